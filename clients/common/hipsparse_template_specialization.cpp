@@ -9387,4 +9387,906 @@ namespace hipsparse
     }
 #endif
 
+#if(!defined(CUDART_VERSION))
+    template <>
+    hipsparseStatus_t hipsparseXcsrsymperm(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           const int*                P,
+                                           const hipsparseMatDescr_t descrC,
+                                           float*                    csrValC,
+                                           int*                      csrRowPtrC,
+                                           int*                      csrColIndC)
+    {
+        return hipsparseScsrsymperm(handle,
+                                    m,
+                                    nnz,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    P,
+                                    descrC,
+                                    csrValC,
+                                    csrRowPtrC,
+                                    csrColIndC);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrsymperm(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           const int*                P,
+                                           const hipsparseMatDescr_t descrC,
+                                           double*                   csrValC,
+                                           int*                      csrRowPtrC,
+                                           int*                      csrColIndC)
+    {
+        return hipsparseDcsrsymperm(handle,
+                                    m,
+                                    nnz,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    P,
+                                    descrC,
+                                    csrValC,
+                                    csrRowPtrC,
+                                    csrColIndC);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrsymperm(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipComplex*         csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           const int*                P,
+                                           const hipsparseMatDescr_t descrC,
+                                           hipComplex*               csrValC,
+                                           int*                      csrRowPtrC,
+                                           int*                      csrColIndC)
+    {
+        return hipsparseCcsrsymperm(handle,
+                                    m,
+                                    nnz,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    P,
+                                    descrC,
+                                    csrValC,
+                                    csrRowPtrC,
+                                    csrColIndC);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrsymperm(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipDoubleComplex*   csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           const int*                P,
+                                           const hipsparseMatDescr_t descrC,
+                                           hipDoubleComplex*         csrValC,
+                                           int*                      csrRowPtrC,
+                                           int*                      csrColIndC)
+    {
+        return hipsparseZcsrsymperm(handle,
+                                    m,
+                                    nnz,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    P,
+                                    descrC,
+                                    csrValC,
+                                    csrRowPtrC,
+                                    csrColIndC);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnz,
+                                           const float*           csrValA,
+                                           float*                 csrValB,
+                                           hipsparsePermuteInfo_t info)
+    {
+        return hipsparseScsrpermute(handle, nnz, csrValA, csrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnz,
+                                           const double*          csrValA,
+                                           double*                csrValB,
+                                           hipsparsePermuteInfo_t info)
+    {
+        return hipsparseDcsrpermute(handle, nnz, csrValA, csrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnz,
+                                           const hipComplex*      csrValA,
+                                           hipComplex*            csrValB,
+                                           hipsparsePermuteInfo_t info)
+    {
+        return hipsparseCcsrpermute(handle, nnz, csrValA, csrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrpermute(hipsparseHandle_t       handle,
+                                           int                     nnz,
+                                           const hipDoubleComplex* csrValA,
+                                           hipDoubleComplex*       csrValB,
+                                           hipsparsePermuteInfo_t  info)
+    {
+        return hipsparseZcsrpermute(handle, nnz, csrValA, csrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnzb,
+                                           int                    blockDim,
+                                           const float*           bsrValA,
+                                           float*                 bsrValB,
+                                           hipsparsePermuteInfo_t info)
+    {
+        return hipsparseSbsrpermute(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnzb,
+                                           int                    blockDim,
+                                           const double*          bsrValA,
+                                           double*                bsrValB,
+                                           hipsparsePermuteInfo_t info)
+    {
+        return hipsparseDbsrpermute(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnzb,
+                                           int                    blockDim,
+                                           const hipComplex*      bsrValA,
+                                           hipComplex*            bsrValB,
+                                           hipsparsePermuteInfo_t info)
+    {
+        return hipsparseCbsrpermute(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrpermute(hipsparseHandle_t       handle,
+                                           int                     nnzb,
+                                           int                     blockDim,
+                                           const hipDoubleComplex* bsrValA,
+                                           hipDoubleComplex*       bsrValB,
+                                           hipsparsePermuteInfo_t  info)
+    {
+        return hipsparseZbsrpermute(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0(hipsparseHandle_t         handle,
+                                          hipsparseItilu0Alg_t      alg,
+                                          int                       option,
+                                          int*                      maxIter,
+                                          float                     tol,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const float*              csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          float*                    csrValM,
+                                          size_t                    bufferSize,
+                                          void*                     pBuffer)
+    {
+        return hipsparseScsritilu0(handle,
+                                   alg,
+                                   option,
+                                   maxIter,
+                                   tol,
+                                   m,
+                                   nnz,
+                                   descrA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   csrValM,
+                                   bufferSize,
+                                   pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0(hipsparseHandle_t         handle,
+                                          hipsparseItilu0Alg_t      alg,
+                                          int                       option,
+                                          int*                      maxIter,
+                                          double                    tol,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const double*             csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          double*                   csrValM,
+                                          size_t                    bufferSize,
+                                          void*                     pBuffer)
+    {
+        return hipsparseDcsritilu0(handle,
+                                   alg,
+                                   option,
+                                   maxIter,
+                                   tol,
+                                   m,
+                                   nnz,
+                                   descrA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   csrValM,
+                                   bufferSize,
+                                   pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0(hipsparseHandle_t         handle,
+                                          hipsparseItilu0Alg_t      alg,
+                                          int                       option,
+                                          int*                      maxIter,
+                                          float                     tol,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipComplex*         csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          hipComplex*               csrValM,
+                                          size_t                    bufferSize,
+                                          void*                     pBuffer)
+    {
+        return hipsparseCcsritilu0(handle,
+                                   alg,
+                                   option,
+                                   maxIter,
+                                   tol,
+                                   m,
+                                   nnz,
+                                   descrA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   csrValM,
+                                   bufferSize,
+                                   pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0(hipsparseHandle_t         handle,
+                                          hipsparseItilu0Alg_t      alg,
+                                          int                       option,
+                                          int*                      maxIter,
+                                          double                    tol,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const hipDoubleComplex*   csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          hipDoubleComplex*         csrValM,
+                                          size_t                    bufferSize,
+                                          void*                     pBuffer)
+    {
+        return hipsparseZcsritilu0(handle,
+                                   alg,
+                                   option,
+                                   maxIter,
+                                   tol,
+                                   m,
+                                   nnz,
+                                   descrA,
+                                   csrValA,
+                                   csrRowPtrA,
+                                   csrColIndA,
+                                   csrValM,
+                                   bufferSize,
+                                   pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0_history(hipsparseHandle_t    handle,
+                                                  hipsparseItilu0Alg_t alg,
+                                                  int*                 niter,
+                                                  float*               data,
+                                                  size_t               bufferSize,
+                                                  void*                pBuffer)
+    {
+        return hipsparseScsritilu0_history(handle, alg, niter, data, bufferSize, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0_history(hipsparseHandle_t    handle,
+                                                  hipsparseItilu0Alg_t alg,
+                                                  int*                 niter,
+                                                  double*              data,
+                                                  size_t               bufferSize,
+                                                  void*                pBuffer)
+    {
+        return hipsparseDcsritilu0_history(handle, alg, niter, data, bufferSize, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0_history(hipsparseHandle_t    handle,
+                                                  hipsparseItilu0Alg_t alg,
+                                                  int*                 niter,
+                                                  float*               data,
+                                                  size_t               bufferSize,
+                                                  void*                pBuffer)
+    {
+        return hipsparseCcsritilu0_history(handle, alg, niter, data, bufferSize, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritilu0_history(hipsparseHandle_t    handle,
+                                                  hipsparseItilu0Alg_t alg,
+                                                  int*                 niter,
+                                                  double*              data,
+                                                  size_t               bufferSize,
+                                                  void*                pBuffer)
+    {
+        return hipsparseZcsritilu0_history(handle, alg, niter, data, bufferSize, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritic0(hipsparseHandle_t         handle,
+                                         hipsparseItilu0Alg_t      alg,
+                                         int                       option,
+                                         int*                      maxIter,
+                                         float                     tol,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipsparseMatDescr_t descrA,
+                                         const float*              csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         float*                    csrValM,
+                                         size_t                    bufferSize,
+                                         void*                     pBuffer)
+    {
+        return hipsparseScsritic0(handle,
+                                  alg,
+                                  option,
+                                  maxIter,
+                                  tol,
+                                  m,
+                                  nnz,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  csrValM,
+                                  bufferSize,
+                                  pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritic0(hipsparseHandle_t         handle,
+                                         hipsparseItilu0Alg_t      alg,
+                                         int                       option,
+                                         int*                      maxIter,
+                                         double                    tol,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipsparseMatDescr_t descrA,
+                                         const double*             csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         double*                   csrValM,
+                                         size_t                    bufferSize,
+                                         void*                     pBuffer)
+    {
+        return hipsparseDcsritic0(handle,
+                                  alg,
+                                  option,
+                                  maxIter,
+                                  tol,
+                                  m,
+                                  nnz,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  csrValM,
+                                  bufferSize,
+                                  pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritic0(hipsparseHandle_t         handle,
+                                         hipsparseItilu0Alg_t      alg,
+                                         int                       option,
+                                         int*                      maxIter,
+                                         float                     tol,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipComplex*         csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         hipComplex*               csrValM,
+                                         size_t                    bufferSize,
+                                         void*                     pBuffer)
+    {
+        return hipsparseCcsritic0(handle,
+                                  alg,
+                                  option,
+                                  maxIter,
+                                  tol,
+                                  m,
+                                  nnz,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  csrValM,
+                                  bufferSize,
+                                  pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsritic0(hipsparseHandle_t         handle,
+                                         hipsparseItilu0Alg_t      alg,
+                                         int                       option,
+                                         int*                      maxIter,
+                                         double                    tol,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipsparseMatDescr_t descrA,
+                                         const hipDoubleComplex*   csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         hipDoubleComplex*         csrValM,
+                                         size_t                    bufferSize,
+                                         void*                     pBuffer)
+    {
+        return hipsparseZcsritic0(handle,
+                                  alg,
+                                  option,
+                                  maxIter,
+                                  tol,
+                                  m,
+                                  nnz,
+                                  descrA,
+                                  csrValA,
+                                  csrRowPtrA,
+                                  csrColIndA,
+                                  csrValM,
+                                  bufferSize,
+                                  pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsriluk(hipsparseHandle_t  handle,
+                                        const float*       csrValA,
+                                        hipsparseIluInfo_t info,
+                                        float*             csrValL,
+                                        int*               csrColIndL,
+                                        float*             csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseScsriluk(handle, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsriluk(hipsparseHandle_t  handle,
+                                        const double*      csrValA,
+                                        hipsparseIluInfo_t info,
+                                        double*            csrValL,
+                                        int*               csrColIndL,
+                                        double*            csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseDcsriluk(handle, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsriluk(hipsparseHandle_t  handle,
+                                        const hipComplex*  csrValA,
+                                        hipsparseIluInfo_t info,
+                                        hipComplex*        csrValL,
+                                        int*               csrColIndL,
+                                        hipComplex*        csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseCcsriluk(handle, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsriluk(hipsparseHandle_t       handle,
+                                        const hipDoubleComplex* csrValA,
+                                        hipsparseIluInfo_t      info,
+                                        hipDoubleComplex*       csrValL,
+                                        int*                    csrColIndL,
+                                        hipDoubleComplex*       csrValU,
+                                        int*                    csrColIndU)
+    {
+        return hipsparseZcsriluk(handle, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilutNnz(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const float*              csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           float                     tol,
+                                           int                       maxFill,
+                                           const hipsparseMatDescr_t descrL,
+                                           int*                      csrRowPtrL,
+                                           int*                      nnzL,
+                                           const hipsparseMatDescr_t descrU,
+                                           int*                      csrRowPtrU,
+                                           int*                      nnzU,
+                                           hipsparseIluInfo_t        info)
+    {
+        return hipsparseScsrilutNnz(handle,
+                                    m,
+                                    nnzA,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    tol,
+                                    maxFill,
+                                    descrL,
+                                    csrRowPtrL,
+                                    nnzL,
+                                    descrU,
+                                    csrRowPtrU,
+                                    nnzU,
+                                    info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilutNnz(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const double*             csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           double                    tol,
+                                           int                       maxFill,
+                                           const hipsparseMatDescr_t descrL,
+                                           int*                      csrRowPtrL,
+                                           int*                      nnzL,
+                                           const hipsparseMatDescr_t descrU,
+                                           int*                      csrRowPtrU,
+                                           int*                      nnzU,
+                                           hipsparseIluInfo_t        info)
+    {
+        return hipsparseDcsrilutNnz(handle,
+                                    m,
+                                    nnzA,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    tol,
+                                    maxFill,
+                                    descrL,
+                                    csrRowPtrL,
+                                    nnzL,
+                                    descrU,
+                                    csrRowPtrU,
+                                    nnzU,
+                                    info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilutNnz(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipComplex*         csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           float                     tol,
+                                           int                       maxFill,
+                                           const hipsparseMatDescr_t descrL,
+                                           int*                      csrRowPtrL,
+                                           int*                      nnzL,
+                                           const hipsparseMatDescr_t descrU,
+                                           int*                      csrRowPtrU,
+                                           int*                      nnzU,
+                                           hipsparseIluInfo_t        info)
+    {
+        return hipsparseCcsrilutNnz(handle,
+                                    m,
+                                    nnzA,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    tol,
+                                    maxFill,
+                                    descrL,
+                                    csrRowPtrL,
+                                    nnzL,
+                                    descrU,
+                                    csrRowPtrU,
+                                    nnzU,
+                                    info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilutNnz(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const hipDoubleComplex*   csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           double                    tol,
+                                           int                       maxFill,
+                                           const hipsparseMatDescr_t descrL,
+                                           int*                      csrRowPtrL,
+                                           int*                      nnzL,
+                                           const hipsparseMatDescr_t descrU,
+                                           int*                      csrRowPtrU,
+                                           int*                      nnzU,
+                                           hipsparseIluInfo_t        info)
+    {
+        return hipsparseZcsrilutNnz(handle,
+                                    m,
+                                    nnzA,
+                                    descrA,
+                                    csrValA,
+                                    csrRowPtrA,
+                                    csrColIndA,
+                                    tol,
+                                    maxFill,
+                                    descrL,
+                                    csrRowPtrL,
+                                    nnzL,
+                                    descrU,
+                                    csrRowPtrU,
+                                    nnzU,
+                                    info);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilut(hipsparseHandle_t  handle,
+                                        hipsparseIluInfo_t info,
+                                        float*             csrValL,
+                                        int*               csrColIndL,
+                                        float*             csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseScsrilut(handle, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilut(hipsparseHandle_t  handle,
+                                        hipsparseIluInfo_t info,
+                                        double*            csrValL,
+                                        int*               csrColIndL,
+                                        double*            csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseDcsrilut(handle, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilut(hipsparseHandle_t  handle,
+                                        hipsparseIluInfo_t info,
+                                        hipComplex*        csrValL,
+                                        int*               csrColIndL,
+                                        hipComplex*        csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseCcsrilut(handle, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXcsrilut(hipsparseHandle_t  handle,
+                                        hipsparseIluInfo_t info,
+                                        hipDoubleComplex*  csrValL,
+                                        int*               csrColIndL,
+                                        hipDoubleComplex*  csrValU,
+                                        int*               csrColIndU)
+    {
+        return hipsparseZcsrilut(handle, info, csrValL, csrColIndL, csrValU, csrColIndU);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiag(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const float*              bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       blockDim,
+                                        float*                    blockDiag)
+    {
+        return hipsparseSbsrdiag(
+            handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiag(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const double*             bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       blockDim,
+                                        double*                   blockDiag)
+    {
+        return hipsparseDbsrdiag(
+            handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiag(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const hipComplex*         bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       blockDim,
+                                        hipComplex*               blockDiag)
+    {
+        return hipsparseCbsrdiag(
+            handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiag(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const hipDoubleComplex*   bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       blockDim,
+                                        hipDoubleComplex*         blockDiag)
+    {
+        return hipsparseZbsrdiag(
+            handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiaginv(hipsparseHandle_t handle,
+                                           int               mb,
+                                           int               blockDim,
+                                           float*            blockDiag,
+                                           int*              position)
+    {
+        return hipsparseSbsrdiaginv(handle, mb, blockDim, blockDiag, position);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiaginv(hipsparseHandle_t handle,
+                                           int               mb,
+                                           int               blockDim,
+                                           double*           blockDiag,
+                                           int*              position)
+    {
+        return hipsparseDbsrdiaginv(handle, mb, blockDim, blockDiag, position);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiaginv(hipsparseHandle_t handle,
+                                           int               mb,
+                                           int               blockDim,
+                                           hipComplex*       blockDiag,
+                                           int*              position)
+    {
+        return hipsparseCbsrdiaginv(handle, mb, blockDim, blockDiag, position);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiaginv(hipsparseHandle_t handle,
+                                           int               mb,
+                                           int               blockDim,
+                                           hipDoubleComplex* blockDiag,
+                                           int*              position)
+    {
+        return hipsparseZbsrdiaginv(handle, mb, blockDim, blockDiag, position);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiagmv(hipsparseHandle_t    handle,
+                                          hipsparseDirection_t dirA,
+                                          int                  mb,
+                                          int                  blockDim,
+                                          const float*         alpha,
+                                          const float*         blockDiag,
+                                          const float*         x,
+                                          const float*         beta,
+                                          float*               y,
+                                          void*                pBuffer)
+    {
+        return hipsparseSbsrdiagmv(
+            handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiagmv(hipsparseHandle_t    handle,
+                                          hipsparseDirection_t dirA,
+                                          int                  mb,
+                                          int                  blockDim,
+                                          const double*        alpha,
+                                          const double*        blockDiag,
+                                          const double*        x,
+                                          const double*        beta,
+                                          double*              y,
+                                          void*                pBuffer)
+    {
+        return hipsparseDbsrdiagmv(
+            handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiagmv(hipsparseHandle_t    handle,
+                                          hipsparseDirection_t dirA,
+                                          int                  mb,
+                                          int                  blockDim,
+                                          const hipComplex*    alpha,
+                                          const hipComplex*    blockDiag,
+                                          const hipComplex*    x,
+                                          const hipComplex*    beta,
+                                          hipComplex*          y,
+                                          void*                pBuffer)
+    {
+        return hipsparseCbsrdiagmv(
+            handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+    }
+
+    template <>
+    hipsparseStatus_t hipsparseXbsrdiagmv(hipsparseHandle_t       handle,
+                                          hipsparseDirection_t    dirA,
+                                          int                     mb,
+                                          int                     blockDim,
+                                          const hipDoubleComplex* alpha,
+                                          const hipDoubleComplex* blockDiag,
+                                          const hipDoubleComplex* x,
+                                          const hipDoubleComplex* beta,
+                                          hipDoubleComplex*       y,
+                                          void*                   pBuffer)
+    {
+        return hipsparseZbsrdiagmv(
+            handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+    }
+#endif
+
 } // namespace hipsparse
@@ -1605,6 +1605,143 @@ namespace hipsparse
                                          int*                      reordering,
                                          hipsparseColorInfo_t      info);
 #endif
+
+#if(!defined(CUDART_VERSION))
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrsymperm(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnz,
+                                           const hipsparseMatDescr_t descrA,
+                                           const T*                  csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           const int*                P,
+                                           const hipsparseMatDescr_t descrC,
+                                           T*                        csrValC,
+                                           int*                      csrRowPtrC,
+                                           int*                      csrColIndC);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnz,
+                                           const T*               csrValA,
+                                           T*                     csrValB,
+                                           hipsparsePermuteInfo_t info);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXbsrpermute(hipsparseHandle_t      handle,
+                                           int                    nnzb,
+                                           int                    blockDim,
+                                           const T*               bsrValA,
+                                           T*                     bsrValB,
+                                           hipsparsePermuteInfo_t info);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsritilu0(hipsparseHandle_t         handle,
+                                          hipsparseItilu0Alg_t      alg,
+                                          int                       option,
+                                          int*                      maxIter,
+                                          floating_data_t<T>        tol,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const T*                  csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          T*                        csrValM,
+                                          size_t                    bufferSize,
+                                          void*                     pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsritilu0_history(hipsparseHandle_t    handle,
+                                                  hipsparseItilu0Alg_t alg,
+                                                  int*                 niter,
+                                                  floating_data_t<T>*  data,
+                                                  size_t               bufferSize,
+                                                  void*                pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsritic0(hipsparseHandle_t         handle,
+                                         hipsparseItilu0Alg_t      alg,
+                                         int                       option,
+                                         int*                      maxIter,
+                                         floating_data_t<T>        tol,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipsparseMatDescr_t descrA,
+                                         const T*                  csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         T*                        csrValM,
+                                         size_t                    bufferSize,
+                                         void*                     pBuffer);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsriluk(hipsparseHandle_t  handle,
+                                        const T*           csrValA,
+                                        hipsparseIluInfo_t info,
+                                        T*                 csrValL,
+                                        int*               csrColIndL,
+                                        T*                 csrValU,
+                                        int*               csrColIndU);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrilutNnz(hipsparseHandle_t         handle,
+                                           int                       m,
+                                           int                       nnzA,
+                                           const hipsparseMatDescr_t descrA,
+                                           const T*                  csrValA,
+                                           const int*                csrRowPtrA,
+                                           const int*                csrColIndA,
+                                           floating_data_t<T>        tol,
+                                           int                       maxFill,
+                                           const hipsparseMatDescr_t descrL,
+                                           int*                      csrRowPtrL,
+                                           int*                      nnzL,
+                                           const hipsparseMatDescr_t descrU,
+                                           int*                      csrRowPtrU,
+                                           int*                      nnzU,
+                                           hipsparseIluInfo_t        info);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXcsrilut(hipsparseHandle_t  handle,
+                                        hipsparseIluInfo_t info,
+                                        T*                 csrValL,
+                                        int*               csrColIndL,
+                                        T*                 csrValU,
+                                        int*               csrColIndU);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXbsrdiag(hipsparseHandle_t         handle,
+                                        hipsparseDirection_t      dirA,
+                                        int                       mb,
+                                        int                       nnzb,
+                                        const hipsparseMatDescr_t descrA,
+                                        const T*                  bsrValA,
+                                        const int*                bsrRowPtrA,
+                                        const int*                bsrColIndA,
+                                        int                       blockDim,
+                                        T*                        blockDiag);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXbsrdiaginv(hipsparseHandle_t handle,
+                                           int               mb,
+                                           int               blockDim,
+                                           T*                blockDiag,
+                                           int*              position);
+
+    template <typename T>
+    hipsparseStatus_t hipsparseXbsrdiagmv(hipsparseHandle_t    handle,
+                                          hipsparseDirection_t dirA,
+                                          int                  mb,
+                                          int                  blockDim,
+                                          const T*             alpha,
+                                          const T*             blockDiag,
+                                          const T*             x,
+                                          const T*             beta,
+                                          T*                   y,
+                                          void*                pBuffer);
+#endif
 } // namespace hipsparse
 
 #endif // _HIPSPARSE_HPP_
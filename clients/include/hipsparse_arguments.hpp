@@ -83,6 +83,7 @@ struct Arguments
     hipsparseHybPartition_t part;
     hipsparseDiagType_t     diag_type;
     hipsparseFillMode_t     fill_mode;
+    hipsparseMatrixType_t   matrix_type;
     hipsparseSolvePolicy_t  solve_policy;
 
     hipsparseDirection_t dirA;
@@ -111,6 +112,13 @@ struct Arguments
     int permute;
     int gtsv_alg;
     int gpsv_alg;
+    int itilu0_alg;
+    int fill_level;
+    int semiring;
+    int sigma;
+
+    int solver_alg;
+    int solver_precond;
 
     int unit_check;
     int timing;
@@ -159,6 +167,7 @@ struct Arguments
         this->part         = HIPSPARSE_HYB_PARTITION_AUTO;
         this->diag_type    = HIPSPARSE_DIAG_TYPE_NON_UNIT;
         this->fill_mode    = HIPSPARSE_FILL_MODE_LOWER;
+        this->matrix_type  = HIPSPARSE_MATRIX_TYPE_GENERAL;
         this->solve_policy = HIPSPARSE_SOLVE_POLICY_NO_LEVEL;
 
         this->dirA    = HIPSPARSE_DIRECTION_ROW;
@@ -183,10 +192,17 @@ struct Arguments
         this->boostval     = 1.0;
         this->boostvali    = 0.0;
 
-        this->ell_width = 0;
-        this->permute   = 0;
-        this->gtsv_alg  = 0;
-        this->gpsv_alg  = 0;
+        this->ell_width  = 0;
+        this->permute    = 0;
+        this->gtsv_alg   = 0;
+        this->gpsv_alg   = 0;
+        this->itilu0_alg = 0;
+        this->fill_level = 0;
+        this->semiring   = 0;
+        this->sigma      = 1;
+
+        this->solver_alg     = 0;
+        this->solver_precond = 0;
 
         this->unit_check = 1;
         this->timing     = 0;
@@ -149,6 +149,12 @@ constexpr auto hipsparse_format2string(hipsparseFormat_t format)
         return "csc";
     case HIPSPARSE_FORMAT_BLOCKED_ELL:
         return "bell";
+    case HIPSPARSE_FORMAT_SELL:
+        return "sell";
+    case HIPSPARSE_FORMAT_ELL:
+        return "ell";
+    case HIPSPARSE_FORMAT_DIA:
+        return "dia";
     }
     return "invalid";
 }
@@ -0,0 +1,437 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_AMG_HPP
+#define TESTING_AMG_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_amg_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int32_t              m         = 100;
+    int64_t              nnz       = 100;
+    size_t               safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* db   = (float*)db_managed.get();
+    float* dx   = (float*)dx_managed.get();
+
+    // Multigrid structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t b, x;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, m, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&b, m, db, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, m, dx, dataType), "success");
+
+    hipsparseAmgDescr_t descr;
+
+    int     numLevels;
+    int64_t rows;
+    int64_t nnzLevel;
+
+    // Create descriptor
+    verify_hipsparse_status_invalid_value(hipsparseAmg_createDescr(nullptr),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_success(hipsparseAmg_createDescr(&descr), "success");
+
+    // Parameters
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setParameters(nullptr, 0.08, 1.0, 10, 64),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setParameters(descr, -0.1, 1.0, 10, 64),
+                                          "Error: strengthThreshold is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setParameters(descr, 1.5, 1.0, 10, 64),
+                                          "Error: strengthThreshold is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setParameters(descr, 0.08, -1.0, 10, 64),
+                                          "Error: prolongatorWeight is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setParameters(descr, 0.08, 1.0, 0, 64),
+                                          "Error: maxLevels is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setParameters(descr, 0.08, 1.0, 10, -1),
+                                          "Error: coarseSize is invalid");
+
+    // Smoother
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_setSmoother(nullptr, HIPSPARSE_SMOOTHER_JACOBI, 1, 1, 1.0),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_setSmoother(descr, (hipsparseSmootherAlg_t)4, 1, 1, 1.0),
+        "Error: alg is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_setSmoother(descr, HIPSPARSE_SMOOTHER_JACOBI, -1, 1, 1.0),
+        "Error: preSweeps is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_setSmoother(descr, HIPSPARSE_SMOOTHER_JACOBI, 1, -1, 1.0),
+        "Error: postSweeps is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_setSmoother(descr, HIPSPARSE_SMOOTHER_JACOBI, 1, 1, 0.0),
+        "Error: omega is invalid");
+
+    // Setup
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setup(nullptr, descr, A, dataType),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setup(handle, nullptr, A, dataType),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setup(handle, descr, nullptr, dataType),
+                                          "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_setup(handle, descr, A, HIP_R_64F),
+                                          "Error: computeType does not match matA");
+
+    // Levels
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_getLevel(nullptr, 0, &numLevels, &rows, &nnzLevel), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_getLevel(descr, 0, nullptr, &rows, &nnzLevel), "Error: numLevels is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_getLevel(descr, 0, &numLevels, nullptr, &nnzLevel), "Error: rows is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_getLevel(descr, 0, &numLevels, &rows, nullptr), "Error: nnz is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_getLevel(descr, 0, &numLevels, &rows, &nnzLevel),
+        "Error: descr has not been set up");
+
+    // V-cycle
+    verify_hipsparse_status_invalid_value(hipsparseAmg_vcycle(nullptr, descr, A, b, x, dataType),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_vcycle(handle, nullptr, A, b, x, dataType), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_vcycle(handle, descr, nullptr, b, x, dataType), "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_vcycle(handle, descr, A, nullptr, x, dataType), "Error: vecB is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseAmg_vcycle(handle, descr, A, b, nullptr, dataType), "Error: vecX is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseAmg_vcycle(handle, descr, A, b, x, dataType),
+                                          "Error: descr has not been set up");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseAmg_destroyDescr(descr), "success");
+    verify_hipsparse_status_success(hipsparseAmg_destroyDescr(nullptr), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(b), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+#endif
+}
+
+//
+// Euclidean norm of r = b - A x.
+//
+template <typename T>
+double amg_residual(int                     m,
+                    const std::vector<int>& csr_row_ptr,
+                    const std::vector<int>& csr_col_ind,
+                    const std::vector<T>&   csr_val,
+                    const std::vector<T>&   b,
+                    const std::vector<T>&   x,
+                    hipsparseIndexBase_t    idx_base)
+{
+    double norm = 0.0;
+    for(int i = 0; i < m; ++i)
+    {
+        T r = b[i];
+        for(int k = csr_row_ptr[i] - idx_base; k < csr_row_ptr[i + 1] - idx_base; ++k)
+        {
+            r = r - csr_val[k] * x[csr_col_ind[k] - idx_base];
+        }
+
+        norm += testing_abs(r) * testing_abs(r);
+    }
+
+    return std::sqrt(norm);
+}
+
+//
+// Convergence of the host reference V-cycle on the 2D Laplacian, which does not need a device.
+//
+template <typename T>
+void testing_amg_host(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                    ndim     = argus.M;
+    hipsparseIndexBase_t   idx_base = argus.baseA;
+    hipsparseSmootherAlg_t alg      = (hipsparseSmootherAlg_t)argus.solver_alg;
+    double                 omega    = (alg == HIPSPARSE_SMOOTHER_SOR) ? 1.2 : 2.0 / 3.0;
+
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    srand(12345ULL);
+
+    int m = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    std::vector<host_amg_level<T>> levels;
+
+    hipsparseStatus_t status = host_amg_setup(
+        m, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base, 0.08, 4.0 / 3.0, 10, 64, levels);
+    verify_hipsparse_status_success(status, "host_amg_setup");
+
+    // The Laplacian is coarsened down to the direct solve
+    int expected_direct = 1;
+    int direct          = !levels.back().inverse.empty();
+    unit_check_general(1, 1, 1, &expected_direct, &direct);
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m, make_DataType<T>(0.0));
+
+    hipsparseInit<T>(hb, 1, m);
+
+    // Every V-cycle reduces the residual
+    int    expected_decrease = 1;
+    double residual = amg_residual(m, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hb, hx, idx_base);
+    for(int cycle = 0; cycle < 5; ++cycle)
+    {
+        host_amg_vcycle(alg, 1, 1, omega, levels, 0, hb.data(), hx.data());
+
+        double residual_cycle
+            = amg_residual(m, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hb, hx, idx_base);
+
+        int decrease = residual_cycle < residual;
+        unit_check_general(1, 1, 1, &expected_decrease, &decrease);
+
+        residual = residual_cycle;
+    }
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_amg(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                    ndim        = argus.M;
+    hipsparseIndexBase_t   idx_base    = argus.baseA;
+    hipsparseSmootherAlg_t alg         = (hipsparseSmootherAlg_t)argus.solver_alg;
+    double                 omega       = (alg == HIPSPARSE_SMOOTHER_SOR) ? 1.2 : 2.0 / 3.0;
+    int                    sweeps      = 2;
+    double                 theta       = 0.08;
+    double                 weight      = 4.0 / 3.0;
+    int                    max_levels  = 10;
+    int64_t                coarse_size = 32;
+
+    // Data type
+    hipDataType typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    srand(12345ULL);
+
+    int m     = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int nnz_A = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m);
+
+    hipsparseInit<T>(hb, 1, m);
+    hipsparseInit<T>(hx, 1, m);
+
+    std::vector<T> hx_gold(hx);
+
+    // allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_A), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dptr = (int*)dptr_managed.get();
+    int* dcol = (int*)dcol_managed.get();
+    T*   dval = (T*)dval_managed.get();
+    T*   db   = (T*)db_managed.get();
+    T*   dx   = (T*)dx_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Create structures
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             m,
+                                             nnz_A,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             typeT));
+
+    hipsparseDnVecDescr_t b, x;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&b, m, db, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+
+    hipsparseAmgDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseAmg_createDescr(&descr));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseAmg_setParameters(descr, theta, weight, max_levels, coarse_size));
+    CHECK_HIPSPARSE_ERROR(hipsparseAmg_setSmoother(descr, alg, sweeps, sweeps, omega));
+    CHECK_HIPSPARSE_ERROR(hipsparseAmg_setup(handle, descr, A, typeT));
+
+    if(argus.unit_check)
+    {
+        // The first setup computes the hierarchy, the second one reuses it for new values
+        for(int setup = 0; setup < 2; ++setup)
+        {
+            if(setup == 1)
+            {
+                for(int k = 0; k < nnz_A; ++k)
+                {
+                    hcsr_val[k] = make_DataType<T>(2.0) * hcsr_val[k];
+                }
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+                CHECK_HIPSPARSE_ERROR(hipsparseAmg_setup(handle, descr, A, typeT));
+
+                hx_gold = hx;
+            }
+
+            std::vector<host_amg_level<T>> levels;
+            CHECK_HIPSPARSE_ERROR(host_amg_setup(m,
+                                                 hcsr_row_ptr,
+                                                 hcsr_col_ind,
+                                                 hcsr_val,
+                                                 idx_base,
+                                                 theta,
+                                                 weight,
+                                                 max_levels,
+                                                 coarse_size,
+                                                 levels));
+
+            // Levels
+            for(size_t l = 0; l < levels.size(); ++l)
+            {
+                int     num_levels;
+                int64_t rows;
+                int64_t nnz;
+                CHECK_HIPSPARSE_ERROR(
+                    hipsparseAmg_getLevel(descr, static_cast<int>(l), &num_levels, &rows, &nnz));
+
+                int     levels_gold = static_cast<int>(levels.size());
+                int64_t rows_gold   = levels[l].n;
+                int64_t nnz_gold    = levels[l].csr_row_ptr[levels[l].n];
+
+                unit_check_general(1, 1, 1, &levels_gold, &num_levels);
+                unit_check_general(1, 1, 1, &rows_gold, &rows);
+                unit_check_general(1, 1, 1, &nnz_gold, &nnz);
+            }
+
+            // V-cycle
+            CHECK_HIPSPARSE_ERROR(hipsparseAmg_vcycle(handle, descr, A, b, x, typeT));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+            // CPU
+            host_amg_vcycle(alg, sweeps, sweeps, omega, levels, 0, hb.data(), hx_gold.data());
+
+            unit_check_near(1, m, 1, hx_gold.data(), hx.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseAmg_vcycle(handle, descr, A, b, x, typeT));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseAmg_vcycle(handle, descr, A, b, x, typeT));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz_A,
+                            display_key_t::algorithm,
+                            argus.solver_alg,
+                            display_key_t::iters,
+                            sweeps,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseAmg_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(b));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_AMG_HPP
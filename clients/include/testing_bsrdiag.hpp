@@ -0,0 +1,414 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_BSRDIAG_HPP
+#define TESTING_BSRDIAG_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_bsrdiag_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    static constexpr int MB        = 10;
+    static constexpr int NNZB      = 10;
+    static constexpr int BLOCK_DIM = 2;
+
+    static constexpr hipsparseDirection_t dir = HIPSPARSE_DIRECTION_ROW;
+
+    T h_alpha = make_DataType<T>(1.0);
+    T h_beta  = make_DataType<T>(0.0);
+
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    const size_t val_size  = sizeof(T) * NNZB * BLOCK_DIM * BLOCK_DIM;
+    const size_t diag_size = sizeof(T) * MB * BLOCK_DIM * BLOCK_DIM;
+    const size_t vec_size  = sizeof(T) * MB * BLOCK_DIM;
+
+    auto m_ptr    = hipsparse_unique_ptr{device_malloc(sizeof(int) * (MB + 1)), device_free};
+    auto m_col    = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZB), device_free};
+    auto m_val    = hipsparse_unique_ptr{device_malloc(val_size), device_free};
+    auto m_diag   = hipsparse_unique_ptr{device_malloc(diag_size), device_free};
+    auto m_x      = hipsparse_unique_ptr{device_malloc(vec_size), device_free};
+    auto m_y      = hipsparse_unique_ptr{device_malloc(vec_size), device_free};
+    auto m_buffer = hipsparse_unique_ptr{device_malloc(sizeof(int) * (MB + 1)), device_free};
+
+    int*  d_ptr    = (int*)m_ptr.get();
+    int*  d_col    = (int*)m_col.get();
+    T*    d_val    = (T*)m_val.get();
+    T*    d_diag   = (T*)m_diag.get();
+    T*    d_x      = (T*)m_x.get();
+    T*    d_y      = (T*)m_y.get();
+    void* d_buffer = (void*)m_buffer.get();
+
+    int    position;
+    size_t buffer_size;
+
+    // Extraction
+    status = hipsparseXbsrdiag(
+        nullptr, dir, MB, NNZB, descrA, d_val, d_ptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXbsrdiag(
+        handle, dir, -1, NNZB, descrA, d_val, d_ptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_size(status, "Error: mb is invalid");
+
+    status = hipsparseXbsrdiag(handle, dir, MB, -1, descrA, d_val, d_ptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_size(status, "Error: nnzb is invalid");
+
+    status = hipsparseXbsrdiag(
+        handle, dir, MB, NNZB, nullptr, d_val, d_ptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descrA is nullptr");
+
+    status = hipsparseXbsrdiag(
+        handle, dir, MB, NNZB, descrA, (T*)nullptr, d_ptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrValA is nullptr");
+
+    status = hipsparseXbsrdiag(
+        handle, dir, MB, NNZB, descrA, d_val, nullptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrRowPtrA is nullptr");
+
+    status = hipsparseXbsrdiag(
+        handle, dir, MB, NNZB, descrA, d_val, d_ptr, nullptr, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrColIndA is nullptr");
+
+    status = hipsparseXbsrdiag(handle, dir, MB, NNZB, descrA, d_val, d_ptr, d_col, 0, d_diag);
+    verify_hipsparse_status_invalid_size(status, "Error: blockDim is invalid");
+
+    status = hipsparseXbsrdiag(
+        handle, dir, MB, NNZB, descrA, d_val, d_ptr, d_col, BLOCK_DIM, (T*)nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: blockDiag is nullptr");
+
+    // Symmetric matrices are not supported
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatType(descrA, HIPSPARSE_MATRIX_TYPE_SYMMETRIC));
+    status = hipsparseXbsrdiag(
+        handle, dir, MB, NNZB, descrA, d_val, d_ptr, d_col, BLOCK_DIM, d_diag);
+    verify_hipsparse_status_not_supported(status, "Error: matrix type is not supported");
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatType(descrA, HIPSPARSE_MATRIX_TYPE_GENERAL));
+
+    // Inversion
+    status = hipsparseXbsrdiaginv(nullptr, MB, BLOCK_DIM, d_diag, &position);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXbsrdiaginv(handle, -1, BLOCK_DIM, d_diag, &position);
+    verify_hipsparse_status_invalid_size(status, "Error: mb is invalid");
+
+    status = hipsparseXbsrdiaginv(handle, MB, 0, d_diag, &position);
+    verify_hipsparse_status_invalid_size(status, "Error: blockDim is invalid");
+
+    status = hipsparseXbsrdiaginv(handle, MB, BLOCK_DIM, (T*)nullptr, &position);
+    verify_hipsparse_status_invalid_pointer(status, "Error: blockDiag is nullptr");
+
+    status = hipsparseXbsrdiaginv(handle, MB, BLOCK_DIM, d_diag, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: position is nullptr");
+
+    // Application
+    status = hipsparseXbsrdiagmv_bufferSize(nullptr, MB, &buffer_size);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXbsrdiagmv_bufferSize(handle, -1, &buffer_size);
+    verify_hipsparse_status_invalid_size(status, "Error: mb is invalid");
+
+    status = hipsparseXbsrdiagmv_bufferSize(handle, MB, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: pBufferSizeInBytes is nullptr");
+
+    status = hipsparseXbsrdiagmv(
+        nullptr, dir, MB, BLOCK_DIM, &h_alpha, d_diag, d_x, &h_beta, d_y, d_buffer);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, -1, BLOCK_DIM, &h_alpha, d_diag, d_x, &h_beta, d_y, d_buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: mb is invalid");
+
+    status = hipsparseXbsrdiagmv(handle, dir, MB, 0, &h_alpha, d_diag, d_x, &h_beta, d_y, d_buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: blockDim is invalid");
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, MB, BLOCK_DIM, (T*)nullptr, d_diag, d_x, &h_beta, d_y, d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, MB, BLOCK_DIM, &h_alpha, (T*)nullptr, d_x, &h_beta, d_y, d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: blockDiag is nullptr");
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, MB, BLOCK_DIM, &h_alpha, d_diag, (T*)nullptr, &h_beta, d_y, d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: x is nullptr");
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, MB, BLOCK_DIM, &h_alpha, d_diag, d_x, (T*)nullptr, d_y, d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, MB, BLOCK_DIM, &h_alpha, d_diag, d_x, &h_beta, (T*)nullptr, d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: y is nullptr");
+
+    status = hipsparseXbsrdiagmv(
+        handle, dir, MB, BLOCK_DIM, &h_alpha, d_diag, d_x, &h_beta, d_y, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: pBuffer is nullptr");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_bsrdiag(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  ndim      = argus.M;
+    int                  block_dim = argus.block_dim;
+    hipsparseDirection_t dir       = argus.dirA;
+    hipsparseIndexBase_t idx_base  = argus.baseA;
+
+    T h_alpha = make_DataType<T>(argus.alpha);
+    T h_beta  = make_DataType<T>(argus.beta);
+
+    // hipSPARSE handle and opaque matrix descriptor
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, idx_base));
+
+    // Block structure of the 2D Laplacian
+    std::vector<int> hbsr_row_ptr;
+    std::vector<int> hbsr_col_ind;
+    std::vector<T>   hlaplacian;
+
+    int mb   = gen_2d_laplacian(ndim, hbsr_row_ptr, hbsr_col_ind, hlaplacian, idx_base);
+    int nnzb = (mb > 0) ? hbsr_row_ptr[mb] - idx_base : 0;
+    int m    = mb * block_dim;
+
+    const int block_size = block_dim * block_dim;
+
+    // Dense blocks, the diagonal blocks are diagonally dominant and non symmetric
+    std::vector<T> hbsr_val(static_cast<size_t>(block_size) * nnzb);
+    for(int i = 0; i < mb; ++i)
+    {
+        for(int k = hbsr_row_ptr[i] - idx_base; k < hbsr_row_ptr[i + 1] - idx_base; ++k)
+        {
+            const int j = hbsr_col_ind[k] - idx_base;
+
+            for(int e = 0; e < block_size; ++e)
+            {
+                const int    r     = e / block_dim;
+                const int    c     = e % block_dim;
+                const double value = ((3 * i + 5 * j + 7 * r + 11 * c) % 13) / 13.0 - 0.5;
+
+                hbsr_val[static_cast<size_t>(block_size) * k + e]
+                    = make_DataType<T>((i == j && r == c) ? 2.0 * block_dim + value : value);
+            }
+        }
+    }
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(m);
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy, 1, m);
+
+    // allocate memory on device
+    const size_t val_size  = sizeof(T) * hbsr_val.size();
+    const size_t diag_size = sizeof(T) * block_size * mb;
+
+    auto dptr_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mb + 1)), device_free};
+    auto dcol_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnzb), device_free};
+    auto dval_managed  = hipsparse_unique_ptr{device_malloc(val_size), device_free};
+    auto ddiag_managed = hipsparse_unique_ptr{device_malloc(diag_size), device_free};
+    auto dx_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed    = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    int* dptr  = (int*)dptr_managed.get();
+    int* dcol  = (int*)dcol_managed.get();
+    T*   dval  = (T*)dval_managed.get();
+    T*   ddiag = (T*)ddiag_managed.get();
+    T*   dx    = (T*)dx_managed.get();
+    T*   dy    = (T*)dy_managed.get();
+
+    // copy data from CPU to device
+    if(mb > 0)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(dptr, hbsr_row_ptr.data(), sizeof(int) * (mb + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hbsr_col_ind.data(), sizeof(int) * nnzb, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval, hbsr_val.data(), val_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    }
+
+    size_t buffer_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseXbsrdiagmv_bufferSize(handle, mb, &buffer_size));
+
+    auto dbuffer_managed = hipsparse_unique_ptr{device_malloc(buffer_size), device_free};
+    void* dbuffer        = (void*)dbuffer_managed.get();
+
+    int position;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseXbsrdiag(handle, dir, mb, nnzb, descrA, dval, dptr, dcol, block_dim, ddiag));
+
+    if(argus.unit_check)
+    {
+        std::vector<T> hdiag(block_size * mb);
+        std::vector<T> hdiag_gold;
+
+        // Extraction
+        CHECK_HIP_ERROR(hipMemcpy(hdiag.data(), ddiag, diag_size, hipMemcpyDeviceToHost));
+
+        host_bsrdiag(mb, hbsr_row_ptr, hbsr_col_ind, hbsr_val, block_dim, idx_base, hdiag_gold);
+        unit_check_general(1, block_size * mb, 1, hdiag_gold.data(), hdiag.data());
+
+        // Inversion
+        CHECK_HIPSPARSE_ERROR(hipsparseXbsrdiaginv(handle, mb, block_dim, ddiag, &position));
+
+        int position_gold = host_bsrdiaginv(mb, block_dim, hdiag_gold);
+        unit_check_general(1, 1, 1, &position_gold, &position);
+
+        CHECK_HIP_ERROR(hipMemcpy(hdiag.data(), ddiag, diag_size, hipMemcpyDeviceToHost));
+        unit_check_near(1, block_size * mb, 1, hdiag_gold.data(), hdiag.data());
+
+        // Application
+        CHECK_HIPSPARSE_ERROR(hipsparseXbsrdiagmv(
+            handle, dir, mb, block_dim, &h_alpha, ddiag, dx, &h_beta, dy, dbuffer));
+
+        std::vector<T> hy_gold = hy;
+        host_bsrdiagmv(dir, mb, block_dim, h_alpha, hdiag_gold, hx, h_beta, hy_gold);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+        unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+        // Drop the diagonal block of the last block row, which yields a zero block that cannot
+        // be inverted
+        if(mb > 0)
+        {
+            std::vector<int> hptr_drop = hbsr_row_ptr;
+            std::vector<int> hcol_drop;
+            std::vector<T>   hval_drop;
+
+            for(int i = 0; i < mb; ++i)
+            {
+                hptr_drop[i + 1] = hptr_drop[i];
+
+                for(int k = hbsr_row_ptr[i] - idx_base; k < hbsr_row_ptr[i + 1] - idx_base; ++k)
+                {
+                    if(i == mb - 1 && hbsr_col_ind[k] - idx_base == i)
+                    {
+                        continue;
+                    }
+
+                    hcol_drop.push_back(hbsr_col_ind[k]);
+                    hval_drop.insert(hval_drop.end(),
+                                     hbsr_val.begin() + static_cast<size_t>(block_size) * k,
+                                     hbsr_val.begin() + static_cast<size_t>(block_size) * (k + 1));
+                    ++hptr_drop[i + 1];
+                }
+            }
+
+            int nnzb_drop = nnzb - 1;
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(dptr, hptr_drop.data(), sizeof(int) * (mb + 1), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(
+                dcol, hcol_drop.data(), sizeof(int) * nnzb_drop, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(
+                dval, hval_drop.data(), sizeof(T) * hval_drop.size(), hipMemcpyHostToDevice));
+
+            CHECK_HIPSPARSE_ERROR(hipsparseXbsrdiag(
+                handle, dir, mb, nnzb_drop, descrA, dval, dptr, dcol, block_dim, ddiag));
+
+            host_bsrdiag(mb, hptr_drop, hcol_drop, hval_drop, block_dim, idx_base, hdiag_gold);
+
+            CHECK_HIP_ERROR(hipMemcpy(hdiag.data(), ddiag, diag_size, hipMemcpyDeviceToHost));
+            unit_check_general(1, block_size * mb, 1, hdiag_gold.data(), hdiag.data());
+
+            verify_hipsparse_status_zero_pivot(
+                hipsparseXbsrdiaginv(handle, mb, block_dim, ddiag, &position),
+                "Error: zero block has not been detected");
+
+            position_gold = host_bsrdiaginv(mb, block_dim, hdiag_gold);
+            unit_check_general(1, 1, 1, &position_gold, &position);
+
+            CHECK_HIP_ERROR(hipMemcpy(hdiag.data(), ddiag, diag_size, hipMemcpyDeviceToHost));
+            unit_check_near(1, block_size * mb, 1, hdiag_gold.data(), hdiag.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXbsrdiagmv(
+                handle, dir, mb, block_dim, &h_alpha, ddiag, dx, &h_beta, dy, dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXbsrdiagmv(
+                handle, dir, mb, block_dim, &h_alpha, ddiag, dx, &h_beta, dy, dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::Mb,
+                            mb,
+                            display_key_t::block_dim,
+                            block_dim,
+                            display_key_t::direction,
+                            hipsparse_direction2string(dir),
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_BSRDIAG_HPP
@@ -0,0 +1,377 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_BSRPERMUTE_HPP
+#define TESTING_BSRPERMUTE_HPP
+
+#include "display.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_bsrpermute_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    static constexpr int M   = 10;
+    static constexpr int N   = 10;
+    static constexpr int NNZ = 10;
+    static constexpr int BD  = 2;
+
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrB(new descr_struct);
+    hipsparseMatDescr_t           descrB = unique_ptr_descrB->descr;
+
+    hipsparsePermuteInfo_t info;
+    verify_hipsparse_status_invalid_pointer(hipsparseCreatePermuteInfo(nullptr),
+                                            "Error: info is nullptr");
+    CHECK_HIPSPARSE_ERROR(hipsparseCreatePermuteInfo(&info));
+
+    auto m_ptr_A = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_A = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_A = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ * BD * BD), device_free};
+    auto m_ptr_B = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_B = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_B = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ * BD * BD), device_free};
+    auto m_P     = hipsparse_unique_ptr{device_malloc(sizeof(int) * M), device_free};
+    auto m_Q     = hipsparse_unique_ptr{device_malloc(sizeof(int) * N), device_free};
+
+    int* d_ptr_A = (int*)m_ptr_A.get();
+    int* d_col_A = (int*)m_col_A.get();
+    T*   d_val_A = (T*)m_val_A.get();
+    int* d_ptr_B = (int*)m_ptr_B.get();
+    int* d_col_B = (int*)m_col_B.get();
+    T*   d_val_B = (T*)m_val_B.get();
+    int* d_P     = (int*)m_P.get();
+    int* d_Q     = (int*)m_Q.get();
+
+    // Symbolic phase
+    status = hipsparseXbsrpermute_analysis(
+        nullptr, M, N, NNZ, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, -1, N, NNZ, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_size(status, "Error: mb is invalid");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, -1, NNZ, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_size(status, "Error: nb is invalid");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, -1, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_size(status, "Error: nnzb is invalid");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, descrA, d_ptr_A, d_col_A, 0, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_size(status, "Error: blockDim is invalid");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, nullptr, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descrA is nullptr");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, descrA, nullptr, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrRowPtrA is nullptr");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, descrA, d_ptr_A, nullptr, BD, d_P, d_Q, descrB, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrColIndA is nullptr");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, nullptr, d_ptr_B, d_col_B, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descrB is nullptr");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, nullptr, d_col_B, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrRowPtrB is nullptr");
+
+    status = hipsparseXbsrpermute_analysis(
+        handle, M, N, NNZ, descrA, d_ptr_A, d_col_A, BD, d_P, d_Q, descrB, d_ptr_B, nullptr, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrColIndB is nullptr");
+
+    status = hipsparseXbsrpermute_analysis(handle,
+                                           M,
+                                           N,
+                                           NNZ,
+                                           descrA,
+                                           d_ptr_A,
+                                           d_col_A,
+                                           BD,
+                                           d_P,
+                                           d_Q,
+                                           descrB,
+                                           d_ptr_B,
+                                           d_col_B,
+                                           nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: info is nullptr");
+
+    // Numeric phase
+    status = hipsparseXbsrpermute(nullptr, NNZ, BD, d_val_A, d_val_B, info);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXbsrpermute(handle, NNZ, BD, (const T*)nullptr, d_val_B, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrValA is nullptr");
+
+    status = hipsparseXbsrpermute(handle, NNZ, BD, d_val_A, (T*)nullptr, info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: bsrValB is nullptr");
+
+    status = hipsparseXbsrpermute(handle, NNZ, BD, d_val_A, d_val_B, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: info is nullptr");
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyPermuteInfo(info));
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_bsrpermute(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  mb        = argus.M;
+    int                  nb        = argus.N;
+    int                  block_dim = argus.block_dim;
+    hipsparseIndexBase_t base_A    = argus.baseA;
+    hipsparseIndexBase_t base_B    = argus.baseB;
+    std::string          filename  = argus.filename;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrB(new descr_struct);
+    hipsparseMatDescr_t           descrB = unique_ptr_descrB->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, base_A));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrB, base_B));
+
+    srand(12345ULL);
+
+    // Host structures, the block pattern is a random CSR matrix
+    std::vector<int> hbsr_row_ptr_A;
+    std::vector<int> hbsr_col_ind_A;
+    std::vector<T>   hcsr_val;
+
+    int nnzb = 0;
+    if(!generate_csr_matrix(
+           filename, mb, nb, nnzb, hbsr_row_ptr_A, hbsr_col_ind_A, hcsr_val, base_A))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    int size = nnzb * block_dim * block_dim;
+
+    std::vector<T> hbsr_val_A(size);
+    hipsparseInit<T>(hbsr_val_A, 1, size);
+
+    // Random block row and block column permutations
+    std::vector<int> hP(mb);
+    std::vector<int> hQ(nb);
+    for(int i = 0; i < mb; ++i)
+    {
+        hP[i] = i;
+    }
+
+    for(int j = 0; j < nb; ++j)
+    {
+        hQ[j] = j;
+    }
+
+    for(int i = mb - 1; i > 0; --i)
+    {
+        std::swap(hP[i], hP[rand() % (i + 1)]);
+    }
+
+    for(int j = nb - 1; j > 0; --j)
+    {
+        std::swap(hQ[j], hQ[rand() % (j + 1)]);
+    }
+
+    // allocate memory on device
+    auto dptr_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mb + 1)), device_free};
+    auto dcol_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnzb), device_free};
+    auto dval_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+    auto dptr_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (mb + 1)), device_free};
+    auto dcol_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnzb), device_free};
+    auto dval_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+    auto dP_managed     = hipsparse_unique_ptr{device_malloc(sizeof(int) * mb), device_free};
+    auto dQ_managed     = hipsparse_unique_ptr{device_malloc(sizeof(int) * nb), device_free};
+
+    int* dptr_A = (int*)dptr_A_managed.get();
+    int* dcol_A = (int*)dcol_A_managed.get();
+    T*   dval_A = (T*)dval_A_managed.get();
+    int* dptr_B = (int*)dptr_B_managed.get();
+    int* dcol_B = (int*)dcol_B_managed.get();
+    T*   dval_B = (T*)dval_B_managed.get();
+    int* dP     = (int*)dP_managed.get();
+    int* dQ     = (int*)dQ_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr_A, hbsr_row_ptr_A.data(), sizeof(int) * (mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol_A, hbsr_col_ind_A.data(), sizeof(int) * nnzb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hbsr_val_A.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dP, hP.data(), sizeof(int) * mb, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dQ, hQ.data(), sizeof(int) * nb, hipMemcpyHostToDevice));
+
+    hipsparsePermuteInfo_t info;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreatePermuteInfo(&info));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXbsrpermute_analysis(handle,
+                                                        mb,
+                                                        nb,
+                                                        nnzb,
+                                                        descrA,
+                                                        dptr_A,
+                                                        dcol_A,
+                                                        block_dim,
+                                                        dP,
+                                                        dQ,
+                                                        descrB,
+                                                        dptr_B,
+                                                        dcol_B,
+                                                        info));
+
+    if(argus.unit_check)
+    {
+        std::vector<int> hbsr_row_ptr_B(mb + 1);
+        std::vector<int> hbsr_col_ind_B(nnzb);
+        std::vector<T>   hbsr_val_B(size);
+
+        std::vector<int> hbsr_row_ptr_B_gold;
+        std::vector<int> hbsr_col_ind_B_gold;
+        std::vector<T>   hbsr_val_B_gold;
+
+        // The numeric phase is repeated with new values of A without a new analysis
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            if(pass > 0)
+            {
+                hipsparseInit<T>(hbsr_val_A, 1, size);
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dval_A, hbsr_val_A.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+            }
+
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXbsrpermute(handle, nnzb, block_dim, dval_A, dval_B, info));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(
+                hbsr_row_ptr_B.data(), dptr_B, sizeof(int) * (mb + 1), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hbsr_col_ind_B.data(), dcol_B, sizeof(int) * nnzb, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hbsr_val_B.data(), dval_B, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+            // CPU
+            host_bsrpermute(mb,
+                            nb,
+                            block_dim,
+                            hbsr_row_ptr_A,
+                            hbsr_col_ind_A,
+                            hbsr_val_A,
+                            hP,
+                            hQ,
+                            hbsr_row_ptr_B_gold,
+                            hbsr_col_ind_B_gold,
+                            hbsr_val_B_gold,
+                            base_A,
+                            base_B);
+
+            unit_check_general(1, mb + 1, 1, hbsr_row_ptr_B_gold.data(), hbsr_row_ptr_B.data());
+            unit_check_general(1, nnzb, 1, hbsr_col_ind_B_gold.data(), hbsr_col_ind_B.data());
+            unit_check_general(1, size, 1, hbsr_val_B_gold.data(), hbsr_val_B.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXbsrpermute(handle, nnzb, block_dim, dval_A, dval_B, info));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXbsrpermute(handle, nnzb, block_dim, dval_A, dval_B, info));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // The numeric phase is a gather of the values
+        double gbyte_count = gthr_gbyte_count<T>(size);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::Mb,
+                            mb,
+                            display_key_t::Nb,
+                            nb,
+                            display_key_t::block_dim,
+                            block_dim,
+                            display_key_t::nnzb,
+                            nnzb,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyPermuteInfo(info));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_BSRPERMUTE_HPP
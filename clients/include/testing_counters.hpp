@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright (C) 2020 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_COUNTERS_HPP
+#define TESTING_COUNTERS_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <hipsparse.h>
+
+#include "hipsparse_arguments.hpp"
+#include "utility.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace hipsparse_test;
+
+void testing_counters_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    hipsparseCounters_t        counters;
+    hipsparseRoutineCounters_t routine_counters;
+    int                        count = 1;
+
+    verify_hipsparse_status(hipsparseGetCounters(nullptr, &counters),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseGetCounters(handle, nullptr),
+                                            "Error: counters is nullptr");
+
+    verify_hipsparse_status(hipsparseGetRoutineCounters(nullptr, &count, &routine_counters),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseGetRoutineCounters(handle, nullptr, &routine_counters),
+        "Error: count is nullptr");
+
+    count = -1;
+    verify_hipsparse_status_invalid_value(
+        hipsparseGetRoutineCounters(handle, &count, &routine_counters), "Error: count is < 0");
+
+    verify_hipsparse_status(hipsparseResetCounters(nullptr),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+static void unit_check_counters(hipsparseCounters_t ref, hipsparseCounters_t counters)
+{
+    unit_check_general(1, 1, 1, &ref.calls, &counters.calls);
+    unit_check_general(1, 1, 1, &ref.hostTimeNs, &counters.hostTimeNs);
+    unit_check_general(1, 1, 1, &ref.deviceTimeNs, &counters.deviceTimeNs);
+    unit_check_general(1, 1, 1, &ref.workspaceBytes, &counters.workspaceBytes);
+    unit_check_general(1, 1, 1, &ref.workspaceAllocations, &counters.workspaceAllocations);
+    unit_check_general(1, 1, 1, &ref.synchronizations, &counters.synchronizations);
+}
+#endif
+
+hipsparseStatus_t testing_counters(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // A fresh handle has not counted anything
+    hipsparseCounters_t counters;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetCounters(handle, &counters));
+
+    hipsparseCounters_t zero = {};
+    unit_check_counters(zero, counters);
+
+    // 2 x 3 matrix, csr2csc allocates a buffer internally and synchronizes
+    int m   = 2;
+    int n   = 3;
+    int nnz = 3;
+
+    std::vector<int>   hcsr_row_ptr = {0, 2, 3};
+    std::vector<int>   hcsr_col_ind = {0, 2, 1};
+    std::vector<float> hcsr_val     = {1.0f, 2.0f, 3.0f};
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+    auto dcsc_col_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (n + 1)), device_free};
+    auto dcsc_row_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsc_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+    int*   dcsc_col_ptr = (int*)dcsc_col_ptr_managed.get();
+    int*   dcsc_row_ind = (int*)dcsc_row_ind_managed.get();
+    float* dcsc_val     = (float*)dcsc_val_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+
+    const int calls = 3;
+    for(int i = 0; i < calls; ++i)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseScsr2csc(handle,
+                                                m,
+                                                n,
+                                                nnz,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                dcsc_val,
+                                                dcsc_row_ind,
+                                                dcsc_col_ptr,
+                                                HIPSPARSE_ACTION_NUMERIC,
+                                                HIPSPARSE_INDEX_BASE_ZERO));
+    }
+
+    // The device time is only measured if HIPSPARSE_COUNTERS_DEVICE_TIME is set and is added once
+    // the calls have completed, tracing is not required
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIPSPARSE_ERROR(hipsparseGetCounters(handle, &counters));
+
+    // Every call allocates a buffer and synchronizes at least once
+    int expected = 1;
+    int counted  = (counters.hostTimeNs > 0) && (counters.workspaceAllocations >= calls)
+                  && (counters.workspaceBytes > 0) && (counters.synchronizations >= calls);
+    unit_check_general(1, 1, 1, &expected, &counted);
+
+    // Only the calls made by the application are counted
+    int64_t expected_total_calls = calls;
+    unit_check_general(1, 1, 1, &expected_total_calls, &counters.calls);
+
+    // Per routine counters
+    int count = 0;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetRoutineCounters(handle, &count, nullptr));
+
+    counted = (count >= 1);
+    unit_check_general(1, 1, 1, &expected, &counted);
+
+    std::vector<hipsparseRoutineCounters_t> routine_counters(count);
+    CHECK_HIPSPARSE_ERROR(hipsparseGetRoutineCounters(handle, &count, routine_counters.data()));
+
+    int64_t expected_calls = calls;
+    int64_t csr2csc_calls  = 0;
+    for(const hipsparseRoutineCounters_t& routine : routine_counters)
+    {
+        if(std::strcmp(routine.name, "hipsparseScsr2csc") == 0)
+        {
+            csr2csc_calls = routine.calls;
+        }
+    }
+    unit_check_general(1, 1, 1, &expected_calls, &csr2csc_calls);
+
+    // Reset
+    CHECK_HIPSPARSE_ERROR(hipsparseResetCounters(handle));
+    CHECK_HIPSPARSE_ERROR(hipsparseGetCounters(handle, &counters));
+
+    unit_check_counters(zero, counters);
+
+    int expected_count = 0;
+    CHECK_HIPSPARSE_ERROR(hipsparseGetRoutineCounters(handle, &count, nullptr));
+    unit_check_general(1, 1, 1, &expected_count, &count);
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_COUNTERS_HPP
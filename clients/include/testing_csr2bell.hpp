@@ -0,0 +1,357 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2BELL_HPP
+#define TESTING_CSR2BELL_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_csr2bell_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t E;
+    int64_t               block_size = 0;
+    int64_t               ell_cols;
+    int64_t               fill;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateBlockedEll(&E, m, n, 2, 2, dcol, dval, idxType, idxBase, dataType),
+        "success");
+
+    // hipsparseCsr2BlockedEllNnz
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2BlockedEllNnz(nullptr, A, &block_size, &ell_cols, &fill),
+        "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2BlockedEllNnz(handle, nullptr, &block_size, &ell_cols, &fill),
+        "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2BlockedEllNnz(handle, A, nullptr, &ell_cols, &fill),
+        "Error: ellBlockSize is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2BlockedEllNnz(handle, A, &block_size, nullptr, &fill),
+        "Error: ellCols is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2BlockedEllNnz(handle, A, &block_size, &ell_cols, nullptr),
+        "Error: ellFill is nullptr");
+    verify_hipsparse_status_not_supported(
+        hipsparseCsr2BlockedEllNnz(handle, E, &block_size, &ell_cols, &fill),
+        "Error: matCsr is not a CSR matrix");
+
+    block_size = -1;
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2BlockedEllNnz(handle, A, &block_size, &ell_cols, &fill),
+        "Error: ellBlockSize is negative");
+
+    // hipsparseCsr2BlockedEll
+    verify_hipsparse_status_invalid_value(hipsparseCsr2BlockedEll(nullptr, A, E),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2BlockedEll(handle, nullptr, E),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2BlockedEll(handle, A, nullptr),
+                                          "Error: matBell is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseCsr2BlockedEll(handle, A, A),
+                                          "Error: matBell is not a Blocked-ELL matrix");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(E), "success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+template <typename I, typename T>
+hipsparseStatus_t testing_csr2bell(Arguments argus)
+{
+    I                    m         = argus.M;
+    I                    n         = argus.N;
+    I                    k         = argus.K;
+    I                    block_dim = argus.block_dim;
+    T                    h_alpha   = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                    h_beta    = make_DataType2<T>(argus.beta, argus.betai);
+    hipsparseOrder_t     orderB    = argus.orderB;
+    hipsparseOrder_t     orderC    = argus.orderC;
+    hipsparseIndexBase_t idxBase   = argus.baseA;
+    std::string          filename  = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, k, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    I* dcol = (I*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, k, nnz, dptr, dcol, dval, typeI, typeI, idxBase, typeT));
+
+    // Block size, width and fill of the Blocked-ELL matrix
+    int64_t block_size = block_dim;
+    int64_t ell_cols;
+    int64_t fill;
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2BlockedEllNnz(handle, A, &block_size, &ell_cols, &fill));
+
+    // Host selection of the block size, the candidate with the fewest bytes wins and larger
+    // blocks win ties
+    I              ell_cols_gold;
+    std::vector<I> hbell_col_gold;
+    std::vector<T> hbell_val_gold;
+
+    int64_t block_size_gold = block_dim;
+    if(block_dim == 0)
+    {
+        int64_t best_bytes = -1;
+        for(I bs = 32; bs >= 1; bs /= 2)
+        {
+            host_csr_to_bell(m,
+                             bs,
+                             hcsr_row_ptr.data(),
+                             hcsr_col_ind.data(),
+                             hcsr_val.data(),
+                             idxBase,
+                             ell_cols_gold,
+                             hbell_col_gold,
+                             hbell_val_gold);
+
+            int64_t bytes = int64_t(hbell_val_gold.size()) * sizeof(T)
+                            + int64_t(hbell_col_gold.size()) * sizeof(I);
+            if(best_bytes < 0 || bytes < best_bytes)
+            {
+                best_bytes      = bytes;
+                block_size_gold = bs;
+            }
+        }
+    }
+
+    host_csr_to_bell(m,
+                     (I)block_size_gold,
+                     hcsr_row_ptr.data(),
+                     hcsr_col_ind.data(),
+                     hcsr_val.data(),
+                     idxBase,
+                     ell_cols_gold,
+                     hbell_col_gold,
+                     hbell_val_gold);
+
+    int64_t ell_cols_gold64 = ell_cols_gold;
+    int64_t fill_gold       = int64_t(hbell_val_gold.size()) - nnz;
+    unit_check_general(1, 1, 1, &block_size_gold, &block_size);
+    unit_check_general(1, 1, 1, &ell_cols_gold64, &ell_cols);
+    unit_check_general(1, 1, 1, &fill_gold, &fill);
+
+    // Convert into Blocked-ELL
+    int64_t mb         = (m + block_size - 1) / block_size;
+    int64_t ell_blocks = ell_cols / block_size;
+    int64_t nvals      = mb * ell_cols * block_size;
+
+    auto dbell_col_managed = hipsparse_unique_ptr{
+        device_malloc(sizeof(I) * std::max(mb * ell_blocks, int64_t(1))), device_free};
+    auto dbell_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * std::max(nvals, int64_t(1))), device_free};
+
+    I* dbell_col = (I*)dbell_col_managed.get();
+    T* dbell_val = (T*)dbell_val_managed.get();
+
+    hipsparseSpMatDescr_t E;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateBlockedEll(
+        &E, m, k, block_size, ell_cols, dbell_col, dbell_val, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2BlockedEll(handle, A, E));
+
+    std::vector<I> hbell_col(mb * ell_blocks);
+    std::vector<T> hbell_val(nvals);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hbell_col.data(), dbell_col, sizeof(I) * mb * ell_blocks, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hbell_val.data(), dbell_val, sizeof(T) * nvals, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, mb * ell_blocks, 1, hbell_col_gold.data(), hbell_col.data());
+    unit_check_general(1, nvals, 1, hbell_val_gold.data(), hbell_val.data());
+
+    // SpMM with the Blocked-ELL matrix
+    int64_t ldb = (orderB == HIPSPARSE_ORDER_COL) ? k : n;
+    int64_t ldc = (orderC == HIPSPARSE_ORDER_COL) ? m : n;
+
+    int64_t nnz_B = int64_t(k) * n;
+    int64_t nnz_C = int64_t(m) * n;
+
+    std::vector<T> hB(nnz_B);
+    std::vector<T> hC(nnz_C);
+
+    hipsparseInit<T>(hB, nnz_B, 1);
+    hipsparseInit<T>(hC, nnz_C, 1);
+
+    std::vector<T> hC_gold = hC;
+
+    auto dB_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dC_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    T* dB = (T*)dB_managed.get();
+    T* dC = (T*)dC_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+
+    hipsparseDnMatDescr_t B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, k, n, ldb, dB, typeT, orderB));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C, m, n, ldc, dC, typeT, orderC));
+
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(handle,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   &h_alpha,
+                                                   E,
+                                                   B,
+                                                   &h_beta,
+                                                   C,
+                                                   typeT,
+                                                   HIPSPARSE_SPMM_BLOCKED_ELL_ALG1,
+                                                   &bufferSize));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(bufferSize, size_t(4))), device_free};
+    void* dbuffer = dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_preprocess(handle,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   &h_alpha,
+                                                   E,
+                                                   B,
+                                                   &h_beta,
+                                                   C,
+                                                   typeT,
+                                                   HIPSPARSE_SPMM_BLOCKED_ELL_ALG1,
+                                                   dbuffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM(handle,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        &h_alpha,
+                                        E,
+                                        B,
+                                        &h_beta,
+                                        C,
+                                        typeT,
+                                        HIPSPARSE_SPMM_BLOCKED_ELL_ALG1,
+                                        dbuffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    // The Blocked-ELL matrix holds the CSR matrix
+    host_csrmm(m,
+               n,
+               k,
+               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val.data(),
+               hB.data(),
+               (I)ldb,
+               orderB,
+               h_beta,
+               hC_gold.data(),
+               (I)ldc,
+               orderC,
+               idxBase,
+               false);
+
+    unit_check_near(1, nnz_C, 1, hC_gold.data(), hC.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(E));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#endif // TESTING_CSR2BELL_HPP
@@ -0,0 +1,537 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRILUK_HPP
+#define TESTING_CSRILUK_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_csriluk_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    static constexpr int M     = 10;
+    static constexpr int NNZ   = 10;
+    static constexpr int LEVEL = 1;
+
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrL(new descr_struct);
+    hipsparseMatDescr_t           descrL = unique_ptr_descrL->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrU(new descr_struct);
+    hipsparseMatDescr_t           descrU = unique_ptr_descrU->descr;
+
+    hipsparseIluInfo_t info;
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateIluInfo(nullptr),
+                                            "Error: info is nullptr");
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateIluInfo(&info));
+
+    auto m_ptr_A = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_A = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_A = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+    auto m_ptr_L = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_L = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_L = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+    auto m_ptr_U = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_U = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_U = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+
+    int* d_ptr_A = (int*)m_ptr_A.get();
+    int* d_col_A = (int*)m_col_A.get();
+    T*   d_val_A = (T*)m_val_A.get();
+    int* d_ptr_L = (int*)m_ptr_L.get();
+    int* d_col_L = (int*)m_col_L.get();
+    T*   d_val_L = (T*)m_val_L.get();
+    int* d_ptr_U = (int*)m_ptr_U.get();
+    int* d_col_U = (int*)m_col_U.get();
+    T*   d_val_U = (T*)m_val_U.get();
+
+    int nnz_L;
+    int nnz_U;
+    int position;
+
+    // Symbolic phase
+    status = hipsparseXcsriluk_analysis(nullptr,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        -1,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_size(status, "Error: m is invalid");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        -1,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_size(status, "Error: nnzA is invalid");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        -1,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_size(status, "Error: level is invalid");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        nullptr,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descrA is nullptr");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        nullptr,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrRowPtrA is nullptr");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        nullptr,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrColIndA is nullptr");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        nullptr,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: nnzL is nullptr");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        nullptr,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrRowPtrU is nullptr");
+
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: info is nullptr");
+
+    // Numeric phase
+    status = hipsparseXcsriluk(nullptr, d_val_A, info, d_val_L, d_col_L, d_val_U, d_col_U);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsriluk(handle, d_val_A, nullptr, d_val_L, d_col_L, d_val_U, d_col_U);
+    verify_hipsparse_status_invalid_pointer(status, "Error: info is nullptr");
+
+    // The numeric phase requires the symbolic phase
+    status = hipsparseXcsriluk(handle, d_val_A, info, d_val_L, d_col_L, d_val_U, d_col_U);
+    verify_hipsparse_status_invalid_value(status, "Error: info holds no analysis");
+
+    status = hipsparseXcsriluk_zeroPivot(handle, info, &position);
+    verify_hipsparse_status_invalid_value(status, "Error: info holds no analysis");
+
+    status = hipsparseXcsriluk_zeroPivot(nullptr, info, &position);
+    verify_hipsparse_status_invalid_handle(status);
+
+    // Only general matrices are supported
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatType(descrA, HIPSPARSE_MATRIX_TYPE_SYMMETRIC));
+    status = hipsparseXcsriluk_analysis(handle,
+                                        M,
+                                        NNZ,
+                                        descrA,
+                                        d_ptr_A,
+                                        d_col_A,
+                                        LEVEL,
+                                        descrL,
+                                        d_ptr_L,
+                                        &nnz_L,
+                                        descrU,
+                                        d_ptr_U,
+                                        &nnz_U,
+                                        info);
+    verify_hipsparse_status_not_supported(status, "Error: matrix type is not supported");
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyIluInfo(info));
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_csriluk(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  ndim     = argus.M;
+    int                  level    = argus.fill_level;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+
+    // hipSPARSE handle and opaque matrix descriptors
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrL(new descr_struct);
+    hipsparseMatDescr_t           descrL = unique_ptr_descrL->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrU(new descr_struct);
+    hipsparseMatDescr_t           descrU = unique_ptr_descrU->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrL, idx_base));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrU, idx_base));
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int nnz = (m > 0) ? hcsr_row_ptr[m] - idx_base : 0;
+
+    // allocate memory on device
+    auto dptr_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dptr_L_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dptr_U_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+
+    int* dptr_A = (int*)dptr_A_managed.get();
+    int* dcol_A = (int*)dcol_A_managed.get();
+    T*   dval_A = (T*)dval_A_managed.get();
+    int* dptr_L = (int*)dptr_L_managed.get();
+    int* dptr_U = (int*)dptr_U_managed.get();
+
+    // copy data from CPU to device
+    if(m > 0)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(dptr_A, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol_A, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    }
+
+    hipsparseIluInfo_t info;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateIluInfo(&info));
+
+    int nnz_L;
+    int nnz_U;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsriluk_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descrA,
+                                                     dptr_A,
+                                                     dcol_A,
+                                                     level,
+                                                     descrL,
+                                                     dptr_L,
+                                                     &nnz_L,
+                                                     descrU,
+                                                     dptr_U,
+                                                     &nnz_U,
+                                                     info));
+
+    auto dcol_L_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_L), device_free};
+    auto dval_L_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_L), device_free};
+    auto dcol_U_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_U), device_free};
+    auto dval_U_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_U), device_free};
+
+    int* dcol_L = (int*)dcol_L_managed.get();
+    T*   dval_L = (T*)dval_L_managed.get();
+    int* dcol_U = (int*)dcol_U_managed.get();
+    T*   dval_U = (T*)dval_U_managed.get();
+
+    if(argus.unit_check)
+    {
+        std::vector<int> hcsr_row_ptr_L(m + 1);
+        std::vector<int> hcsr_col_ind_L(nnz_L);
+        std::vector<T>   hcsr_val_L(nnz_L);
+        std::vector<int> hcsr_row_ptr_U(m + 1);
+        std::vector<int> hcsr_col_ind_U(nnz_U);
+        std::vector<T>   hcsr_val_U(nnz_U);
+
+        std::vector<int> hcsr_row_ptr_L_gold;
+        std::vector<int> hcsr_col_ind_L_gold;
+        std::vector<T>   hcsr_val_L_gold;
+        std::vector<int> hcsr_row_ptr_U_gold;
+        std::vector<int> hcsr_col_ind_U_gold;
+        std::vector<T>   hcsr_val_U_gold;
+
+        // The numeric phase is repeated with new values of A without a new analysis
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            // Diagonally dominant values
+            for(int i = 0; i < m; ++i)
+            {
+                for(int k = hcsr_row_ptr[i] - idx_base; k < hcsr_row_ptr[i + 1] - idx_base; ++k)
+                {
+                    const int    j       = hcsr_col_ind[k] - idx_base;
+                    const double offdiag = -1.0 - ((3 * i + 7 * j + pass) % 11) / 20.0;
+
+                    hcsr_val[k] = make_DataType<T>((j == i) ? 8.0 + pass : offdiag);
+                }
+            }
+
+            if(nnz > 0)
+            {
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dval_A, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+            }
+
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXcsriluk(handle, dval_A, info, dval_L, dcol_L, dval_U, dcol_U));
+
+            int position;
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsriluk_zeroPivot(handle, info, &position));
+
+            int expected_position = -1;
+            unit_check_general(1, 1, 1, &expected_position, &position);
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_row_ptr_L.data(), dptr_L, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_col_ind_L.data(), dcol_L, sizeof(int) * nnz_L, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_L.data(), dval_L, sizeof(T) * nnz_L, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_row_ptr_U.data(), dptr_U, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_col_ind_U.data(), dcol_U, sizeof(int) * nnz_U, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_U.data(), dval_U, sizeof(T) * nnz_U, hipMemcpyDeviceToHost));
+
+            // CPU
+            host_csriluk(m,
+                         hcsr_row_ptr,
+                         hcsr_col_ind,
+                         hcsr_val,
+                         idx_base,
+                         level,
+                         hcsr_row_ptr_L_gold,
+                         hcsr_col_ind_L_gold,
+                         hcsr_val_L_gold,
+                         hcsr_row_ptr_U_gold,
+                         hcsr_col_ind_U_gold,
+                         hcsr_val_U_gold);
+
+            unit_check_general(1, m + 1, 1, hcsr_row_ptr_L_gold.data(), hcsr_row_ptr_L.data());
+            unit_check_general(1, nnz_L, 1, hcsr_col_ind_L_gold.data(), hcsr_col_ind_L.data());
+            unit_check_near(1, nnz_L, 1, hcsr_val_L_gold.data(), hcsr_val_L.data());
+            unit_check_general(1, m + 1, 1, hcsr_row_ptr_U_gold.data(), hcsr_row_ptr_U.data());
+            unit_check_general(1, nnz_U, 1, hcsr_col_ind_U_gold.data(), hcsr_col_ind_U.data());
+            unit_check_near(1, nnz_U, 1, hcsr_val_U_gold.data(), hcsr_val_U.data());
+
+            // ILU(0) has the pattern of A and matches the existing ILU0 factorization
+            if(level == 0)
+            {
+                std::vector<T> hilu0 = hcsr_val;
+                csrilu0(m,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hilu0.data(),
+                        idx_base,
+                        false,
+                        0.0,
+                        make_DataType<T>(0.0));
+
+                std::vector<T> hilu0_gold(nnz);
+                for(int i = 0; i < m; ++i)
+                {
+                    int k = hcsr_row_ptr[i] - idx_base;
+                    for(int p = hcsr_row_ptr_L_gold[i] - idx_base;
+                        p < hcsr_row_ptr_L_gold[i + 1] - idx_base;
+                        ++p)
+                    {
+                        hilu0_gold[k++] = hcsr_val_L_gold[p];
+                    }
+
+                    for(int p = hcsr_row_ptr_U_gold[i] - idx_base;
+                        p < hcsr_row_ptr_U_gold[i + 1] - idx_base;
+                        ++p)
+                    {
+                        hilu0_gold[k++] = hcsr_val_U_gold[p];
+                    }
+                }
+
+                int nnz_LU = nnz_L + nnz_U;
+                unit_check_general(1, 1, 1, &nnz, &nnz_LU);
+                unit_check_near(1, nnz, 1, hilu0.data(), hilu0_gold.data());
+            }
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXcsriluk(handle, dval_A, info, dval_L, dcol_L, dval_U, dcol_U));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run, the refactorization with an existing analysis
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseXcsriluk(handle, dval_A, info, dval_L, dcol_L, dval_U, dcol_U));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyIluInfo(info));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRILUK_HPP
@@ -0,0 +1,526 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRITILU0_HPP
+#define TESTING_CSRITILU0_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_csritilu0_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    static constexpr int M        = 10;
+    static constexpr int NNZ      = 10;
+    static constexpr int MAX_ITER = 10;
+
+    hipsparseItilu0Alg_t alg    = HIPSPARSE_ITILU0_ALG_DEFAULT;
+    int                  option = 0;
+
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    auto m_csr_row_ptr = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_csr_col_ind = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_csr_val_A   = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+    auto m_csr_val_M   = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+    auto m_buffer      = hipsparse_unique_ptr{device_malloc(sizeof(char) * 256), device_free};
+
+    int*  d_csr_row_ptr = (int*)m_csr_row_ptr.get();
+    int*  d_csr_col_ind = (int*)m_csr_col_ind.get();
+    T*    d_csr_val_A   = (T*)m_csr_val_A.get();
+    T*    d_csr_val_M   = (T*)m_csr_val_M.get();
+    void* d_buffer      = (void*)m_buffer.get();
+
+    size_t             buffer_size = 256;
+    int                max_iter    = MAX_ITER;
+    floating_data_t<T> tol         = make_DataType<floating_data_t<T>>(1e-3);
+
+    status = hipsparseXcsritilu0_bufferSize(nullptr,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            &buffer_size);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsritilu0_bufferSize(handle,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            -1,
+                                            NNZ,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            &buffer_size);
+    verify_hipsparse_status_invalid_size(status, "Error: m is invalid");
+
+    status = hipsparseXcsritilu0_bufferSize(handle,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            -1,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            &buffer_size);
+    verify_hipsparse_status_invalid_size(status, "Error: nnz is invalid");
+
+    status = hipsparseXcsritilu0_bufferSize(handle,
+                                            (hipsparseItilu0Alg_t)-1,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            &buffer_size);
+    verify_hipsparse_status_invalid_value(status, "Error: alg is invalid");
+
+    status = hipsparseXcsritilu0_bufferSize(handle,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            nullptr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            &buffer_size);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    status = hipsparseXcsritilu0_bufferSize(handle,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: pBufferSizeInBytes is nullptr");
+
+    status = hipsparseXcsritilu0_preprocess(nullptr,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            buffer_size,
+                                            d_buffer);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsritilu0_preprocess(handle,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            nullptr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            buffer_size,
+                                            d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    status = hipsparseXcsritilu0(nullptr,
+                                 alg,
+                                 option,
+                                 &max_iter,
+                                 tol,
+                                 M,
+                                 NNZ,
+                                 descr,
+                                 d_csr_val_A,
+                                 d_csr_row_ptr,
+                                 d_csr_col_ind,
+                                 d_csr_val_M,
+                                 buffer_size,
+                                 d_buffer);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsritilu0(handle,
+                                 alg,
+                                 option,
+                                 &max_iter,
+                                 tol,
+                                 -1,
+                                 NNZ,
+                                 descr,
+                                 d_csr_val_A,
+                                 d_csr_row_ptr,
+                                 d_csr_col_ind,
+                                 d_csr_val_M,
+                                 buffer_size,
+                                 d_buffer);
+    verify_hipsparse_status_invalid_size(status, "Error: m is invalid");
+
+    status = hipsparseXcsritilu0(handle,
+                                 alg,
+                                 option,
+                                 &max_iter,
+                                 tol,
+                                 M,
+                                 NNZ,
+                                 nullptr,
+                                 d_csr_val_A,
+                                 d_csr_row_ptr,
+                                 d_csr_col_ind,
+                                 d_csr_val_M,
+                                 buffer_size,
+                                 d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    status = hipsparseXcsritilu0(handle,
+                                 alg,
+                                 option,
+                                 nullptr,
+                                 tol,
+                                 M,
+                                 NNZ,
+                                 descr,
+                                 d_csr_val_A,
+                                 d_csr_row_ptr,
+                                 d_csr_col_ind,
+                                 d_csr_val_M,
+                                 buffer_size,
+                                 d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: maxIter is nullptr");
+
+    status = hipsparseXcsritic0(handle,
+                                alg,
+                                option,
+                                &max_iter,
+                                tol,
+                                M,
+                                NNZ,
+                                nullptr,
+                                d_csr_val_A,
+                                d_csr_row_ptr,
+                                d_csr_col_ind,
+                                d_csr_val_M,
+                                buffer_size,
+                                d_buffer);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    // Only general matrices are supported
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatType(descr, HIPSPARSE_MATRIX_TYPE_SYMMETRIC));
+    status = hipsparseXcsritilu0_bufferSize(handle,
+                                            alg,
+                                            option,
+                                            MAX_ITER,
+                                            M,
+                                            NNZ,
+                                            descr,
+                                            d_csr_row_ptr,
+                                            d_csr_col_ind,
+                                            getDataType<T>(),
+                                            &buffer_size);
+    verify_hipsparse_status_not_supported(status, "Error: matrix type is not supported");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_csritilu0(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  ndim     = argus.M;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseItilu0Alg_t alg      = (hipsparseItilu0Alg_t)argus.itilu0_alg;
+
+    // Sweep until the correction is negligible, the result is then compared to the exact
+    // factorization
+    int option = HIPSPARSE_ITILU0_OPTION_STOPPING_CRITERIA
+                 | HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_CORRECTION
+                 | HIPSPARSE_ITILU0_OPTION_CONVERGENCE_HISTORY;
+
+    int max_iter = 1000;
+
+    floating_data_t<T> tol = make_DataType<floating_data_t<T>>(
+        (sizeof(floating_data_t<T>) == sizeof(float)) ? 1e-5 : 1e-10);
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, idx_base));
+
+    // Host structures, the Laplacian is symmetric positive definite, such that both the LU and
+    // the Cholesky factorization exist
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int nnz = (m > 0) ? hcsr_row_ptr[m] - idx_base : 0;
+
+    // allocate memory on device
+    auto dptr_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dvalA_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dvalM_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    int* dptr  = (int*)dptr_managed.get();
+    int* dcol  = (int*)dcol_managed.get();
+    T*   dvalA = (T*)dvalA_managed.get();
+    T*   dvalM = (T*)dvalM_managed.get();
+
+    // copy data from CPU to device
+    if(m > 0)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dvalA, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    }
+
+    size_t buffer_size;
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsritilu0_bufferSize(handle,
+                                                         alg,
+                                                         option,
+                                                         max_iter,
+                                                         m,
+                                                         nnz,
+                                                         descrA,
+                                                         dptr,
+                                                         dcol,
+                                                         getDataType<T>(),
+                                                         &buffer_size));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(char) * buffer_size), device_free};
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsritilu0_preprocess(handle,
+                                                         alg,
+                                                         option,
+                                                         max_iter,
+                                                         m,
+                                                         nnz,
+                                                         descrA,
+                                                         dptr,
+                                                         dcol,
+                                                         getDataType<T>(),
+                                                         buffer_size,
+                                                         dbuffer));
+
+    if(argus.unit_check)
+    {
+        // Incomplete LU factorization
+        int ilu0_iter = max_iter;
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsritilu0(handle,
+                                                  alg,
+                                                  option,
+                                                  &ilu0_iter,
+                                                  tol,
+                                                  m,
+                                                  nnz,
+                                                  descrA,
+                                                  dvalA,
+                                                  dptr,
+                                                  dcol,
+                                                  dvalM,
+                                                  buffer_size,
+                                                  dbuffer));
+
+        std::vector<T> hilu0(nnz);
+        CHECK_HIP_ERROR(hipMemcpy(hilu0.data(), dvalM, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        int expected_true = 1;
+        int within_limit  = (ilu0_iter >= 0 && ilu0_iter <= max_iter);
+        unit_check_general(1, 1, 1, &expected_true, &within_limit);
+
+        // Convergence history
+        int                             niter;
+        std::vector<floating_data_t<T>> history(2 * max_iter);
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsritilu0_history<T>(
+            handle, alg, &niter, history.data(), buffer_size, dbuffer));
+
+        within_limit = (niter >= 0 && niter <= max_iter);
+        unit_check_general(1, 1, 1, &expected_true, &within_limit);
+
+        // CPU, the fixed-point sweeps converge to the exact factorization
+        std::vector<T> hilu0_gold;
+        host_csritilu0(
+            m, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hilu0_gold, idx_base, max_iter, 0.0);
+
+        std::vector<T> hilu0_exact = hcsr_val;
+        csrilu0(m,
+                hcsr_row_ptr.data(),
+                hcsr_col_ind.data(),
+                hilu0_exact.data(),
+                idx_base,
+                false,
+                0.0,
+                make_DataType<T>(0.0));
+
+        unit_check_near(1, nnz, 1, hilu0_exact.data(), hilu0_gold.data());
+        unit_check_near(1, nnz, 1, hilu0_gold.data(), hilu0.data());
+
+        // Incomplete Cholesky factorization
+        int ic0_iter = max_iter;
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsritic0(handle,
+                                                 alg,
+                                                 option,
+                                                 &ic0_iter,
+                                                 tol,
+                                                 m,
+                                                 nnz,
+                                                 descrA,
+                                                 dvalA,
+                                                 dptr,
+                                                 dcol,
+                                                 dvalM,
+                                                 buffer_size,
+                                                 dbuffer));
+
+        std::vector<T> hic0(nnz);
+        CHECK_HIP_ERROR(hipMemcpy(hic0.data(), dvalM, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        std::vector<T> hic0_gold;
+        host_csritic0(m, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hic0_gold, idx_base, max_iter, 0.0);
+
+        std::vector<T> hic0_exact = hcsr_val;
+        int            struct_pivot;
+        int            numeric_pivot;
+        csric0(m,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hic0_exact.data(),
+               idx_base,
+               struct_pivot,
+               numeric_pivot);
+
+        unit_check_near(1, nnz, 1, hic0_exact.data(), hic0_gold.data());
+        unit_check_near(1, nnz, 1, hic0_gold.data(), hic0.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        int iter;
+
+        // Warm up
+        for(int i = 0; i < number_cold_calls; ++i)
+        {
+            iter = max_iter;
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsritilu0(handle,
+                                                      alg,
+                                                      option,
+                                                      &iter,
+                                                      tol,
+                                                      m,
+                                                      nnz,
+                                                      descrA,
+                                                      dvalA,
+                                                      dptr,
+                                                      dcol,
+                                                      dvalM,
+                                                      buffer_size,
+                                                      dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int i = 0; i < number_hot_calls; ++i)
+        {
+            iter = max_iter;
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsritilu0(handle,
+                                                      alg,
+                                                      option,
+                                                      &iter,
+                                                      tol,
+                                                      m,
+                                                      nnz,
+                                                      descrA,
+                                                      dvalA,
+                                                      dptr,
+                                                      dcol,
+                                                      dvalM,
+                                                      buffer_size,
+                                                      dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::iters,
+                            iter,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRITILU0_HPP
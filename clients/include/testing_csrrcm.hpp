@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRRCM_HPP
+#define TESTING_CSRRCM_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+// Maximum distance of an entry from the diagonal.
+inline int csrrcm_bandwidth(int                     m,
+                            const std::vector<int>& csr_row_ptr,
+                            const std::vector<int>& csr_col_ind,
+                            hipsparseIndexBase_t    base)
+{
+    int bandwidth = 0;
+    for(int i = 0; i < m; ++i)
+    {
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            bandwidth = std::max(bandwidth, std::abs(csr_col_ind[k] - base - i));
+        }
+    }
+
+    return bandwidth;
+}
+
+void testing_csrrcm_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    static constexpr int M   = 10;
+    static constexpr int NNZ = 10;
+
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descr = unique_ptr_descr->descr;
+
+    auto m_csr_row_ptr = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_csr_col_ind = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_perm        = hipsparse_unique_ptr{device_malloc(sizeof(int) * M), device_free};
+    int* d_csr_row_ptr = (int*)m_csr_row_ptr.get();
+    int* d_csr_col_ind = (int*)m_csr_col_ind.get();
+    int* d_perm        = (int*)m_perm.get();
+
+    status = hipsparseXcsrrcm(nullptr, M, NNZ, descr, d_csr_row_ptr, d_csr_col_ind, d_perm);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsrrcm(handle, -1, NNZ, descr, d_csr_row_ptr, d_csr_col_ind, d_perm);
+    verify_hipsparse_status_invalid_size(status, "Error: m is invalid");
+
+    status = hipsparseXcsrrcm(handle, M, -1, descr, d_csr_row_ptr, d_csr_col_ind, d_perm);
+    verify_hipsparse_status_invalid_size(status, "Error: nnz is invalid");
+
+    status = hipsparseXcsrrcm(handle, M, NNZ, nullptr, d_csr_row_ptr, d_csr_col_ind, d_perm);
+    verify_hipsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+
+    status = hipsparseXcsrrcm(handle, M, NNZ, descr, nullptr, d_csr_col_ind, d_perm);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrRowPtr is nullptr");
+
+    status = hipsparseXcsrrcm(handle, M, NNZ, descr, d_csr_row_ptr, nullptr, d_perm);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrColInd is nullptr");
+
+    status = hipsparseXcsrrcm(handle, M, NNZ, descr, d_csr_row_ptr, d_csr_col_ind, nullptr);
+    verify_hipsparse_status_invalid_pointer(status, "Error: P is nullptr");
+#endif
+}
+
+hipsparseStatus_t testing_csrrcm(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  ndim     = argus.M;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, idx_base));
+
+    // Host structures
+    std::vector<int>    hcsr_row_ptr;
+    std::vector<int>    hcsr_col_ind;
+    std::vector<double> hcsr_val;
+
+    srand(12345ULL);
+
+    int m = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    // Shuffle the Laplacian, such that its bandwidth is large
+    std::vector<int> hshuffle(m);
+    for(int i = 0; i < m; ++i)
+    {
+        hshuffle[i] = i;
+    }
+
+    for(int i = m - 1; i > 0; --i)
+    {
+        std::swap(hshuffle[i], hshuffle[rand() % (i + 1)]);
+    }
+
+    std::vector<int>    hA_row_ptr;
+    std::vector<int>    hA_col_ind;
+    std::vector<double> hA_val;
+    host_csrsymperm(m,
+                    hcsr_row_ptr,
+                    hcsr_col_ind,
+                    hcsr_val,
+                    hshuffle,
+                    hA_row_ptr,
+                    hA_col_ind,
+                    hA_val,
+                    idx_base,
+                    idx_base);
+
+    int nnz = hA_row_ptr[m] - idx_base;
+
+    // allocate memory on device
+    auto dptr_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dperm_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+
+    int* dptr  = (int*)dptr_managed.get();
+    int* dcol  = (int*)dcol_managed.get();
+    int* dperm = (int*)dperm_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hA_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hA_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrrcm(handle, m, nnz, descrA, dptr, dcol, dperm));
+
+        // copy output from device to CPU
+        std::vector<int> hperm(m);
+        CHECK_HIP_ERROR(hipMemcpy(hperm.data(), dperm, sizeof(int) * m, hipMemcpyDeviceToHost));
+
+        // CPU
+        std::vector<int> hperm_gold;
+        host_csrrcm(m, hA_row_ptr, hA_col_ind, hperm_gold, idx_base);
+
+        unit_check_general(1, m, 1, hperm_gold.data(), hperm.data());
+
+        // The reordering restores the bandwidth of the Laplacian, which is the grid dimension
+        std::vector<int>    hC_row_ptr;
+        std::vector<int>    hC_col_ind;
+        std::vector<double> hC_val;
+        host_csrsymperm(m,
+                        hA_row_ptr,
+                        hA_col_ind,
+                        hA_val,
+                        hperm,
+                        hC_row_ptr,
+                        hC_col_ind,
+                        hC_val,
+                        idx_base,
+                        idx_base);
+
+        int expected_bandwidth = 1;
+        int bandwidth          = csrrcm_bandwidth(m, hC_row_ptr, hC_col_ind, idx_base) <= ndim;
+        unit_check_general(1, 1, 1, &expected_bandwidth, &bandwidth);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrrcm(handle, m, nnz, descrA, dptr, dcol, dperm));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrrcm(handle, m, nnz, descrA, dptr, dcol, dperm));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRRCM_HPP
@@ -0,0 +1,352 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRSYMPERM_HPP
+#define TESTING_CSRSYMPERM_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+template <typename T>
+void testing_csrsymperm_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    static constexpr int M   = 10;
+    static constexpr int NNZ = 10;
+
+    hipsparseStatus_t status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrC(new descr_struct);
+    hipsparseMatDescr_t           descrC = unique_ptr_descrC->descr;
+
+    auto m_ptr_A = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_A = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_A = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+    auto m_ptr_C = hipsparse_unique_ptr{device_malloc(sizeof(int) * (M + 1)), device_free};
+    auto m_col_C = hipsparse_unique_ptr{device_malloc(sizeof(int) * NNZ), device_free};
+    auto m_val_C = hipsparse_unique_ptr{device_malloc(sizeof(T) * NNZ), device_free};
+    auto m_perm  = hipsparse_unique_ptr{device_malloc(sizeof(int) * M), device_free};
+
+    int* d_ptr_A = (int*)m_ptr_A.get();
+    int* d_col_A = (int*)m_col_A.get();
+    T*   d_val_A = (T*)m_val_A.get();
+    int* d_ptr_C = (int*)m_ptr_C.get();
+    int* d_col_C = (int*)m_col_C.get();
+    T*   d_val_C = (T*)m_val_C.get();
+    int* d_perm  = (int*)m_perm.get();
+
+    status = hipsparseXcsrsymperm(nullptr,
+                                  M,
+                                  NNZ,
+                                  descrA,
+                                  d_val_A,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  d_perm,
+                                  descrC,
+                                  d_val_C,
+                                  d_ptr_C,
+                                  d_col_C);
+    verify_hipsparse_status_invalid_handle(status);
+
+    status = hipsparseXcsrsymperm(handle,
+                                  -1,
+                                  NNZ,
+                                  descrA,
+                                  d_val_A,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  d_perm,
+                                  descrC,
+                                  d_val_C,
+                                  d_ptr_C,
+                                  d_col_C);
+    verify_hipsparse_status_invalid_size(status, "Error: m is invalid");
+
+    status = hipsparseXcsrsymperm(handle,
+                                  M,
+                                  -1,
+                                  descrA,
+                                  d_val_A,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  d_perm,
+                                  descrC,
+                                  d_val_C,
+                                  d_ptr_C,
+                                  d_col_C);
+    verify_hipsparse_status_invalid_size(status, "Error: nnz is invalid");
+
+    status = hipsparseXcsrsymperm(handle,
+                                  M,
+                                  NNZ,
+                                  descrA,
+                                  (const T*)nullptr,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  d_perm,
+                                  descrC,
+                                  d_val_C,
+                                  d_ptr_C,
+                                  d_col_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrValA is nullptr");
+
+    status = hipsparseXcsrsymperm(handle,
+                                  M,
+                                  NNZ,
+                                  descrA,
+                                  d_val_A,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  nullptr,
+                                  descrC,
+                                  d_val_C,
+                                  d_ptr_C,
+                                  d_col_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: P is nullptr");
+
+    status = hipsparseXcsrsymperm(handle,
+                                  M,
+                                  NNZ,
+                                  descrA,
+                                  d_val_A,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  d_perm,
+                                  descrC,
+                                  d_val_C,
+                                  nullptr,
+                                  d_col_C);
+    verify_hipsparse_status_invalid_pointer(status, "Error: csrRowPtrC is nullptr");
+
+    // Only general matrices are supported
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatType(descrA, HIPSPARSE_MATRIX_TYPE_SYMMETRIC));
+
+    status = hipsparseXcsrsymperm(handle,
+                                  M,
+                                  NNZ,
+                                  descrA,
+                                  d_val_A,
+                                  d_ptr_A,
+                                  d_col_A,
+                                  d_perm,
+                                  descrC,
+                                  d_val_C,
+                                  d_ptr_C,
+                                  d_col_C);
+    verify_hipsparse_status_not_supported(status, "Error: matrix type is not supported");
+#endif
+}
+
+template <typename T>
+hipsparseStatus_t testing_csrsymperm(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  ndim   = argus.M;
+    hipsparseIndexBase_t base_A = argus.baseA;
+    hipsparseIndexBase_t base_C = argus.baseC;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrA(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descrA->descr;
+
+    std::unique_ptr<descr_struct> unique_ptr_descrC(new descr_struct);
+    hipsparseMatDescr_t           descrC = unique_ptr_descrC->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, base_A));
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrC, base_C));
+
+    // Host structures
+    std::vector<int> hcsr_row_ptr_A;
+    std::vector<int> hcsr_col_ind_A;
+    std::vector<T>   hcsr_val_A;
+
+    srand(12345ULL);
+
+    int m   = gen_2d_laplacian(ndim, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, base_A);
+    int nnz = hcsr_row_ptr_A[m] - base_A;
+
+    hipsparseInit<T>(hcsr_val_A, 1, nnz);
+
+    // Random permutation
+    std::vector<int> hperm(m);
+    for(int i = 0; i < m; ++i)
+    {
+        hperm[i] = i;
+    }
+
+    for(int i = m - 1; i > 0; --i)
+    {
+        std::swap(hperm[i], hperm[rand() % (i + 1)]);
+    }
+
+    // allocate memory on device
+    auto dptr_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dptr_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dperm_managed  = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+
+    int* dptr_A = (int*)dptr_A_managed.get();
+    int* dcol_A = (int*)dcol_A_managed.get();
+    T*   dval_A = (T*)dval_A_managed.get();
+    int* dptr_C = (int*)dptr_C_managed.get();
+    int* dcol_C = (int*)dcol_C_managed.get();
+    T*   dval_C = (T*)dval_C_managed.get();
+    int* dperm  = (int*)dperm_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr_A, hcsr_row_ptr_A.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol_A, hcsr_col_ind_A.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dperm, hperm.data(), sizeof(int) * m, hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseXcsrsymperm(handle,
+                                                   m,
+                                                   nnz,
+                                                   descrA,
+                                                   dval_A,
+                                                   dptr_A,
+                                                   dcol_A,
+                                                   dperm,
+                                                   descrC,
+                                                   dval_C,
+                                                   dptr_C,
+                                                   dcol_C));
+
+        // copy output from device to CPU
+        std::vector<int> hcsr_row_ptr_C(m + 1);
+        std::vector<int> hcsr_col_ind_C(nnz);
+        std::vector<T>   hcsr_val_C(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_row_ptr_C.data(), dptr_C, sizeof(int) * (m + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_col_ind_C.data(), dcol_C, sizeof(int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C.data(), dval_C, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU
+        std::vector<int> hcsr_row_ptr_C_gold;
+        std::vector<int> hcsr_col_ind_C_gold;
+        std::vector<T>   hcsr_val_C_gold;
+        host_csrsymperm(m,
+                        hcsr_row_ptr_A,
+                        hcsr_col_ind_A,
+                        hcsr_val_A,
+                        hperm,
+                        hcsr_row_ptr_C_gold,
+                        hcsr_col_ind_C_gold,
+                        hcsr_val_C_gold,
+                        base_A,
+                        base_C);
+
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+        unit_check_general(1, nnz, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+        unit_check_general(1, nnz, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrsymperm(handle,
+                                                       m,
+                                                       nnz,
+                                                       descrA,
+                                                       dval_A,
+                                                       dptr_A,
+                                                       dcol_A,
+                                                       dperm,
+                                                       descrC,
+                                                       dval_C,
+                                                       dptr_C,
+                                                       dcol_C));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseXcsrsymperm(handle,
+                                                       m,
+                                                       nnz,
+                                                       descrA,
+                                                       dval_A,
+                                                       dptr_A,
+                                                       dcol_A,
+                                                       dperm,
+                                                       descrC,
+                                                       dval_C,
+                                                       dptr_C,
+                                                       dcol_C));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_CSRSYMPERM_HPP
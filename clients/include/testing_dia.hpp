@@ -0,0 +1,398 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+
+#pragma once
+#ifndef TESTING_DIA_HPP
+#define TESTING_DIA_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_dia_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              ndiag     = 1;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto doff_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    int*   doff = (int*)doff_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t D;
+    int64_t               num_diagonals;
+    int64_t               fill;
+    int64_t               csr_nnz;
+
+    // hipsparseCreateDia
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateDia(nullptr, m, n, ndiag, doff, dval, idxType, idxBase, dataType),
+        "Error: spMatDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateDia(&D, -1, n, ndiag, doff, dval, idxType, idxBase, dataType),
+        "Error: rows is negative");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateDia(&D, m, n, -1, doff, dval, idxType, idxBase, dataType),
+        "Error: diaNumDiagonals is negative");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateDia(&D, m, n, ndiag, nullptr, dval, idxType, idxBase, dataType),
+        "Error: diaOffsets is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateDia(&D, m, n, ndiag, doff, nullptr, idxType, idxBase, dataType),
+        "Error: diaValues is nullptr");
+    verify_hipsparse_status_not_supported(
+        hipsparseCreateDia(&D, m, n, ndiag, doff, dval, HIPSPARSE_INDEX_16U, idxBase, dataType),
+        "Error: diaIdxType is not supported");
+
+    // hipsparseCsr2DiaNnz
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+
+    verify_hipsparse_status_invalid_value(hipsparseCsr2DiaNnz(nullptr, A, &num_diagonals, &fill),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2DiaNnz(handle, nullptr, &num_diagonals, &fill), "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2DiaNnz(handle, A, nullptr, &fill),
+                                          "Error: diaNumDiagonals is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2DiaNnz(handle, A, &num_diagonals, nullptr),
+                                          "Error: diaFill is nullptr");
+
+    // hipsparseCsr2Dia
+    verify_hipsparse_status_success(
+        hipsparseCreateDia(&D, m, n, ndiag, doff, dval, idxType, idxBase, dataType), "success");
+
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Dia(nullptr, A, D),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Dia(handle, nullptr, D),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Dia(handle, A, nullptr),
+                                          "Error: matDia is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseCsr2Dia(handle, A, A),
+                                          "Error: matDia is not a DIA matrix");
+    verify_hipsparse_status_not_supported(hipsparseCsr2DiaNnz(handle, D, &num_diagonals, &fill),
+                                          "Error: matCsr is not a CSR matrix");
+
+    // hipsparseDia2CsrNnz
+    verify_hipsparse_status_invalid_value(hipsparseDia2CsrNnz(nullptr, D, dptr, &csr_nnz),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseDia2CsrNnz(handle, nullptr, dptr, &csr_nnz),
+                                          "Error: matDia is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseDia2CsrNnz(handle, D, nullptr, &csr_nnz),
+                                          "Error: csrRowOffsets is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseDia2CsrNnz(handle, D, dptr, nullptr),
+                                          "Error: csrNnz is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseDia2CsrNnz(handle, A, dptr, &csr_nnz),
+                                          "Error: matDia is not a DIA matrix");
+
+    // hipsparseDia2Csr
+    verify_hipsparse_status_invalid_value(hipsparseDia2Csr(nullptr, D, A),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseDia2Csr(handle, nullptr, A),
+                                          "Error: matDia is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseDia2Csr(handle, D, nullptr),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseDia2Csr(handle, A, A),
+                                          "Error: matDia is not a DIA matrix");
+
+    // hipsparseSpMV and hipsparseSpMM, there are no kernels for the DIA format
+    float                 alpha = 1.0f;
+    float                 beta  = 0.0f;
+    size_t                bufferSize;
+    hipsparseDnVecDescr_t x;
+    hipsparseDnMatDescr_t B;
+    hipsparseStatus_t     status;
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dval, dataType), "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateDnMat(&B, n, 1, n, dval, dataType, HIPSPARSE_ORDER_COL), "success");
+
+    status = hipsparseSpMV_bufferSize(handle,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      &alpha,
+                                      D,
+                                      x,
+                                      &beta,
+                                      x,
+                                      dataType,
+                                      HIPSPARSE_SPMV_ALG_DEFAULT,
+                                      &bufferSize);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a DIA matrix");
+
+    status = hipsparseSpMV(handle,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           &alpha,
+                           D,
+                           x,
+                           &beta,
+                           x,
+                           dataType,
+                           HIPSPARSE_SPMV_ALG_DEFAULT,
+                           dval);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a DIA matrix");
+
+    status = hipsparseSpMM_bufferSize(handle,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      &alpha,
+                                      D,
+                                      B,
+                                      &beta,
+                                      B,
+                                      dataType,
+                                      HIPSPARSE_SPMM_ALG_DEFAULT,
+                                      &bufferSize);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a DIA matrix");
+
+    status = hipsparseSpMM(handle,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           &alpha,
+                           D,
+                           B,
+                           &beta,
+                           B,
+                           dataType,
+                           HIPSPARSE_SPMM_ALG_DEFAULT,
+                           dval);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a DIA matrix");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnMat(B), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(D), "success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+//
+// Convert a CSR matrix on the device into a DIA matrix and check the conversion against the host,
+// then convert the DIA matrix back into CSR format. The device arrays of the DIA matrix are
+// returned in the managed pointers.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_dia_convert(hipsparseHandle_t      handle,
+                                             I                      m,
+                                             I                      n,
+                                             I                      nnz,
+                                             const std::vector<I>&  hcsr_row_ptr,
+                                             const std::vector<I>&  hcsr_col_ind,
+                                             const std::vector<T>&  hcsr_val,
+                                             hipsparseIndexBase_t   idxBase,
+                                             hipsparse_unique_ptr&  ddia_off_managed,
+                                             hipsparse_unique_ptr&  ddia_val_managed,
+                                             hipsparseSpMatDescr_t* D)
+{
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    I* dcol = (I*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeI, idxBase, typeT));
+
+    int64_t num_diagonals;
+    int64_t fill;
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2DiaNnz(handle, A, &num_diagonals, &fill));
+
+    ddia_off_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * std::max(num_diagonals, int64_t(1))),
+                               device_free};
+    ddia_val_managed = hipsparse_unique_ptr{
+        device_malloc(sizeof(T) * std::max(num_diagonals * m, int64_t(1))), device_free};
+
+    I* ddia_off = (I*)ddia_off_managed.get();
+    T* ddia_val = (T*)ddia_val_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateDia(D, m, n, num_diagonals, ddia_off, ddia_val, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2Dia(handle, A, *D));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    // Host conversion
+    std::vector<I> hdia_off_gold;
+    std::vector<T> hdia_val_gold;
+    host_csr_to_dia(m,
+                    n,
+                    hcsr_row_ptr.data(),
+                    hcsr_col_ind.data(),
+                    hcsr_val.data(),
+                    idxBase,
+                    hdia_off_gold,
+                    hdia_val_gold);
+
+    int64_t num_diagonals_gold = hdia_off_gold.size();
+    int64_t fill_gold          = num_diagonals_gold * m - nnz;
+    unit_check_general(1, 1, 1, &num_diagonals_gold, &num_diagonals);
+    unit_check_general(1, 1, 1, &fill_gold, &fill);
+
+    std::vector<I> hdia_off(num_diagonals);
+    std::vector<T> hdia_val(num_diagonals * m);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hdia_off.data(), ddia_off, sizeof(I) * num_diagonals, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hdia_val.data(), ddia_val, sizeof(T) * num_diagonals * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, num_diagonals, 1, hdia_off_gold.data(), hdia_off.data());
+    unit_check_general(1, num_diagonals * m, 1, hdia_val_gold.data(), hdia_val.data());
+
+    // The descriptor reports the DIA format
+    hipsparseFormat_t format;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(*D, &format));
+
+    int format_gold = HIPSPARSE_FORMAT_DIA;
+    int format_dia  = format;
+    unit_check_general(1, 1, 1, &format_gold, &format_dia);
+
+    // Convert back into CSR, the explicit zeros of the diagonals are dropped
+    auto dptr2_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    I*   dptr2         = (I*)dptr2_managed.get();
+
+    int64_t csr_nnz;
+    CHECK_HIPSPARSE_ERROR(hipsparseDia2CsrNnz(handle, *D, dptr2, &csr_nnz));
+
+    int64_t csr_nnz_gold = nnz;
+    unit_check_general(1, 1, 1, &csr_nnz_gold, &csr_nnz);
+
+    auto dcol2_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    I* dcol2 = (I*)dcol2_managed.get();
+    T* dval2 = (T*)dval2_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr2, dcol2, dval2, typeI, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseDia2Csr(handle, *D, A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    std::vector<I> hcsr_row_ptr2(m + 1);
+    std::vector<I> hcsr_col_ind2(nnz);
+    std::vector<T> hcsr_val2(nnz);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_row_ptr2.data(), dptr2, sizeof(I) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_col_ind2.data(), dcol2, sizeof(I) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val2.data(), dval2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    std::vector<I> hcsr_row_ptr_gold = hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind_gold = hcsr_col_ind;
+    std::vector<T> hcsr_val_gold     = hcsr_val;
+
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr2.data());
+    unit_check_general(1, nnz, 1, hcsr_col_ind_gold.data(), hcsr_col_ind2.data());
+    unit_check_general(1, nnz, 1, hcsr_val_gold.data(), hcsr_val2.data());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_csr2dia(Arguments argus)
+{
+    I                    m        = argus.M;
+    I                    n        = argus.N;
+    hipsparseIndexBase_t idxBase  = argus.baseA;
+    std::string          filename = argus.filename;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Convert into DIA and back
+    auto ddia_off_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto ddia_val_managed = hipsparse_unique_ptr{nullptr, device_free};
+
+    hipsparseSpMatDescr_t D;
+    CHECK_HIPSPARSE_ERROR(testing_dia_convert(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              hcsr_row_ptr,
+                                              hcsr_col_ind,
+                                              hcsr_val,
+                                              idxBase,
+                                              ddia_off_managed,
+                                              ddia_val_managed,
+                                              &D));
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(D));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#endif // TESTING_DIA_HPP
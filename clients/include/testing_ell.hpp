@@ -0,0 +1,571 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+
+#pragma once
+#ifndef TESTING_ELL_HPP
+#define TESTING_ELL_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_ell_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              width     = 1;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t E;
+    int64_t               ell_width;
+    int64_t               fill;
+    int64_t               csr_nnz;
+
+    // hipsparseCreateEll
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateEll(nullptr, m, n, width, dcol, dval, idxType, idxBase, dataType),
+        "Error: spMatDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateEll(&E, -1, n, width, dcol, dval, idxType, idxBase, dataType),
+        "Error: rows is negative");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateEll(&E, m, n, -1, dcol, dval, idxType, idxBase, dataType),
+        "Error: ellWidth is negative");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateEll(&E, m, n, width, nullptr, dval, idxType, idxBase, dataType),
+        "Error: ellColInd is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateEll(&E, m, n, width, dcol, nullptr, idxType, idxBase, dataType),
+        "Error: ellValues is nullptr");
+
+    // hipsparseCsr2EllNnz
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+
+    verify_hipsparse_status_invalid_value(hipsparseCsr2EllNnz(nullptr, A, &ell_width, &fill),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2EllNnz(handle, nullptr, &ell_width, &fill),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2EllNnz(handle, A, nullptr, &fill),
+                                          "Error: ellWidth is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2EllNnz(handle, A, &ell_width, nullptr),
+                                          "Error: ellFill is nullptr");
+
+    // hipsparseCsr2Ell
+    verify_hipsparse_status_success(
+        hipsparseCreateEll(&E, m, n, width, dcol, dval, idxType, idxBase, dataType), "success");
+
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Ell(nullptr, A, E),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Ell(handle, nullptr, E),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Ell(handle, A, nullptr),
+                                          "Error: matEll is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseCsr2Ell(handle, A, A),
+                                          "Error: matEll is not an ELL matrix");
+    verify_hipsparse_status_not_supported(hipsparseCsr2EllNnz(handle, E, &ell_width, &fill),
+                                          "Error: matCsr is not a CSR matrix");
+
+    // hipsparseEll2CsrNnz
+    verify_hipsparse_status_invalid_value(hipsparseEll2CsrNnz(nullptr, E, dptr, &csr_nnz),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseEll2CsrNnz(handle, nullptr, dptr, &csr_nnz),
+                                          "Error: matEll is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseEll2CsrNnz(handle, E, nullptr, &csr_nnz),
+                                          "Error: csrRowOffsets is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseEll2CsrNnz(handle, E, dptr, nullptr),
+                                          "Error: csrNnz is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseEll2CsrNnz(handle, A, dptr, &csr_nnz),
+                                          "Error: matEll is not an ELL matrix");
+
+    // hipsparseEll2Csr
+    verify_hipsparse_status_invalid_value(hipsparseEll2Csr(nullptr, E, A),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseEll2Csr(handle, nullptr, A),
+                                          "Error: matEll is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseEll2Csr(handle, E, nullptr),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseEll2Csr(handle, A, A),
+                                          "Error: matEll is not an ELL matrix");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(E), "success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+//
+// Convert a CSR matrix on the device into an ELL matrix and check the conversion against the host,
+// then convert the ELL matrix back into CSR format. The device arrays of the ELL matrix are
+// returned in the managed pointers.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_ell_convert(hipsparseHandle_t      handle,
+                                             I                      m,
+                                             I                      n,
+                                             I                      nnz,
+                                             const std::vector<I>&  hcsr_row_ptr,
+                                             const std::vector<I>&  hcsr_col_ind,
+                                             const std::vector<T>&  hcsr_val,
+                                             hipsparseIndexBase_t   idxBase,
+                                             hipsparse_unique_ptr&  dell_col_managed,
+                                             hipsparse_unique_ptr&  dell_val_managed,
+                                             hipsparseSpMatDescr_t* E)
+{
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    I* dcol = (I*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeI, idxBase, typeT));
+
+    int64_t ell_width;
+    int64_t fill;
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2EllNnz(handle, A, &ell_width, &fill));
+
+    dell_col_managed = hipsparse_unique_ptr{
+        device_malloc(sizeof(I) * std::max(ell_width * m, int64_t(1))), device_free};
+    dell_val_managed = hipsparse_unique_ptr{
+        device_malloc(sizeof(T) * std::max(ell_width * m, int64_t(1))), device_free};
+
+    I* dell_col = (I*)dell_col_managed.get();
+    T* dell_val = (T*)dell_val_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateEll(E, m, n, ell_width, dell_col, dell_val, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2Ell(handle, A, *E));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    // Host conversion
+    I              ell_width_gold;
+    std::vector<I> hell_col_gold;
+    std::vector<T> hell_val_gold;
+    host_csr_to_ell(m,
+                    hcsr_row_ptr.data(),
+                    hcsr_col_ind.data(),
+                    hcsr_val.data(),
+                    idxBase,
+                    ell_width_gold,
+                    hell_col_gold,
+                    hell_val_gold);
+
+    int64_t width_gold = ell_width_gold;
+    int64_t fill_gold  = width_gold * m - nnz;
+    unit_check_general(1, 1, 1, &width_gold, &ell_width);
+    unit_check_general(1, 1, 1, &fill_gold, &fill);
+
+    std::vector<I> hell_col(ell_width * m);
+    std::vector<T> hell_val(ell_width * m);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hell_col.data(), dell_col, sizeof(I) * ell_width * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hell_val.data(), dell_val, sizeof(T) * ell_width * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, ell_width * m, 1, hell_col_gold.data(), hell_col.data());
+    unit_check_general(1, ell_width * m, 1, hell_val_gold.data(), hell_val.data());
+
+    // The descriptor reports the ELL format
+    hipsparseFormat_t format;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(*E, &format));
+
+    int format_gold = HIPSPARSE_FORMAT_ELL;
+    int format_ell  = format;
+    unit_check_general(1, 1, 1, &format_gold, &format_ell);
+
+    // Convert back into CSR
+    auto dptr2_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    I*   dptr2         = (I*)dptr2_managed.get();
+
+    int64_t csr_nnz;
+    CHECK_HIPSPARSE_ERROR(hipsparseEll2CsrNnz(handle, *E, dptr2, &csr_nnz));
+
+    int64_t csr_nnz_gold = nnz;
+    unit_check_general(1, 1, 1, &csr_nnz_gold, &csr_nnz);
+
+    auto dcol2_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval2_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    I* dcol2 = (I*)dcol2_managed.get();
+    T* dval2 = (T*)dval2_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr2, dcol2, dval2, typeI, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseEll2Csr(handle, *E, A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    std::vector<I> hcsr_row_ptr2(m + 1);
+    std::vector<I> hcsr_col_ind2(nnz);
+    std::vector<T> hcsr_val2(nnz);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_row_ptr2.data(), dptr2, sizeof(I) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_col_ind2.data(), dcol2, sizeof(I) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val2.data(), dval2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    std::vector<I> hcsr_row_ptr_gold = hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind_gold = hcsr_col_ind;
+    std::vector<T> hcsr_val_gold     = hcsr_val;
+
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr2.data());
+    unit_check_general(1, nnz, 1, hcsr_col_ind_gold.data(), hcsr_col_ind2.data());
+    unit_check_general(1, nnz, 1, hcsr_val_gold.data(), hcsr_val2.data());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmv_ell(Arguments argus)
+{
+    I                    m        = argus.M;
+    I                    n        = argus.N;
+    T                    h_alpha  = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                    h_beta   = make_DataType2<T>(argus.beta, argus.betai);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idxBase  = argus.baseA;
+    std::string          filename = argus.filename;
+
+    // Data type
+    hipDataType typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Convert into ELL
+    auto dell_col_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto dell_val_managed = hipsparse_unique_ptr{nullptr, device_free};
+
+    hipsparseSpMatDescr_t E;
+    CHECK_HIPSPARSE_ERROR(testing_ell_convert(handle,
+                                              m,
+                                              n,
+                                              nnz,
+                                              hcsr_row_ptr,
+                                              hcsr_col_ind,
+                                              hcsr_val,
+                                              idxBase,
+                                              dell_col_managed,
+                                              dell_val_managed,
+                                              &E));
+
+    I size_x = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    I size_y = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<T> hx(size_x);
+    std::vector<T> hy(size_y);
+
+    hipsparseInit<T>(hx, 1, size_x);
+    hipsparseInit<T>(hy, 1, size_y);
+
+    std::vector<T> hy_gold = hy;
+
+    auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, size_x, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, size_y, dy, typeT));
+
+    // SpMV
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(handle,
+                                                   transA,
+                                                   &h_alpha,
+                                                   E,
+                                                   x,
+                                                   &h_beta,
+                                                   y,
+                                                   typeT,
+                                                   HIPSPARSE_SPMV_ALG_DEFAULT,
+                                                   &bufferSize));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(bufferSize, size_t(4))), device_free};
+    void* dbuffer = dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV(handle,
+                                        transA,
+                                        &h_alpha,
+                                        E,
+                                        x,
+                                        &h_beta,
+                                        y,
+                                        typeT,
+                                        HIPSPARSE_SPMV_ALG_DEFAULT,
+                                        dbuffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+    // Host SpMV on the ELL matrix
+    int64_t              rows, cols, ell_width;
+    void*                dell_col;
+    void*                dell_val;
+    hipsparseIndexType_t idx_type;
+    hipsparseIndexBase_t idx_base;
+    hipDataType          data_type;
+    CHECK_HIPSPARSE_ERROR(hipsparseEllGet(
+        E, &rows, &cols, &ell_width, &dell_col, &dell_val, &idx_type, &idx_base, &data_type));
+
+    std::vector<I> hell_col(ell_width * m);
+    std::vector<T> hell_val(ell_width * m);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hell_col.data(), dell_col, sizeof(I) * ell_width * m, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hell_val.data(), dell_val, sizeof(T) * ell_width * m, hipMemcpyDeviceToHost));
+
+    host_ellmv(transA,
+               m,
+               n,
+               (I)ell_width,
+               hell_col.data(),
+               hell_val.data(),
+               h_alpha,
+               hx.data(),
+               h_beta,
+               hy_gold.data(),
+               idxBase);
+
+    unit_check_near(1, size_y, 1, hy_gold.data(), hy.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(E));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmm_ell(Arguments argus)
+{
+    I                    m        = argus.M;
+    I                    n        = argus.N;
+    I                    k        = argus.K;
+    T                    h_alpha  = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                    h_beta   = make_DataType2<T>(argus.beta, argus.betai);
+    hipsparseOperation_t transB   = argus.transB;
+    hipsparseOrder_t     orderB   = argus.orderB;
+    hipsparseOrder_t     orderC   = argus.orderC;
+    hipsparseIndexBase_t idxBase  = argus.baseA;
+    std::string          filename = argus.filename;
+
+    // Data type
+    hipDataType typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, k, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Convert into ELL
+    auto dell_col_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto dell_val_managed = hipsparse_unique_ptr{nullptr, device_free};
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(testing_ell_convert(handle,
+                                              m,
+                                              k,
+                                              nnz,
+                                              hcsr_row_ptr,
+                                              hcsr_col_ind,
+                                              hcsr_val,
+                                              idxBase,
+                                              dell_col_managed,
+                                              dell_val_managed,
+                                              &A));
+
+    I B_m = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? k : n;
+    I B_n = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : k;
+
+    int64_t ldb = (orderB == HIPSPARSE_ORDER_COL) ? B_m : B_n;
+    int64_t ldc = (orderC == HIPSPARSE_ORDER_COL) ? m : n;
+
+    int64_t nnz_B = int64_t(B_m) * B_n;
+    int64_t nnz_C = int64_t(m) * n;
+
+    std::vector<T> hB(nnz_B);
+    std::vector<T> hC(nnz_C);
+
+    hipsparseInit<T>(hB, nnz_B, 1);
+    hipsparseInit<T>(hC, nnz_C, 1);
+
+    std::vector<T> hC_gold = hC;
+
+    auto dB_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dC_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    T* dB = (T*)dB_managed.get();
+    T* dC = (T*)dC_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+
+    hipsparseDnMatDescr_t B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, B_m, B_n, ldb, dB, typeT, orderB));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C, m, n, ldc, dC, typeT, orderC));
+
+    // SpMM
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM_bufferSize(handle,
+                                                   HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                   transB,
+                                                   &h_alpha,
+                                                   A,
+                                                   B,
+                                                   &h_beta,
+                                                   C,
+                                                   typeT,
+                                                   HIPSPARSE_SPMM_ALG_DEFAULT,
+                                                   &bufferSize));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(bufferSize, size_t(4))), device_free};
+    void* dbuffer = dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMM(handle,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        transB,
+                                        &h_alpha,
+                                        A,
+                                        B,
+                                        &h_beta,
+                                        C,
+                                        typeT,
+                                        HIPSPARSE_SPMM_ALG_DEFAULT,
+                                        dbuffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    // The ELL matrix holds the CSR matrix
+    host_csrmm(m,
+               n,
+               k,
+               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               transB,
+               h_alpha,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val.data(),
+               hB.data(),
+               (I)ldb,
+               orderB,
+               h_beta,
+               hC_gold.data(),
+               (I)ldc,
+               orderC,
+               idxBase,
+               false);
+
+    unit_check_near(1, nnz_C, 1, hC_gold.data(), hC.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#endif // TESTING_ELL_HPP
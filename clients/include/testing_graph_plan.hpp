@@ -0,0 +1,310 @@
+/* ************************************************************************
+ * Copyright (C) 2020 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_GRAPH_PLAN_HPP
+#define TESTING_GRAPH_PLAN_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <hipsparse.h>
+
+#include "hipsparse_arguments.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <vector>
+
+using namespace hipsparse_test;
+
+void testing_graph_plan_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseCreateGraphPlan(nullptr),
+                                            "Error: plan is nullptr");
+
+    hipsparseGraphPlan_t plan;
+    verify_hipsparse_status_success(hipsparseCreateGraphPlan(&plan), "success");
+
+    verify_hipsparse_status(hipsparseGraphPlanBeginCapture(nullptr, plan),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseGraphPlanBeginCapture(handle, nullptr),
+                                            "Error: plan is nullptr");
+
+    verify_hipsparse_status(hipsparseGraphPlanEndCapture(nullptr, plan),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseGraphPlanEndCapture(handle, nullptr),
+                                            "Error: plan is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGraphPlanEndCapture(handle, plan),
+                                          "Error: plan is not capturing");
+
+    verify_hipsparse_status(hipsparseGraphPlanLaunch(nullptr, plan),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseGraphPlanLaunch(handle, nullptr),
+                                            "Error: plan is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseGraphPlanLaunch(handle, plan),
+                                          "Error: nothing has been captured");
+
+    verify_hipsparse_status_success(hipsparseGraphPlanBeginCapture(handle, plan), "success");
+    verify_hipsparse_status_invalid_value(hipsparseGraphPlanBeginCapture(handle, plan),
+                                          "Error: plan is already capturing");
+    verify_hipsparse_status_invalid_value(hipsparseGraphPlanLaunch(handle, plan),
+                                          "Error: plan is still capturing");
+    verify_hipsparse_status_success(hipsparseGraphPlanEndCapture(handle, plan), "success");
+
+    verify_hipsparse_status_success(hipsparseDestroyGraphPlan(plan), "success");
+#endif
+}
+
+hipsparseStatus_t testing_graph_plan(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // 3 x 4 matrix
+    int m   = 3;
+    int n   = 4;
+    int nnz = 5;
+
+    float alpha = 2.0f;
+    float beta  = 1.0f;
+
+    std::vector<int>   hcsr_row_ptr = {0, 2, 3, 5};
+    std::vector<int>   hcsr_col_ind = {0, 3, 1, 0, 2};
+    std::vector<float> hcsr_val     = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+    std::vector<float> hx           = {1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> hy           = {1.0f, 1.0f, 1.0f};
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+    auto dx_managed       = hipsparse_unique_ptr{device_malloc(sizeof(float) * n), device_free};
+    auto dy_managed       = hipsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+    float* dx           = (float*)dx_managed.get();
+    float* dy           = (float*)dy_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x;
+    hipsparseDnVecDescr_t y;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             dcsr_val,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_BASE_ZERO,
+                                             HIP_R_32F));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, n, dx, HIP_R_32F));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, HIP_R_32F));
+
+    hipsparseGraphPlan_t plan;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateGraphPlan(&plan));
+
+    // First SpMV with A is captured, its setup runs outside of the capture
+    CHECK_HIPSPARSE_ERROR(hipsparseGraphPlanBeginCapture(handle, plan));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV(handle,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        &alpha,
+                                        A,
+                                        x,
+                                        &beta,
+                                        y,
+                                        HIP_R_32F,
+                                        HIPSPARSE_SPMV_ALG_DEFAULT,
+                                        nullptr));
+    CHECK_HIPSPARSE_ERROR(hipsparseGraphPlanEndCapture(handle, plan));
+
+    // Captured calls are not executed
+    std::vector<float> hy_gold = hy;
+    std::vector<float> hy_result(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_result.data(), dy, sizeof(float) * m, hipMemcpyDeviceToHost));
+    unit_check_general(1, m, 1, hy_gold.data(), hy_result.data());
+
+    // Every launch replays y = alpha * A * x + y, with the current contents of x
+    const int launches = 3;
+    for(int launch = 0; launch < launches + 1; ++launch)
+    {
+        if(launch == launches)
+        {
+            hx = {-1.0f, 0.5f, 2.0f, 0.0f};
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+        }
+
+        CHECK_HIPSPARSE_ERROR(hipsparseGraphPlanLaunch(handle, plan));
+
+        for(int i = 0; i < m; ++i)
+        {
+            float sum = 0.0f;
+            for(int j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
+            {
+                sum += hcsr_val[j] * hx[hcsr_col_ind[j]];
+            }
+
+            hy_gold[i] = alpha * sum + beta * hy_gold[i];
+        }
+    }
+
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIP_ERROR(hipMemcpy(hy_result.data(), dy, sizeof(float) * m, hipMemcpyDeviceToHost));
+    unit_check_near(1, m, 1, hy_gold.data(), hy_result.data());
+
+    // The handle got its stream back and runs eagerly again
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV(handle,
+                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                        &alpha,
+                                        A,
+                                        x,
+                                        &beta,
+                                        y,
+                                        HIP_R_32F,
+                                        HIPSPARSE_SPMV_ALG_DEFAULT,
+                                        nullptr));
+
+    for(int i = 0; i < m; ++i)
+    {
+        float sum = 0.0f;
+        for(int j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
+        {
+            sum += hcsr_val[j] * hx[hcsr_col_ind[j]];
+        }
+
+        hy_gold[i] = alpha * sum + beta * hy_gold[i];
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hy_result.data(), dy, sizeof(float) * m, hipMemcpyDeviceToHost));
+    unit_check_near(1, m, 1, hy_gold.data(), hy_result.data());
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyGraphPlan(plan));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t testing_graph_plan_host_path(void)
+{
+#if(!defined(CUDART_VERSION))
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // 3 x 4 matrix with the diagonals -2, 0 and 3
+    int m   = 3;
+    int n   = 4;
+    int nnz = 5;
+
+    std::vector<int>   hcsr_row_ptr = {0, 2, 3, 5};
+    std::vector<int>   hcsr_col_ind = {0, 3, 1, 0, 2};
+    std::vector<float> hcsr_val     = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dcsr_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             dcsr_val,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_BASE_ZERO,
+                                             HIP_R_32F));
+
+    hipsparseGraphPlan_t plan;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateGraphPlan(&plan));
+
+    int64_t num_diagonals = -1;
+    int64_t fill          = -1;
+
+    // The conversion copies the matrix to the host and synchronizes, it cannot be captured
+    CHECK_HIPSPARSE_ERROR(hipsparseGraphPlanBeginCapture(handle, plan));
+    verify_hipsparse_status(hipsparseCsr2DiaNnz(handle, A, &num_diagonals, &fill),
+                            HIPSPARSE_STATUS_NOT_SUPPORTED,
+                            "Error: host conversion during stream capture");
+    CHECK_HIPSPARSE_ERROR(hipsparseGraphPlanEndCapture(handle, plan));
+
+    int64_t num_diagonals_unset = -1;
+    unit_check_general(1, 1, 1, &num_diagonals_unset, &num_diagonals);
+
+    // The rejected call did not invalidate the capture, the handle runs eagerly again
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2DiaNnz(handle, A, &num_diagonals, &fill));
+
+    int64_t num_diagonals_gold = 3;
+    int64_t fill_gold          = num_diagonals_gold * m - nnz;
+
+    unit_check_general(1, 1, 1, &num_diagonals_gold, &num_diagonals);
+    unit_check_general(1, 1, 1, &fill_gold, &fill);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyGraphPlan(plan));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_GRAPH_PLAN_HPP
@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+
+#pragma once
+#ifndef TESTING_SELL_HPP
+#define TESTING_SELL_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_sell_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    int64_t              C         = 4;
+    int64_t              sigma     = 8;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto doff_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dperm_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int*   dptr  = (int*)dptr_managed.get();
+    int*   dcol  = (int*)dcol_managed.get();
+    float* dval  = (float*)dval_managed.get();
+    int*   doff  = (int*)doff_managed.get();
+    int*   dperm = (int*)dperm_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    hipsparseSpMatDescr_t S;
+    int64_t               values_size;
+
+    // hipsparseCreateSell
+    verify_hipsparse_status_invalid_value(hipsparseCreateSell(nullptr,
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              nnz,
+                                                              C,
+                                                              doff,
+                                                              dcol,
+                                                              dval,
+                                                              dperm,
+                                                              idxType,
+                                                              idxBase,
+                                                              dataType),
+                                          "Error: spMatDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateSell(
+            &S, m, n, nnz, nnz, 0, doff, dcol, dval, dperm, idxType, idxBase, dataType),
+        "Error: sliceSize is not positive");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateSell(
+            &S, m, n, nnz, nnz - 1, C, doff, dcol, dval, dperm, idxType, idxBase, dataType),
+        "Error: sellValuesSize is less than nnz");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateSell(
+            &S, m, n, nnz, nnz, C, nullptr, dcol, dval, dperm, idxType, idxBase, dataType),
+        "Error: sellSliceOffsets is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateSell(
+            &S, m, n, nnz, nnz, C, doff, nullptr, dval, dperm, idxType, idxBase, dataType),
+        "Error: sellColInd is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCreateSell(
+            &S, m, n, nnz, nnz, C, doff, dcol, nullptr, dperm, idxType, idxBase, dataType),
+        "Error: sellValues is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseCreateSell(&S,
+                                                              m,
+                                                              n,
+                                                              nnz,
+                                                              nnz,
+                                                              C,
+                                                              doff,
+                                                              dcol,
+                                                              dval,
+                                                              dperm,
+                                                              HIPSPARSE_INDEX_16U,
+                                                              idxBase,
+                                                              dataType),
+                                          "Error: sellIdxType is not supported");
+
+    // hipsparseCsr2SellNnz
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(nullptr, A, C, sigma, doff, dperm, &values_size),
+        "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(handle, nullptr, C, sigma, doff, dperm, &values_size),
+        "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(handle, A, 0, sigma, doff, dperm, &values_size),
+        "Error: sliceSize is not positive");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(handle, A, C, 0, doff, dperm, &values_size),
+        "Error: sigma is not positive");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(handle, A, C, sigma, nullptr, dperm, &values_size),
+        "Error: sellSliceOffsets is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(handle, A, C, sigma, doff, nullptr, &values_size),
+        "Error: sellRowPerm is nullptr with sigma > 1");
+    verify_hipsparse_status_invalid_value(
+        hipsparseCsr2SellNnz(handle, A, C, sigma, doff, dperm, nullptr),
+        "Error: sellValuesSize is nullptr");
+
+    // hipsparseCsr2Sell
+    verify_hipsparse_status_success(
+        hipsparseCreateSell(
+            &S, m, n, nnz, nnz, C, doff, dcol, dval, dperm, idxType, idxBase, dataType),
+        "success");
+
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Sell(nullptr, A, S),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Sell(handle, nullptr, S),
+                                          "Error: matCsr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseCsr2Sell(handle, A, nullptr),
+                                          "Error: matSell is nullptr");
+    verify_hipsparse_status_not_supported(hipsparseCsr2Sell(handle, A, A),
+                                          "Error: matSell is not a SELL-C-sigma matrix");
+    verify_hipsparse_status_not_supported(
+        hipsparseCsr2SellNnz(handle, S, C, sigma, doff, dperm, &values_size),
+        "Error: matCsr is not a CSR matrix");
+
+    // hipsparseSpMV and hipsparseSpMM, there are no kernels for the SELL-C-sigma format
+    float                 alpha = 1.0f;
+    float                 beta  = 0.0f;
+    size_t                bufferSize;
+    hipsparseDnVecDescr_t x;
+    hipsparseDnMatDescr_t B;
+    hipsparseStatus_t     status;
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dval, dataType), "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateDnMat(&B, n, 1, n, dval, dataType, HIPSPARSE_ORDER_COL), "success");
+
+    status = hipsparseSpMV_bufferSize(handle,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      &alpha,
+                                      S,
+                                      x,
+                                      &beta,
+                                      x,
+                                      dataType,
+                                      HIPSPARSE_SPMV_ALG_DEFAULT,
+                                      &bufferSize);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a SELL-C-sigma matrix");
+
+    status = hipsparseSpMV(handle,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           &alpha,
+                           S,
+                           x,
+                           &beta,
+                           x,
+                           dataType,
+                           HIPSPARSE_SPMV_ALG_DEFAULT,
+                           dval);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a SELL-C-sigma matrix");
+
+    status = hipsparseSpMM_bufferSize(handle,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                      &alpha,
+                                      S,
+                                      B,
+                                      &beta,
+                                      B,
+                                      dataType,
+                                      HIPSPARSE_SPMM_ALG_DEFAULT,
+                                      &bufferSize);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a SELL-C-sigma matrix");
+
+    status = hipsparseSpMM(handle,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           &alpha,
+                           S,
+                           B,
+                           &beta,
+                           B,
+                           dataType,
+                           HIPSPARSE_SPMM_ALG_DEFAULT,
+                           dval);
+    verify_hipsparse_status_not_supported(status, "Error: matA is a SELL-C-sigma matrix");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnMat(B), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(S), "success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+//
+// Convert a CSR matrix on the device into a SELL-C-sigma matrix and check the conversion
+// against the host. The device arrays of the SELL-C-sigma matrix are returned in the managed
+// pointers.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_sell_convert(hipsparseHandle_t     handle,
+                                              I                     m,
+                                              I                     n,
+                                              I                     nnz,
+                                              I                     C,
+                                              I                     sigma,
+                                              const std::vector<I>& hcsr_row_ptr,
+                                              const std::vector<I>& hcsr_col_ind,
+                                              const std::vector<T>& hcsr_val,
+                                              hipsparseIndexBase_t  idxBase,
+                                              hipsparse_unique_ptr& dsell_off_managed,
+                                              hipsparse_unique_ptr& dsell_col_managed,
+                                              hipsparse_unique_ptr& dsell_val_managed,
+                                              hipsparse_unique_ptr& dsell_perm_managed,
+                                              hipsparseSpMatDescr_t* S)
+{
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    I slices = (m + C - 1) / C;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    I* dcol = (I*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeI, idxBase, typeT));
+
+    dsell_off_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (slices + 1)), device_free};
+    dsell_perm_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * m), device_free};
+
+    I* dsell_off  = (I*)dsell_off_managed.get();
+    I* dsell_perm = (I*)dsell_perm_managed.get();
+
+    int64_t values_size;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCsr2SellNnz(handle, A, C, sigma, dsell_off, dsell_perm, &values_size));
+
+    dsell_col_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * values_size), device_free};
+    dsell_val_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * values_size), device_free};
+
+    I* dsell_col = (I*)dsell_col_managed.get();
+    T* dsell_val = (T*)dsell_val_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateSell(S,
+                                              m,
+                                              n,
+                                              nnz,
+                                              values_size,
+                                              C,
+                                              dsell_off,
+                                              dsell_col,
+                                              dsell_val,
+                                              dsell_perm,
+                                              typeI,
+                                              idxBase,
+                                              typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCsr2Sell(handle, A, *S));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    // Host conversion
+    std::vector<I> hsell_off_gold;
+    std::vector<I> hsell_col_gold;
+    std::vector<T> hsell_val_gold;
+    std::vector<I> hsell_perm_gold;
+    host_csr_to_sell(m,
+                     hcsr_row_ptr.data(),
+                     hcsr_col_ind.data(),
+                     hcsr_val.data(),
+                     idxBase,
+                     C,
+                     sigma,
+                     hsell_off_gold,
+                     hsell_col_gold,
+                     hsell_val_gold,
+                     hsell_perm_gold);
+
+    int64_t values_size_gold = hsell_off_gold[slices];
+    unit_check_general(1, 1, 1, &values_size_gold, &values_size);
+
+    std::vector<I> hsell_off(slices + 1);
+    std::vector<I> hsell_col(values_size);
+    std::vector<T> hsell_val(values_size);
+    std::vector<I> hsell_perm(m);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hsell_off.data(), dsell_off, sizeof(I) * (slices + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hsell_col.data(), dsell_col, sizeof(I) * values_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hsell_val.data(), dsell_val, sizeof(T) * values_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hsell_perm.data(), dsell_perm, sizeof(I) * m, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, slices + 1, 1, hsell_off_gold.data(), hsell_off.data());
+    unit_check_general(1, m, 1, hsell_perm_gold.data(), hsell_perm.data());
+    unit_check_general(1, values_size, 1, hsell_col_gold.data(), hsell_col.data());
+    unit_check_general(1, values_size, 1, hsell_val_gold.data(), hsell_val.data());
+
+    // The descriptor reports the SELL-C-sigma format
+    hipsparseFormat_t format;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(*S, &format));
+
+    int format_gold = HIPSPARSE_FORMAT_SELL;
+    int format_sell = format;
+    unit_check_general(1, 1, 1, &format_gold, &format_sell);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_csr2sell(Arguments argus)
+{
+    I                    m        = argus.M;
+    I                    n        = argus.N;
+    I                    C        = argus.block_dim;
+    I                    sigma    = argus.sigma;
+    hipsparseIndexBase_t idxBase  = argus.baseA;
+    std::string          filename = argus.filename;
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Convert into SELL-C-sigma
+    auto dsell_off_managed  = hipsparse_unique_ptr{nullptr, device_free};
+    auto dsell_col_managed  = hipsparse_unique_ptr{nullptr, device_free};
+    auto dsell_val_managed  = hipsparse_unique_ptr{nullptr, device_free};
+    auto dsell_perm_managed = hipsparse_unique_ptr{nullptr, device_free};
+
+    hipsparseSpMatDescr_t S;
+    CHECK_HIPSPARSE_ERROR(testing_sell_convert(handle,
+                                               m,
+                                               n,
+                                               nnz,
+                                               C,
+                                               sigma,
+                                               hcsr_row_ptr,
+                                               hcsr_col_ind,
+                                               hcsr_val,
+                                               idxBase,
+                                               dsell_off_managed,
+                                               dsell_col_managed,
+                                               dsell_val_managed,
+                                               dsell_perm_managed,
+                                               &S));
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(S));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#endif // TESTING_SELL_HPP
@@ -0,0 +1,798 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SEMIRING_HPP
+#define TESTING_SEMIRING_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_semiring_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              safe_size = 100;
+    float                identity  = 0.0;
+    hipsparseOperation_t transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseSemiring_t  semiring  = HIPSPARSE_SEMIRING_MIN_PLUS;
+    hipsparseSemiring_t  plusTimes = HIPSPARSE_SEMIRING_PLUS_TIMES;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_col_ind_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcsr_val_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dcsr_row_ptr = (int*)dcsr_row_ptr_managed.get();
+    int*   dcsr_col_ind = (int*)dcsr_col_ind_managed.get();
+    float* dcsr_val     = (float*)dcsr_val_managed.get();
+    float* dx           = (float*)dx_managed.get();
+    float* dy           = (float*)dy_managed.get();
+
+    // Structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x, y, y_wrong;
+
+    verify_hipsparse_status_success(hipsparseCreateCsr(&A,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dcsr_val,
+                                                       idxType,
+                                                       idxType,
+                                                       idxBase,
+                                                       dataType),
+                                    "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y_wrong, m + 1, dy, dataType),
+                                    "success");
+
+    // Identity
+    verify_hipsparse_status_invalid_value(
+        hipsparseSemiringGetIdentity(semiring, dataType, nullptr), "Error: identity is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSemiringGetIdentity((hipsparseSemiring_t)-1, dataType, &identity),
+        "Error: semiring is invalid");
+    verify_hipsparse_status_not_supported(
+        hipsparseSemiringGetIdentity(semiring, HIP_C_32F, &identity),
+        "Error: complex values are not supported by min plus");
+
+    // SpMV
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVSemiring(nullptr, transA, plusTimes, A, x, y, dataType),
+        "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVSemiring(handle, transA, plusTimes, nullptr, x, y, dataType),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVSemiring(handle, transA, plusTimes, A, nullptr, y, dataType),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVSemiring(handle, transA, plusTimes, A, x, nullptr, dataType),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVSemiring(handle, transA, (hipsparseSemiring_t)-1, A, x, y, dataType),
+        "Error: semiring is invalid");
+    verify_hipsparse_status_not_supported(
+        hipsparseSpMVSemiring(handle, transA, semiring, A, x, y, dataType),
+        "Error: min plus is not supported");
+    verify_hipsparse_status_not_supported(
+        hipsparseSpMVSemiring(handle, transA, plusTimes, A, x, y, HIP_C_32F),
+        "Error: complex values are not supported");
+    verify_hipsparse_status_not_supported(
+        hipsparseSpMVSemiring(handle, transA, plusTimes, A, x, y, HIP_R_64F),
+        "Error: computeType does not match the matrix");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMVSemiring(handle, transA, plusTimes, A, x, y_wrong, dataType),
+        "Error: y does not match A");
+
+    // SpGEMM
+    verify_hipsparse_status_invalid_value(hipsparseSpGEMM_setSemiring(nullptr, plusTimes),
+                                          "Error: spgemmDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpGEMM_setSemiring(descr, (hipsparseSemiring_t)-1), "Error: semiring is invalid");
+    verify_hipsparse_status_not_supported(hipsparseSpGEMM_setSemiring(descr, semiring),
+                                          "Error: min plus is not supported");
+    verify_hipsparse_status_success(hipsparseSpGEMM_setSemiring(descr, plusTimes), "success");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y_wrong), "success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+template <typename T>
+static T testing_semiring_identity(hipsparseSemiring_t semiring)
+{
+    switch(semiring)
+    {
+    case HIPSPARSE_SEMIRING_PLUS_TIMES:
+        return host_semiring_plus_times::identity<T>();
+    case HIPSPARSE_SEMIRING_MIN_PLUS:
+        return host_semiring_min_plus::identity<T>();
+    case HIPSPARSE_SEMIRING_MAX_PLUS:
+        return host_semiring_max_plus::identity<T>();
+    case HIPSPARSE_SEMIRING_MAX_MIN:
+        return host_semiring_max_min::identity<T>();
+    case HIPSPARSE_SEMIRING_OR_AND:
+        return host_semiring_or_and::identity<T>();
+    }
+
+    return static_cast<T>(0);
+}
+
+template <typename I, typename T>
+static void testing_semiring_coomv(hipsparseSemiring_t  semiring,
+                                   hipsparseOperation_t trans,
+                                   int64_t              nnz,
+                                   const I*             coo_row_ind,
+                                   const I*             coo_col_ind,
+                                   const T*             coo_val,
+                                   const T*             x,
+                                   T*                   y,
+                                   hipsparseIndexBase_t base)
+{
+    switch(semiring)
+    {
+    case HIPSPARSE_SEMIRING_PLUS_TIMES:
+        host_coomv_semiring<host_semiring_plus_times>(
+            trans, nnz, coo_row_ind, coo_col_ind, coo_val, x, y, base);
+        break;
+    case HIPSPARSE_SEMIRING_MIN_PLUS:
+        host_coomv_semiring<host_semiring_min_plus>(
+            trans, nnz, coo_row_ind, coo_col_ind, coo_val, x, y, base);
+        break;
+    case HIPSPARSE_SEMIRING_MAX_PLUS:
+        host_coomv_semiring<host_semiring_max_plus>(
+            trans, nnz, coo_row_ind, coo_col_ind, coo_val, x, y, base);
+        break;
+    case HIPSPARSE_SEMIRING_MAX_MIN:
+        host_coomv_semiring<host_semiring_max_min>(
+            trans, nnz, coo_row_ind, coo_col_ind, coo_val, x, y, base);
+        break;
+    case HIPSPARSE_SEMIRING_OR_AND:
+        host_coomv_semiring<host_semiring_or_and>(
+            trans, nnz, coo_row_ind, coo_col_ind, coo_val, x, y, base);
+        break;
+    }
+}
+
+template <typename S, typename I, typename J, typename T>
+static void testing_semiring_csrgemm(J                    m,
+                                     J                    n,
+                                     J                    k,
+                                     const T*             alpha,
+                                     const I*             csr_row_ptr_A,
+                                     const J*             csr_col_ind_A,
+                                     const T*             csr_val_A,
+                                     const I*             csr_row_ptr_B,
+                                     const J*             csr_col_ind_B,
+                                     const T*             csr_val_B,
+                                     const I*             csr_row_ptr_C,
+                                     J*                   csr_col_ind_C,
+                                     T*                   csr_val_C,
+                                     hipsparseIndexBase_t idx_base_A,
+                                     hipsparseIndexBase_t idx_base_B,
+                                     hipsparseIndexBase_t idx_base_C)
+{
+    host_csrgemm2<I, J, T, S>(m,
+                              n,
+                              k,
+                              alpha,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              csr_val_A,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              csr_val_B,
+                              (const T*)nullptr,
+                              (const I*)nullptr,
+                              (const J*)nullptr,
+                              (const T*)nullptr,
+                              csr_row_ptr_C,
+                              csr_col_ind_C,
+                              csr_val_C,
+                              idx_base_A,
+                              idx_base_B,
+                              idx_base_C,
+                              HIPSPARSE_INDEX_BASE_ZERO);
+}
+#endif
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmv_semiring(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    I                    m        = argus.M;
+    I                    n        = argus.N;
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idxBase  = argus.baseA;
+    hipsparseFormat_t    format   = argus.formatA;
+    hipsparseSemiring_t  semiring = static_cast<hipsparseSemiring_t>(argus.semiring);
+    std::string          filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Row indices of the COO format
+    std::vector<I> hcoo_row_ind(nnz);
+    for(I i = 0; i < m; ++i)
+    {
+        for(I j = hcsr_row_ptr[i] - idxBase; j < hcsr_row_ptr[i + 1] - idxBase; ++j)
+        {
+            hcoo_row_ind[j] = i + idxBase;
+        }
+    }
+
+    // The CSC format stores the n x m transpose of the generated matrix
+    bool     csc       = (format == HIPSPARSE_FORMAT_CSC);
+    I        rows_A    = csc ? n : m;
+    I        cols_A    = csc ? m : n;
+    const I* hrow_gold = csc ? hcsr_col_ind.data() : hcoo_row_ind.data();
+    const I* hcol_gold = csc ? hcoo_row_ind.data() : hcsr_col_ind.data();
+
+    I size_x = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? cols_A : rows_A;
+    I size_y = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? rows_A : cols_A;
+
+    std::vector<T> hx(size_x);
+    std::vector<T> hy(size_y);
+
+    hipsparseInit<T>(hx, 1, size_x);
+    hipsparseInit<T>(hy, 1, size_y);
+
+    // The identity does not change y
+    T h_identity;
+    CHECK_HIPSPARSE_ERROR(hipsparseSemiringGetIdentity(semiring, typeT, &h_identity));
+
+    T h_identity_gold = testing_semiring_identity<T>(semiring);
+    unit_check_general(1, 1, 1, &h_identity_gold, &h_identity);
+
+    // Every second entry of y starts from the identity
+    for(I i = 0; i < size_y; i += 2)
+    {
+        hy[i] = h_identity;
+    }
+
+    std::vector<T> hy_gold = hy;
+
+    // allocate memory on device
+    auto dcsr_row_ptr_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dcoo_row_ind_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * nnz), device_free};
+    auto dcsr_val_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_x), device_free};
+    auto dy_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size_y), device_free};
+
+    I* dcsr_row_ptr = (I*)dcsr_row_ptr_managed.get();
+    I* dcsr_col_ind = (I*)dcsr_col_ind_managed.get();
+    I* dcoo_row_ind = (I*)dcoo_row_ind_managed.get();
+    T* dcsr_val     = (T*)dcsr_val_managed.get();
+    T* dx           = (T*)dx_managed.get();
+    T* dy           = (T*)dy_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcoo_row_ind, hcoo_row_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * size_x, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    // Create matrix and vectors
+    hipsparseSpMatDescr_t A;
+    if(format == HIPSPARSE_FORMAT_CSR)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+            &A, m, n, nnz, dcsr_row_ptr, dcsr_col_ind, dcsr_val, typeI, typeI, idxBase, typeT));
+    }
+    else if(format == HIPSPARSE_FORMAT_CSC)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCsc(
+            &A, n, m, nnz, dcsr_row_ptr, dcsr_col_ind, dcsr_val, typeI, typeI, idxBase, typeT));
+    }
+    else
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateCoo(
+            &A, m, n, nnz, dcoo_row_ind, dcsr_col_ind, dcsr_val, typeI, idxBase, typeT));
+    }
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, size_x, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, size_y, dy, typeT));
+
+    // rocSPARSE only computes the arithmetic product
+    if(semiring != HIPSPARSE_SEMIRING_PLUS_TIMES)
+    {
+        verify_hipsparse_status_not_supported(
+            hipsparseSpMVSemiring(handle, transA, semiring, A, x, y, typeT),
+            "Error: only the arithmetic semiring is supported");
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // SpMV over the semiring
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMVSemiring(handle, transA, semiring, A, x, y, typeT));
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+
+    // Host SpMV over the semiring
+    testing_semiring_coomv(semiring,
+                           transA,
+                           nnz,
+                           hrow_gold,
+                           hcol_gold,
+                           hcsr_val.data(),
+                           hx.data(),
+                           hy_gold.data(),
+                           idxBase);
+
+    // Verify results against host
+    unit_check_near(1, size_y, 1, hy_gold.data(), hy.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spgemm_semiring(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    J                    m        = argus.M;
+    J                    k        = argus.K;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    hipsparseIndexBase_t idxBaseA = argus.baseA;
+    hipsparseIndexBase_t idxBaseB = argus.baseB;
+    hipsparseIndexBase_t idxBaseC = argus.baseC;
+    hipsparseSemiring_t  semiring = static_cast<hipsparseSemiring_t>(argus.semiring);
+    hipsparseSpGEMMAlg_t alg      = static_cast<hipsparseSpGEMMAlg_t>(argus.spgemm_alg);
+    std::string          filename = argus.filename;
+
+    T                    h_beta = make_DataType<T>(0);
+    hipsparseOperation_t transA = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseOperation_t transB = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handles
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<spgemm_struct> unique_ptr_descr(new spgemm_struct);
+    hipsparseSpGEMMDescr_t         descr = unique_ptr_descr->descr;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr_A;
+    std::vector<J> hcsr_col_ind_A;
+    std::vector<T> hcsr_val_A;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz_A;
+    if(!generate_csr_matrix(
+           filename, m, k, nnz_A, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idxBaseA))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // For sparse matrix B, use the transpose of A
+    J n     = m;
+    I nnz_B = nnz_A;
+
+    std::vector<I> hcsr_row_ptr_B(k + 1);
+    std::vector<J> hcsr_col_ind_B(nnz_B);
+    std::vector<T> hcsr_val_B(nnz_B);
+
+    transpose_csr(m,
+                  k,
+                  nnz_A,
+                  hcsr_row_ptr_A.data(),
+                  hcsr_col_ind_A.data(),
+                  hcsr_val_A.data(),
+                  hcsr_row_ptr_B.data(),
+                  hcsr_col_ind_B.data(),
+                  hcsr_val_B.data(),
+                  idxBaseA,
+                  idxBaseB);
+
+    // allocate memory on device
+    auto dcsr_row_ptr_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcsr_col_ind_A_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_A), device_free};
+    auto dcsr_val_A_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto dcsr_row_ptr_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (k + 1)), device_free};
+    auto dcsr_col_ind_B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_B), device_free};
+    auto dcsr_val_B_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dcsr_row_ptr_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+
+    I* dcsr_row_ptr_A = (I*)dcsr_row_ptr_A_managed.get();
+    J* dcsr_col_ind_A = (J*)dcsr_col_ind_A_managed.get();
+    T* dcsr_val_A     = (T*)dcsr_val_A_managed.get();
+    I* dcsr_row_ptr_B = (I*)dcsr_row_ptr_B_managed.get();
+    J* dcsr_col_ind_B = (J*)dcsr_col_ind_B_managed.get();
+    T* dcsr_val_B     = (T*)dcsr_val_B_managed.get();
+    I* dcsr_row_ptr_C = (I*)dcsr_row_ptr_C_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind_A, hcsr_col_ind_A.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_A, hcsr_val_A.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_B, hcsr_row_ptr_B.data(), sizeof(I) * (k + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind_B, hcsr_col_ind_B.data(), sizeof(J) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_val_B, hcsr_val_B.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+
+    // Create matrices
+    hipsparseSpMatDescr_t A, B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             k,
+                                             nnz_A,
+                                             dcsr_row_ptr_A,
+                                             dcsr_col_ind_A,
+                                             dcsr_val_A,
+                                             typeI,
+                                             typeJ,
+                                             idxBaseA,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&B,
+                                             k,
+                                             n,
+                                             nnz_B,
+                                             dcsr_row_ptr_B,
+                                             dcsr_col_ind_B,
+                                             dcsr_val_B,
+                                             typeI,
+                                             typeJ,
+                                             idxBaseB,
+                                             typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(
+        &C, m, n, 0, dcsr_row_ptr_C, nullptr, nullptr, typeI, typeJ, idxBaseC, typeT));
+
+    // rocSPARSE only computes the arithmetic product
+    if(semiring != HIPSPARSE_SEMIRING_PLUS_TIMES)
+    {
+        verify_hipsparse_status_not_supported(hipsparseSpGEMM_setSemiring(descr, semiring),
+                                              "Error: only the arithmetic semiring is supported");
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Compute the product over the semiring
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_setSemiring(descr, semiring));
+
+    // SpGEMM work estimation
+    size_t bufferSize1;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                         transA,
+                                                         transB,
+                                                         &h_alpha,
+                                                         A,
+                                                         B,
+                                                         &h_beta,
+                                                         C,
+                                                         typeT,
+                                                         alg,
+                                                         descr,
+                                                         &bufferSize1,
+                                                         nullptr));
+
+    void* externalBuffer1;
+    CHECK_HIP_ERROR(hipMalloc(&externalBuffer1, bufferSize1));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_workEstimation(handle,
+                                                         transA,
+                                                         transB,
+                                                         &h_alpha,
+                                                         A,
+                                                         B,
+                                                         &h_beta,
+                                                         C,
+                                                         typeT,
+                                                         alg,
+                                                         descr,
+                                                         &bufferSize1,
+                                                         externalBuffer1));
+
+    // SpGEMM compute
+    size_t bufferSize2;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                  transA,
+                                                  transB,
+                                                  &h_alpha,
+                                                  A,
+                                                  B,
+                                                  &h_beta,
+                                                  C,
+                                                  typeT,
+                                                  alg,
+                                                  descr,
+                                                  &bufferSize2,
+                                                  nullptr));
+
+    void* externalBuffer2;
+    CHECK_HIP_ERROR(hipMalloc(&externalBuffer2, bufferSize2));
+
+    // Get nnz of C
+    int64_t rows_C, cols_C, nnz_C;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C, &rows_C, &cols_C, &nnz_C));
+
+    // Allocate C
+    auto dcsr_col_ind_C_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_C), device_free};
+    auto dcsr_val_C_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    J* dcsr_col_ind_C = (J*)dcsr_col_ind_C_managed.get();
+    T* dcsr_val_C     = (T*)dcsr_val_C_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_compute(handle,
+                                                  transA,
+                                                  transB,
+                                                  &h_alpha,
+                                                  A,
+                                                  B,
+                                                  &h_beta,
+                                                  C,
+                                                  typeT,
+                                                  alg,
+                                                  descr,
+                                                  &bufferSize2,
+                                                  externalBuffer2));
+    CHECK_HIPSPARSE_ERROR(hipsparseCsrSetPointers(C, dcsr_row_ptr_C, dcsr_col_ind_C, dcsr_val_C));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpGEMM_copy(
+        handle, transA, transB, &h_alpha, A, B, &h_beta, C, typeT, alg, descr));
+
+    // Copy output from device to CPU
+    std::vector<I> hcsr_row_ptr_C(m + 1);
+    std::vector<J> hcsr_col_ind_C(nnz_C);
+    std::vector<T> hcsr_val_C(nnz_C);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_C.data(), dcsr_row_ptr_C, sizeof(I) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_C.data(), dcsr_col_ind_C, sizeof(J) * nnz_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_C.data(), dcsr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+    // The pattern of C does not depend on the semiring
+    std::vector<I> hcsr_row_ptr_C_gold(m + 1);
+
+    int64_t nnz_C_gold = host_csrgemm2_nnz(m,
+                                           n,
+                                           k,
+                                           &h_alpha,
+                                           hcsr_row_ptr_A.data(),
+                                           hcsr_col_ind_A.data(),
+                                           hcsr_row_ptr_B.data(),
+                                           hcsr_col_ind_B.data(),
+                                           (const T*)nullptr,
+                                           (const I*)nullptr,
+                                           (const J*)nullptr,
+                                           hcsr_row_ptr_C_gold.data(),
+                                           idxBaseA,
+                                           idxBaseB,
+                                           idxBaseC,
+                                           HIPSPARSE_INDEX_BASE_ZERO);
+
+    // Verify nnz and row pointer array
+    unit_check_general(1, 1, 1, &nnz_C_gold, &nnz_C);
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C.data());
+
+    // Compute SpGEMM over the semiring on host
+    std::vector<J> hcsr_col_ind_C_gold(nnz_C_gold);
+    std::vector<T> hcsr_val_C_gold(nnz_C_gold);
+
+    switch(semiring)
+    {
+    case HIPSPARSE_SEMIRING_PLUS_TIMES:
+        testing_semiring_csrgemm<host_semiring_plus_times>(m,
+                                                           n,
+                                                           k,
+                                                           &h_alpha,
+                                                           hcsr_row_ptr_A.data(),
+                                                           hcsr_col_ind_A.data(),
+                                                           hcsr_val_A.data(),
+                                                           hcsr_row_ptr_B.data(),
+                                                           hcsr_col_ind_B.data(),
+                                                           hcsr_val_B.data(),
+                                                           hcsr_row_ptr_C_gold.data(),
+                                                           hcsr_col_ind_C_gold.data(),
+                                                           hcsr_val_C_gold.data(),
+                                                           idxBaseA,
+                                                           idxBaseB,
+                                                           idxBaseC);
+        break;
+    case HIPSPARSE_SEMIRING_MIN_PLUS:
+        testing_semiring_csrgemm<host_semiring_min_plus>(m,
+                                                         n,
+                                                         k,
+                                                         &h_alpha,
+                                                         hcsr_row_ptr_A.data(),
+                                                         hcsr_col_ind_A.data(),
+                                                         hcsr_val_A.data(),
+                                                         hcsr_row_ptr_B.data(),
+                                                         hcsr_col_ind_B.data(),
+                                                         hcsr_val_B.data(),
+                                                         hcsr_row_ptr_C_gold.data(),
+                                                         hcsr_col_ind_C_gold.data(),
+                                                         hcsr_val_C_gold.data(),
+                                                         idxBaseA,
+                                                         idxBaseB,
+                                                         idxBaseC);
+        break;
+    case HIPSPARSE_SEMIRING_MAX_PLUS:
+        testing_semiring_csrgemm<host_semiring_max_plus>(m,
+                                                         n,
+                                                         k,
+                                                         &h_alpha,
+                                                         hcsr_row_ptr_A.data(),
+                                                         hcsr_col_ind_A.data(),
+                                                         hcsr_val_A.data(),
+                                                         hcsr_row_ptr_B.data(),
+                                                         hcsr_col_ind_B.data(),
+                                                         hcsr_val_B.data(),
+                                                         hcsr_row_ptr_C_gold.data(),
+                                                         hcsr_col_ind_C_gold.data(),
+                                                         hcsr_val_C_gold.data(),
+                                                         idxBaseA,
+                                                         idxBaseB,
+                                                         idxBaseC);
+        break;
+    case HIPSPARSE_SEMIRING_MAX_MIN:
+        testing_semiring_csrgemm<host_semiring_max_min>(m,
+                                                        n,
+                                                        k,
+                                                        &h_alpha,
+                                                        hcsr_row_ptr_A.data(),
+                                                        hcsr_col_ind_A.data(),
+                                                        hcsr_val_A.data(),
+                                                        hcsr_row_ptr_B.data(),
+                                                        hcsr_col_ind_B.data(),
+                                                        hcsr_val_B.data(),
+                                                        hcsr_row_ptr_C_gold.data(),
+                                                        hcsr_col_ind_C_gold.data(),
+                                                        hcsr_val_C_gold.data(),
+                                                        idxBaseA,
+                                                        idxBaseB,
+                                                        idxBaseC);
+        break;
+    case HIPSPARSE_SEMIRING_OR_AND:
+        testing_semiring_csrgemm<host_semiring_or_and>(m,
+                                                       n,
+                                                       k,
+                                                       &h_alpha,
+                                                       hcsr_row_ptr_A.data(),
+                                                       hcsr_col_ind_A.data(),
+                                                       hcsr_val_A.data(),
+                                                       hcsr_row_ptr_B.data(),
+                                                       hcsr_col_ind_B.data(),
+                                                       hcsr_val_B.data(),
+                                                       hcsr_row_ptr_C_gold.data(),
+                                                       hcsr_col_ind_C_gold.data(),
+                                                       hcsr_val_C_gold.data(),
+                                                       idxBaseA,
+                                                       idxBaseB,
+                                                       idxBaseC);
+        break;
+    }
+
+    // Verify column and value array
+    unit_check_general(1, nnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C.data());
+    unit_check_near(1, nnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C.data());
+
+    // Free buffers
+    CHECK_HIP_ERROR(hipFree(externalBuffer1));
+    CHECK_HIP_ERROR(hipFree(externalBuffer2));
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SEMIRING_HPP
@@ -0,0 +1,429 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SMOOTHER_HPP
+#define TESTING_SMOOTHER_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_smoother_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int32_t              m         = 100;
+    int64_t              nnz       = 100;
+    size_t               safe_size = 100;
+    int                  ncolors   = 2;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dcoloring_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+
+    int*   dptr      = (int*)dptr_managed.get();
+    int*   dcol      = (int*)dcol_managed.get();
+    float* dval      = (float*)dval_managed.get();
+    float* db        = (float*)db_managed.get();
+    float* dx        = (float*)dx_managed.get();
+    int*   dcoloring = (int*)dcoloring_managed.get();
+
+    // Smoother structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t b, x;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, m, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&b, m, db, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, m, dx, dataType), "success");
+
+    hipsparseSmootherDescr_t descr;
+
+    // Create descriptor
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_createDescr(nullptr, HIPSPARSE_SMOOTHER_GAUSS_SEIDEL),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_createDescr(&descr, (hipsparseSmootherAlg_t)4), "Error: alg is invalid");
+    verify_hipsparse_status_success(
+        hipsparseSmoother_createDescr(&descr, HIPSPARSE_SMOOTHER_GAUSS_SEIDEL), "success");
+
+    // Parameters
+    verify_hipsparse_status_invalid_value(hipsparseSmoother_setParameters(nullptr, 1, 1.0),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSmoother_setParameters(descr, -1, 1.0),
+                                          "Error: sweeps is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseSmoother_setParameters(descr, 1, 0.0),
+                                          "Error: omega is invalid");
+
+    // Analysis
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_analysis(nullptr, descr, A, ncolors, dcoloring, dataType),
+        "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_analysis(handle, nullptr, A, ncolors, dcoloring, dataType),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_analysis(handle, descr, nullptr, ncolors, dcoloring, dataType),
+        "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_analysis(handle, descr, A, 0, dcoloring, dataType),
+        "Error: ncolors is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_analysis(handle, descr, A, ncolors, nullptr, dataType),
+        "Error: coloring is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_analysis(handle, descr, A, ncolors, dcoloring, HIP_R_64F),
+        "Error: computeType does not match matA");
+
+    // Smooth
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_smooth(nullptr, descr, A, b, x, dataType), "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_smooth(handle, nullptr, A, b, x, dataType), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_smooth(handle, descr, nullptr, b, x, dataType), "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_smooth(handle, descr, A, nullptr, x, dataType), "Error: vecB is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_smooth(handle, descr, A, b, nullptr, dataType), "Error: vecX is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSmoother_smooth(handle, descr, A, b, x, dataType),
+        "Error: descr has not been analysed");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseSmoother_destroyDescr(descr), "success");
+    verify_hipsparse_status_success(hipsparseSmoother_destroyDescr(nullptr), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(b), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+#endif
+}
+
+//
+// Relative residual of x.
+//
+template <typename I, typename J, typename T>
+double smoother_residual(J                     m,
+                         I                     nnz,
+                         const std::vector<I>& csr_row_ptr,
+                         const std::vector<J>& csr_col_ind,
+                         const std::vector<T>& csr_val,
+                         const std::vector<T>& b,
+                         const std::vector<T>& x,
+                         hipsparseIndexBase_t  idx_base)
+{
+    std::vector<T> r(b);
+    host_csrmv(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+               m,
+               m,
+               nnz,
+               make_DataType<T>(-1.0),
+               csr_row_ptr.data(),
+               csr_col_ind.data(),
+               csr_val.data(),
+               x.data(),
+               make_DataType<T>(1.0),
+               r.data(),
+               idx_base);
+
+    double norm_r = 0.0;
+    double norm_b = 0.0;
+    for(J i = 0; i < m; ++i)
+    {
+        norm_r += testing_abs(r[i]) * testing_abs(r[i]);
+        norm_b += testing_abs(b[i]) * testing_abs(b[i]);
+    }
+
+    return std::sqrt(norm_r / norm_b);
+}
+
+//
+// Convergence of the host reference smoother with a red-black coloring of the 2D Laplacian,
+// which does not need a device.
+//
+template <typename T>
+void testing_smoother_host(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                    ndim     = argus.M;
+    hipsparseIndexBase_t   idx_base = argus.baseA;
+    hipsparseSmootherAlg_t alg      = (hipsparseSmootherAlg_t)argus.solver_alg;
+    double                 omega    = (alg == HIPSPARSE_SMOOTHER_SOR) ? 1.5 : 0.8;
+
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    srand(12345ULL);
+
+    int m     = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int nnz_A = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<int> hcoloring(m);
+    for(int i = 0; i < m; ++i)
+    {
+        hcoloring[i] = (i / ndim + i % ndim) % 2;
+    }
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m, make_DataType<T>(0.0));
+
+    hipsparseInit<T>(hb, 1, m);
+
+    // Every sweep reduces the residual
+    int    expected_decrease = 1;
+    double residual          = 1.0;
+    for(int sweep = 0; sweep < 5; ++sweep)
+    {
+        host_smoother(alg,
+                      1,
+                      omega,
+                      m,
+                      hcsr_row_ptr.data(),
+                      hcsr_col_ind.data(),
+                      hcsr_val.data(),
+                      2,
+                      hcoloring.data(),
+                      hb.data(),
+                      hx.data(),
+                      idx_base);
+
+        double residual_sweep
+            = smoother_residual(m, nnz_A, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hb, hx, idx_base);
+
+        int decrease = residual_sweep < residual;
+        unit_check_general(1, 1, 1, &expected_decrease, &decrease);
+
+        residual = residual_sweep;
+    }
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_smoother(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                    ndim     = argus.M;
+    hipsparseIndexBase_t   idx_base = argus.baseA;
+    hipsparseSmootherAlg_t alg      = (hipsparseSmootherAlg_t)argus.solver_alg;
+    int                    sweeps   = 3;
+    double                 omega    = (alg == HIPSPARSE_SMOOTHER_SOR) ? 1.5 : 0.8;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    hipsparseMatDescr_t           descrA = unique_ptr_descr->descr;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSetMatIndexBase(descrA, idx_base));
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    srand(12345ULL);
+
+    J m     = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    I nnz_A = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m);
+
+    hipsparseInit<T>(hb, 1, m);
+    hipsparseInit<T>(hx, 1, m);
+
+    std::vector<T> hx_gold(hx);
+
+    // csrcolor takes 32 bit indices
+    std::vector<int> hcsr_row_ptr_32(hcsr_row_ptr.begin(), hcsr_row_ptr.end());
+    std::vector<int> hcsr_col_ind_32(hcsr_col_ind.begin(), hcsr_col_ind.end());
+
+    // allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_A), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dptr_32_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_32_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz_A), device_free};
+    auto dcoloring_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * m), device_free};
+
+    I*   dptr      = (I*)dptr_managed.get();
+    J*   dcol      = (J*)dcol_managed.get();
+    T*   dval      = (T*)dval_managed.get();
+    T*   db        = (T*)db_managed.get();
+    T*   dx        = (T*)dx_managed.get();
+    int* dptr_32   = (int*)dptr_32_managed.get();
+    int* dcol_32   = (int*)dcol_32_managed.get();
+    int* dcoloring = (int*)dcoloring_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_32, hcsr_row_ptr_32.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_32, hcsr_col_ind_32.data(), sizeof(int) * nnz_A, hipMemcpyHostToDevice));
+
+    // Coloring
+    hipsparseColorInfo_t colorInfo;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateColorInfo(&colorInfo));
+
+    floating_data_t<T> fractionToColor = make_DataType<floating_data_t<T>>(1.0);
+    int                ncolors;
+
+    CHECK_HIPSPARSE_ERROR(hipsparseXcsrcolor(handle,
+                                             (int)m,
+                                             (int)nnz_A,
+                                             descrA,
+                                             dval,
+                                             dptr_32,
+                                             dcol_32,
+                                             &fractionToColor,
+                                             &ncolors,
+                                             dcoloring,
+                                             (int*)nullptr,
+                                             colorInfo));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyColorInfo(colorInfo));
+
+    std::vector<int> hcoloring(m);
+    CHECK_HIP_ERROR(hipMemcpy(hcoloring.data(), dcoloring, sizeof(int) * m, hipMemcpyDeviceToHost));
+
+    // Create structures
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, m, nnz_A, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+
+    hipsparseDnVecDescr_t b, x;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&b, m, db, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+
+    hipsparseSmootherDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSmoother_createDescr(&descr, alg));
+    CHECK_HIPSPARSE_ERROR(hipsparseSmoother_setParameters(descr, sweeps, omega));
+    CHECK_HIPSPARSE_ERROR(hipsparseSmoother_analysis(handle, descr, A, ncolors, dcoloring, typeT));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSmoother_smooth(handle, descr, A, b, x, typeT));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // CPU
+        host_smoother(alg,
+                      sweeps,
+                      omega,
+                      m,
+                      hcsr_row_ptr.data(),
+                      hcsr_col_ind.data(),
+                      hcsr_val.data(),
+                      ncolors,
+                      hcoloring.data(),
+                      hb.data(),
+                      hx_gold.data(),
+                      idx_base);
+
+        unit_check_near(1, m, 1, hx_gold.data(), hx.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSmoother_smooth(handle, descr, A, b, x, typeT));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSmoother_smooth(handle, descr, A, b, x, typeT));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz_A,
+                            display_key_t::algorithm,
+                            argus.solver_alg,
+                            display_key_t::iters,
+                            sweeps,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSmoother_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(b));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SMOOTHER_HPP
@@ -0,0 +1,492 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SOLVER_HPP
+#define TESTING_SOLVER_HPP
+
+#include "display.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_solver_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int32_t              m         = 100;
+    int64_t              nnz       = 100;
+    size_t               safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* db   = (float*)db_managed.get();
+    float* dx   = (float*)dx_managed.get();
+
+    // Solver structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t b, x;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, m, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&b, m, db, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, m, dx, dataType), "success");
+
+    hipsparseSolverDescr_t descr;
+
+    // Create descriptor
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_createDescr(nullptr, HIPSPARSE_SOLVER_CG, HIPSPARSE_SOLVER_PRECOND_NONE),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_createDescr(&descr, (hipsparseSolverAlg_t)3, HIPSPARSE_SOLVER_PRECOND_NONE),
+        "Error: alg is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_createDescr(&descr, HIPSPARSE_SOLVER_CG, (hipsparseSolverPrecond_t)4),
+        "Error: precond is invalid");
+    verify_hipsparse_status_success(
+        hipsparseSolver_createDescr(&descr, HIPSPARSE_SOLVER_CG, HIPSPARSE_SOLVER_PRECOND_NONE),
+        "success");
+
+    // Parameters
+    verify_hipsparse_status_invalid_value(hipsparseSolver_setParameters(nullptr, 100, 1e-6, 30),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_setParameters(descr, -1, 1e-6, 30),
+                                          "Error: maxIterations is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_setParameters(descr, 100, -1.0, 30),
+                                          "Error: tolerance is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_setParameters(descr, 100, 1e-6, 0),
+                                          "Error: restart is invalid");
+
+    // Analysis
+    verify_hipsparse_status_invalid_value(hipsparseSolver_analysis(nullptr, descr, A, dataType),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_analysis(handle, nullptr, A, dataType),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_analysis(handle, descr, nullptr, dataType), "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_analysis(handle, descr, A, HIP_R_64F),
+                                          "Error: computeType does not match matA");
+
+    // Solve
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_solve(nullptr, descr, A, b, x, dataType), "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_solve(handle, nullptr, A, b, x, dataType), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_solve(handle, descr, nullptr, b, x, dataType), "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_solve(handle, descr, A, nullptr, x, dataType), "Error: vecB is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_solve(handle, descr, A, b, nullptr, dataType), "Error: vecX is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_solve(handle, descr, A, b, x, dataType),
+                                          "Error: descr has not been analysed");
+
+    // Convergence
+    int    iterations;
+    double residual;
+    int    converged;
+    int    history_size;
+
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_getInfo(nullptr, &iterations, &residual, &converged),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_getInfo(descr, nullptr, &residual, &converged),
+        "Error: iterations is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_getInfo(descr, &iterations, nullptr, &converged),
+        "Error: residual is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_getInfo(descr, &iterations, &residual, nullptr),
+        "Error: converged is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSolver_getHistory(nullptr, &history_size, nullptr), "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSolver_getHistory(descr, nullptr, nullptr),
+                                          "Error: historySize is nullptr");
+
+    // Nothing has been solved yet
+    int expected_history_size = 0;
+    verify_hipsparse_status_success(hipsparseSolver_getHistory(descr, &history_size, nullptr),
+                                    "success");
+    unit_check_general(1, 1, 1, &expected_history_size, &history_size);
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseSolver_destroyDescr(descr), "success");
+    verify_hipsparse_status_success(hipsparseSolver_destroyDescr(nullptr), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(b), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+#endif
+}
+
+//
+// Convergence of the host reference solver, which does not need a device.
+//
+template <typename T>
+void testing_solver_host(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                      ndim     = argus.M;
+    hipsparseIndexBase_t     idx_base = argus.baseA;
+    hipsparseSolverAlg_t     alg      = (hipsparseSolverAlg_t)argus.solver_alg;
+    hipsparseSolverPrecond_t precond  = (hipsparseSolverPrecond_t)argus.solver_precond;
+    double                   tolerance
+        = (sizeof(T) == sizeof(float) || sizeof(T) == sizeof(hipComplex)) ? 1e-4 : 1e-10;
+
+    std::vector<int> hcsr_row_ptr;
+    std::vector<int> hcsr_col_ind;
+    std::vector<T>   hcsr_val;
+
+    srand(12345ULL);
+
+    int m     = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    int nnz_A = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m, make_DataType<T>(0.0));
+
+    hipsparseInit<T>(hb, 1, m);
+
+    int                 iterations;
+    double              residual;
+    int                 converged;
+    std::vector<double> history;
+
+    host_solver(alg,
+                precond,
+                2000,
+                tolerance,
+                30,
+                m,
+                nnz_A,
+                hcsr_row_ptr.data(),
+                hcsr_col_ind.data(),
+                hcsr_val.data(),
+                hb.data(),
+                hx.data(),
+                idx_base,
+                &iterations,
+                &residual,
+                &converged,
+                history);
+
+    int expected_converged = 1;
+    unit_check_general(1, 1, 1, &expected_converged, &converged);
+
+    int expected_history_size = iterations + 1;
+    int history_size          = static_cast<int>(history.size());
+    unit_check_general(1, 1, 1, &expected_history_size, &history_size);
+
+    // Preconditioning reduces the number of iterations
+    if(precond == HIPSPARSE_SOLVER_PRECOND_ILU0 || precond == HIPSPARSE_SOLVER_PRECOND_IC0)
+    {
+        int                 iterations_none;
+        double              residual_none;
+        int                 converged_none;
+        std::vector<double> history_none;
+        std::vector<T>      hx_none(m, make_DataType<T>(0.0));
+
+        host_solver(alg,
+                    HIPSPARSE_SOLVER_PRECOND_NONE,
+                    2000,
+                    tolerance,
+                    30,
+                    m,
+                    nnz_A,
+                    hcsr_row_ptr.data(),
+                    hcsr_col_ind.data(),
+                    hcsr_val.data(),
+                    hb.data(),
+                    hx_none.data(),
+                    idx_base,
+                    &iterations_none,
+                    &residual_none,
+                    &converged_none,
+                    history_none);
+
+        int fewer_iterations = iterations < iterations_none;
+        unit_check_general(1, 1, 1, &expected_converged, &fewer_iterations);
+    }
+#endif
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_solver(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                      ndim     = argus.M;
+    hipsparseIndexBase_t     idx_base = argus.baseA;
+    hipsparseSolverAlg_t     alg      = (hipsparseSolverAlg_t)argus.solver_alg;
+    hipsparseSolverPrecond_t precond  = (hipsparseSolverPrecond_t)argus.solver_precond;
+
+    // Single precision solves to a looser tolerance
+    int    max_iterations = 2000;
+    int    restart        = 30;
+    double tolerance      = (sizeof(T) == sizeof(float) || sizeof(T) == sizeof(hipComplex))
+                                ? 1e-4
+                                : 1e-10;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures, the 2D Laplacian is Hermitian positive definite, which all methods and
+    // preconditioners support
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    srand(12345ULL);
+
+    J m     = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    I nnz_A = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hb(m);
+    std::vector<T> hx(m, make_DataType<T>(0.0));
+    std::vector<T> hx_gold(m, make_DataType<T>(0.0));
+
+    hipsparseInit<T>(hb, 1, m);
+
+    // allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz_A), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_A), device_free};
+    auto db_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    J* dcol = (J*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+    T* db   = (T*)db_managed.get();
+    T* dx   = (T*)dx_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Create structures
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, m, nnz_A, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+
+    hipsparseDnVecDescr_t b, x;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&b, m, db, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+
+    hipsparseSolverDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSolver_createDescr(&descr, alg, precond));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSolver_setParameters(descr, max_iterations, tolerance, restart));
+
+    // The incomplete factorizations support 32 bit indices only
+    if((precond == HIPSPARSE_SOLVER_PRECOND_ILU0 || precond == HIPSPARSE_SOLVER_PRECOND_IC0)
+       && (typeI != HIPSPARSE_INDEX_32I || typeJ != HIPSPARSE_INDEX_32I))
+    {
+        verify_hipsparse_status_not_supported(
+            hipsparseSolver_analysis(handle, descr, A, typeT),
+            "Error: incomplete factorizations require 32 bit indices");
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSolver_destroyDescr(descr));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(b));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSolver_analysis(handle, descr, A, typeT));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSolver_solve(handle, descr, A, b, x, typeT));
+
+        int    iterations;
+        double residual;
+        int    converged;
+        int    history_size;
+        CHECK_HIPSPARSE_ERROR(hipsparseSolver_getInfo(descr, &iterations, &residual, &converged));
+        CHECK_HIPSPARSE_ERROR(hipsparseSolver_getHistory(descr, &history_size, nullptr));
+
+        std::vector<double> history(history_size);
+        CHECK_HIPSPARSE_ERROR(hipsparseSolver_getHistory(descr, &history_size, history.data()));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // CPU
+        int                 iterations_gold;
+        double              residual_gold;
+        int                 converged_gold;
+        std::vector<double> history_gold;
+
+        host_solver(alg,
+                    precond,
+                    max_iterations,
+                    tolerance,
+                    restart,
+                    m,
+                    nnz_A,
+                    hcsr_row_ptr.data(),
+                    hcsr_col_ind.data(),
+                    hcsr_val.data(),
+                    hb.data(),
+                    hx_gold.data(),
+                    idx_base,
+                    &iterations_gold,
+                    &residual_gold,
+                    &converged_gold,
+                    history_gold);
+
+        // Both solvers converge
+        int expected_converged = 1;
+        unit_check_general(1, 1, 1, &expected_converged, &converged_gold);
+        unit_check_general(1, 1, 1, &expected_converged, &converged);
+
+        // The history holds the initial residual and one residual per iteration, the initial
+        // guess is zero
+        int expected_history_size = iterations + 1;
+        unit_check_general(1, 1, 1, &expected_history_size, &history_size);
+
+        int initial_match = std::abs(history[0] - 1.0) <= tolerance;
+        unit_check_general(1, 1, 1, &expected_converged, &initial_match);
+
+        // The iteration counts agree up to rounding, CG and BiCGStab check for convergence every
+        // four iterations
+        int iterations_match = std::abs(iterations - iterations_gold)
+                               <= std::max(2, iterations_gold / 10) + 3;
+        unit_check_general(1, 1, 1, &expected_converged, &iterations_match);
+
+        // True residual of the device solution
+        std::vector<T> hr(hb);
+        host_csrmv(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                   m,
+                   m,
+                   nnz_A,
+                   make_DataType<T>(-1.0),
+                   hcsr_row_ptr.data(),
+                   hcsr_col_ind.data(),
+                   hcsr_val.data(),
+                   hx.data(),
+                   make_DataType<T>(1.0),
+                   hr.data(),
+                   idx_base);
+
+        double norm_r = 0.0;
+        double norm_b = 0.0;
+        for(J i = 0; i < m; ++i)
+        {
+            norm_r += testing_abs(hr[i]) * testing_abs(hr[i]);
+            norm_b += testing_abs(hb[i]) * testing_abs(hb[i]);
+        }
+
+        int residual_match = std::sqrt(norm_r / norm_b) <= 10.0 * tolerance;
+        unit_check_general(1, 1, 1, &expected_converged, &residual_match);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(T) * m));
+            CHECK_HIPSPARSE_ERROR(hipsparseSolver_solve(handle, descr, A, b, x, typeT));
+        }
+
+        double gpu_time_used = 0.0;
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(T) * m));
+
+            double start = get_time_us();
+            CHECK_HIPSPARSE_ERROR(hipsparseSolver_solve(handle, descr, A, b, x, typeT));
+            gpu_time_used += get_time_us() - start;
+        }
+
+        gpu_time_used /= number_hot_calls;
+
+        int    iterations;
+        double residual;
+        int    converged;
+        CHECK_HIPSPARSE_ERROR(hipsparseSolver_getInfo(descr, &iterations, &residual, &converged));
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::nnz,
+                            nnz_A,
+                            display_key_t::algorithm,
+                            argus.solver_alg,
+                            display_key_t::iters,
+                            iterations,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSolver_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(b));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SOLVER_HPP
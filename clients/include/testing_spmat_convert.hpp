@@ -0,0 +1,554 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+
+#pragma once
+#ifndef TESTING_SPMAT_CONVERT_HPP
+#define TESTING_SPMAT_CONVERT_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_spmat_convert_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 100;
+    int64_t              nnz       = 100;
+    int64_t              width     = 1;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    hipsparseSpMatConvertAlg_t alg = HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    void*  dbuf = (void*)dbuf_managed.get();
+
+    hipsparseSpMatDescr_t        A;
+    hipsparseSpMatDescr_t        B;
+    hipsparseSpMatDescr_t        E;
+    hipsparseSpMatConvertDescr_t descr;
+    size_t                       bufferSize;
+    int64_t                      nnzB;
+
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateCsc(&B, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(
+        hipsparseCreateEll(&E, m, n, width, dcol, dval, idxType, idxBase, dataType), "success");
+
+    // hipsparseSpMatConvert_createDescr
+    verify_hipsparse_status_invalid_value(hipsparseSpMatConvert_createDescr(nullptr),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_success(hipsparseSpMatConvert_createDescr(&descr), "success");
+
+    // hipsparseSpMatConvert_bufferSize
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_bufferSize(nullptr, A, B, alg, descr, &bufferSize),
+        "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_bufferSize(handle, nullptr, B, alg, descr, &bufferSize),
+        "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_bufferSize(handle, A, nullptr, alg, descr, &bufferSize),
+        "Error: matB is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_bufferSize(handle, A, B, alg, nullptr, &bufferSize),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_bufferSize(handle, A, B, alg, descr, nullptr),
+        "Error: pBufferSizeInBytes is nullptr");
+    verify_hipsparse_status_not_supported(
+        hipsparseSpMatConvert_bufferSize(handle, A, E, alg, descr, &bufferSize),
+        "Error: matB is an ELL matrix");
+
+    // hipsparseSpMatConvert_analysis
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_analysis(nullptr, A, B, alg, descr, &nnzB, dbuf),
+        "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_analysis(handle, nullptr, B, alg, descr, &nnzB, dbuf),
+        "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_analysis(handle, A, nullptr, alg, descr, &nnzB, dbuf),
+        "Error: matB is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_analysis(handle, A, B, alg, nullptr, &nnzB, dbuf),
+        "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_analysis(handle, A, B, alg, descr, nullptr, dbuf),
+        "Error: pNnzB is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert_analysis(handle, A, B, alg, descr, &nnzB, nullptr),
+        "Error: externalBuffer is nullptr");
+    verify_hipsparse_status_not_supported(
+        hipsparseSpMatConvert_analysis(handle, E, B, alg, descr, &nnzB, dbuf),
+        "Error: matA is an ELL matrix");
+
+    // hipsparseSpMatConvert
+    verify_hipsparse_status_invalid_value(hipsparseSpMatConvert(nullptr, A, B, alg, descr, dbuf),
+                                          "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert(handle, nullptr, B, alg, descr, dbuf), "Error: matA is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert(handle, A, nullptr, alg, descr, dbuf), "Error: matB is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseSpMatConvert(handle, A, B, alg, nullptr, dbuf),
+                                          "Error: descr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatConvert(handle, A, B, alg, descr, nullptr),
+        "Error: externalBuffer is nullptr");
+    verify_hipsparse_status(hipsparseSpMatConvert(handle, A, B, alg, descr, dbuf),
+                            HIPSPARSE_STATUS_NOT_INITIALIZED,
+                            "Error: descr is not analysed");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseSpMatConvert_destroyDescr(descr), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(B), "success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(E), "success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+//
+// Create a sparse matrix of the given format. ptr is only used by CSR and CSC, ind2 only by COO
+// and size is the number of non-zeros, or the number of ELL columns for Blocked-ELL.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_spmat_convert_create(hipsparseSpMatDescr_t* mat,
+                                                      hipsparseFormat_t      format,
+                                                      I                      m,
+                                                      I                      n,
+                                                      int64_t                size,
+                                                      I                      block_dim,
+                                                      I*                     ptr,
+                                                      I*                     ind,
+                                                      I*                     ind2,
+                                                      T*                     val,
+                                                      hipsparseIndexBase_t   idxBase)
+{
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    switch(format)
+    {
+    case HIPSPARSE_FORMAT_CSR:
+        return hipsparseCreateCsr(mat, m, n, size, ptr, ind, val, typeI, typeI, idxBase, typeT);
+    case HIPSPARSE_FORMAT_CSC:
+        return hipsparseCreateCsc(mat, m, n, size, ptr, ind, val, typeI, typeI, idxBase, typeT);
+    case HIPSPARSE_FORMAT_COO:
+        return hipsparseCreateCoo(mat, m, n, size, ind, ind2, val, typeI, idxBase, typeT);
+    case HIPSPARSE_FORMAT_COO_AOS:
+        return hipsparseCreateCooAoS(mat, m, n, size, ind, val, typeI, idxBase, typeT);
+    case HIPSPARSE_FORMAT_BLOCKED_ELL:
+        return hipsparseCreateBlockedEll(
+            mat, m, n, block_dim, size, ind, val, typeI, idxBase, typeT);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+//
+// Run the analysis of the conversion of A into the given format, with a target matrix of size
+// zero, and return the size of the target matrix.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_spmat_convert_analysis(hipsparseHandle_t            handle,
+                                                        hipsparseSpMatDescr_t        A,
+                                                        hipsparseFormat_t            format,
+                                                        I                            m,
+                                                        I                            n,
+                                                        I                            block_dim,
+                                                        I*                           ptr,
+                                                        hipsparseIndexBase_t         idxBase,
+                                                        hipsparseSpMatConvertDescr_t descr,
+                                                        hipsparse_unique_ptr&        dbuffer,
+                                                        int64_t*                     size)
+{
+    auto dind_managed = hipsparse_unique_ptr{device_malloc(sizeof(I)), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dind = (I*)dind_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    hipsparseSpMatDescr_t B;
+    CHECK_HIPSPARSE_ERROR(testing_spmat_convert_create(
+        &B, format, m, n, 0, block_dim, ptr, dind, dind, dval, idxBase));
+
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatConvert_bufferSize(
+        handle, A, B, HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT, descr, &bufferSize));
+
+    dbuffer = hipsparse_unique_ptr{device_malloc(std::max(bufferSize, size_t(4))), device_free};
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatConvert_analysis(
+        handle, A, B, HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT, descr, size, dbuffer.get()));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmat_convert(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    I                    m         = argus.M;
+    I                    n         = argus.N;
+    I                    block_dim = argus.block_dim;
+    hipsparseFormat_t    format    = argus.formatB;
+    hipsparseIndexBase_t idxBase   = argus.baseA;
+    std::string          filename  = argus.filename;
+
+    hipsparseSpMatConvertAlg_t alg = HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idxBase))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Host conversion into the target format
+    I              size_gold = nnz;
+    std::vector<I> hptr_gold;
+    std::vector<I> hind_gold;
+    std::vector<I> hind2_gold;
+    std::vector<T> hval_gold;
+
+    switch(format)
+    {
+    case HIPSPARSE_FORMAT_CSR:
+    {
+        hptr_gold = hcsr_row_ptr;
+        hind_gold = hcsr_col_ind;
+        hval_gold = hcsr_val;
+        break;
+    }
+    case HIPSPARSE_FORMAT_CSC:
+    {
+        host_csr_to_csc(m,
+                        n,
+                        nnz,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        hind_gold,
+                        hptr_gold,
+                        hval_gold,
+                        HIPSPARSE_ACTION_NUMERIC,
+                        idxBase);
+        break;
+    }
+    case HIPSPARSE_FORMAT_COO:
+    case HIPSPARSE_FORMAT_COO_AOS:
+    {
+        for(I i = 0; i < m; ++i)
+        {
+            for(I j = hcsr_row_ptr[i] - idxBase; j < hcsr_row_ptr[i + 1] - idxBase; ++j)
+            {
+                if(format == HIPSPARSE_FORMAT_COO)
+                {
+                    hind_gold.push_back(i + idxBase);
+                    hind2_gold.push_back(hcsr_col_ind[j]);
+                }
+                else
+                {
+                    hind_gold.push_back(i + idxBase);
+                    hind_gold.push_back(hcsr_col_ind[j]);
+                }
+            }
+        }
+        hval_gold = hcsr_val;
+        break;
+    }
+    case HIPSPARSE_FORMAT_BLOCKED_ELL:
+    {
+        host_csr_to_bell(m,
+                         block_dim,
+                         hcsr_row_ptr.data(),
+                         hcsr_col_ind.data(),
+                         hcsr_val.data(),
+                         idxBase,
+                         size_gold,
+                         hind_gold,
+                         hval_gold);
+        break;
+    }
+    default:
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+    }
+
+    // Device CSR matrix
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * std::max(nnz, I(1))), device_free};
+    auto dval_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * std::max(nnz, I(1))), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    I* dcol = (I*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeI, idxBase, typeT));
+
+    // Analysis of the conversion into the target format
+    I ptr_size  = (format == HIPSPARSE_FORMAT_CSC) ? n + 1 : m + 1;
+    I ind_size  = hind_gold.size();
+    I ind2_size = hind2_gold.size();
+    I val_size  = hval_gold.size();
+
+    auto dptrB_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * ptr_size), device_free};
+    I*   dptrB         = (I*)dptrB_managed.get();
+
+    hipsparseSpMatConvertDescr_t descr;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatConvert_createDescr(&descr));
+
+    auto    dbuffer_managed = hipsparse_unique_ptr{nullptr, device_free};
+    int64_t sizeB;
+    CHECK_HIPSPARSE_ERROR((testing_spmat_convert_analysis<I, T>(
+        handle, A, format, m, n, block_dim, dptrB, idxBase, descr, dbuffer_managed, &sizeB)));
+
+    int64_t sizeB_gold = size_gold;
+    unit_check_general(1, 1, 1, &sizeB_gold, &sizeB);
+
+    // Conversion
+    auto dindB_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * std::max(ind_size, I(1))), device_free};
+    auto dind2B_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * std::max(ind2_size, I(1))), device_free};
+    auto dvalB_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * std::max(val_size, I(1))), device_free};
+
+    I* dindB  = (I*)dindB_managed.get();
+    I* dind2B = (I*)dind2B_managed.get();
+    T* dvalB  = (T*)dvalB_managed.get();
+
+    hipsparseSpMatDescr_t B;
+    CHECK_HIPSPARSE_ERROR(testing_spmat_convert_create(
+        &B, format, m, n, sizeB, block_dim, dptrB, dindB, dind2B, dvalB, idxBase));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatConvert(handle, A, B, alg, descr, dbuffer_managed.get()));
+
+    std::vector<I> hptr(ptr_size);
+    std::vector<I> hind(ind_size);
+    std::vector<I> hind2(ind2_size);
+    std::vector<T> hval(val_size);
+
+    CHECK_HIP_ERROR(hipMemcpy(hind.data(), dindB, sizeof(I) * ind_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hind2.data(), dind2B, sizeof(I) * ind2_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hval.data(), dvalB, sizeof(T) * val_size, hipMemcpyDeviceToHost));
+
+    if(format == HIPSPARSE_FORMAT_CSR || format == HIPSPARSE_FORMAT_CSC)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(hptr.data(), dptrB, sizeof(I) * ptr_size, hipMemcpyDeviceToHost));
+        unit_check_general(1, ptr_size, 1, hptr_gold.data(), hptr.data());
+    }
+
+    unit_check_general(1, ind_size, 1, hind_gold.data(), hind.data());
+    unit_check_general(1, ind2_size, 1, hind2_gold.data(), hind2.data());
+    unit_check_general(1, val_size, 1, hval_gold.data(), hval.data());
+
+    // Convert new values of A with the same analysis
+    T two = make_DataType2<T>(2.0, 0.0);
+
+    std::vector<T> hcsr_val2(nnz);
+    for(I j = 0; j < nnz; ++j)
+    {
+        hcsr_val2[j] = testing_mult(two, hcsr_val[j]);
+    }
+
+    for(I j = 0; j < val_size; ++j)
+    {
+        hval_gold[j] = testing_mult(two, hval_gold[j]);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val2.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatConvert(handle, A, B, alg, descr, dbuffer_managed.get()));
+
+    CHECK_HIP_ERROR(hipMemcpy(hval.data(), dvalB, sizeof(T) * val_size, hipMemcpyDeviceToHost));
+    unit_check_general(1, val_size, 1, hval_gold.data(), hval.data());
+
+    // Convert back into CSR. Blocked-ELL keeps every entry of its blocks, including zeros.
+    std::vector<I> hcsr_row_ptr_gold;
+    std::vector<I> hcsr_col_ind_gold;
+    std::vector<T> hcsr_val_gold;
+
+    if(format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+    {
+        I ell_blocks = size_gold / block_dim;
+
+        hcsr_row_ptr_gold.push_back(idxBase);
+        for(I i = 0; i < m; ++i)
+        {
+            I bi = i / block_dim;
+
+            for(I k = 0; k < ell_blocks; ++k)
+            {
+                I bj = hind_gold[bi * ell_blocks + k];
+                if(bj == -1)
+                {
+                    continue;
+                }
+
+                for(I c = 0; c < block_dim; ++c)
+                {
+                    I col = (bj - idxBase) * block_dim + c;
+                    if(col < n)
+                    {
+                        hcsr_col_ind_gold.push_back(col + idxBase);
+                        hcsr_val_gold.push_back(
+                            hval_gold[((bi * ell_blocks + k) * block_dim + c) * block_dim
+                                      + i % block_dim]);
+                    }
+                }
+            }
+
+            hcsr_row_ptr_gold.push_back(I(hcsr_col_ind_gold.size()) + idxBase);
+        }
+    }
+    else
+    {
+        hcsr_row_ptr_gold = hcsr_row_ptr;
+        hcsr_col_ind_gold = hcsr_col_ind;
+        hcsr_val_gold     = hcsr_val2;
+    }
+
+    I nnzC_gold = hcsr_col_ind_gold.size();
+
+    auto dptrC_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    I*   dptrC         = (I*)dptrC_managed.get();
+
+    hipsparseSpMatConvertDescr_t descrC;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatConvert_createDescr(&descrC));
+
+    auto    dbufferC_managed = hipsparse_unique_ptr{nullptr, device_free};
+    int64_t nnzC;
+    CHECK_HIPSPARSE_ERROR((testing_spmat_convert_analysis<I, T>(handle,
+                                                                B,
+                                                                HIPSPARSE_FORMAT_CSR,
+                                                                m,
+                                                                n,
+                                                                block_dim,
+                                                                dptrC,
+                                                                idxBase,
+                                                                descrC,
+                                                                dbufferC_managed,
+                                                                &nnzC)));
+
+    int64_t nnzC_gold64 = nnzC_gold;
+    unit_check_general(1, 1, 1, &nnzC_gold64, &nnzC);
+
+    auto dcolC_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(I) * std::max(nnzC_gold, I(1))), device_free};
+    auto dvalC_managed
+        = hipsparse_unique_ptr{device_malloc(sizeof(T) * std::max(nnzC_gold, I(1))), device_free};
+
+    I* dcolC = (I*)dcolC_managed.get();
+    T* dvalC = (T*)dvalC_managed.get();
+
+    hipsparseSpMatDescr_t C;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&C, m, n, nnzC, dptrC, dcolC, dvalC, typeI, typeI, idxBase, typeT));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatConvert(handle, B, C, alg, descrC, dbufferC_managed.get()));
+
+    std::vector<I> hcsr_row_ptrC(m + 1);
+    std::vector<I> hcsr_col_indC(nnzC_gold);
+    std::vector<T> hcsr_valC(nnzC_gold);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_row_ptrC.data(), dptrC, sizeof(I) * (m + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_col_indC.data(), dcolC, sizeof(I) * nnzC_gold, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_valC.data(), dvalC, sizeof(T) * nnzC_gold, hipMemcpyDeviceToHost));
+
+    unit_check_general(1, m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptrC.data());
+    unit_check_general(1, nnzC_gold, 1, hcsr_col_ind_gold.data(), hcsr_col_indC.data());
+    unit_check_general(1, nnzC_gold, 1, hcsr_val_gold.data(), hcsr_valC.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatConvert_destroyDescr(descr));
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatConvert_destroyDescr(descrC));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(C));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMAT_CONVERT_HPP
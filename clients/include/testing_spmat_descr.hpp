@@ -772,6 +772,17 @@ void testing_spmat_descr_bad_arg(void)
     verify_hipsparse_status_invalid_pointer(hipsparseSpMatSetValues(coo, nullptr),
                                             "Error: val_ptr is nullptr");
 
+    // hipsparseSpMatUpdateValues
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMatUpdateValues(nullptr, coo, val_ptr),
+                                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMatUpdateValues(handle, nullptr, val_ptr),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMatUpdateValues(handle, coo, nullptr),
+                                            "Error: val_ptr is nullptr");
+
     int     batch_count                 = 100;
     int64_t batch_stride                = 100;
     int64_t offsets_batch_stride        = 100;
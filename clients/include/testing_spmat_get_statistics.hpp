@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (C) 2020 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMAT_GET_STATISTICS_HPP
+#define TESTING_SPMAT_GET_STATISTICS_HPP
+
+#include "hipsparse_test_unique_ptr.hpp"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <hipsparse.h>
+
+#include "hipsparse_arguments.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace hipsparse_test;
+
+void testing_spmat_get_statistics_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t m   = 100;
+    int64_t n   = 100;
+    int64_t nnz = 100;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto row_data_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto col_data_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto val_data_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+
+    int*   row_data = (int*)row_data_managed.get();
+    int*   col_data = (int*)col_data_managed.get();
+    float* val_data = (float*)val_data_managed.get();
+
+    hipsparseSpMatDescr_t A;
+    verify_hipsparse_status_success(hipsparseCreateCsr(&A,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       row_data,
+                                                       col_data,
+                                                       val_data,
+                                                       HIPSPARSE_INDEX_32I,
+                                                       HIPSPARSE_INDEX_32I,
+                                                       HIPSPARSE_INDEX_BASE_ZERO,
+                                                       HIP_R_32F),
+                                    "Success");
+
+    hipsparseSpMatStatistics_t stats;
+
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMatGetStatistics(nullptr, A, &stats),
+                                            "Error: handle is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMatGetStatistics(handle, nullptr, &stats),
+                                            "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(hipsparseSpMatGetStatistics(handle, A, nullptr),
+                                            "Error: stats is nullptr");
+
+    // DIA matrices are not supported
+    hipsparseSpMatDescr_t D;
+    verify_hipsparse_status_success(hipsparseCreateDia(&D,
+                                                       m,
+                                                       n,
+                                                       1,
+                                                       col_data,
+                                                       val_data,
+                                                       HIPSPARSE_INDEX_32I,
+                                                       HIPSPARSE_INDEX_BASE_ZERO,
+                                                       HIP_R_32F),
+                                    "Success");
+    verify_hipsparse_status_not_supported(hipsparseSpMatGetStatistics(handle, D, &stats),
+                                          "Error: DIA is not supported");
+
+    verify_hipsparse_status_success(hipsparseDestroySpMat(D), "Success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "Success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+// Reference statistics of a zero based host CSR pattern
+static hipsparseSpMatStatistics_t host_spmat_statistics(int                     m,
+                                                        int                     n,
+                                                        const std::vector<int>& row_ptr,
+                                                        const std::vector<int>& col_ind)
+{
+    hipsparseSpMatStatistics_t stats{};
+
+    stats.rows      = m;
+    stats.cols      = n;
+    stats.nnz       = row_ptr[m];
+    stats.minRowNnz = row_ptr[m];
+
+    std::vector<std::vector<int>> pattern(m);
+    for(int i = 0; i < m; ++i)
+    {
+        int row_nnz = row_ptr[i + 1] - row_ptr[i];
+
+        stats.minRowNnz = std::min<int64_t>(stats.minRowNnz, row_nnz);
+        stats.maxRowNnz = std::max<int64_t>(stats.maxRowNnz, row_nnz);
+        stats.emptyRows += (row_nnz == 0);
+
+        int bin = (row_nnz == 0) ? 0 : 1 + (int)std::floor(std::log2((double)row_nnz));
+        ++stats.rowNnzHistogram[std::min(bin, HIPSPARSE_SPMAT_STATISTICS_HISTOGRAM_BINS - 1)];
+
+        for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+        {
+            int j = col_ind[k];
+
+            stats.lowerBandwidth = std::max<int64_t>(stats.lowerBandwidth, i - j);
+            stats.upperBandwidth = std::max<int64_t>(stats.upperBandwidth, j - i);
+            stats.diagonalNnz += (i == j);
+
+            pattern[i].push_back(j);
+        }
+    }
+
+    if(m > 0)
+    {
+        stats.meanRowNnz = (double)stats.nnz / m;
+
+        double sum_sq = 0.0;
+        for(int i = 0; i < m; ++i)
+        {
+            double diff = (row_ptr[i + 1] - row_ptr[i]) - stats.meanRowNnz;
+            sum_sq += diff * diff;
+        }
+        stats.stdDevRowNnz = std::sqrt(sum_sq / m);
+    }
+
+    stats.hasFullDiagonal = 1;
+    for(int i = 0; i < std::min(m, n); ++i)
+    {
+        if(std::find(pattern[i].begin(), pattern[i].end(), i) == pattern[i].end())
+        {
+            stats.hasFullDiagonal = 0;
+        }
+    }
+
+    stats.isStructurallySymmetric = (m == n);
+    for(int i = 0; i < m && stats.isStructurallySymmetric; ++i)
+    {
+        for(int j : pattern[i])
+        {
+            if(std::find(pattern[j].begin(), pattern[j].end(), i) == pattern[j].end())
+            {
+                stats.isStructurallySymmetric = 0;
+            }
+        }
+    }
+
+    return stats;
+}
+
+static void unit_check_spmat_statistics(hipsparseSpMatStatistics_t ref,
+                                        hipsparseSpMatStatistics_t stats)
+{
+    unit_check_general(1, 1, 1, &ref.rows, &stats.rows);
+    unit_check_general(1, 1, 1, &ref.cols, &stats.cols);
+    unit_check_general(1, 1, 1, &ref.nnz, &stats.nnz);
+    unit_check_general(1, 1, 1, &ref.minRowNnz, &stats.minRowNnz);
+    unit_check_general(1, 1, 1, &ref.maxRowNnz, &stats.maxRowNnz);
+    unit_check_general(1, 1, 1, &ref.emptyRows, &stats.emptyRows);
+    unit_check_general(
+        1, HIPSPARSE_SPMAT_STATISTICS_HISTOGRAM_BINS, 1, ref.rowNnzHistogram, stats.rowNnzHistogram);
+    unit_check_general(1, 1, 1, &ref.lowerBandwidth, &stats.lowerBandwidth);
+    unit_check_general(1, 1, 1, &ref.upperBandwidth, &stats.upperBandwidth);
+    unit_check_general(1, 1, 1, &ref.diagonalNnz, &stats.diagonalNnz);
+    unit_check_general(1, 1, 1, &ref.hasFullDiagonal, &stats.hasFullDiagonal);
+    unit_check_general(1, 1, 1, &ref.isStructurallySymmetric, &stats.isStructurallySymmetric);
+    unit_check_near(1, 1, 1, &ref.meanRowNnz, &stats.meanRowNnz);
+    unit_check_near(1, 1, 1, &ref.stdDevRowNnz, &stats.stdDevRowNnz);
+}
+#endif
+
+hipsparseStatus_t testing_spmat_get_statistics(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    int                  m        = argus.M;
+    int                  n        = argus.N;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    std::string          filename = argus.filename;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<int>   hcsr_row_ptr;
+    std::vector<int>   hcsr_col_ind;
+    std::vector<float> hcsr_val;
+
+    int nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Zero based pattern for the reference and the COO / CSC conversions
+    std::vector<int> hrow_ptr(m + 1);
+    std::vector<int> hcol_ind(nnz);
+    std::vector<int> hrow_ind(nnz);
+    for(int i = 0; i <= m; ++i)
+    {
+        hrow_ptr[i] = hcsr_row_ptr[i] - idx_base;
+    }
+    for(int i = 0; i < m; ++i)
+    {
+        for(int k = hrow_ptr[i]; k < hrow_ptr[i + 1]; ++k)
+        {
+            hcol_ind[k] = hcsr_col_ind[k] - idx_base;
+            hrow_ind[k] = i + idx_base;
+        }
+    }
+
+    hipsparseSpMatStatistics_t ref = host_spmat_statistics(m, n, hrow_ptr, hcol_ind);
+
+    // Allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto drow_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * nnz), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    int*   drow = (int*)drow_managed.get();
+    float* dval = (float*)dval_managed.get();
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(drow, hrow_ind.data(), sizeof(int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(float) * nnz, hipMemcpyHostToDevice));
+
+    hipsparseSpMatStatistics_t stats;
+
+    // CSR
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsr(&A,
+                                             m,
+                                             n,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             HIP_R_32F));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetStatistics(handle, A, &stats));
+    unit_check_spmat_statistics(ref, stats);
+
+    // Second query is served from the descriptor
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetStatistics(handle, A, &stats));
+    unit_check_spmat_statistics(ref, stats);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    // COO
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCoo(
+        &A, m, n, nnz, drow, dcol, dval, HIPSPARSE_INDEX_32I, idx_base, HIP_R_32F));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetStatistics(handle, A, &stats));
+    unit_check_spmat_statistics(ref, stats);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+
+    // The CSR pattern read as CSC describes the transpose
+    std::vector<int> hrow_ptr_t(n + 1, 0);
+    std::vector<int> hcol_ind_t(nnz);
+    for(int k = 0; k < nnz; ++k)
+    {
+        ++hrow_ptr_t[hcol_ind[k] + 1];
+    }
+    for(int j = 0; j < n; ++j)
+    {
+        hrow_ptr_t[j + 1] += hrow_ptr_t[j];
+    }
+    std::vector<int> offset(hrow_ptr_t.begin(), hrow_ptr_t.end() - 1);
+    for(int i = 0; i < m; ++i)
+    {
+        for(int k = hrow_ptr[i]; k < hrow_ptr[i + 1]; ++k)
+        {
+            hcol_ind_t[offset[hcol_ind[k]]++] = i;
+        }
+    }
+
+    hipsparseSpMatStatistics_t ref_t = host_spmat_statistics(n, m, hrow_ptr_t, hcol_ind_t);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateCsc(&A,
+                                             n,
+                                             m,
+                                             nnz,
+                                             dptr,
+                                             dcol,
+                                             dval,
+                                             HIPSPARSE_INDEX_32I,
+                                             HIPSPARSE_INDEX_32I,
+                                             idx_base,
+                                             HIP_R_32F));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMatGetStatistics(handle, A, &stats));
+    unit_check_spmat_statistics(ref_t, stats);
+
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMAT_GET_STATISTICS_HPP
@@ -0,0 +1,421 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_BATCHED_COO_HPP
+#define TESTING_SPMV_BATCHED_COO_HPP
+
+#include "display.hpp"
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "hipsparse.hpp"
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse;
+using namespace hipsparse_test;
+
+void testing_spmv_batched_coo_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int32_t              m         = 100;
+    int32_t              n         = 100;
+    int64_t              nnz       = 100;
+    float                alpha     = 0.6;
+    float                beta      = 0.2;
+    size_t               safe_size = 100;
+    hipsparseOperation_t transA    = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+    hipsparseSpMVAlg_t   alg       = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto drow_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dbuf_managed = hipsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    int*   drow = (int*)drow_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+    void*  dbuf = (void*)dbuf_managed.get();
+
+    // SpMV structures
+    hipsparseSpMatDescr_t A;
+    hipsparseDnVecDescr_t x, y;
+
+    // Create SpMV structures
+    verify_hipsparse_status_success(
+        hipsparseCreateCoo(&A, m, n, nnz, drow, dcol, dval, idxType, idxBase, dataType),
+        "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "success");
+
+    int     batch_count;
+    int64_t batch_stride;
+
+    // Strided batch of dense vectors
+    verify_hipsparse_status_invalid_value(hipsparseDnVecSetStridedBatch(nullptr, 5, n),
+                                          "Error: dnVecDescr is nullptr");
+    verify_hipsparse_status_invalid_value(hipsparseDnVecSetStridedBatch(x, 0, n),
+                                          "Error: batchCount is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseDnVecSetStridedBatch(x, 5, -1),
+                                          "Error: batchStride is invalid");
+    verify_hipsparse_status_invalid_value(hipsparseDnVecSetStridedBatch(x, 5, n - 1),
+                                          "Error: batchStride is smaller than the vector size");
+    verify_hipsparse_status_invalid_value(
+        hipsparseDnVecGetStridedBatch(nullptr, &batch_count, &batch_stride),
+        "Error: dnVecDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseDnVecGetStridedBatch(x, nullptr, &batch_stride), "Error: batchCount is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseDnVecGetStridedBatch(x, &batch_count, nullptr), "Error: batchStride is nullptr");
+
+    // A vector without a batch has a batch count of 1
+    int expected_batch_count = 1;
+    verify_hipsparse_status_success(
+        hipsparseDnVecGetStridedBatch(x, &batch_count, &batch_stride), "success");
+    unit_check_general(1, 1, 1, &expected_batch_count, &batch_count);
+
+    // y_i = A * x, y is batched but neither A nor x
+    verify_hipsparse_status_success(hipsparseDnVecSetStridedBatch(y, 5, m), "success");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMV(handle, transA, &alpha, A, x, &beta, y, dataType, alg, dbuf),
+        "Error: Combination of strided batch parameters is invalid");
+
+    // y_i = A_i * x_i with different batch counts of A and y
+    verify_hipsparse_status_success(hipsparseCooSetStridedBatch(A, 10, nnz), "success");
+    verify_hipsparse_status_success(hipsparseDnVecSetStridedBatch(x, 10, n), "success");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMV(handle, transA, &alpha, A, x, &beta, y, dataType, alg, dbuf),
+        "Error: Combination of strided batch parameters is invalid");
+
+    // y_i = A * x_i with different batch counts of x and y
+    verify_hipsparse_status_success(hipsparseCooSetStridedBatch(A, 1, 0), "success");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMV(handle, transA, &alpha, A, x, &beta, y, dataType, alg, dbuf),
+        "Error: Combination of strided batch parameters is invalid");
+
+    // Destruct
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "success");
+
+    // The batch belongs to the descriptor, a new descriptor starts without one
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "success");
+    verify_hipsparse_status_success(
+        hipsparseDnVecGetStridedBatch(x, &batch_count, &batch_stride), "success");
+    unit_check_general(1, 1, 1, &expected_batch_count, &batch_count);
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
+#endif
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmv_batched_coo(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    I                    m           = argus.M;
+    I                    n           = argus.N;
+    T                    h_alpha     = make_DataType<T>(argus.alpha);
+    T                    h_beta      = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA      = argus.transA;
+    hipsparseIndexBase_t idx_base    = argus.baseA;
+    I                    batch_count = argus.batch_count;
+    hipsparseSpMVAlg_t   alg         = HIPSPARSE_SPMV_ALG_DEFAULT;
+
+    std::string filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hrow_ptr;
+    std::vector<I> hcol_ind_temp;
+    std::vector<T> hval_temp;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz_A;
+    if(!generate_csr_matrix(filename, m, n, nnz_A, hrow_ptr, hcol_ind_temp, hval_temp, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    std::vector<I> hrow_ind_temp(nnz_A);
+
+    // Convert to COO
+    for(I i = 0; i < m; ++i)
+    {
+        for(I j = hrow_ptr[i]; j < hrow_ptr[i + 1]; ++j)
+        {
+            hrow_ind_temp[j - idx_base] = i + idx_base;
+        }
+    }
+
+    I x_size = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    I y_size = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    // y_i = A * x_i, y_i = A_i * x and y_i = A_i * x_i
+    I batch_counts_A[] = {1, batch_count, batch_count};
+    I batch_counts_x[] = {batch_count, 1, batch_count};
+
+    for(int mode = 0; mode < 3; ++mode)
+    {
+        I batch_count_A = batch_counts_A[mode];
+        I batch_count_x = batch_counts_x[mode];
+        I batch_count_y = batch_count;
+
+        int64_t batch_stride_A = (batch_count_A > 1) ? nnz_A : 0;
+        int64_t batch_stride_x = x_size;
+        int64_t batch_stride_y = y_size;
+
+        // All batches of A share the sparsity pattern, but have their own values
+        std::vector<I> hrow_ind(batch_count_A * nnz_A);
+        std::vector<I> hcol_ind(batch_count_A * nnz_A);
+        std::vector<T> hval(batch_count_A * nnz_A);
+
+        for(I i = 0; i < batch_count_A; i++)
+        {
+            for(I j = 0; j < nnz_A; j++)
+            {
+                hrow_ind[nnz_A * i + j] = hrow_ind_temp[j];
+                hcol_ind[nnz_A * i + j] = hcol_ind_temp[j];
+            }
+        }
+
+        hipsparseInit<T>(hval, 1, batch_count_A * nnz_A);
+
+        std::vector<T> hx(batch_count_x * batch_stride_x);
+        std::vector<T> hy_1(batch_count_y * batch_stride_y);
+        std::vector<T> hy_2(batch_count_y * batch_stride_y);
+        std::vector<T> hy_gold(batch_count_y * batch_stride_y);
+
+        hipsparseInit<T>(hx, 1, batch_count_x * batch_stride_x);
+        hipsparseInit<T>(hy_1, 1, batch_count_y * batch_stride_y);
+
+        hy_2    = hy_1;
+        hy_gold = hy_1;
+
+        // allocate memory on device
+        auto drow_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * batch_count_A * nnz_A), device_free};
+        auto dcol_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(I) * batch_count_A * nnz_A), device_free};
+        auto dval_managed
+            = hipsparse_unique_ptr{device_malloc(sizeof(T) * batch_count_A * nnz_A), device_free};
+        auto dx_managed = hipsparse_unique_ptr{
+            device_malloc(sizeof(T) * batch_count_x * batch_stride_x), device_free};
+        auto dy_1_managed = hipsparse_unique_ptr{
+            device_malloc(sizeof(T) * batch_count_y * batch_stride_y), device_free};
+        auto dy_2_managed = hipsparse_unique_ptr{
+            device_malloc(sizeof(T) * batch_count_y * batch_stride_y), device_free};
+        auto d_alpha_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+        auto d_beta_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+        I* drow    = (I*)drow_managed.get();
+        I* dcol    = (I*)dcol_managed.get();
+        T* dval    = (T*)dval_managed.get();
+        T* dx      = (T*)dx_managed.get();
+        T* dy_1    = (T*)dy_1_managed.get();
+        T* dy_2    = (T*)dy_2_managed.get();
+        T* d_alpha = (T*)d_alpha_managed.get();
+        T* d_beta  = (T*)d_beta_managed.get();
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(
+            drow, hrow_ind.data(), sizeof(I) * batch_count_A * nnz_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcol, hcol_ind.data(), sizeof(I) * batch_count_A * nnz_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dval, hval.data(), sizeof(T) * batch_count_A * nnz_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dx, hx.data(), sizeof(T) * batch_count_x * batch_stride_x, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_1,
+                                  hy_1.data(),
+                                  sizeof(T) * batch_count_y * batch_stride_y,
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2,
+                                  hy_2.data(),
+                                  sizeof(T) * batch_count_y * batch_stride_y,
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Create matrices
+        hipsparseSpMatDescr_t A;
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCreateCoo(&A, m, n, nnz_A, drow, dcol, dval, typeI, idx_base, typeT));
+
+        // Create dense vectors
+        hipsparseDnVecDescr_t x, y1, y2;
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, x_size, dx, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, y_size, dy_1, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, y_size, dy_2, typeT));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseCooSetStridedBatch(A, batch_count_A, batch_stride_A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDnVecSetStridedBatch(x, batch_count_x, batch_stride_x));
+        CHECK_HIPSPARSE_ERROR(hipsparseDnVecSetStridedBatch(y1, batch_count_y, batch_stride_y));
+        CHECK_HIPSPARSE_ERROR(hipsparseDnVecSetStridedBatch(y2, batch_count_y, batch_stride_y));
+
+        // Query SpMV buffer
+        size_t bufferSize;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+            handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+        void* buffer;
+        CHECK_HIP_ERROR(hipMalloc(&buffer, std::max(bufferSize, sizeof(char))));
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(
+            handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+        if(argus.unit_check)
+        {
+            // HIPSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+
+            // HIPSPARSE pointer mode device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(
+                hipsparseSpMV(handle, transA, d_alpha, A, x, d_beta, y2, typeT, alg, buffer));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(hy_1.data(),
+                                      dy_1,
+                                      sizeof(T) * batch_count_y * batch_stride_y,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hy_2.data(),
+                                      dy_2,
+                                      sizeof(T) * batch_count_y * batch_stride_y,
+                                      hipMemcpyDeviceToHost));
+
+            // CPU
+            host_coomv_batched(transA,
+                               m,
+                               n,
+                               nnz_A,
+                               h_alpha,
+                               hrow_ind.data(),
+                               hcol_ind.data(),
+                               hval.data(),
+                               batch_count_A,
+                               batch_stride_A,
+                               hx.data(),
+                               batch_count_x,
+                               batch_stride_x,
+                               h_beta,
+                               hy_gold.data(),
+                               batch_count_y,
+                               batch_stride_y,
+                               idx_base);
+
+            unit_check_near(1, batch_count_y * batch_stride_y, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, batch_count_y * batch_stride_y, 1, hy_gold.data(), hy_2.data());
+        }
+
+        if(argus.timing && batch_count_A > 1 && batch_count_x > 1)
+        {
+            int number_cold_calls = 2;
+            int number_hot_calls  = argus.iters;
+
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+            // Warm up
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_HIPSPARSE_ERROR(
+                    hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            }
+
+            double gpu_time_used = get_time_us();
+
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_HIPSPARSE_ERROR(
+                    hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, buffer));
+            }
+
+            gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+            double gflop_count
+                = batch_count * spmv_gflop_count(m, nnz_A, h_beta != make_DataType<T>(0));
+            double gbyte_count
+                = batch_count * coomv_gbyte_count<T>(m, n, nnz_A, h_beta != make_DataType<T>(0));
+
+            double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+            double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+            display_timing_info(display_key_t::M,
+                                m,
+                                display_key_t::N,
+                                n,
+                                display_key_t::nnz,
+                                nnz_A,
+                                display_key_t::batch_count,
+                                batch_count,
+                                display_key_t::alpha,
+                                h_alpha,
+                                display_key_t::beta,
+                                h_beta,
+                                display_key_t::gflops,
+                                gpu_gflops,
+                                display_key_t::bandwidth,
+                                gpu_gbyte,
+                                display_key_t::time_ms,
+                                get_gpu_time_msec(gpu_time_used));
+        }
+
+        CHECK_HIP_ERROR(hipFree(buffer));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+    }
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+#endif // TESTING_SPMV_BATCHED_COO_HPP
@@ -164,6 +164,45 @@ void testing_spmv_csr_bad_arg(void)
         hipsparseSpMV(handle, transA, &alpha, A, x, &beta, nullptr, dataType, alg, nullptr),
         "Error: dbuf is nullptr");
 
+#if(!defined(CUDART_VERSION))
+    // SpMV with dot product
+    float                 result;
+    hipsparseDnVecDescr_t z;
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&z, m / 2, dx, dataType), "success");
+
+    verify_hipsparse_status_invalid_handle(hipsparseSpMVDot(
+        nullptr, transA, &alpha, A, x, &beta, y, nullptr, &result, dataType, alg, dbuf));
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, nullptr, A, x, &beta, y, nullptr, &result, dataType, alg, dbuf),
+        "Error: alpha is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, nullptr, x, &beta, y, nullptr, &result, dataType, alg, dbuf),
+        "Error: A is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, nullptr, &beta, y, nullptr, &result, dataType, alg, dbuf),
+        "Error: x is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, x, nullptr, y, nullptr, &result, dataType, alg, dbuf),
+        "Error: beta is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, x, &beta, nullptr, nullptr, &result, dataType, alg, dbuf),
+        "Error: y is nullptr");
+    verify_hipsparse_status_invalid_pointer(
+        hipsparseSpMVDot(
+            handle, transA, &alpha, A, x, &beta, y, nullptr, nullptr, dataType, alg, dbuf),
+        "Error: result is nullptr");
+    verify_hipsparse_status_invalid_size(
+        hipsparseSpMVDot(handle, transA, &alpha, A, x, &beta, y, z, &result, dataType, alg, dbuf),
+        "Error: z and y sizes do not match");
+
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(z), "success");
+#endif
+
     // Destruct
     verify_hipsparse_status_success(hipsparseDestroySpMat(A), "success");
     verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "success");
@@ -432,4 +471,614 @@ hipsparseStatus_t testing_spmv_csr(Arguments argus)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_csr_alternating(Arguments            argus,
+                                               hipsparseOperation_t transB,
+                                               hipsparseSpMVAlg_t   algB)
+{
+#if(!defined(CUDART_VERSION) || CUDART_VERSION > 10010 \
+    || (CUDART_VERSION == 10010 && CUDART_10_1_UPDATE_VERSION == 1))
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   algA     = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    // The two plans that are alternated on the same matrix descriptor, A * x with the
+    // requested algorithm and op(A) * x with algB
+    hipsparseOperation_t trans[2] = {HIPSPARSE_OPERATION_NON_TRANSPOSE, transB};
+    hipsparseSpMVAlg_t   alg[2]   = {algA, algB};
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // x and y are sized for both A * x and A^T * x
+    J mn = std::max(m, n);
+
+    std::vector<T> hx(mn);
+    std::vector<T> hy(mn);
+    std::vector<T> hy_gold(mn);
+
+    hipsparseInit<T>(hx, 1, mn);
+    hipsparseInit<T>(hy, 1, mn);
+
+    hy_gold = hy;
+
+    // allocate memory on device
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * mn), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T) * mn), device_free};
+
+    I* dptr = (I*)dptr_managed.get();
+    J* dcol = (J*)dcol_managed.get();
+    T* dval = (T*)dval_managed.get();
+    T* dx   = (T*)dx_managed.get();
+    T* dy   = (T*)dy_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * mn, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * mn, hipMemcpyHostToDevice));
+
+    // Create matrix
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+
+    // Create dense vectors for both plans, they share the same device memory
+    hipsparseDnVecDescr_t x[2];
+    hipsparseDnVecDescr_t y[2];
+    J                     xsize[2];
+    J                     ysize[2];
+    void*                 buffer[2];
+
+    for(int p = 0; p < 2; ++p)
+    {
+        xsize[p] = (trans[p] == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+        ysize[p] = (trans[p] == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x[p], xsize[p], dx, typeT));
+        CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y[p], ysize[p], dy, typeT));
+    }
+
+    // Query and preprocess both plans on the same matrix descriptor before any of them is
+    // executed, so that the analysis of the second plan cannot hide a stale first plan
+    for(int p = 0; p < 2; ++p)
+    {
+        size_t bufferSize;
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(handle,
+                                                       trans[p],
+                                                       &h_alpha,
+                                                       A,
+                                                       x[p],
+                                                       &h_beta,
+                                                       y[p],
+                                                       typeT,
+                                                       alg[p],
+                                                       &bufferSize));
+
+        CHECK_HIP_ERROR(hipMalloc(&buffer[p], bufferSize));
+    }
+
+    for(int p = 0; p < 2; ++p)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(handle,
+                                                       trans[p],
+                                                       &h_alpha,
+                                                       A,
+                                                       x[p],
+                                                       &h_beta,
+                                                       y[p],
+                                                       typeT,
+                                                       alg[p],
+                                                       buffer[p]));
+    }
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Alternate between both plans, each must keep using its own analysis
+        for(int iter = 0; iter < 4; ++iter)
+        {
+            int p = iter % 2;
+
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMV(handle,
+                                                trans[p],
+                                                &h_alpha,
+                                                A,
+                                                x[p],
+                                                &h_beta,
+                                                y[p],
+                                                typeT,
+                                                alg[p],
+                                                buffer[p]));
+
+            host_csrmv(trans[p],
+                       m,
+                       n,
+                       nnz,
+                       h_alpha,
+                       hcsr_row_ptr.data(),
+                       hcol_ind.data(),
+                       hval.data(),
+                       hx.data(),
+                       h_beta,
+                       hy_gold.data(),
+                       idx_base);
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy.data(), dy, sizeof(T) * ysize[p], hipMemcpyDeviceToHost));
+            unit_check_near(1, ysize[p], 1, hy_gold.data(), hy.data());
+
+            // Continue from the device result so that rounding differences do not accumulate
+            hy_gold = hy;
+        }
+    }
+
+    for(int p = 0; p < 2; ++p)
+    {
+        CHECK_HIP_ERROR(hipFree(buffer[p]));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x[p]));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y[p]));
+    }
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_csr_update_values(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA   = HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // New values on the same sparsity pattern
+    std::vector<T> hval_new(nnz);
+    hipsparseInit<T>(hval_new, 1, nnz);
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+    std::vector<T> hy_gold(m);
+
+    hipsparseInit<T>(hx, 1, n);
+    hipsparseInit<T>(hy, 1, m);
+
+    hy_gold = hy;
+
+    // allocate memory on device
+    auto dptr_managed     = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed     = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dcol_new_managed = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dval_new_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    I* dptr     = (I*)dptr_managed.get();
+    J* dcol     = (J*)dcol_managed.get();
+    J* dcol_new = (J*)dcol_new_managed.get();
+    T* dval     = (T*)dval_managed.get();
+    T* dval_new = (T*)dval_new_managed.get();
+    T* dx       = (T*)dx_managed.get();
+    T* dy       = (T*)dy_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol_new, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_new, hval_new.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Create matrix and dense vectors
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, n, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, typeT));
+
+    // Analysis is performed once only
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMV_preprocess(handle, transA, &h_alpha, A, x, &h_beta, y, typeT, alg, buffer));
+
+    if(argus.unit_check)
+    {
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Values-only update, the analysis is kept
+        CHECK_HIPSPARSE_ERROR(hipsparseSpMatUpdateValues(handle, A, dval_new));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y, typeT, alg, buffer));
+
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval_new.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+        unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+        // Continue from the device result so that rounding differences do not accumulate
+        hy_gold = hy;
+
+        // Changing the column index array invalidates the analysis of A
+        CHECK_HIPSPARSE_ERROR(hipsparseCsrSetPointers(A, dptr, dcol_new, dval));
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseSpMV(handle, transA, &h_alpha, A, x, &h_beta, y, typeT, alg, buffer));
+
+        host_csrmv(transA,
+                   m,
+                   n,
+                   nnz,
+                   h_alpha,
+                   hcsr_row_ptr.data(),
+                   hcol_ind.data(),
+                   hval_new.data(),
+                   hx.data(),
+                   h_beta,
+                   hy_gold.data(),
+                   idx_base);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+        unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+
+template <typename I, typename J, typename T>
+hipsparseStatus_t testing_spmv_csr_dot(Arguments argus)
+{
+#if(!defined(CUDART_VERSION))
+    J                    m        = argus.M;
+    J                    n        = argus.N;
+    T                    h_alpha  = make_DataType<T>(argus.alpha);
+    T                    h_beta   = make_DataType<T>(argus.beta);
+    hipsparseOperation_t transA   = argus.transA;
+    hipsparseIndexBase_t idx_base = argus.baseA;
+    hipsparseSpMVAlg_t   alg      = static_cast<hipsparseSpMVAlg_t>(argus.spmv_alg);
+    std::string          filename = argus.filename;
+
+    // Index and data type
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipsparseIndexType_t typeJ = getIndexType<J>();
+    hipDataType          typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<J> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    I nnz;
+    if(!generate_csr_matrix(filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base))
+    {
+        fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    J x_size = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+    J y_size = (transA == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+
+    std::vector<T> hx(x_size);
+    std::vector<T> hz(y_size);
+    std::vector<T> hy_1(y_size);
+    std::vector<T> hy_2(y_size);
+    std::vector<T> hy_gold(y_size);
+
+    hipsparseInit<T>(hx, 1, x_size);
+    hipsparseInit<T>(hz, 1, y_size);
+    hipsparseInit<T>(hy_1, 1, y_size);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // allocate memory on device
+    auto dptr_managed     = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+    auto dcol_managed     = hipsparse_unique_ptr{device_malloc(sizeof(J) * nnz), device_free};
+    auto dval_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * x_size), device_free};
+    auto dz_managed       = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto dy_1_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto dy_2_managed     = hipsparse_unique_ptr{device_malloc(sizeof(T) * y_size), device_free};
+    auto d_alpha_managed  = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed   = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_result_managed = hipsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    I* dptr     = (I*)dptr_managed.get();
+    J* dcol     = (J*)dcol_managed.get();
+    T* dval     = (T*)dval_managed.get();
+    T* dx       = (T*)dx_managed.get();
+    T* dz       = (T*)dz_managed.get();
+    T* dy_1     = (T*)dy_1_managed.get();
+    T* dy_2     = (T*)dy_2_managed.get();
+    T* d_alpha  = (T*)d_alpha_managed.get();
+    T* d_beta   = (T*)d_beta_managed.get();
+    T* d_result = (T*)d_result_managed.get();
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcol, hcol_ind.data(), sizeof(J) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dz, hz.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Create matrix and dense vectors
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, typeI, typeJ, idx_base, typeT));
+
+    hipsparseDnVecDescr_t x, z, y1, y2;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, x_size, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&z, y_size, dz, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y1, y_size, dy_1, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y2, y_size, dy_2, typeT));
+
+    // Query SpMV buffer, the SpMV with dot product uses the SpMV buffer
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(
+        handle, transA, &h_alpha, A, x, &h_beta, y1, typeT, alg, &bufferSize));
+
+    void* buffer;
+    CHECK_HIP_ERROR(hipMalloc(&buffer, bufferSize));
+
+    if(argus.unit_check)
+    {
+        // Dot product with x if op(A) is square, with z otherwise
+        hipsparseDnVecDescr_t vecZ   = (x_size == y_size) ? nullptr : z;
+        const T*              hz_ptr = (x_size == y_size) ? nullptr : hz.data();
+
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            T h_result_1;
+            T h_result_2;
+
+            // HIPSPARSE pointer mode host
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot(handle,
+                                                   transA,
+                                                   &h_alpha,
+                                                   A,
+                                                   x,
+                                                   &h_beta,
+                                                   y1,
+                                                   vecZ,
+                                                   &h_result_1,
+                                                   typeT,
+                                                   alg,
+                                                   buffer));
+
+            // HIPSPARSE pointer mode device, the result stays on the device
+            CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_DEVICE));
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot(handle,
+                                                   transA,
+                                                   d_alpha,
+                                                   A,
+                                                   x,
+                                                   d_beta,
+                                                   y2,
+                                                   vecZ,
+                                                   d_result,
+                                                   typeT,
+                                                   alg,
+                                                   buffer));
+
+            // copy output from device to CPU
+            CHECK_HIP_ERROR(hipMemcpy(&h_result_2, d_result, sizeof(T), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_1.data(), dy_1, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_2.data(), dy_2, sizeof(T) * y_size, hipMemcpyDeviceToHost));
+
+            // CPU
+            T h_result_gold = host_csrmv_dot(transA,
+                                             m,
+                                             n,
+                                             nnz,
+                                             h_alpha,
+                                             hcsr_row_ptr.data(),
+                                             hcol_ind.data(),
+                                             hval.data(),
+                                             hx.data(),
+                                             h_beta,
+                                             hy_gold.data(),
+                                             hz_ptr,
+                                             idx_base);
+
+            unit_check_near(1, y_size, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, y_size, 1, hy_gold.data(), hy_2.data());
+            unit_check_near(1, 1, 1, &h_result_gold, &h_result_1);
+            unit_check_near(1, 1, 1, &h_result_gold, &h_result_2);
+
+            // The second pass uses the explicit z vector
+            vecZ   = z;
+            hz_ptr = hz.data();
+
+            // Continue from the device result so that rounding differences do not accumulate
+            hy_gold = hy_1;
+            CHECK_HIP_ERROR(
+                hipMemcpy(dy_2, hy_1.data(), sizeof(T) * y_size, hipMemcpyHostToDevice));
+        }
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+
+        T h_result;
+
+        CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot(handle,
+                                                   transA,
+                                                   &h_alpha,
+                                                   A,
+                                                   x,
+                                                   &h_beta,
+                                                   y1,
+                                                   z,
+                                                   &h_result,
+                                                   typeT,
+                                                   alg,
+                                                   buffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIPSPARSE_ERROR(hipsparseSpMVDot(handle,
+                                                   transA,
+                                                   &h_alpha,
+                                                   A,
+                                                   x,
+                                                   &h_beta,
+                                                   y1,
+                                                   z,
+                                                   &h_result,
+                                                   typeT,
+                                                   alg,
+                                                   buffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = spmv_gflop_count(m, nnz, h_beta != make_DataType<T>(0.0));
+        double gbyte_count = csrmv_gbyte_count<T>(m, n, nnz, h_beta != make_DataType<T>(0.0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            m,
+                            display_key_t::N,
+                            n,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::alpha,
+                            h_alpha,
+                            display_key_t::beta,
+                            h_beta,
+                            display_key_t::gflops,
+                            gpu_gflops,
+                            display_key_t::bandwidth,
+                            gpu_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(gpu_time_used));
+    }
+
+    CHECK_HIP_ERROR(hipFree(buffer));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(z));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y1));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y2));
+#endif
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 #endif // TESTING_SPMV_CSR_HPP
@@ -0,0 +1,651 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_SYMMETRIC_HPP
+#define TESTING_SYMMETRIC_HPP
+
+#include "hipsparse_arguments.hpp"
+#include "hipsparse_test_unique_ptr.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <hipsparse.h>
+#include <string>
+#include <typeinfo>
+
+using namespace hipsparse_test;
+
+void testing_symmetric_bad_arg(void)
+{
+#if(!defined(CUDART_VERSION))
+    int64_t              m         = 100;
+    int64_t              n         = 50;
+    int64_t              nnz       = 0;
+    int64_t              safe_size = 100;
+    hipsparseIndexBase_t idxBase   = HIPSPARSE_INDEX_BASE_ZERO;
+    hipsparseIndexType_t idxType   = HIPSPARSE_INDEX_32I;
+    hipDataType          dataType  = HIP_R_32F;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    auto dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(int) * safe_size), device_free};
+    auto dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dx_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = hipsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    int*   dptr = (int*)dptr_managed.get();
+    int*   dcol = (int*)dcol_managed.get();
+    float* dval = (float*)dval_managed.get();
+    float* dx   = (float*)dx_managed.get();
+    float* dy   = (float*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemset(dptr, 0, sizeof(int) * (m + 1)));
+
+    hipsparseSpMatDescr_t A;
+    verify_hipsparse_status_success(
+        hipsparseCreateCsr(&A, m, n, nnz, dptr, dcol, dval, idxType, idxType, idxBase, dataType),
+        "Success");
+
+    hipsparseMatrixType_t matrix_type = HIPSPARSE_MATRIX_TYPE_HERMITIAN;
+    hipsparseFillMode_t   fill_mode   = HIPSPARSE_FILL_MODE_UPPER;
+
+    // hipsparseSpMatSetAttribute
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatSetAttribute(
+            nullptr, HIPSPARSE_SPMAT_MATRIX_TYPE, &matrix_type, sizeof(matrix_type)),
+        "Error: spMatDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_MATRIX_TYPE, nullptr, sizeof(matrix_type)),
+        "Error: data is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_MATRIX_TYPE, &matrix_type, sizeof(char)),
+        "Error: dataSize is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatSetAttribute(
+            A, (hipsparseSpMatAttribute_t)-1, &matrix_type, sizeof(matrix_type)),
+        "Error: attribute is invalid");
+
+    hipsparseMatrixType_t bad_matrix_type = (hipsparseMatrixType_t)-1;
+    hipsparseFillMode_t   bad_fill_mode   = (hipsparseFillMode_t)-1;
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatSetAttribute(
+            A, HIPSPARSE_SPMAT_MATRIX_TYPE, &bad_matrix_type, sizeof(bad_matrix_type)),
+        "Error: matrix type is invalid");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatSetAttribute(
+            A, HIPSPARSE_SPMAT_FILL_MODE, &bad_fill_mode, sizeof(bad_fill_mode)),
+        "Error: fill mode is invalid");
+
+    // hipsparseSpMatGetAttribute
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatGetAttribute(
+            nullptr, HIPSPARSE_SPMAT_MATRIX_TYPE, &matrix_type, sizeof(matrix_type)),
+        "Error: spMatDescr is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatGetAttribute(A, HIPSPARSE_SPMAT_MATRIX_TYPE, nullptr, sizeof(matrix_type)),
+        "Error: data is nullptr");
+    verify_hipsparse_status_invalid_value(
+        hipsparseSpMatGetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &fill_mode, sizeof(char)),
+        "Error: dataSize is invalid");
+
+    // The attributes are read back as they were set
+    verify_hipsparse_status_success(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_MATRIX_TYPE, &matrix_type, sizeof(matrix_type)),
+        "Success");
+    verify_hipsparse_status_success(
+        hipsparseSpMatSetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &fill_mode, sizeof(fill_mode)),
+        "Success");
+
+    hipsparseMatrixType_t matrix_type_A;
+    hipsparseFillMode_t   fill_mode_A;
+    verify_hipsparse_status_success(
+        hipsparseSpMatGetAttribute(
+            A, HIPSPARSE_SPMAT_MATRIX_TYPE, &matrix_type_A, sizeof(matrix_type_A)),
+        "Success");
+    verify_hipsparse_status_success(
+        hipsparseSpMatGetAttribute(A, HIPSPARSE_SPMAT_FILL_MODE, &fill_mode_A, sizeof(fill_mode_A)),
+        "Success");
+
+    int matrix_type_gold = matrix_type;
+    int matrix_type_int  = matrix_type_A;
+    int fill_mode_gold   = fill_mode;
+    int fill_mode_int    = fill_mode_A;
+    unit_check_general(1, 1, 1, &matrix_type_gold, &matrix_type_int);
+    unit_check_general(1, 1, 1, &fill_mode_gold, &fill_mode_int);
+
+    // Products with Hermitian matrices are not supported
+    hipsparseDnVecDescr_t x;
+    hipsparseDnVecDescr_t y;
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&x, n, dx, dataType), "Success");
+    verify_hipsparse_status_success(hipsparseCreateDnVec(&y, m, dy, dataType), "Success");
+
+    float             alpha = 1.0f;
+    float             beta  = 0.0f;
+    size_t            bufferSize;
+    hipsparseStatus_t status = hipsparseSpMV_bufferSize(handle,
+                                                        HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                        &alpha,
+                                                        A,
+                                                        x,
+                                                        &beta,
+                                                        y,
+                                                        dataType,
+                                                        HIPSPARSE_SPMV_ALG_DEFAULT,
+                                                        &bufferSize);
+    verify_hipsparse_status_not_supported(status, "Error: A is Hermitian");
+    status = hipsparseSpMV(handle,
+                           HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                           &alpha,
+                           A,
+                           x,
+                           &beta,
+                           y,
+                           dataType,
+                           HIPSPARSE_SPMV_ALG_DEFAULT,
+                           dy);
+    verify_hipsparse_status_not_supported(status, "Error: A is Hermitian");
+
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(x), "Success");
+    verify_hipsparse_status_success(hipsparseDestroyDnVec(y), "Success");
+    verify_hipsparse_status_success(hipsparseDestroySpMat(A), "Success");
+#endif
+}
+
+#if(!defined(CUDART_VERSION))
+//
+// Symmetric or Hermitian test matrix of size m that stores the triangle given by fill_mode. A
+// symmetric .mtx file is read as the lower triangle it stores, without expansion, other files
+// and generated matrices are cut down to the triangle.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_symmetric_matrix(const std::string    filename,
+                                                  I&                   m,
+                                                  hipsparseFillMode_t  fill_mode,
+                                                  bool                 hermitian,
+                                                  hipsparseIndexBase_t idxBase,
+                                                  std::vector<I>&      hcsr_row_ptr,
+                                                  std::vector<I>&      hcsr_col_ind,
+                                                  std::vector<T>&      hcsr_val)
+{
+    std::vector<I> hrow_ptr;
+    std::vector<I> hcol_ind;
+    std::vector<T> hval;
+
+    std::string extension = filename.substr(filename.find_last_of(".") + 1);
+    if(filename != "" && extension == "mtx")
+    {
+        I              n;
+        int64_t        nnz;
+        std::vector<I> hrow_ind;
+        if(read_mtx_matrix(filename.c_str(), m, n, nnz, hrow_ind, hcol_ind, hval, idxBase, false)
+               != 0
+           || m != n)
+        {
+            fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+
+        hrow_ptr.resize(m + 1, 0);
+        for(int64_t i = 0; i < nnz; ++i)
+        {
+            ++hrow_ptr[hrow_ind[i] + 1 - idxBase];
+        }
+
+        hrow_ptr[0] = idxBase;
+        for(I i = 0; i < m; ++i)
+        {
+            hrow_ptr[i + 1] += hrow_ptr[i];
+        }
+
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        {
+            hcsr_row_ptr = hrow_ptr;
+            hcsr_col_ind = hcol_ind;
+            hcsr_val     = hval;
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // The upper triangle is the (conjugate) transpose of the stored lower triangle
+        std::vector<I> hgen_row_ptr;
+        std::vector<I> hgen_col_ind;
+        std::vector<T> hgen_val;
+        host_csr_symmetric_to_general(m,
+                                      hrow_ptr,
+                                      hcol_ind,
+                                      hval,
+                                      idxBase,
+                                      HIPSPARSE_FILL_MODE_LOWER,
+                                      hermitian,
+                                      hgen_row_ptr,
+                                      hgen_col_ind,
+                                      hgen_val);
+
+        hrow_ptr = hgen_row_ptr;
+        hcol_ind = hgen_col_ind;
+        hval     = hgen_val;
+    }
+    else
+    {
+        I n = m;
+        I nnz;
+        if(!generate_csr_matrix(filename, m, n, nnz, hrow_ptr, hcol_ind, hval, idxBase) || m != n)
+        {
+            fprintf(stderr, "Cannot open [read] %s\ncol", filename.c_str());
+            return HIPSPARSE_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    host_csr_triangle(
+        m, hrow_ptr, hcol_ind, hval, idxBase, fill_mode, hcsr_row_ptr, hcsr_col_ind, hcsr_val);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Create a CSR or ELL matrix on the device from the stored triangle and set its matrix type and
+// fill mode. The device arrays are returned in the managed pointers.
+//
+template <typename I, typename T>
+static hipsparseStatus_t testing_symmetric_create(I                      m,
+                                                  const std::vector<I>&  hcsr_row_ptr,
+                                                  const std::vector<I>&  hcsr_col_ind,
+                                                  const std::vector<T>&  hcsr_val,
+                                                  hipsparseFormat_t      format,
+                                                  hipsparseMatrixType_t  matrix_type,
+                                                  hipsparseFillMode_t    fill_mode,
+                                                  hipsparseIndexBase_t   idxBase,
+                                                  hipsparse_unique_ptr&  dptr_managed,
+                                                  hipsparse_unique_ptr&  dcol_managed,
+                                                  hipsparse_unique_ptr&  dval_managed,
+                                                  hipsparseSpMatDescr_t* A)
+{
+    hipsparseIndexType_t typeI = getIndexType<I>();
+    hipDataType          typeT = getDataType<T>();
+
+    I nnz = hcsr_row_ptr[m] - hcsr_row_ptr[0];
+
+    if(format == HIPSPARSE_FORMAT_ELL)
+    {
+        I              ell_width;
+        std::vector<I> hell_col;
+        std::vector<T> hell_val;
+        host_csr_to_ell(m,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        idxBase,
+                        ell_width,
+                        hell_col,
+                        hell_val);
+
+        int64_t size = std::max(int64_t(ell_width) * m, int64_t(1));
+
+        dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * size), device_free};
+        dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * size), device_free};
+
+        I* dell_col = (I*)dcol_managed.get();
+        T* dell_val = (T*)dval_managed.get();
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            dell_col, hell_col.data(), sizeof(I) * ell_width * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dell_val, hell_val.data(), sizeof(T) * ell_width * m, hipMemcpyHostToDevice));
+
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCreateEll(A, m, m, ell_width, dell_col, dell_val, typeI, idxBase, typeT));
+    }
+    else
+    {
+        dptr_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * (m + 1)), device_free};
+        dcol_managed = hipsparse_unique_ptr{device_malloc(sizeof(I) * std::max(nnz, I(1))),
+                                            device_free};
+        dval_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * std::max(nnz, I(1))),
+                                            device_free};
+
+        I* dptr = (I*)dptr_managed.get();
+        I* dcol = (I*)dcol_managed.get();
+        T* dval = (T*)dval_managed.get();
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dptr, hcsr_row_ptr.data(), sizeof(I) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(I) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+        CHECK_HIPSPARSE_ERROR(
+            hipsparseCreateCsr(A, m, m, nnz, dptr, dcol, dval, typeI, typeI, idxBase, typeT));
+    }
+
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(*A, HIPSPARSE_SPMAT_MATRIX_TYPE, &matrix_type, sizeof(matrix_type)));
+    CHECK_HIPSPARSE_ERROR(
+        hipsparseSpMatSetAttribute(*A, HIPSPARSE_SPMAT_FILL_MODE, &fill_mode, sizeof(fill_mode)));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmv_symmetric(Arguments argus)
+{
+    I                     m           = argus.M;
+    T                     h_alpha     = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                     h_beta      = make_DataType2<T>(argus.beta, argus.betai);
+    hipsparseOperation_t  transA      = argus.transA;
+    hipsparseFillMode_t   fill_mode   = argus.fill_mode;
+    hipsparseMatrixType_t matrix_type = argus.matrix_type;
+    hipsparseFormat_t     format      = argus.formatA;
+    hipsparseIndexBase_t  idxBase     = argus.baseA;
+    std::string           filename    = argus.filename;
+
+    // Data type
+    hipDataType typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    bool hermitian = (matrix_type == HIPSPARSE_MATRIX_TYPE_HERMITIAN);
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    CHECK_HIPSPARSE_ERROR(testing_symmetric_matrix(
+        filename, m, fill_mode, hermitian, idxBase, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    auto dptr_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto dcol_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto dval_managed = hipsparse_unique_ptr{nullptr, device_free};
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(testing_symmetric_create(m,
+                                                   hcsr_row_ptr,
+                                                   hcsr_col_ind,
+                                                   hcsr_val,
+                                                   format,
+                                                   matrix_type,
+                                                   fill_mode,
+                                                   idxBase,
+                                                   dptr_managed,
+                                                   dcol_managed,
+                                                   dval_managed,
+                                                   &A));
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(m);
+
+    hipsparseInit<T>(hx, 1, m);
+    hipsparseInit<T>(hy, 1, m);
+
+    std::vector<T> hy_gold = hy;
+
+    auto dx_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    hipsparseDnVecDescr_t x, y;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&x, m, dx, typeT));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnVec(&y, m, dy, typeT));
+
+    // SpMV
+    size_t bufferSize;
+    CHECK_HIPSPARSE_ERROR(hipsparseSetPointerMode(handle, HIPSPARSE_POINTER_MODE_HOST));
+
+    // rocSPARSE only multiplies symmetric CSR matrices without transposition, which a real
+    // symmetric matrix equals for all operations and a complex one except the conjugate transpose
+    bool complex   = (typeT == HIP_C_32F || typeT == HIP_C_64F);
+    bool supported = (format == HIPSPARSE_FORMAT_CSR
+                      && matrix_type == HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+                      && !(complex && transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE));
+    if(!supported)
+    {
+        hipsparseStatus_t status = hipsparseSpMV_bufferSize(handle,
+                                                            transA,
+                                                            &h_alpha,
+                                                            A,
+                                                            x,
+                                                            &h_beta,
+                                                            y,
+                                                            typeT,
+                                                            HIPSPARSE_SPMV_ALG_DEFAULT,
+                                                            &bufferSize);
+        verify_hipsparse_status_not_supported(status, "Error: product is not supported");
+
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+        CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_bufferSize(handle,
+                                                   transA,
+                                                   &h_alpha,
+                                                   A,
+                                                   x,
+                                                   &h_beta,
+                                                   y,
+                                                   typeT,
+                                                   HIPSPARSE_SPMV_ALG_DEFAULT,
+                                                   &bufferSize));
+
+    auto dbuffer_managed
+        = hipsparse_unique_ptr{device_malloc(std::max(bufferSize, size_t(4))), device_free};
+    void* dbuffer = dbuffer_managed.get();
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV_preprocess(handle,
+                                                   transA,
+                                                   &h_alpha,
+                                                   A,
+                                                   x,
+                                                   &h_beta,
+                                                   y,
+                                                   typeT,
+                                                   HIPSPARSE_SPMV_ALG_DEFAULT,
+                                                   dbuffer));
+
+    CHECK_HIPSPARSE_ERROR(hipsparseSpMV(handle,
+                                        transA,
+                                        &h_alpha,
+                                        A,
+                                        x,
+                                        &h_beta,
+                                        y,
+                                        typeT,
+                                        HIPSPARSE_SPMV_ALG_DEFAULT,
+                                        dbuffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    // Host SpMV on the expanded matrix
+    std::vector<I> hgen_row_ptr;
+    std::vector<I> hgen_col_ind;
+    std::vector<T> hgen_val;
+    host_csr_symmetric_to_general(m,
+                                  hcsr_row_ptr,
+                                  hcsr_col_ind,
+                                  hcsr_val,
+                                  idxBase,
+                                  fill_mode,
+                                  hermitian,
+                                  hgen_row_ptr,
+                                  hgen_col_ind,
+                                  hgen_val);
+
+    host_csrmv(transA,
+               m,
+               m,
+               hgen_row_ptr[m] - hgen_row_ptr[0],
+               h_alpha,
+               hgen_row_ptr.data(),
+               hgen_col_ind.data(),
+               hgen_val.data(),
+               hx.data(),
+               h_beta,
+               hy_gold.data(),
+               idxBase);
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(x));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnVec(y));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+template <typename I, typename T>
+hipsparseStatus_t testing_spmm_symmetric(Arguments argus)
+{
+    I                     m           = argus.M;
+    I                     n           = argus.N;
+    T                     h_alpha     = make_DataType2<T>(argus.alpha, argus.alphai);
+    T                     h_beta      = make_DataType2<T>(argus.beta, argus.betai);
+    hipsparseOperation_t  transA      = argus.transA;
+    hipsparseOperation_t  transB      = argus.transB;
+    hipsparseOrder_t      orderB      = argus.orderB;
+    hipsparseOrder_t      orderC      = argus.orderC;
+    hipsparseFillMode_t   fill_mode   = argus.fill_mode;
+    hipsparseMatrixType_t matrix_type = argus.matrix_type;
+    hipsparseFormat_t     format      = argus.formatA;
+    hipsparseIndexBase_t  idxBase     = argus.baseA;
+    std::string           filename    = argus.filename;
+
+    // Data type
+    hipDataType typeT = getDataType<T>();
+
+    // hipSPARSE handle
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    hipsparseHandle_t              handle = unique_ptr_handle->handle;
+
+    bool hermitian = (matrix_type == HIPSPARSE_MATRIX_TYPE_HERMITIAN);
+
+    // Host structures
+    std::vector<I> hcsr_row_ptr;
+    std::vector<I> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+
+    CHECK_HIPSPARSE_ERROR(testing_symmetric_matrix(
+        filename, m, fill_mode, hermitian, idxBase, hcsr_row_ptr, hcsr_col_ind, hcsr_val));
+
+    auto dptr_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto dcol_managed = hipsparse_unique_ptr{nullptr, device_free};
+    auto dval_managed = hipsparse_unique_ptr{nullptr, device_free};
+
+    hipsparseSpMatDescr_t A;
+    CHECK_HIPSPARSE_ERROR(testing_symmetric_create(m,
+                                                   hcsr_row_ptr,
+                                                   hcsr_col_ind,
+                                                   hcsr_val,
+                                                   format,
+                                                   matrix_type,
+                                                   fill_mode,
+                                                   idxBase,
+                                                   dptr_managed,
+                                                   dcol_managed,
+                                                   dval_managed,
+                                                   &A));
+
+    I B_m = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? m : n;
+    I B_n = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? n : m;
+
+    int64_t ldb = (orderB == HIPSPARSE_ORDER_COL) ? B_m : B_n;
+    int64_t ldc = (orderC == HIPSPARSE_ORDER_COL) ? m : n;
+
+    int64_t nnz_B = int64_t(B_m) * B_n;
+    int64_t nnz_C = int64_t(m) * n;
+
+    std::vector<T> hB(nnz_B);
+    std::vector<T> hC(nnz_C);
+
+    hipsparseInit<T>(hB, nnz_B, 1);
+    hipsparseInit<T>(hC, nnz_C, 1);
+
+    auto dB_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_B), device_free};
+    auto dC_managed = hipsparse_unique_ptr{device_malloc(sizeof(T) * nnz_C), device_free};
+
+    T* dB = (T*)dB_managed.get();
+    T* dC = (T*)dC_managed.get();
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+
+    hipsparseDnMatDescr_t B, C;
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&B, B_m, B_n, ldb, dB, typeT, orderB));
+    CHECK_HIPSPARSE_ERROR(hipsparseCreateDnMat(&C, m, n, ldc, dC, typeT, orderC));
+
+    // rocsparse_spmm only multiplies symmetric and Hermitian matrices as general matrices
+    size_t            bufferSize;
+    hipsparseStatus_t status = hipsparseSpMM_bufferSize(handle,
+                                                        transA,
+                                                        transB,
+                                                        &h_alpha,
+                                                        A,
+                                                        B,
+                                                        &h_beta,
+                                                        C,
+                                                        typeT,
+                                                        HIPSPARSE_SPMM_ALG_DEFAULT,
+                                                        &bufferSize);
+    verify_hipsparse_status_not_supported(status, "Error: A is symmetric or Hermitian");
+    status = hipsparseSpMM(handle,
+                           transA,
+                           transB,
+                           &h_alpha,
+                           A,
+                           B,
+                           &h_beta,
+                           C,
+                           typeT,
+                           HIPSPARSE_SPMM_ALG_DEFAULT,
+                           dB);
+    verify_hipsparse_status_not_supported(status, "Error: A is symmetric or Hermitian");
+
+    // Clean up
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroySpMat(A));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(B));
+    CHECK_HIPSPARSE_ERROR(hipsparseDestroyDnMat(C));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+#endif
+
+#endif // TESTING_SYMMETRIC_HPP
@@ -31,6 +31,7 @@
 #include <cstring>
 #include <hip/hip_runtime_api.h>
 #include <hipsparse/hipsparse.h>
+#include <limits>
 #include <math.h>
 #include <sstream>
 #include <stdio.h>
@@ -409,6 +410,146 @@ static inline double testing_real(hipDoubleComplex x)
     return hipCreal(x);
 }
 
+/* ============================================================================================ */
+/*! \brief semirings, see hipsparseSemiring_t. identity() is the identity of add, scale applies
+ *  alpha or beta and is ignored by all semirings but the arithmetic one. */
+struct host_semiring_plus_times
+{
+    template <typename T>
+    static T identity()
+    {
+        return make_DataType<T>(0.0);
+    }
+
+    template <typename T>
+    static T add(T a, T b)
+    {
+        return a + b;
+    }
+
+    template <typename T>
+    static T mul(T a, T b)
+    {
+        return testing_mult(a, b);
+    }
+
+    template <typename T>
+    static T scale(T alpha, T a)
+    {
+        return testing_mult(alpha, a);
+    }
+};
+
+struct host_semiring_min_plus
+{
+    template <typename T>
+    static T identity()
+    {
+        return std::numeric_limits<T>::infinity();
+    }
+
+    template <typename T>
+    static T add(T a, T b)
+    {
+        return std::min(a, b);
+    }
+
+    template <typename T>
+    static T mul(T a, T b)
+    {
+        return a + b;
+    }
+
+    template <typename T>
+    static T scale(T, T a)
+    {
+        return a;
+    }
+};
+
+struct host_semiring_max_plus
+{
+    template <typename T>
+    static T identity()
+    {
+        return -std::numeric_limits<T>::infinity();
+    }
+
+    template <typename T>
+    static T add(T a, T b)
+    {
+        return std::max(a, b);
+    }
+
+    template <typename T>
+    static T mul(T a, T b)
+    {
+        return a + b;
+    }
+
+    template <typename T>
+    static T scale(T, T a)
+    {
+        return a;
+    }
+};
+
+struct host_semiring_max_min
+{
+    template <typename T>
+    static T identity()
+    {
+        return -std::numeric_limits<T>::infinity();
+    }
+
+    template <typename T>
+    static T add(T a, T b)
+    {
+        return std::max(a, b);
+    }
+
+    template <typename T>
+    static T mul(T a, T b)
+    {
+        return std::min(a, b);
+    }
+
+    template <typename T>
+    static T scale(T, T a)
+    {
+        return a;
+    }
+};
+
+struct host_semiring_or_and
+{
+    template <typename T>
+    static T identity()
+    {
+        return static_cast<T>(0);
+    }
+
+    template <typename T>
+    static T add(T a, T b)
+    {
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+
+    template <typename T>
+    static T mul(T a, T b)
+    {
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+
+    template <typename T>
+    static T scale(T, T a)
+    {
+        return a;
+    }
+};
+
 /* ============================================================================================ */
 /* generate random number :*/
 
@@ -771,6 +912,9 @@ inline void scan<int64_t>(const char* line, int64_t* nrow, int64_t* ncol, int64_
     sscanf(line, "%ld %ld %ld", nrow, ncol, nnz);
 }
 
+/* ============================================================================================ */
+/*! \brief  Read matrix from mtx file in COO format. The triangle stored in a symmetric file is
+ *  mirrored unless expand_symmetric is false */
 template <typename I, typename T>
 int read_mtx_matrix(const char*          filename,
                     I&                   nrow,
@@ -779,7 +923,8 @@ int read_mtx_matrix(const char*          filename,
                     std::vector<I>&      row,
                     std::vector<I>&      col,
                     std::vector<T>&      val,
-                    hipsparseIndexBase_t idx_base)
+                    hipsparseIndexBase_t idx_base,
+                    bool                 expand_symmetric = true)
 {
     const char* env = getenv("GTEST_LISTENER");
     if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
@@ -859,7 +1004,7 @@ int read_mtx_matrix(const char*          filename,
     }
 
     // Symmetric flag
-    int symm = !strcmp(type, "symmetric");
+    int symm = !strcmp(type, "symmetric") && expand_symmetric;
 
     // Skip comments
     while(fgets(line, 1024, f))
@@ -2717,649 +2862,770 @@ inline void host_csrmv(hipsparseOperation_t trans,
     }
 }
 
-template <typename T>
-inline void host_bsrmm(int                     Mb,
-                       int                     N,
-                       int                     Kb,
-                       int                     block_dim,
-                       hipsparseDirection_t    dir,
-                       hipsparseOperation_t    transA,
-                       hipsparseOperation_t    transB,
-                       T                       alpha,
-                       const std::vector<int>& bsr_row_ptr_A,
-                       const std::vector<int>& bsr_col_ind_A,
-                       const std::vector<T>&   bsr_val_A,
-                       const std::vector<T>&   B,
-                       int                     ldb,
-                       T                       beta,
-                       std::vector<T>&         C,
-                       int                     ldc,
-                       hipsparseIndexBase_t    base)
+template <typename I, typename J, typename T>
+inline void host_csrmv_batched(hipsparseOperation_t trans,
+                               J                    M,
+                               J                    N,
+                               I                    nnz,
+                               T                    alpha,
+                               const I*             csr_row_ptr,
+                               const J*             csr_col_ind,
+                               const T*             csr_val,
+                               J                    batch_count_A,
+                               I                    offsets_batch_stride_A,
+                               I                    columns_values_batch_stride_A,
+                               const T*             x,
+                               J                    batch_count_x,
+                               int64_t              batch_stride_x,
+                               T                    beta,
+                               T*                   y,
+                               J                    batch_count_y,
+                               int64_t              batch_stride_y,
+                               hipsparseIndexBase_t base)
 {
-    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
-    {
-        return;
+    // y_i = A * x_i, y_i = A_i * x or y_i = A_i * x_i
+    for(J i = 0; i < batch_count_y; ++i)
+    {
+        J batch_A = (batch_count_A > 1) ? i : 0;
+        J batch_x = (batch_count_x > 1) ? i : 0;
+
+        host_csrmv(trans,
+                   M,
+                   N,
+                   nnz,
+                   alpha,
+                   csr_row_ptr + offsets_batch_stride_A * batch_A,
+                   csr_col_ind + columns_values_batch_stride_A * batch_A,
+                   csr_val + columns_values_batch_stride_A * batch_A,
+                   x + batch_stride_x * batch_x,
+                   beta,
+                   y + batch_stride_y * i,
+                   base);
     }
+}
 
-    if(transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && transB != HIPSPARSE_OPERATION_TRANSPOSE)
+template <typename I, typename J, typename T>
+inline T host_csrmv_dot(hipsparseOperation_t trans,
+                        J                    M,
+                        J                    N,
+                        I                    nnz,
+                        T                    alpha,
+                        const I*             csr_row_ptr,
+                        const J*             csr_col_ind,
+                        const T*             csr_val,
+                        const T*             x,
+                        T                    beta,
+                        T*                   y,
+                        const T*             z,
+                        hipsparseIndexBase_t base)
+{
+    host_csrmv(trans, M, N, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, base);
+
+    // result = conj(z)^T * y, z defaults to x
+    const T* w      = (z != nullptr) ? z : x;
+    J        size   = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+    T        result = make_DataType<T>(0);
+
+    for(J i = 0; i < size; ++i)
     {
-        return;
+        result = testing_fma(testing_conj(w[i]), y[i], result);
     }
 
-    int M = Mb * block_dim;
+    return result;
+}
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < M; i++)
+template <typename I, typename T>
+inline void host_coomv(hipsparseOperation_t trans,
+                       I                    M,
+                       I                    N,
+                       int64_t              nnz,
+                       T                    alpha,
+                       const I*             coo_row_ind,
+                       const I*             coo_col_ind,
+                       const T*             coo_val,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       hipsparseIndexBase_t base)
+{
+    I y_size = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+
+    for(I i = 0; i < y_size; ++i)
     {
-        int local_row = i % block_dim;
+        y[i] = testing_mult(beta, y[i]);
+    }
 
-        int row_begin = bsr_row_ptr_A[i / block_dim] - base;
-        int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        I row = coo_row_ind[i] - base;
+        I col = coo_col_ind[i] - base;
 
-        for(int j = 0; j < N; j++)
+        if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
         {
-            int idx_C = i + j * ldc;
-
-            T sum = make_DataType<T>(0.0);
+            y[row] = testing_fma(testing_mult(alpha, coo_val[i]), x[col], y[row]);
+        }
+        else
+        {
+            T val = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE) ? testing_conj(coo_val[i])
+                                                                       : coo_val[i];
 
-            for(int s = row_begin; s < row_end; s++)
-            {
-                for(int t = 0; t < block_dim; t++)
-                {
-                    int idx_A = (dir == HIPSPARSE_DIRECTION_ROW)
-                                    ? block_dim * block_dim * s + block_dim * local_row + t
-                                    : block_dim * block_dim * s + block_dim * t + local_row;
-                    int idx_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE)
-                                    ? j * ldb + block_dim * (bsr_col_ind_A[s] - base) + t
-                                    : (block_dim * (bsr_col_ind_A[s] - base) + t) * ldb + j;
+            y[col] = testing_fma(testing_mult(alpha, val), x[row], y[col]);
+        }
+    }
+}
 
-                    sum = sum + testing_mult(alpha, testing_mult(bsr_val_A[idx_A], B[idx_B]));
-                }
-            }
+// y_i = y_i (+) sum_j op(A)_ij (x) x_j over the semiring S
+template <typename S, typename I, typename T>
+inline void host_coomv_semiring(hipsparseOperation_t trans,
+                                int64_t              nnz,
+                                const I*             coo_row_ind,
+                                const I*             coo_col_ind,
+                                const T*             coo_val,
+                                const T*             x,
+                                T*                   y,
+                                hipsparseIndexBase_t base)
+{
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        I row = coo_row_ind[i] - base;
+        I col = coo_col_ind[i] - base;
 
-            if(beta == make_DataType<T>(0.0))
-            {
-                C[idx_C] = sum;
-            }
-            else
-            {
-                C[idx_C] = sum + testing_mult(beta, C[idx_C]);
-            }
+        if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            y[row] = S::add(y[row], S::mul(coo_val[i], x[col]));
+        }
+        else
+        {
+            y[col] = S::add(y[col], S::mul(coo_val[i], x[row]));
         }
     }
 }
 
-template <typename I, typename J, typename T>
-void host_csrmm(J                    M,
-                J                    N,
-                J                    K,
-                hipsparseOperation_t transA,
-                hipsparseOperation_t transB,
-                T                    alpha,
-                const I*             csr_row_ptr_A,
-                const J*             csr_col_ind_A,
-                const T*             csr_val_A,
-                const T*             B,
-                J                    ldb,
-                hipsparseOrder_t     orderB,
-                T                    beta,
-                T*                   C,
-                J                    ldc,
-                hipsparseOrder_t     orderC,
-                hipsparseIndexBase_t base,
-                bool                 force_conj_A)
+// Convert a CSR matrix into the SELL-C-sigma format. The rows are sorted by decreasing length
+// within windows of sigma rows and grouped into slices of C rows, each slice is stored column by
+// column and padded to its longest row with column index -1.
+template <typename I, typename T>
+inline void host_csr_to_sell(I                    M,
+                             const I*             csr_row_ptr,
+                             const I*             csr_col_ind,
+                             const T*             csr_val,
+                             hipsparseIndexBase_t base,
+                             I                    C,
+                             I                    sigma,
+                             std::vector<I>&      sell_slice_offsets,
+                             std::vector<I>&      sell_col_ind,
+                             std::vector<T>&      sell_val,
+                             std::vector<I>&      sell_row_perm)
 {
-    bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE || force_conj_A);
-    bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    I slices = (M + C - 1) / C;
 
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    std::vector<I> perm(M);
+    for(I i = 0; i < M; ++i)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(J i = 0; i < M; i++)
+        perm[i] = i;
+    }
+
+    for(I w = 0; w < M; w += sigma)
+    {
+        std::stable_sort(perm.begin() + w,
+                         perm.begin() + std::min(w + sigma, M),
+                         [&](I a, I b) {
+                             return csr_row_ptr[a + 1] - csr_row_ptr[a]
+                                    > csr_row_ptr[b + 1] - csr_row_ptr[b];
+                         });
+    }
+
+    sell_slice_offsets.resize(slices + 1);
+    sell_slice_offsets[0] = 0;
+
+    for(I s = 0; s < slices; ++s)
+    {
+        I width = 0;
+        for(I p = s * C; p < std::min((s + 1) * C, M); ++p)
         {
-            for(J j = 0; j < N; ++j)
-            {
-                I row_begin = csr_row_ptr_A[i] - base;
-                I row_end   = csr_row_ptr_A[i + 1] - base;
-                J idx_C     = orderC == HIPSPARSE_ORDER_COL ? i + j * ldc : i * ldc + j;
+            width = std::max(width, csr_row_ptr[perm[p] + 1] - csr_row_ptr[perm[p]]);
+        }
 
-                T sum = make_DataType<T>(0);
+        sell_slice_offsets[s + 1] = sell_slice_offsets[s] + C * width;
+    }
 
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    J idx_B = 0;
-                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                        && orderB == HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
-                           && orderB != HIPSPARSE_ORDER_COL))
-                    {
-                        idx_B = (csr_col_ind_A[k] - base + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + (csr_col_ind_A[k] - base) * ldb);
-                    }
+    sell_col_ind.assign(sell_slice_offsets[slices], -1);
+    sell_val.assign(sell_slice_offsets[slices], make_DataType2<T>(0.0, 0.0));
+    sell_row_perm.resize(M);
 
-                    sum = testing_fma(
-                        testing_conj(csr_val_A[k], conj_A), testing_conj(B[idx_B], conj_B), sum);
-                }
+    for(I p = 0; p < M; ++p)
+    {
+        I s   = p / C;
+        I row = perm[p];
 
-                if(beta == make_DataType<T>(0))
-                {
-                    C[idx_C] = testing_mult(alpha, sum);
-                }
-                else
-                {
-                    C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum));
-                }
-            }
+        sell_row_perm[p] = row + base;
+
+        for(I j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+        {
+            I idx = sell_slice_offsets[s] + (j - (csr_row_ptr[row] - base)) * C + p - s * C;
+
+            sell_col_ind[idx] = csr_col_ind[j];
+            sell_val[idx]     = csr_val[j];
         }
     }
-    else
+}
+
+// Convert a CSR matrix into the DIA format. Every occupied diagonal is stored with M entries in
+// increasing order of its offset, entry i of diagonal d holds A(i, i + offset[d]) or zero if the
+// position is outside of the matrix.
+template <typename I, typename T>
+inline void host_csr_to_dia(I                    M,
+                            I                    N,
+                            const I*             csr_row_ptr,
+                            const I*             csr_col_ind,
+                            const T*             csr_val,
+                            hipsparseIndexBase_t base,
+                            std::vector<I>&      dia_offsets,
+                            std::vector<T>&      dia_val)
+{
+    std::vector<I> diag(M + N, -1);
+
+    for(I i = 0; i < M; ++i)
     {
-        // scale C by beta
-        for(J i = 0; i < K; i++)
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
         {
-            for(J j = 0; j < N; ++j)
-            {
-                J idx_C  = (orderC == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
-                C[idx_C] = testing_mult(beta, C[idx_C]);
-            }
+            diag[csr_col_ind[j] - base - i + M] = 0;
         }
+    }
 
-        for(J i = 0; i < M; i++)
+    dia_offsets.clear();
+    for(I d = 0; d < M + N; ++d)
+    {
+        if(diag[d] == 0)
         {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
+            diag[d] = dia_offsets.size();
+            dia_offsets.push_back(d - M);
+        }
+    }
 
-            for(J j = 0; j < N; ++j)
+    dia_val.assign(dia_offsets.size() * M, make_DataType2<T>(0.0, 0.0));
+
+    for(I i = 0; i < M; ++i)
+    {
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            dia_val[diag[csr_col_ind[j] - base - i + M] * M + i] = csr_val[j];
+        }
+    }
+}
+
+// Keep the triangle of a square CSR matrix given by fill_mode, including the diagonal.
+template <typename I, typename T>
+inline void host_csr_triangle(I                     M,
+                              const std::vector<I>& csr_row_ptr,
+                              const std::vector<I>& csr_col_ind,
+                              const std::vector<T>& csr_val,
+                              hipsparseIndexBase_t  base,
+                              hipsparseFillMode_t   fill_mode,
+                              std::vector<I>&       tri_row_ptr,
+                              std::vector<I>&       tri_col_ind,
+                              std::vector<T>&       tri_val)
+{
+    tri_row_ptr.resize(M + 1);
+    tri_col_ind.clear();
+    tri_val.clear();
+
+    tri_row_ptr[0] = base;
+    for(I i = 0; i < M; ++i)
+    {
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            I col = csr_col_ind[j] - base;
+            if((fill_mode == HIPSPARSE_FILL_MODE_LOWER) ? (col <= i) : (col >= i))
             {
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    J col = csr_col_ind_A[k] - base;
-                    T val = testing_conj(csr_val_A[k], conj_A);
+                tri_col_ind.push_back(csr_col_ind[j]);
+                tri_val.push_back(csr_val[j]);
+            }
+        }
 
-                    J idx_B = 0;
+        tri_row_ptr[i + 1] = static_cast<I>(tri_col_ind.size()) + base;
+    }
+}
 
-                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                        && orderB == HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
-                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
-                           && orderB != HIPSPARSE_ORDER_COL))
-                    {
-                        idx_B = (i + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + i * ldb);
-                    }
+// Expand a symmetric or Hermitian CSR matrix that stores the triangle given by fill_mode into a
+// general CSR matrix. Entries of the other triangle are ignored, entries off the diagonal are
+// mirrored, and conjugated if the matrix is Hermitian.
+template <typename I, typename T>
+inline void host_csr_symmetric_to_general(I                     M,
+                                          const std::vector<I>& csr_row_ptr,
+                                          const std::vector<I>& csr_col_ind,
+                                          const std::vector<T>& csr_val,
+                                          hipsparseIndexBase_t  base,
+                                          hipsparseFillMode_t   fill_mode,
+                                          bool                  hermitian,
+                                          std::vector<I>&       gen_row_ptr,
+                                          std::vector<I>&       gen_col_ind,
+                                          std::vector<T>&       gen_val)
+{
+    std::vector<I> coo_row_ind;
+    std::vector<I> coo_col_ind;
+    std::vector<T> coo_val;
 
-                    J idx_C = (orderC == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
+    for(I i = 0; i < M; ++i)
+    {
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            I col = csr_col_ind[j] - base;
+            if((fill_mode == HIPSPARSE_FILL_MODE_LOWER) ? (col > i) : (col < i))
+            {
+                continue;
+            }
 
-                    C[idx_C]
-                        = C[idx_C]
-                          + testing_mult(alpha, testing_mult(val, testing_conj(B[idx_B], conj_B)));
-                }
+            coo_row_ind.push_back(i);
+            coo_col_ind.push_back(col);
+            coo_val.push_back(csr_val[j]);
+
+            if(col != i)
+            {
+                coo_row_ind.push_back(col);
+                coo_col_ind.push_back(i);
+                coo_val.push_back(hermitian ? testing_conj(csr_val[j]) : csr_val[j]);
             }
         }
     }
+
+    size_t nnz = coo_val.size();
+
+    std::vector<size_t> perm(nnz);
+    for(size_t k = 0; k < nnz; ++k)
+    {
+        perm[k] = k;
+    }
+
+    std::sort(perm.begin(), perm.end(), [&](size_t a, size_t b) {
+        return (coo_row_ind[a] != coo_row_ind[b]) ? (coo_row_ind[a] < coo_row_ind[b])
+                                                  : (coo_col_ind[a] < coo_col_ind[b]);
+    });
+
+    gen_row_ptr.assign(M + 1, 0);
+    gen_col_ind.resize(nnz);
+    gen_val.resize(nnz);
+
+    for(size_t k = 0; k < nnz; ++k)
+    {
+        ++gen_row_ptr[coo_row_ind[perm[k]] + 1];
+        gen_col_ind[k] = coo_col_ind[perm[k]] + base;
+        gen_val[k]     = coo_val[perm[k]];
+    }
+
+    gen_row_ptr[0] = base;
+    for(I i = 0; i < M; ++i)
+    {
+        gen_row_ptr[i + 1] += gen_row_ptr[i];
+    }
 }
 
-template <typename T, typename I, typename J>
-void host_csrmm_batched(J                    M,
-                        J                    N,
-                        J                    K,
-                        J                    batch_count_A,
-                        J                    offsets_batch_stride_A,
-                        I                    columns_values_batch_stride_A,
-                        hipsparseOperation_t transA,
-                        hipsparseOperation_t transB,
-                        T                    alpha,
-                        const I*             csr_row_ptr_A,
-                        const J*             csr_col_ind_A,
-                        const T*             csr_val_A,
-                        const T*             B,
-                        J                    ldb,
-                        J                    batch_count_B,
-                        I                    batch_stride_B,
-                        hipsparseOrder_t     order_B,
-                        T                    beta,
-                        T*                   C,
-                        J                    ldc,
-                        J                    batch_count_C,
-                        I                    batch_stride_C,
-                        hipsparseOrder_t     order_C,
-                        hipsparseIndexBase_t base,
-                        bool                 force_conj_A)
+// Convert a CSR matrix into the ELL format. Each row is padded to the longest row with column
+// index -1 and the entries are stored column by column, i.e. entry k of row i is at k * M + i.
+template <typename I, typename T>
+inline void host_csr_to_ell(I                    M,
+                            const I*             csr_row_ptr,
+                            const I*             csr_col_ind,
+                            const T*             csr_val,
+                            hipsparseIndexBase_t base,
+                            I&                   ell_width,
+                            std::vector<I>&      ell_col_ind,
+                            std::vector<T>&      ell_val)
 {
-    bool Ci_A_Bi  = (batch_count_A == 1 && batch_count_B == batch_count_C);
-    bool Ci_Ai_B  = (batch_count_B == 1 && batch_count_A == batch_count_C);
-    bool Ci_Ai_Bi = (batch_count_A == batch_count_C && batch_count_A == batch_count_B);
-
-    if(!Ci_A_Bi && !Ci_Ai_B && !Ci_Ai_Bi)
+    ell_width = 0;
+    for(I i = 0; i < M; ++i)
     {
-        return;
+        ell_width = std::max(ell_width, csr_row_ptr[i + 1] - csr_row_ptr[i]);
     }
 
-    if(Ci_A_Bi)
+    ell_col_ind.assign(int64_t(ell_width) * M, -1);
+    ell_val.assign(int64_t(ell_width) * M, make_DataType2<T>(0.0, 0.0));
+
+    for(I i = 0; i < M; ++i)
     {
-        for(J i = 0; i < batch_count_C; i++)
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
         {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A,
-                       csr_col_ind_A,
-                       csr_val_A,
-                       B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
+            I idx = (j - (csr_row_ptr[i] - base)) * M + i;
+
+            ell_col_ind[idx] = csr_col_ind[j];
+            ell_val[idx]     = csr_val[j];
         }
     }
-    else if(Ci_Ai_B)
+}
+
+template <typename I, typename T>
+inline void host_ellmv(hipsparseOperation_t trans,
+                       I                    M,
+                       I                    N,
+                       I                    ell_width,
+                       const I*             ell_col_ind,
+                       const T*             ell_val,
+                       T                    alpha,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       hipsparseIndexBase_t base)
+{
+    I y_size = (trans == HIPSPARSE_OPERATION_NON_TRANSPOSE) ? M : N;
+
+    for(I i = 0; i < y_size; ++i)
     {
-        for(J i = 0; i < batch_count_C; i++)
-        {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       B,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
-        }
+        y[i] = testing_mult(beta, y[i]);
     }
-    else if(Ci_Ai_Bi)
+
+    for(I i = 0; i < M; ++i)
     {
-        for(J i = 0; i < batch_count_C; i++)
+        for(I k = 0; k < ell_width; ++k)
         {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
+            I idx = k * M + i;
+
+            if(ell_col_ind[idx] == -1)
+            {
+                continue;
+            }
+
+            I col = ell_col_ind[idx] - base;
+
+            if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+            {
+                y[i] = testing_fma(testing_mult(alpha, ell_val[idx]), x[col], y[i]);
+            }
+            else
+            {
+                T val = (trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+                            ? testing_conj(ell_val[idx])
+                            : ell_val[idx];
+
+                y[col] = testing_fma(testing_mult(alpha, val), x[i], y[col]);
+            }
         }
     }
 }
 
-template <typename T, typename I, typename J>
-void host_cscmm(J                    M,
-                J                    N,
-                J                    K,
-                hipsparseOperation_t transA,
-                hipsparseOperation_t transB,
-                T                    alpha,
-                const I*             csc_col_ptr_A,
-                const J*             csc_row_ind_A,
-                const T*             csc_val_A,
-                const T*             B,
-                J                    ldb,
-                hipsparseOrder_t     order_B,
-                T                    beta,
-                T*                   C,
-                J                    ldc,
-                hipsparseOrder_t     order_C,
-                hipsparseIndexBase_t base)
+// Convert a CSR matrix into the Blocked-ELL format with square blocks of size block_dim. Each block
+// row stores its non-zero blocks sorted by block column and is padded to the longest block row
+// with block column index -1. Blocks are stored column by column and ell_cols is the number of
+// columns of the Blocked-ELL structure, i.e. block_dim times the number of blocks per block row.
+template <typename I, typename T>
+inline void host_csr_to_bell(I                    M,
+                             I                    block_dim,
+                             const I*             csr_row_ptr,
+                             const I*             csr_col_ind,
+                             const T*             csr_val,
+                             hipsparseIndexBase_t base,
+                             I&                   ell_cols,
+                             std::vector<I>&      ell_col_ind,
+                             std::vector<T>&      ell_val)
 {
-    switch(transA)
-    {
-    case HIPSPARSE_OPERATION_NON_TRANSPOSE:
+    I mb = (M + block_dim - 1) / block_dim;
+
+    std::vector<std::vector<I>> blocks(mb);
+    for(I i = 0; i < M; ++i)
     {
-        return host_csrmm(K,
-                          N,
-                          M,
-                          HIPSPARSE_OPERATION_TRANSPOSE,
-                          transB,
-                          alpha,
-                          csc_col_ptr_A,
-                          csc_row_ind_A,
-                          csc_val_A,
-                          B,
-                          ldb,
-                          order_B,
-                          beta,
-                          C,
-                          ldc,
-                          order_C,
-                          base,
-                          false);
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            blocks[i / block_dim].push_back((csr_col_ind[j] - base) / block_dim);
+        }
     }
-    case HIPSPARSE_OPERATION_TRANSPOSE:
+
+    I ell_blocks = 0;
+    for(I bi = 0; bi < mb; ++bi)
     {
-        return host_csrmm(K,
-                          N,
-                          M,
-                          HIPSPARSE_OPERATION_NON_TRANSPOSE,
-                          transB,
-                          alpha,
-                          csc_col_ptr_A,
-                          csc_row_ind_A,
-                          csc_val_A,
-                          B,
-                          ldb,
-                          order_B,
-                          beta,
-                          C,
-                          ldc,
-                          order_C,
-                          base,
-                          false);
+        std::sort(blocks[bi].begin(), blocks[bi].end());
+        blocks[bi].erase(std::unique(blocks[bi].begin(), blocks[bi].end()), blocks[bi].end());
+        ell_blocks = std::max(ell_blocks, static_cast<I>(blocks[bi].size()));
     }
-    case HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE:
+
+    ell_cols = ell_blocks * block_dim;
+
+    ell_col_ind.assign(int64_t(mb) * ell_blocks, -1);
+    ell_val.assign(int64_t(mb) * ell_cols * block_dim, make_DataType2<T>(0.0, 0.0));
+
+    for(I bi = 0; bi < mb; ++bi)
     {
-        return host_csrmm(K,
-                          N,
-                          M,
-                          HIPSPARSE_OPERATION_NON_TRANSPOSE,
-                          transB,
-                          alpha,
-                          csc_col_ptr_A,
-                          csc_row_ind_A,
-                          csc_val_A,
-                          B,
-                          ldb,
-                          order_B,
-                          beta,
-                          C,
-                          ldc,
-                          order_C,
-                          base,
-                          true);
+        for(size_t k = 0; k < blocks[bi].size(); ++k)
+        {
+            ell_col_ind[bi * ell_blocks + k] = blocks[bi][k] + base;
+        }
     }
+
+    for(I i = 0; i < M; ++i)
+    {
+        I bi = i / block_dim;
+
+        for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            I col = csr_col_ind[j] - base;
+            I k   = std::lower_bound(blocks[bi].begin(), blocks[bi].end(), col / block_dim)
+                  - blocks[bi].begin();
+
+            ell_val[((bi * ell_blocks + k) * block_dim + col % block_dim) * block_dim
+                    + i % block_dim]
+                = csr_val[j];
+        }
     }
 }
 
-template <typename T, typename I, typename J>
-void host_cscmm_batched(J                    M,
-                        J                    N,
-                        J                    K,
-                        J                    batch_count_A,
-                        I                    offsets_batch_stride_A,
-                        I                    rows_values_batch_stride_A,
-                        hipsparseOperation_t transA,
-                        hipsparseOperation_t transB,
-                        T                    alpha,
-                        const I*             csc_col_ptr_A,
-                        const J*             csc_row_ind_A,
-                        const T*             csc_val_A,
-                        const T*             B,
-                        J                    ldb,
-                        J                    batch_count_B,
-                        I                    batch_stride_B,
-                        hipsparseOrder_t     order_B,
-                        T                    beta,
-                        T*                   C,
-                        J                    ldc,
-                        J                    batch_count_C,
-                        I                    batch_stride_C,
-                        hipsparseOrder_t     order_C,
-                        hipsparseIndexBase_t base)
+template <typename I, typename T>
+inline void host_coomv_batched(hipsparseOperation_t trans,
+                               I                    M,
+                               I                    N,
+                               int64_t              nnz,
+                               T                    alpha,
+                               const I*             coo_row_ind,
+                               const I*             coo_col_ind,
+                               const T*             coo_val,
+                               I                    batch_count_A,
+                               int64_t              batch_stride_A,
+                               const T*             x,
+                               I                    batch_count_x,
+                               int64_t              batch_stride_x,
+                               T                    beta,
+                               T*                   y,
+                               I                    batch_count_y,
+                               int64_t              batch_stride_y,
+                               hipsparseIndexBase_t base)
 {
-    switch(transA)
-    {
-    case HIPSPARSE_OPERATION_NON_TRANSPOSE:
-    {
-        return host_csrmm_batched(K,
-                                  N,
-                                  M,
-                                  batch_count_A,
-                                  offsets_batch_stride_A,
-                                  rows_values_batch_stride_A,
-                                  HIPSPARSE_OPERATION_TRANSPOSE,
-                                  transB,
-                                  alpha,
-                                  csc_col_ptr_A,
-                                  csc_row_ind_A,
-                                  csc_val_A,
-                                  B,
-                                  ldb,
-                                  batch_count_B,
-                                  batch_stride_B,
-                                  order_B,
-                                  beta,
-                                  C,
-                                  ldc,
-                                  batch_count_C,
-                                  batch_stride_C,
-                                  order_C,
-                                  base,
-                                  false);
+    // y_i = A * x_i, y_i = A_i * x or y_i = A_i * x_i
+    for(I i = 0; i < batch_count_y; ++i)
+    {
+        I batch_A = (batch_count_A > 1) ? i : 0;
+        I batch_x = (batch_count_x > 1) ? i : 0;
+
+        host_coomv(trans,
+                   M,
+                   N,
+                   nnz,
+                   alpha,
+                   coo_row_ind + batch_stride_A * batch_A,
+                   coo_col_ind + batch_stride_A * batch_A,
+                   coo_val + batch_stride_A * batch_A,
+                   x + batch_stride_x * batch_x,
+                   beta,
+                   y + batch_stride_y * i,
+                   base);
     }
-    case HIPSPARSE_OPERATION_TRANSPOSE:
+}
+
+template <typename T>
+inline void host_bsrmm(int                     Mb,
+                       int                     N,
+                       int                     Kb,
+                       int                     block_dim,
+                       hipsparseDirection_t    dir,
+                       hipsparseOperation_t    transA,
+                       hipsparseOperation_t    transB,
+                       T                       alpha,
+                       const std::vector<int>& bsr_row_ptr_A,
+                       const std::vector<int>& bsr_col_ind_A,
+                       const std::vector<T>&   bsr_val_A,
+                       const std::vector<T>&   B,
+                       int                     ldb,
+                       T                       beta,
+                       std::vector<T>&         C,
+                       int                     ldc,
+                       hipsparseIndexBase_t    base)
+{
+    if(transA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        return host_csrmm_batched(K,
-                                  N,
-                                  M,
-                                  batch_count_A,
-                                  offsets_batch_stride_A,
-                                  rows_values_batch_stride_A,
-                                  HIPSPARSE_OPERATION_NON_TRANSPOSE,
-                                  transB,
-                                  alpha,
-                                  csc_col_ptr_A,
-                                  csc_row_ind_A,
-                                  csc_val_A,
-                                  B,
-                                  ldb,
-                                  batch_count_B,
-                                  batch_stride_B,
-                                  order_B,
-                                  beta,
-                                  C,
-                                  ldc,
-                                  batch_count_C,
-                                  batch_stride_C,
-                                  order_C,
-                                  base,
-                                  false);
+        return;
     }
-    case HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE:
+
+    if(transB != HIPSPARSE_OPERATION_NON_TRANSPOSE && transB != HIPSPARSE_OPERATION_TRANSPOSE)
     {
-        return host_csrmm_batched(K,
-                                  N,
-                                  M,
-                                  batch_count_A,
-                                  offsets_batch_stride_A,
-                                  rows_values_batch_stride_A,
-                                  HIPSPARSE_OPERATION_NON_TRANSPOSE,
-                                  transB,
-                                  alpha,
-                                  csc_col_ptr_A,
-                                  csc_row_ind_A,
-                                  csc_val_A,
-                                  B,
-                                  ldb,
-                                  batch_count_B,
-                                  batch_stride_B,
-                                  order_B,
-                                  beta,
-                                  C,
-                                  ldc,
-                                  batch_count_C,
-                                  batch_stride_C,
-                                  order_C,
-                                  base,
-                                  true);
+        return;
     }
+
+    int M = Mb * block_dim;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < M; i++)
+    {
+        int local_row = i % block_dim;
+
+        int row_begin = bsr_row_ptr_A[i / block_dim] - base;
+        int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
+
+        for(int j = 0; j < N; j++)
+        {
+            int idx_C = i + j * ldc;
+
+            T sum = make_DataType<T>(0.0);
+
+            for(int s = row_begin; s < row_end; s++)
+            {
+                for(int t = 0; t < block_dim; t++)
+                {
+                    int idx_A = (dir == HIPSPARSE_DIRECTION_ROW)
+                                    ? block_dim * block_dim * s + block_dim * local_row + t
+                                    : block_dim * block_dim * s + block_dim * t + local_row;
+                    int idx_B = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+                                    ? j * ldb + block_dim * (bsr_col_ind_A[s] - base) + t
+                                    : (block_dim * (bsr_col_ind_A[s] - base) + t) * ldb + j;
+
+                    sum = sum + testing_mult(alpha, testing_mult(bsr_val_A[idx_A], B[idx_B]));
+                }
+            }
+
+            if(beta == make_DataType<T>(0.0))
+            {
+                C[idx_C] = sum;
+            }
+            else
+            {
+                C[idx_C] = sum + testing_mult(beta, C[idx_C]);
+            }
+        }
     }
 }
 
-template <typename T, typename I>
-void host_coomm(I                    M,
-                I                    N,
-                I                    K,
-                I                    nnz,
+template <typename I, typename J, typename T>
+void host_csrmm(J                    M,
+                J                    N,
+                J                    K,
                 hipsparseOperation_t transA,
                 hipsparseOperation_t transB,
                 T                    alpha,
-                const I*             coo_row_ind_A,
-                const I*             coo_col_ind_A,
-                const T*             coo_val_A,
+                const I*             csr_row_ptr_A,
+                const J*             csr_col_ind_A,
+                const T*             csr_val_A,
                 const T*             B,
-                I                    ldb,
-                hipsparseOrder_t     order_B,
+                J                    ldb,
+                hipsparseOrder_t     orderB,
                 T                    beta,
                 T*                   C,
-                I                    ldc,
-                hipsparseOrder_t     order_C,
-                hipsparseIndexBase_t base)
+                J                    ldc,
+                hipsparseOrder_t     orderC,
+                hipsparseIndexBase_t base,
+                bool                 force_conj_A)
 {
-    bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE || force_conj_A);
     bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
 
     if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        for(I j = 0; j < N; j++)
-        {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-            for(I i = 0; i < M; ++i)
+        for(J i = 0; i < M; i++)
+        {
+            for(J j = 0; j < N; ++j)
             {
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
+                I row_begin = csr_row_ptr_A[i] - base;
+                I row_end   = csr_row_ptr_A[i + 1] - base;
+                J idx_C     = orderC == HIPSPARSE_ORDER_COL ? i + j * ldc : i * ldc + j;
 
-                C[idx_C] = testing_mult(beta, C[idx_C]);
-            }
-        }
+                T sum = make_DataType<T>(0);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I j = 0; j < N; j++)
-        {
-            for(I i = 0; i < nnz; ++i)
-            {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = testing_mult(alpha, coo_val_A[i]);
+                for(I k = row_begin; k < row_end; ++k)
+                {
+                    J idx_B = 0;
+                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
+                        && orderB == HIPSPARSE_ORDER_COL)
+                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
+                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
+                           && orderB != HIPSPARSE_ORDER_COL))
+                    {
+                        idx_B = (csr_col_ind_A[k] - base + j * ldb);
+                    }
+                    else
+                    {
+                        idx_B = (j + (csr_col_ind_A[k] - base) * ldb);
+                    }
 
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? row + j * ldc : row * ldc + j;
+                    sum = testing_fma(
+                        testing_conj(csr_val_A[k], conj_A), testing_conj(B[idx_B], conj_B), sum);
+                }
 
-                I idx_B = 0;
-                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
-                       && order_B != HIPSPARSE_ORDER_COL))
+                if(beta == make_DataType<T>(0))
                 {
-                    idx_B = (col + j * ldb);
+                    C[idx_C] = testing_mult(alpha, sum);
                 }
                 else
                 {
-                    idx_B = (j + col * ldb);
+                    C[idx_C] = testing_fma(beta, C[idx_C], testing_mult(alpha, sum));
                 }
-
-                C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
             }
         }
     }
     else
     {
-        for(I j = 0; j < N; j++)
+        // scale C by beta
+        for(J i = 0; i < K; i++)
         {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-            for(I i = 0; i < K; ++i)
+            for(J j = 0; j < N; ++j)
             {
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
-
+                J idx_C  = (orderC == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
                 C[idx_C] = testing_mult(beta, C[idx_C]);
             }
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I j = 0; j < N; j++)
+        for(J i = 0; i < M; i++)
         {
-            for(I i = 0; i < nnz; ++i)
+            I row_begin = csr_row_ptr_A[i] - base;
+            I row_end   = csr_row_ptr_A[i + 1] - base;
+
+            for(J j = 0; j < N; ++j)
             {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = testing_mult(alpha, testing_conj(coo_val_A[i], conj_A));
+                for(I k = row_begin; k < row_end; ++k)
+                {
+                    J col = csr_col_ind_A[k] - base;
+                    T val = testing_conj(csr_val_A[k], conj_A);
 
-                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
+                    J idx_B = 0;
 
-                I idx_B = 0;
-                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
-                       && order_B != HIPSPARSE_ORDER_COL))
-                {
-                    idx_B = (row + j * ldb);
-                }
-                else
-                {
-                    idx_B = (j + row * ldb);
-                }
+                    if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
+                        && orderB == HIPSPARSE_ORDER_COL)
+                       || (transB == HIPSPARSE_OPERATION_TRANSPOSE && orderB != HIPSPARSE_ORDER_COL)
+                       || (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE
+                           && orderB != HIPSPARSE_ORDER_COL))
+                    {
+                        idx_B = (i + j * ldb);
+                    }
+                    else
+                    {
+                        idx_B = (j + i * ldb);
+                    }
 
-                C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
+                    J idx_C = (orderC == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
+
+                    C[idx_C]
+                        = C[idx_C]
+                          + testing_mult(alpha, testing_mult(val, testing_conj(B[idx_B], conj_B)));
+                }
             }
         }
     }
 }
 
-template <typename T, typename I>
-void host_coomm_batched(I                    M,
-                        I                    N,
-                        I                    K,
-                        I                    nnz,
-                        I                    batch_count_A,
-                        I                    batch_stride_A,
+template <typename T, typename I, typename J>
+void host_csrmm_batched(J                    M,
+                        J                    N,
+                        J                    K,
+                        J                    batch_count_A,
+                        J                    offsets_batch_stride_A,
+                        I                    columns_values_batch_stride_A,
                         hipsparseOperation_t transA,
                         hipsparseOperation_t transB,
                         T                    alpha,
-                        const I*             coo_row_ind_A,
-                        const I*             coo_col_ind_A,
-                        const T*             coo_val_A,
+                        const I*             csr_row_ptr_A,
+                        const J*             csr_col_ind_A,
+                        const T*             csr_val_A,
                         const T*             B,
-                        I                    ldb,
-                        I                    batch_count_B,
+                        J                    ldb,
+                        J                    batch_count_B,
                         I                    batch_stride_B,
                         hipsparseOrder_t     order_B,
                         T                    beta,
                         T*                   C,
-                        I                    ldc,
-                        I                    batch_count_C,
+                        J                    ldc,
+                        J                    batch_count_C,
                         I                    batch_stride_C,
                         hipsparseOrder_t     order_C,
-                        hipsparseIndexBase_t base)
+                        hipsparseIndexBase_t base,
+                        bool                 force_conj_A)
 {
     bool Ci_A_Bi  = (batch_count_A == 1 && batch_count_B == batch_count_C);
     bool Ci_Ai_B  = (batch_count_B == 1 && batch_count_A == batch_count_C);
@@ -3372,18 +3638,17 @@ void host_coomm_batched(I                    M,
 
     if(Ci_A_Bi)
     {
-        for(I i = 0; i < batch_count_C; i++)
+        for(J i = 0; i < batch_count_C; i++)
         {
-            host_coomm(M,
+            host_csrmm(M,
                        N,
                        K,
-                       nnz,
                        transA,
                        transB,
                        alpha,
-                       coo_row_ind_A,
-                       coo_col_ind_A,
-                       coo_val_A,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
                        B + batch_stride_B * i,
                        ldb,
                        order_B,
@@ -3391,23 +3656,23 @@ void host_coomm_batched(I                    M,
                        C + batch_stride_C * i,
                        ldc,
                        order_C,
-                       base);
+                       base,
+                       force_conj_A);
         }
     }
     else if(Ci_Ai_B)
     {
-        for(I i = 0; i < batch_count_C; i++)
+        for(J i = 0; i < batch_count_C; i++)
         {
-            host_coomm(M,
+            host_csrmm(M,
                        N,
                        K,
-                       nnz,
                        transA,
                        transB,
                        alpha,
-                       coo_row_ind_A + batch_stride_A * i,
-                       coo_col_ind_A + batch_stride_A * i,
-                       coo_val_A + batch_stride_A * i,
+                       csr_row_ptr_A + offsets_batch_stride_A * i,
+                       csr_col_ind_A + columns_values_batch_stride_A * i,
+                       csr_val_A + columns_values_batch_stride_A * i,
                        B,
                        ldb,
                        order_B,
@@ -3415,1441 +3680,3161 @@ void host_coomm_batched(I                    M,
                        C + batch_stride_C * i,
                        ldc,
                        order_C,
-                       base);
+                       base,
+                       force_conj_A);
+        }
+    }
+    else if(Ci_Ai_Bi)
+    {
+        for(J i = 0; i < batch_count_C; i++)
+        {
+            host_csrmm(M,
+                       N,
+                       K,
+                       transA,
+                       transB,
+                       alpha,
+                       csr_row_ptr_A + offsets_batch_stride_A * i,
+                       csr_col_ind_A + columns_values_batch_stride_A * i,
+                       csr_val_A + columns_values_batch_stride_A * i,
+                       B + batch_stride_B * i,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base,
+                       force_conj_A);
+        }
+    }
+}
+
+template <typename T, typename I, typename J>
+void host_cscmm(J                    M,
+                J                    N,
+                J                    K,
+                hipsparseOperation_t transA,
+                hipsparseOperation_t transB,
+                T                    alpha,
+                const I*             csc_col_ptr_A,
+                const J*             csc_row_ind_A,
+                const T*             csc_val_A,
+                const T*             B,
+                J                    ldb,
+                hipsparseOrder_t     order_B,
+                T                    beta,
+                T*                   C,
+                J                    ldc,
+                hipsparseOrder_t     order_C,
+                hipsparseIndexBase_t base)
+{
+    switch(transA)
+    {
+    case HIPSPARSE_OPERATION_NON_TRANSPOSE:
+    {
+        return host_csrmm(K,
+                          N,
+                          M,
+                          HIPSPARSE_OPERATION_TRANSPOSE,
+                          transB,
+                          alpha,
+                          csc_col_ptr_A,
+                          csc_row_ind_A,
+                          csc_val_A,
+                          B,
+                          ldb,
+                          order_B,
+                          beta,
+                          C,
+                          ldc,
+                          order_C,
+                          base,
+                          false);
+    }
+    case HIPSPARSE_OPERATION_TRANSPOSE:
+    {
+        return host_csrmm(K,
+                          N,
+                          M,
+                          HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                          transB,
+                          alpha,
+                          csc_col_ptr_A,
+                          csc_row_ind_A,
+                          csc_val_A,
+                          B,
+                          ldb,
+                          order_B,
+                          beta,
+                          C,
+                          ldc,
+                          order_C,
+                          base,
+                          false);
+    }
+    case HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE:
+    {
+        return host_csrmm(K,
+                          N,
+                          M,
+                          HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                          transB,
+                          alpha,
+                          csc_col_ptr_A,
+                          csc_row_ind_A,
+                          csc_val_A,
+                          B,
+                          ldb,
+                          order_B,
+                          beta,
+                          C,
+                          ldc,
+                          order_C,
+                          base,
+                          true);
+    }
+    }
+}
+
+template <typename T, typename I, typename J>
+void host_cscmm_batched(J                    M,
+                        J                    N,
+                        J                    K,
+                        J                    batch_count_A,
+                        I                    offsets_batch_stride_A,
+                        I                    rows_values_batch_stride_A,
+                        hipsparseOperation_t transA,
+                        hipsparseOperation_t transB,
+                        T                    alpha,
+                        const I*             csc_col_ptr_A,
+                        const J*             csc_row_ind_A,
+                        const T*             csc_val_A,
+                        const T*             B,
+                        J                    ldb,
+                        J                    batch_count_B,
+                        I                    batch_stride_B,
+                        hipsparseOrder_t     order_B,
+                        T                    beta,
+                        T*                   C,
+                        J                    ldc,
+                        J                    batch_count_C,
+                        I                    batch_stride_C,
+                        hipsparseOrder_t     order_C,
+                        hipsparseIndexBase_t base)
+{
+    switch(transA)
+    {
+    case HIPSPARSE_OPERATION_NON_TRANSPOSE:
+    {
+        return host_csrmm_batched(K,
+                                  N,
+                                  M,
+                                  batch_count_A,
+                                  offsets_batch_stride_A,
+                                  rows_values_batch_stride_A,
+                                  HIPSPARSE_OPERATION_TRANSPOSE,
+                                  transB,
+                                  alpha,
+                                  csc_col_ptr_A,
+                                  csc_row_ind_A,
+                                  csc_val_A,
+                                  B,
+                                  ldb,
+                                  batch_count_B,
+                                  batch_stride_B,
+                                  order_B,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  batch_count_C,
+                                  batch_stride_C,
+                                  order_C,
+                                  base,
+                                  false);
+    }
+    case HIPSPARSE_OPERATION_TRANSPOSE:
+    {
+        return host_csrmm_batched(K,
+                                  N,
+                                  M,
+                                  batch_count_A,
+                                  offsets_batch_stride_A,
+                                  rows_values_batch_stride_A,
+                                  HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                  transB,
+                                  alpha,
+                                  csc_col_ptr_A,
+                                  csc_row_ind_A,
+                                  csc_val_A,
+                                  B,
+                                  ldb,
+                                  batch_count_B,
+                                  batch_stride_B,
+                                  order_B,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  batch_count_C,
+                                  batch_stride_C,
+                                  order_C,
+                                  base,
+                                  false);
+    }
+    case HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE:
+    {
+        return host_csrmm_batched(K,
+                                  N,
+                                  M,
+                                  batch_count_A,
+                                  offsets_batch_stride_A,
+                                  rows_values_batch_stride_A,
+                                  HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                  transB,
+                                  alpha,
+                                  csc_col_ptr_A,
+                                  csc_row_ind_A,
+                                  csc_val_A,
+                                  B,
+                                  ldb,
+                                  batch_count_B,
+                                  batch_stride_B,
+                                  order_B,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  batch_count_C,
+                                  batch_stride_C,
+                                  order_C,
+                                  base,
+                                  true);
+    }
+    }
+}
+
+template <typename T, typename I>
+void host_coomm(I                    M,
+                I                    N,
+                I                    K,
+                I                    nnz,
+                hipsparseOperation_t transA,
+                hipsparseOperation_t transB,
+                T                    alpha,
+                const I*             coo_row_ind_A,
+                const I*             coo_col_ind_A,
+                const T*             coo_val_A,
+                const T*             B,
+                I                    ldb,
+                hipsparseOrder_t     order_B,
+                T                    beta,
+                T*                   C,
+                I                    ldc,
+                hipsparseOrder_t     order_C,
+                hipsparseIndexBase_t base)
+{
+    bool conj_A = (transA == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+    bool conj_B = (transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE);
+
+    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        for(I j = 0; j < N; j++)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(I i = 0; i < M; ++i)
+            {
+                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
+
+                C[idx_C] = testing_mult(beta, C[idx_C]);
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(I j = 0; j < N; j++)
+        {
+            for(I i = 0; i < nnz; ++i)
+            {
+                I row = coo_row_ind_A[i] - base;
+                I col = coo_col_ind_A[i] - base;
+                T val = testing_mult(alpha, coo_val_A[i]);
+
+                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? row + j * ldc : row * ldc + j;
+
+                I idx_B = 0;
+                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
+                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
+                       && order_B != HIPSPARSE_ORDER_COL))
+                {
+                    idx_B = (col + j * ldb);
+                }
+                else
+                {
+                    idx_B = (j + col * ldb);
+                }
+
+                C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
+            }
+        }
+    }
+    else
+    {
+        for(I j = 0; j < N; j++)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(I i = 0; i < K; ++i)
+            {
+                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? i + j * ldc : i * ldc + j;
+
+                C[idx_C] = testing_mult(beta, C[idx_C]);
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(I j = 0; j < N; j++)
+        {
+            for(I i = 0; i < nnz; ++i)
+            {
+                I row = coo_row_ind_A[i] - base;
+                I col = coo_col_ind_A[i] - base;
+                T val = testing_mult(alpha, testing_conj(coo_val_A[i], conj_A));
+
+                I idx_C = (order_C == HIPSPARSE_ORDER_COL) ? col + j * ldc : col * ldc + j;
+
+                I idx_B = 0;
+                if((transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
+                   || (transB != HIPSPARSE_OPERATION_NON_TRANSPOSE
+                       && order_B != HIPSPARSE_ORDER_COL))
+                {
+                    idx_B = (row + j * ldb);
+                }
+                else
+                {
+                    idx_B = (j + row * ldb);
+                }
+
+                C[idx_C] = testing_fma(val, testing_conj(B[idx_B], conj_B), C[idx_C]);
+            }
+        }
+    }
+}
+
+template <typename T, typename I>
+void host_coomm_batched(I                    M,
+                        I                    N,
+                        I                    K,
+                        I                    nnz,
+                        I                    batch_count_A,
+                        I                    batch_stride_A,
+                        hipsparseOperation_t transA,
+                        hipsparseOperation_t transB,
+                        T                    alpha,
+                        const I*             coo_row_ind_A,
+                        const I*             coo_col_ind_A,
+                        const T*             coo_val_A,
+                        const T*             B,
+                        I                    ldb,
+                        I                    batch_count_B,
+                        I                    batch_stride_B,
+                        hipsparseOrder_t     order_B,
+                        T                    beta,
+                        T*                   C,
+                        I                    ldc,
+                        I                    batch_count_C,
+                        I                    batch_stride_C,
+                        hipsparseOrder_t     order_C,
+                        hipsparseIndexBase_t base)
+{
+    bool Ci_A_Bi  = (batch_count_A == 1 && batch_count_B == batch_count_C);
+    bool Ci_Ai_B  = (batch_count_B == 1 && batch_count_A == batch_count_C);
+    bool Ci_Ai_Bi = (batch_count_A == batch_count_C && batch_count_A == batch_count_B);
+
+    if(!Ci_A_Bi && !Ci_Ai_B && !Ci_Ai_Bi)
+    {
+        return;
+    }
+
+    if(Ci_A_Bi)
+    {
+        for(I i = 0; i < batch_count_C; i++)
+        {
+            host_coomm(M,
+                       N,
+                       K,
+                       nnz,
+                       transA,
+                       transB,
+                       alpha,
+                       coo_row_ind_A,
+                       coo_col_ind_A,
+                       coo_val_A,
+                       B + batch_stride_B * i,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base);
+        }
+    }
+    else if(Ci_Ai_B)
+    {
+        for(I i = 0; i < batch_count_C; i++)
+        {
+            host_coomm(M,
+                       N,
+                       K,
+                       nnz,
+                       transA,
+                       transB,
+                       alpha,
+                       coo_row_ind_A + batch_stride_A * i,
+                       coo_col_ind_A + batch_stride_A * i,
+                       coo_val_A + batch_stride_A * i,
+                       B,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base);
+        }
+    }
+    else if(Ci_Ai_Bi)
+    {
+        for(I i = 0; i < batch_count_C; i++)
+        {
+            host_coomm(M,
+                       N,
+                       K,
+                       nnz,
+                       transA,
+                       transB,
+                       alpha,
+                       coo_row_ind_A + batch_stride_A * i,
+                       coo_col_ind_A + batch_stride_A * i,
+                       coo_val_A + batch_stride_A * i,
+                       B + batch_stride_B * i,
+                       ldb,
+                       order_B,
+                       beta,
+                       C + batch_stride_C * i,
+                       ldc,
+                       order_C,
+                       base);
+        }
+    }
+}
+
+template <typename T>
+int csrilu0(int                  m,
+            const int*           ptr,
+            const int*           col,
+            T*                   val,
+            hipsparseIndexBase_t idx_base,
+            bool                 boost,
+            double               boost_tol,
+            T                    boost_val)
+{
+    // pointer of upper part of each row
+    std::vector<int> diag_offset(m);
+    std::vector<int> nnz_entries(m, 0);
+
+    // ai = 0 to N loop over all rows
+    for(int ai = 0; ai < m; ++ai)
+    {
+        // ai-th row entries
+        int row_start = ptr[ai] - idx_base;
+        int row_end   = ptr[ai + 1] - idx_base;
+        int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_start; j < row_end; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = j;
+        }
+
+        bool has_diag = false;
+
+        // loop over ai-th row nnz entries
+        for(j = row_start; j < row_end; ++j)
+        {
+            // if nnz entry is in lower matrix
+            if(col[j] - idx_base < ai)
+            {
+                int col_j  = col[j] - idx_base;
+                int diag_j = diag_offset[col_j];
+
+                T diag_val = val[diag_j];
+
+                if(boost)
+                {
+                    diag_val    = (boost_tol >= testing_abs(diag_val)) ? boost_val : diag_val;
+                    val[diag_j] = diag_val;
+                }
+                else
+                {
+                    // Check for numeric pivot
+                    if(diag_val == make_DataType<T>(0.0))
+                    {
+                        // Numerical zero diagonal
+                        return col_j + idx_base;
+                    }
+                }
+
+                // multiplication factor
+                val[j] = testing_div(val[j], diag_val);
+
+                // loop over upper offset pointer and do linear combination for nnz entry
+                for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                {
+                    // if nnz at this position do linear combination
+                    if(nnz_entries[col[k] - idx_base] != 0)
+                    {
+                        int idx  = nnz_entries[col[k] - idx_base];
+                        val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
+                    }
+                }
+            }
+            else if(col[j] - idx_base == ai)
+            {
+                has_diag = true;
+                break;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if(!has_diag)
+        {
+            // Structural zero digonal
+            return ai + idx_base;
+        }
+
+        // set diagonal pointer to diagonal element
+        diag_offset[ai] = j;
+
+        // clear nnz entries
+        for(j = row_start; j < row_end; ++j)
+        {
+            nnz_entries[col[j] - idx_base] = 0;
+        }
+    }
+
+    return -1;
+}
+
+template <typename T>
+inline void host_bsrilu02(hipsparseDirection_t    dir,
+                          int                     mb,
+                          int                     bsr_dim,
+                          const std::vector<int>& bsr_row_ptr,
+                          const std::vector<int>& bsr_col_ind,
+                          std::vector<T>&         bsr_val,
+                          hipsparseIndexBase_t    base,
+                          int*                    struct_pivot,
+                          int*                    numeric_pivot,
+                          bool                    boost,
+                          double                  boost_tol,
+                          T                       boost_val)
+{
+    // Initialize pivots
+    *struct_pivot  = mb + 1;
+    *numeric_pivot = mb + 1;
+
+    // Temporary vector to hold diagonal offset to access diagonal BSR block
+    std::vector<int> diag_offset(mb);
+    std::vector<int> nnz_entries(mb, -1);
+
+    // First diagonal block is index 0
+    if(mb > 0)
+    {
+        diag_offset[0] = 0;
+    }
+
+    // Loop over all BSR rows
+    for(int i = 0; i < mb; ++i)
+    {
+        // Flag whether we have a diagonal block or not
+        bool has_diag = false;
+
+        // BSR column entry and exit point
+        int row_begin = bsr_row_ptr[i] - base;
+        int row_end   = bsr_row_ptr[i + 1] - base;
+
+        int j;
+
+        // Set up entry points for linear combination
+        for(j = row_begin; j < row_end; ++j)
+        {
+            int col_j          = bsr_col_ind[j] - base;
+            nnz_entries[col_j] = j;
+        }
+
+        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
+        for(j = row_begin; j < row_end; ++j)
+        {
+            // Column index of current BSR block
+            int bsr_col = bsr_col_ind[j] - base;
+
+            // If this is a diagonal block, set diagonal flag to true and skip
+            // all upcoming blocks as we exceed the lower matrix part
+            if(bsr_col == i)
+            {
+                has_diag = true;
+                break;
+            }
+
+            // Skip all upper matrix blocks
+            if(bsr_col > i)
+            {
+                break;
+            }
+
+            // Process all lower matrix BSR blocks
+
+            // Obtain corresponding row entry and exit point that corresponds with the
+            // current BSR column. Actually, we skip all lower matrix column indices,
+            // therefore starting with the diagonal entry.
+            int diag_j    = diag_offset[bsr_col];
+            int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+
+            // Loop through all rows within the BSR block
+            for(int bi = 0; bi < bsr_dim; ++bi)
+            {
+                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+
+                // Process all rows within the BSR block
+                for(int bk = 0; bk < bsr_dim; ++bk)
+                {
+                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                    // Multiplication factor
+                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
+
+                    // Loop through columns of bk-th row and do linear combination
+                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                    {
+                        bsr_val[BSR_IND(j, bk, bj, dir)]
+                            = testing_fma(-val,
+                                          bsr_val[BSR_IND(diag_j, bi, bj, dir)],
+                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                    }
+                }
+            }
+
+            // Loop over upper offset pointer and do linear combination for nnz entry
+            for(int k = diag_j + 1; k < row_end_j; ++k)
+            {
+                int bsr_col_k = bsr_col_ind[k] - base;
+
+                if(nnz_entries[bsr_col_k] != -1)
+                {
+                    int m = nnz_entries[bsr_col_k];
+
+                    // Loop through all rows within the BSR block
+                    for(int bi = 0; bi < bsr_dim; ++bi)
+                    {
+                        // Loop through columns of bi-th row and do linear combination
+                        for(int bj = 0; bj < bsr_dim; ++bj)
+                        {
+                            T sum = make_DataType<T>(0);
+
+                            for(int bk = 0; bk < bsr_dim; ++bk)
+                            {
+                                sum = testing_fma(bsr_val[BSR_IND(j, bi, bk, dir)],
+                                                  bsr_val[BSR_IND(k, bk, bj, dir)],
+                                                  sum);
+                            }
+
+                            bsr_val[BSR_IND(m, bi, bj, dir)]
+                                = bsr_val[BSR_IND(m, bi, bj, dir)] - sum;
+                        }
+                    }
+                }
+            }
+        }
+
+        // Check for structural pivot
+        if(!has_diag)
+        {
+            *struct_pivot = std::min(*struct_pivot, i + base);
+            break;
+        }
+
+        // Process diagonal
+        if(bsr_col_ind[j] - base == i)
+        {
+            // Loop through all rows within the BSR block
+            for(int bi = 0; bi < bsr_dim; ++bi)
+            {
+                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+
+                if(boost)
+                {
+                    diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
+                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                }
+                else
+                {
+                    // Check for numeric pivot
+                    if(diag == make_DataType<T>(0))
+                    {
+                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
+                        continue;
+                    }
+                }
+
+                // Process all rows within the BSR block after bi-th row
+                for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                {
+                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                    // Multiplication factor
+                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
+
+                    // Loop through remaining columns of bk-th row and do linear combination
+                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
+                    {
+                        bsr_val[BSR_IND(j, bk, bj, dir)]
+                            = testing_fma(-val,
+                                          bsr_val[BSR_IND(j, bi, bj, dir)],
+                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                    }
+                }
+            }
+        }
+
+        // Store diagonal BSR block entry point
+        int row_diag = diag_offset[i] = j;
+
+        // Process upper diagonal BSR blocks
+        for(j = row_diag + 1; j < row_end; ++j)
+        {
+            // Loop through all rows within the BSR block
+            for(int bi = 0; bi < bsr_dim; ++bi)
+            {
+                // Process all rows within the BSR block after bi-th row
+                for(int bk = bi + 1; bk < bsr_dim; ++bk)
+                {
+                    // Loop through columns of bk-th row and do linear combination
+                    for(int bj = 0; bj < bsr_dim; ++bj)
+                    {
+                        bsr_val[BSR_IND(j, bk, bj, dir)]
+                            = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
+                                          bsr_val[BSR_IND(j, bi, bj, dir)],
+                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
+                    }
+                }
+            }
+        }
+
+        // Reset entry points
+        for(j = row_begin; j < row_end; ++j)
+        {
+            int col_j          = bsr_col_ind[j] - base;
+            nnz_entries[col_j] = -1;
+        }
+    }
+
+    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
+}
+
+template <typename T>
+inline void host_bsric02(hipsparseDirection_t    direction,
+                         int                     Mb,
+                         int                     block_dim,
+                         const std::vector<int>& bsr_row_ptr,
+                         const std::vector<int>& bsr_col_ind,
+                         std::vector<T>&         bsr_val,
+                         hipsparseIndexBase_t    base,
+                         int*                    struct_pivot,
+                         int*                    numeric_pivot)
+{
+    int M = Mb * block_dim;
+
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    if(bsr_col_ind.size() == 0 && bsr_val.size() == 0)
+    {
+        return;
+    }
+
+    // pointer of upper part of each row
+    std::vector<int> diag_block_offset(Mb);
+    std::vector<int> diag_offset(M, -1);
+    std::vector<int> nnz_entries(M, -1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(int i = 0; i < Mb; i++)
+    {
+        int row_begin = bsr_row_ptr[i] - base;
+        int row_end   = bsr_row_ptr[i + 1] - base;
+
+        for(int j = row_begin; j < row_end; j++)
+        {
+            if(bsr_col_ind[j] - base == i)
+            {
+                diag_block_offset[i] = j;
+                break;
+            }
+        }
+    }
+
+    for(int i = 0; i < M; i++)
+    {
+        int local_row = i % block_dim;
+
+        int row_begin = bsr_row_ptr[i / block_dim] - base;
+        int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
+
+        for(int j = row_begin; j < row_end; j++)
+        {
+            int block_col_j = bsr_col_ind[j] - base;
+
+            for(int k = 0; k < block_dim; k++)
+            {
+                if(direction == HIPSPARSE_DIRECTION_ROW)
+                {
+                    nnz_entries[block_dim * block_col_j + k]
+                        = block_dim * block_dim * j + block_dim * local_row + k;
+                }
+                else
+                {
+                    nnz_entries[block_dim * block_col_j + k]
+                        = block_dim * block_dim * j + block_dim * k + local_row;
+                }
+            }
+        }
+
+        T   sum            = make_DataType<T>(0);
+        int diag_val_index = -1;
+
+        bool has_diag         = false;
+        bool break_outer_loop = false;
+
+        for(int j = row_begin; j < row_end; j++)
+        {
+            int block_col_j = bsr_col_ind[j] - base;
+
+            for(int k = 0; k < block_dim; k++)
+            {
+                int col_j = block_dim * block_col_j + k;
+
+                // Mark diagonal and skip row
+                if(col_j == i)
+                {
+                    diag_val_index = block_dim * block_dim * j + block_dim * k + k;
+
+                    has_diag         = true;
+                    break_outer_loop = true;
+                    break;
+                }
+
+                // Skip upper triangular
+                if(col_j > i)
+                {
+                    break_outer_loop = true;
+                    break;
+                }
+
+                T val_j;
+                if(direction == HIPSPARSE_DIRECTION_ROW)
+                {
+                    val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
+                }
+                else
+                {
+                    val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
+                }
+
+                int local_row_j = col_j % block_dim;
+
+                int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
+                int row_end_j   = diag_block_offset[col_j / block_dim];
+                int row_diag_j  = diag_offset[col_j];
+
+                T local_sum = make_DataType<T>(0);
+                T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : make_DataType<T>(0);
+
+                // Check for numeric zero
+                if(inv_diag == make_DataType<T>(0))
+                {
+                    // Numerical non-invertible block diagonal
+                    if(*numeric_pivot == -1)
+                    {
+                        *numeric_pivot = block_col_j + base;
+                    }
+
+                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
+
+                    inv_diag = make_DataType<T>(1);
+                }
+
+                inv_diag = testing_div(make_DataType<T>(1), inv_diag);
+
+                // loop over upper offset pointer and do linear combination for nnz entry
+                for(int l = row_begin_j; l < row_end_j + 1; l++)
+                {
+                    int block_col_l = bsr_col_ind[l] - base;
+
+                    for(int m = 0; m < block_dim; m++)
+                    {
+                        int idx = nnz_entries[block_dim * block_col_l + m];
+
+                        if(idx != -1 && block_dim * block_col_l + m < col_j)
+                        {
+                            if(direction == HIPSPARSE_DIRECTION_ROW)
+                            {
+                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
+                                                                + block_dim * local_row_j + m],
+                                                        testing_conj(bsr_val[idx]),
+                                                        local_sum);
+                            }
+                            else
+                            {
+                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
+                                                                + block_dim * m + local_row_j],
+                                                        testing_conj(bsr_val[idx]),
+                                                        local_sum);
+                            }
+                        }
+                    }
+                }
+
+                val_j = testing_mult((val_j - local_sum), inv_diag);
+                sum   = testing_fma(val_j, testing_conj(val_j), sum);
+
+                if(direction == HIPSPARSE_DIRECTION_ROW)
+                {
+                    bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
+                }
+                else
+                {
+                    bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
+                }
+            }
+
+            if(break_outer_loop)
+            {
+                break;
+            }
+        }
+
+        if(!has_diag)
+        {
+            // Structural missing block diagonal
+            if(*struct_pivot == -1)
+            {
+                *struct_pivot = i / block_dim + base;
+            }
+        }
+
+        // Process diagonal entry
+        if(has_diag)
+        {
+            T diag_entry = make_DataType<T>(std::sqrt(testing_abs(bsr_val[diag_val_index] - sum)));
+            bsr_val[diag_val_index] = diag_entry;
+
+            if(diag_entry == make_DataType<T>(0))
+            {
+                // Numerical non-invertible block diagonal
+                if(*numeric_pivot == -1)
+                {
+                    *numeric_pivot = i / block_dim + base;
+                }
+
+                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
+            }
+
+            // Store diagonal offset
+            diag_offset[i] = diag_val_index;
+        }
+
+        for(int j = row_begin; j < row_end; j++)
+        {
+            int block_col_j = bsr_col_ind[j] - base;
+
+            for(int k = 0; k < block_dim; k++)
+            {
+                if(direction == HIPSPARSE_DIRECTION_ROW)
+                {
+                    nnz_entries[block_dim * block_col_j + k] = -1;
+                }
+                else
+                {
+                    nnz_entries[block_dim * block_col_j + k] = -1;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void csric0(int                  M,
+            const int*           csr_row_ptr,
+            const int*           csr_col_ind,
+            T*                   csr_val,
+            hipsparseIndexBase_t idx_base,
+            int&                 struct_pivot,
+            int&                 numeric_pivot)
+{
+    // Initialize pivot
+    struct_pivot  = -1;
+    numeric_pivot = -1;
+
+    // pointer of upper part of each row
+    std::vector<int> diag_offset(M);
+    std::vector<int> nnz_entries(M, 0);
+
+    // ai = 0 to N loop over all rows
+    for(int ai = 0; ai < M; ++ai)
+    {
+        // ai-th row entries
+        int row_begin = csr_row_ptr[ai] - idx_base;
+        int row_end   = csr_row_ptr[ai + 1] - idx_base;
+        int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - idx_base] = j;
+        }
+
+        T sum = make_DataType<T>(0.0);
+
+        bool has_diag = false;
+
+        // loop over ai-th row nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            int col_j = csr_col_ind[j] - idx_base;
+            T   val_j = csr_val[j];
+
+            // Mark diagonal and skip row
+            if(col_j == ai)
+            {
+                has_diag = true;
+                break;
+            }
+
+            // Skip upper triangular
+            if(col_j > ai)
+            {
+                break;
+            }
+
+            int row_begin_j = csr_row_ptr[col_j] - idx_base;
+            int row_diag_j  = diag_offset[col_j];
+
+            T local_sum = make_DataType<T>(0.0);
+            T inv_diag  = csr_val[row_diag_j];
+
+            // Check for numeric zero
+            if(inv_diag == make_DataType<T>(0.0))
+            {
+                // Numerical zero diagonal
+                numeric_pivot = col_j + idx_base;
+                return;
+            }
+
+            inv_diag = testing_div(make_DataType<T>(1.0), inv_diag);
+
+            // loop over upper offset pointer and do linear combination for nnz entry
+            for(int k = row_begin_j; k < row_diag_j; ++k)
+            {
+                int col_k = csr_col_ind[k] - idx_base;
+
+                // if nnz at this position do linear combination
+                if(nnz_entries[col_k] != 0)
+                {
+                    int idx   = nnz_entries[col_k];
+                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
+                }
+            }
+
+            val_j = testing_mult((val_j - local_sum), inv_diag);
+            sum   = testing_fma(val_j, testing_conj(val_j), sum);
+
+            csr_val[j] = val_j;
+        }
+
+        if(!has_diag)
+        {
+            // Structural (and numerical) zero diagonal
+            struct_pivot  = ai + idx_base;
+            numeric_pivot = ai + idx_base;
+            return;
+        }
+
+        // Process diagonal entry
+        T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
+        csr_val[j]   = diag_entry;
+
+        // Store diagonal offset
+        diag_offset[ai] = j;
+
+        // clear nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - idx_base] = 0;
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Sparse triangular system solve using CSR storage format. */
+template <typename I, typename J, typename T>
+static inline void host_lssolve(J                     M,
+                                J                     nrhs,
+                                hipsparseOperation_t  transB,
+                                T                     alpha,
+                                const std::vector<I>& csr_row_ptr,
+                                const std::vector<J>& csr_col_ind,
+                                const std::vector<T>& csr_val,
+                                std::vector<T>&       B,
+                                J                     ldb,
+                                hipsparseOrder_t      order_B,
+                                hipsparseDiagType_t   diag_type,
+                                hipsparseIndexBase_t  base,
+                                J*                    struct_pivot,
+                                J*                    numeric_pivot)
+{
+    // Get device properties
+    int             dev;
+    hipDeviceProp_t prop;
+
+    std::ignore = hipGetDevice(&dev);
+    std::ignore = hipGetDeviceProperties(&prop, dev);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < nrhs; ++i)
+    {
+        std::vector<T> temp(prop.warpSize);
+
+        // Process lower triangular part
+        for(J row = 0; row < M; ++row)
+        {
+            temp.assign(prop.warpSize, make_DataType<T>(0.0));
+
+            J idx_B
+                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
+                      ? i * ldb + row
+                      : row * ldb + i;
+
+            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+            {
+                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
+            }
+            else
+            {
+                temp[0] = testing_mult(alpha, B[idx_B]);
+            }
+
+            I diag      = -1;
+            I row_begin = csr_row_ptr[row] - base;
+            I row_end   = csr_row_ptr[row + 1] - base;
+
+            T diag_val = make_DataType<T>(0.0);
+
+            for(I l = row_begin; l < row_end; l += prop.warpSize)
+            {
+                for(int k = 0; k < prop.warpSize; ++k)
+                {
+                    I j = l + k;
+
+                    // Do not run out of bounds
+                    if(j >= row_end)
+                    {
+                        break;
+                    }
+
+                    J local_col = csr_col_ind[j] - base;
+                    T local_val = csr_val[j];
+
+                    if(local_val == make_DataType<T>(0.0) && local_col == row
+                       && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                    {
+                        // Numerical zero pivot found, avoid division by 0 and store
+                        // index for later use
+                        *numeric_pivot = std::min(*numeric_pivot, row + base);
+                        local_val      = make_DataType<T>(1.0);
+                    }
+
+                    // Ignore all entries that are above the diagonal
+                    if(local_col > row)
+                    {
+                        break;
+                    }
+
+                    // Diagonal entry
+                    if(local_col == row)
+                    {
+                        // If diagonal type is non unit, do division by diagonal entry
+                        // This is not required for unit diagonal for obvious reasons
+                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                        {
+                            diag     = j;
+                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
+                        }
+
+                        break;
+                    }
+
+                    // Lower triangular part
+                    J idx     = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
+                             && order_B == HIPSPARSE_ORDER_COL)
+                                    ? i * ldb + local_col
+                                    : local_col * ldb + i;
+                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
+
+                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+                    {
+                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
+                    }
+                    else
+                    {
+                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
+                    }
+                }
+            }
+
+            for(int j = 1; j < prop.warpSize; j <<= 1)
+            {
+                for(int k = 0; k < prop.warpSize - j; ++k)
+                {
+                    temp[k] = temp[k] + temp[k + j];
+                }
+            }
+
+            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+            {
+                if(diag == -1)
+                {
+                    *struct_pivot = std::min(*struct_pivot, row + base);
+                }
+
+                B[idx_B] = testing_mult(temp[0], diag_val);
+            }
+            else
+            {
+                B[idx_B] = temp[0];
+            }
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+static inline void host_ussolve(J                     M,
+                                J                     nrhs,
+                                hipsparseOperation_t  transB,
+                                T                     alpha,
+                                const std::vector<I>& csr_row_ptr,
+                                const std::vector<J>& csr_col_ind,
+                                const std::vector<T>& csr_val,
+                                std::vector<T>&       B,
+                                J                     ldb,
+                                hipsparseOrder_t      order_B,
+                                hipsparseDiagType_t   diag_type,
+                                hipsparseIndexBase_t  base,
+                                J*                    struct_pivot,
+                                J*                    numeric_pivot)
+{
+    // Get device properties
+    int             dev;
+    hipDeviceProp_t prop;
+
+    std::ignore = hipGetDevice(&dev);
+    std::ignore = hipGetDeviceProperties(&prop, dev);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(J i = 0; i < nrhs; ++i)
+    {
+        std::vector<T> temp(prop.warpSize);
+
+        // Process upper triangular part
+        for(J row = M - 1; row >= 0; --row)
+        {
+            temp.assign(prop.warpSize, make_DataType<T>(0.0));
+
+            J idx_B
+                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
+                      ? i * ldb + row
+                      : row * ldb + i;
+
+            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+            {
+                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
+            }
+            else
+            {
+                temp[0] = testing_mult(alpha, B[idx_B]);
+            }
+
+            I diag      = -1;
+            I row_begin = csr_row_ptr[row] - base;
+            I row_end   = csr_row_ptr[row + 1] - base;
+
+            T diag_val = make_DataType<T>(0.0);
+
+            for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
+            {
+                for(int k = 0; k < prop.warpSize; ++k)
+                {
+                    I j = l - k;
+
+                    // Do not run out of bounds
+                    if(j < row_begin)
+                    {
+                        break;
+                    }
+
+                    J local_col = csr_col_ind[j] - base;
+                    T local_val = csr_val[j];
+
+                    // Ignore all entries that are below the diagonal
+                    if(local_col < row)
+                    {
+                        continue;
+                    }
+
+                    // Diagonal entry
+                    if(local_col == row)
+                    {
+                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                        {
+                            // Check for numerical zero
+                            if(local_val == make_DataType<T>(0.0))
+                            {
+                                *numeric_pivot = std::min(*numeric_pivot, row + base);
+                                local_val      = make_DataType<T>(1.0);
+                            }
+
+                            diag     = j;
+                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
+                        }
+
+                        continue;
+                    }
+
+                    // Upper triangular part
+                    J idx = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
+                             && order_B == HIPSPARSE_ORDER_COL)
+                                ? i * ldb + local_col
+                                : local_col * ldb + i;
+
+                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
+
+                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+                    {
+                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
+                    }
+                    else
+                    {
+                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
+                    }
+                }
+            }
+
+            for(int j = 1; j < prop.warpSize; j <<= 1)
+            {
+                for(int k = 0; k < prop.warpSize - j; ++k)
+                {
+                    temp[k] = temp[k] + temp[k + j];
+                }
+            }
+
+            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+            {
+                if(diag == -1)
+                {
+                    *struct_pivot = std::min(*struct_pivot, row + base);
+                }
+
+                B[idx_B] = testing_mult(temp[0], diag_val);
+            }
+            else
+            {
+                B[idx_B] = temp[0];
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_bsrsm(int                  mb,
+                int                  nrhs,
+                int                  nnzb,
+                hipsparseDirection_t dir,
+                hipsparseOperation_t transA,
+                hipsparseOperation_t transX,
+                T                    alpha,
+                const int*           bsr_row_ptr,
+                const int*           bsr_col_ind,
+                const T*             bsr_val,
+                int                  bsr_dim,
+                const T*             B,
+                int                  ldb,
+                T*                   X,
+                int                  ldx,
+                hipsparseDiagType_t  diag_type,
+                hipsparseFillMode_t  fill_mode,
+                hipsparseIndexBase_t base,
+                int*                 struct_pivot,
+                int*                 numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = mb + 1;
+    *numeric_pivot = mb + 1;
+
+    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        {
+            bsr_lsolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+        }
+        else
+        {
+            bsr_usolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       bsr_val,
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+        }
+    }
+    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE)
+    {
+        // Transpose matrix
+        std::vector<int> bsrt_row_ptr(mb + 1);
+        std::vector<int> bsrt_col_ind(nnzb);
+        std::vector<T>   bsrt_val(nnzb * bsr_dim * bsr_dim);
+
+        host_bsr_to_bsc(mb,
+                        mb,
+                        nnzb,
+                        bsr_dim,
+                        bsr_row_ptr,
+                        bsr_col_ind,
+                        bsr_val,
+                        bsrt_col_ind,
+                        bsrt_row_ptr,
+                        bsrt_val,
+                        base,
+                        base);
+
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        {
+            bsr_usolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsrt_row_ptr.data(),
+                       bsrt_col_ind.data(),
+                       bsrt_val.data(),
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+        }
+        else
+        {
+            bsr_lsolve(dir,
+                       transX,
+                       mb,
+                       nrhs,
+                       alpha,
+                       bsrt_row_ptr.data(),
+                       bsrt_col_ind.data(),
+                       bsrt_val.data(),
+                       bsr_dim,
+                       B,
+                       ldb,
+                       X,
+                       ldx,
+                       diag_type,
+                       base,
+                       struct_pivot,
+                       numeric_pivot);
+        }
+    }
+
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+
+    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
+}
+
+template <typename I, typename J, typename T>
+void host_csr_lsolve(J                    M,
+                     T                    alpha,
+                     const I*             csr_row_ptr,
+                     const J*             csr_col_ind,
+                     const T*             csr_val,
+                     const T*             x,
+                     T*                   y,
+                     hipsparseDiagType_t  diag_type,
+                     hipsparseIndexBase_t base,
+                     J*                   struct_pivot,
+                     J*                   numeric_pivot)
+{
+    // Get device properties
+    int             dev;
+    hipDeviceProp_t prop;
+
+    std::ignore = hipGetDevice(&dev);
+    std::ignore = hipGetDeviceProperties(&prop, dev);
+
+    std::vector<T> temp(prop.warpSize);
+
+    // Process lower triangular part
+    for(J row = 0; row < M; ++row)
+    {
+        temp.assign(prop.warpSize, make_DataType<T>(0.0));
+        temp[0] = testing_mult(alpha, x[row]);
+
+        I diag      = -1;
+        I row_begin = csr_row_ptr[row] - base;
+        I row_end   = csr_row_ptr[row + 1] - base;
+
+        T diag_val = make_DataType<T>(0.0);
+
+        for(I l = row_begin; l < row_end; l += prop.warpSize)
+        {
+            for(int k = 0; k < prop.warpSize; ++k)
+            {
+                I j = l + k;
+
+                // Do not run out of bounds
+                if(j >= row_end)
+                {
+                    break;
+                }
+
+                J local_col = csr_col_ind[j] - base;
+                T local_val = csr_val[j];
+
+                if(local_val == make_DataType<T>(0.0) && local_col == row
+                   && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    *numeric_pivot = std::min(*numeric_pivot, row + base);
+                    local_val      = make_DataType<T>(1);
+                }
+
+                // Ignore all entries that are above the diagonal
+                if(local_col > row)
+                {
+                    break;
+                }
+
+                // Diagonal entry
+                if(local_col == row)
+                {
+                    // If diagonal type is non unit, do division by diagonal entry
+                    // This is not required for unit diagonal for obvious reasons
+                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+                    {
+                        diag     = j;
+                        diag_val = testing_div(make_DataType<T>(1), local_val);
+                    }
+
+                    break;
+                }
+
+                // Lower triangular part
+                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
+            }
+        }
+
+        for(int j = 1; j < prop.warpSize; j <<= 1)
+        {
+            for(int k = 0; k < prop.warpSize - j; ++k)
+            {
+                temp[k] = temp[k] + temp[k + j];
+            }
         }
-    }
-    else if(Ci_Ai_Bi)
-    {
-        for(I i = 0; i < batch_count_C; i++)
+
+        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
         {
-            host_coomm(M,
-                       N,
-                       K,
-                       nnz,
-                       transA,
-                       transB,
-                       alpha,
-                       coo_row_ind_A + batch_stride_A * i,
-                       coo_col_ind_A + batch_stride_A * i,
-                       coo_val_A + batch_stride_A * i,
-                       B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base);
+            if(diag == -1)
+            {
+                *struct_pivot = std::min(*struct_pivot, row + base);
+            }
+
+            y[row] = testing_mult(temp[0], diag_val);
+        }
+        else
+        {
+            y[row] = temp[0];
         }
     }
 }
 
-template <typename T>
-int csrilu0(int                  m,
-            const int*           ptr,
-            const int*           col,
-            T*                   val,
-            hipsparseIndexBase_t idx_base,
-            bool                 boost,
-            double               boost_tol,
-            T                    boost_val)
+template <typename I, typename J, typename T>
+void host_csr_usolve(J                    M,
+                     T                    alpha,
+                     const I*             csr_row_ptr,
+                     const J*             csr_col_ind,
+                     const T*             csr_val,
+                     const T*             x,
+                     T*                   y,
+                     hipsparseDiagType_t  diag_type,
+                     hipsparseIndexBase_t base,
+                     J*                   struct_pivot,
+                     J*                   numeric_pivot)
 {
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(m);
-    std::vector<int> nnz_entries(m, 0);
+    // Get device properties
+    int             dev;
+    hipDeviceProp_t prop;
 
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < m; ++ai)
+    std::ignore = hipGetDevice(&dev);
+    std::ignore = hipGetDeviceProperties(&prop, dev);
+
+    std::vector<T> temp(prop.warpSize);
+
+    // Process upper triangular part
+    for(J row = M - 1; row >= 0; --row)
     {
-        // ai-th row entries
-        int row_start = ptr[ai] - idx_base;
-        int row_end   = ptr[ai + 1] - idx_base;
-        int j;
+        temp.assign(prop.warpSize, make_DataType<T>(0));
+        temp[0] = testing_mult(alpha, x[row]);
 
-        // nnz position of ai-th row in val array
-        for(j = row_start; j < row_end; ++j)
-        {
-            nnz_entries[col[j] - idx_base] = j;
-        }
+        I diag      = -1;
+        I row_begin = csr_row_ptr[row] - base;
+        I row_end   = csr_row_ptr[row + 1] - base;
 
-        bool has_diag = false;
+        T diag_val = make_DataType<T>(0);
 
-        // loop over ai-th row nnz entries
-        for(j = row_start; j < row_end; ++j)
+        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
         {
-            // if nnz entry is in lower matrix
-            if(col[j] - idx_base < ai)
+            for(int k = 0; k < prop.warpSize; ++k)
             {
-                int col_j  = col[j] - idx_base;
-                int diag_j = diag_offset[col_j];
-
-                T diag_val = val[diag_j];
+                I j = l - k;
 
-                if(boost)
+                // Do not run out of bounds
+                if(j < row_begin)
                 {
-                    diag_val    = (boost_tol >= testing_abs(diag_val)) ? boost_val : diag_val;
-                    val[diag_j] = diag_val;
+                    break;
                 }
-                else
+
+                J local_col = csr_col_ind[j] - base;
+                T local_val = csr_val[j];
+
+                // Ignore all entries that are below the diagonal
+                if(local_col < row)
                 {
-                    // Check for numeric pivot
-                    if(diag_val == make_DataType<T>(0.0))
-                    {
-                        // Numerical zero diagonal
-                        return col_j + idx_base;
-                    }
+                    continue;
                 }
 
-                // multiplication factor
-                val[j] = testing_div(val[j], diag_val);
-
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(int k = diag_j + 1; k < ptr[col_j + 1] - idx_base; ++k)
+                // Diagonal entry
+                if(local_col == row)
                 {
-                    // if nnz at this position do linear combination
-                    if(nnz_entries[col[k] - idx_base] != 0)
+                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
                     {
-                        int idx  = nnz_entries[col[k] - idx_base];
-                        val[idx] = testing_fma(testing_neg(val[j]), val[k], val[idx]);
+                        // Check for numerical zero
+                        if(local_val == make_DataType<T>(0))
+                        {
+                            *numeric_pivot = std::min(*numeric_pivot, row + base);
+                            local_val      = make_DataType<T>(1);
+                        }
+
+                        diag     = j;
+                        diag_val = testing_div(make_DataType<T>(1), local_val);
                     }
+
+                    continue;
                 }
-            }
-            else if(col[j] - idx_base == ai)
-            {
-                has_diag = true;
-                break;
-            }
-            else
-            {
-                break;
+
+                // Upper triangular part
+                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
             }
         }
 
-        if(!has_diag)
+        for(int j = 1; j < prop.warpSize; j <<= 1)
         {
-            // Structural zero digonal
-            return ai + idx_base;
+            for(int k = 0; k < prop.warpSize - j; ++k)
+            {
+                temp[k] = temp[k] + temp[k + j];
+            }
         }
 
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
+        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+        {
+            if(diag == -1)
+            {
+                *struct_pivot = std::min(*struct_pivot, row + base);
+            }
 
-        // clear nnz entries
-        for(j = row_start; j < row_end; ++j)
+            y[row] = testing_mult(temp[0], diag_val);
+        }
+        else
         {
-            nnz_entries[col[j] - idx_base] = 0;
+            y[row] = temp[0];
         }
     }
-
-    return -1;
 }
 
-template <typename T>
-inline void host_bsrilu02(hipsparseDirection_t    dir,
-                          int                     mb,
-                          int                     bsr_dim,
-                          const std::vector<int>& bsr_row_ptr,
-                          const std::vector<int>& bsr_col_ind,
-                          std::vector<T>&         bsr_val,
-                          hipsparseIndexBase_t    base,
-                          int*                    struct_pivot,
-                          int*                    numeric_pivot,
-                          bool                    boost,
-                          double                  boost_tol,
-                          T                       boost_val)
+template <typename I, typename J, typename T>
+void host_csrsv(hipsparseOperation_t trans,
+                J                    M,
+                I                    nnz,
+                T                    alpha,
+                const I*             csr_row_ptr,
+                const J*             csr_col_ind,
+                const T*             csr_val,
+                const T*             x,
+                T*                   y,
+                hipsparseDiagType_t  diag_type,
+                hipsparseFillMode_t  fill_mode,
+                hipsparseIndexBase_t base,
+                J*                   struct_pivot,
+                J*                   numeric_pivot)
 {
-    // Initialize pivots
-    *struct_pivot  = mb + 1;
-    *numeric_pivot = mb + 1;
-
-    // Temporary vector to hold diagonal offset to access diagonal BSR block
-    std::vector<int> diag_offset(mb);
-    std::vector<int> nnz_entries(mb, -1);
+    // Initialize pivot
+    *struct_pivot  = M + 1;
+    *numeric_pivot = M + 1;
 
-    // First diagonal block is index 0
-    if(mb > 0)
+    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
     {
-        diag_offset[0] = 0;
-    }
-
-    // Loop over all BSR rows
-    for(int i = 0; i < mb; ++i)
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        {
+            host_csr_lsolve(M,
+                            alpha,
+                            csr_row_ptr,
+                            csr_col_ind,
+                            csr_val,
+                            x,
+                            y,
+                            diag_type,
+                            base,
+                            struct_pivot,
+                            numeric_pivot);
+        }
+        else
+        {
+            host_csr_usolve(M,
+                            alpha,
+                            csr_row_ptr,
+                            csr_col_ind,
+                            csr_val,
+                            x,
+                            y,
+                            diag_type,
+                            base,
+                            struct_pivot,
+                            numeric_pivot);
+        }
+    }
+    else if(trans == HIPSPARSE_OPERATION_TRANSPOSE
+            || trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
     {
-        // Flag whether we have a diagonal block or not
-        bool has_diag = false;
-
-        // BSR column entry and exit point
-        int row_begin = bsr_row_ptr[i] - base;
-        int row_end   = bsr_row_ptr[i + 1] - base;
-
-        int j;
+        // Transpose matrix
+        std::vector<I> csrt_row_ptr(M + 1);
+        std::vector<J> csrt_col_ind(nnz);
+        std::vector<T> csrt_val(nnz);
 
-        // Set up entry points for linear combination
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = j;
-        }
+        host_csr_to_csc(M,
+                        M,
+                        nnz,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        csrt_col_ind,
+                        csrt_row_ptr,
+                        csrt_val,
+                        HIPSPARSE_ACTION_NUMERIC,
+                        base);
 
-        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
-        for(j = row_begin; j < row_end; ++j)
+        if(trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
         {
-            // Column index of current BSR block
-            int bsr_col = bsr_col_ind[j] - base;
-
-            // If this is a diagonal block, set diagonal flag to true and skip
-            // all upcoming blocks as we exceed the lower matrix part
-            if(bsr_col == i)
+            for(size_t i = 0; i < csrt_val.size(); i++)
             {
-                has_diag = true;
-                break;
+                csrt_val[i] = testing_conj(csrt_val[i]);
             }
+        }
 
-            // Skip all upper matrix blocks
-            if(bsr_col > i)
-            {
-                break;
-            }
+        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        {
+            host_csr_usolve(M,
+                            alpha,
+                            csrt_row_ptr.data(),
+                            csrt_col_ind.data(),
+                            csrt_val.data(),
+                            x,
+                            y,
+                            diag_type,
+                            base,
+                            struct_pivot,
+                            numeric_pivot);
+        }
+        else
+        {
+            host_csr_lsolve(M,
+                            alpha,
+                            csrt_row_ptr.data(),
+                            csrt_col_ind.data(),
+                            csrt_val.data(),
+                            x,
+                            y,
+                            diag_type,
+                            base,
+                            struct_pivot,
+                            numeric_pivot);
+        }
+    }
 
-            // Process all lower matrix BSR blocks
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
 
-            // Obtain corresponding row entry and exit point that corresponds with the
-            // current BSR column. Actually, we skip all lower matrix column indices,
-            // therefore starting with the diagonal entry.
-            int diag_j    = diag_offset[bsr_col];
-            int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+}
 
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+/* ============================================================================================ */
+/*! \brief  Preconditioned Krylov solver, host reference of hipsparseSolver_solve. The methods
+ *  follow the device implementation step by step, such that the iteration counts agree up to
+ *  rounding.
+ */
+#if(!defined(CUDART_VERSION))
+template <typename I, typename J, typename T>
+void host_solver(hipsparseSolverAlg_t     alg,
+                 hipsparseSolverPrecond_t precond,
+                 int                      max_iterations,
+                 double                   tolerance,
+                 int                      restart,
+                 J                        M,
+                 I                        nnz,
+                 const I*                 csr_row_ptr,
+                 const J*                 csr_col_ind,
+                 const T*                 csr_val,
+                 const T*                 b,
+                 T*                       x,
+                 hipsparseIndexBase_t     base,
+                 int*                     iterations,
+                 double*                  residual,
+                 int*                     converged,
+                 std::vector<double>&     history)
+{
+    const T zero = make_DataType<T>(0.0);
+    const T one  = make_DataType<T>(1.0);
 
-                // Process all rows within the BSR block
-                for(int bk = 0; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+    *iterations = 0;
+    *residual   = 0.0;
+    *converged  = 0;
+    history.clear();
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
+    // Preconditioner setup
+    std::vector<T>   inverse_diagonal;
+    std::vector<int> factor_row_ptr;
+    std::vector<int> factor_col_ind;
+    std::vector<T>   factor_val;
 
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(diag_j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
-            }
+    if(precond == HIPSPARSE_SOLVER_PRECOND_JACOBI)
+    {
+        inverse_diagonal.resize(M, zero);
 
-            // Loop over upper offset pointer and do linear combination for nnz entry
-            for(int k = diag_j + 1; k < row_end_j; ++k)
+        for(J i = 0; i < M; ++i)
+        {
+            for(I k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
             {
-                int bsr_col_k = bsr_col_ind[k] - base;
-
-                if(nnz_entries[bsr_col_k] != -1)
+                if(csr_col_ind[k] - base == i)
                 {
-                    int m = nnz_entries[bsr_col_k];
-
-                    // Loop through all rows within the BSR block
-                    for(int bi = 0; bi < bsr_dim; ++bi)
-                    {
-                        // Loop through columns of bi-th row and do linear combination
-                        for(int bj = 0; bj < bsr_dim; ++bj)
-                        {
-                            T sum = make_DataType<T>(0);
-
-                            for(int bk = 0; bk < bsr_dim; ++bk)
-                            {
-                                sum = testing_fma(bsr_val[BSR_IND(j, bi, bk, dir)],
-                                                  bsr_val[BSR_IND(k, bk, bj, dir)],
-                                                  sum);
-                            }
-
-                            bsr_val[BSR_IND(m, bi, bj, dir)]
-                                = bsr_val[BSR_IND(m, bi, bj, dir)] - sum;
-                        }
-                    }
+                    inverse_diagonal[i] = testing_div(one, csr_val[k]);
+                    break;
                 }
             }
         }
+    }
+    else if(precond == HIPSPARSE_SOLVER_PRECOND_ILU0 || precond == HIPSPARSE_SOLVER_PRECOND_IC0)
+    {
+        factor_row_ptr.assign(csr_row_ptr, csr_row_ptr + M + 1);
+        factor_col_ind.assign(csr_col_ind, csr_col_ind + nnz);
+        factor_val.assign(csr_val, csr_val + nnz);
 
-        // Check for structural pivot
-        if(!has_diag)
+        if(precond == HIPSPARSE_SOLVER_PRECOND_ILU0)
         {
-            *struct_pivot = std::min(*struct_pivot, i + base);
-            break;
+            csrilu0(M,
+                    factor_row_ptr.data(),
+                    factor_col_ind.data(),
+                    factor_val.data(),
+                    base,
+                    false,
+                    0.0,
+                    zero);
         }
-
-        // Process diagonal
-        if(bsr_col_ind[j] - base == i)
+        else
         {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
-
-                if(boost)
-                {
-                    diag = (boost_tol >= testing_abs(diag)) ? boost_val : diag;
-                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
-                }
-                else
-                {
-                    // Check for numeric pivot
-                    if(diag == make_DataType<T>(0))
-                    {
-                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
-                        continue;
-                    }
-                }
-
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
-
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val = testing_div(val, diag);
-
-                    // Loop through remaining columns of bk-th row and do linear combination
-                    for(int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-val,
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
-            }
+            int struct_pivot;
+            int numeric_pivot;
+            csric0(M,
+                   factor_row_ptr.data(),
+                   factor_col_ind.data(),
+                   factor_val.data(),
+                   base,
+                   struct_pivot,
+                   numeric_pivot);
         }
+    }
 
-        // Store diagonal BSR block entry point
-        int row_diag = diag_offset[i] = j;
+    std::vector<T> temp(M);
 
-        // Process upper diagonal BSR blocks
-        for(j = row_diag + 1; j < row_end; ++j)
+    // z = M^-1 * r
+    auto apply_precond = [&](const std::vector<T>& r, std::vector<T>& z) {
+        int struct_pivot;
+        int numeric_pivot;
+
+        switch(precond)
         {
-            // Loop through all rows within the BSR block
-            for(int bi = 0; bi < bsr_dim; ++bi)
+        case HIPSPARSE_SOLVER_PRECOND_NONE:
+            z = r;
+            break;
+        case HIPSPARSE_SOLVER_PRECOND_JACOBI:
+            for(J i = 0; i < M; ++i)
             {
-                // Process all rows within the BSR block after bi-th row
-                for(int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    // Loop through columns of bk-th row and do linear combination
-                    for(int bj = 0; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = testing_fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
-                                          bsr_val[BSR_IND(j, bi, bj, dir)],
-                                          bsr_val[BSR_IND(j, bk, bj, dir)]);
-                    }
-                }
+                z[i] = testing_mult(inverse_diagonal[i], r[i]);
             }
+            break;
+        case HIPSPARSE_SOLVER_PRECOND_ILU0:
+        case HIPSPARSE_SOLVER_PRECOND_IC0:
+            host_csrsv(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                       (int)M,
+                       (int)nnz,
+                       one,
+                       factor_row_ptr.data(),
+                       factor_col_ind.data(),
+                       factor_val.data(),
+                       r.data(),
+                       temp.data(),
+                       (precond == HIPSPARSE_SOLVER_PRECOND_ILU0) ? HIPSPARSE_DIAG_TYPE_UNIT
+                                                                  : HIPSPARSE_DIAG_TYPE_NON_UNIT,
+                       HIPSPARSE_FILL_MODE_LOWER,
+                       base,
+                       &struct_pivot,
+                       &numeric_pivot);
+            host_csrsv((precond == HIPSPARSE_SOLVER_PRECOND_ILU0)
+                           ? HIPSPARSE_OPERATION_NON_TRANSPOSE
+                           : HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE,
+                       (int)M,
+                       (int)nnz,
+                       one,
+                       factor_row_ptr.data(),
+                       factor_col_ind.data(),
+                       factor_val.data(),
+                       temp.data(),
+                       z.data(),
+                       HIPSPARSE_DIAG_TYPE_NON_UNIT,
+                       (precond == HIPSPARSE_SOLVER_PRECOND_ILU0) ? HIPSPARSE_FILL_MODE_UPPER
+                                                                  : HIPSPARSE_FILL_MODE_LOWER,
+                       base,
+                       &struct_pivot,
+                       &numeric_pivot);
+            break;
+        }
+    };
+
+    // y = A * x
+    auto spmv = [&](const std::vector<T>& v, std::vector<T>& y) {
+        host_csrmv(HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                   M,
+                   M,
+                   nnz,
+                   one,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   csr_val,
+                   v.data(),
+                   zero,
+                   y.data(),
+                   base);
+    };
+
+    // x^H * y
+    auto dot = [&](const std::vector<T>& u, const std::vector<T>& v) {
+        T sum = zero;
+        for(J i = 0; i < M; ++i)
+        {
+            sum = testing_fma(testing_conj(u[i]), v[i], sum);
         }
+        return sum;
+    };
 
-        // Reset entry points
-        for(j = row_begin; j < row_end; ++j)
+    // y = alpha * x + beta * y
+    auto axpby = [&](T alpha, const std::vector<T>& u, T beta, std::vector<T>& v) {
+        for(J i = 0; i < M; ++i)
         {
-            int col_j          = bsr_col_ind[j] - base;
-            nnz_entries[col_j] = -1;
+            v[i] = testing_fma(alpha, u[i], testing_mult(beta, v[i]));
         }
-    }
+    };
 
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
-}
+    auto norm = [&](T squared_norm) { return std::sqrt((double)testing_abs(squared_norm)); };
 
-template <typename T>
-inline void host_bsric02(hipsparseDirection_t    direction,
-                         int                     Mb,
-                         int                     block_dim,
-                         const std::vector<int>& bsr_row_ptr,
-                         const std::vector<int>& bsr_col_ind,
-                         std::vector<T>&         bsr_val,
-                         hipsparseIndexBase_t    base,
-                         int*                    struct_pivot,
-                         int*                    numeric_pivot)
-{
-    int M = Mb * block_dim;
+    std::vector<T> vb(b, b + M);
+    std::vector<T> vx(x, x + M);
+    std::vector<T> r(M);
 
-    // Initialize pivot
-    *struct_pivot  = -1;
-    *numeric_pivot = -1;
+    // r = b - A * x
+    spmv(vx, r);
+    axpby(one, vb, make_DataType<T>(-1.0), r);
 
-    if(bsr_col_ind.size() == 0 && bsr_val.size() == 0)
-    {
-        return;
-    }
+    const double norm_b = norm(dot(vb, vb));
+    double       res    = (norm_b > 0.0) ? norm(dot(r, r)) / norm_b : 0.0;
 
-    // pointer of upper part of each row
-    std::vector<int> diag_block_offset(Mb);
-    std::vector<int> diag_offset(M, -1);
-    std::vector<int> nnz_entries(M, -1);
+    history.push_back(res);
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int i = 0; i < Mb; i++)
+    if(alg == HIPSPARSE_SOLVER_CG)
     {
-        int row_begin = bsr_row_ptr[i] - base;
-        int row_end   = bsr_row_ptr[i + 1] - base;
+        std::vector<T> z(M), p(M), q(M);
 
-        for(int j = row_begin; j < row_end; j++)
+        apply_precond(r, z);
+        p = z;
+
+        T rho = dot(r, z);
+
+        while(res > tolerance && *iterations < max_iterations)
         {
-            if(bsr_col_ind[j] - base == i)
+            spmv(p, q);
+
+            T pq = dot(p, q);
+            if(pq == zero)
+            {
+                break;
+            }
+
+            T alpha = testing_div(rho, pq);
+
+            axpby(alpha, p, one, vx);
+            axpby(-alpha, q, one, r);
+            apply_precond(r, z);
+
+            T rho_new = dot(r, z);
+
+            ++*iterations;
+            res = norm(dot(r, r)) / norm_b;
+            history.push_back(res);
+
+            if(rho == zero)
             {
-                diag_block_offset[i] = j;
                 break;
             }
+
+            T beta = testing_div(rho_new, rho);
+            rho    = rho_new;
+
+            axpby(one, z, beta, p);
         }
     }
-
-    for(int i = 0; i < M; i++)
+    else if(alg == HIPSPARSE_SOLVER_BICGSTAB)
     {
-        int local_row = i % block_dim;
+        std::vector<T> r0(r), p(r), v(M), s(M), t(M), phat(M), shat(M);
 
-        int row_begin = bsr_row_ptr[i / block_dim] - base;
-        int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
+        T rho = dot(r0, r);
 
-        for(int j = row_begin; j < row_end; j++)
+        while(res > tolerance && *iterations < max_iterations)
         {
-            int block_col_j = bsr_col_ind[j] - base;
+            apply_precond(p, phat);
+            spmv(phat, v);
 
-            for(int k = 0; k < block_dim; k++)
+            T r0v = dot(r0, v);
+            if(r0v == zero)
             {
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * local_row + k;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * k + local_row;
-                }
+                break;
             }
-        }
 
-        T   sum            = make_DataType<T>(0);
-        int diag_val_index = -1;
+            T alpha = testing_div(rho, r0v);
 
-        bool has_diag         = false;
-        bool break_outer_loop = false;
+            s = r;
+            axpby(-alpha, v, one, s);
+            apply_precond(s, shat);
+            spmv(shat, t);
 
-        for(int j = row_begin; j < row_end; j++)
-        {
-            int block_col_j = bsr_col_ind[j] - base;
+            T ss = dot(s, s);
+            T ts = dot(t, s);
+            T tt = dot(t, t);
 
-            for(int k = 0; k < block_dim; k++)
+            ++*iterations;
+
+            const double res_s = norm(ss) / norm_b;
+            if(res_s <= tolerance || tt == zero)
             {
-                int col_j = block_dim * block_col_j + k;
+                axpby(alpha, phat, one, vx);
+                r = s;
 
-                // Mark diagonal and skip row
-                if(col_j == i)
-                {
-                    diag_val_index = block_dim * block_dim * j + block_dim * k + k;
+                res = res_s;
+                history.push_back(res);
+                break;
+            }
 
-                    has_diag         = true;
-                    break_outer_loop = true;
-                    break;
-                }
+            T omega = testing_div(ts, tt);
 
-                // Skip upper triangular
-                if(col_j > i)
-                {
-                    break_outer_loop = true;
-                    break;
-                }
+            axpby(alpha, phat, one, vx);
+            axpby(omega, shat, one, vx);
+            r = s;
+            axpby(-omega, t, one, r);
 
-                T val_j;
-                if(direction == HIPSPARSE_DIRECTION_ROW)
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
-                }
-                else
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
-                }
+            T rho_new = dot(r0, r);
 
-                int local_row_j = col_j % block_dim;
+            res = norm(dot(r, r)) / norm_b;
+            history.push_back(res);
 
-                int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
-                int row_end_j   = diag_block_offset[col_j / block_dim];
-                int row_diag_j  = diag_offset[col_j];
+            if(rho == zero || omega == zero)
+            {
+                break;
+            }
 
-                T local_sum = make_DataType<T>(0);
-                T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : make_DataType<T>(0);
+            T beta = testing_mult(testing_div(rho_new, rho), testing_div(alpha, omega));
+            rho    = rho_new;
 
-                // Check for numeric zero
-                if(inv_diag == make_DataType<T>(0))
-                {
-                    // Numerical non-invertible block diagonal
-                    if(*numeric_pivot == -1)
-                    {
-                        *numeric_pivot = block_col_j + base;
-                    }
+            axpby(-omega, v, one, p);
+            axpby(one, r, beta, p);
+        }
+    }
+    else if(alg == HIPSPARSE_SOLVER_GMRES)
+    {
+        const int m = restart;
 
-                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
+        std::vector<std::vector<T>> V(m + 1, std::vector<T>(M));
+        std::vector<T>              w(M), z(M);
+        std::vector<T>              H((m + 1) * m, zero);
+        std::vector<T>              g(m + 1), y(m), cs(m), sn(m);
 
-                    inv_diag = make_DataType<T>(1);
-                }
+        auto h = [&](int i, int j) -> T& { return H[i + j * (m + 1)]; };
 
-                inv_diag = testing_div(make_DataType<T>(1), inv_diag);
+        double norm_r = norm(dot(r, r));
 
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(int l = row_begin_j; l < row_end_j + 1; l++)
+        while(res > tolerance && *iterations < max_iterations)
+        {
+            V[0] = r;
+            axpby(zero, V[0], make_DataType<T>(1.0 / norm_r), V[0]);
+
+            std::fill(g.begin(), g.end(), zero);
+            g[0] = make_DataType<T>(norm_r);
+
+            int  k         = 0;
+            bool breakdown = false;
+
+            while(k < m && *iterations < max_iterations)
+            {
+                const int j = k;
+
+                apply_precond(V[j], z);
+                spmv(z, w);
+
+                for(int i = 0; i <= j; ++i)
                 {
-                    int block_col_l = bsr_col_ind[l] - base;
+                    h(i, j) = zero;
+                }
 
-                    for(int m = 0; m < block_dim; m++)
+                // Two passes of classical Gram-Schmidt
+                for(int pass = 0; pass < 2; ++pass)
+                {
+                    std::vector<T> proj(j + 1);
+                    for(int i = 0; i <= j; ++i)
                     {
-                        int idx = nnz_entries[block_dim * block_col_l + m];
+                        proj[i] = dot(V[i], w);
+                    }
 
-                        if(idx != -1 && block_dim * block_col_l + m < col_j)
-                        {
-                            if(direction == HIPSPARSE_DIRECTION_ROW)
-                            {
-                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
-                                                                + block_dim * local_row_j + m],
-                                                        testing_conj(bsr_val[idx]),
-                                                        local_sum);
-                            }
-                            else
-                            {
-                                local_sum = testing_fma(bsr_val[block_dim * block_dim * l
-                                                                + block_dim * m + local_row_j],
-                                                        testing_conj(bsr_val[idx]),
-                                                        local_sum);
-                            }
-                        }
+                    for(int i = 0; i <= j; ++i)
+                    {
+                        axpby(-proj[i], V[i], one, w);
+                        h(i, j) = h(i, j) + proj[i];
                     }
                 }
 
-                val_j = testing_mult((val_j - local_sum), inv_diag);
-                sum   = testing_fma(val_j, testing_conj(val_j), sum);
+                const double norm_w = norm(dot(w, w));
+                h(j + 1, j)         = make_DataType<T>(norm_w);
 
-                if(direction == HIPSPARSE_DIRECTION_ROW)
+                if(norm_w > 0.0)
                 {
-                    bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
+                    V[j + 1] = w;
+                    axpby(zero, V[j + 1], make_DataType<T>(1.0 / norm_w), V[j + 1]);
                 }
                 else
                 {
-                    bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
+                    breakdown = true;
                 }
-            }
-
-            if(break_outer_loop)
-            {
-                break;
-            }
-        }
-
-        if(!has_diag)
-        {
-            // Structural missing block diagonal
-            if(*struct_pivot == -1)
-            {
-                *struct_pivot = i / block_dim + base;
-            }
-        }
-
-        // Process diagonal entry
-        if(has_diag)
-        {
-            T diag_entry = make_DataType<T>(std::sqrt(testing_abs(bsr_val[diag_val_index] - sum)));
-            bsr_val[diag_val_index] = diag_entry;
 
-            if(diag_entry == make_DataType<T>(0))
-            {
-                // Numerical non-invertible block diagonal
-                if(*numeric_pivot == -1)
+                // Apply the previous Givens rotations to the new column
+                for(int i = 0; i < j; ++i)
                 {
-                    *numeric_pivot = i / block_dim + base;
+                    T temp_h    = cs[i] * h(i, j) + sn[i] * h(i + 1, j);
+                    h(i + 1, j) = -testing_conj(sn[i]) * h(i, j) + cs[i] * h(i + 1, j);
+                    h(i, j)     = temp_h;
                 }
 
-                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
-            }
-
-            // Store diagonal offset
-            diag_offset[i] = diag_val_index;
-        }
-
-        for(int j = row_begin; j < row_end; j++)
-        {
-            int block_col_j = bsr_col_ind[j] - base;
+                // Rotation that eliminates h(j + 1, j)
+                const double abs_a = testing_abs(h(j, j));
+                const double abs_b = testing_abs(h(j + 1, j));
+                const double nrm   = std::sqrt(abs_a * abs_a + abs_b * abs_b);
 
-            for(int k = 0; k < block_dim; k++)
-            {
-                if(direction == HIPSPARSE_DIRECTION_ROW)
+                if(nrm == 0.0)
                 {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    cs[j] = one;
+                    sn[j] = zero;
                 }
-                else
+                else if(abs_a == 0.0)
                 {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    cs[j] = zero;
+                    sn[j] = testing_div(testing_conj(h(j + 1, j)), make_DataType<T>(abs_b));
                 }
-            }
-        }
-    }
-}
+                else
+                {
+                    T phase = testing_div(h(j, j), make_DataType<T>(abs_a));
 
-template <typename T>
-void csric0(int                  M,
-            const int*           csr_row_ptr,
-            const int*           csr_col_ind,
-            T*                   csr_val,
-            hipsparseIndexBase_t idx_base,
-            int&                 struct_pivot,
-            int&                 numeric_pivot)
-{
-    // Initialize pivot
-    struct_pivot  = -1;
-    numeric_pivot = -1;
+                    cs[j] = make_DataType<T>(abs_a / nrm);
+                    sn[j] = testing_div(phase * testing_conj(h(j + 1, j)), make_DataType<T>(nrm));
+                }
 
-    // pointer of upper part of each row
-    std::vector<int> diag_offset(M);
-    std::vector<int> nnz_entries(M, 0);
+                h(j, j)     = cs[j] * h(j, j) + sn[j] * h(j + 1, j);
+                h(j + 1, j) = zero;
+                g[j + 1]    = -testing_conj(sn[j]) * g[j];
+                g[j]        = cs[j] * g[j];
 
-    // ai = 0 to N loop over all rows
-    for(int ai = 0; ai < M; ++ai)
-    {
-        // ai-th row entries
-        int row_begin = csr_row_ptr[ai] - idx_base;
-        int row_end   = csr_row_ptr[ai + 1] - idx_base;
-        int j;
+                ++k;
+                ++*iterations;
 
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - idx_base] = j;
-        }
+                res = testing_abs(g[j + 1]) / norm_b;
+                history.push_back(res);
 
-        T sum = make_DataType<T>(0.0);
+                if(res <= tolerance || breakdown)
+                {
+                    break;
+                }
+            }
 
-        bool has_diag = false;
+            // Solve the upper triangular system H(0:k, 0:k) * y = g(0:k)
+            for(int i = k - 1; i >= 0; --i)
+            {
+                T sum = g[i];
+                for(int l = i + 1; l < k; ++l)
+                {
+                    sum = sum - h(i, l) * y[l];
+                }
 
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            int col_j = csr_col_ind[j] - idx_base;
-            T   val_j = csr_val[j];
+                y[i] = (h(i, i) != zero) ? testing_div(sum, h(i, i)) : zero;
+            }
 
-            // Mark diagonal and skip row
-            if(col_j == ai)
+            // x = x + M^-1 * V * y
+            std::fill(w.begin(), w.end(), zero);
+            for(int i = 0; i < k; ++i)
             {
-                has_diag = true;
-                break;
+                axpby(y[i], V[i], one, w);
             }
 
-            // Skip upper triangular
-            if(col_j > ai)
+            apply_precond(w, z);
+            axpby(one, z, one, vx);
+
+            // Residual of the restart
+            spmv(vx, r);
+            axpby(one, vb, make_DataType<T>(-1.0), r);
+
+            norm_r = norm(dot(r, r));
+            res    = norm_r / norm_b;
+
+            if(breakdown)
             {
                 break;
             }
+        }
+    }
 
-            int row_begin_j = csr_row_ptr[col_j] - idx_base;
-            int row_diag_j  = diag_offset[col_j];
+    std::copy(vx.begin(), vx.end(), x);
 
-            T local_sum = make_DataType<T>(0.0);
-            T inv_diag  = csr_val[row_diag_j];
+    *residual  = res;
+    *converged = (res <= tolerance) ? 1 : 0;
+}
+#endif
 
-            // Check for numeric zero
-            if(inv_diag == make_DataType<T>(0.0))
-            {
-                // Numerical zero diagonal
-                numeric_pivot = col_j + idx_base;
-                return;
+/* ============================================================================================ */
+/*! \brief  Multicolor smoother, host reference of hipsparseSmoother_smooth. The rows of one
+ *  color are relaxed from the iterate before the color, such that the order of the rows within
+ *  a color does not matter.
+ */
+#if(!defined(CUDART_VERSION))
+template <typename I, typename J, typename T>
+void host_smoother(hipsparseSmootherAlg_t alg,
+                   int                    sweeps,
+                   double                 omega,
+                   J                      M,
+                   const I*               csr_row_ptr,
+                   const J*               csr_col_ind,
+                   const T*               csr_val,
+                   int                    ncolors,
+                   const int*             coloring,
+                   const T*               b,
+                   T*                     x,
+                   hipsparseIndexBase_t   base)
+{
+    std::vector<T> diagonal(M, make_DataType<T>(0.0));
+    for(J i = 0; i < M; ++i)
+    {
+        for(I k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            if(csr_col_ind[k] - base == i)
+            {
+                diagonal[i] = diagonal[i] + csr_val[k];
             }
+        }
+    }
 
-            inv_diag = testing_div(make_DataType<T>(1.0), inv_diag);
+    const T weight = (alg == HIPSPARSE_SMOOTHER_JACOBI || alg == HIPSPARSE_SMOOTHER_SOR)
+                         ? make_DataType<T>(omega)
+                         : make_DataType<T>(1.0);
 
-            // loop over upper offset pointer and do linear combination for nnz entry
-            for(int k = row_begin_j; k < row_diag_j; ++k)
-            {
-                int col_k = csr_col_ind[k] - idx_base;
+    // Relax all rows of color c, or all rows if c is negative
+    std::vector<T> x_old(M);
+    auto           relax = [&](int c) {
+        std::copy(x, x + M, x_old.begin());
 
-                // if nnz at this position do linear combination
-                if(nnz_entries[col_k] != 0)
-                {
-                    int idx   = nnz_entries[col_k];
-                    local_sum = testing_fma(csr_val[k], testing_conj(csr_val[idx]), local_sum);
-                }
+        for(J i = 0; i < M; ++i)
+        {
+            if(c >= 0 && coloring[i] != c)
+            {
+                continue;
             }
 
-            val_j = testing_mult((val_j - local_sum), inv_diag);
-            sum   = testing_fma(val_j, testing_conj(val_j), sum);
+            T r = b[i];
+            for(I k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+            {
+                r = r - csr_val[k] * x_old[csr_col_ind[k] - base];
+            }
 
-            csr_val[j] = val_j;
+            x[i] = x_old[i] + weight * r / diagonal[i];
         }
+    };
 
-        if(!has_diag)
+    for(int sweep = 0; sweep < sweeps; ++sweep)
+    {
+        if(alg == HIPSPARSE_SMOOTHER_JACOBI)
         {
-            // Structural (and numerical) zero diagonal
-            struct_pivot  = ai + idx_base;
-            numeric_pivot = ai + idx_base;
-            return;
+            relax(-1);
+            continue;
         }
 
-        // Process diagonal entry
-        T diag_entry = make_DataType<T>(std::sqrt(testing_abs(csr_val[j] - sum)));
-        csr_val[j]   = diag_entry;
-
-        // Store diagonal offset
-        diag_offset[ai] = j;
+        for(int c = 0; c < ncolors; ++c)
+        {
+            relax(c);
+        }
 
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
+        if(alg == HIPSPARSE_SMOOTHER_SYMMETRIC_GAUSS_SEIDEL)
         {
-            nnz_entries[csr_col_ind[j] - idx_base] = 0;
+            for(int c = ncolors - 1; c >= 0; --c)
+            {
+                relax(c);
+            }
         }
     }
 }
+#endif
 
 /* ============================================================================================ */
-/*! \brief  Sparse triangular system solve using CSR storage format. */
-template <typename I, typename J, typename T>
-static inline void host_lssolve(J                     M,
-                                J                     nrhs,
-                                hipsparseOperation_t  transB,
-                                T                     alpha,
-                                const std::vector<I>& csr_row_ptr,
-                                const std::vector<J>& csr_col_ind,
-                                const std::vector<T>& csr_val,
-                                std::vector<T>&       B,
-                                J                     ldb,
-                                hipsparseOrder_t      order_B,
-                                hipsparseDiagType_t   diag_type,
-                                hipsparseIndexBase_t  base,
-                                J*                    struct_pivot,
-                                J*                    numeric_pivot)
+/*! \brief  Reverse Cuthill-McKee permutation of the pattern of A + A^T, host reference of
+ *  hipsparseXcsrrcm. Row i of P A P^T is row perm[i] of A.
+ */
+inline void host_csrrcm(int                     M,
+                        const std::vector<int>& csr_row_ptr,
+                        const std::vector<int>& csr_col_ind,
+                        std::vector<int>&       perm,
+                        hipsparseIndexBase_t    base)
 {
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    std::ignore = hipGetDevice(&dev);
-    std::ignore = hipGetDeviceProperties(&prop, dev);
-
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
+    std::vector<std::vector<int>> adj(M);
+    for(int i = 0; i < M; ++i)
     {
-        std::vector<T> temp(prop.warpSize);
-
-        // Process lower triangular part
-        for(J row = 0; row < M; ++row)
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
         {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
-
-            J idx_B
-                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
-            }
-            else
+            const int j = csr_col_ind[k] - base;
+            if(j != i)
             {
-                temp[0] = testing_mult(alpha, B[idx_B]);
+                adj[i].push_back(j);
+                adj[j].push_back(i);
             }
+        }
+    }
 
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
+    for(int i = 0; i < M; ++i)
+    {
+        std::sort(adj[i].begin(), adj[i].end());
+        adj[i].erase(std::unique(adj[i].begin(), adj[i].end()), adj[i].end());
+    }
 
-            T diag_val = make_DataType<T>(0.0);
+    auto less_degree = [&adj](int a, int b) {
+        return adj[a].size() < adj[b].size() || (adj[a].size() == adj[b].size() && a < b);
+    };
 
-            for(I l = row_begin; l < row_end; l += prop.warpSize)
+    // Levels of a breadth first search from root
+    auto levels = [&adj, M](int root) {
+        std::vector<std::vector<int>> level{{root}};
+        std::vector<bool>             seen(M, false);
+        seen[root] = true;
+
+        while(true)
+        {
+            std::vector<int> next;
+            for(int u : level.back())
             {
-                for(int k = 0; k < prop.warpSize; ++k)
+                for(int v : adj[u])
                 {
-                    I j = l + k;
-
-                    // Do not run out of bounds
-                    if(j >= row_end)
+                    if(!seen[v])
                     {
-                        break;
+                        seen[v] = true;
+                        next.push_back(v);
                     }
+                }
+            }
 
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
+            if(next.empty())
+            {
+                return level;
+            }
 
-                    if(local_val == make_DataType<T>(0.0) && local_col == row
-                       && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Numerical zero pivot found, avoid division by 0 and store
-                        // index for later use
-                        *numeric_pivot = std::min(*numeric_pivot, row + base);
-                        local_val      = make_DataType<T>(1.0);
-                    }
+            level.push_back(next);
+        }
+    };
 
-                    // Ignore all entries that are above the diagonal
-                    if(local_col > row)
-                    {
-                        break;
-                    }
+    std::vector<bool> ordered(M, false);
+    std::vector<int>  order;
 
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        // If diagonal type is non unit, do division by diagonal entry
-                        // This is not required for unit diagonal for obvious reasons
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            diag     = j;
-                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
-                        }
+    for(int seed = 0; seed < M; ++seed)
+    {
+        if(ordered[seed])
+        {
+            continue;
+        }
 
-                        break;
-                    }
+        // Node of minimum degree of the component
+        std::vector<int> component;
+        for(const std::vector<int>& l : levels(seed))
+        {
+            component.insert(component.end(), l.begin(), l.end());
+        }
 
-                    // Lower triangular part
-                    J idx     = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                             && order_B == HIPSPARSE_ORDER_COL)
-                                    ? i * ldb + local_col
-                                    : local_col * ldb + i;
-                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
+        int root = *std::min_element(component.begin(), component.end(), less_degree);
 
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
-                    {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
-                    }
-                }
-            }
+        // Pseudo-peripheral node
+        std::vector<std::vector<int>> root_levels = levels(root);
+        while(root_levels.size() > 1)
+        {
+            const int candidate = *std::min_element(
+                root_levels.back().begin(), root_levels.back().end(), less_degree);
 
-            for(int j = 1; j < prop.warpSize; j <<= 1)
+            std::vector<std::vector<int>> candidate_levels = levels(candidate);
+            if(candidate_levels.size() <= root_levels.size())
             {
-                for(int k = 0; k < prop.warpSize - j; ++k)
-                {
-                    temp[k] = temp[k] + temp[k + j];
-                }
+                break;
             }
 
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+            root        = candidate;
+            root_levels = candidate_levels;
+        }
+
+        // Cuthill-McKee
+        size_t head = order.size();
+        order.push_back(root);
+        ordered[root] = true;
+
+        while(head < order.size())
+        {
+            std::vector<int> next;
+            for(int v : adj[order[head++]])
             {
-                if(diag == -1)
+                if(!ordered[v])
                 {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
+                    ordered[v] = true;
+                    next.push_back(v);
                 }
-
-                B[idx_B] = testing_mult(temp[0], diag_val);
-            }
-            else
-            {
-                B[idx_B] = temp[0];
             }
+
+            std::sort(next.begin(), next.end(), less_degree);
+            order.insert(order.end(), next.begin(), next.end());
         }
     }
+
+    perm.assign(order.rbegin(), order.rend());
 }
 
-template <typename I, typename J, typename T>
-static inline void host_ussolve(J                     M,
-                                J                     nrhs,
-                                hipsparseOperation_t  transB,
-                                T                     alpha,
-                                const std::vector<I>& csr_row_ptr,
-                                const std::vector<J>& csr_col_ind,
-                                const std::vector<T>& csr_val,
-                                std::vector<T>&       B,
-                                J                     ldb,
-                                hipsparseOrder_t      order_B,
-                                hipsparseDiagType_t   diag_type,
-                                hipsparseIndexBase_t  base,
-                                J*                    struct_pivot,
-                                J*                    numeric_pivot)
+/* ============================================================================================ */
+/*! \brief  Symmetric permutation C = P A P^T with sorted columns, host reference of
+ *  hipsparseXcsrsymperm.
+ */
+template <typename T>
+void host_csrsymperm(int                     M,
+                     const std::vector<int>& csr_row_ptr_A,
+                     const std::vector<int>& csr_col_ind_A,
+                     const std::vector<T>&   csr_val_A,
+                     const std::vector<int>& perm,
+                     std::vector<int>&       csr_row_ptr_C,
+                     std::vector<int>&       csr_col_ind_C,
+                     std::vector<T>&         csr_val_C,
+                     hipsparseIndexBase_t    base_A,
+                     hipsparseIndexBase_t    base_C)
 {
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
+    std::vector<int> inverse_perm(M);
+    for(int i = 0; i < M; ++i)
+    {
+        inverse_perm[perm[i]] = i;
+    }
 
-    std::ignore = hipGetDevice(&dev);
-    std::ignore = hipGetDeviceProperties(&prop, dev);
+    csr_row_ptr_C.assign(1, base_C);
+    csr_col_ind_C.clear();
+    csr_val_C.clear();
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-    for(J i = 0; i < nrhs; ++i)
+    for(int i = 0; i < M; ++i)
     {
-        std::vector<T> temp(prop.warpSize);
-
-        // Process upper triangular part
-        for(J row = M - 1; row >= 0; --row)
+        std::vector<std::pair<int, int>> row;
+        for(int k = csr_row_ptr_A[perm[i]] - base_A; k < csr_row_ptr_A[perm[i] + 1] - base_A; ++k)
         {
-            temp.assign(prop.warpSize, make_DataType<T>(0.0));
-
-            J idx_B
-                = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE && order_B == HIPSPARSE_ORDER_COL)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-            {
-                temp[0] = testing_mult(alpha, testing_conj(B[idx_B]));
-            }
-            else
-            {
-                temp[0] = testing_mult(alpha, B[idx_B]);
-            }
+            row.emplace_back(inverse_perm[csr_col_ind_A[k] - base_A], k);
+        }
 
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
+        std::sort(row.begin(), row.end());
 
-            T diag_val = make_DataType<T>(0.0);
+        for(const std::pair<int, int>& entry : row)
+        {
+            csr_col_ind_C.push_back(entry.first + base_C);
+            csr_val_C.push_back(csr_val_A[entry.second]);
+        }
 
-            for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
-            {
-                for(int k = 0; k < prop.warpSize; ++k)
-                {
-                    I j = l - k;
+        csr_row_ptr_C.push_back(static_cast<int>(csr_col_ind_C.size()) + base_C);
+    }
+}
 
-                    // Do not run out of bounds
-                    if(j < row_begin)
-                    {
-                        break;
-                    }
+/* ============================================================================================ */
+/*! \brief  Permutation B = P A Q^T of a BSR matrix with sorted block columns, host reference of
+ *  hipsparseXbsrpermute and, with block_dim 1, of hipsparseXcsrpermute. An empty P or Q is the
+ *  identity.
+ */
+template <typename T>
+void host_bsrpermute(int                     Mb,
+                     int                     Nb,
+                     int                     block_dim,
+                     const std::vector<int>& bsr_row_ptr_A,
+                     const std::vector<int>& bsr_col_ind_A,
+                     const std::vector<T>&   bsr_val_A,
+                     const std::vector<int>& P,
+                     const std::vector<int>& Q,
+                     std::vector<int>&       bsr_row_ptr_B,
+                     std::vector<int>&       bsr_col_ind_B,
+                     std::vector<T>&         bsr_val_B,
+                     hipsparseIndexBase_t    base_A,
+                     hipsparseIndexBase_t    base_B)
+{
+    std::vector<int> inverse_Q(Nb);
+    for(int j = 0; j < Nb; ++j)
+    {
+        inverse_Q[Q.empty() ? j : Q[j]] = j;
+    }
 
-                    J local_col = csr_col_ind[j] - base;
-                    T local_val = csr_val[j];
+    const int block_size = block_dim * block_dim;
 
-                    // Ignore all entries that are below the diagonal
-                    if(local_col < row)
-                    {
-                        continue;
-                    }
+    bsr_row_ptr_B.assign(1, base_B);
+    bsr_col_ind_B.clear();
+    bsr_val_B.clear();
 
-                    // Diagonal entry
-                    if(local_col == row)
-                    {
-                        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                        {
-                            // Check for numerical zero
-                            if(local_val == make_DataType<T>(0.0))
-                            {
-                                *numeric_pivot = std::min(*numeric_pivot, row + base);
-                                local_val      = make_DataType<T>(1.0);
-                            }
+    for(int i = 0; i < Mb; ++i)
+    {
+        const int row = P.empty() ? i : P[i];
 
-                            diag     = j;
-                            diag_val = testing_div(make_DataType<T>(1.0), local_val);
-                        }
+        std::vector<std::pair<int, int>> blocks;
+        for(int k = bsr_row_ptr_A[row] - base_A; k < bsr_row_ptr_A[row + 1] - base_A; ++k)
+        {
+            blocks.emplace_back(inverse_Q[bsr_col_ind_A[k] - base_A], k);
+        }
 
-                        continue;
-                    }
+        std::sort(blocks.begin(), blocks.end());
 
-                    // Upper triangular part
-                    J idx = (transB == HIPSPARSE_OPERATION_NON_TRANSPOSE
-                             && order_B == HIPSPARSE_ORDER_COL)
-                                ? i * ldb + local_col
-                                : local_col * ldb + i;
+        for(const std::pair<int, int>& block : blocks)
+        {
+            bsr_col_ind_B.push_back(block.first + base_B);
+            bsr_val_B.insert(bsr_val_B.end(),
+                             bsr_val_A.begin() + block.second * block_size,
+                             bsr_val_A.begin() + (block.second + 1) * block_size);
+        }
 
-                    T neg_val = testing_mult(make_DataType<T>(-1.0), local_val);
+        bsr_row_ptr_B.push_back(static_cast<int>(bsr_col_ind_B.size()) + base_B);
+    }
+}
 
-                    if(transB == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
-                    {
-                        temp[k] = testing_fma(neg_val, testing_conj(B[idx]), temp[k]);
-                    }
-                    else
-                    {
-                        temp[k] = testing_fma(neg_val, B[idx], temp[k]);
-                    }
-                }
+/* ============================================================================================ */
+/*! \brief  Incomplete LU factorization with 0 fill-ins by synchronous fixed-point sweeps, host
+ *  reference of hipsparseXcsritilu0. Columns have to be sorted and every row has to contain its
+ *  diagonal. The sweeps stop after max_iter sweeps, or once the largest correction of a sweep
+ *  is at most tol. Returns the number of sweeps performed.
+ */
+template <typename T>
+int host_csritilu0(int                     M,
+                   const std::vector<int>& csr_row_ptr,
+                   const std::vector<int>& csr_col_ind,
+                   const std::vector<T>&   csr_val_A,
+                   std::vector<T>&         csr_val_M,
+                   hipsparseIndexBase_t    base,
+                   int                     max_iter,
+                   double                  tol)
+{
+    const int nnz = csr_row_ptr[M] - base;
+
+    std::vector<int> diag(M);
+    for(int i = 0; i < M; ++i)
+    {
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            if(csr_col_ind[k] - base == i)
+            {
+                diag[i] = k;
             }
+        }
+    }
 
-            for(int j = 1; j < prop.warpSize; j <<= 1)
+    // Initial guess, L is the strictly lower part of A scaled by the diagonal, U the upper part
+    csr_val_M = csr_val_A;
+    for(int i = 0; i < M; ++i)
+    {
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            const int j = csr_col_ind[k] - base;
+            if(j < i)
             {
-                for(int k = 0; k < prop.warpSize - j; ++k)
-                {
-                    temp[k] = temp[k] + temp[k + j];
-                }
+                csr_val_M[k] = testing_div(csr_val_A[k], csr_val_A[diag[j]]);
             }
+        }
+    }
 
-            if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+    std::vector<T> next(nnz);
+
+    int iter = 0;
+    while(iter < max_iter)
+    {
+        double correction = 0.0;
+
+        for(int i = 0; i < M; ++i)
+        {
+            for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
             {
-                if(diag == -1)
+                const int j   = csr_col_ind[k] - base;
+                const int lim = std::min(i, j);
+
+                // sum over L_il U_lj with l < min(i, j), both in the pattern of A
+                T sum = csr_val_A[k];
+                for(int p = csr_row_ptr[i] - base;
+                    p < csr_row_ptr[i + 1] - base && csr_col_ind[p] - base < lim;
+                    ++p)
                 {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
+                    const int l = csr_col_ind[p] - base;
+
+                    auto first = csr_col_ind.begin() + (csr_row_ptr[l] - base);
+                    auto last  = csr_col_ind.begin() + (csr_row_ptr[l + 1] - base);
+                    auto q     = std::lower_bound(first, last, j + base);
+
+                    if(q != last && *q == j + base)
+                    {
+                        const int lj = static_cast<int>(q - csr_col_ind.begin());
+                        sum = testing_fma(testing_neg(csr_val_M[p]), csr_val_M[lj], sum);
+                    }
                 }
 
-                B[idx_B] = testing_mult(temp[0], diag_val);
-            }
-            else
-            {
-                B[idx_B] = temp[0];
+                next[k] = (i > j) ? testing_div(sum, csr_val_M[diag[j]]) : sum;
+
+                correction = std::max(
+                    correction,
+                    static_cast<double>(testing_abs(
+                        testing_fma(make_DataType<T>(-1.0), csr_val_M[k], next[k]))));
             }
         }
+
+        csr_val_M.swap(next);
+        ++iter;
+
+        if(correction <= tol)
+        {
+            break;
+        }
     }
+
+    return iter;
 }
 
+/* ============================================================================================ */
+/*! \brief  Incomplete Cholesky factorization with 0 fill-ins by synchronous fixed-point sweeps,
+ *  host reference of hipsparseXcsritic0. Both triangular parts of A have to be stored. The lower
+ *  part of M holds the factor, the strictly upper part keeps the values of A. Returns the
+ *  number of sweeps performed.
+ */
 template <typename T>
-void host_bsrsm(int                  mb,
-                int                  nrhs,
-                int                  nnzb,
-                hipsparseDirection_t dir,
-                hipsparseOperation_t transA,
-                hipsparseOperation_t transX,
-                T                    alpha,
-                const int*           bsr_row_ptr,
-                const int*           bsr_col_ind,
-                const T*             bsr_val,
-                int                  bsr_dim,
-                const T*             B,
-                int                  ldb,
-                T*                   X,
-                int                  ldx,
-                hipsparseDiagType_t  diag_type,
-                hipsparseFillMode_t  fill_mode,
-                hipsparseIndexBase_t base,
-                int*                 struct_pivot,
-                int*                 numeric_pivot)
+int host_csritic0(int                     M,
+                  const std::vector<int>& csr_row_ptr,
+                  const std::vector<int>& csr_col_ind,
+                  const std::vector<T>&   csr_val_A,
+                  std::vector<T>&         csr_val_M,
+                  hipsparseIndexBase_t    base,
+                  int                     max_iter,
+                  double                  tol)
 {
-    // Initialize pivot
-    *struct_pivot  = mb + 1;
-    *numeric_pivot = mb + 1;
+    int iter
+        = host_csritilu0(M, csr_row_ptr, csr_col_ind, csr_val_A, csr_val_M, base, max_iter, tol);
 
-    if(transA == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    // L D^{1/2}, with D the diagonal of U
+    std::vector<T> sqrt_diag(M);
+    for(int i = 0; i < M; ++i)
     {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            bsr_lsolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-        else
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
         {
-            bsr_usolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
+            if(csr_col_ind[k] - base == i)
+            {
+                sqrt_diag[i] = make_DataType<T>(std::sqrt(testing_real(csr_val_M[k])));
+            }
         }
     }
-    else if(transA == HIPSPARSE_OPERATION_TRANSPOSE)
-    {
-        // Transpose matrix
-        std::vector<int> bsrt_row_ptr(mb + 1);
-        std::vector<int> bsrt_col_ind(nnzb);
-        std::vector<T>   bsrt_val(nnzb * bsr_dim * bsr_dim);
-
-        host_bsr_to_bsc(mb,
-                        mb,
-                        nnzb,
-                        bsr_dim,
-                        bsr_row_ptr,
-                        bsr_col_ind,
-                        bsr_val,
-                        bsrt_col_ind,
-                        bsrt_row_ptr,
-                        bsrt_val,
-                        base,
-                        base);
 
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            bsr_usolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsrt_row_ptr.data(),
-                       bsrt_col_ind.data(),
-                       bsrt_val.data(),
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
-        }
-        else
+    for(int i = 0; i < M; ++i)
+    {
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
         {
-            bsr_lsolve(dir,
-                       transX,
-                       mb,
-                       nrhs,
-                       alpha,
-                       bsrt_row_ptr.data(),
-                       bsrt_col_ind.data(),
-                       bsrt_val.data(),
-                       bsr_dim,
-                       B,
-                       ldb,
-                       X,
-                       ldx,
-                       diag_type,
-                       base,
-                       struct_pivot,
-                       numeric_pivot);
+            const int j = csr_col_ind[k] - base;
+            if(j < i)
+            {
+                csr_val_M[k] = testing_mult(csr_val_M[k], sqrt_diag[j]);
+            }
+            else if(j == i)
+            {
+                csr_val_M[k] = sqrt_diag[i];
+            }
+            else
+            {
+                csr_val_M[k] = csr_val_A[k];
+            }
         }
     }
 
-    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
-
-    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
+    return iter;
 }
 
-template <typename I, typename J, typename T>
-void host_csr_lsolve(J                    M,
-                     T                    alpha,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     const T*             x,
-                     T*                   y,
-                     hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
+// ILU(k), L is strictly lower and U upper including the diagonal. The factors have the index
+// base of A.
+template <typename T>
+void host_csriluk(int                     M,
+                  const std::vector<int>& csr_row_ptr,
+                  const std::vector<int>& csr_col_ind,
+                  const std::vector<T>&   csr_val,
+                  hipsparseIndexBase_t    base,
+                  int                     level,
+                  std::vector<int>&       csr_row_ptr_L,
+                  std::vector<int>&       csr_col_ind_L,
+                  std::vector<T>&         csr_val_L,
+                  std::vector<int>&       csr_row_ptr_U,
+                  std::vector<int>&       csr_col_ind_U,
+                  std::vector<T>&         csr_val_U)
 {
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
+    const int none = std::numeric_limits<int>::max();
 
-    std::ignore = hipGetDevice(&dev);
-    std::ignore = hipGetDeviceProperties(&prop, dev);
+    // Level of fill of the upper part of every row
+    std::vector<std::vector<int>> lev_U(M);
 
-    std::vector<T> temp(prop.warpSize);
+    csr_row_ptr_L.assign(M + 1, base);
+    csr_row_ptr_U.assign(M + 1, base);
+    csr_col_ind_L.clear();
+    csr_col_ind_U.clear();
+    csr_val_L.clear();
+    csr_val_U.clear();
 
-    // Process lower triangular part
-    for(J row = 0; row < M; ++row)
-    {
-        temp.assign(prop.warpSize, make_DataType<T>(0.0));
-        temp[0] = testing_mult(alpha, x[row]);
+    std::vector<int> lev(M, none);
+    std::vector<T>   w(M, make_DataType<T>(0.0));
 
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
+    for(int i = 0; i < M; ++i)
+    {
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            lev[csr_col_ind[k] - base] = 0;
+            w[csr_col_ind[k] - base]   = csr_val[k];
+        }
 
-        T diag_val = make_DataType<T>(0.0);
+        lev[i] = 0;
 
-        for(I l = row_begin; l < row_end; l += prop.warpSize)
+        // Symbolic, rows are eliminated in increasing order
+        for(int k = 0; k < i; ++k)
         {
-            for(int k = 0; k < prop.warpSize; ++k)
+            if(lev[k] == none)
             {
-                I j = l + k;
+                continue;
+            }
 
-                // Do not run out of bounds
-                if(j >= row_end)
+            for(int p = csr_row_ptr_U[k] - base + 1; p < csr_row_ptr_U[k + 1] - base; ++p)
+            {
+                const int j   = csr_col_ind_U[p] - base;
+                const int l_j = lev[k] + lev_U[k][p - (csr_row_ptr_U[k] - base)] + 1;
+                if(l_j <= level && l_j < lev[j])
                 {
-                    break;
+                    lev[j] = l_j;
                 }
+            }
+        }
 
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+        // Numeric, restricted to the pattern
+        for(int k = 0; k < i; ++k)
+        {
+            if(lev[k] == none)
+            {
+                continue;
+            }
 
-                if(local_val == make_DataType<T>(0.0) && local_col == row
-                   && diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                {
-                    // Numerical zero pivot found, avoid division by 0
-                    // and store index for later use.
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = make_DataType<T>(1);
-                }
+            const int diag = csr_row_ptr_U[k] - base;
 
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
+            w[k] = testing_div(w[k], csr_val_U[diag]);
 
-                // Diagonal entry
-                if(local_col == row)
+            for(int p = diag + 1; p < csr_row_ptr_U[k + 1] - base; ++p)
+            {
+                const int j = csr_col_ind_U[p] - base;
+                if(lev[j] != none)
                 {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        diag     = j;
-                        diag_val = testing_div(make_DataType<T>(1), local_val);
-                    }
-
-                    break;
+                    w[j] = w[j] - testing_mult(w[k], csr_val_U[p]);
                 }
-
-                // Lower triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
             }
+
+            csr_col_ind_L.push_back(k + base);
+            csr_val_L.push_back(w[k]);
         }
 
-        for(int j = 1; j < prop.warpSize; j <<= 1)
+        lev_U[i].clear();
+        for(int j = i; j < M; ++j)
         {
-            for(int k = 0; k < prop.warpSize - j; ++k)
+            if(lev[j] != none)
             {
-                temp[k] = temp[k] + temp[k + j];
+                csr_col_ind_U.push_back(j + base);
+                csr_val_U.push_back(w[j]);
+                lev_U[i].push_back(lev[j]);
             }
         }
 
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
+        csr_row_ptr_L[i + 1] = static_cast<int>(csr_col_ind_L.size()) + base;
+        csr_row_ptr_U[i + 1] = static_cast<int>(csr_col_ind_U.size()) + base;
 
-            y[row] = testing_mult(temp[0], diag_val);
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
+        std::fill(lev.begin(), lev.end(), none);
+        std::fill(w.begin(), w.end(), make_DataType<T>(0.0));
     }
 }
 
-template <typename I, typename J, typename T>
-void host_csr_usolve(J                    M,
-                     T                    alpha,
-                     const I*             csr_row_ptr,
-                     const J*             csr_col_ind,
-                     const T*             csr_val,
-                     const T*             x,
-                     T*                   y,
-                     hipsparseDiagType_t  diag_type,
-                     hipsparseIndexBase_t base,
-                     J*                   struct_pivot,
-                     J*                   numeric_pivot)
+// ILUT(tol, max_fill), entries smaller than tol times the row norm of A are dropped and the
+// max_fill largest entries of every row of L and U are kept, ties by the smaller column. Returns
+// the row of a zero pivot or -1. The factors have the index base of A.
+template <typename T>
+int host_csrilut(int                     M,
+                 const std::vector<int>& csr_row_ptr,
+                 const std::vector<int>& csr_col_ind,
+                 const std::vector<T>&   csr_val,
+                 hipsparseIndexBase_t    base,
+                 double                  tol,
+                 int                     max_fill,
+                 std::vector<int>&       csr_row_ptr_L,
+                 std::vector<int>&       csr_col_ind_L,
+                 std::vector<T>&         csr_val_L,
+                 std::vector<int>&       csr_row_ptr_U,
+                 std::vector<int>&       csr_col_ind_U,
+                 std::vector<T>&         csr_val_U)
 {
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
+    csr_row_ptr_L.assign(M + 1, base);
+    csr_row_ptr_U.assign(M + 1, base);
+    csr_col_ind_L.clear();
+    csr_col_ind_U.clear();
+    csr_val_L.clear();
+    csr_val_U.clear();
+
+    std::vector<char> nnz(M, 0);
+    std::vector<T>    w(M, make_DataType<T>(0.0));
+
+    auto larger = [](const std::pair<int, T>& a, const std::pair<int, T>& b) {
+        const double abs_a = testing_abs(a.second);
+        const double abs_b = testing_abs(b.second);
+        return abs_a > abs_b || (abs_a == abs_b && a.first < b.first);
+    };
 
-    std::ignore = hipGetDevice(&dev);
-    std::ignore = hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process upper triangular part
-    for(J row = M - 1; row >= 0; --row)
+    for(int i = 0; i < M; ++i)
     {
-        temp.assign(prop.warpSize, make_DataType<T>(0));
-        temp[0] = testing_mult(alpha, x[row]);
+        double norm = 0.0;
+        for(int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            const double a = testing_abs(csr_val[k]);
 
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
+            nnz[csr_col_ind[k] - base] = 1;
+            w[csr_col_ind[k] - base]   = csr_val[k];
+            norm += a * a;
+        }
 
-        T diag_val = make_DataType<T>(0);
+        const double tau = tol * std::sqrt(norm);
 
-        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
+        std::vector<std::pair<int, T>> row_L;
+        std::vector<std::pair<int, T>> row_U;
+
+        for(int k = 0; k < i; ++k)
         {
-            for(int k = 0; k < prop.warpSize; ++k)
+            if(!nnz[k])
             {
-                I j = l - k;
+                continue;
+            }
 
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
+            const int diag = csr_row_ptr_U[k] - base;
+            const T   w_k  = testing_div(w[k], csr_val_U[diag]);
 
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+            if(testing_abs(w_k) < tau)
+            {
+                continue;
+            }
 
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
-                {
-                    continue;
-                }
+            row_L.push_back(std::make_pair(k, w_k));
 
-                // Diagonal entry
-                if(local_col == row)
+            for(int p = diag + 1; p < csr_row_ptr_U[k + 1] - base; ++p)
+            {
+                const int j = csr_col_ind_U[p] - base;
+                if(!nnz[j])
                 {
-                    if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
-                    {
-                        // Check for numerical zero
-                        if(local_val == make_DataType<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = make_DataType<T>(1);
-                        }
-
-                        diag     = j;
-                        diag_val = testing_div(make_DataType<T>(1), local_val);
-                    }
-
-                    continue;
+                    nnz[j] = 1;
+                    w[j]   = make_DataType<T>(0.0);
                 }
 
-                // Upper triangular part
-                temp[k] = testing_fma(-local_val, y[local_col], temp[k]);
+                w[j] = w[j] - testing_mult(w_k, csr_val_U[p]);
             }
         }
 
-        for(int j = 1; j < prop.warpSize; j <<= 1)
+        if(!nnz[i] || w[i] == make_DataType<T>(0.0))
         {
-            for(int k = 0; k < prop.warpSize - j; ++k)
+            return i + base;
+        }
+
+        for(int j = i + 1; j < M; ++j)
+        {
+            if(nnz[j] && testing_abs(w[j]) >= tau)
             {
-                temp[k] = temp[k] + temp[k + j];
+                row_U.push_back(std::make_pair(j, w[j]));
             }
         }
 
-        if(diag_type == HIPSPARSE_DIAG_TYPE_NON_UNIT)
+        for(auto* row : {&row_L, &row_U})
         {
-            if(diag == -1)
+            if(row->size() > static_cast<size_t>(max_fill))
             {
-                *struct_pivot = std::min(*struct_pivot, row + base);
+                std::sort(row->begin(), row->end(), larger);
+                row->resize(max_fill);
+                std::sort(row->begin(), row->end(), [](const auto& a, const auto& b) {
+                    return a.first < b.first;
+                });
             }
+        }
 
-            y[row] = testing_mult(temp[0], diag_val);
+        for(const auto& ij : row_L)
+        {
+            csr_col_ind_L.push_back(ij.first + base);
+            csr_val_L.push_back(ij.second);
         }
-        else
+
+        csr_col_ind_U.push_back(i + base);
+        csr_val_U.push_back(w[i]);
+
+        for(const auto& ij : row_U)
         {
-            y[row] = temp[0];
+            csr_col_ind_U.push_back(ij.first + base);
+            csr_val_U.push_back(ij.second);
         }
+
+        csr_row_ptr_L[i + 1] = static_cast<int>(csr_col_ind_L.size()) + base;
+        csr_row_ptr_U[i + 1] = static_cast<int>(csr_col_ind_U.size()) + base;
+
+        std::fill(nnz.begin(), nnz.end(), 0);
+        std::fill(w.begin(), w.end(), make_DataType<T>(0.0));
     }
+
+    return -1;
 }
 
-template <typename I, typename J, typename T>
-void host_csrsv(hipsparseOperation_t trans,
-                J                    M,
-                I                    nnz,
-                T                    alpha,
-                const I*             csr_row_ptr,
-                const J*             csr_col_ind,
-                const T*             csr_val,
-                const T*             x,
-                T*                   y,
-                hipsparseDiagType_t  diag_type,
-                hipsparseFillMode_t  fill_mode,
-                hipsparseIndexBase_t base,
-                J*                   struct_pivot,
-                J*                   numeric_pivot)
+// Diagonal blocks of a BSR matrix, missing blocks are zero
+template <typename T>
+void host_bsrdiag(int                     mb,
+                  const std::vector<int>& bsr_row_ptr,
+                  const std::vector<int>& bsr_col_ind,
+                  const std::vector<T>&   bsr_val,
+                  int                     block_dim,
+                  hipsparseIndexBase_t    base,
+                  std::vector<T>&         block_diag)
 {
-    // Initialize pivot
-    *struct_pivot  = M + 1;
-    *numeric_pivot = M + 1;
+    const int block_size = block_dim * block_dim;
 
-    if(trans == HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    block_diag.assign(static_cast<size_t>(block_size) * mb, make_DataType<T>(0.0));
+
+    for(int i = 0; i < mb; ++i)
     {
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
-        {
-            host_csr_lsolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
-        }
-        else
+        for(int k = bsr_row_ptr[i] - base; k < bsr_row_ptr[i + 1] - base; ++k)
         {
-            host_csr_usolve(M,
-                            alpha,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            csr_val,
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
+            if(bsr_col_ind[k] - base == i)
+            {
+                std::copy(bsr_val.begin() + static_cast<size_t>(block_size) * k,
+                          bsr_val.begin() + static_cast<size_t>(block_size) * (k + 1),
+                          block_diag.begin() + static_cast<size_t>(block_size) * i);
+                break;
+            }
         }
     }
-    else if(trans == HIPSPARSE_OPERATION_TRANSPOSE
-            || trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+}
+
+// In place inversion of a batch of dense blocks by Gauss-Jordan elimination with partial
+// pivoting. Singular blocks are left unchanged. Returns the first singular block or -1.
+template <typename T>
+int host_bsrdiaginv(int mb, int block_dim, std::vector<T>& block_diag)
+{
+    const int n        = block_dim;
+    int       position = -1;
+
+    for(int b = 0; b < mb; ++b)
     {
-        // Transpose matrix
-        std::vector<I> csrt_row_ptr(M + 1);
-        std::vector<J> csrt_col_ind(nnz);
-        std::vector<T> csrt_val(nnz);
+        T* a = block_diag.data() + static_cast<size_t>(n) * n * b;
 
-        host_csr_to_csc(M,
-                        M,
-                        nnz,
-                        csr_row_ptr,
-                        csr_col_ind,
-                        csr_val,
-                        csrt_col_ind,
-                        csrt_row_ptr,
-                        csrt_val,
-                        HIPSPARSE_ACTION_NUMERIC,
-                        base);
+        std::vector<T> w(2 * n * n, make_DataType<T>(0.0));
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                w[2 * n * i + j] = a[n * i + j];
+            }
 
-        if(trans == HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE)
+            w[2 * n * i + n + i] = make_DataType<T>(1.0);
+        }
+
+        bool singular = false;
+        for(int k = 0; k < n && !singular; ++k)
         {
-            for(size_t i = 0; i < csrt_val.size(); i++)
+            int pivot = k;
+            for(int i = k + 1; i < n; ++i)
             {
-                csrt_val[i] = testing_conj(csrt_val[i]);
+                if(testing_abs(w[2 * n * i + k]) > testing_abs(w[2 * n * pivot + k]))
+                {
+                    pivot = i;
+                }
+            }
+
+            if(testing_abs(w[2 * n * pivot + k]) == 0.0)
+            {
+                singular = true;
+                break;
+            }
+
+            for(int j = 0; j < 2 * n; ++j)
+            {
+                std::swap(w[2 * n * k + j], w[2 * n * pivot + j]);
+            }
+
+            const T d = w[2 * n * k + k];
+            for(int j = 0; j < 2 * n; ++j)
+            {
+                w[2 * n * k + j] = testing_div(w[2 * n * k + j], d);
+            }
+
+            for(int i = 0; i < n; ++i)
+            {
+                if(i != k)
+                {
+                    const T f = w[2 * n * i + k];
+                    for(int j = 0; j < 2 * n; ++j)
+                    {
+                        w[2 * n * i + j] = w[2 * n * i + j] - testing_mult(f, w[2 * n * k + j]);
+                    }
+                }
             }
         }
 
-        if(fill_mode == HIPSPARSE_FILL_MODE_LOWER)
+        if(singular)
         {
-            host_csr_usolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
+            position = (position == -1) ? b : position;
+            continue;
         }
-        else
+
+        for(int i = 0; i < n; ++i)
         {
-            host_csr_lsolve(M,
-                            alpha,
-                            csrt_row_ptr.data(),
-                            csrt_col_ind.data(),
-                            csrt_val.data(),
-                            x,
-                            y,
-                            diag_type,
-                            base,
-                            struct_pivot,
-                            numeric_pivot);
+            for(int j = 0; j < n; ++j)
+            {
+                a[n * i + j] = w[2 * n * i + n + j];
+            }
         }
     }
 
-    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+    return position;
+}
 
-    *struct_pivot  = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
-    *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+// y = alpha * blockdiag(B) * x + beta * y
+template <typename T>
+void host_bsrdiagmv(hipsparseDirection_t  dir,
+                    int                   mb,
+                    int                   block_dim,
+                    T                     alpha,
+                    const std::vector<T>& block_diag,
+                    const std::vector<T>& x,
+                    T                     beta,
+                    std::vector<T>&       y)
+{
+    const int n = block_dim;
+
+    for(int b = 0; b < mb; ++b)
+    {
+        const T* a = block_diag.data() + static_cast<size_t>(n) * n * b;
+
+        for(int i = 0; i < n; ++i)
+        {
+            T sum = make_DataType<T>(0.0);
+            for(int j = 0; j < n; ++j)
+            {
+                const T a_ij = (dir == HIPSPARSE_DIRECTION_ROW) ? a[n * i + j] : a[n * j + i];
+
+                sum = sum + testing_mult(a_ij, x[n * b + j]);
+            }
+
+            y[n * b + i] = testing_mult(alpha, sum) + testing_mult(beta, y[n * b + i]);
+        }
+    }
 }
 
 template <typename I, typename T>
@@ -6339,7 +8324,9 @@ static void host_csrgeam(int                  M,
 }
 
 /* ============================================================================================ */
-/*! \brief  Compute sparse matrix sparse matrix multiplication. */
+/*! \brief  Compute sparse matrix sparse matrix multiplication. If the mask M is given, products
+ *  A_ik * B_kj are only accumulated if (i, j) is in the sparsity pattern of M. The values are
+ *  computed over the semiring S, the pattern does not depend on it. */
 template <typename I, typename J, typename T>
 static I host_csrgemm2_nnz(J                    m,
                            J                    n,
@@ -6356,13 +8343,17 @@ static I host_csrgemm2_nnz(J                    m,
                            hipsparseIndexBase_t idx_base_A,
                            hipsparseIndexBase_t idx_base_B,
                            hipsparseIndexBase_t idx_base_C,
-                           hipsparseIndexBase_t idx_base_D)
+                           hipsparseIndexBase_t idx_base_D,
+                           const I*             csr_row_ptr_M = nullptr,
+                           const J*             csr_col_ind_M = nullptr,
+                           hipsparseIndexBase_t idx_base_M    = HIPSPARSE_INDEX_BASE_ZERO)
 {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
         std::vector<J> nnz(n, -1);
+        std::vector<J> mask(csr_row_ptr_M != nullptr ? n : 0, -1);
 
 #ifdef _OPENMP
         int nthreads = omp_get_num_threads();
@@ -6385,6 +8376,15 @@ static I host_csrgemm2_nnz(J                    m,
             // Initialize csr row pointer with previous row offset
             csr_row_ptr_C[i + 1] = 0;
 
+            // Mark the columns of the mask in row i
+            if(csr_row_ptr_M != nullptr)
+            {
+                for(I j = csr_row_ptr_M[i] - idx_base_M; j < csr_row_ptr_M[i + 1] - idx_base_M; ++j)
+                {
+                    mask[csr_col_ind_M[j] - idx_base_M] = i;
+                }
+            }
+
             if(alpha)
             {
                 I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
@@ -6405,6 +8405,12 @@ static I host_csrgemm2_nnz(J                    m,
                         // Current column of B
                         J col_B = csr_col_ind_B[irow] - idx_base_B;
 
+                        // Skip products outside of the mask
+                        if(csr_row_ptr_M != nullptr && mask[col_B] != i)
+                        {
+                            continue;
+                        }
+
                         // Check if a new nnz is generated
                         if(nnz[col_B] != i)
                         {
@@ -6446,7 +8452,7 @@ static I host_csrgemm2_nnz(J                    m,
     return csr_row_ptr_C[m] - idx_base_C;
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename S = host_semiring_plus_times>
 static void host_csrgemm2(J                    m,
                           J                    n,
                           J                    k,
@@ -6467,13 +8473,17 @@ static void host_csrgemm2(J                    m,
                           hipsparseIndexBase_t idx_base_A,
                           hipsparseIndexBase_t idx_base_B,
                           hipsparseIndexBase_t idx_base_C,
-                          hipsparseIndexBase_t idx_base_D)
+                          hipsparseIndexBase_t idx_base_D,
+                          const I*             csr_row_ptr_M = nullptr,
+                          const J*             csr_col_ind_M = nullptr,
+                          hipsparseIndexBase_t idx_base_M    = HIPSPARSE_INDEX_BASE_ZERO)
 {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
         std::vector<I> nnz(n, -1);
+        std::vector<J> mask(csr_row_ptr_M != nullptr ? n : 0, -1);
 
 #ifdef _OPENMP
         int nthreads = omp_get_num_threads();
@@ -6493,6 +8503,15 @@ static void host_csrgemm2(J                    m,
             I row_begin_C = csr_row_ptr_C[i] - idx_base_C;
             I row_end_C   = row_begin_C;
 
+            // Mark the columns of the mask in row i
+            if(csr_row_ptr_M != nullptr)
+            {
+                for(I j = csr_row_ptr_M[i] - idx_base_M; j < csr_row_ptr_M[i + 1] - idx_base_M; ++j)
+                {
+                    mask[csr_col_ind_M[j] - idx_base_M] = i;
+                }
+            }
+
             if(alpha)
             {
                 I row_begin_A = csr_row_ptr_A[i] - idx_base_A;
@@ -6504,7 +8523,7 @@ static void host_csrgemm2(J                    m,
                     // Current column of A
                     J col_A = csr_col_ind_A[j] - idx_base_A;
                     // Current value of A
-                    T val_A = testing_mult(*alpha, csr_val_A[j]);
+                    T val_A = S::scale(*alpha, csr_val_A[j]);
 
                     I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
                     I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
@@ -6514,6 +8533,13 @@ static void host_csrgemm2(J                    m,
                     {
                         // Current column of B
                         J col_B = csr_col_ind_B[l] - idx_base_B;
+
+                        // Skip products outside of the mask
+                        if(csr_row_ptr_M != nullptr && mask[col_B] != i)
+                        {
+                            continue;
+                        }
+
                         // Current value of B
                         T val_B = csr_val_B[l];
 
@@ -6522,13 +8548,13 @@ static void host_csrgemm2(J                    m,
                         {
                             nnz[col_B]               = row_end_C;
                             csr_col_ind_C[row_end_C] = col_B + idx_base_C;
-                            csr_val_C[row_end_C]     = testing_mult(val_A, val_B);
+                            csr_val_C[row_end_C]     = S::mul(val_A, val_B);
                             ++row_end_C;
                         }
                         else
                         {
                             csr_val_C[nnz[col_B]]
-                                = csr_val_C[nnz[col_B]] + testing_mult(val_A, val_B);
+                                = S::add(csr_val_C[nnz[col_B]], S::mul(val_A, val_B));
                         }
                     }
                 }
@@ -6546,7 +8572,7 @@ static void host_csrgemm2(J                    m,
                     // Current column of D
                     J col_D = csr_col_ind_D[j] - idx_base_D;
                     // Current value of D
-                    T val_D = testing_mult(*beta, csr_val_D[j]);
+                    T val_D = S::scale(*beta, csr_val_D[j]);
 
                     // Check if a new nnz is generated or if the value is added
                     if(nnz[col_D] < row_begin_C)
@@ -6559,7 +8585,7 @@ static void host_csrgemm2(J                    m,
                     }
                     else
                     {
-                        csr_val_C[nnz[col_D]] = csr_val_C[nnz[col_D]] + val_D;
+                        csr_val_C[nnz[col_D]] = S::add(csr_val_C[nnz[col_D]], val_D);
                     }
                 }
             }
@@ -6604,6 +8630,526 @@ static void host_csrgemm2(J                    m,
     }
 }
 
+/* ============================================================================================ */
+/*! \brief  Level of the host reference of the smoothed aggregation multigrid method. All
+ *  matrices are zero based. The prolongator and the restriction are empty on the coarsest
+ *  level, the dense inverse is empty unless the level is solved directly.
+ */
+#if(!defined(CUDART_VERSION))
+template <typename T>
+struct host_amg_level
+{
+    int              n{};
+    std::vector<int> csr_row_ptr;
+    std::vector<int> csr_col_ind;
+    std::vector<T>   csr_val;
+
+    std::vector<int> P_row_ptr;
+    std::vector<int> P_col_ind;
+    std::vector<T>   P_val;
+    std::vector<int> R_row_ptr;
+    std::vector<int> R_col_ind;
+    std::vector<T>   R_val;
+
+    int              ncolors{};
+    std::vector<int> coloring;
+
+    std::vector<T> inverse;
+};
+
+// C = A B of zero based CSR matrices with k columns of A
+template <typename T>
+void host_amg_csrgemm(int                     m,
+                      int                     n,
+                      int                     k,
+                      const std::vector<int>& A_row_ptr,
+                      const std::vector<int>& A_col_ind,
+                      const std::vector<T>&   A_val,
+                      const std::vector<int>& B_row_ptr,
+                      const std::vector<int>& B_col_ind,
+                      const std::vector<T>&   B_val,
+                      std::vector<int>&       C_row_ptr,
+                      std::vector<int>&       C_col_ind,
+                      std::vector<T>&         C_val)
+{
+    const T alpha = make_DataType<T>(1.0);
+
+    C_row_ptr.resize(m + 1);
+    int nnz_C = host_csrgemm2_nnz(m,
+                                  n,
+                                  k,
+                                  &alpha,
+                                  A_row_ptr.data(),
+                                  A_col_ind.data(),
+                                  B_row_ptr.data(),
+                                  B_col_ind.data(),
+                                  (const T*)nullptr,
+                                  (const int*)nullptr,
+                                  (const int*)nullptr,
+                                  C_row_ptr.data(),
+                                  HIPSPARSE_INDEX_BASE_ZERO,
+                                  HIPSPARSE_INDEX_BASE_ZERO,
+                                  HIPSPARSE_INDEX_BASE_ZERO,
+                                  HIPSPARSE_INDEX_BASE_ZERO);
+
+    C_col_ind.resize(nnz_C);
+    C_val.resize(nnz_C);
+    host_csrgemm2(m,
+                  n,
+                  k,
+                  &alpha,
+                  A_row_ptr.data(),
+                  A_col_ind.data(),
+                  A_val.data(),
+                  B_row_ptr.data(),
+                  B_col_ind.data(),
+                  B_val.data(),
+                  (const T*)nullptr,
+                  (const int*)nullptr,
+                  (const int*)nullptr,
+                  (const T*)nullptr,
+                  C_row_ptr.data(),
+                  C_col_ind.data(),
+                  C_val.data(),
+                  HIPSPARSE_INDEX_BASE_ZERO,
+                  HIPSPARSE_INDEX_BASE_ZERO,
+                  HIPSPARSE_INDEX_BASE_ZERO,
+                  HIPSPARSE_INDEX_BASE_ZERO);
+}
+
+// y = alpha A x + beta y of a zero based CSR matrix with m rows
+template <typename T>
+void host_amg_csrmv(int                     m,
+                    T                       alpha,
+                    const std::vector<int>& csr_row_ptr,
+                    const std::vector<int>& csr_col_ind,
+                    const std::vector<T>&   csr_val,
+                    const T*                x,
+                    T                       beta,
+                    T*                      y)
+{
+    for(int i = 0; i < m; ++i)
+    {
+        T sum = make_DataType<T>(0.0);
+        for(int k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+        {
+            sum = sum + csr_val[k] * x[csr_col_ind[k]];
+        }
+
+        y[i] = alpha * sum + beta * y[i];
+    }
+}
+
+/*! \brief  Smoothed aggregation multigrid setup, host reference of hipsparseAmg_setup. Rows are
+ *  aggregated greedily over the strong connections |a_ij| >= theta sqrt(|a_ii a_jj|), the
+ *  tentative prolongator is smoothed by I - weight / rho D^{-1} A with the Gershgorin bound rho
+ *  and the coarse matrices are R A P with R = P^T.
+ */
+template <typename T>
+hipsparseStatus_t host_amg_setup(int                             m,
+                                 const std::vector<int>&         csr_row_ptr,
+                                 const std::vector<int>&         csr_col_ind,
+                                 const std::vector<T>&           csr_val,
+                                 hipsparseIndexBase_t            base,
+                                 double                          theta,
+                                 double                          weight,
+                                 int                             max_levels,
+                                 int64_t                         coarse_size,
+                                 std::vector<host_amg_level<T>>& levels)
+{
+    levels.assign(1, host_amg_level<T>());
+
+    levels[0].n       = m;
+    levels[0].csr_val = csr_val;
+    for(int i = 0; i <= m; ++i)
+    {
+        levels[0].csr_row_ptr.push_back(csr_row_ptr[i] - base);
+    }
+
+    for(size_t k = 0; k < csr_col_ind.size(); ++k)
+    {
+        levels[0].csr_col_ind.push_back(csr_col_ind[k] - base);
+    }
+
+    for(size_t l = 0;; ++l)
+    {
+        host_amg_level<T>       coarse;
+        host_amg_level<T>&      level   = levels[l];
+        const int               n       = level.n;
+        const std::vector<int>& row_ptr = level.csr_row_ptr;
+        const std::vector<int>& col_ind = level.csr_col_ind;
+        const std::vector<T>&   val     = level.csr_val;
+
+        std::vector<T> diagonal(n, make_DataType<T>(0.0));
+        for(int i = 0; i < n; ++i)
+        {
+            for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+            {
+                if(col_ind[k] == i)
+                {
+                    diagonal[i] = diagonal[i] + val[k];
+                }
+            }
+
+            if(diagonal[i] == make_DataType<T>(0.0))
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+        }
+
+        // Greedy aggregation of the strongly connected rows, -2 marks unassigned rows and -1
+        // rows without strong connections
+        std::vector<int> aggregates(n, -2);
+        int              nc = 0;
+
+        bool coarsest = (n <= coarse_size || l + 1 >= size_t(max_levels));
+        if(!coarsest)
+        {
+            std::vector<std::vector<int>> strong(n);
+            for(int i = 0; i < n; ++i)
+            {
+                for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+                {
+                    const int    j     = col_ind[k];
+                    const double bound
+                        = theta * std::sqrt(testing_abs(diagonal[i]) * testing_abs(diagonal[j]));
+                    if(j != i && testing_abs(val[k]) >= bound)
+                    {
+                        strong[i].push_back(j);
+                    }
+                }
+
+                if(strong[i].empty())
+                {
+                    aggregates[i] = -1;
+                }
+            }
+
+            for(int i = 0; i < n; ++i)
+            {
+                bool isolated = (aggregates[i] == -2);
+                for(int j : strong[i])
+                {
+                    isolated = isolated && (aggregates[j] == -2);
+                }
+
+                if(isolated)
+                {
+                    aggregates[i] = nc;
+                    for(int j : strong[i])
+                    {
+                        aggregates[j] = nc;
+                    }
+
+                    ++nc;
+                }
+            }
+
+            const std::vector<int> first_pass(aggregates);
+            for(int i = 0; i < n; ++i)
+            {
+                for(size_t k = 0; aggregates[i] == -2 && k < strong[i].size(); ++k)
+                {
+                    if(first_pass[strong[i][k]] >= 0)
+                    {
+                        aggregates[i] = first_pass[strong[i][k]];
+                    }
+                }
+            }
+
+            for(int i = 0; i < n; ++i)
+            {
+                if(aggregates[i] == -2)
+                {
+                    aggregates[i] = nc;
+                    for(int j : strong[i])
+                    {
+                        aggregates[j] = (aggregates[j] == -2) ? nc : aggregates[j];
+                    }
+
+                    ++nc;
+                }
+            }
+
+            coarsest = (nc == 0 || nc >= n);
+        }
+
+        if(coarsest && n <= coarse_size)
+        {
+            level.inverse.assign(static_cast<size_t>(n) * n, make_DataType<T>(0.0));
+            for(int i = 0; i < n; ++i)
+            {
+                for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+                {
+                    level.inverse[i * n + col_ind[k]] = level.inverse[i * n + col_ind[k]] + val[k];
+                }
+            }
+
+            return (host_bsrdiaginv(1, n, level.inverse) == -1) ? HIPSPARSE_STATUS_SUCCESS
+                                                                : HIPSPARSE_STATUS_ZERO_PIVOT;
+        }
+
+        // Greedy coloring, the smallest color none of the lower neighbours has
+        level.coloring.assign(n, -1);
+        for(int i = 0; i < n; ++i)
+        {
+            std::vector<bool> taken(level.ncolors, false);
+            for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+            {
+                if(col_ind[k] != i && level.coloring[col_ind[k]] >= 0)
+                {
+                    taken[level.coloring[col_ind[k]]] = true;
+                }
+            }
+
+            int c = 0;
+            while(c < level.ncolors && taken[c])
+            {
+                ++c;
+            }
+
+            level.coloring[i] = c;
+            level.ncolors     = std::max(level.ncolors, c + 1);
+        }
+
+        if(coarsest)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Jacobi operator I - omega D^{-1} A
+        double rho = 0.0;
+        for(int i = 0; i < n; ++i)
+        {
+            double sum = 0.0;
+            for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+            {
+                sum += testing_abs(val[k]);
+            }
+
+            rho = std::max(rho, sum / testing_abs(diagonal[i]));
+        }
+
+        const T omega = make_DataType<T>(rho > 0.0 ? weight / rho : 0.0);
+
+        std::vector<int> J_row_ptr(n + 1, 0);
+        std::vector<int> J_col_ind;
+        std::vector<T>   J_val;
+        for(int i = 0; i < n; ++i)
+        {
+            std::vector<std::pair<int, T>> row(1, std::make_pair(i, make_DataType<T>(1.0)));
+            for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+            {
+                row.push_back(std::make_pair(col_ind[k], -omega * val[k] / diagonal[i]));
+            }
+
+            std::stable_sort(row.begin(),
+                             row.end(),
+                             [](const std::pair<int, T>& a, const std::pair<int, T>& b) {
+                                 return a.first < b.first;
+                             });
+
+            for(const std::pair<int, T>& entry : row)
+            {
+                if(int(J_col_ind.size()) > J_row_ptr[i] && J_col_ind.back() == entry.first)
+                {
+                    J_val.back() = J_val.back() + entry.second;
+                    continue;
+                }
+
+                J_col_ind.push_back(entry.first);
+                J_val.push_back(entry.second);
+            }
+
+            J_row_ptr[i + 1] = static_cast<int>(J_col_ind.size());
+        }
+
+        // Tentative prolongator
+        std::vector<int> T_row_ptr(n + 1, 0);
+        std::vector<int> T_col_ind;
+        for(int i = 0; i < n; ++i)
+        {
+            if(aggregates[i] >= 0)
+            {
+                T_col_ind.push_back(aggregates[i]);
+            }
+
+            T_row_ptr[i + 1] = static_cast<int>(T_col_ind.size());
+        }
+
+        std::vector<T> T_val(T_col_ind.size(), make_DataType<T>(1.0));
+
+        // P = J T and R = P^T
+        host_amg_csrgemm(n,
+                         nc,
+                         n,
+                         J_row_ptr,
+                         J_col_ind,
+                         J_val,
+                         T_row_ptr,
+                         T_col_ind,
+                         T_val,
+                         level.P_row_ptr,
+                         level.P_col_ind,
+                         level.P_val);
+
+        level.R_row_ptr.assign(nc + 1, 0);
+        level.R_col_ind.resize(level.P_col_ind.size());
+        level.R_val.resize(level.P_val.size());
+        for(size_t k = 0; k < level.P_col_ind.size(); ++k)
+        {
+            ++level.R_row_ptr[level.P_col_ind[k] + 1];
+        }
+
+        for(int c = 0; c < nc; ++c)
+        {
+            level.R_row_ptr[c + 1] += level.R_row_ptr[c];
+        }
+
+        std::vector<int> next(level.R_row_ptr.begin(), level.R_row_ptr.end() - 1);
+        for(int i = 0; i < n; ++i)
+        {
+            for(int k = level.P_row_ptr[i]; k < level.P_row_ptr[i + 1]; ++k)
+            {
+                const int idx        = next[level.P_col_ind[k]]++;
+                level.R_col_ind[idx] = i;
+                level.R_val[idx]     = level.P_val[k];
+            }
+        }
+
+        // A_c = R (A P)
+        std::vector<int> AP_row_ptr;
+        std::vector<int> AP_col_ind;
+        std::vector<T>   AP_val;
+        host_amg_csrgemm(n,
+                         nc,
+                         n,
+                         row_ptr,
+                         col_ind,
+                         val,
+                         level.P_row_ptr,
+                         level.P_col_ind,
+                         level.P_val,
+                         AP_row_ptr,
+                         AP_col_ind,
+                         AP_val);
+
+        coarse.n = nc;
+        host_amg_csrgemm(nc,
+                         nc,
+                         n,
+                         level.R_row_ptr,
+                         level.R_col_ind,
+                         level.R_val,
+                         AP_row_ptr,
+                         AP_col_ind,
+                         AP_val,
+                         coarse.csr_row_ptr,
+                         coarse.csr_col_ind,
+                         coarse.csr_val);
+
+        levels.push_back(std::move(coarse));
+    }
+}
+
+/*! \brief  One V-cycle on level l, host reference of hipsparseAmg_vcycle. */
+template <typename T>
+void host_amg_vcycle(hipsparseSmootherAlg_t                alg,
+                     int                                   pre_sweeps,
+                     int                                   post_sweeps,
+                     double                                omega,
+                     const std::vector<host_amg_level<T>>& levels,
+                     size_t                                l,
+                     const T*                              b,
+                     T*                                    x)
+{
+    const host_amg_level<T>& level = levels[l];
+    const int                n     = level.n;
+
+    std::vector<T> r(b, b + n);
+
+    if(!level.inverse.empty())
+    {
+        host_amg_csrmv(n,
+                       make_DataType<T>(-1.0),
+                       level.csr_row_ptr,
+                       level.csr_col_ind,
+                       level.csr_val,
+                       x,
+                       make_DataType<T>(1.0),
+                       r.data());
+
+        for(int i = 0; i < n; ++i)
+        {
+            T sum = make_DataType<T>(0.0);
+            for(int j = 0; j < n; ++j)
+            {
+                sum = sum + level.inverse[i * n + j] * r[j];
+            }
+
+            x[i] = x[i] + sum;
+        }
+
+        return;
+    }
+
+    auto smooth = [&](int sweeps) {
+        host_smoother(alg,
+                      sweeps,
+                      omega,
+                      n,
+                      level.csr_row_ptr.data(),
+                      level.csr_col_ind.data(),
+                      level.csr_val.data(),
+                      level.ncolors,
+                      level.coloring.data(),
+                      b,
+                      x,
+                      HIPSPARSE_INDEX_BASE_ZERO);
+    };
+
+    smooth(pre_sweeps);
+
+    if(l + 1 < levels.size())
+    {
+        const int nc = levels[l + 1].n;
+
+        std::vector<T> bc(nc);
+        std::vector<T> xc(nc, make_DataType<T>(0.0));
+
+        host_amg_csrmv(n,
+                       make_DataType<T>(-1.0),
+                       level.csr_row_ptr,
+                       level.csr_col_ind,
+                       level.csr_val,
+                       x,
+                       make_DataType<T>(1.0),
+                       r.data());
+        host_amg_csrmv(nc,
+                       make_DataType<T>(1.0),
+                       level.R_row_ptr,
+                       level.R_col_ind,
+                       level.R_val,
+                       r.data(),
+                       make_DataType<T>(0.0),
+                       bc.data());
+
+        host_amg_vcycle(alg, pre_sweeps, post_sweeps, omega, levels, l + 1, bc.data(), xc.data());
+
+        host_amg_csrmv(n,
+                       make_DataType<T>(1.0),
+                       level.P_row_ptr,
+                       level.P_col_ind,
+                       level.P_val,
+                       xc.data(),
+                       make_DataType<T>(1.0),
+                       x);
+    }
+
+    smooth(post_sweeps);
+}
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
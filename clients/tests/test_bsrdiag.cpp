@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_bsrdiag.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseDirection_t, hipsparseIndexBase_t> bsrdiag_tuple;
+
+int bsrdiag_ndim_range[] = {0, 1, 4, 9};
+
+int bsrdiag_block_dim_range[] = {1, 2, 3, 4, 7, 16};
+
+hipsparseDirection_t bsrdiag_dir_range[] = {HIPSPARSE_DIRECTION_ROW, HIPSPARSE_DIRECTION_COLUMN};
+
+hipsparseIndexBase_t bsrdiag_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_bsrdiag : public testing::TestWithParam<bsrdiag_tuple>
+{
+protected:
+    parameterized_bsrdiag() {}
+    virtual ~parameterized_bsrdiag() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_bsrdiag_arguments(bsrdiag_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.block_dim = std::get<1>(tup);
+    arg.dirA      = std::get<2>(tup);
+    arg.baseA     = std::get<3>(tup);
+    arg.alpha     = 2.0;
+    arg.beta      = 0.5;
+    arg.timing    = 0;
+    return arg;
+}
+
+// Block-Jacobi routines are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(bsrdiag_bad_arg, bsrdiag_float)
+{
+    testing_bsrdiag_bad_arg<float>();
+}
+
+TEST_P(parameterized_bsrdiag, bsrdiag_float)
+{
+    Arguments arg = setup_bsrdiag_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrdiag<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_bsrdiag, bsrdiag_double)
+{
+    Arguments arg = setup_bsrdiag_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrdiag<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_bsrdiag, bsrdiag_float_complex)
+{
+    Arguments arg = setup_bsrdiag_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrdiag<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_bsrdiag, bsrdiag_double_complex)
+{
+    Arguments arg = setup_bsrdiag_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrdiag<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(bsrdiag,
+                         parameterized_bsrdiag,
+                         testing::Combine(testing::ValuesIn(bsrdiag_ndim_range),
+                                          testing::ValuesIn(bsrdiag_block_dim_range),
+                                          testing::ValuesIn(bsrdiag_dir_range),
+                                          testing::ValuesIn(bsrdiag_idxbase_range)));
+#endif
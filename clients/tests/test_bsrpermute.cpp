@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_bsrpermute.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, hipsparseIndexBase_t, hipsparseIndexBase_t> bsrpermute_tuple;
+
+int bsrpermute_M_range[]         = {0, 1, 327, 2153};
+int bsrpermute_N_range[]         = {0, 1, 231, 2928};
+int bsrpermute_block_dim_range[] = {1, 2, 4, 7, 16};
+
+hipsparseIndexBase_t bsrpermute_idxbaseA_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+hipsparseIndexBase_t bsrpermute_idxbaseB_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_bsrpermute : public testing::TestWithParam<bsrpermute_tuple>
+{
+protected:
+    parameterized_bsrpermute() {}
+    virtual ~parameterized_bsrpermute() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_bsrpermute_arguments(bsrpermute_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.block_dim = std::get<2>(tup);
+    arg.baseA     = std::get<3>(tup);
+    arg.baseB     = std::get<4>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+// Permutation is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(bsrpermute_bad_arg, bsrpermute_float)
+{
+    testing_bsrpermute_bad_arg<float>();
+}
+
+TEST_P(parameterized_bsrpermute, bsrpermute_float)
+{
+    Arguments arg = setup_bsrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrpermute<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_bsrpermute, bsrpermute_double)
+{
+    Arguments arg = setup_bsrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrpermute<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_bsrpermute, bsrpermute_float_complex)
+{
+    Arguments arg = setup_bsrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrpermute<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_bsrpermute, bsrpermute_double_complex)
+{
+    Arguments arg = setup_bsrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_bsrpermute<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(bsrpermute,
+                         parameterized_bsrpermute,
+                         testing::Combine(testing::ValuesIn(bsrpermute_M_range),
+                                          testing::ValuesIn(bsrpermute_N_range),
+                                          testing::ValuesIn(bsrpermute_block_dim_range),
+                                          testing::ValuesIn(bsrpermute_idxbaseA_range),
+                                          testing::ValuesIn(bsrpermute_idxbaseB_range)));
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csr2bell.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, int, hipsparseOrder_t, hipsparseOrder_t, hipsparseIndexBase_t>
+    csr2bell_tuple;
+
+int csr2bell_M_range[]   = {64, 1024};
+int csr2bell_N_range[]   = {7, 32};
+int csr2bell_K_range[]   = {96, 544};
+int csr2bell_dim_range[] = {0, 1, 4, 16};
+
+hipsparseOrder_t     csr2bell_order_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseIndexBase_t csr2bell_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csr2bell : public testing::TestWithParam<csr2bell_tuple>
+{
+protected:
+    parameterized_csr2bell() {}
+    virtual ~parameterized_csr2bell() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csr2bell_arguments(csr2bell_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.K         = std::get<2>(tup);
+    arg.block_dim = std::get<3>(tup);
+    arg.alpha     = 2.0;
+    arg.beta      = 0.5;
+    arg.orderB    = std::get<4>(tup);
+    arg.orderC    = std::get<5>(tup);
+    arg.baseA     = std::get<6>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+// The conversion into the Blocked-ELL format is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csr2bell_bad_arg, csr2bell_float)
+{
+    testing_csr2bell_bad_arg();
+}
+
+TEST_P(parameterized_csr2bell, csr2bell_i32_float)
+{
+    Arguments arg = setup_csr2bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2bell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csr2bell, csr2bell_i64_double)
+{
+    Arguments arg = setup_csr2bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2bell<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csr2bell, csr2bell_i32_float_complex)
+{
+    Arguments arg = setup_csr2bell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2bell<int32_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csr2bell,
+                         parameterized_csr2bell,
+                         testing::Combine(testing::ValuesIn(csr2bell_M_range),
+                                          testing::ValuesIn(csr2bell_N_range),
+                                          testing::ValuesIn(csr2bell_K_range),
+                                          testing::ValuesIn(csr2bell_dim_range),
+                                          testing::ValuesIn(csr2bell_order_range),
+                                          testing::ValuesIn(csr2bell_order_range),
+                                          testing::ValuesIn(csr2bell_idxbase_range)));
+#endif
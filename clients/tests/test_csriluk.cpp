@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csriluk.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> csriluk_tuple;
+
+int csriluk_ndim_range[] = {0, 1, 8, 20};
+
+// Level 0 reproduces csrilu0, higher levels add fill
+int csriluk_level_range[] = {0, 1, 2, 4};
+
+hipsparseIndexBase_t csriluk_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csriluk : public testing::TestWithParam<csriluk_tuple>
+{
+protected:
+    parameterized_csriluk() {}
+    virtual ~parameterized_csriluk() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csriluk_arguments(csriluk_tuple tup)
+{
+    Arguments arg;
+    arg.M          = std::get<0>(tup);
+    arg.fill_level = std::get<1>(tup);
+    arg.baseA      = std::get<2>(tup);
+    arg.timing     = 0;
+    return arg;
+}
+
+// Level-of-fill incomplete factorizations are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csriluk_bad_arg, csriluk_float)
+{
+    testing_csriluk_bad_arg<float>();
+}
+
+TEST_P(parameterized_csriluk, csriluk_float)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csriluk<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csriluk, csriluk_double)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csriluk<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csriluk, csriluk_float_complex)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csriluk<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csriluk, csriluk_double_complex)
+{
+    Arguments arg = setup_csriluk_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csriluk<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csriluk,
+                         parameterized_csriluk,
+                         testing::Combine(testing::ValuesIn(csriluk_ndim_range),
+                                          testing::ValuesIn(csriluk_level_range),
+                                          testing::ValuesIn(csriluk_idxbase_range)));
+#endif
@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrilut.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, double, int, hipsparseIndexBase_t> csrilut_tuple;
+
+int csrilut_ndim_range[] = {0, 1, 8, 20};
+
+double csrilut_tol_range[] = {0.0, 1e-2, 1e-1};
+
+// No fill, some fill and unlimited fill per row
+int csrilut_fill_range[] = {0, 2, 1000};
+
+hipsparseIndexBase_t csrilut_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csrilut : public testing::TestWithParam<csrilut_tuple>
+{
+protected:
+    parameterized_csrilut() {}
+    virtual ~parameterized_csrilut() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrilut_arguments(csrilut_tuple tup)
+{
+    Arguments arg;
+    arg.M          = std::get<0>(tup);
+    arg.threshold  = std::get<1>(tup);
+    arg.fill_level = std::get<2>(tup);
+    arg.baseA      = std::get<3>(tup);
+    arg.timing     = 0;
+    return arg;
+}
+
+// Threshold incomplete factorizations are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csrilut_bad_arg, csrilut_float)
+{
+    testing_csrilut_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrilut, csrilut_float)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrilut<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrilut, csrilut_double)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrilut<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrilut, csrilut_float_complex)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrilut<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrilut, csrilut_double_complex)
+{
+    Arguments arg = setup_csrilut_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrilut<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csrilut,
+                         parameterized_csrilut,
+                         testing::Combine(testing::ValuesIn(csrilut_ndim_range),
+                                          testing::ValuesIn(csrilut_tol_range),
+                                          testing::ValuesIn(csrilut_fill_range),
+                                          testing::ValuesIn(csrilut_idxbase_range)));
+#endif
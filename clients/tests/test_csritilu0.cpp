@@ -0,0 +1,102 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csritilu0.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> csritilu0_tuple;
+
+int csritilu0_ndim_range[] = {0, 1, 8, 33};
+
+// Default, asynchronous in place and synchronous split sweeps
+int csritilu0_alg_range[] = {0, 1, 3};
+
+hipsparseIndexBase_t csritilu0_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csritilu0 : public testing::TestWithParam<csritilu0_tuple>
+{
+protected:
+    parameterized_csritilu0() {}
+    virtual ~parameterized_csritilu0() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csritilu0_arguments(csritilu0_tuple tup)
+{
+    Arguments arg;
+    arg.M          = std::get<0>(tup);
+    arg.itilu0_alg = std::get<1>(tup);
+    arg.baseA      = std::get<2>(tup);
+    arg.timing     = 0;
+    return arg;
+}
+
+// Iterative incomplete factorizations are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csritilu0_bad_arg, csritilu0_float)
+{
+    testing_csritilu0_bad_arg<float>();
+}
+
+TEST_P(parameterized_csritilu0, csritilu0_float)
+{
+    Arguments arg = setup_csritilu0_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csritilu0<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csritilu0, csritilu0_double)
+{
+    Arguments arg = setup_csritilu0_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csritilu0<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csritilu0, csritilu0_float_complex)
+{
+    Arguments arg = setup_csritilu0_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csritilu0<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csritilu0, csritilu0_double_complex)
+{
+    Arguments arg = setup_csritilu0_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csritilu0<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csritilu0,
+                         parameterized_csritilu0,
+                         testing::Combine(testing::ValuesIn(csritilu0_ndim_range),
+                                          testing::ValuesIn(csritilu0_alg_range),
+                                          testing::ValuesIn(csritilu0_idxbase_range)));
+#endif
@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrpermute.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t, hipsparseIndexBase_t> csrpermute_tuple;
+
+int csrpermute_M_range[] = {0, 1, 872, 21453};
+int csrpermute_N_range[] = {0, 1, 623, 29285};
+
+hipsparseIndexBase_t csrpermute_idxbaseA_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+hipsparseIndexBase_t csrpermute_idxbaseB_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csrpermute : public testing::TestWithParam<csrpermute_tuple>
+{
+protected:
+    parameterized_csrpermute() {}
+    virtual ~parameterized_csrpermute() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrpermute_arguments(csrpermute_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.baseA  = std::get<2>(tup);
+    arg.baseB  = std::get<3>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+// Permutation is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csrpermute_bad_arg, csrpermute_float)
+{
+    testing_csrpermute_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrpermute, csrpermute_float)
+{
+    Arguments arg = setup_csrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrpermute<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrpermute, csrpermute_double)
+{
+    Arguments arg = setup_csrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrpermute<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrpermute, csrpermute_float_complex)
+{
+    Arguments arg = setup_csrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrpermute<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrpermute, csrpermute_double_complex)
+{
+    Arguments arg = setup_csrpermute_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrpermute<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csrpermute,
+                         parameterized_csrpermute,
+                         testing::Combine(testing::ValuesIn(csrpermute_M_range),
+                                          testing::ValuesIn(csrpermute_N_range),
+                                          testing::ValuesIn(csrpermute_idxbaseA_range),
+                                          testing::ValuesIn(csrpermute_idxbaseB_range)));
+#endif
@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrrcm.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, hipsparseIndexBase_t> csrrcm_tuple;
+
+int csrrcm_ndim_range[] = {0, 1, 16, 50};
+
+hipsparseIndexBase_t csrrcm_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csrrcm : public testing::TestWithParam<csrrcm_tuple>
+{
+protected:
+    parameterized_csrrcm() {}
+    virtual ~parameterized_csrrcm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrrcm_arguments(csrrcm_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.baseA  = std::get<1>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+// Reverse Cuthill-McKee is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csrrcm_bad_arg, csrrcm)
+{
+    testing_csrrcm_bad_arg();
+}
+
+TEST_P(parameterized_csrrcm, csrrcm)
+{
+    Arguments arg = setup_csrrcm_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrrcm(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csrrcm,
+                         parameterized_csrrcm,
+                         testing::Combine(testing::ValuesIn(csrrcm_ndim_range),
+                                          testing::ValuesIn(csrrcm_idxbase_range)));
+#endif
@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrsymperm.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, hipsparseIndexBase_t, hipsparseIndexBase_t> csrsymperm_tuple;
+
+int csrsymperm_ndim_range[] = {0, 1, 16, 50};
+
+hipsparseIndexBase_t csrsymperm_idxbaseA_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+hipsparseIndexBase_t csrsymperm_idxbaseC_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csrsymperm : public testing::TestWithParam<csrsymperm_tuple>
+{
+protected:
+    parameterized_csrsymperm() {}
+    virtual ~parameterized_csrsymperm() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrsymperm_arguments(csrsymperm_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.baseA  = std::get<1>(tup);
+    arg.baseC  = std::get<2>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+// Symmetric permutation is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(csrsymperm_bad_arg, csrsymperm_float)
+{
+    testing_csrsymperm_bad_arg<float>();
+}
+
+TEST_P(parameterized_csrsymperm, csrsymperm_float)
+{
+    Arguments arg = setup_csrsymperm_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrsymperm<float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrsymperm, csrsymperm_double)
+{
+    Arguments arg = setup_csrsymperm_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrsymperm<double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrsymperm, csrsymperm_float_complex)
+{
+    Arguments arg = setup_csrsymperm_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrsymperm<hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csrsymperm, csrsymperm_double_complex)
+{
+    Arguments arg = setup_csrsymperm_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csrsymperm<hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(csrsymperm,
+                         parameterized_csrsymperm,
+                         testing::Combine(testing::ValuesIn(csrsymperm_ndim_range),
+                                          testing::ValuesIn(csrsymperm_idxbaseA_range),
+                                          testing::ValuesIn(csrsymperm_idxbaseC_range)));
+#endif
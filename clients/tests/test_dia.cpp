@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_dia.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> csr2dia_tuple;
+
+int dia_M_range[] = {50, 1149};
+int dia_N_range[] = {7, 521};
+
+hipsparseIndexBase_t dia_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csr2dia : public testing::TestWithParam<csr2dia_tuple>
+{
+protected:
+    parameterized_csr2dia() {}
+    virtual ~parameterized_csr2dia() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csr2dia_arguments(csr2dia_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.baseA  = std::get<2>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+// The DIA format is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(dia_bad_arg, dia_float)
+{
+    testing_dia_bad_arg();
+}
+
+TEST_P(parameterized_csr2dia, csr2dia_i32_float)
+{
+    Arguments arg = setup_csr2dia_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2dia<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csr2dia, csr2dia_i64_double)
+{
+    Arguments arg = setup_csr2dia_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2dia<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csr2dia, csr2dia_i32_double_complex)
+{
+    Arguments arg = setup_csr2dia_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2dia<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(dia,
+                         parameterized_csr2dia,
+                         testing::Combine(testing::ValuesIn(dia_M_range),
+                                          testing::ValuesIn(dia_N_range),
+                                          testing::ValuesIn(dia_idxbase_range)));
+#endif
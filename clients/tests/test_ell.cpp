@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_ell.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, double, double, hipsparseOperation_t, hipsparseIndexBase_t>
+    spmv_ell_tuple;
+
+typedef std::tuple<int,
+                   int,
+                   int,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseOrder_t,
+                   hipsparseIndexBase_t>
+    spmm_ell_tuple;
+
+int ell_M_range[] = {50, 1149};
+int ell_N_range[] = {7, 521};
+int ell_K_range[] = {84};
+
+double ell_alpha_range[] = {2.0};
+double ell_beta_range[]  = {0.0, 0.5};
+
+hipsparseOperation_t ell_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                           HIPSPARSE_OPERATION_TRANSPOSE,
+                                           HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE};
+hipsparseOperation_t ell_transB_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseOrder_t     ell_order_range[]   = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseIndexBase_t ell_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_spmv_ell : public testing::TestWithParam<spmv_ell_tuple>
+{
+protected:
+    parameterized_spmv_ell() {}
+    virtual ~parameterized_spmv_ell() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmm_ell : public testing::TestWithParam<spmm_ell_tuple>
+{
+protected:
+    parameterized_spmm_ell() {}
+    virtual ~parameterized_spmm_ell() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmv_ell_arguments(spmv_ell_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.alpha  = std::get<2>(tup);
+    arg.beta   = std::get<3>(tup);
+    arg.transA = std::get<4>(tup);
+    arg.baseA  = std::get<5>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+Arguments setup_spmm_ell_arguments(spmm_ell_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.K      = std::get<2>(tup);
+    arg.alpha  = 2.0;
+    arg.beta   = 0.5;
+    arg.transB = std::get<3>(tup);
+    arg.orderB = std::get<4>(tup);
+    arg.orderC = std::get<5>(tup);
+    arg.baseA  = std::get<6>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+// The ELL format is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(ell_bad_arg, ell_float)
+{
+    testing_ell_bad_arg();
+}
+
+TEST_P(parameterized_spmv_ell, spmv_ell_i32_float)
+{
+    Arguments arg = setup_spmv_ell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_ell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_ell, spmv_ell_i64_double)
+{
+    Arguments arg = setup_spmv_ell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_ell<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_ell, spmv_ell_i32_double_complex)
+{
+    Arguments arg = setup_spmv_ell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_ell<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_ell, spmm_ell_i32_float)
+{
+    Arguments arg = setup_spmm_ell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_ell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_ell, spmm_ell_i64_float_complex)
+{
+    Arguments arg = setup_spmm_ell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_ell<int64_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(ell,
+                         parameterized_spmv_ell,
+                         testing::Combine(testing::ValuesIn(ell_M_range),
+                                          testing::ValuesIn(ell_N_range),
+                                          testing::ValuesIn(ell_alpha_range),
+                                          testing::ValuesIn(ell_beta_range),
+                                          testing::ValuesIn(ell_transA_range),
+                                          testing::ValuesIn(ell_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(ell,
+                         parameterized_spmm_ell,
+                         testing::Combine(testing::ValuesIn(ell_M_range),
+                                          testing::ValuesIn(ell_N_range),
+                                          testing::ValuesIn(ell_K_range),
+                                          testing::ValuesIn(ell_transB_range),
+                                          testing::ValuesIn(ell_order_range),
+                                          testing::ValuesIn(ell_order_range),
+                                          testing::ValuesIn(ell_idxbase_range)));
+#endif
@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_sell.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, int, hipsparseIndexBase_t> csr2sell_tuple;
+
+int sell_M_range[] = {50, 1149};
+int sell_N_range[] = {7, 521};
+
+int sell_C_range[]     = {1, 32};
+int sell_sigma_range[] = {1, 4, 128};
+
+hipsparseIndexBase_t sell_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_csr2sell : public testing::TestWithParam<csr2sell_tuple>
+{
+protected:
+    parameterized_csr2sell() {}
+    virtual ~parameterized_csr2sell() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csr2sell_arguments(csr2sell_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.block_dim = std::get<2>(tup);
+    arg.sigma     = std::get<3>(tup);
+    arg.baseA     = std::get<4>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+// The SELL-C-sigma format is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(sell_bad_arg, sell_float)
+{
+    testing_sell_bad_arg();
+}
+
+TEST_P(parameterized_csr2sell, csr2sell_i32_float)
+{
+    Arguments arg = setup_csr2sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2sell<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csr2sell, csr2sell_i64_double)
+{
+    Arguments arg = setup_csr2sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2sell<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_csr2sell, csr2sell_i32_double_complex)
+{
+    Arguments arg = setup_csr2sell_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_csr2sell<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(sell,
+                         parameterized_csr2sell,
+                         testing::Combine(testing::ValuesIn(sell_M_range),
+                                          testing::ValuesIn(sell_N_range),
+                                          testing::ValuesIn(sell_C_range),
+                                          testing::ValuesIn(sell_sigma_range),
+                                          testing::ValuesIn(sell_idxbase_range)));
+#endif
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_semiring.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, hipsparseOperation_t, hipsparseFormat_t, hipsparseIndexBase_t>
+    spmv_semiring_tuple;
+
+typedef std::tuple<int, int, int, double, hipsparseIndexBase_t, hipsparseIndexBase_t>
+    spgemm_semiring_tuple;
+
+int spmv_semiring_M_range[]   = {50, 1149};
+int spgemm_semiring_M_range[] = {478, 1149};
+int semiring_N_range[]        = {521, 1322};
+
+int semiring_range[] = {HIPSPARSE_SEMIRING_PLUS_TIMES,
+                        HIPSPARSE_SEMIRING_MIN_PLUS,
+                        HIPSPARSE_SEMIRING_MAX_PLUS,
+                        HIPSPARSE_SEMIRING_MAX_MIN,
+                        HIPSPARSE_SEMIRING_OR_AND};
+
+hipsparseOperation_t semiring_transA_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseFormat_t semiring_format_range[]
+    = {HIPSPARSE_FORMAT_CSR, HIPSPARSE_FORMAT_CSC, HIPSPARSE_FORMAT_COO};
+hipsparseIndexBase_t semiring_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::vector<double> semiring_alpha_range = {2.0};
+
+class parameterized_spmv_semiring : public testing::TestWithParam<spmv_semiring_tuple>
+{
+protected:
+    parameterized_spmv_semiring() {}
+    virtual ~parameterized_spmv_semiring() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spgemm_semiring : public testing::TestWithParam<spgemm_semiring_tuple>
+{
+protected:
+    parameterized_spgemm_semiring() {}
+    virtual ~parameterized_spgemm_semiring() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmv_semiring_arguments(spmv_semiring_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.semiring = std::get<2>(tup);
+    arg.transA   = std::get<3>(tup);
+    arg.formatA  = std::get<4>(tup);
+    arg.baseA    = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_spgemm_semiring_arguments(spgemm_semiring_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.K        = std::get<1>(tup);
+    arg.semiring = std::get<2>(tup);
+    arg.alpha    = std::get<3>(tup);
+    arg.baseA    = std::get<4>(tup);
+    arg.baseB    = std::get<4>(tup);
+    arg.baseC    = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+// Semirings are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(semiring_bad_arg, semiring_float)
+{
+    testing_semiring_bad_arg();
+}
+
+TEST_P(parameterized_spmv_semiring, spmv_semiring_i32_float)
+{
+    Arguments arg = setup_spmv_semiring_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_semiring<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_semiring, spmv_semiring_i64_double)
+{
+    Arguments arg = setup_spmv_semiring_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_semiring<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spgemm_semiring, spgemm_semiring_i32_float)
+{
+    Arguments arg = setup_spgemm_semiring_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spgemm_semiring<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spgemm_semiring, spgemm_semiring_i64_double)
+{
+    Arguments arg = setup_spgemm_semiring_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spgemm_semiring<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(semiring,
+                         parameterized_spmv_semiring,
+                         testing::Combine(testing::ValuesIn(spmv_semiring_M_range),
+                                          testing::ValuesIn(semiring_N_range),
+                                          testing::ValuesIn(semiring_range),
+                                          testing::ValuesIn(semiring_transA_range),
+                                          testing::ValuesIn(semiring_format_range),
+                                          testing::ValuesIn(semiring_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(semiring,
+                         parameterized_spgemm_semiring,
+                         testing::Combine(testing::ValuesIn(spgemm_semiring_M_range),
+                                          testing::ValuesIn(semiring_N_range),
+                                          testing::ValuesIn(semiring_range),
+                                          testing::ValuesIn(semiring_alpha_range),
+                                          testing::ValuesIn(semiring_idxbase_range),
+                                          testing::ValuesIn(semiring_idxbase_range)));
+#endif
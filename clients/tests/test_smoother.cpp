@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_smoother.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t> smoother_tuple;
+
+int smoother_ndim_range[] = {16, 40};
+
+// Jacobi, Gauss-Seidel, symmetric Gauss-Seidel and SOR
+int smoother_alg_range[] = {0, 1, 2, 3};
+
+hipsparseIndexBase_t smoother_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_smoother : public testing::TestWithParam<smoother_tuple>
+{
+protected:
+    parameterized_smoother() {}
+    virtual ~parameterized_smoother() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_smoother_arguments(smoother_tuple tup)
+{
+    Arguments arg;
+    arg.M          = std::get<0>(tup);
+    arg.solver_alg = std::get<1>(tup);
+    arg.baseA      = std::get<2>(tup);
+    arg.timing     = 0;
+    return arg;
+}
+
+// Smoothers are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(smoother_bad_arg, smoother_float)
+{
+    testing_smoother_bad_arg();
+}
+
+TEST_P(parameterized_smoother, smoother_host_double)
+{
+    Arguments arg = setup_smoother_arguments(GetParam());
+
+    testing_smoother_host<double>(arg);
+}
+
+TEST_P(parameterized_smoother, smoother_i32_float)
+{
+    Arguments arg = setup_smoother_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_smoother<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_smoother, smoother_i32_double)
+{
+    Arguments arg = setup_smoother_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_smoother<int32_t, int32_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_smoother, smoother_i32_float_complex)
+{
+    Arguments arg = setup_smoother_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_smoother<int32_t, int32_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_smoother, smoother_i32_double_complex)
+{
+    Arguments arg = setup_smoother_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_smoother<int32_t, int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_smoother, smoother_i64_double)
+{
+    Arguments arg = setup_smoother_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_smoother<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoother,
+                         parameterized_smoother,
+                         testing::Combine(testing::ValuesIn(smoother_ndim_range),
+                                          testing::ValuesIn(smoother_alg_range),
+                                          testing::ValuesIn(smoother_idxbase_range)));
+#endif
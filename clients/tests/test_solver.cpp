@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_solver.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, int, hipsparseIndexBase_t> solver_tuple;
+
+int solver_ndim_range[] = {16, 40};
+
+// CG, BiCGStab and GMRES
+int solver_alg_range[] = {0, 1, 2};
+
+// None, Jacobi, ILU0 and IC0
+int solver_precond_range[] = {0, 1, 2, 3};
+
+hipsparseIndexBase_t solver_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_solver : public testing::TestWithParam<solver_tuple>
+{
+protected:
+    parameterized_solver() {}
+    virtual ~parameterized_solver() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_solver_arguments(solver_tuple tup)
+{
+    Arguments arg;
+    arg.M              = std::get<0>(tup);
+    arg.solver_alg     = std::get<1>(tup);
+    arg.solver_precond = std::get<2>(tup);
+    arg.baseA          = std::get<3>(tup);
+    arg.timing         = 0;
+    return arg;
+}
+
+// Solvers are not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(solver_bad_arg, solver_float)
+{
+    testing_solver_bad_arg();
+}
+
+TEST_P(parameterized_solver, solver_host_float)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    testing_solver_host<float>(arg);
+}
+
+TEST_P(parameterized_solver, solver_host_double_complex)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    testing_solver_host<hipDoubleComplex>(arg);
+}
+
+TEST_P(parameterized_solver, solver_i32_float)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_solver<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_solver, solver_i32_double)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_solver<int32_t, int32_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_solver, solver_i32_float_complex)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_solver<int32_t, int32_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_solver, solver_i32_double_complex)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_solver<int32_t, int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_solver, solver_i64_double)
+{
+    Arguments arg = setup_solver_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_solver<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(solver,
+                         parameterized_solver,
+                         testing::Combine(testing::ValuesIn(solver_ndim_range),
+                                          testing::ValuesIn(solver_alg_range),
+                                          testing::ValuesIn(solver_precond_range),
+                                          testing::ValuesIn(solver_idxbase_range)));
+#endif
@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_spmat_convert.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseFormat_t, int, hipsparseIndexBase_t> spmat_convert_tuple;
+
+int spmat_convert_M_range[] = {48, 648};
+int spmat_convert_N_range[] = {8, 520};
+
+hipsparseFormat_t spmat_convert_format_range[] = {HIPSPARSE_FORMAT_CSR,
+                                                  HIPSPARSE_FORMAT_CSC,
+                                                  HIPSPARSE_FORMAT_COO,
+                                                  HIPSPARSE_FORMAT_COO_AOS,
+                                                  HIPSPARSE_FORMAT_BLOCKED_ELL};
+
+int spmat_convert_block_dim_range[] = {1, 4};
+
+hipsparseIndexBase_t spmat_convert_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+class parameterized_spmat_convert : public testing::TestWithParam<spmat_convert_tuple>
+{
+protected:
+    parameterized_spmat_convert() {}
+    virtual ~parameterized_spmat_convert() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmat_convert_arguments(spmat_convert_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.formatB   = std::get<2>(tup);
+    arg.block_dim = std::get<3>(tup);
+    arg.baseA     = std::get<4>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+// hipsparseSpMatConvert is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(spmat_convert_bad_arg, spmat_convert_float)
+{
+    testing_spmat_convert_bad_arg();
+}
+
+TEST_P(parameterized_spmat_convert, spmat_convert_i32_float)
+{
+    Arguments arg = setup_spmat_convert_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmat_convert<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmat_convert, spmat_convert_i64_double)
+{
+    Arguments arg = setup_spmat_convert_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmat_convert<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmat_convert, spmat_convert_i32_double_complex)
+{
+    Arguments arg = setup_spmat_convert_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmat_convert<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(spmat_convert,
+                         parameterized_spmat_convert,
+                         testing::Combine(testing::ValuesIn(spmat_convert_M_range),
+                                          testing::ValuesIn(spmat_convert_N_range),
+                                          testing::ValuesIn(spmat_convert_format_range),
+                                          testing::ValuesIn(spmat_convert_block_dim_range),
+                                          testing::ValuesIn(spmat_convert_idxbase_range)));
+#endif
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (C) 2020 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipsparse_arguments.hpp"
+#include "testing_spmat_get_statistics.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int, int, hipsparseIndexBase_t>         spmat_get_statistics_tuple;
+typedef std::tuple<hipsparseIndexBase_t, std::string> spmat_get_statistics_bin_tuple;
+
+int spmat_get_statistics_M_range[] = {0, 50, 647};
+int spmat_get_statistics_N_range[] = {84, 647};
+
+hipsparseIndexBase_t spmat_get_statistics_idxbase_range[]
+    = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+std::string spmat_get_statistics_bin[] = {"nos1.bin", "nos3.bin", "Chebyshev4.bin"};
+
+class parameterized_spmat_get_statistics : public testing::TestWithParam<spmat_get_statistics_tuple>
+{
+protected:
+    parameterized_spmat_get_statistics() {}
+    virtual ~parameterized_spmat_get_statistics() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmat_get_statistics_bin
+    : public testing::TestWithParam<spmat_get_statistics_bin_tuple>
+{
+protected:
+    parameterized_spmat_get_statistics_bin() {}
+    virtual ~parameterized_spmat_get_statistics_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmat_get_statistics_arguments(spmat_get_statistics_tuple tup)
+{
+    Arguments arg;
+    arg.M      = std::get<0>(tup);
+    arg.N      = std::get<1>(tup);
+    arg.baseA  = std::get<2>(tup);
+    arg.timing = 0;
+    return arg;
+}
+
+Arguments setup_spmat_get_statistics_arguments(spmat_get_statistics_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M      = -99;
+    arg.N      = -99;
+    arg.baseA  = std::get<0>(tup);
+    arg.timing = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<1>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(bin_file);
+
+    return arg;
+}
+
+TEST(spmat_get_statistics_bad_arg, spmat_get_statistics)
+{
+    testing_spmat_get_statistics_bad_arg();
+}
+
+TEST_P(parameterized_spmat_get_statistics, spmat_get_statistics)
+{
+    Arguments arg = setup_spmat_get_statistics_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmat_get_statistics(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmat_get_statistics_bin, spmat_get_statistics_bin)
+{
+    Arguments arg = setup_spmat_get_statistics_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmat_get_statistics(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(spmat_get_statistics,
+                         parameterized_spmat_get_statistics,
+                         testing::Combine(testing::ValuesIn(spmat_get_statistics_M_range),
+                                          testing::ValuesIn(spmat_get_statistics_N_range),
+                                          testing::ValuesIn(spmat_get_statistics_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(spmat_get_statistics_bin,
+                         parameterized_spmat_get_statistics_bin,
+                         testing::Combine(testing::ValuesIn(spmat_get_statistics_idxbase_range),
+                                          testing::ValuesIn(spmat_get_statistics_bin)));
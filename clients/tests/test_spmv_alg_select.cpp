@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+// Host-only selection heuristic of the default SpMV algorithm, no device is required.
+#include "generic/hipsparse_spmv_alg_select.h"
+
+using namespace hipsparse;
+
+static std::vector<int32_t> spmv_alg_select_row_ptr(const std::vector<int32_t>& row_nnz)
+{
+    std::vector<int32_t> row_ptr(row_nnz.size() + 1, 0);
+    for(size_t i = 0; i < row_nnz.size(); ++i)
+    {
+        row_ptr[i + 1] = row_ptr[i] + row_nnz[i];
+    }
+    return row_ptr;
+}
+
+TEST(spmv_alg_select, row_statistics)
+{
+    std::vector<int32_t> row_ptr = spmv_alg_select_row_ptr({2, 0, 4, 2});
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int32_t>(4, row_ptr.data());
+
+    EXPECT_EQ(stats.m, 4);
+    EXPECT_EQ(stats.nnz, 8);
+    EXPECT_EQ(stats.max_row_nnz, 4);
+    EXPECT_EQ(stats.empty_rows, 1);
+    EXPECT_DOUBLE_EQ(stats.mean_row_nnz, 2.0);
+    EXPECT_DOUBLE_EQ(stats.cv_row_nnz, std::sqrt(2.0) / 2.0);
+}
+
+TEST(spmv_alg_select, row_statistics_one_based)
+{
+    std::vector<int64_t> row_ptr = {1, 4, 7, 10};
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int64_t>(3, row_ptr.data());
+
+    EXPECT_EQ(stats.nnz, 9);
+    EXPECT_EQ(stats.max_row_nnz, 3);
+    EXPECT_EQ(stats.empty_rows, 0);
+    EXPECT_DOUBLE_EQ(stats.cv_row_nnz, 0.0);
+}
+
+TEST(spmv_alg_select, uniform_rows)
+{
+    std::vector<int32_t> row_ptr = spmv_alg_select_row_ptr(std::vector<int32_t>(1000, 27));
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int32_t>(1000, row_ptr.data());
+
+    EXPECT_EQ(select_spmv_path(stats, false, false, true), spmv_path_stream);
+}
+
+TEST(spmv_alg_select, irregular_rows)
+{
+    // Rows alternate between 2 and 40 entries
+    std::vector<int32_t> row_nnz(1000);
+    for(size_t i = 0; i < row_nnz.size(); ++i)
+    {
+        row_nnz[i] = (i % 2 == 0) ? 2 : 40;
+    }
+
+    std::vector<int32_t> row_ptr = spmv_alg_select_row_ptr(row_nnz);
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int32_t>(1000, row_ptr.data());
+
+    EXPECT_EQ(select_spmv_path(stats, false, false, true), spmv_path_adaptive);
+}
+
+TEST(spmv_alg_select, skewed_rows)
+{
+    // A few very long rows in an otherwise short matrix
+    std::vector<int32_t> row_nnz(10000, 4);
+    row_nnz[0]    = 5000;
+    row_nnz[5000] = 5000;
+
+    std::vector<int32_t> row_ptr = spmv_alg_select_row_ptr(row_nnz);
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int32_t>(10000, row_ptr.data());
+
+    EXPECT_EQ(select_spmv_path(stats, false, false, true), spmv_path_lrb);
+
+    // LRB does not support symmetric matrices
+    EXPECT_EQ(select_spmv_path(stats, false, true, true), spmv_path_adaptive);
+
+    // LRB does not support transposed products either
+    EXPECT_EQ(select_spmv_path(stats, true, false, true), spmv_path_adaptive);
+}
+
+TEST(spmv_alg_select, empty_rows)
+{
+    // Three out of four rows are empty
+    std::vector<int32_t> row_nnz(1000, 0);
+    for(size_t i = 0; i < row_nnz.size(); i += 4)
+    {
+        row_nnz[i] = 16;
+    }
+
+    std::vector<int32_t> row_ptr = spmv_alg_select_row_ptr(row_nnz);
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int32_t>(1000, row_ptr.data());
+
+    EXPECT_EQ(stats.empty_rows, 750);
+    EXPECT_EQ(select_spmv_path(stats, false, false, true), spmv_path_coo);
+    EXPECT_NE(select_spmv_path(stats, false, false, false), spmv_path_coo);
+}
+
+TEST(spmv_alg_select, empty_matrix)
+{
+    std::vector<int32_t> row_ptr = spmv_alg_select_row_ptr(std::vector<int32_t>(10, 0));
+
+    spmv_row_statistics stats = compute_spmv_row_statistics<int32_t>(10, row_ptr.data());
+
+    EXPECT_EQ(stats.nnz, 0);
+    EXPECT_EQ(select_spmv_path(stats, false, false, true), spmv_path_stream);
+
+    stats = compute_spmv_row_statistics<int32_t>(0, row_ptr.data());
+    EXPECT_EQ(select_spmv_path(stats, false, false, true), spmv_path_stream);
+}
+
+TEST(spmv_alg_select, override)
+{
+    spmv_path path = spmv_path_stream;
+
+    EXPECT_FALSE(parse_spmv_path(nullptr, &path));
+    EXPECT_FALSE(parse_spmv_path("", &path));
+    EXPECT_FALSE(parse_spmv_path("csr", &path));
+    EXPECT_EQ(path, spmv_path_stream);
+
+    EXPECT_TRUE(parse_spmv_path("adaptive", &path));
+    EXPECT_EQ(path, spmv_path_adaptive);
+    EXPECT_TRUE(parse_spmv_path("lrb", &path));
+    EXPECT_EQ(path, spmv_path_lrb);
+    EXPECT_TRUE(parse_spmv_path("coo", &path));
+    EXPECT_EQ(path, spmv_path_coo);
+    EXPECT_TRUE(parse_spmv_path("stream", &path));
+    EXPECT_EQ(path, spmv_path_stream);
+    EXPECT_TRUE(parse_spmv_path("auto", &path));
+    EXPECT_EQ(path, spmv_path_auto);
+    EXPECT_TRUE(parse_spmv_path("default", &path));
+    EXPECT_EQ(path, spmv_path_default);
+}
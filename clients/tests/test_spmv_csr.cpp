@@ -163,6 +163,110 @@ TEST_P(parameterized_spmv_csr, spmv_csr_i64_double_complex)
     EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
 }
 
+TEST_P(parameterized_spmv_csr, spmv_csr_alternating_i32_float)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_alternating<int32_t, int32_t, float>(
+        arg, HIPSPARSE_OPERATION_TRANSPOSE, static_cast<hipsparseSpMVAlg_t>(arg.spmv_alg));
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_alternating_i64_double_complex)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_alternating<int64_t, int64_t, hipDoubleComplex>(
+        arg, HIPSPARSE_OPERATION_TRANSPOSE, static_cast<hipsparseSpMVAlg_t>(arg.spmv_alg));
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+#if(!defined(CUDART_VERSION))
+// Second algorithm alternated with the requested one on the same operation
+static hipsparseSpMVAlg_t spmv_csr_alternate_alg(const Arguments& arg)
+{
+    return (arg.spmv_alg == HIPSPARSE_SPMV_CSR_ALG1) ? HIPSPARSE_SPMV_CSR_ALG2
+                                                     : HIPSPARSE_SPMV_CSR_ALG1;
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_alternating_alg_i32_float)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_alternating<int32_t, int32_t, float>(
+        arg, HIPSPARSE_OPERATION_NON_TRANSPOSE, spmv_csr_alternate_alg(arg));
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_alternating_alg_i64_double)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_alternating<int64_t, int64_t, double>(
+        arg, HIPSPARSE_OPERATION_NON_TRANSPOSE, spmv_csr_alternate_alg(arg));
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_alternating_op_alg_i32_double_complex)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_alternating<int32_t, int32_t, hipDoubleComplex>(
+        arg, HIPSPARSE_OPERATION_TRANSPOSE, spmv_csr_alternate_alg(arg));
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
+#if(!defined(CUDART_VERSION))
+TEST_P(parameterized_spmv_csr, spmv_csr_update_values_i32_float)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_update_values<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_update_values_i64_double)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_update_values<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_dot_i32_float)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_dot<int32_t, int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_dot_i64_double)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_dot<int64_t, int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr, spmv_csr_dot_i32_float_complex)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_dot<int32_t, int32_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_csr_bin, spmv_csr_dot_bin_i32_double)
+{
+    Arguments arg = setup_spmv_csr_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_csr_dot<int32_t, int32_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+#endif
+
 TEST_P(parameterized_spmv_csr_bin, spmv_csr_bin_i32_float)
 {
     Arguments arg = setup_spmv_csr_arguments(GetParam());
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_symmetric.hpp"
+
+#include <hipsparse.h>
+
+typedef std::tuple<int,
+                   double,
+                   double,
+                   hipsparseOperation_t,
+                   hipsparseFillMode_t,
+                   hipsparseMatrixType_t,
+                   hipsparseFormat_t,
+                   hipsparseIndexBase_t>
+    spmv_symmetric_tuple;
+
+typedef std::tuple<int,
+                   int,
+                   hipsparseOperation_t,
+                   hipsparseOperation_t,
+                   hipsparseOrder_t,
+                   hipsparseFillMode_t,
+                   hipsparseMatrixType_t,
+                   hipsparseFormat_t,
+                   hipsparseIndexBase_t>
+    spmm_symmetric_tuple;
+
+typedef std::tuple<double,
+                   double,
+                   hipsparseOperation_t,
+                   hipsparseFillMode_t,
+                   hipsparseMatrixType_t,
+                   hipsparseFormat_t,
+                   std::string>
+    spmv_symmetric_file_tuple;
+
+int symmetric_M_range[] = {50, 1149};
+int symmetric_N_range[] = {7};
+
+double symmetric_alpha_range[] = {2.0};
+double symmetric_beta_range[]  = {0.0, 0.5};
+
+hipsparseOperation_t symmetric_transA_range[] = {HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                                                 HIPSPARSE_OPERATION_TRANSPOSE,
+                                                 HIPSPARSE_OPERATION_CONJUGATE_TRANSPOSE};
+hipsparseOperation_t symmetric_transB_range[]
+    = {HIPSPARSE_OPERATION_NON_TRANSPOSE, HIPSPARSE_OPERATION_TRANSPOSE};
+hipsparseOrder_t    symmetric_order_range[] = {HIPSPARSE_ORDER_COL, HIPSPARSE_ORDER_ROW};
+hipsparseFillMode_t symmetric_fill_range[]
+    = {HIPSPARSE_FILL_MODE_LOWER, HIPSPARSE_FILL_MODE_UPPER};
+hipsparseMatrixType_t symmetric_matrix_type_range[]
+    = {HIPSPARSE_MATRIX_TYPE_SYMMETRIC, HIPSPARSE_MATRIX_TYPE_HERMITIAN};
+hipsparseFormat_t    symmetric_format_range[]  = {HIPSPARSE_FORMAT_CSR, HIPSPARSE_FORMAT_ELL};
+hipsparseIndexBase_t symmetric_idxbase_range[] = {HIPSPARSE_INDEX_BASE_ZERO, HIPSPARSE_INDEX_BASE_ONE};
+
+// Symmetric matrix market files, read without expanding the stored triangle
+std::string symmetric_mtx_range[] = {"nos1.mtx", "nos3.mtx"};
+
+class parameterized_spmv_symmetric : public testing::TestWithParam<spmv_symmetric_tuple>
+{
+protected:
+    parameterized_spmv_symmetric() {}
+    virtual ~parameterized_spmv_symmetric() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmm_symmetric : public testing::TestWithParam<spmm_symmetric_tuple>
+{
+protected:
+    parameterized_spmm_symmetric() {}
+    virtual ~parameterized_spmm_symmetric() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmv_symmetric_file : public testing::TestWithParam<spmv_symmetric_file_tuple>
+{
+protected:
+    parameterized_spmv_symmetric_file() {}
+    virtual ~parameterized_spmv_symmetric_file() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmv_symmetric_arguments(spmv_symmetric_tuple tup)
+{
+    Arguments arg;
+    arg.M           = std::get<0>(tup);
+    arg.alpha       = std::get<1>(tup);
+    arg.beta        = std::get<2>(tup);
+    arg.transA      = std::get<3>(tup);
+    arg.fill_mode   = std::get<4>(tup);
+    arg.matrix_type = std::get<5>(tup);
+    arg.formatA     = std::get<6>(tup);
+    arg.baseA       = std::get<7>(tup);
+    arg.timing      = 0;
+    return arg;
+}
+
+Arguments setup_spmm_symmetric_arguments(spmm_symmetric_tuple tup)
+{
+    Arguments arg;
+    arg.M           = std::get<0>(tup);
+    arg.N           = std::get<1>(tup);
+    arg.alpha       = 2.0;
+    arg.beta        = 0.5;
+    arg.transA      = std::get<2>(tup);
+    arg.transB      = std::get<3>(tup);
+    arg.orderB      = std::get<4>(tup);
+    arg.orderC      = std::get<4>(tup);
+    arg.fill_mode   = std::get<5>(tup);
+    arg.matrix_type = std::get<6>(tup);
+    arg.formatA     = std::get<7>(tup);
+    arg.baseA       = std::get<8>(tup);
+    arg.timing      = 0;
+    return arg;
+}
+
+Arguments setup_spmv_symmetric_file_arguments(spmv_symmetric_file_tuple tup)
+{
+    Arguments arg;
+    arg.M           = -99;
+    arg.alpha       = std::get<0>(tup);
+    arg.beta        = std::get<1>(tup);
+    arg.transA      = std::get<2>(tup);
+    arg.fill_mode   = std::get<3>(tup);
+    arg.matrix_type = std::get<4>(tup);
+    arg.formatA     = std::get<5>(tup);
+    arg.baseA       = HIPSPARSE_INDEX_BASE_ZERO;
+    arg.timing      = 0;
+
+    // Determine absolute path of test matrix
+    std::string mtx_file = std::get<6>(tup);
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = get_filename(mtx_file);
+
+    return arg;
+}
+
+// The matrix type attribute is not supported in cusparse
+#if(!defined(CUDART_VERSION))
+TEST(symmetric_bad_arg, symmetric_float)
+{
+    testing_symmetric_bad_arg();
+}
+
+TEST_P(parameterized_spmv_symmetric, spmv_symmetric_i32_float)
+{
+    Arguments arg = setup_spmv_symmetric_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_symmetric<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_symmetric, spmv_symmetric_i64_double)
+{
+    Arguments arg = setup_spmv_symmetric_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_symmetric<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_symmetric, spmv_symmetric_i32_double_complex)
+{
+    Arguments arg = setup_spmv_symmetric_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_symmetric<int32_t, hipDoubleComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_symmetric, spmm_symmetric_i32_float)
+{
+    Arguments arg = setup_spmm_symmetric_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_symmetric<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmm_symmetric, spmm_symmetric_i64_float_complex)
+{
+    Arguments arg = setup_spmm_symmetric_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmm_symmetric<int64_t, hipComplex>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_symmetric_file, spmv_symmetric_file_i32_float)
+{
+    Arguments arg = setup_spmv_symmetric_file_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_symmetric<int32_t, float>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+TEST_P(parameterized_spmv_symmetric_file, spmv_symmetric_file_i64_double)
+{
+    Arguments arg = setup_spmv_symmetric_file_arguments(GetParam());
+
+    hipsparseStatus_t status = testing_spmv_symmetric<int64_t, double>(arg);
+    EXPECT_EQ(status, HIPSPARSE_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(symmetric,
+                         parameterized_spmv_symmetric,
+                         testing::Combine(testing::ValuesIn(symmetric_M_range),
+                                          testing::ValuesIn(symmetric_alpha_range),
+                                          testing::ValuesIn(symmetric_beta_range),
+                                          testing::ValuesIn(symmetric_transA_range),
+                                          testing::ValuesIn(symmetric_fill_range),
+                                          testing::ValuesIn(symmetric_matrix_type_range),
+                                          testing::ValuesIn(symmetric_format_range),
+                                          testing::ValuesIn(symmetric_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(symmetric,
+                         parameterized_spmm_symmetric,
+                         testing::Combine(testing::ValuesIn(symmetric_M_range),
+                                          testing::ValuesIn(symmetric_N_range),
+                                          testing::ValuesIn(symmetric_transA_range),
+                                          testing::ValuesIn(symmetric_transB_range),
+                                          testing::ValuesIn(symmetric_order_range),
+                                          testing::ValuesIn(symmetric_fill_range),
+                                          testing::ValuesIn(symmetric_matrix_type_range),
+                                          testing::ValuesIn(symmetric_format_range),
+                                          testing::ValuesIn(symmetric_idxbase_range)));
+
+INSTANTIATE_TEST_SUITE_P(symmetric,
+                         parameterized_spmv_symmetric_file,
+                         testing::Combine(testing::ValuesIn(symmetric_alpha_range),
+                                          testing::ValuesIn(symmetric_beta_range),
+                                          testing::ValuesIn(symmetric_transA_range),
+                                          testing::ValuesIn(symmetric_fill_range),
+                                          testing::ValuesIn(symmetric_matrix_type_range),
+                                          testing::ValuesIn(symmetric_format_range),
+                                          testing::ValuesIn(symmetric_mtx_range)));
+#endif
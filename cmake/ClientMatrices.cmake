@@ -93,6 +93,12 @@ if(STATUS AND NOT STATUS EQUAL 0)
   message(FATAL_ERROR "mtx2csr.exe failed to build, aborting.")
 endif()
 
+# Symmetric matrices that are also kept as .mtx files, to test the storage of their triangle
+set(TEST_MTX_MATRICES
+  nos1
+  nos3
+)
+
 list(LENGTH TEST_MATRICES len)
 math(EXPR len1 "${len} - 1")
 
@@ -104,8 +110,11 @@ foreach(i RANGE 0 ${len1})
   list(GET sep_m 0 dir)
   list(GET sep_m 1 mat)
 
+  list(FIND TEST_MTX_MATRICES ${mat} keep_mtx)
+
   # Download test matrices if not already downloaded
-  if(NOT EXISTS "${CMAKE_MATRICES_DIR}/${mat}.bin")
+  if(NOT EXISTS "${CMAKE_MATRICES_DIR}/${mat}.bin"
+     OR (NOT keep_mtx EQUAL -1 AND NOT EXISTS "${CMAKE_MATRICES_DIR}/${mat}.mtx"))
     if(NOT HIPSPARSE_MTX_DIR)
       # First try user specified mirror, if available
       if(DEFINED ENV{HIPSPARSE_TEST_MIRROR} AND NOT $ENV{HIPSPARSE_TEST_MIRROR} STREQUAL "")
@@ -173,7 +182,10 @@ foreach(i RANGE 0 ${len1})
       message(STATUS "${mat} success.")
     endif()
     # TODO: add 'COMMAND_ERROR_IS_FATAL ANY' once cmake supported version is 3.19
-    file(REMOVE_RECURSE ${CMAKE_MATRICES_DIR}/${mat}.tar.gz ${CMAKE_MATRICES_DIR}/${mat} ${CMAKE_MATRICES_DIR}/${mat}.mtx)
+    file(REMOVE_RECURSE ${CMAKE_MATRICES_DIR}/${mat}.tar.gz ${CMAKE_MATRICES_DIR}/${mat})
+    if(keep_mtx EQUAL -1)
+      file(REMOVE ${CMAKE_MATRICES_DIR}/${mat}.mtx)
+    endif()
 
   endif()
 endforeach()
@@ -119,6 +119,208 @@ hipsparseStatus_t hipsparseSetStream(hipsparseHandle_t handle, hipStream_t strea
 HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* streamId);
 
+/*! \ingroup aux_module
+ *  \brief Get the performance counters of a handle
+ *
+ *  \details
+ *  \p hipsparseGetCounters returns the totals of the performance counters of the hipSPARSE
+ *  library context: the number of routine calls, the host time spent in them, the number and
+ *  size of device memory allocations made internally on behalf of the caller, and the number
+ *  of synchronizations forced by routines that are blocking.
+ *
+ *  Counting is always enabled and does not synchronize. The device time of routine calls is
+ *  only measured if the environment variable \p HIPSPARSE_COUNTERS_DEVICE_TIME is set to 1,
+ *  and is 0 otherwise. It is measured with HIP events on the stream of the handle and covers
+ *  the calls that have completed on the device, calls captured into a graph are not timed.
+ *
+ *  \note
+ *  Only the routines called by the application are counted. hipSPARSE routines that are
+ *  called internally by another routine are part of the counts of the calling routine.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *  @param[out]
+ *  counters    performance counters of \p handle.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is not initialized.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p counters is invalid.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetCounters(hipsparseHandle_t handle, hipsparseCounters_t* counters);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Get the performance counters of each routine of a handle
+ *
+ *  \details
+ *  \p hipsparseGetRoutineCounters returns the performance counters of every routine that has
+ *  been called through the hipSPARSE library context. On input, \p count holds the number of
+ *  entries of \p counters. On output, it holds the number of routines that have been called.
+ *  If \p counters is \p nullptr, only the number of routines is returned. Otherwise, the
+ *  counters of up to the given number of routines are written to \p counters.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *  @param[inout]
+ *  count       number of entries of \p counters on input, number of routines on output.
+ *  @param[out]
+ *  counters    array of \p count routine counters, or \p nullptr.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is not initialized.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p count is invalid.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGetRoutineCounters(hipsparseHandle_t           handle,
+                                              int*                        count,
+                                              hipsparseRoutineCounters_t* counters);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Reset the performance counters of a handle
+ *
+ *  \details
+ *  \p hipsparseResetCounters sets all performance counters of the hipSPARSE library context
+ *  to zero.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is not initialized.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseResetCounters(hipsparseHandle_t handle);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Create a graph plan
+ *
+ *  \details
+ *  \p hipsparseCreateGraphPlan creates a graph plan. A graph plan records a sequence of
+ *  hipSPARSE calls into a HIP graph, such that repeated pipelines, e.g. the SpMV and vector
+ *  updates of an iterative solver, are replayed with a single launch. It should be destroyed
+ *  at the end using hipsparseDestroyGraphPlan().
+ *
+ *  @param[out]
+ *  plan        the pointer to the graph plan.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p plan pointer is invalid.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateGraphPlan(hipsparseGraphPlan_t* plan);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Destroy a graph plan
+ *
+ *  \details
+ *  \p hipsparseDestroyGraphPlan destroys a graph plan and releases its graph. A capture that
+ *  is still running is abandoned and the handle gets its stream back.
+ *
+ *  @param[in]
+ *  plan        the graph plan.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyGraphPlan(hipsparseGraphPlan_t plan);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Start recording hipSPARSE calls into a graph plan
+ *
+ *  \details
+ *  \p hipsparseGraphPlanBeginCapture starts capturing the work of all subsequent calls made
+ *  with \p handle into \p plan, until hipsparseGraphPlanEndCapture() is called. During the
+ *  capture, the handle stream is replaced by a capture stream of the plan. Work issued by the
+ *  caller on the stream returned by hipsparseGetStream() is captured as well.
+ *
+ *  The captured calls are not executed. Descriptors and buffers are recorded by address, such
+ *  that their contents can change between launches, but they must not be destroyed or point
+ *  to different memory while the plan is in use. Scalars are read during the capture with
+ *  \ref HIPSPARSE_POINTER_MODE_HOST and at every launch with \ref HIPSPARSE_POINTER_MODE_DEVICE.
+ *
+ *  \note
+ *  Setup work of the first call with a descriptor, such as algorithm selection, analysis and
+ *  internal buffer allocation of hipsparseSpMV() and hipsparseSpSV_solve(), cannot be
+ *  captured. It is executed eagerly on a side stream during the capture instead, using the
+ *  matrix as it is at that time. Calls that return a result to the host synchronize the
+ *  stream and invalidate the capture.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *  @param[inout]
+ *  plan        the graph plan.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is not initialized.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p plan is invalid or already capturing.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGraphPlanBeginCapture(hipsparseHandle_t    handle,
+                                                 hipsparseGraphPlan_t plan);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Stop recording hipSPARSE calls into a graph plan
+ *
+ *  \details
+ *  \p hipsparseGraphPlanEndCapture ends the capture started by
+ *  hipsparseGraphPlanBeginCapture(), restores the stream of \p handle and instantiates the
+ *  captured graph. A sequence captured previously into \p plan is replaced.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *  @param[inout]
+ *  plan        the graph plan.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is not initialized.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p plan is invalid or not capturing with
+ *           \p handle.
+ *  \retval HIPSPARSE_STATUS_INTERNAL_ERROR the capture was invalidated by an operation that
+ *           cannot be captured, or the graph could not be instantiated.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGraphPlanEndCapture(hipsparseHandle_t    handle,
+                                               hipsparseGraphPlan_t plan);
+#endif
+
+/*! \ingroup aux_module
+ *  \brief Replay a graph plan
+ *
+ *  \details
+ *  \p hipsparseGraphPlanLaunch launches the sequence captured into \p plan on the stream of
+ *  \p handle with a single graph launch.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the hipsparse library context queue.
+ *  @param[in]
+ *  plan        the graph plan.
+ *
+ *  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+ *  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p handle is not initialized.
+ *  \retval HIPSPARSE_STATUS_INVALID_VALUE \p plan is invalid, has not captured a sequence
+ *           yet or is still capturing.
+ */
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseGraphPlanLaunch(hipsparseHandle_t handle, hipsparseGraphPlan_t plan);
+#endif
+
 /*! \ingroup aux_module
  *  \brief Specify pointer mode
  *
@@ -533,6 +735,50 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDestroyColorInfo(hipsparseColorInfo_t info);
 #endif
 
+#if(!defined(CUDART_VERSION))
+/*! \ingroup aux_module
+ *  \brief Create a permute info structure
+ *
+ *  \details
+ *  \p hipsparseCreatePermuteInfo creates a structure that holds the permute info data
+ *  that is gathered during hipsparseXcsrpermute_analysis() or hipsparseXbsrpermute_analysis().
+ *  It should be destroyed at the end using hipsparseDestroyPermuteInfo().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreatePermuteInfo(hipsparsePermuteInfo_t* info);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a permute info structure
+ *
+ *  \details
+ *  \p hipsparseDestroyPermuteInfo destroys a permute info structure.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyPermuteInfo(hipsparsePermuteInfo_t info);
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup aux_module
+ *  \brief Create an ILU info structure
+ *
+ *  \details
+ *  \p hipsparseCreateIluInfo creates a structure that holds the ILU info data that is
+ *  gathered during hipsparseXcsriluk_analysis() or hipsparseXcsrilutNnz().
+ *  It should be destroyed at the end using hipsparseDestroyIluInfo().
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateIluInfo(hipsparseIluInfo_t* info);
+
+/*! \ingroup aux_module
+ *  \brief Destroy an ILU info structure
+ *
+ *  \details
+ *  \p hipsparseDestroyIluInfo destroys an ILU info structure.
+ */
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDestroyIluInfo(hipsparseIluInfo_t info);
+#endif
+
 #if(!defined(CUDART_VERSION) || CUDART_VERSION < 12000)
 /* Info structures */
 /*! \ingroup aux_module
@@ -309,7 +309,8 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
 *  \brief Create a sparse Blocked ELL matrix descriptor
 *  \details
 *  \p hipsparseCreateCsr creates a sparse Blocked ELL matrix descriptor. It should be
-*  destroyed at the end using \p hipsparseDestroySpMat.
+*  destroyed at the end using \p hipsparseDestroySpMat. \p hipsparseCsr2BlockedEllNnz and
+*  \p hipsparseCsr2BlockedEll convert a CSR matrix into this format.
 */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11021)
 HIPSPARSE_EXPORT
@@ -345,6 +346,244 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                                  hipDataType                 valueType);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Create a sparse ELL matrix descriptor
+*  \details
+*  \p hipsparseCreateEll creates a sparse ELL matrix descriptor. It should be destroyed at the
+*  end using \p hipsparseDestroySpMat.
+*
+*  Every row stores \p ellWidth entries column by column, i.e. entry \p k of row \p i is stored
+*  at position <tt>k * rows + i</tt> of \p ellColInd and \p ellValues. Rows with less than
+*  \p ellWidth entries are padded with column index -1. \p hipsparseCsr2EllNnz and
+*  \p hipsparseCsr2Ell convert a CSR matrix into this format.
+*
+*  \note
+*  rocSPARSE computes \ref hipsparseSpMV with a general ELL matrix. \ref hipsparseSpMM copies
+*  the entries inside of the matrix into a CSR matrix on the device on its first call or
+*  preprocessing. Products with a symmetric or Hermitian ELL matrix are not supported.
+*
+*  @param[out]
+*  spMatDescr  the pointer to the sparse ELL matrix descriptor.
+*  @param[in]
+*  rows        number of rows of the matrix.
+*  @param[in]
+*  cols        number of columns of the matrix.
+*  @param[in]
+*  ellWidth    number of entries per row.
+*  @param[in]
+*  ellColInd   array of <tt>rows * ellWidth</tt> column indices.
+*  @param[in]
+*  ellValues   array of <tt>rows * ellWidth</tt> values.
+*  @param[in]
+*  ellIdxType  index type of \p ellColInd.
+*  @param[in]
+*  idxBase     index base of \p ellColInd.
+*  @param[in]
+*  valueType   data type of \p ellValues.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateEll(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                ellWidth,
+                                     void*                  ellColInd,
+                                     void*                  ellValues,
+                                     hipsparseIndexType_t   ellIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse ELL matrix descriptor
+*  \details
+*  \p hipsparseCreateConstEll creates a sparse ELL matrix descriptor with constant arrays, see
+*  \p hipsparseCreateEll. It should be destroyed at the end using \p hipsparseDestroySpMat.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateConstEll(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     ellWidth,
+                                          const void*                 ellColInd,
+                                          const void*                 ellValues,
+                                          hipsparseIndexType_t        ellIdxType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse SELL-C-sigma matrix descriptor
+*  \details
+*  \p hipsparseCreateSell creates a sparse sliced ELL (SELL-C-sigma) matrix descriptor. It
+*  should be destroyed at the end using \p hipsparseDestroySpMat.
+*
+*  The rows of the matrix are grouped into slices of \p sliceSize consecutive rows. Slice \p s
+*  stores its entries column by column, i.e. entry \p k of row \p r of the slice is stored at
+*  position <tt>sellSliceOffsets[s] + k * sliceSize + r</tt> of \p sellColInd and
+*  \p sellValues, and is padded to the length of its longest row. Padded entries have column
+*  index -1. If \p sellRowPerm is not null, row \p i of the sliced matrix is row
+*  <tt>sellRowPerm[i]</tt> of the matrix, such that rows of similar length can be sorted into
+*  the same slice. \p hipsparseCsr2SellNnz and \p hipsparseCsr2Sell convert a CSR matrix
+*  into this format.
+*
+*  \note
+*  Neither rocSPARSE nor hipSPARSE have kernels for this format. \ref hipsparseSpMV and
+*  \ref hipsparseSpMM return \ref HIPSPARSE_STATUS_NOT_SUPPORTED for SELL-C-sigma matrices,
+*  the descriptor only holds the arrays for user kernels.
+*
+*  @param[out]
+*  spMatDescr          the pointer to the sparse SELL-C-sigma matrix descriptor.
+*  @param[in]
+*  rows                number of rows of the matrix.
+*  @param[in]
+*  cols                number of columns of the matrix.
+*  @param[in]
+*  nnz                 number of non-zero entries of the matrix.
+*  @param[in]
+*  sellValuesSize      number of entries of \p sellColInd and \p sellValues, including the
+*                      padding.
+*  @param[in]
+*  sliceSize           number of rows per slice.
+*  @param[in]
+*  sellSliceOffsets    array of <tt>ceil(rows / sliceSize) + 1</tt> elements that point to the
+*                      start of each slice.
+*  @param[in]
+*  sellColInd          array of \p sellValuesSize column indices.
+*  @param[in]
+*  sellValues          array of \p sellValuesSize values.
+*  @param[in]
+*  sellRowPerm         array of \p rows row indices, or null if the rows are not permuted.
+*  @param[in]
+*  sellIdxType         index type of \p sellSliceOffsets, \p sellColInd and \p sellRowPerm.
+*  @param[in]
+*  idxBase             index base of \p sellColInd and \p sellRowPerm.
+*  @param[in]
+*  valueType           data type of \p sellValues.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p spMatDescr is invalid, a size is negative,
+*              \p sliceSize is not positive, \p sellValuesSize is less than \p nnz or an
+*              array is null.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p sellIdxType is not supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateSell(hipsparseSpMatDescr_t* spMatDescr,
+                                      int64_t                rows,
+                                      int64_t                cols,
+                                      int64_t                nnz,
+                                      int64_t                sellValuesSize,
+                                      int64_t                sliceSize,
+                                      void*                  sellSliceOffsets,
+                                      void*                  sellColInd,
+                                      void*                  sellValues,
+                                      void*                  sellRowPerm,
+                                      hipsparseIndexType_t   sellIdxType,
+                                      hipsparseIndexBase_t   idxBase,
+                                      hipDataType            valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse SELL-C-sigma matrix descriptor
+*  \details
+*  \p hipsparseCreateConstSell creates a sparse sliced ELL (SELL-C-sigma) matrix descriptor
+*  with constant arrays, see \p hipsparseCreateSell. It should be destroyed at the end using
+*  \p hipsparseDestroySpMat.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateConstSell(hipsparseConstSpMatDescr_t* spMatDescr,
+                                           int64_t                     rows,
+                                           int64_t                     cols,
+                                           int64_t                     nnz,
+                                           int64_t                     sellValuesSize,
+                                           int64_t                     sliceSize,
+                                           const void*                 sellSliceOffsets,
+                                           const void*                 sellColInd,
+                                           const void*                 sellValues,
+                                           const void*                 sellRowPerm,
+                                           hipsparseIndexType_t        sellIdxType,
+                                           hipsparseIndexBase_t        idxBase,
+                                           hipDataType                 valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse DIA matrix descriptor
+*  \details
+*  \p hipsparseCreateDia creates a sparse diagonal (DIA) matrix descriptor. It should be
+*  destroyed at the end using \p hipsparseDestroySpMat.
+*
+*  Diagonal \p d holds the entries <tt>A(i, i + diaOffsets[d])</tt>, stored at position
+*  <tt>d * rows + i</tt> of \p diaValues. Positions whose column is outside of the matrix are
+*  padding. The offsets are not shifted by the index base. The number of non-zeros reported
+*  for the matrix is the number of stored values, <tt>rows * diaNumDiagonals</tt>.
+*  \p hipsparseCsr2DiaNnz and \p hipsparseCsr2Dia convert a CSR matrix into this format.
+*
+*  \note
+*  Neither rocSPARSE nor hipSPARSE have kernels for this format. \ref hipsparseSpMV and
+*  \ref hipsparseSpMM return \ref HIPSPARSE_STATUS_NOT_SUPPORTED for DIA matrices, the
+*  descriptor only holds the arrays for user kernels. \p hipsparseDia2CsrNnz and
+*  \p hipsparseDia2Csr convert the matrix back into CSR.
+*
+*  @param[out]
+*  spMatDescr       the pointer to the sparse DIA matrix descriptor.
+*  @param[in]
+*  rows             number of rows of the matrix.
+*  @param[in]
+*  cols             number of columns of the matrix.
+*  @param[in]
+*  diaNumDiagonals  number of stored diagonals.
+*  @param[in]
+*  diaOffsets       array of \p diaNumDiagonals diagonal offsets.
+*  @param[in]
+*  diaValues        array of <tt>rows * diaNumDiagonals</tt> values.
+*  @param[in]
+*  diaIdxType       index type of \p diaOffsets.
+*  @param[in]
+*  idxBase          index base of the matrix.
+*  @param[in]
+*  valueType        data type of \p diaValues.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p spMatDescr is invalid, a size is negative or an
+*              array is null.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p diaIdxType is not supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateDia(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                diaNumDiagonals,
+                                     void*                  diaOffsets,
+                                     void*                  diaValues,
+                                     hipsparseIndexType_t   diaIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse DIA matrix descriptor
+*  \details
+*  \p hipsparseCreateConstDia creates a sparse diagonal (DIA) matrix descriptor with constant
+*  arrays, see \p hipsparseCreateDia. It should be destroyed at the end using
+*  \p hipsparseDestroySpMat.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCreateConstDia(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     diaNumDiagonals,
+                                          const void*                 diaOffsets,
+                                          const void*                 diaValues,
+                                          hipsparseIndexType_t        diaIdxType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Destroy a sparse matrix descriptor
 *  \details
@@ -534,10 +773,134 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
                                               hipDataType*               valueType);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse ELL matrix
+*  \details
+*  \p hipsparseEllGet gets the fields of the sparse ELL matrix descriptor, see
+*  \p hipsparseCreateEll.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    ellWidth,
+                                  void**                      ellColInd,
+                                  void**                      ellValues,
+                                  hipsparseIndexType_t*       ellIdxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse ELL matrix
+*  \details
+*  \p hipsparseConstEllGet gets the fields of the sparse ELL matrix descriptor, see
+*  \p hipsparseCreateEll.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseConstEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   ellWidth,
+                                       const void**               ellColInd,
+                                       const void**               ellValues,
+                                       hipsparseIndexType_t*      ellIdxType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse SELL-C-sigma matrix
+*  \details
+*  \p hipsparseSellGet gets the fields of the sparse SELL-C-sigma matrix descriptor, see
+*  \p hipsparseCreateSell.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSellGet(const hipsparseSpMatDescr_t spMatDescr,
+                                   int64_t*                    rows,
+                                   int64_t*                    cols,
+                                   int64_t*                    nnz,
+                                   int64_t*                    sellValuesSize,
+                                   int64_t*                    sliceSize,
+                                   void**                      sellSliceOffsets,
+                                   void**                      sellColInd,
+                                   void**                      sellValues,
+                                   void**                      sellRowPerm,
+                                   hipsparseIndexType_t*       sellIdxType,
+                                   hipsparseIndexBase_t*       idxBase,
+                                   hipDataType*                valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse SELL-C-sigma matrix
+*  \details
+*  \p hipsparseConstSellGet gets the fields of the sparse SELL-C-sigma matrix descriptor, see
+*  \p hipsparseCreateSell.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseConstSellGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                        int64_t*                   rows,
+                                        int64_t*                   cols,
+                                        int64_t*                   nnz,
+                                        int64_t*                   sellValuesSize,
+                                        int64_t*                   sliceSize,
+                                        const void**               sellSliceOffsets,
+                                        const void**               sellColInd,
+                                        const void**               sellValues,
+                                        const void**               sellRowPerm,
+                                        hipsparseIndexType_t*      sellIdxType,
+                                        hipsparseIndexBase_t*      idxBase,
+                                        hipDataType*               valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse DIA matrix
+*  \details
+*  \p hipsparseDiaGet gets the fields of the sparse DIA matrix descriptor, see
+*  \p hipsparseCreateDia.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDiaGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    diaNumDiagonals,
+                                  void**                      diaOffsets,
+                                  void**                      diaValues,
+                                  hipsparseIndexType_t*       diaIdxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Get pointers of a sparse DIA matrix
+*  \details
+*  \p hipsparseConstDiaGet gets the fields of the sparse DIA matrix descriptor, see
+*  \p hipsparseCreateDia.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseConstDiaGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   diaNumDiagonals,
+                                       const void**               diaOffsets,
+                                       const void**               diaValues,
+                                       hipsparseIndexType_t*      diaIdxType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Set pointers of a sparse CSR matrix
 *  \details
-*  \p hipsparseCsrSetPointers sets the fields of the sparse CSR matrix descriptor
+*  \p hipsparseCsrSetPointers sets the fields of the sparse CSR matrix descriptor. Analysis data
+*  attached to the descriptor is invalidated if the index arrays change, changing only the values
+*  array keeps it valid.
 */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11000)
 HIPSPARSE_EXPORT
@@ -550,7 +913,9 @@ hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
 /*! \ingroup generic_module
 *  \brief Set pointers of a sparse CSC matrix
 *  \details
-*  \p hipsparseCscSetPointers sets the fields of the sparse CSC matrix descriptor
+*  \p hipsparseCscSetPointers sets the fields of the sparse CSC matrix descriptor. Analysis data
+*  attached to the descriptor is invalidated if the index arrays change, changing only the values
+*  array keeps it valid.
 */
 #if(!defined(CUDART_VERSION))
 HIPSPARSE_EXPORT
@@ -563,7 +928,9 @@ hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
 /*! \ingroup generic_module
 *  \brief Set pointers of a sparse COO matrix
 *  \details
-*  \p hipsparseCooSetPointers sets the fields of the sparse COO matrix descriptor
+*  \p hipsparseCooSetPointers sets the fields of the sparse COO matrix descriptor. Analysis data
+*  attached to the descriptor is invalidated if the index arrays change, changing only the values
+*  array keeps it valid.
 */
 #if(!defined(CUDART_VERSION))
 HIPSPARSE_EXPORT
@@ -641,6 +1008,46 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Update the values of a sparse matrix while keeping its sparsity pattern
+*  \details
+*  \p hipsparseSpMatUpdateValues copies \p values into the values array of the sparse matrix
+*  descriptor, asynchronously with respect to the stream of \p handle. The sparsity pattern and all
+*  array pointers of the descriptor stay unchanged, such that analysis data attached to it, e.g.
+*  from \ref hipsparseSpMV_preprocess or \ref hipsparseSpSV_analysis, remains valid and does not
+*  need to be recomputed.
+*
+*  Analysis data is only invalidated when the sparsity pattern pointers change, e.g. through
+*  \ref hipsparseCsrSetPointers. Changing only the values pointer with
+*  \ref hipsparseSpMatSetValues or \ref hipsparseCsrSetPointers keeps it valid as well. In that
+*  case, \ref hipsparseSpSV_solve redoes the analysis in the buffer passed to
+*  \ref hipsparseSpSV_analysis and returns \ref HIPSPARSE_STATUS_INVALID_VALUE if the new
+*  sparsity pattern requires a larger buffer.
+*
+*  \note
+*  Only non-batched CSR, CSC, COO, COO (AoS), ELL, SELL and DIA matrices are supported. For ELL,
+*  SELL and DIA matrices, \p values includes the padding entries.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[inout]
+*  spMatDescr  sparse matrix descriptor whose values are updated.
+*  @param[in]
+*  values      device array containing the new values, of the same size and type as the values
+*              array of \p spMatDescr.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p spMatDescr or \p values is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the format of \p spMatDescr is not supported or the
+*           matrix is batched.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatUpdateValues(hipsparseHandle_t     handle,
+                                             hipsparseSpMatDescr_t spMatDescr,
+                                             const void*           values);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Get the batch count of the sparse matrix
 */
@@ -703,6 +1110,27 @@ hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseSpMatDescr_t     spMatDesc
 
 /*! \ingroup generic_module
 *  \brief Set attribute in sparse matrix descriptor
+*  \details
+*  \p hipsparseSpMatSetAttribute sets an attribute of the sparse matrix descriptor. \p data
+*  points to a \ref hipsparseFillMode_t for \ref HIPSPARSE_SPMAT_FILL_MODE, to a
+*  \ref hipsparseDiagType_t for \ref HIPSPARSE_SPMAT_DIAG_TYPE and to a
+*  \ref hipsparseMatrixType_t for \ref HIPSPARSE_SPMAT_MATRIX_TYPE.
+*
+*  A square matrix with the matrix type \ref HIPSPARSE_MATRIX_TYPE_SYMMETRIC or
+*  \ref HIPSPARSE_MATRIX_TYPE_HERMITIAN only stores the triangle given by the fill mode,
+*  including the diagonal. \ref hipsparseSpMV then multiplies with the full matrix, i.e. each
+*  stored entry \p A(i,j) off the diagonal also stands for \p A(j,i), or its complex conjugate
+*  for Hermitian matrices. Entries of the other triangle are ignored.
+*
+*  \note
+*  Only the products rocSPARSE computes from half storage are supported: \ref hipsparseSpMV
+*  with a symmetric CSR matrix. A symmetric matrix equals its transpose, and a real one also its
+*  conjugate transpose, so these products are computed without transposition. All other
+*  products with symmetric or Hermitian matrices return \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p spMatDescr or \p data is invalid, or \p dataSize
+*          does not match the size of the attribute.
 */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11030)
 HIPSPARSE_EXPORT
@@ -712,6 +1140,40 @@ hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDesc
                                              size_t                    dataSize);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Get structural statistics of a sparse matrix
+*  \details
+*  \p hipsparseSpMatGetStatistics computes the structural statistics of the sparse matrix in a
+*  single pass over its sparsity pattern, see \ref hipsparseSpMatStatistics_t. The statistics are
+*  cached in the sparse matrix descriptor and only recomputed after its sparsity pattern pointers
+*  changed, e.g. through \ref hipsparseCsrSetPointers. Value updates keep the cached statistics.
+*
+*  \note
+*  The first call for a given sparsity pattern copies the pattern to the host and is blocking.
+*
+*  \note
+*  Only CSR, CSC and COO matrices with 32 or 64 bit indices are supported, SELL and DIA matrices
+*  return \ref HIPSPARSE_STATUS_NOT_SUPPORTED. For batched matrices, the statistics of the first
+*  batch are returned.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  spMatDescr  sparse matrix descriptor.
+*  @param[out]
+*  statistics  structural statistics of the sparse matrix.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p spMatDescr or \p statistics is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the format of \p spMatDescr is not supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatGetStatistics(hipsparseHandle_t           handle,
+                                              hipsparseConstSpMatDescr_t  spMatDescr,
+                                              hipsparseSpMatStatistics_t* statistics);
+#endif
+
 /* Dense vector API */
 
 /*! \ingroup generic_module
@@ -817,6 +1279,34 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Get the batch count and batch stride of the dense vector
+*  \details
+*  \p hipsparseDnVecGetStridedBatch returns the batch count and batch stride set with
+*  \ref hipsparseDnVecSetStridedBatch. A dense vector without a batch has a batch count of 1.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDnVecGetStridedBatch(hipsparseConstDnVecDescr_t dnVecDescr,
+                                                int*                       batchCount,
+                                                int64_t*                   batchStride);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Set the batch count and batch stride of the dense vector
+*  \details
+*  \p hipsparseDnVecSetStridedBatch turns the dense vector into a batch of \p batchCount
+*  vectors, where vector \p i starts at element \p i * \p batchStride of the values array.
+*  The batch stride must not be smaller than the vector size. Batched dense vectors are
+*  supported by \ref hipsparseSpMV with CSR and COO matrices.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDnVecSetStridedBatch(hipsparseDnVecDescr_t dnVecDescr,
+                                                int                   batchCount,
+                                                int64_t               batchStride);
+#endif
+
 /* Dense matrix API */
 
 /* Description: Create dense matrix */
@@ -136,6 +136,7 @@ typedef void const* hipsparseConstDnMatDescr_t;
 struct hipsparseSpGEMMDescr;
 struct hipsparseSpSVDescr;
 struct hipsparseSpSMDescr;
+struct hipsparseSpMatConvertDescr;
 /// \endcond
 
 /*! \ingroup types_module
@@ -176,6 +177,20 @@ typedef struct hipsparseSpSVDescr* hipsparseSpSVDescr_t;
 typedef struct hipsparseSpSMDescr* hipsparseSpSMDescr_t;
 #endif
 
+/*! \ingroup types_module
+ *  \brief Generic API opaque structure holding information for a sparse matrix conversion
+ *
+ *  \details
+ *  The hipSPARSE descriptor is an opaque structure holding the sparsity pattern of the target matrix
+ *  and the position of every source value computed by hipsparseSpMatConvert_analysis(). It is used
+ *  in hipsparseSpMatConvert_bufferSize(), hipsparseSpMatConvert_analysis() and hipsparseSpMatConvert().
+ *  It must be initialized using hipsparseSpMatConvert_createDescr(). It should be destroyed at the
+ *  end using hipsparseSpMatConvert_destroyDescr().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparseSpMatConvertDescr* hipsparseSpMatConvertDescr_t;
+#endif
+
 /* Generic API types */
 
 /*! \ingroup generic_module
@@ -192,7 +207,10 @@ typedef enum
     HIPSPARSE_FORMAT_CSC         = 2, /**< Compressed Sparse Column */
     HIPSPARSE_FORMAT_COO         = 3, /**< Coordinate - Structure of Arrays */
     HIPSPARSE_FORMAT_COO_AOS     = 4, /**< Coordinate - Array of Structures */
-    HIPSPARSE_FORMAT_BLOCKED_ELL = 5 /**< Blocked ELL */
+    HIPSPARSE_FORMAT_BLOCKED_ELL = 5, /**< Blocked ELL */
+    HIPSPARSE_FORMAT_SELL        = 7, /**< Sliced ELL (SELL-C-sigma) */
+    HIPSPARSE_FORMAT_ELL         = 8, /**< ELL */
+    HIPSPARSE_FORMAT_DIA         = 9 /**< Diagonal */
 } hipsparseFormat_t;
 #else
 #if(CUDART_VERSION >= 12000)
@@ -440,6 +458,20 @@ typedef enum
 } hipsparseDenseToSparseAlg_t;
 #endif
 
+/*! \ingroup generic_module
+ *  \brief List of hipsparse sparse matrix conversion algorithms.
+ *
+ *  \details
+ *  This is a list of the \ref hipsparseSpMatConvertAlg_t types that are used by the hipSPARSE
+ *  library.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum
+{
+    HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT = 0,
+} hipsparseSpMatConvertAlg_t;
+#endif
+
 /*! \ingroup generic_module
  *  \brief List of hipsparse SDDMM algorithms.
  *
@@ -489,7 +521,14 @@ typedef enum
  *  This is a list of the \ref hipsparseSpMatAttribute_t types that are used by the hipSPARSE
  *  library.
  */
-#if(!defined(CUDART_VERSION) || CUDART_VERSION >= 11030)
+#if(!defined(CUDART_VERSION))
+typedef enum
+{
+    HIPSPARSE_SPMAT_FILL_MODE   = 0, /**< Fill mode attribute */
+    HIPSPARSE_SPMAT_DIAG_TYPE   = 1, /**< Diag type attribute */
+    HIPSPARSE_SPMAT_MATRIX_TYPE = 2 /**< Matrix type attribute */
+} hipsparseSpMatAttribute_t;
+#elif(CUDART_VERSION >= 11030)
 typedef enum
 {
     HIPSPARSE_SPMAT_FILL_MODE = 0, /**< Fill mode attribute */
@@ -497,6 +536,43 @@ typedef enum
 } hipsparseSpMatAttribute_t;
 #endif
 
+/*! \ingroup generic_module
+ *  \brief Number of bins of the non-zeros per row histogram in \ref hipsparseSpMatStatistics_t.
+ */
+#define HIPSPARSE_SPMAT_STATISTICS_HISTOGRAM_BINS 32
+
+/*! \ingroup generic_module
+ *  \brief Structural statistics of a sparse matrix.
+ *
+ *  \details
+ *  \ref hipsparseSpMatStatistics_t holds the structural properties of a sparse matrix as
+ *  returned by \ref hipsparseSpMatGetStatistics. All properties depend on the sparsity pattern
+ *  only.
+ *
+ *  The histogram counts rows by their number of non-zeros. Bin 0 counts empty rows, bin
+ *  \f$k > 0\f$ counts rows with \f$2^{k-1} \leq nnz < 2^k\f$ non-zeros and the last bin also
+ *  counts all longer rows.
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct
+{
+    int64_t rows; /**< Number of rows */
+    int64_t cols; /**< Number of columns */
+    int64_t nnz; /**< Number of stored entries */
+    int64_t minRowNnz; /**< Minimum number of non-zeros per row */
+    int64_t maxRowNnz; /**< Maximum number of non-zeros per row */
+    double  meanRowNnz; /**< Mean number of non-zeros per row */
+    double  stdDevRowNnz; /**< Standard deviation of the number of non-zeros per row */
+    int64_t emptyRows; /**< Number of rows without non-zeros */
+    int64_t rowNnzHistogram[HIPSPARSE_SPMAT_STATISTICS_HISTOGRAM_BINS]; /**< Histogram of non-zeros per row */
+    int64_t lowerBandwidth; /**< Maximum of \f$i - j\f$ over all entries \f$(i, j)\f$, 0 if there are none below the diagonal */
+    int64_t upperBandwidth; /**< Maximum of \f$j - i\f$ over all entries \f$(i, j)\f$, 0 if there are none above the diagonal */
+    int64_t diagonalNnz; /**< Number of stored diagonal entries */
+    int     hasFullDiagonal; /**< 1 if every diagonal entry is stored, 0 otherwise */
+    int     isStructurallySymmetric; /**< 1 if the sparsity pattern is symmetric, 0 otherwise */
+} hipsparseSpMatStatistics_t;
+#endif
+
 /*! \ingroup generic_module
  *  \brief List of hipsparse SpGEMM algorithms.
  *
@@ -540,4 +616,26 @@ typedef enum
 #endif
 #endif
 
+/*! \ingroup generic_module
+ *  \brief List of hipsparse semirings.
+ *
+ *  \details
+ *  This is a list of the \ref hipsparseSemiring_t types that are used by
+ *  \ref hipsparseSpMVSemiring and \ref hipsparseSpGEMM_setSemiring. A semiring replaces the
+ *  addition \f$\oplus\f$ and the multiplication \f$\otimes\f$ of the sparse product. Entries
+ *  that are not stored take the identity of \f$\oplus\f$, which can be queried with
+ *  \ref hipsparseSemiringGetIdentity. rocSPARSE only computes \ref HIPSPARSE_SEMIRING_PLUS_TIMES,
+ *  the products return \ref HIPSPARSE_STATUS_NOT_SUPPORTED for the other semirings.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum
+{
+    HIPSPARSE_SEMIRING_PLUS_TIMES = 0, /**< \f$(+, \times)\f$ with identity \f$0\f$, the arithmetic product. */
+    HIPSPARSE_SEMIRING_MIN_PLUS   = 1, /**< \f$(\min, +)\f$ with identity \f$+\infty\f$, e.g. shortest paths. */
+    HIPSPARSE_SEMIRING_MAX_PLUS   = 2, /**< \f$(\max, +)\f$ with identity \f$-\infty\f$, e.g. longest paths. */
+    HIPSPARSE_SEMIRING_MAX_MIN    = 3, /**< \f$(\max, \min)\f$ with identity \f$-\infty\f$, e.g. widest paths. */
+    HIPSPARSE_SEMIRING_OR_AND     = 4 /**< \f$(\lor, \land)\f$ with identity \f$0\f$, non-zero values are true and results are \f$0\f$ or \f$1\f$, e.g. reachability. */
+} hipsparseSemiring_t;
+#endif
+
 #endif /* HIPSPARSE_GENERIC_TYPES_H */
@@ -37,6 +37,12 @@ struct csric02Info;
 struct csrgemm2Info;
 struct pruneInfo;
 struct csru2csrInfo;
+struct hipsparseGraphPlan;
+struct hipsparseSolverDescr;
+struct hipsparseSmootherDescr;
+struct hipsparseAmgDescr;
+struct hipsparsePermuteInfo;
+struct hipsparseIluInfo;
 /// \endcond
 
 /*! \ingroup types_module
@@ -226,6 +232,90 @@ typedef struct pruneInfo* pruneInfo_t;
  */
 typedef struct csru2csrInfo* csru2csrInfo_t;
 
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding a graph plan.
+ *
+ *  \details
+ *  The hipSPARSE graph plan holds a sequence of hipSPARSE calls that has been captured into a
+ *  HIP graph between hipsparseGraphPlanBeginCapture() and hipsparseGraphPlanEndCapture(), such
+ *  that it can be replayed with a single hipsparseGraphPlanLaunch(). It must be initialized
+ *  using hipsparseCreateGraphPlan() and should be destroyed at the end using
+ *  hipsparseDestroyGraphPlan().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparseGraphPlan* hipsparseGraphPlan_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding a solver descriptor.
+ *
+ *  \details
+ *  The hipSPARSE solver descriptor holds the Krylov method, the preconditioner, the solver
+ *  parameters, the analysis data of a matrix and the convergence of the last solve. It must be
+ *  initialized using hipsparseSolver_createDescr() and should be destroyed at the end using
+ *  hipsparseSolver_destroyDescr().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparseSolverDescr* hipsparseSolverDescr_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding a smoother descriptor.
+ *
+ *  \details
+ *  The hipSPARSE smoother descriptor holds the relaxation method, the smoother parameters and a
+ *  copy of a matrix whose rows are permuted into contiguous blocks of one color each. It must be
+ *  initialized using hipsparseSmoother_createDescr() and should be destroyed at the end using
+ *  hipsparseSmoother_destroyDescr().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparseSmootherDescr* hipsparseSmootherDescr_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding an algebraic multigrid descriptor.
+ *
+ *  \details
+ *  The hipSPARSE multigrid descriptor holds the parameters of a smoothed aggregation multigrid
+ *  method and the hierarchy of levels computed by hipsparseAmg_setup(): the aggregates, the
+ *  prolongators, restrictions and coarse matrices and the smoother of every level. It must be
+ *  initialized using hipsparseAmg_createDescr() and should be destroyed at the end using
+ *  hipsparseAmg_destroyDescr().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparseAmgDescr* hipsparseAmgDescr_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding permute info.
+ *
+ *  \details
+ *  The hipSPARSE permute structure holds the position of every value of a permuted matrix in the
+ *  original matrix. It is computed by hipsparseXcsrpermute_analysis() or
+ *  hipsparseXbsrpermute_analysis() and used by \ref hipsparseScsrpermute "hipsparseXcsrpermute()"
+ *  and \ref hipsparseSbsrpermute "hipsparseXbsrpermute()". It must be initialized using
+ *  hipsparseCreatePermuteInfo() and should be destroyed at the end using
+ *  hipsparseDestroyPermuteInfo().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparsePermuteInfo* hipsparsePermuteInfo_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Pointer type to opaque structure holding ILU info.
+ *
+ *  \details
+ *  The hipSPARSE ILU structure holds the data of an incomplete LU factorization with level of
+ *  fill or threshold dropping. It is computed by hipsparseXcsriluk_analysis() or
+ *  \ref hipsparseScsrilutNnz "hipsparseXcsrilutNnz()" and used by
+ *  \ref hipsparseScsriluk "hipsparseXcsriluk()" and \ref hipsparseScsrilut "hipsparseXcsrilut()".
+ *  It must be initialized using hipsparseCreateIluInfo() and should be destroyed at the end
+ *  using hipsparseDestroyIluInfo().
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct hipsparseIluInfo* hipsparseIluInfo_t;
+#endif
+
 // clang-format off
 
 /*! \ingroup types_module
@@ -455,6 +545,123 @@ typedef enum
 #endif
 #endif
 
+/*! \ingroup types_module
+ *  \brief Performance counters of a hipSPARSE handle.
+ *
+ *  \details
+ *  The \ref hipsparseCounters_t structure holds the totals of the performance counters
+ *  of a handle, as returned by \ref hipsparseGetCounters. All counters are accumulated
+ *  since the handle was created or since the last call to \ref hipsparseResetCounters.
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct {
+    int64_t calls; /**< Number of routine calls */
+    int64_t hostTimeNs; /**< Host time spent in routine calls, in nanoseconds */
+    int64_t deviceTimeNs; /**< Device time of completed routine calls, in nanoseconds, if measured */
+    int64_t workspaceBytes; /**< Bytes of device memory allocated internally */
+    int64_t workspaceAllocations; /**< Number of internal device memory allocations */
+    int64_t synchronizations; /**< Number of forced synchronizations */
+} hipsparseCounters_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief Performance counters of a single routine.
+ *
+ *  \details
+ *  The \ref hipsparseRoutineCounters_t structure holds the performance counters of one
+ *  routine of a handle, as returned by \ref hipsparseGetRoutineCounters.
+ */
+#if(!defined(CUDART_VERSION))
+typedef struct {
+    const char* name; /**< Name of the routine */
+    int64_t calls; /**< Number of calls */
+    int64_t hostTimeNs; /**< Host time spent in the calls, in nanoseconds */
+    int64_t deviceTimeNs; /**< Device time of completed calls, in nanoseconds, if measured */
+} hipsparseRoutineCounters_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief List of hipsparse solver algorithms.
+ *
+ *  \details
+ *  This is a list of the Krylov methods of the \ref hipsparseSolverDescr_t solvers.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum {
+    HIPSPARSE_SOLVER_CG = 0, /**< Conjugate gradient, for Hermitian positive definite matrices */
+    HIPSPARSE_SOLVER_BICGSTAB = 1, /**< Stabilized bi-conjugate gradient */
+    HIPSPARSE_SOLVER_GMRES = 2 /**< Restarted generalized minimal residual */
+} hipsparseSolverAlg_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief List of hipsparse solver preconditioners.
+ *
+ *  \details
+ *  This is a list of the preconditioners of the \ref hipsparseSolverDescr_t solvers.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum {
+    HIPSPARSE_SOLVER_PRECOND_NONE = 0, /**< No preconditioner */
+    HIPSPARSE_SOLVER_PRECOND_JACOBI = 1, /**< Inverse of the diagonal */
+    HIPSPARSE_SOLVER_PRECOND_ILU0 = 2, /**< Incomplete LU factorization with zero fill-in */
+    HIPSPARSE_SOLVER_PRECOND_IC0 = 3 /**< Incomplete Cholesky factorization with zero fill-in */
+} hipsparseSolverPrecond_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief List of hipsparse smoother methods.
+ *
+ *  \details
+ *  This is a list of the relaxation methods of the \ref hipsparseSmootherDescr_t smoothers.
+ *  All methods except the Jacobi method update the rows of one color at a time.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum {
+    HIPSPARSE_SMOOTHER_JACOBI = 0, /**< Weighted Jacobi, all rows are updated at once */
+    HIPSPARSE_SMOOTHER_GAUSS_SEIDEL = 1, /**< Multicolor Gauss-Seidel, colors in ascending order */
+    HIPSPARSE_SMOOTHER_SYMMETRIC_GAUSS_SEIDEL = 2, /**< Multicolor Gauss-Seidel, colors in ascending then descending order */
+    HIPSPARSE_SMOOTHER_SOR = 3 /**< Multicolor successive over-relaxation */
+} hipsparseSmootherAlg_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief List of hipsparse iterative ILU0 algorithms.
+ *
+ *  \details
+ *  This is a list of the fixed-point sweeps of \ref hipsparseScsritilu0 "hipsparseXcsritilu0()"
+ *  and \ref hipsparseScsritic0 "hipsparseXcsritic0()". Synchronous sweeps compute all entries
+ *  of the next iterate from the previous iterate, asynchronous sweeps use updated entries as
+ *  soon as they are available.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum {
+    HIPSPARSE_ITILU0_ALG_DEFAULT = 0, /**< Default algorithm */
+    HIPSPARSE_ITILU0_ALG_ASYNC_INPLACE = 1, /**< Asynchronous sweeps, factors updated in place */
+    HIPSPARSE_ITILU0_ALG_ASYNC_SPLIT = 2, /**< Asynchronous sweeps, L and U stored separately */
+    HIPSPARSE_ITILU0_ALG_SYNC_SPLIT = 3, /**< Synchronous sweeps, L and U stored separately */
+    HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION = 4 /**< Synchronous sweeps, fused with the norm computation */
+} hipsparseItilu0Alg_t;
+#endif
+
+/*! \ingroup types_module
+ *  \brief List of hipsparse iterative ILU0 options.
+ *
+ *  \details
+ *  This is a list of the options of \ref hipsparseScsritilu0 "hipsparseXcsritilu0()" and
+ *  \ref hipsparseScsritic0 "hipsparseXcsritic0()". Options are combined with a bitwise or.
+ */
+#if(!defined(CUDART_VERSION))
+typedef enum {
+    HIPSPARSE_ITILU0_OPTION_VERBOSE = 1, /**< Print the norms of every sweep */
+    HIPSPARSE_ITILU0_OPTION_STOPPING_CRITERIA = 2, /**< Stop once the computed norms are below the tolerance */
+    HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_CORRECTION = 4, /**< Compute the norm of the correction of every sweep */
+    HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_RESIDUAL = 8, /**< Compute the norm of the residual A - LU on the pattern of A */
+    HIPSPARSE_ITILU0_OPTION_CONVERGENCE_HISTORY = 16, /**< Record the norms of every sweep */
+    HIPSPARSE_ITILU0_OPTION_COO_FORMAT = 32 /**< Sweep over the nonzeros in COO format */
+} hipsparseItilu0Option_t;
+#endif
+
 // clang-format on
 
 #endif /* HIPSPARSE_TYPES_H */
@@ -145,9 +145,13 @@
 */
 
 #include "internal/precond/hipsparse_bsric0.h"
+#include "internal/precond/hipsparse_bsrdiag.h"
 #include "internal/precond/hipsparse_bsrilu0.h"
 #include "internal/precond/hipsparse_csric0.h"
 #include "internal/precond/hipsparse_csrilu0.h"
+#include "internal/precond/hipsparse_csriluk.h"
+#include "internal/precond/hipsparse_csrilut.h"
+#include "internal/precond/hipsparse_csritilu0.h"
 #include "internal/precond/hipsparse_gpsv_interleaved_batch.h"
 #include "internal/precond/hipsparse_gtsv.h"
 #include "internal/precond/hipsparse_gtsv_interleaved_batch.h"
@@ -196,6 +200,10 @@
 */
 
 #include "internal/reorder/hipsparse_csrcolor.h"
+#include "internal/reorder/hipsparse_csrrcm.h"
+#include "internal/reorder/hipsparse_csrsymperm.h"
+#include "internal/reorder/hipsparse_csrpermute.h"
+#include "internal/reorder/hipsparse_bsrpermute.h"
 
 /*
 * ===========================================================================
@@ -208,18 +216,34 @@
 #include "hipsparse-generic-auxiliary.h"
 
 #include "internal/generic/hipsparse_axpby.h"
+#include "internal/generic/hipsparse_csr2bell.h"
+#include "internal/generic/hipsparse_csr2dia.h"
+#include "internal/generic/hipsparse_csr2ell.h"
+#include "internal/generic/hipsparse_csr2sell.h"
 #include "internal/generic/hipsparse_dense2sparse.h"
 #include "internal/generic/hipsparse_gather.h"
 #include "internal/generic/hipsparse_rot.h"
 #include "internal/generic/hipsparse_scatter.h"
 #include "internal/generic/hipsparse_sddmm.h"
+#include "internal/generic/hipsparse_semiring.h"
 #include "internal/generic/hipsparse_sparse2dense.h"
 #include "internal/generic/hipsparse_spgemm.h"
 #include "internal/generic/hipsparse_spgemm_reuse.h"
+#include "internal/generic/hipsparse_spmat_convert.h"
 #include "internal/generic/hipsparse_spmm.h"
 #include "internal/generic/hipsparse_spmv.h"
 #include "internal/generic/hipsparse_spsm.h"
 #include "internal/generic/hipsparse_spsv.h"
 #include "internal/generic/hipsparse_spvv.h"
 
+/*
+* ===========================================================================
+*    solvers SPARSE
+* ===========================================================================
+*/
+
+#include "internal/solvers/hipsparse_smoother.h"
+#include "internal/solvers/hipsparse_amg.h"
+#include "internal/solvers/hipsparse_solver.h"
+
 #endif // HIPSPARSE_H
@@ -0,0 +1,126 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSR2BELL_H
+#define HIPSPARSE_CSR2BELL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Block size and width of the Blocked-ELL format of a CSR matrix.
+*
+*  \details
+*  \p hipsparseCsr2BlockedEllNnz is the first step of the conversion of a sparse CSR matrix into
+*  the Blocked-ELL format, see \ref hipsparseCreateBlockedEll. The matrix is tiled into dense
+*  square blocks of \p ellBlockSize rows and columns, every block row stores the same number of
+*  blocks and blocks without entries of \p matCsr are only stored as padding.
+*
+*  If \p ellBlockSize is 0 on entry, the block size is selected among 1, 2, 4, 8, 16 and 32. For
+*  every candidate, the number of stored values and block column indices is computed from the
+*  sparsity pattern of \p matCsr, and the candidate with the smallest Blocked-ELL arrays is
+*  returned. Larger blocks win ties, since they make better use of the dense block products of
+*  \ref HIPSPARSE_SPMM_BLOCKED_ELL_ALG1. Any other positive \p ellBlockSize is kept.
+*
+*  \p ellCols is the number of columns of the Blocked-ELL matrix, i.e. the block size times the
+*  largest number of non-zero blocks in a block row, and \p ellFill is the number of explicit
+*  zeros the Blocked-ELL format stores in addition to the \p nnz entries of \p matCsr. The fill
+*  ratio of the conversion is (\p nnz + \p ellFill) / \p nnz.
+*
+*  After allocating \p ellCols / \p ellBlockSize block column indices for each of the
+*  ceil(\p m / \p ellBlockSize) block rows and \p ellCols times \p ellBlockSize values per block
+*  row, create the Blocked-ELL descriptor with \ref hipsparseCreateBlockedEll and fill it with
+*  \ref hipsparseCsr2BlockedEll.
+*
+*  \note
+*  The block size and width are computed on the host and the routine blocks until they are
+*  known.
+*
+*  @param[in]
+*  handle        handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr        sparse CSR matrix descriptor.
+*  @param[inout]
+*  ellBlockSize  block size of the Blocked-ELL matrix, on the host. 0 selects the block size.
+*  @param[out]
+*  ellCols       number of columns of the Blocked-ELL matrix, on the host.
+*  @param[out]
+*  ellFill       number of padded entries of the Blocked-ELL matrix, on the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr, \p ellBlockSize, \p ellCols or
+*          \p ellFill pointer is invalid or \p ellBlockSize is negative.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2BlockedEllNnz(hipsparseHandle_t          handle,
+                                             hipsparseConstSpMatDescr_t matCsr,
+                                             int64_t*                   ellBlockSize,
+                                             int64_t*                   ellCols,
+                                             int64_t*                   ellFill);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert a sparse CSR matrix into the Blocked-ELL format.
+*
+*  \details
+*  \p hipsparseCsr2BlockedEll fills the block column indices and values of a Blocked-ELL matrix
+*  with the entries of a sparse CSR matrix. The blocks of each block row are sorted by their
+*  block column, each block is stored column by column and block rows with fewer blocks than
+*  \p matBell holds are padded with the block column index -1 and zero blocks. Entries of a
+*  stored block that are not in \p matCsr are zero. The number of columns of \p matBell must be
+*  at least the number computed by \ref hipsparseCsr2BlockedEllNnz for its block size.
+*
+*  \note
+*  The conversion is computed on the host and the routine blocks until \p matBell has been
+*  written. Matrices whose values change with a fixed sparsity pattern can be converted again
+*  on the device with \ref hipsparseSpMatConvert.
+*
+*  @param[in]
+*  handle   handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr   sparse CSR matrix descriptor.
+*  @param[inout]
+*  matBell  sparse Blocked-ELL matrix descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr or \p matBell pointer is invalid,
+*          the sizes of \p matCsr and \p matBell do not match or a block row of \p matCsr has
+*          more non-zero blocks than \p matBell holds.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix, \p matBell is not a
+*          Blocked-ELL matrix or their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2BlockedEll(hipsparseHandle_t          handle,
+                                          hipsparseConstSpMatDescr_t matCsr,
+                                          hipsparseSpMatDescr_t      matBell);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSR2BELL_H */
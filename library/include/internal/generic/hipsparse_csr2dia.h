@@ -0,0 +1,179 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSR2DIA_H
+#define HIPSPARSE_CSR2DIA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Number of diagonals of the DIA format of a CSR matrix.
+*
+*  \details
+*  \p hipsparseCsr2DiaNnz is the first step of the conversion of a sparse CSR matrix into the
+*  DIA format, see \ref hipsparseCreateDia. It computes the number of diagonals that hold at
+*  least one entry of \p matCsr and the fill, i.e. the number of padded values the DIA format
+*  stores in addition to the \p nnz entries of \p matCsr. hipSPARSE has no kernels for the DIA
+*  format, \ref hipsparseSpMV and \ref hipsparseSpMM return \ref HIPSPARSE_STATUS_NOT_SUPPORTED
+*  for DIA matrices. The conversion provides the arrays for user kernels.
+*
+*  After allocating \p diaNumDiagonals offsets and \p diaNumDiagonals times \p m values, create
+*  the DIA descriptor with \ref hipsparseCreateDia and fill it with \ref hipsparseCsr2Dia.
+*
+*  \note
+*  The diagonals are computed on the host and the routine blocks until they are known.
+*
+*  @param[in]
+*  handle           handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr           sparse CSR matrix descriptor.
+*  @param[out]
+*  diaNumDiagonals  number of diagonals of the DIA matrix, on the host.
+*  @param[out]
+*  diaFill          number of padded values of the DIA matrix, on the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr, \p diaNumDiagonals or
+*          \p diaFill pointer is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2DiaNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matCsr,
+                                      int64_t*                   diaNumDiagonals,
+                                      int64_t*                   diaFill);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert a sparse CSR matrix into the DIA format.
+*
+*  \details
+*  \p hipsparseCsr2Dia fills the offsets and values of a DIA matrix with the entries of a sparse
+*  CSR matrix. The offsets are sorted in increasing order, and positions of a diagonal without
+*  an entry of \p matCsr are set to zero. \p matDia must have the number of diagonals computed
+*  by \ref hipsparseCsr2DiaNnz for \p matCsr.
+*
+*  \note
+*  The conversion is computed on the host and the routine blocks until \p matDia has been
+*  written.
+*
+*  @param[in]
+*  handle   handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr   sparse CSR matrix descriptor.
+*  @param[inout]
+*  matDia   sparse DIA matrix descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr or \p matDia pointer is invalid,
+*          the sizes of \p matCsr and \p matDia do not match or \p matDia does not have the
+*          number of diagonals of \p matCsr.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix, \p matDia is not a DIA
+*          matrix or their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2Dia(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matCsr,
+                                   hipsparseSpMatDescr_t      matDia);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Row offsets of the CSR format of a DIA matrix.
+*
+*  \details
+*  \p hipsparseDia2CsrNnz is the first step of the conversion of a DIA matrix into the CSR
+*  format. It computes the row offsets and the number of non-zeros of the CSR matrix. The DIA
+*  format cannot tell explicit zeros apart from the padding, values equal to zero are not
+*  converted.
+*
+*  After allocating \p csrNnz column indices and values, create the CSR descriptor with
+*  \ref hipsparseCreateCsr and fill it with \ref hipsparseDia2Csr.
+*
+*  \note
+*  The row offsets are computed on the host and the routine blocks until they have been written.
+*
+*  @param[in]
+*  handle         handle to the hipsparse library context queue.
+*  @param[in]
+*  matDia         sparse DIA matrix descriptor.
+*  @param[out]
+*  csrRowOffsets  array of \p m+1 row offsets, stored with the index type and the index base of
+*                 \p matDia.
+*  @param[out]
+*  csrNnz         number of non-zeros of the CSR matrix, on the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matDia, \p csrRowOffsets or \p csrNnz
+*          pointer is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matDia is not a DIA matrix.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDia2CsrNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matDia,
+                                      void*                      csrRowOffsets,
+                                      int64_t*                   csrNnz);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert a DIA matrix into the CSR format.
+*
+*  \details
+*  \p hipsparseDia2Csr fills the row offsets, column indices and values of a sparse CSR matrix
+*  with the non-zero values of a DIA matrix. The columns of each row are sorted. \p matCsr must
+*  have the number of non-zeros computed by \ref hipsparseDia2CsrNnz for \p matDia.
+*
+*  \note
+*  The conversion is computed on the host and the routine blocks until \p matCsr has been
+*  written.
+*
+*  @param[in]
+*  handle   handle to the hipsparse library context queue.
+*  @param[in]
+*  matDia   sparse DIA matrix descriptor.
+*  @param[inout]
+*  matCsr   sparse CSR matrix descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matDia or \p matCsr pointer is invalid,
+*          the sizes of \p matDia and \p matCsr do not match or \p matCsr does not have the
+*          number of non-zeros of \p matDia.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matDia is not a DIA matrix, \p matCsr is not a CSR
+*          matrix or their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDia2Csr(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matDia,
+                                   hipsparseSpMatDescr_t      matCsr);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSR2DIA_H */
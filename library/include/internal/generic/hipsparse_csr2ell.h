@@ -0,0 +1,177 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSR2ELL_H
+#define HIPSPARSE_CSR2ELL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Width of the ELL format of a CSR matrix.
+*
+*  \details
+*  \p hipsparseCsr2EllNnz is the first step of the conversion of a sparse CSR matrix into the
+*  ELL format, see \ref hipsparseCreateEll. It computes the width of the ELL matrix, i.e. the
+*  length of the longest row of \p matCsr, and the fill, i.e. the number of padded entries the
+*  ELL format stores in addition to the \p nnz entries of \p matCsr. ELL pays off for matrices
+*  with rows of similar length, where the fill is small.
+*
+*  After allocating \p ellWidth times \p m column indices and values, create the ELL descriptor
+*  with \ref hipsparseCreateEll and fill it with \ref hipsparseCsr2Ell.
+*
+*  \note
+*  The width is computed on the host and the routine blocks until it is known.
+*
+*  @param[in]
+*  handle    handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr    sparse CSR matrix descriptor.
+*  @param[out]
+*  ellWidth  number of entries per row of the ELL matrix, on the host.
+*  @param[out]
+*  ellFill   number of padded entries of the ELL matrix, on the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr, \p ellWidth or \p ellFill
+*          pointer is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2EllNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matCsr,
+                                      int64_t*                   ellWidth,
+                                      int64_t*                   ellFill);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert a sparse CSR matrix into the ELL format.
+*
+*  \details
+*  \p hipsparseCsr2Ell fills the column indices and values of an ELL matrix with the entries of
+*  a sparse CSR matrix. Rows shorter than the width of \p matEll are padded with the column
+*  index -1 and a zero value. The width of \p matEll must be at least the width computed by
+*  \ref hipsparseCsr2EllNnz for \p matCsr.
+*
+*  \note
+*  The conversion is computed on the host and the routine blocks until \p matEll has been
+*  written.
+*
+*  @param[in]
+*  handle   handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr   sparse CSR matrix descriptor.
+*  @param[inout]
+*  matEll   sparse ELL matrix descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr or \p matEll pointer is invalid,
+*          the sizes of \p matCsr and \p matEll do not match or a row of \p matCsr is longer
+*          than the width of \p matEll.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix, \p matEll is not an
+*          ELL matrix or their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2Ell(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matCsr,
+                                   hipsparseSpMatDescr_t      matEll);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Row offsets of the CSR format of an ELL matrix.
+*
+*  \details
+*  \p hipsparseEll2CsrNnz is the first step of the conversion of an ELL matrix into the CSR
+*  format. It computes the row offsets and the number of non-zeros of the CSR matrix, padded
+*  entries are not converted.
+*
+*  After allocating \p csrNnz column indices and values, create the CSR descriptor with
+*  \ref hipsparseCreateCsr and fill it with \ref hipsparseEll2Csr.
+*
+*  \note
+*  The row offsets are computed on the host and the routine blocks until they have been written.
+*
+*  @param[in]
+*  handle         handle to the hipsparse library context queue.
+*  @param[in]
+*  matEll         sparse ELL matrix descriptor.
+*  @param[out]
+*  csrRowOffsets  array of \p m+1 row offsets, stored with the index type and the index base of
+*                 \p matEll.
+*  @param[out]
+*  csrNnz         number of non-zeros of the CSR matrix, on the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matEll, \p csrRowOffsets or \p csrNnz
+*          pointer is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matEll is not an ELL matrix.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseEll2CsrNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matEll,
+                                      void*                      csrRowOffsets,
+                                      int64_t*                   csrNnz);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert an ELL matrix into the CSR format.
+*
+*  \details
+*  \p hipsparseEll2Csr fills the row offsets, column indices and values of a sparse CSR matrix
+*  with the entries of an ELL matrix. The columns of each row are sorted. \p matCsr must have
+*  the number of non-zeros computed by \ref hipsparseEll2CsrNnz for \p matEll.
+*
+*  \note
+*  The conversion is computed on the host and the routine blocks until \p matCsr has been
+*  written.
+*
+*  @param[in]
+*  handle   handle to the hipsparse library context queue.
+*  @param[in]
+*  matEll   sparse ELL matrix descriptor.
+*  @param[inout]
+*  matCsr   sparse CSR matrix descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matEll or \p matCsr pointer is invalid,
+*          the sizes of \p matEll and \p matCsr do not match or \p matCsr does not have the
+*          number of non-zeros of \p matEll.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matEll is not an ELL matrix, \p matCsr is not a CSR
+*          matrix or their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseEll2Csr(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matEll,
+                                   hipsparseSpMatDescr_t      matCsr);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSR2ELL_H */
@@ -0,0 +1,124 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSR2SELL_H
+#define HIPSPARSE_CSR2SELL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Slice structure of the SELL-C-sigma format of a CSR matrix.
+*
+*  \details
+*  \p hipsparseCsr2SellNnz is the first step of the conversion of a sparse CSR matrix into the
+*  SELL-C-sigma format, see \ref hipsparseCreateSell. The rows are sorted by decreasing length
+*  within windows of \p sigma consecutive rows and grouped into slices of \p sliceSize rows.
+*  Each slice is padded to the length of its longest row. \p hipsparseCsr2SellNnz computes the
+*  slice offsets, the row permutation and the number of stored entries including the padding.
+*
+*  Larger windows reduce the padding, at the cost of a less local access to \f$y\f$. With
+*  \p sigma equal to 1 the rows are not permuted and \p sellRowPerm can be null. A \p sliceSize
+*  equal to the wavefront size and a \p sigma of a few slices is a good start.
+*
+*  After allocating \p sellValuesSize column indices and values, create the SELL-C-sigma
+*  descriptor with \ref hipsparseCreateSell and fill it with \ref hipsparseCsr2Sell.
+*
+*  \note
+*  The slice structure is computed on the host and the routine blocks until it has been written.
+*
+*  @param[in]
+*  handle            handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr            sparse CSR matrix descriptor.
+*  @param[in]
+*  sliceSize         number of rows per slice.
+*  @param[in]
+*  sigma             number of rows sorted by length together.
+*  @param[out]
+*  sellSliceOffsets  array of <tt>ceil(m / sliceSize) + 1</tt> slice offsets, stored with the
+*                    column index type of \p matCsr.
+*  @param[out]
+*  sellRowPerm       array of \p m row indices, stored with the column index type and the index
+*                    base of \p matCsr. Can be null if \p sigma is 1.
+*  @param[out]
+*  sellValuesSize    number of entries of the SELL-C-sigma matrix, including the padding, on
+*                    the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr, \p sellSliceOffsets,
+*          \p sellRowPerm or \p sellValuesSize pointer is invalid, or \p sliceSize or \p sigma is
+*          not positive.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2SellNnz(hipsparseHandle_t          handle,
+                                       hipsparseConstSpMatDescr_t matCsr,
+                                       int64_t                    sliceSize,
+                                       int64_t                    sigma,
+                                       void*                      sellSliceOffsets,
+                                       void*                      sellRowPerm,
+                                       int64_t*                   sellValuesSize);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert a sparse CSR matrix into the SELL-C-sigma format.
+*
+*  \details
+*  \p hipsparseCsr2Sell fills the column indices and values of a SELL-C-sigma matrix with the
+*  entries of a sparse CSR matrix. The slice size, the slice offsets and the row permutation of
+*  \p matSell must have been computed by \ref hipsparseCsr2SellNnz for \p matCsr, and \p matSell
+*  must use the column index type and the index base of \p matCsr.
+*
+*  \note
+*  The conversion is computed on the host and the routine blocks until \p matSell has been
+*  written.
+*
+*  @param[in]
+*  handle   handle to the hipsparse library context queue.
+*  @param[in]
+*  matCsr   sparse CSR matrix descriptor.
+*  @param[inout]
+*  matSell  sparse SELL-C-sigma matrix descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matCsr or \p matSell pointer is invalid,
+*          the sizes, index types or index bases of \p matCsr and \p matSell do not match or
+*          the slice structure of \p matSell does not hold the rows of \p matCsr.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matCsr is not a CSR matrix, \p matSell is not a
+*          SELL-C-sigma matrix or their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCsr2Sell(hipsparseHandle_t          handle,
+                                    hipsparseConstSpMatDescr_t matCsr,
+                                    hipsparseSpMatDescr_t      matSell);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSR2SELL_H */
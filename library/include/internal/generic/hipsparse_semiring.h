@@ -0,0 +1,119 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_SEMIRING_H
+#define HIPSPARSE_SEMIRING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Identity of the semiring addition.
+*
+*  \details
+*  \p hipsparseSemiringGetIdentity returns the identity of the addition \f$\oplus\f$ of a semiring, i.e. the
+*  value of the entries that are not stored in a sparse matrix. It is the value a dense vector has to be
+*  initialized with, such that \ref hipsparseSpMVSemiring computes \f$op(A) \otimes x\f$ only, e.g.
+*  \f$+\infty\f$ for the distances of a shortest path search.
+*
+*  @param[in]
+*  semiring     semiring, see \ref hipsparseSemiring_t.
+*  @param[in]
+*  valueType    data type of the identity.
+*  @param[out]
+*  identity     identity of \f$\oplus\f$ stored as \p valueType on the host.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p semiring is invalid or \p identity pointer is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p valueType is not supported by \p semiring.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSemiringGetIdentity(hipsparseSemiring_t semiring,
+                                               hipDataType         valueType,
+                                               void*               identity);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix dense vector multiplication over a semiring:
+*  \f[
+*    y_i := y_i \oplus \bigoplus_j op(A)_{ij} \otimes x_j,
+*  \f]
+*  where \f$op(A)\f$ is a sparse \f$m \times n\f$ matrix in CSR, CSC or COO format, \f$x\f$ is a dense vector of
+*  length \f$n\f$ and \f$y\f$ is a dense vector of length \f$m\f$.
+*
+*  \details
+*  \p hipsparseSpMVSemiring replaces the addition and the multiplication of the matrix vector product by the
+*  operations of \p semiring. Only stored entries of \f$A\f$ take part in the product. The previous values of
+*  \f$y\f$ are always accumulated. Initialize \f$y\f$ with the identity returned by
+*  \ref hipsparseSemiringGetIdentity to compute \f$op(A) \otimes x\f$ only.
+*
+*  For \ref HIPSPARSE_SEMIRING_PLUS_TIMES the result is the same as \ref hipsparseSpMV with
+*  \f$\alpha = \beta = 1\f$.
+*
+*  \note
+*  rocSPARSE hard-codes the arithmetic operations in its kernels. \ref HIPSPARSE_SEMIRING_PLUS_TIMES is
+*  computed by rocsparse_spmv on the device, the other semirings return
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+*
+*  \note
+*  Only real value types are supported. The value types of \f$A\f$, \f$x\f$ and \f$y\f$ must be \p computeType.
+*
+*  @param[in]
+*  handle       handle to the hipsparse library context queue.
+*  @param[in]
+*  opA          matrix operation type.
+*  @param[in]
+*  semiring     semiring of the product, see \ref hipsparseSemiring_t.
+*  @param[in]
+*  matA         matrix descriptor.
+*  @param[in]
+*  vecX         vector descriptor.
+*  @param[inout]
+*  vecY         vector descriptor.
+*  @param[in]
+*  computeType  floating point precision for the product.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matA, \p vecX or \p vecY pointer is invalid, \p semiring
+*          is invalid or the sizes of \p matA, \p vecX and \p vecY do not match.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p semiring, the format of \p matA, \p computeType or the value types
+*          of \p matA, \p vecX and \p vecY are not supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVSemiring(hipsparseHandle_t          handle,
+                                        hipsparseOperation_t       opA,
+                                        hipsparseSemiring_t        semiring,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        hipsparseConstDnVecDescr_t vecX,
+                                        hipsparseDnVecDescr_t      vecY,
+                                        hipDataType                computeType);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_SEMIRING_H */
@@ -48,6 +48,83 @@ HIPSPARSE_EXPORT
 hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Set the output mask of the sparse matrix sparse matrix product:
+*  \f[
+*    C' := \alpha \cdot M \circ (op(A) \cdot op(B)) + \beta \cdot C,
+*  \f]
+*  where \f$M\f$ is a sparse matrix and \f$\circ\f$ restricts the product to the sparsity pattern of \f$M\f$.
+*
+*  \details
+*  \p hipsparseSpGEMM_setMask attaches the sparse matrix \f$M\f$ to the SpGEMM descriptor. The following calls to
+*  \ref hipsparseSpGEMM_workEstimation, \ref hipsparseSpGEMM_compute and \ref hipsparseSpGEMM_copy only store the
+*  entries \f$(i, j)\f$ of the product that are stored in \f$M\f$, such that the sparsity pattern of \f$C\f$ is a
+*  subset of the sparsity pattern of \f$M\f$. Entries of \f$M\f$ that no product contributes to are not stored in
+*  \f$C\f$. Only the sparsity pattern of \f$M\f$ is used, its values are ignored.
+*
+*  Passing \p nullptr for \p matM removes the mask. The mask must remain valid until \ref hipsparseSpGEMM_copy has
+*  been called.
+*
+*  \note
+*  The masked product requires \ref HIPSPARSE_OPERATION_NON_TRANSPOSE for \f$A\f$ and \f$B\f$, matrices \f$A\f$,
+*  \f$B\f$, \f$C\f$ and \f$M\f$ in \ref HIPSPARSE_FORMAT_CSR format and \f$A\f$, \f$B\f$ and \f$C\f$ with the
+*  value type \p computeType.
+*
+*  \note
+*  \ref hipsparseSpGEMM_workEstimation computes the sparsity pattern of \f$C\f$ on the host, together with the
+*  positions of its entries in the full product \f$\alpha A B\f$. \ref hipsparseSpGEMM_compute forms the full
+*  product on the device with rocsparse_spgemm in \p externalBuffer2 and gathers the entries of \f$C\f$ from it, so
+*  \p externalBuffer2 also holds the full product.
+*
+*  \note
+*  The mask is not supported by the hipsparseSpGEMMreuse functions.
+*
+*  @param[inout]
+*  spgemmDescr      SpGEMM descriptor.
+*  @param[in]
+*  matM             sparse matrix \f$M\f$ with the dimensions of \f$C\f$, or \p nullptr.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p spgemmDescr is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_setMask(hipsparseSpGEMMDescr_t     spgemmDescr,
+                                          hipsparseConstSpMatDescr_t matM);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Set the semiring of the sparse matrix sparse matrix product:
+*  \f[
+*    C'_{ij} := \bigoplus_k op(A)_{ik} \otimes op(B)_{kj},
+*  \f]
+*  where \f$\oplus\f$ and \f$\otimes\f$ are the addition and multiplication of the semiring.
+*
+*  \details
+*  \p hipsparseSpGEMM_setSemiring selects the semiring used by the following calls to
+*  \ref hipsparseSpGEMM_workEstimation, \ref hipsparseSpGEMM_compute and \ref hipsparseSpGEMM_copy. The sparsity
+*  pattern of \f$C\f$ is the same for all semirings, i.e. \f$(i, j)\f$ is stored if at least one product
+*  \f$A_{ik} B_{kj}\f$ exists. The default is \ref HIPSPARSE_SEMIRING_PLUS_TIMES.
+*
+*  \note
+*  rocsparse_spgemm only computes the arithmetic product, semirings other than
+*  \ref HIPSPARSE_SEMIRING_PLUS_TIMES return \ref HIPSPARSE_STATUS_NOT_SUPPORTED.
+*
+*  @param[inout]
+*  spgemmDescr      SpGEMM descriptor.
+*  @param[in]
+*  semiring         semiring of the product, see \ref hipsparseSemiring_t.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p spgemmDescr or \p semiring is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p semiring is not \ref HIPSPARSE_SEMIRING_PLUS_TIMES.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpGEMM_setSemiring(hipsparseSpGEMMDescr_t spgemmDescr,
+                                              hipsparseSemiring_t    semiring);
+#endif
+
 /*! \ingroup generic_module
 *  \brief Work estimation step of the sparse matrix sparse matrix product:
 *  \f[
@@ -0,0 +1,193 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_SPMAT_CONVERT_H
+#define HIPSPARSE_SPMAT_CONVERT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup generic_module
+*  \brief Create a sparse matrix conversion descriptor
+*  \details
+*  \p hipsparseSpMatConvert_createDescr creates the descriptor that holds the analysis of a
+*  conversion between two sparse matrix formats, see \ref hipsparseSpMatConvert_analysis. It
+*  should be destroyed at the end using \ref hipsparseSpMatConvert_destroyDescr.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatConvert_createDescr(hipsparseSpMatConvertDescr_t* descr);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Destroy a sparse matrix conversion descriptor
+*  \details
+*  \p hipsparseSpMatConvert_destroyDescr destroys a sparse matrix conversion descriptor and
+*  releases all resources used by the descriptor.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatConvert_destroyDescr(hipsparseSpMatConvertDescr_t descr);
+#endif
+
+/*! \ingroup generic_module
+*  \details
+*  \p hipsparseSpMatConvert_bufferSize computes the size of the user allocated buffer needed by
+*  \ref hipsparseSpMatConvert_analysis and \ref hipsparseSpMatConvert to convert the sparse
+*  matrix \p matA into the format of the sparse matrix \p matB. Both matrices can be in CSR,
+*  CSC, COO, COO_AOS or BLOCKED_ELL format, including the same format. They must have the same
+*  dimensions and value type.
+*
+*  @param[in]
+*  handle              handle to the hipsparse library context queue.
+*  @param[in]
+*  matA                source sparse matrix descriptor.
+*  @param[in]
+*  matB                target sparse matrix descriptor.
+*  @param[in]
+*  alg                 algorithm for the conversion.
+*  @param[in]
+*  descr               sparse matrix conversion descriptor.
+*  @param[out]
+*  pBufferSizeInBytes  number of bytes of the temporary storage buffer.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matA, \p matB, \p descr or
+*          \p pBufferSizeInBytes pointer is invalid or the dimensions of \p matA and \p matB
+*          differ.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the format of \p matA or \p matB is not supported or
+*          their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatConvert_bufferSize(hipsparseHandle_t            handle,
+                                                   hipsparseConstSpMatDescr_t   matA,
+                                                   hipsparseConstSpMatDescr_t   matB,
+                                                   hipsparseSpMatConvertAlg_t   alg,
+                                                   hipsparseSpMatConvertDescr_t descr,
+                                                   size_t*                      pBufferSizeInBytes);
+#endif
+
+/*! \ingroup generic_module
+*  \details
+*  \p hipsparseSpMatConvert_analysis computes the sparsity pattern of \p matB from the pattern
+*  of \p matA and stores it in \p descr, together with the position of every value of \p matA
+*  in the values of \p matB. Only the format, dimensions, index types, index base, value type
+*  and, for BLOCKED_ELL, the block size of \p matB are used, its arrays are not accessed.
+*
+*  \p pNnzB returns the size of \p matB. For CSR, CSC, COO and COO_AOS it is the number of
+*  non-zero entries of \p matB, which equals the number of entries of \p matA, except for a
+*  BLOCKED_ELL matrix \p matA, where all entries of the stored blocks are converted. For
+*  BLOCKED_ELL it is the number of columns \p ellCols of the Blocked-ELL structure, rows of
+*  blocks with fewer blocks are padded with the block column index -1 and zero values.
+*  \p matB can be created with a size of zero for the analysis. Afterwards, allocate its
+*  arrays for the size \p pNnzB and create \p matB again with the same format, dimensions
+*  and types.
+*
+*  The buffer must stay allocated and unchanged for all following calls of
+*  \ref hipsparseSpMatConvert with \p descr.
+*
+*  \note
+*  The pattern of \p matB is computed on the host and the routine blocks until it is known.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  matA            source sparse matrix descriptor.
+*  @param[in]
+*  matB            target sparse matrix descriptor.
+*  @param[in]
+*  alg             algorithm for the conversion.
+*  @param[inout]
+*  descr           sparse matrix conversion descriptor.
+*  @param[out]
+*  pNnzB           size of \p matB, on the host.
+*  @param[in]
+*  externalBuffer  temporary storage buffer allocated by the user.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matA, \p matB, \p descr, \p pNnzB or
+*          \p externalBuffer pointer is invalid, the dimensions of \p matA and \p matB differ or
+*          an index of \p matA is out of range.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the format of \p matA or \p matB is not supported or
+*          their value types differ.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatConvert_analysis(hipsparseHandle_t            handle,
+                                                 hipsparseConstSpMatDescr_t   matA,
+                                                 hipsparseConstSpMatDescr_t   matB,
+                                                 hipsparseSpMatConvertAlg_t   alg,
+                                                 hipsparseSpMatConvertDescr_t descr,
+                                                 int64_t*                     pNnzB,
+                                                 void*                        externalBuffer);
+#endif
+
+/*! \ingroup generic_module
+*  \brief Convert a sparse matrix into another sparse matrix format.
+*
+*  \details
+*  \p hipsparseSpMatConvert writes the indices and values of \p matB, using the analysis of
+*  \ref hipsparseSpMatConvert_analysis. The indices of \p matB are only written when its index
+*  arrays differ from the previous call with \p descr. The values of \p matB are moved with a
+*  single gather or scatter on the device.
+*
+*  When only the values of \p matA change, call \p hipsparseSpMatConvert again without a new
+*  analysis to convert the new values. \p matA must keep the sparsity pattern it had during the
+*  analysis.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  matA            source sparse matrix descriptor.
+*  @param[inout]
+*  matB            target sparse matrix descriptor.
+*  @param[in]
+*  alg             algorithm for the conversion.
+*  @param[in]
+*  descr           sparse matrix conversion descriptor.
+*  @param[in]
+*  externalBuffer  temporary storage buffer passed to \ref hipsparseSpMatConvert_analysis.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p matA, \p matB, \p descr or
+*          \p externalBuffer pointer is invalid, or \p matA, \p matB or \p externalBuffer do
+*          not match the analysis.
+*  \retval HIPSPARSE_STATUS_NOT_INITIALIZED \p descr has not been analysed.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMatConvert(hipsparseHandle_t            handle,
+                                        hipsparseConstSpMatDescr_t   matA,
+                                        hipsparseSpMatDescr_t        matB,
+                                        hipsparseSpMatConvertAlg_t   alg,
+                                        hipsparseSpMatConvertDescr_t descr,
+                                        void*                        externalBuffer);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_SPMAT_CONVERT_H */
@@ -66,7 +66,7 @@ extern "C" {
 *  \retval      HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p alpha, \p matA, \p x, \p beta, \p y or
 *               \p pBufferSizeInBytes pointer is invalid or if \p opA, \p computeType, \p alg is incorrect.
 *  \retval      HIPSPARSE_STATUS_NOT_SUPPORTED \p computeType or \p alg is
-*               currently not supported.
+*               currently not supported, or \p matA is a SELL-C-sigma or DIA matrix.
 */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
 HIPSPARSE_EXPORT
@@ -133,7 +133,7 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
 *  \retval      HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p alpha, \p matA, \p x, \p beta, \p y or
 *               \p externalBuffer pointer is invalid or if \p opA, \p computeType, \p alg is incorrect.
 *  \retval      HIPSPARSE_STATUS_NOT_SUPPORTED \p computeType or \p alg is
-*               currently not supported.
+*               currently not supported, or \p matA is a SELL-C-sigma or DIA matrix.
 */
 #if(!defined(CUDART_VERSION) || CUDART_VERSION >= 12000)
 HIPSPARSE_EXPORT
@@ -207,6 +207,27 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
 *  <tr><td>HIPSPARSE_SPMV_COO_ALG2</td>
 *  </table>
 *
+*  For CSR matrices, \ref HIPSPARSE_SPMV_ALG_DEFAULT chooses the algorithm from the row length statistics of \f$A\f$
+*  (mean, maximum, coefficient of variation and number of empty rows). The statistics are computed once for the
+*  sparsity pattern of the matrix descriptor, which requires a blocking copy of the row pointer array to the host
+*  during the first call. Uniform rows use the stream algorithm, irregular rows the adaptive or the row binning
+*  algorithm, and matrices with mostly empty or extremely long rows the COO algorithm. Transposed products and
+*  symmetric matrices use the adaptive algorithm instead of row binning. The COO algorithm stores the expanded row
+*  indices in \p externalBuffer, it is only chosen if the buffer size was queried with \ref hipsparseSpMV_bufferSize.
+*  If the stream is being captured into a graph during the first call, the rocSPARSE default algorithm is used. The
+*  algorithm can be pinned by setting the environment variable \p HIPSPARSE_SPMV_DEFAULT_ALG to \p stream,
+*  \p adaptive, \p lrb or \p coo. Setting it to \p default uses the rocSPARSE default algorithm and avoids the copy of
+*  the row pointer array.
+*
+*  \p hipsparseSpMV computes a whole batch of products in one call if \f$A\f$ is a strided batch of CSR or COO
+*  matrices (see \ref hipsparseCsrSetStridedBatch and \ref hipsparseCooSetStridedBatch) or \f$x\f$ and \f$y\f$ are
+*  strided batches of dense vectors (see \ref hipsparseDnVecSetStridedBatch). The batch count of \f$y\f$ is the
+*  number of products, the batch counts of \f$A\f$ and \f$x\f$ must either be 1 or equal to it, such that
+*  \f$y_i = \alpha \cdot op(A) \cdot x_i + \beta \cdot y_i\f$, \f$y_i = \alpha \cdot op(A_i) \cdot x + \beta \cdot y_i\f$ or
+*  \f$y_i = \alpha \cdot op(A_i) \cdot x_i + \beta \cdot y_i\f$. The \p alg parameter is ignored for batches.
+*  Batches need an \p externalBuffer of the size returned by \ref hipsparseSpMV_bufferSize as well, the preprocessing
+*  is repeated if a different buffer is passed.
+*
 *  \p hipsparseSpMV supports multiple combinations of data types and compute types. The tables below indicate the currently
 *  supported data types that can be used for the sparse matrix \f$op(A)\f$ and the dense vectors \f$x\f$ and \f$y\f$ and the 
 *  compute type for \f$\alpha\f$ and \f$\beta\f$. The advantage of using different data types is to save on memory bandwidth 
@@ -290,7 +311,7 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
 *  \retval      HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p alpha, \p matA, \p x, \p beta, \p y or
 *               \p externalBuffer pointer is invalid or if \p opA, \p computeType, \p alg is incorrect.
 *  \retval      HIPSPARSE_STATUS_NOT_SUPPORTED \p computeType or \p alg is
-*               currently not supported.
+*               currently not supported, or \p matA is a SELL-C-sigma or DIA matrix.
 *
 *  \par Example
 *  \code{.c}
@@ -429,6 +450,88 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 void*                       externalBuffer);
 #endif
 
+/*! \ingroup generic_module
+*  \brief Compute the sparse matrix vector multiplication, then a dot product with the result
+*
+*  \details
+*  \p hipsparseSpMVDot computes the sparse matrix vector product of \f$op(A)\f$ with \f$x\f$
+*  and then the dot product of \f$z\f$ with the updated \f$y\f$, such that
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y, \quad
+*    \text{result} := \bar{z}^T \cdot y.
+*  \f]
+*  If \p vecZ is \p NULL, \f$z = x\f$ is used, which requires \f$op(A)\f$ to be square. For real
+*  data types, the conjugation has no effect.
+*
+*  Krylov solvers such as CG compute \f$q = A p\f$ followed by \f$p^H q\f$ in every iteration.
+*  \p hipsparseSpMVDot is a convenience wrapper for this pattern, reusing the SpMV plan of
+*  \p matA. The operations are not fused: \ref hipsparseSpMV runs first, then the dense dot
+*  product is computed by rocsparse_sddmm as the product of \f$z^H\f$ and \f$y\f$ on the handle
+*  stream. The small temporary storage of the dot product is allocated once per plan and grows
+*  with the rocsparse_sddmm buffer.
+*
+*  \p hipsparseSpMVDot takes the same \p computeType, \p alg and \p externalBuffer as
+*  \ref hipsparseSpMV, i.e. the buffer size is queried with \ref hipsparseSpMV_bufferSize and
+*  the analysis can be performed ahead of time with \ref hipsparseSpMV_preprocess. \p result
+*  is of type \p computeType. It is stored in host memory if the pointer mode is
+*  \ref HIPSPARSE_POINTER_MODE_HOST and stays in device memory if the pointer mode is
+*  \ref HIPSPARSE_POINTER_MODE_DEVICE, such that no synchronization is required in the latter
+*  case.
+*
+*  \note
+*  Strided batches of matrices and vectors are not supported.
+*
+*  \note
+*  This function is not available with the cuSPARSE backend.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  opA             matrix operation type.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  matA            matrix descriptor.
+*  @param[in]
+*  vecX            vector descriptor.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[inout]
+*  vecY            vector descriptor.
+*  @param[in]
+*  vecZ            vector descriptor of \f$z\f$, or \p NULL to use \f$x\f$.
+*  @param[out]
+*  result          pointer to the dot product, can be host or device memory.
+*  @param[in]
+*  computeType     floating point precision for the SpMV and dot product computation.
+*  @param[in]
+*  alg             SpMV algorithm for the SpMV computation.
+*  @param[in]
+*  externalBuffer  temporary storage buffer allocated by the user.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p alpha, \p matA, \p vecX, \p beta,
+*          \p vecY or \p result pointer is invalid, or the size of \f$z\f$ does not match
+*          the size of \f$y\f$.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p opA, \p computeType or \p alg is currently not
+*          supported, or the matrix or one of the vectors is a strided batch.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSpMVDot(hipsparseHandle_t          handle,
+                                   hipsparseOperation_t       opA,
+                                   const void*                alpha,
+                                   hipsparseConstSpMatDescr_t matA,
+                                   hipsparseConstDnVecDescr_t vecX,
+                                   const void*                beta,
+                                   hipsparseDnVecDescr_t      vecY,
+                                   hipsparseConstDnVecDescr_t vecZ,
+                                   void*                      result,
+                                   hipDataType                computeType,
+                                   hipsparseSpMVAlg_t         alg,
+                                   void*                      externalBuffer);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,341 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_BSRDIAG_H
+#define HIPSPARSE_BSRDIAG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup precond_module
+*  \brief Extract the diagonal blocks of a sparse BSR matrix.
+*
+*  \details
+*  \p hipsparseXbsrdiag copies the \p mb diagonal blocks of the sparse BSR matrix \f$A\f$ into
+*  the dense batch \p blockDiag, such that block \f$i\f$ starts at
+*  \p blockDiag[i*blockDim*blockDim]. Every block keeps the storage layout of \f$A\f$ given by
+*  \p dirA. Block rows without a diagonal block yield a zero block.
+*
+*  Together with \ref hipsparseSbsrdiaginv "hipsparseXbsrdiaginv()" and
+*  \ref hipsparseSbsrdiagmv "hipsparseXbsrdiagmv()", this forms the block-Jacobi
+*  preconditioner
+*  \f[
+*    y := \alpha \cdot D^{-1} x + \beta \cdot y, \quad D = \text{blockdiag}(A).
+*  \f]
+*  Only its application runs entirely on the device. The setup depends on the host, which
+*  locates the diagonal blocks and inverts them.
+*
+*  \note
+*  The positions of the diagonal blocks are determined on the host, the values are gathered
+*  on the device. This function is blocking with respect to the host.
+*
+*  \note
+*  The gather uses 32 bit indices, such that \p nnzb*blockDim*blockDim and
+*  \p mb*blockDim*blockDim have to fit into an \p int.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  @param[in]
+*  handle           handle to the hipsparse library context queue.
+*  @param[in]
+*  dirA             storage layout of the blocks, \ref HIPSPARSE_DIRECTION_ROW or
+*                   \ref HIPSPARSE_DIRECTION_COLUMN.
+*  @param[in]
+*  mb               number of block rows and block columns of the sparse BSR matrix.
+*  @param[in]
+*  nnzb             number of non-zero block entries of the sparse BSR matrix.
+*  @param[in]
+*  descrA           descriptor of the sparse BSR matrix.
+*  @param[in]
+*  bsrValA          array of length \p nnzb*blockDim*blockDim containing the values of the
+*                   sparse BSR matrix.
+*  @param[in]
+*  bsrRowPtrA       array of \p mb+1 elements that point to the start of every block row of
+*                   the sparse BSR matrix.
+*  @param[in]
+*  bsrColIndA       array of \p nnzb elements containing the block column indices of the
+*                   sparse BSR matrix.
+*  @param[in]
+*  blockDim         the block dimension of the BSR matrix.
+*  @param[out]
+*  blockDiag        array of length \p mb*blockDim*blockDim holding the diagonal blocks.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p mb, \p nnzb, \p blockDim,
+*          \p descrA, \p bsrValA, \p bsrRowPtrA, \p bsrColIndA or \p blockDiag pointer is
+*          invalid, or the block column indices are out of range.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL, the number of
+*          block entries exceeds the 32 bit index range or the handle stream is being captured.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    float*                    blockDiag);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    double*                   blockDiag);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    hipComplex*               blockDiag);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    hipDoubleComplex*         blockDiag);
+#endif
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Invert a batch of small dense blocks on the host.
+*
+*  \details
+*  \p hipsparseXbsrdiaginv replaces each of the \p mb dense \p blockDim \f$\times\f$
+*  \p blockDim blocks of \p blockDiag by its inverse, computed by Gauss-Jordan elimination
+*  with partial pivoting. Since the inverse of the transpose is the transpose of the inverse,
+*  the result does not depend on whether the blocks are stored by rows or by columns.
+*
+*  If a block is singular, it is left unchanged, the index of the first singular block is
+*  stored in \p position and \ref HIPSPARSE_STATUS_ZERO_PIVOT is returned. All other blocks
+*  are inverted. Otherwise, \p position is set to -1.
+*
+*  \note
+*  There is no device implementation. The blocks are copied to the host, inverted one after
+*  another and copied back. This function is blocking with respect to the host and its cost
+*  grows with \p mb*blockDim^3 on a single host thread.
+*
+*  @param[in]
+*  handle           handle to the hipsparse library context queue.
+*  @param[in]
+*  mb               number of blocks.
+*  @param[in]
+*  blockDim         the dimension of the blocks.
+*  @param[inout]
+*  blockDiag        array of length \p mb*blockDim*blockDim holding the blocks, which are
+*                   overwritten by their inverses.
+*  @param[out]
+*  position         zero based index of the first singular block or -1, in host memory.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p mb, \p blockDim, \p blockDiag or
+*          \p position pointer is invalid.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT a block is singular.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the handle stream is being captured.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       float*            blockDiag,
+                                       int*              position);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       double*           blockDiag,
+                                       int*              position);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       hipComplex*       blockDiag,
+                                       int*              position);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       hipDoubleComplex* blockDiag,
+                                       int*              position);
+#endif
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Buffer size of the block diagonal matrix vector multiplication.
+*
+*  \details
+*  \p hipsparseXbsrdiagmv_bufferSize returns the size of the temporary storage buffer that
+*  is required by \ref hipsparseSbsrdiagmv "hipsparseXbsrdiagmv()".
+*
+*  @param[in]
+*  handle           handle to the hipsparse library context queue.
+*  @param[in]
+*  mb               number of blocks.
+*  @param[out]
+*  pBufferSizeInBytes number of bytes of the temporary storage buffer.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p mb or \p pBufferSizeInBytes pointer
+*          is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXbsrdiagmv_bufferSize(hipsparseHandle_t handle,
+                                                 int               mb,
+                                                 size_t*           pBufferSizeInBytes);
+#endif
+
+/*! \ingroup precond_module
+*  \brief Block diagonal matrix vector multiplication.
+*
+*  \details
+*  \p hipsparseXbsrdiagmv multiplies the scalar \f$\alpha\f$ with the block diagonal matrix
+*  \f$B = \text{blockdiag}(B_0, \ldots, B_{mb-1})\f$ and the dense vector \f$x\f$ and adds the
+*  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    y := \alpha \cdot B x + \beta \cdot y.
+*  \f]
+*  With the inverted diagonal blocks of \ref hipsparseSbsrdiaginv "hipsparseXbsrdiaginv()",
+*  this applies the block-Jacobi preconditioner. The blocks are multiplied as a block
+*  diagonal BSR matrix by \ref hipsparseSbsrmv "hipsparseXbsrmv()".
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host. It
+*  does not allocate memory and can be captured into a graph.
+*
+*  @param[in]
+*  handle           handle to the hipsparse library context queue.
+*  @param[in]
+*  dirA             storage layout of the blocks, \ref HIPSPARSE_DIRECTION_ROW or
+*                   \ref HIPSPARSE_DIRECTION_COLUMN.
+*  @param[in]
+*  mb               number of blocks.
+*  @param[in]
+*  blockDim         the dimension of the blocks.
+*  @param[in]
+*  alpha            scalar \f$\alpha\f$.
+*  @param[in]
+*  blockDiag        array of length \p mb*blockDim*blockDim holding the blocks.
+*  @param[in]
+*  x                array of \p mb*blockDim elements (\f$x\f$).
+*  @param[in]
+*  beta             scalar \f$\beta\f$.
+*  @param[inout]
+*  y                array of \p mb*blockDim elements (\f$y\f$).
+*  @param[in]
+*  pBuffer          temporary storage buffer allocated by the user, the size is returned by
+*                   hipsparseXbsrdiagmv_bufferSize().
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p mb, \p blockDim, \p alpha,
+*          \p blockDiag, \p x, \p beta, \p y or \p pBuffer pointer is invalid.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSbsrdiagmv(hipsparseHandle_t    handle,
+                                      hipsparseDirection_t dirA,
+                                      int                  mb,
+                                      int                  blockDim,
+                                      const float*         alpha,
+                                      const float*         blockDiag,
+                                      const float*         x,
+                                      const float*         beta,
+                                      float*               y,
+                                      void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDbsrdiagmv(hipsparseHandle_t    handle,
+                                      hipsparseDirection_t dirA,
+                                      int                  mb,
+                                      int                  blockDim,
+                                      const double*        alpha,
+                                      const double*        blockDiag,
+                                      const double*        x,
+                                      const double*        beta,
+                                      double*              y,
+                                      void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCbsrdiagmv(hipsparseHandle_t    handle,
+                                      hipsparseDirection_t dirA,
+                                      int                  mb,
+                                      int                  blockDim,
+                                      const hipComplex*    alpha,
+                                      const hipComplex*    blockDiag,
+                                      const hipComplex*    x,
+                                      const hipComplex*    beta,
+                                      hipComplex*          y,
+                                      void*                pBuffer);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZbsrdiagmv(hipsparseHandle_t       handle,
+                                      hipsparseDirection_t    dirA,
+                                      int                     mb,
+                                      int                     blockDim,
+                                      const hipDoubleComplex* alpha,
+                                      const hipDoubleComplex* blockDiag,
+                                      const hipDoubleComplex* x,
+                                      const hipDoubleComplex* beta,
+                                      hipDoubleComplex*       y,
+                                      void*                   pBuffer);
+#endif
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_BSRDIAG_H */
@@ -0,0 +1,249 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSRILUK_H
+#define HIPSPARSE_CSRILUK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup precond_module
+*  \brief Symbolic phase of the incomplete LU factorization with level of fill ILU(k).
+*
+*  \details
+*  \p hipsparseXcsriluk_analysis computes the sparsity patterns of the factors of the
+*  incomplete LU factorization
+*  \f[
+*    A \approx L U
+*  \f]
+*  of the sparse \f$m \times m\f$ CSR matrix \f$A\f$, where fill-in is admitted up to level
+*  \p level. Entries of \f$A\f$ have level 0, an entry created by eliminating \f$A_{ik}\f$ has
+*  level \f$\text{lev}(i, k) + \text{lev}(k, j) + 1\f$. ILU(0) has the pattern of \f$A\f$ and a
+*  sufficiently large level computes the complete LU factorization.
+*
+*  \f$L\f$ is unit lower triangular, only its strictly lower part is stored. \f$U\f$ is upper
+*  triangular including the diagonal. Both are sorted CSR matrices that can be passed to
+*  hipsparseSpSV_analysis() and hipsparseSpSV_solve() directly, with
+*  \ref HIPSPARSE_SPMAT_FILL_MODE set to \ref HIPSPARSE_FILL_MODE_LOWER and
+*  \ref HIPSPARSE_SPMAT_DIAG_TYPE set to \ref HIPSPARSE_DIAG_TYPE_UNIT for \f$L\f$, and
+*  \ref HIPSPARSE_SPMAT_FILL_MODE set to \ref HIPSPARSE_FILL_MODE_UPPER for \f$U\f$.
+*
+*  The row pointers of \f$L\f$ and \f$U\f$ and their number of non-zero entries are returned,
+*  such that the user can allocate the column indices and values. The fill pattern and the
+*  position of every entry of \f$A\f$, \f$L\f$ and \f$U\f$ in it are stored in \p info. The
+*  factors are computed by \ref hipsparseScsriluk "hipsparseXcsriluk()", which can be called
+*  as often as the values of \f$A\f$ change without repeating this analysis.
+*
+*  \note
+*  The sparsity pattern is computed on the host. This function is blocking with respect to the
+*  host.
+*
+*  \note
+*  The columns of \f$A\f$ have to be sorted. The diagonal is always part of the pattern,
+*  missing diagonal entries of \f$A\f$ are treated as explicit zeros.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnzA            number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrColIndA      array of \p nnzA elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  level           maximum level of fill.
+*  @param[in]
+*  descrL          descriptor of the sparse CSR matrix \f$L\f$.
+*  @param[out]
+*  csrRowPtrL      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$L\f$.
+*  @param[out]
+*  nnzL            number of non-zero entries of \f$L\f$, in host memory.
+*  @param[in]
+*  descrU          descriptor of the sparse CSR matrix \f$U\f$.
+*  @param[out]
+*  csrRowPtrU      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$U\f$.
+*  @param[out]
+*  nnzU            number of non-zero entries of \f$U\f$, in host memory.
+*  @param[out]
+*  info            structure that holds the fill pattern.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p nnzA, \p level, \p descrA,
+*          \p csrRowPtrA, \p csrColIndA, \p descrL, \p csrRowPtrL, \p nnzL, \p descrU,
+*          \p csrRowPtrU, \p nnzU or \p info pointer is invalid, or the columns of \f$A\f$ are
+*          not sorted.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsriluk_analysis(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnzA,
+                                             const hipsparseMatDescr_t descrA,
+                                             const int*                csrRowPtrA,
+                                             const int*                csrColIndA,
+                                             int                       level,
+                                             const hipsparseMatDescr_t descrL,
+                                             int*                      csrRowPtrL,
+                                             int*                      nnzL,
+                                             const hipsparseMatDescr_t descrU,
+                                             int*                      csrRowPtrU,
+                                             int*                      nnzU,
+                                             hipsparseIluInfo_t        info);
+#endif
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill ILU(k) zero pivot.
+*
+*  \details
+*  \p hipsparseXcsriluk_zeroPivot returns \ref HIPSPARSE_STATUS_ZERO_PIVOT, if a zero pivot
+*  has been found during the last call to \ref hipsparseScsriluk "hipsparseXcsriluk()". The
+*  row of the first zero pivot, in the index base of \f$A\f$, is stored in \p position. If no
+*  zero pivot has been found, \p position is set to -1 and \ref HIPSPARSE_STATUS_SUCCESS is
+*  returned instead.
+*
+*  \note
+*  \p position can be in host or device memory, depending on the pointer mode.
+*
+*  \note
+*  \p hipsparseXcsriluk_zeroPivot is a blocking function.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  info            structure that holds the fill pattern.
+*  @param[inout]
+*  position        pointer to the zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p info or \p position pointer is
+*          invalid, or \p info does not hold an ILU(k) analysis.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT zero pivot has been found.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsriluk_zeroPivot(hipsparseHandle_t  handle,
+                                              hipsparseIluInfo_t info,
+                                              int*               position);
+#endif
+
+/*! \ingroup precond_module
+*  \brief Numeric phase of the incomplete LU factorization with level of fill ILU(k).
+*
+*  \details
+*  \p hipsparseXcsriluk computes the values of the factors \f$L\f$ and \f$U\f$ of the ILU(k)
+*  factorization, whose sparsity patterns have been computed by
+*  hipsparseXcsriluk_analysis(). The values of \f$A\f$ are scattered into the fill pattern,
+*  which is factorized by \ref hipsparseScsrilu02 "hipsparseXcsrilu02()" and gathered into
+*  \f$L\f$ and \f$U\f$. The dependency analysis of the factorization is computed by the first
+*  call and reused by all later calls with the same data type, such that refactorizing a
+*  matrix with new values only repeats the numeric work.
+*
+*  The column indices of \f$L\f$ and \f$U\f$ are written on every call. Zero pivots can be
+*  queried with hipsparseXcsriluk_zeroPivot().
+*
+*  \note
+*  The first call per data type performs the dependency analysis and is blocking with respect
+*  to the host. Later calls are non blocking and executed asynchronously with respect to the
+*  host.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  csrValA         array of \p nnzA elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  info            structure that holds the fill pattern.
+*  @param[out]
+*  csrValL         array of \p nnzL elements of the sparse CSR matrix \f$L\f$.
+*  @param[out]
+*  csrColIndL      array of \p nnzL elements containing the column indices of the sparse
+*                  CSR matrix \f$L\f$.
+*  @param[out]
+*  csrValU         array of \p nnzU elements of the sparse CSR matrix \f$U\f$.
+*  @param[out]
+*  csrColIndU      array of \p nnzU elements containing the column indices of the sparse
+*                  CSR matrix \f$U\f$.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p csrValA, \p info, \p csrValL,
+*          \p csrColIndL, \p csrValU or \p csrColIndU pointer is invalid, or \p info does
+*          not hold an ILU(k) analysis.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsriluk(hipsparseHandle_t  handle,
+                                    const float*       csrValA,
+                                    hipsparseIluInfo_t info,
+                                    float*             csrValL,
+                                    int*               csrColIndL,
+                                    float*             csrValU,
+                                    int*               csrColIndU);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsriluk(hipsparseHandle_t  handle,
+                                    const double*      csrValA,
+                                    hipsparseIluInfo_t info,
+                                    double*            csrValL,
+                                    int*               csrColIndL,
+                                    double*            csrValU,
+                                    int*               csrColIndU);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsriluk(hipsparseHandle_t  handle,
+                                    const hipComplex*  csrValA,
+                                    hipsparseIluInfo_t info,
+                                    hipComplex*        csrValL,
+                                    int*               csrColIndL,
+                                    hipComplex*        csrValU,
+                                    int*               csrColIndU);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsriluk(hipsparseHandle_t       handle,
+                                    const hipDoubleComplex* csrValA,
+                                    hipsparseIluInfo_t      info,
+                                    hipDoubleComplex*       csrValL,
+                                    int*                    csrColIndL,
+                                    hipDoubleComplex*       csrValU,
+                                    int*                    csrColIndU);
+#endif
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSRILUK_H */
@@ -0,0 +1,263 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSRILUT_H
+#define HIPSPARSE_CSRILUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with dual threshold dropping ILUT on the host.
+*
+*  \details
+*  \p hipsparseXcsrilutNnz computes the incomplete LU factorization
+*  \f[
+*    A \approx L U
+*  \f]
+*  of the sparse \f$m \times m\f$ CSR matrix \f$A\f$ with the dual threshold strategy
+*  ILUT(\p tol, \p maxFill). Row \f$i\f$ is eliminated with the rows of \f$U\f$ computed so
+*  far, where multipliers and entries smaller than \f$\tau_i = \text{tol} \cdot
+*  \|a_{i,:}\|_2\f$ in magnitude are dropped. Of the remaining entries, the \p maxFill largest
+*  entries of the row of \f$L\f$ and of the row of \f$U\f$ are kept, not counting the
+*  diagonal. With \p tol = 0 and \p maxFill = \p m the complete LU factorization is computed.
+*
+*  \f$L\f$ is unit lower triangular, only its strictly lower part is stored. \f$U\f$ is upper
+*  triangular including the diagonal. Both are sorted CSR matrices that can be passed to
+*  hipsparseSpSV_analysis() and hipsparseSpSV_solve() directly, with
+*  \ref HIPSPARSE_SPMAT_DIAG_TYPE set to \ref HIPSPARSE_DIAG_TYPE_UNIT for \f$L\f$.
+*
+*  The row pointers of \f$L\f$ and \f$U\f$ and their number of non-zero entries are returned,
+*  such that the user can allocate the column indices and values. The factors are stored in
+*  \p info and copied by \ref hipsparseScsrilut "hipsparseXcsrilut()".
+*
+*  \note
+*  The sparsity pattern of ILUT depends on the values of \f$A\f$, such that there is no
+*  analysis that can be reused for new values. There is no device implementation, the
+*  factorization is computed serially on the host and this function is blocking with respect to
+*  the host. It returns \ref HIPSPARSE_STATUS_NOT_SUPPORTED while the handle stream is being
+*  captured. Use \ref hipsparseXcsriluk_analysis for a pattern that is refactorized on the
+*  device.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnzA            number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrValA         array of \p nnzA elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrColIndA      array of \p nnzA elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  tol             non-negative drop tolerance, relative to the norm of each row of \f$A\f$.
+*  @param[in]
+*  maxFill         maximum number of entries per row of \f$L\f$ and of \f$U\f$, not counting
+*                  the diagonal.
+*  @param[in]
+*  descrL          descriptor of the sparse CSR matrix \f$L\f$.
+*  @param[out]
+*  csrRowPtrL      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$L\f$.
+*  @param[out]
+*  nnzL            number of non-zero entries of \f$L\f$, in host memory.
+*  @param[in]
+*  descrU          descriptor of the sparse CSR matrix \f$U\f$.
+*  @param[out]
+*  csrRowPtrU      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$U\f$.
+*  @param[out]
+*  nnzU            number of non-zero entries of \f$U\f$, in host memory.
+*  @param[out]
+*  info            structure that holds the factors.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p nnzA, \p tol, \p maxFill,
+*          \p descrA, \p csrValA, \p csrRowPtrA, \p csrColIndA, \p descrL, \p csrRowPtrL,
+*          \p nnzL, \p descrU, \p csrRowPtrU, \p nnzU or \p info pointer is invalid.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT a pivot is zero.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL or the handle
+*          stream is being captured.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const float*              csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       float                     tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const double*             csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       double                    tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipComplex*         csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       float                     tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipDoubleComplex*   csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       double                    tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info);
+#endif
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with dual threshold dropping ILUT on the host.
+*
+*  \details
+*  \p hipsparseXcsrilut copies the column indices and values of the factors \f$L\f$ and
+*  \f$U\f$ computed by \ref hipsparseScsrilutNnz "hipsparseXcsrilutNnz()" into the arrays
+*  allocated by the user. The data type has to match the one of
+*  \ref hipsparseScsrilutNnz "hipsparseXcsrilutNnz()".
+*
+*  \note
+*  The factors are kept on the host and copied into the device arrays. This function is
+*  blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  info            structure that holds the factors.
+*  @param[out]
+*  csrValL         array of \p nnzL elements of the sparse CSR matrix \f$L\f$.
+*  @param[out]
+*  csrColIndL      array of \p nnzL elements containing the column indices of the sparse
+*                  CSR matrix \f$L\f$.
+*  @param[out]
+*  csrValU         array of \p nnzU elements of the sparse CSR matrix \f$U\f$.
+*  @param[out]
+*  csrColIndU      array of \p nnzU elements containing the column indices of the sparse
+*                  CSR matrix \f$U\f$.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p info, \p csrValL, \p csrColIndL,
+*          \p csrValU or \p csrColIndU pointer is invalid, or \p info does not hold an ILUT
+*          factorization of the same data type.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the handle stream is being captured.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    float*             csrValL,
+                                    int*               csrColIndL,
+                                    float*             csrValU,
+                                    int*               csrColIndU);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    double*            csrValL,
+                                    int*               csrColIndL,
+                                    double*            csrValU,
+                                    int*               csrColIndU);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    hipComplex*        csrValL,
+                                    int*               csrColIndL,
+                                    hipComplex*        csrValU,
+                                    int*               csrColIndU);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    hipDoubleComplex*  csrValL,
+                                    int*               csrColIndL,
+                                    hipDoubleComplex*  csrValU,
+                                    int*               csrColIndU);
+#endif
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSRILUT_H */
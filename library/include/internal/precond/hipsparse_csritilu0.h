@@ -0,0 +1,487 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSRITILU0_H
+#define HIPSPARSE_CSRITILU0_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup precond_module
+*  \details
+*  \p hipsparseXcsritilu0_bufferSize returns the size of the temporary storage buffer
+*  in bytes that is required by \ref hipsparseXcsritilu0_preprocess,
+*  \ref hipsparseScsritilu0 "hipsparseXcsritilu0()" and
+*  \ref hipsparseScsritic0 "hipsparseXcsritic0()". The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle             handle to the hipsparse library context queue.
+*  @param[in]
+*  alg                algorithm of the fixed-point sweeps, see \ref hipsparseItilu0Alg_t.
+*  @param[in]
+*  option             combination of \ref hipsparseItilu0Option_t options.
+*  @param[in]
+*  maxIter            maximum number of sweeps.
+*  @param[in]
+*  m                  number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz                number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descrA             descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csrRowPtrA         array of \p m+1 elements that point to the start of every row of
+*                     the sparse CSR matrix.
+*  @param[in]
+*  csrColIndA         array of \p nnz elements containing the column indices of the sparse
+*                     CSR matrix.
+*  @param[in]
+*  valueType          data type of the values of the sparse CSR matrix.
+*  @param[out]
+*  pBufferSizeInBytes number of bytes of the temporary storage buffer.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descrA, \p csrRowPtrA,
+*          \p csrColIndA or \p pBufferSizeInBytes pointer is invalid, or \p m, \p nnz,
+*          \p maxIter or \p alg is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL, or \p valueType
+*          is not supported.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsritilu0_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseItilu0Alg_t      alg,
+                                                 int                       option,
+                                                 int                       maxIter,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const int*                csrRowPtrA,
+                                                 const int*                csrColIndA,
+                                                 hipDataType               valueType,
+                                                 size_t*                   pBufferSizeInBytes);
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup precond_module
+*  \details
+*  \p hipsparseXcsritilu0_preprocess analyses the sparsity pattern of the sparse CSR matrix
+*  for \ref hipsparseScsritilu0 "hipsparseXcsritilu0()" and
+*  \ref hipsparseScsritic0 "hipsparseXcsritic0()". The result is stored in the temporary
+*  storage buffer and can be reused for any matrix with the same sparsity pattern.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted and every row has to contain its diagonal entry.
+*
+*  @param[in]
+*  handle             handle to the hipsparse library context queue.
+*  @param[in]
+*  alg                algorithm of the fixed-point sweeps, see \ref hipsparseItilu0Alg_t.
+*  @param[in]
+*  option             combination of \ref hipsparseItilu0Option_t options.
+*  @param[in]
+*  maxIter            maximum number of sweeps.
+*  @param[in]
+*  m                  number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz                number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descrA             descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csrRowPtrA         array of \p m+1 elements that point to the start of every row of
+*                     the sparse CSR matrix.
+*  @param[in]
+*  csrColIndA         array of \p nnz elements containing the column indices of the sparse
+*                     CSR matrix.
+*  @param[in]
+*  valueType          data type of the values of the sparse CSR matrix.
+*  @param[in]
+*  bufferSize         size of the temporary storage buffer, as returned by
+*                     \ref hipsparseXcsritilu0_bufferSize.
+*  @param[in]
+*  pBuffer            temporary storage buffer allocated by the user.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descrA, \p csrRowPtrA,
+*          \p csrColIndA or \p pBuffer pointer is invalid, or \p m, \p nnz, \p maxIter,
+*          \p alg or \p bufferSize is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL, or \p valueType
+*          is not supported.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT a row of the matrix does not contain its diagonal.
+*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsritilu0_preprocess(hipsparseHandle_t         handle,
+                                                 hipsparseItilu0Alg_t      alg,
+                                                 int                       option,
+                                                 int                       maxIter,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const int*                csrRowPtrA,
+                                                 const int*                csrColIndA,
+                                                 hipDataType               valueType,
+                                                 size_t                    bufferSize,
+                                                 void*                     pBuffer);
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup precond_module
+*  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p hipsparseXcsritilu0 computes the incomplete LU factorization \f$A \approx LU\f$ with the
+*  sparsity pattern of \f$A\f$ by fixed-point sweeps. Every sweep updates all entries of
+*  \f$L\f$ and \f$U\f$ in parallel from
+*  \f[
+*    \begin{array}{ll}
+*      L_{ij} = \left(A_{ij} - \sum_{k < j} L_{ik} U_{kj}\right) / U_{jj}, & i > j, \\
+*      U_{ij} = A_{ij} - \sum_{k < i} L_{ik} U_{kj}, & i \le j,
+*    \end{array}
+*  \f]
+*  where the sums run over the sparsity pattern of \f$A\f$. The fixed point of the sweeps is
+*  the factorization computed by \ref hipsparseScsrilu02 "hipsparseXcsrilu02()". Unlike the
+*  level scheduled factorization, the parallelism of a sweep does not depend on the
+*  dependencies between rows, such that a few sweeps are often faster on matrices with long
+*  dependency chains.
+*
+*  The strictly lower triangular part of \p csrValM holds \f$L\f$ without its unit diagonal,
+*  the upper triangular part holds \f$U\f$.
+*
+*  The sweeps stop after \p maxIter sweeps, or earlier if
+*  \ref HIPSPARSE_ITILU0_OPTION_STOPPING_CRITERIA is set and the computed correction or
+*  residual norm is below \p tol. The number of sweeps performed is returned in \p maxIter.
+*  \ref HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_CORRECTION and
+*  \ref HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_RESIDUAL select the norms that are computed, and
+*  \ref HIPSPARSE_ITILU0_OPTION_CONVERGENCE_HISTORY records them for
+*  \ref hipsparseScsritilu0_history "hipsparseXcsritilu0_history()".
+*
+*  \note
+*  \p hipsparseXcsritilu0 requires \ref hipsparseXcsritilu0_preprocess to be called with the
+*  same \p alg, \p option and \p maxIter first.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  alg         algorithm of the fixed-point sweeps, see \ref hipsparseItilu0Alg_t.
+*  @param[in]
+*  option      combination of \ref hipsparseItilu0Option_t options.
+*  @param[inout]
+*  maxIter     maximum number of sweeps on input, number of sweeps performed on output.
+*  @param[in]
+*  tol         tolerance of the stopping criteria.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descrA      descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csrValA     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csrRowPtrA  array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csrColIndA  array of \p nnz elements containing the column indices of the sparse CSR
+*              matrix.
+*  @param[out]
+*  csrValM     array of \p nnz elements containing the incomplete LU factors.
+*  @param[in]
+*  bufferSize  size of the temporary storage buffer.
+*  @param[in]
+*  pBuffer     temporary storage buffer prepared by \ref hipsparseXcsritilu0_preprocess.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descrA, \p maxIter, \p csrValA,
+*          \p csrRowPtrA, \p csrColIndA, \p csrValM or \p pBuffer pointer is invalid, or
+*          \p m, \p nnz, \p alg or \p tol is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT a zero pivot has been found.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      float                     tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const float*              csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      float*                    csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      double                    tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const double*             csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      double*                   csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      float                     tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipComplex*         csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      hipComplex*               csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      double                    tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipDoubleComplex*   csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      hipDoubleComplex*         csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer);
+/**@}*/
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup precond_module
+*  \details
+*  \p hipsparseXcsritilu0_history returns the convergence history of the last call to
+*  \ref hipsparseScsritilu0 "hipsparseXcsritilu0()" or
+*  \ref hipsparseScsritic0 "hipsparseXcsritic0()" that used \p pBuffer. \p data holds
+*  \f$2 \cdot niter\f$ values, the correction norm and the residual norm of every sweep.
+*  The history is only recorded if \ref HIPSPARSE_ITILU0_OPTION_CONVERGENCE_HISTORY is set.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  alg         algorithm of the fixed-point sweeps, see \ref hipsparseItilu0Alg_t.
+*  @param[out]
+*  niter       number of sweeps recorded.
+*  @param[out]
+*  data        array of \f$2 \cdot maxIter\f$ elements, in host memory.
+*  @param[in]
+*  bufferSize  size of the temporary storage buffer.
+*  @param[in]
+*  pBuffer     temporary storage buffer.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p niter, \p data or \p pBuffer
+*          pointer is invalid, or \p alg is invalid.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              float*               data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              double*              data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              float*               data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              double*              data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer);
+/**@}*/
+#endif
+
+#if(!defined(CUDART_VERSION))
+/*! \ingroup precond_module
+*  \brief Iterative incomplete Cholesky factorization with 0 fill-ins and no pivoting using
+*  CSR storage format
+*
+*  \details
+*  \p hipsparseXcsritic0 computes the incomplete Cholesky factorization
+*  \f$A \approx LL^H\f$ of a Hermitian positive definite matrix by the fixed-point sweeps
+*  of \ref hipsparseScsritilu0 "hipsparseXcsritilu0()". The incomplete LU factors of such a
+*  matrix satisfy \f$U = DL^H\f$, with \f$D\f$ the diagonal of \f$U\f$, and the Cholesky
+*  factor is obtained by scaling the columns of the unit lower triangular factor with
+*  \f$D^{1/2}\f$.
+*
+*  The lower triangular part of \p csrValM holds \f$L\f$, the strictly upper triangular
+*  part holds the values of \f$A\f$, as with \ref hipsparseScsric02 "hipsparseXcsric02()".
+*
+*  \note
+*  Both triangular parts of \f$A\f$ have to be stored.
+*
+*  \note
+*  \p hipsparseXcsritic0 requires \ref hipsparseXcsritilu0_preprocess to be called with the
+*  same \p alg, \p option and \p maxIter first.
+*
+*  \note
+*  Only the fixed-point sweeps run on the device. The matrix and its incomplete LU factors are
+*  then copied to the host, scaled into the Cholesky factor by a single host thread and copied
+*  back. This function is blocking with respect to the host and returns
+*  \ref HIPSPARSE_STATUS_NOT_SUPPORTED while the handle stream is being captured.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  alg         algorithm of the fixed-point sweeps, see \ref hipsparseItilu0Alg_t.
+*  @param[in]
+*  option      combination of \ref hipsparseItilu0Option_t options.
+*  @param[inout]
+*  maxIter     maximum number of sweeps on input, number of sweeps performed on output.
+*  @param[in]
+*  tol         tolerance of the stopping criteria.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descrA      descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csrValA     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csrRowPtrA  array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csrColIndA  array of \p nnz elements containing the column indices of the sparse CSR
+*              matrix.
+*  @param[out]
+*  csrValM     array of \p nnz elements containing the incomplete Cholesky factor.
+*  @param[in]
+*  bufferSize  size of the temporary storage buffer.
+*  @param[in]
+*  pBuffer     temporary storage buffer prepared by \ref hipsparseXcsritilu0_preprocess.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descrA, \p maxIter, \p csrValA,
+*          \p csrRowPtrA, \p csrColIndA, \p csrValM or \p pBuffer pointer is invalid, or
+*          \p m, \p nnz, \p alg or \p tol is invalid.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL, or the handle
+*          stream is being captured.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT a zero or negative pivot has been found.
+*/
+/**@{*/
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     float                     tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     float*                    csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     double                    tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     double*                   csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     float                     tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     hipComplex*               csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer);
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     double                    tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     hipDoubleComplex*         csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer);
+/**@}*/
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSRITILU0_H */
@@ -0,0 +1,193 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_BSRPERMUTE_H
+#define HIPSPARSE_BSRPERMUTE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Symbolic phase of the permutation of a sparse BSR matrix.
+*
+*  \details
+*  \p hipsparseXbsrpermute_analysis computes the sparsity pattern of the permuted
+*  \f$mb \times nb\f$ block matrix
+*  \f[
+*    B = P A Q^T,
+*  \f]
+*  i.e. block \f$(i, j)\f$ of \f$B\f$ is block \f$(P[i], Q[j])\f$ of \f$A\f$, where \p P and
+*  \p Q are zero based permutations of the block rows and block columns. The blocks themselves
+*  are not changed, such that the result does not depend on the storage direction of the blocks.
+*  The block columns of every block row of \f$B\f$ are sorted. The position of every value of
+*  \f$A\f$ in \f$B\f$ is stored in \p info, such that the values of \f$B\f$ can be computed
+*  with \ref hipsparseSbsrpermute "hipsparseXbsrpermute()" as often as the values of \f$A\f$
+*  change, without repeating this analysis.
+*
+*  \p P or \p Q can be \p nullptr, in which case the block rows or block columns are not
+*  permuted.
+*
+*  \note
+*  The sparsity pattern is computed on the host. This function is blocking with respect to the
+*  host.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  mb              number of block rows of the sparse BSR matrices.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrices.
+*  @param[in]
+*  nnzb            number of non-zero blocks of the sparse BSR matrices.
+*  @param[in]
+*  descrA          descriptor of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsrRowPtrA      array of \p mb+1 elements that point to the start of every block row of the
+*                  sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsrColIndA      array of \p nnzb elements containing the block column indices of the sparse
+*                  BSR matrix \f$A\f$.
+*  @param[in]
+*  blockDim        block dimension of the sparse BSR matrices.
+*  @param[in]
+*  P               array of \p mb elements containing the block row permutation, or
+*                  \p nullptr.
+*  @param[in]
+*  Q               array of \p nb elements containing the block column permutation, or
+*                  \p nullptr.
+*  @param[in]
+*  descrB          descriptor of the sparse BSR matrix \f$B\f$.
+*  @param[out]
+*  bsrRowPtrB      array of \p mb+1 elements that point to the start of every block row of the
+*                  sparse BSR matrix \f$B\f$.
+*  @param[out]
+*  bsrColIndB      array of \p nnzb elements containing the block column indices of the sparse
+*                  BSR matrix \f$B\f$.
+*  @param[out]
+*  info            structure that holds the permutation of the values.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p mb, \p nb, \p nnzb, \p blockDim,
+*          \p descrA, \p bsrRowPtrA, \p bsrColIndA, \p descrB, \p bsrRowPtrB, \p bsrColIndB or
+*          \p info pointer is invalid, or \p P or \p Q is not a permutation.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXbsrpermute_analysis(hipsparseHandle_t         handle,
+                                                int                       mb,
+                                                int                       nb,
+                                                int                       nnzb,
+                                                const hipsparseMatDescr_t descrA,
+                                                const int*                bsrRowPtrA,
+                                                const int*                bsrColIndA,
+                                                int                       blockDim,
+                                                const int*                P,
+                                                const int*                Q,
+                                                const hipsparseMatDescr_t descrB,
+                                                int*                      bsrRowPtrB,
+                                                int*                      bsrColIndB,
+                                                hipsparsePermuteInfo_t    info);
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Numeric phase of the permutation of a sparse BSR matrix.
+*
+*  \details
+*  \p hipsparseXbsrpermute computes the values of the permuted matrix \f$B = P A Q^T\f$, whose
+*  sparsity pattern has been computed by hipsparseXbsrpermute_analysis(). The values are
+*  gathered in a single pass over \f$A\f$.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  nnzb            number of non-zero blocks of the sparse BSR matrices.
+*  @param[in]
+*  blockDim        block dimension of the sparse BSR matrices.
+*  @param[in]
+*  bsrValA         array of \p nnzb*blockDim*blockDim elements of the sparse BSR matrix
+*                  \f$A\f$.
+*  @param[out]
+*  bsrValB         array of \p nnzb*blockDim*blockDim elements of the sparse BSR matrix
+*                  \f$B\f$.
+*  @param[in]
+*  info            structure that holds the permutation of the values.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p nnzb, \p blockDim, \p bsrValA,
+*          \p bsrValB or \p info pointer is invalid, or \p nnzb or \p blockDim does not match
+*          the analysis.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSbsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnzb,
+                                       int                    blockDim,
+                                       const float*           bsrValA,
+                                       float*                 bsrValB,
+                                       hipsparsePermuteInfo_t info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDbsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnzb,
+                                       int                    blockDim,
+                                       const double*          bsrValA,
+                                       double*                bsrValB,
+                                       hipsparsePermuteInfo_t info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCbsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnzb,
+                                       int                    blockDim,
+                                       const hipComplex*      bsrValA,
+                                       hipComplex*            bsrValB,
+                                       hipsparsePermuteInfo_t info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZbsrpermute(hipsparseHandle_t       handle,
+                                       int                     nnzb,
+                                       int                     blockDim,
+                                       const hipDoubleComplex* bsrValA,
+                                       hipDoubleComplex*       bsrValB,
+                                       hipsparsePermuteInfo_t  info);
+#endif
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_BSRPERMUTE_H */
@@ -0,0 +1,179 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSRPERMUTE_H
+#define HIPSPARSE_CSRPERMUTE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Symbolic phase of the permutation of a sparse CSR matrix.
+*
+*  \details
+*  \p hipsparseXcsrpermute_analysis computes the sparsity pattern of the permuted \f$m \times n\f$
+*  matrix
+*  \f[
+*    B = P A Q^T,
+*  \f]
+*  i.e. \f$B_{ij} = A_{P[i], Q[j]}\f$, where \p P and \p Q are zero based permutations of the
+*  rows and columns. \f$B\f$ has the same number of non-zero entries as \f$A\f$ and the columns
+*  of every row of \f$B\f$ are sorted. The position of every entry of \f$A\f$ in \f$B\f$ is
+*  stored in \p info, such that the values of \f$B\f$ can be computed with
+*  \ref hipsparseScsrpermute "hipsparseXcsrpermute()" as often as the values of \f$A\f$
+*  change, without repeating this analysis.
+*
+*  A symmetric permutation \f$P A P^T\f$ is computed with \p Q equal to \p P, for example with
+*  the permutation computed by hipsparseXcsrrcm(). \p P or \p Q can be \p nullptr, in which
+*  case the rows or columns are not permuted.
+*
+*  \note
+*  The sparsity pattern is computed on the host. This function is blocking with respect to the
+*  host.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrices.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrices.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrices.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrColIndA      array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  P               array of \p m elements containing the row permutation, or \p nullptr.
+*  @param[in]
+*  Q               array of \p n elements containing the column permutation, or \p nullptr.
+*  @param[in]
+*  descrB          descriptor of the sparse CSR matrix \f$B\f$.
+*  @param[out]
+*  csrRowPtrB      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[out]
+*  csrColIndB      array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$B\f$.
+*  @param[out]
+*  info            structure that holds the permutation of the values.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p n, \p nnz, \p descrA,
+*          \p csrRowPtrA, \p csrColIndA, \p descrB, \p csrRowPtrB, \p csrColIndB or \p info
+*          pointer is invalid, or \p P or \p Q is not a permutation.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrpermute_analysis(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const int*                P,
+                                                const int*                Q,
+                                                const hipsparseMatDescr_t descrB,
+                                                int*                      csrRowPtrB,
+                                                int*                      csrColIndB,
+                                                hipsparsePermuteInfo_t    info);
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Numeric phase of the permutation of a sparse CSR matrix.
+*
+*  \details
+*  \p hipsparseXcsrpermute computes the values of the permuted matrix \f$B = P A Q^T\f$, whose
+*  sparsity pattern has been computed by hipsparseXcsrpermute_analysis(). The values are
+*  gathered in a single pass over \f$A\f$.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  This routine supports execution in a hipGraph context.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrices.
+*  @param[in]
+*  csrValA         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+*  @param[out]
+*  csrValB         array of \p nnz elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  info            structure that holds the permutation of the values.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p nnz, \p csrValA, \p csrValB or \p info
+*          pointer is invalid, or \p nnz does not match the analysis.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnz,
+                                       const float*           csrValA,
+                                       float*                 csrValB,
+                                       hipsparsePermuteInfo_t info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnz,
+                                       const double*          csrValA,
+                                       double*                csrValB,
+                                       hipsparsePermuteInfo_t info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnz,
+                                       const hipComplex*      csrValA,
+                                       hipComplex*            csrValB,
+                                       hipsparsePermuteInfo_t info);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrpermute(hipsparseHandle_t       handle,
+                                       int                     nnz,
+                                       const hipDoubleComplex* csrValA,
+                                       hipDoubleComplex*       csrValB,
+                                       hipsparsePermuteInfo_t  info);
+#endif
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSRPERMUTE_H */
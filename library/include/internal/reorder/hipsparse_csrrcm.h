@@ -0,0 +1,90 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSRRCM_H
+#define HIPSPARSE_CSRRCM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Reverse Cuthill-McKee reordering of the matrix \f$A\f$ stored in the CSR format.
+*
+*  \details
+*  \p hipsparseXcsrrcm computes the reverse Cuthill-McKee permutation of the undirected graph
+*  represented by the sparsity pattern of \f$A + A^T\f$. The permutation reduces the bandwidth
+*  and the profile of \f$A\f$, which improves the locality of SpMV and reduces the fill-in of
+*  incomplete factorizations.
+*
+*  Every connected component of the graph is ordered by a breadth first search from a
+*  pseudo-peripheral node, visiting the neighbours of a node in ascending order of their degree.
+*  The concatenated orderings of the components are reversed.
+*
+*  The permutation \p P maps the rows of the reordered matrix to the rows of \f$A\f$, i.e. row
+*  \f$i\f$ of \f$P A P^T\f$ is row \f$P[i]\f$ of \f$A\f$. It is zero based and uses the same
+*  convention as the permutations of \ref hipsparseXcsrsort() and
+*  \ref hipsparseCreateIdentityPermutation(), such that vectors can be permuted with
+*  \ref hipsparseSgthr "hipsparseXgthr()". The matrix itself can be permuted with
+*  \ref hipsparseScsrsymperm "hipsparseXcsrsymperm()".
+*
+*  \note
+*  The permutation is computed on the host. This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csrColIndA      array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  P               array of \p m elements containing the permutation.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p nnz, \p descrA, \p csrRowPtrA,
+*          \p csrColIndA or \p P pointer is invalid, or a column index is out of range.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseXcsrrcm(hipsparseHandle_t         handle,
+                                   int                       m,
+                                   int                       nnz,
+                                   const hipsparseMatDescr_t descrA,
+                                   const int*                csrRowPtrA,
+                                   const int*                csrColIndA,
+                                   int*                      P);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSRRCM_H */
@@ -0,0 +1,152 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_CSRSYMPERM_H
+#define HIPSPARSE_CSRSYMPERM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup reordering_module
+*  \brief Symmetric permutation of a sparse CSR matrix.
+*
+*  \details
+*  \p hipsparseXcsrsymperm computes the symmetrically permuted matrix
+*  \f[
+*    C = P A P^T,
+*  \f]
+*  i.e. \f$C_{ij} = A_{P[i], P[j]}\f$, where \p P is a zero based permutation, for example the
+*  permutation computed by \ref hipsparseXcsrrcm(). \f$C\f$ has the same number of non-zero
+*  entries as \f$A\f$ and the columns of every row of \f$C\f$ are sorted.
+*
+*  The sparsity pattern of \f$C\f$ and the position of every entry of \f$A\f$ in \f$C\f$ are
+*  computed on the host, the values are gathered on the device.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  Currently, only \ref HIPSPARSE_MATRIX_TYPE_GENERAL is supported.
+*
+*  @param[in]
+*  handle          handle to the hipsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrices.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrices.
+*  @param[in]
+*  descrA          descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrValA         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrRowPtrA      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csrColIndA      array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  P               array of \p m elements containing the permutation.
+*  @param[in]
+*  descrC          descriptor of the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csrValC         array of \p nnz elements of the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csrRowPtrC      array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csrColIndC      array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$C\f$.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p m, \p nnz, \p descrA, \p csrValA,
+*          \p csrRowPtrA, \p csrColIndA, \p P, \p descrC, \p csrValC, \p csrRowPtrC or
+*          \p csrColIndC pointer is invalid, or \p P is not a permutation.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED
+*          \ref hipsparseMatrixType_t != \ref HIPSPARSE_MATRIX_TYPE_GENERAL.
+*/
+/**@{*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseScsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const float*              csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       float*                    csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseDcsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const double*             csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       double*                   csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseCcsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipComplex*         csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       hipComplex*               csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC);
+
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseZcsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipDoubleComplex*   csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       hipDoubleComplex*         csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC);
+#endif
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_CSRSYMPERM_H */
@@ -0,0 +1,278 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_AMG_H
+#define HIPSPARSE_AMG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Create an algebraic multigrid descriptor.
+*
+*  \details
+*  \p hipsparseAmg_createDescr creates a smoothed aggregation algebraic multigrid descriptor with
+*  the default parameters: a strength threshold of 0.08, a prolongator weight of 4/3, at most 10
+*  levels, a coarsest level of at most 64 rows and one pre- and one post-sweep of the weighted
+*  Jacobi method with \f$\omega = 2/3\f$.
+*
+*  @param[out]
+*  descr       pointer to the multigrid descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_createDescr(hipsparseAmgDescr_t* descr);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Destroy an algebraic multigrid descriptor.
+*
+*  \details
+*  \p hipsparseAmg_destroyDescr destroys a multigrid descriptor and releases the hierarchy held
+*  by it.
+*
+*  @param[in]
+*  descr       the multigrid descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_destroyDescr(hipsparseAmgDescr_t descr);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Set the coarsening parameters of an algebraic multigrid descriptor.
+*
+*  \details
+*  \p hipsparseAmg_setParameters sets the parameters of the coarsening. Row \f$i\f$ of a level
+*  is strongly connected to row \f$j \neq i\f$ if
+*  \f[
+*    |a_{ij}| \geq \theta \sqrt{|a_{ii} a_{jj}|}.
+*  \f]
+*  The rows are grouped into aggregates of strongly connected rows, every aggregate is a row of
+*  the next coarser level. The tentative prolongator \f$T\f$ has a one in row \f$i\f$ and the
+*  column of the aggregate of \f$i\f$, rows without strong connections are not aggregated and
+*  their row of \f$T\f$ is empty. It is smoothed by one step of the weighted Jacobi method
+*  \f[
+*    P = (I - \frac{w}{\rho} D^{-1} A) T,
+*  \f]
+*  where \f$\rho\f$ is the Gershgorin bound of the spectral radius of \f$D^{-1} A\f$. The
+*  restriction is \f$R = P^T\f$ and the matrix of the next coarser level is \f$R A P\f$.
+*
+*  The coarsening stops at \p maxLevels levels, once a level has at most \p coarseSize rows or
+*  once the aggregation does not reduce the number of rows. The coarsest level is solved with
+*  its dense inverse if it has at most \p coarseSize rows, and relaxed with the smoother
+*  otherwise.
+*
+*  The parameters take effect with the next call to \ref hipsparseAmg_setup, which has to be
+*  repeated before the next V-cycle.
+*
+*  @param[inout]
+*  descr       the multigrid descriptor.
+*  @param[in]
+*  strengthThreshold threshold \f$\theta\f$ of the strength of connection, in \f$[0, 1]\f$.
+*  @param[in]
+*  prolongatorWeight weight \f$w\f$ of the prolongator smoothing, 0 uses the tentative
+*              prolongator.
+*  @param[in]
+*  maxLevels   maximum number of levels, including the finest level.
+*  @param[in]
+*  coarseSize  maximum number of rows of a level that is solved directly.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid, \p strengthThreshold is
+*          not in \f$[0, 1]\f$, \p prolongatorWeight is negative, \p maxLevels is not positive
+*          or \p coarseSize is negative.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_setParameters(hipsparseAmgDescr_t descr,
+                                             double              strengthThreshold,
+                                             double              prolongatorWeight,
+                                             int                 maxLevels,
+                                             int64_t             coarseSize);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Set the smoother of an algebraic multigrid descriptor.
+*
+*  \details
+*  \p hipsparseAmg_setSmoother sets the smoother of every level, see
+*  \ref hipsparseSmoother_createDescr. The multicolor smoothers use a greedy coloring of every
+*  level computed by the setup. The smoother takes effect with the next call to
+*  \ref hipsparseAmg_setup, which has to be repeated before the next V-cycle.
+*
+*  @param[inout]
+*  descr       the multigrid descriptor.
+*  @param[in]
+*  alg         relaxation method, see \ref hipsparseSmootherAlg_t.
+*  @param[in]
+*  preSweeps   number of sweeps before the coarse grid correction.
+*  @param[in]
+*  postSweeps  number of sweeps after the coarse grid correction.
+*  @param[in]
+*  omega       relaxation weight of the Jacobi and SOR methods.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid, \p alg is invalid,
+*          \p preSweeps or \p postSweeps is negative or \p omega is not positive.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_setSmoother(hipsparseAmgDescr_t    descr,
+                                           hipsparseSmootherAlg_t alg,
+                                           int                    preSweeps,
+                                           int                    postSweeps,
+                                           double                 omega);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Set up the multigrid hierarchy of a matrix.
+*
+*  \details
+*  \p hipsparseAmg_setup computes the levels of the smoothed aggregation multigrid method for
+*  \p matA. The strength of connection, the aggregation, the Jacobi operator of the prolongator
+*  smoothing, the coloring of every level and the dense inverse of the coarsest level are
+*  computed on the host. The prolongators and the Galerkin products \f$R A P\f$ are computed on
+*  the device with \ref hipsparseSpGEMM_compute "SpGEMM" and the restrictions by a
+*  transposition. Every level is copied to the host, such that the setup is bound by host work
+*  and transfers. Only \ref hipsparseAmg_vcycle runs entirely on the device.
+*
+*  If \p descr has been set up before for a matrix with the same sparsity pattern, i.e. the same
+*  descriptor with unchanged size and pointers, and its parameters did not change, the
+*  aggregates and the sparsity patterns of all levels are kept and only the numeric phase of
+*  every SpGEMM, the smoothers and the coarsest level are recomputed.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  \note
+*  Only matrices with 32 bit indices are supported.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[inout]
+*  descr       the multigrid descriptor.
+*  @param[in]
+*  matA        square matrix descriptor in CSR format.
+*  @param[in]
+*  computeType floating point precision of the multigrid method, has to match the data type of
+*              \p matA.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descr or \p matA pointer is invalid,
+*          \p matA is not square or \p computeType does not match the data type of \p matA.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT the diagonal of a level has a zero or missing entry or
+*          the coarsest level is singular.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matA is not in CSR format, does not use 32 bit
+*          indices or \p computeType is not supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_setup(hipsparseHandle_t          handle,
+                                     hipsparseAmgDescr_t        descr,
+                                     hipsparseConstSpMatDescr_t matA,
+                                     hipDataType                computeType);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Query the levels of a multigrid hierarchy.
+*
+*  \details
+*  \p hipsparseAmg_getLevel returns the number of levels of the last setup and the size of
+*  level \p level, where level 0 is the matrix passed to \ref hipsparseAmg_setup.
+*
+*  @param[in]
+*  descr       the multigrid descriptor.
+*  @param[in]
+*  level       the level to query.
+*  @param[out]
+*  numLevels   number of levels of the hierarchy.
+*  @param[out]
+*  rows        number of rows of level \p level.
+*  @param[out]
+*  nnz         number of non-zero entries of level \p level.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr, \p numLevels, \p rows or \p nnz pointer is
+*          invalid, \p descr has not been set up or \p level is out of range.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_getLevel(
+    hipsparseAmgDescr_t descr, int level, int* numLevels, int64_t* rows, int64_t* nnz);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Apply one V-cycle of a multigrid hierarchy.
+*
+*  \details
+*  \p hipsparseAmg_vcycle updates the approximation in \p vecX of the solution of
+*  \f$A x = b\f$ by one V-cycle. On every level but the coarsest, the pre-sweeps of the smoother
+*  are applied, the residual is restricted to the next coarser level, the correction of the
+*  coarser level is prolongated and added, and the post-sweeps are applied. A V-cycle with a
+*  zero initial approximation is a symmetric preconditioner for symmetric matrices if the
+*  smoother is symmetric and the pre- and post-sweeps are equal.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host. It may
+*  return before the actual computation has finished and can be captured into a graph.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  descr       the multigrid descriptor, set up for \p matA.
+*  @param[in]
+*  matA        matrix descriptor passed to \ref hipsparseAmg_setup.
+*  @param[in]
+*  vecB        right hand side.
+*  @param[inout]
+*  vecX        approximation of the solution, updated in place.
+*  @param[in]
+*  computeType floating point precision of the multigrid method.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descr, \p matA, \p vecB or \p vecX
+*          pointer is invalid, \p descr has not been set up for \p matA or the sizes or data
+*          types of the vectors do not match.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseAmg_vcycle(hipsparseHandle_t          handle,
+                                      hipsparseAmgDescr_t        descr,
+                                      hipsparseConstSpMatDescr_t matA,
+                                      hipsparseConstDnVecDescr_t vecB,
+                                      hipsparseDnVecDescr_t      vecX,
+                                      hipDataType                computeType);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_AMG_H */
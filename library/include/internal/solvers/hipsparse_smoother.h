@@ -0,0 +1,204 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_SMOOTHER_H
+#define HIPSPARSE_SMOOTHER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Create a smoother descriptor.
+*
+*  \details
+*  \p hipsparseSmoother_createDescr creates a smoother descriptor for the relaxation method
+*  \p alg. The smoother runs one sweep with a relaxation weight of 1, unless changed with
+*  \ref hipsparseSmoother_setParameters.
+*
+*  A sweep of the smoother updates an approximation \f$x\f$ of the solution of
+*  \f[
+*    A x = b,
+*  \f]
+*  where \f$A\f$ is a square sparse matrix in CSR format. The rows of \f$A\f$ are grouped by the
+*  colors of a coloring computed by \ref hipsparseScsrcolor "hipsparseXcsrcolor()". The
+*  Gauss-Seidel and SOR methods update the rows of one color \f$c\f$ at a time
+*  \f[
+*    x_c := x_c + \omega D_c^{-1} (b_c - A_c x),
+*  \f]
+*  where \f$A_c\f$, \f$D_c\f$, \f$x_c\f$ and \f$b_c\f$ are the rows of \f$A\f$, the diagonal of
+*  \f$A\f$, \f$x\f$ and \f$b\f$ of color \f$c\f$. The symmetric Gauss-Seidel method sweeps the
+*  colors in ascending and then in descending order. The weighted Jacobi method updates all rows
+*  at once.
+*
+*  @param[out]
+*  descr       pointer to the smoother descriptor.
+*  @param[in]
+*  alg         relaxation method, see \ref hipsparseSmootherAlg_t.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid or \p alg is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSmoother_createDescr(hipsparseSmootherDescr_t* descr,
+                                                hipsparseSmootherAlg_t    alg);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Destroy a smoother descriptor.
+*
+*  \details
+*  \p hipsparseSmoother_destroyDescr destroys a smoother descriptor and releases all resources
+*  held by it.
+*
+*  @param[in]
+*  descr       the smoother descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSmoother_destroyDescr(hipsparseSmootherDescr_t descr);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Set the parameters of a smoother.
+*
+*  \details
+*  \p hipsparseSmoother_setParameters sets the number of sweeps of every call to
+*  \ref hipsparseSmoother_smooth and the relaxation weight \f$\omega\f$. The Gauss-Seidel and
+*  symmetric Gauss-Seidel methods always use \f$\omega = 1\f$.
+*
+*  @param[inout]
+*  descr       the smoother descriptor.
+*  @param[in]
+*  sweeps      number of sweeps.
+*  @param[in]
+*  omega       relaxation weight of the Jacobi and SOR methods, usually in \f$(0, 1]\f$ for the
+*              Jacobi method and in \f$(0, 2)\f$ for the SOR method.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid, \p sweeps is negative or
+*          \p omega is not positive.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseSmoother_setParameters(hipsparseSmootherDescr_t descr, int sweeps, double omega);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Set up a smoother for a matrix and its coloring.
+*
+*  \details
+*  \p hipsparseSmoother_analysis permutes a copy of \p matA such that the rows and columns of
+*  every color are contiguous, and inverts its diagonal. The permutation is computed once and
+*  every sweep of \ref hipsparseSmoother_smooth then works on one contiguous block of rows per
+*  color. The analysis has to be repeated if the values of \p matA change.
+*
+*  \p coloring is the coloring returned by \ref hipsparseScsrcolor "hipsparseXcsrcolor()". Rows
+*  of the same color should not be coupled by an off-diagonal entry of \p matA, otherwise the
+*  rows of a color are relaxed like in the Jacobi method.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[inout]
+*  descr       the smoother descriptor.
+*  @param[in]
+*  matA        square matrix descriptor in CSR format.
+*  @param[in]
+*  ncolors     number of colors of \p coloring.
+*  @param[in]
+*  coloring    array of \p m colors in \f$[0, ncolors)\f$, one for every row of \p matA, in
+*              device memory. The Jacobi method ignores \p ncolors and \p coloring, which can
+*              be a null pointer.
+*  @param[in]
+*  computeType floating point precision of the smoother, has to match the data type of \p matA.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descr, \p matA or \p coloring pointer is
+*          invalid, \p matA is not square, \p ncolors is not positive, a color is out of range
+*          or \p computeType does not match the data type of \p matA.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT the diagonal of \p matA has a zero or missing entry.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matA is not in CSR format or \p computeType is not
+*          supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSmoother_analysis(hipsparseHandle_t          handle,
+                                             hipsparseSmootherDescr_t   descr,
+                                             hipsparseConstSpMatDescr_t matA,
+                                             int                        ncolors,
+                                             const int*                 coloring,
+                                             hipDataType                computeType);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Apply the sweeps of a smoother.
+*
+*  \details
+*  \p hipsparseSmoother_smooth applies the sweeps of \p descr to the approximation in \p vecX of
+*  the solution of \f$A x = b\f$. \p vecB and \p vecX are in the original order of the rows, the
+*  smoother permutes them into the order of the colors and back once per call.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host. It may
+*  return before the actual computation has finished and can be captured into a graph.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[in]
+*  descr       the smoother descriptor, set up for \p matA.
+*  @param[in]
+*  matA        matrix descriptor passed to \ref hipsparseSmoother_analysis.
+*  @param[in]
+*  vecB        right hand side.
+*  @param[inout]
+*  vecX        approximation of the solution, updated in place.
+*  @param[in]
+*  computeType floating point precision of the smoother.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descr, \p matA, \p vecB or \p vecX
+*          pointer is invalid, \p descr has not been set up for \p matA or the sizes or data
+*          types of the vectors do not match.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSmoother_smooth(hipsparseHandle_t          handle,
+                                           hipsparseSmootherDescr_t   descr,
+                                           hipsparseConstSpMatDescr_t matA,
+                                           hipsparseConstDnVecDescr_t vecB,
+                                           hipsparseDnVecDescr_t      vecX,
+                                           hipDataType                computeType);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_SMOOTHER_H */
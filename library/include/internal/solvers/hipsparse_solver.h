@@ -0,0 +1,270 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#ifndef HIPSPARSE_SOLVER_H
+#define HIPSPARSE_SOLVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Create a solver descriptor.
+*
+*  \details
+*  \p hipsparseSolver_createDescr creates a solver descriptor for the Krylov method \p alg with
+*  the preconditioner \p precond. The solver runs at most 1000 iterations to a relative residual
+*  of \f$10^{-6}\f$ and GMRES restarts every 30 iterations, unless changed with
+*  \ref hipsparseSolver_setParameters.
+*
+*  The solvers compute the solution of
+*  \f[
+*    A x = b,
+*  \f]
+*  where \f$A\f$ is a square sparse matrix in CSR format. CG requires \f$A\f$ and the
+*  preconditioner to be Hermitian positive definite and should be combined with the Jacobi or
+*  IC0 preconditioner. BiCGStab and GMRES are right preconditioned and work with all
+*  preconditioners.
+*
+*  The solvers are driven by the host. The matrix products, triangular solves and vector
+*  updates run on the device, while the Jacobi setup, the convergence checks and the least
+*  squares problem of GMRES run on the host, see \ref hipsparseSolver_analysis and
+*  \ref hipsparseSolver_solve.
+*
+*  @param[out]
+*  descr       pointer to the solver descriptor.
+*  @param[in]
+*  alg         Krylov method, see \ref hipsparseSolverAlg_t.
+*  @param[in]
+*  precond     preconditioner, see \ref hipsparseSolverPrecond_t.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid or \p alg or \p precond
+*          is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSolver_createDescr(hipsparseSolverDescr_t*  descr,
+                                              hipsparseSolverAlg_t     alg,
+                                              hipsparseSolverPrecond_t precond);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Destroy a solver descriptor.
+*
+*  \details
+*  \p hipsparseSolver_destroyDescr destroys a solver descriptor and releases all resources
+*  held by it.
+*
+*  @param[in]
+*  descr       the solver descriptor.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSolver_destroyDescr(hipsparseSolverDescr_t descr);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Set the parameters of a solver.
+*
+*  \details
+*  \p hipsparseSolver_setParameters sets the maximum number of iterations, the tolerance of the
+*  relative residual \f$\|b - A x\|_2 / \|b\|_2\f$ and the restart length of GMRES. An
+*  iteration is one multiplication with \f$A\f$ for CG and GMRES and two for BiCGStab.
+*
+*  \note
+*  Changing the restart length of a GMRES solver discards its analysis.
+*
+*  @param[inout]
+*  descr           the solver descriptor.
+*  @param[in]
+*  maxIterations   maximum number of iterations.
+*  @param[in]
+*  tolerance       tolerance of the relative residual.
+*  @param[in]
+*  restart         number of iterations between restarts of GMRES, ignored by the other
+*                  methods.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr pointer is invalid, \p maxIterations or
+*          \p tolerance is negative or \p restart is not positive.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSolver_setParameters(hipsparseSolverDescr_t descr,
+                                                int                    maxIterations,
+                                                double                 tolerance,
+                                                int                    restart);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Analyse a matrix for a solver.
+*
+*  \details
+*  \p hipsparseSolver_analysis allocates the workspace of the solver and sets up the
+*  preconditioner of \p matA. The Jacobi preconditioner inverts the diagonal of \p matA, the
+*  ILU0 and IC0 preconditioners compute the incomplete factorization of a copy of the values of
+*  \p matA and analyse the triangular solves. The analysis has to be repeated if the values of
+*  \p matA change.
+*
+*  \note
+*  The diagonal positions and the inverse diagonal of the Jacobi preconditioner are computed on
+*  the host from copies of \p matA. This function is blocking with respect to the host.
+*
+*  \note
+*  The ILU0 and IC0 preconditioners require 32 bit indices.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[inout]
+*  descr       the solver descriptor.
+*  @param[in]
+*  matA        square matrix descriptor in CSR format.
+*  @param[in]
+*  computeType floating point precision of the solver, has to match the data type of \p matA.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descr or \p matA pointer is invalid,
+*          \p matA is not square or \p computeType does not match the data type of \p matA.
+*  \retval HIPSPARSE_STATUS_ZERO_PIVOT the diagonal of \p matA or the incomplete factorization
+*          has a zero pivot.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED \p matA is not in CSR format or the index types or
+*          \p computeType are not supported.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSolver_analysis(hipsparseHandle_t          handle,
+                                           hipsparseSolverDescr_t     descr,
+                                           hipsparseConstSpMatDescr_t matA,
+                                           hipDataType                computeType);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Solve a linear system.
+*
+*  \details
+*  \p hipsparseSolver_solve solves \f$A x = b\f$ with the Krylov method and preconditioner of
+*  \p descr, starting from the initial guess in \p vecX. The solution overwrites \p vecX.
+*
+*  All vectors and scalars of the solver stay in device memory. CG and BiCGStab compute their
+*  step lengths in device scalars and read the relative residuals back every four iterations,
+*  such that they may run up to three iterations beyond the tolerance. On a breakdown between
+*  two checks, they restart from the iterate of the last check and check every iteration. GMRES
+*  solves its least squares problem on the host and reads the dot products of every Arnoldi
+*  step back, such that every GMRES iteration waits for a round trip between the device and
+*  the host. The number of iterations, the final relative residual and the relative residual
+*  of every iteration can be queried with \ref hipsparseSolver_getInfo and
+*  \ref hipsparseSolver_getHistory.
+*
+*  A solve that does not converge within the maximum number of iterations, or that stops on a
+*  breakdown of the method, still returns \ref HIPSPARSE_STATUS_SUCCESS with the last iterate
+*  in \p vecX. Check the convergence flag of \ref hipsparseSolver_getInfo.
+*
+*  \note
+*  This function is blocking with respect to the host and cannot be captured into a graph.
+*
+*  @param[in]
+*  handle      handle to the hipsparse library context queue.
+*  @param[inout]
+*  descr       the solver descriptor, analysed for \p matA.
+*  @param[in]
+*  matA        matrix descriptor passed to \ref hipsparseSolver_analysis.
+*  @param[in]
+*  vecB        right hand side.
+*  @param[inout]
+*  vecX        initial guess on input, solution on output.
+*  @param[in]
+*  computeType floating point precision of the solver.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p handle, \p descr, \p matA, \p vecB or \p vecX
+*          pointer is invalid, \p descr has not been analysed for \p matA or the sizes or data
+*          types of the vectors do not match.
+*  \retval HIPSPARSE_STATUS_NOT_SUPPORTED the handle stream is being captured.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSolver_solve(hipsparseHandle_t          handle,
+                                        hipsparseSolverDescr_t     descr,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        hipsparseConstDnVecDescr_t vecB,
+                                        hipsparseDnVecDescr_t      vecX,
+                                        hipDataType                computeType);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Query the convergence of the last solve.
+*
+*  @param[in]
+*  descr       the solver descriptor.
+*  @param[out]
+*  iterations  number of iterations of the last solve.
+*  @param[out]
+*  residual    final relative residual \f$\|b - A x\|_2 / \|b\|_2\f$ of the last solve, as
+*              computed by the method.
+*  @param[out]
+*  converged   1 if the last solve reached the tolerance, 0 otherwise.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr, \p iterations, \p residual or \p converged
+*          pointer is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t hipsparseSolver_getInfo(hipsparseSolverDescr_t descr,
+                                          int*                   iterations,
+                                          double*                residual,
+                                          int*                   converged);
+#endif
+
+/*! \ingroup solvers_module
+*  \brief Query the convergence history of the last solve.
+*
+*  \details
+*  \p hipsparseSolver_getHistory returns the relative residual of the initial guess followed by
+*  the relative residual of every iteration of the last solve. If \p history is a null pointer,
+*  only the number of entries is returned, such that the user can allocate \p history.
+*
+*  @param[in]
+*  descr       the solver descriptor.
+*  @param[out]
+*  historySize number of entries of the history.
+*  @param[out]
+*  history     host array of \p historySize relative residuals, can be a null pointer.
+*
+*  \retval HIPSPARSE_STATUS_SUCCESS the operation completed successfully.
+*  \retval HIPSPARSE_STATUS_INVALID_VALUE \p descr or \p historySize pointer is invalid.
+*/
+#if(!defined(CUDART_VERSION))
+HIPSPARSE_EXPORT
+hipsparseStatus_t
+    hipsparseSolver_getHistory(hipsparseSolverDescr_t descr, int* historySize, double* history);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HIPSPARSE_SOLVER_H */
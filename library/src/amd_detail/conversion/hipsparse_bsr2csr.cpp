@@ -44,6 +44,8 @@ hipsparseStatus_t hipsparseSbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nb, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -74,6 +76,8 @@ hipsparseStatus_t hipsparseDbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nb, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -104,6 +108,8 @@ hipsparseStatus_t hipsparseCbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nb, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
@@ -134,6 +140,8 @@ hipsparseStatus_t hipsparseZbsr2csr(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nb, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zbsr2csr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  mb,
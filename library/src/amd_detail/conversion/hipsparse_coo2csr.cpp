@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseXcoo2csr(hipsparseHandle_t    handle,
                                     int*                 csrRowPtr,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, m, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_coo2csr((rocsparse_handle)handle,
                           cooRowInd,
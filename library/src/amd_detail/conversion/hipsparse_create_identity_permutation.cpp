@@ -32,6 +32,8 @@
 
 hipsparseStatus_t hipsparseCreateIdentityPermutation(hipsparseHandle_t handle, int n, int* p)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, n);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_create_identity_permutation((rocsparse_handle)handle, n, p));
 }
@@ -40,6 +40,8 @@ hipsparseStatus_t hipsparseScsc2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -62,6 +64,8 @@ hipsparseStatus_t hipsparseDcsc2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -84,6 +88,8 @@ hipsparseStatus_t hipsparseCcsc2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -106,6 +112,8 @@ hipsparseStatus_t hipsparseZcsc2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsc2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -38,6 +38,8 @@ hipsparseStatus_t hipsparseXcscsort_bufferSizeExt(hipsparseHandle_t handle,
                                                   const int*        cscRowInd,
                                                   size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort_buffer_size(
         (rocsparse_handle)handle, m, n, nnz, cscColPtr, cscRowInd, pBufferSizeInBytes));
 }
@@ -52,6 +54,8 @@ hipsparseStatus_t hipsparseXcscsort(hipsparseHandle_t         handle,
                                     int*                      P,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cscsort((rocsparse_handle)handle,
                                                                    m,
                                                                    n,
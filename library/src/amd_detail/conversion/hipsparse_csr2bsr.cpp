@@ -42,6 +42,8 @@ hipsparseStatus_t hipsparseXcsr2bsrNnz(hipsparseHandle_t         handle,
                                        int*                      bsrRowPtrC,
                                        int*                      bsrNnzb)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz((rocsparse_handle)handle,
                                                     hipsparse::hipDirectionToHCCDirection(dirA),
                                                     m,
@@ -71,6 +73,8 @@ hipsparseStatus_t hipsparseScsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -101,6 +105,8 @@ hipsparseStatus_t hipsparseDcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -131,6 +137,8 @@ hipsparseStatus_t hipsparseCcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -161,6 +169,8 @@ hipsparseStatus_t hipsparseZcsr2bsr(hipsparseHandle_t         handle,
                                     int*                      bsrRowPtrC,
                                     int*                      bsrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, blockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2bsr((rocsparse_handle)handle,
                                                  hipsparse::hipDirectionToHCCDirection(dirA),
                                                  m,
@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseXcsr2coo(hipsparseHandle_t    handle,
                                     int*                 cooRowInd,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, m, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csr2coo((rocsparse_handle)handle,
                           csrRowPtr,
@@ -43,6 +43,8 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz, copyValues, idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -57,6 +59,7 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
@@ -90,6 +93,7 @@ hipsparseStatus_t hipsparseScsr2csc(hipsparseHandle_t    handle,
     RETURN_IF_HIP_ERROR(hipFree(buffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return status;
@@ -108,6 +112,8 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz, copyValues, idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -122,6 +128,7 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
@@ -155,6 +162,7 @@ hipsparseStatus_t hipsparseDcsr2csc(hipsparseHandle_t    handle,
     RETURN_IF_HIP_ERROR(hipFree(buffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return status;
@@ -173,6 +181,8 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
                                     hipsparseAction_t    copyValues,
                                     hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz, copyValues, idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -187,6 +197,7 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
@@ -220,6 +231,7 @@ hipsparseStatus_t hipsparseCcsr2csc(hipsparseHandle_t    handle,
     RETURN_IF_HIP_ERROR(hipFree(buffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return status;
@@ -238,6 +250,8 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
                                     hipsparseAction_t       copyValues,
                                     hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz, copyValues, idxBase);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(
@@ -252,6 +266,7 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Obtain stream, to explicitly sync (cusparse csr2csc is blocking)
@@ -285,6 +300,7 @@ hipsparseStatus_t hipsparseZcsr2csc(hipsparseHandle_t       handle,
     RETURN_IF_HIP_ERROR(hipFree(buffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return status;
@@ -306,6 +322,8 @@ hipsparseStatus_t hipsparseCsr2cscEx2_bufferSize(hipsparseHandle_t     handle,
                                                  hipsparseCsr2CscAlg_t alg,
                                                  size_t*               pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz, valType, copyValues, idxBase, alg);
+
     switch(valType)
     {
     case HIP_R_32F:
@@ -410,6 +428,8 @@ hipsparseStatus_t hipsparseCsr2cscEx2(hipsparseHandle_t     handle,
                                       hipsparseCsr2CscAlg_t alg,
                                       void*                 buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz, valType, copyValues, idxBase, alg);
+
     switch(valType)
     {
     case HIP_R_32F:
@@ -44,6 +44,8 @@ hipsparseStatus_t hipsparseScsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              float                     tol)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -74,6 +76,8 @@ hipsparseStatus_t hipsparseDcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              double                    tol)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, tol);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -104,6 +108,8 @@ hipsparseStatus_t hipsparseCcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipComplex                tol)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -134,6 +140,8 @@ hipsparseStatus_t hipsparseZcsr2csr_compress(hipsparseHandle_t         handle,
                                              int*                      csrRowPtrC,
                                              hipDoubleComplex          tol)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2csr_compress((rocsparse_handle)handle,
                                     m,
@@ -48,6 +48,8 @@ hipsparseStatus_t hipsparseScsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -123,6 +125,8 @@ hipsparseStatus_t hipsparseDcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -198,6 +202,8 @@ hipsparseStatus_t hipsparseCcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -273,6 +279,8 @@ hipsparseStatus_t hipsparseZcsr2csru(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
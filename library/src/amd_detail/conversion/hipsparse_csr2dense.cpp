@@ -40,6 +40,8 @@ hipsparseStatus_t hipsparseScsr2dense(hipsparseHandle_t         handle,
                                       float*                    A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -62,6 +64,8 @@ hipsparseStatus_t hipsparseDcsr2dense(hipsparseHandle_t         handle,
                                       double*                   A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -84,6 +88,8 @@ hipsparseStatus_t hipsparseCcsr2dense(hipsparseHandle_t         handle,
                                       hipComplex*               A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -106,6 +112,8 @@ hipsparseStatus_t hipsparseZcsr2dense(hipsparseHandle_t         handle,
                                       hipDoubleComplex*         A,
                                       int                       ld)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2dense((rocsparse_handle)handle,
                                                    m,
                                                    n,
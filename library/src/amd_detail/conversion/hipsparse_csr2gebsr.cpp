@@ -42,6 +42,8 @@ hipsparseStatus_t hipsparseScsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_scsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -69,6 +71,8 @@ hipsparseStatus_t hipsparseDcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -96,6 +100,8 @@ hipsparseStatus_t hipsparseCcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_ccsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -123,6 +129,8 @@ hipsparseStatus_t hipsparseZcsr2gebsr_bufferSize(hipsparseHandle_t         handl
                                                  int                       colBlockDim,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zcsr2gebsr_buffer_size((rocsparse_handle)handle,
                                          hipsparse::hipDirectionToHCCDirection(dir),
@@ -152,6 +160,7 @@ hipsparseStatus_t hipsparseXcsr2gebsrNnz(hipsparseHandle_t         handle,
                                          int*                      bsrNnzDevhost,
                                          void*                     pbuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2gebsr_nnz((rocsparse_handle)handle,
                                                       hipsparse::hipDirectionToHCCDirection(dir),
@@ -185,6 +194,8 @@ hipsparseStatus_t hipsparseScsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_scsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -219,6 +230,8 @@ hipsparseStatus_t hipsparseDcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -253,6 +266,8 @@ hipsparseStatus_t hipsparseCcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ccsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
@@ -287,6 +302,8 @@ hipsparseStatus_t hipsparseZcsr2gebsr(hipsparseHandle_t         handle,
                                       int                       colBlockDim,
                                       void*                     pbuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, m, n, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zcsr2gebsr((rocsparse_handle)handle,
                                                    hipsparse::hipDirectionToHCCDirection(dir),
                                                    m,
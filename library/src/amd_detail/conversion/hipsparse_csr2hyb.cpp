@@ -41,6 +41,8 @@ hipsparseStatus_t hipsparseScsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, userEllWidth, partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsr2hyb((rocsparse_handle)handle,
                            m,
@@ -65,6 +67,8 @@ hipsparseStatus_t hipsparseDcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, userEllWidth, partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -89,6 +93,8 @@ hipsparseStatus_t hipsparseCcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, userEllWidth, partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsr2hyb((rocsparse_handle)handle,
                            m,
@@ -113,6 +119,8 @@ hipsparseStatus_t hipsparseZcsr2hyb(hipsparseHandle_t         handle,
                                     int                       userEllWidth,
                                     hipsparseHybPartition_t   partitionType)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, userEllWidth, partitionType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsr2hyb((rocsparse_handle)handle,
                            m,
@@ -81,6 +81,8 @@ hipsparseStatus_t hipsparseScsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -135,6 +137,8 @@ hipsparseStatus_t hipsparseDcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -189,6 +193,8 @@ hipsparseStatus_t hipsparseCcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -243,6 +249,8 @@ hipsparseStatus_t hipsparseZcsru2csr_bufferSizeExt(hipsparseHandle_t handle,
                                                    csru2csrInfo_t    info,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -298,6 +306,8 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -343,6 +353,7 @@ hipsparseStatus_t hipsparseScsru2csr(hipsparseHandle_t         handle,
         // size must be 0
         assert(info->size == 0);
 
+        hipsparse::count_workspace(handle, sizeof(int) * nnz);
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
 
         info->size = nnz;
@@ -381,6 +392,8 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -426,6 +439,7 @@ hipsparseStatus_t hipsparseDcsru2csr(hipsparseHandle_t         handle,
         // size must be 0
         assert(info->size == 0);
 
+        hipsparse::count_workspace(handle, sizeof(int) * nnz);
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
 
         info->size = nnz;
@@ -464,6 +478,8 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -509,6 +525,7 @@ hipsparseStatus_t hipsparseCcsru2csr(hipsparseHandle_t         handle,
         // size must be 0
         assert(info->size == 0);
 
+        hipsparse::count_workspace(handle, sizeof(int) * nnz);
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
 
         info->size = nnz;
@@ -547,6 +564,8 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
                                      csru2csrInfo_t            info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
     // Test for bad args
     if(handle == nullptr)
     {
@@ -592,6 +611,7 @@ hipsparseStatus_t hipsparseZcsru2csr(hipsparseHandle_t         handle,
         // size must be 0
         assert(info->size == 0);
 
+        hipsparse::count_workspace(handle, sizeof(int) * nnz);
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->P, sizeof(int) * nnz));
 
         info->size = nnz;
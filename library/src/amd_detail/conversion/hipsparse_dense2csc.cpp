@@ -41,6 +41,8 @@ hipsparseStatus_t hipsparseSdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -65,6 +67,8 @@ hipsparseStatus_t hipsparseDdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -89,6 +93,8 @@ hipsparseStatus_t hipsparseCdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -113,6 +119,8 @@ hipsparseStatus_t hipsparseZdense2csc(hipsparseHandle_t         handle,
                                       int*                      cscRowInd,
                                       int*                      cscColPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csc((rocsparse_handle)handle,
                                                    m,
                                                    n,
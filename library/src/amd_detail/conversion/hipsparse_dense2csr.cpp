@@ -41,6 +41,8 @@ hipsparseStatus_t hipsparseSdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -65,6 +67,8 @@ hipsparseStatus_t hipsparseDdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_ddense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -89,6 +93,8 @@ hipsparseStatus_t hipsparseCdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -113,6 +119,8 @@ hipsparseStatus_t hipsparseZdense2csr(hipsparseHandle_t         handle,
                                       int*                      csrRowPtr,
                                       int*                      csrColInd)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ld);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zdense2csr((rocsparse_handle)handle,
                                                    m,
                                                    n,
@@ -41,6 +41,8 @@ hipsparseStatus_t hipsparseSgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -65,6 +67,8 @@ hipsparseStatus_t hipsparseDgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc_buffer_size((rocsparse_handle)handle,
                                                                  mb,
                                                                  nb,
@@ -89,6 +93,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsc_bufferSize(hipsparseHandle_t handle,
                                                    int               colBlockDim,
                                                    size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim);
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_cgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -115,6 +120,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsc_bufferSize(hipsparseHandle_t       handl
                                                    int                     colBlockDim,
                                                    size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim);
 
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_zgebsr2gebsc_buffer_size((rocsparse_handle)handle,
@@ -146,6 +152,8 @@ hipsparseStatus_t hipsparseSgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim, copyValues, idx_base);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_sgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
                                                      nb,
@@ -180,6 +188,7 @@ hipsparseStatus_t hipsparseDgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim, copyValues, idx_base);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -215,6 +224,7 @@ hipsparseStatus_t hipsparseCgebsr2gebsc(hipsparseHandle_t    handle,
                                         hipsparseIndexBase_t idx_base,
                                         void*                temp_buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim, copyValues, idx_base);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -250,6 +260,7 @@ hipsparseStatus_t hipsparseZgebsr2gebsc(hipsparseHandle_t       handle,
                                         hipsparseIndexBase_t    idx_base,
                                         void*                   temp_buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, rowBlockDim, colBlockDim, copyValues, idx_base);
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_zgebsr2gebsc((rocsparse_handle)handle,
                                                      mb,
@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -47,6 +49,7 @@ hipsparseStatus_t hipsparseShyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Format conversion
@@ -72,6 +75,8 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -82,6 +87,7 @@ hipsparseStatus_t hipsparseDhyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Format conversion
@@ -107,6 +113,8 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -117,6 +125,7 @@ hipsparseStatus_t hipsparseChyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Format conversion
@@ -142,6 +151,8 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
                                     int*                      csrSortedRowPtrA,
                                     int*                      csrSortedColIndA)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Determine buffer size
     size_t buffer_size = 0;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_hyb2csr_buffer_size((rocsparse_handle)handle,
@@ -152,6 +163,7 @@ hipsparseStatus_t hipsparseZhyb2csr(hipsparseHandle_t         handle,
 
     // Allocate buffer
     void* buffer = nullptr;
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
 
     // Format conversion
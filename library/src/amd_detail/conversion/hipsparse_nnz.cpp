@@ -40,6 +40,8 @@ hipsparseStatus_t hipsparseSnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, lda);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_snnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -62,6 +64,8 @@ hipsparseStatus_t hipsparseDnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, lda);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -84,6 +88,8 @@ hipsparseStatus_t hipsparseCnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, lda);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_cnnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -106,6 +112,8 @@ hipsparseStatus_t hipsparseZnnz(hipsparseHandle_t         handle,
                                 int*                      nnzPerRowColumn,
                                 int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, m, n, lda);
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_znnz((rocsparse_handle)handle,
                                              hipsparse::hipDirectionToHCCDirection(dirA),
                                              m,
@@ -45,6 +45,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -77,6 +79,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSize(hipsparseHandle_t         ha
                                                     const int*                csrColIndC,
                                                     size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -109,6 +113,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -141,6 +147,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csr_bufferSizeExt(hipsparseHandle_t
                                                        const int*                csrColIndC,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_buffer_size((rocsparse_handle)handle,
                                              m,
@@ -172,6 +180,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -202,6 +212,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnz(hipsparseHandle_t         handle,
                                             int*                      nnzTotalDevHostPtr,
                                             void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz((rocsparse_handle)handle,
                                      m,
@@ -233,6 +245,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr((rocsparse_handle)handle,
                                  m,
@@ -265,6 +279,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csr(hipsparseHandle_t         handle,
                                          int*                      csrColIndC,
                                          void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr((rocsparse_handle)handle,
                                  m,
@@ -46,6 +46,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -80,6 +82,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSize(hipsparseHandle_
                                                                 pruneInfo_t info,
                                                                 size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -114,6 +118,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t  info,
                                                                    size_t*      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -148,6 +154,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage_bufferSizeExt(hipsparseHand
                                                                    pruneInfo_t   info,
                                                                    size_t*       pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                            m,
@@ -181,6 +189,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -213,6 +223,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csrNnzByPercentage(hipsparseHandle_t
                                                         pruneInfo_t info,
                                                         void*       buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                    m,
@@ -246,6 +258,8 @@ hipsparseStatus_t hipsparseSpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -280,6 +294,8 @@ hipsparseStatus_t hipsparseDpruneCsr2csrByPercentage(hipsparseHandle_t         h
                                                      pruneInfo_t               info,
                                                      void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, percentage);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dprune_csr2csr_by_percentage((rocsparse_handle)handle,
                                                m,
@@ -43,6 +43,8 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -73,6 +75,8 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage_bufferSize(hipsparseHandl
                                                                   pruneInfo_t info,
                                                                   size_t*     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -104,6 +108,8 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -135,6 +141,8 @@ hipsparseStatus_t
                                                        pruneInfo_t               info,
                                                        size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage_buffer_size((rocsparse_handle)handle,
                                                              m,
@@ -164,6 +172,8 @@ hipsparseStatus_t hipsparseSpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -192,6 +202,8 @@ hipsparseStatus_t hipsparseDpruneDense2csrNnzByPercentage(hipsparseHandle_t
                                                           pruneInfo_t info,
                                                           void*       buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_nnz_by_percentage((rocsparse_handle)handle,
                                                      m,
@@ -221,6 +233,8 @@ hipsparseStatus_t hipsparseSpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_sprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
@@ -251,6 +265,8 @@ hipsparseStatus_t hipsparseDpruneDense2csrByPercentage(hipsparseHandle_t
                                                        pruneInfo_t               info,
                                                        void*                     buffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, lda, percentage);
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_dprune_dense2csr_by_percentage((rocsparse_handle)handle,
                                                  m,
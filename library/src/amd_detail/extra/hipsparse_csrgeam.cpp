@@ -45,6 +45,8 @@ hipsparseStatus_t hipsparseXcsrgeamNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
@@ -82,6 +84,8 @@ hipsparseStatus_t hipsparseScsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
@@ -124,6 +128,8 @@ hipsparseStatus_t hipsparseDcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
@@ -166,6 +172,8 @@ hipsparseStatus_t hipsparseCcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -208,6 +216,8 @@ hipsparseStatus_t hipsparseZcsrgeam(hipsparseHandle_t         handle,
                                     int*                      csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
@@ -251,6 +261,8 @@ hipsparseStatus_t hipsparseScsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -277,6 +289,8 @@ hipsparseStatus_t hipsparseDcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -303,6 +317,8 @@ hipsparseStatus_t hipsparseCcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -329,6 +345,8 @@ hipsparseStatus_t hipsparseZcsrgeam2_bufferSizeExt(hipsparseHandle_t         han
                                                    const int*                csrSortedColIndC,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     *pBufferSizeInBytes = 4;
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -350,6 +368,8 @@ hipsparseStatus_t hipsparseXcsrgeam2Nnz(hipsparseHandle_t         handle,
                                         int*                      nnzTotalDevHostPtr,
                                         void*                     workspace)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csrgeam_nnz((rocsparse_handle)handle,
                               m,
@@ -388,6 +408,8 @@ hipsparseStatus_t hipsparseScsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgeam((rocsparse_handle)handle,
                            m,
@@ -431,6 +453,8 @@ hipsparseStatus_t hipsparseDcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgeam((rocsparse_handle)handle,
                            m,
@@ -474,6 +498,8 @@ hipsparseStatus_t hipsparseCcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgeam((rocsparse_handle)handle,
                            m,
@@ -517,6 +543,8 @@ hipsparseStatus_t hipsparseZcsrgeam2(hipsparseHandle_t         handle,
                                      int*                      csrSortedColIndC,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnzA, nnzB);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgeam((rocsparse_handle)handle,
                            m,
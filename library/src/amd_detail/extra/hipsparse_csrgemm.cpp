@@ -48,6 +48,8 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
                                        int*                      csrRowPtrC,
                                        int*                      nnzTotalDevHostPtr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnzA, nnzB);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -81,7 +83,9 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
     }
     else
     {
+        hipsparse::count_workspace(handle, sizeof(hipDoubleComplex));
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
+        hipsparse::count_synchronization(handle);
         RETURN_IF_HIP_ERROR(
             hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
     }
@@ -127,6 +131,7 @@ hipsparseStatus_t hipsparseXcsrgemmNnz(hipsparseHandle_t         handle,
         return status;
     }
 
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
 
     // Determine nnz
@@ -199,6 +204,8 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnzA, nnzB);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -232,7 +239,9 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
     }
     else
     {
+        hipsparse::count_workspace(handle, sizeof(float));
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(float)));
+        hipsparse::count_synchronization(handle);
         RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(float), hipMemcpyHostToDevice));
     }
 
@@ -277,6 +286,7 @@ hipsparseStatus_t hipsparseScsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
 
     // Perform csrgemm computation
@@ -355,6 +365,8 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnzA, nnzB);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -388,7 +400,9 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
     }
     else
     {
+        hipsparse::count_workspace(handle, sizeof(double));
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(double)));
+        hipsparse::count_synchronization(handle);
         RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(double), hipMemcpyHostToDevice));
     }
 
@@ -433,6 +447,7 @@ hipsparseStatus_t hipsparseDcsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
 
     // Perform csrgemm computation
@@ -511,6 +526,8 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnzA, nnzB);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -544,7 +561,9 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
     }
     else
     {
+        hipsparse::count_workspace(handle, sizeof(hipComplex));
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipComplex)));
+        hipsparse::count_synchronization(handle);
         RETURN_IF_HIP_ERROR(hipMemcpy(alpha, &one, sizeof(hipComplex), hipMemcpyHostToDevice));
     }
 
@@ -589,6 +608,7 @@ hipsparseStatus_t hipsparseCcsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
 
     // Perform csrgemm computation
@@ -667,6 +687,8 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
                                     const int*                csrRowPtrC,
                                     int*                      csrColIndC)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnzA, nnzB);
+
     // Create matrix info
     rocsparse_mat_info info;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info));
@@ -700,7 +722,9 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
     }
     else
     {
+        hipsparse::count_workspace(handle, sizeof(hipDoubleComplex));
         RETURN_IF_HIP_ERROR(hipMalloc((void**)&alpha, sizeof(hipDoubleComplex)));
+        hipsparse::count_synchronization(handle);
         RETURN_IF_HIP_ERROR(
             hipMemcpy(alpha, &one, sizeof(hipDoubleComplex), hipMemcpyHostToDevice));
     }
@@ -746,6 +770,7 @@ hipsparseStatus_t hipsparseZcsrgemm(hipsparseHandle_t         handle,
         return status;
     }
 
+    hipsparse::count_workspace(handle, buffer_size);
     RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
 
     // Perform csrgemm computation
@@ -824,6 +849,8 @@ hipsparseStatus_t hipsparseScsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -870,6 +897,8 @@ hipsparseStatus_t hipsparseDcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -916,6 +945,8 @@ hipsparseStatus_t hipsparseCcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -962,6 +993,8 @@ hipsparseStatus_t hipsparseZcsrgemm2_bufferSizeExt(hipsparseHandle_t         han
                                                    csrgemm2Info_t            info,
                                                    size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm_buffer_size((rocsparse_handle)handle,
                                        rocsparse_operation_none,
@@ -1009,6 +1042,8 @@ hipsparseStatus_t hipsparseXcsrgemm2Nnz(hipsparseHandle_t         handle,
                                         const csrgemm2Info_t      info,
                                         void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csrgemm_nnz((rocsparse_handle)handle,
                                                                        rocsparse_operation_none,
                                                                        rocsparse_operation_none,
@@ -1062,6 +1097,8 @@ hipsparseStatus_t hipsparseScsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scsrgemm((rocsparse_handle)handle,
                                                                     rocsparse_operation_none,
                                                                     rocsparse_operation_none,
@@ -1121,6 +1158,8 @@ hipsparseStatus_t hipsparseDcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dcsrgemm((rocsparse_handle)handle,
                                                                     rocsparse_operation_none,
                                                                     rocsparse_operation_none,
@@ -1180,6 +1219,8 @@ hipsparseStatus_t hipsparseCcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
@@ -1240,6 +1281,8 @@ hipsparseStatus_t hipsparseZcsrgemm2(hipsparseHandle_t         handle,
                                      const csrgemm2Info_t      info,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnzA, nnzB, nnzD);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrgemm((rocsparse_handle)handle,
                            rocsparse_operation_none,
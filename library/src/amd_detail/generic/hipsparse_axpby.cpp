@@ -36,9 +36,11 @@ hipsparseStatus_t hipsparseAxpby(hipsparseHandle_t          handle,
                                  const void*                beta,
                                  hipsparseDnVecDescr_t      vecY)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_axpby((rocsparse_handle)handle,
                                                                  alpha,
                                                                  (rocsparse_const_spvec_descr)vecX,
                                                                  beta,
-                                                                 (rocsparse_dnvec_descr)vecY));
+                                                                 to_rocsparse_dnvec_descr(vecY)));
 }
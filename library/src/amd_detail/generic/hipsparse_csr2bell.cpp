@@ -0,0 +1,280 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace hipsparse
+{
+    //
+    // Sorted block columns of block row br of a CSR matrix with zero based column indices.
+    //
+    static void csr2bellBlockColumns(const host_csr&             A,
+                                     const std::vector<int64_t>& col_ind,
+                                     int64_t                     bs,
+                                     int64_t                     br,
+                                     std::vector<int64_t>&       blocks)
+    {
+        const int64_t begin = A.row_ptr[std::min(br * bs, A.m)];
+        const int64_t end   = A.row_ptr[std::min((br + 1) * bs, A.m)];
+
+        blocks.clear();
+        for(int64_t j = begin; j < end; ++j)
+        {
+            blocks.push_back(col_ind[j] / bs);
+        }
+
+        std::sort(blocks.begin(), blocks.end());
+        blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+    }
+
+    //
+    // Largest number of non-zero blocks in a block row.
+    //
+    static int64_t csr2bellBlocks(const host_csr&             A,
+                                  const std::vector<int64_t>& col_ind,
+                                  int64_t                     bs)
+    {
+        const int64_t mb = (A.m + bs - 1) / bs;
+
+        int64_t              ell_blocks = 0;
+        std::vector<int64_t> blocks;
+        for(int64_t br = 0; br < mb; ++br)
+        {
+            csr2bellBlockColumns(A, col_ind, bs, br, blocks);
+            ell_blocks = std::max(ell_blocks, static_cast<int64_t>(blocks.size()));
+        }
+
+        return ell_blocks;
+    }
+}
+
+hipsparseStatus_t hipsparseCsr2BlockedEllNnz(hipsparseHandle_t          handle,
+                                             hipsparseConstSpMatDescr_t matCsr,
+                                             int64_t*                   ellBlockSize,
+                                             int64_t*                   ellCols,
+                                             int64_t*                   ellFill)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || ellBlockSize == nullptr || ellCols == nullptr
+       || ellFill == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(*ellBlockSize < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    std::vector<int64_t> col_ind;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+        handle, stream, A.col_ind, A.col_type, A.nnz, A.base, col_ind));
+
+    int64_t block_size = *ellBlockSize;
+    int64_t ell_blocks = 0;
+
+    if(block_size > 0)
+    {
+        ell_blocks = hipsparse::csr2bellBlocks(A, col_ind, block_size);
+    }
+    else
+    {
+        //
+        // A block row stores ell_blocks * bs * bs values and ell_blocks block column indices,
+        // the candidate with the fewest bytes is selected. Candidates are visited from the
+        // largest block size down, such that larger blocks win ties.
+        //
+        const int64_t value_size = hipsparse::host_value_type_size(A.value_type);
+        const int64_t index_size = (A.col_type == HIPSPARSE_INDEX_64I) ? 8 : 4;
+
+        int64_t best_bytes = -1;
+        for(int64_t bs = 32; bs >= 1; bs /= 2)
+        {
+            const int64_t blocks = hipsparse::csr2bellBlocks(A, col_ind, bs);
+            const int64_t bytes
+                = (A.m + bs - 1) / bs * blocks * (bs * bs * value_size + index_size);
+
+            if(best_bytes < 0 || bytes < best_bytes)
+            {
+                best_bytes = bytes;
+                block_size = bs;
+                ell_blocks = blocks;
+            }
+        }
+    }
+
+    const int64_t mb = (A.m + block_size - 1) / block_size;
+
+    *ellBlockSize = block_size;
+    *ellCols      = ell_blocks * block_size;
+    *ellFill      = mb * ell_blocks * block_size * block_size - A.nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsr2BlockedEll(hipsparseHandle_t          handle,
+                                          hipsparseConstSpMatDescr_t matCsr,
+                                          hipsparseSpMatDescr_t      matBell)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || matBell == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matBell, &format));
+
+    if(format != HIPSPARSE_FORMAT_BLOCKED_ELL)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              bs;
+    int64_t              ell_cols;
+    void*                bell_col_ind;
+    void*                bell_val;
+    hipsparseIndexType_t index_type;
+    hipsparseIndexBase_t idx_base;
+    hipDataType          value_type;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseBlockedEllGet(matBell,
+                                                     &rows,
+                                                     &cols,
+                                                     &bs,
+                                                     &ell_cols,
+                                                     &bell_col_ind,
+                                                     &bell_val,
+                                                     &index_type,
+                                                     &idx_base,
+                                                     &value_type));
+
+    if(bs <= 0 || ell_cols < 0 || ell_cols % bs != 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    if(A.value_type != value_type)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+    if(value_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(A.m != rows || A.n != cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<int64_t> csr_col_ind;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+        handle, stream, A.col_ind, A.col_type, A.nnz, A.base, csr_col_ind));
+
+    std::vector<char> csr_val(value_size * A.nnz);
+    if(A.nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_val.data(), A.val, value_size * A.nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+
+    //
+    // Block k of block row br is stored column by column at (br * ell_blocks + k) * bs * bs.
+    // Padded blocks get the block column index -1 and zero values, the block column indices are
+    // written zero based and shifted by the index base of the Blocked-ELL matrix, except for the
+    // padding.
+    //
+    const int64_t mb         = (A.m + bs - 1) / bs;
+    const int64_t ell_blocks = ell_cols / bs;
+
+    std::vector<int64_t> bell_ind(mb * ell_blocks, -1 - idx_base);
+    std::vector<char>    bell_values(value_size * mb * ell_blocks * bs * bs, 0);
+
+    std::vector<int64_t> blocks;
+    for(int64_t br = 0; br < mb; ++br)
+    {
+        hipsparse::csr2bellBlockColumns(A, csr_col_ind, bs, br, blocks);
+
+        if(static_cast<int64_t>(blocks.size()) > ell_blocks)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        std::copy(blocks.begin(), blocks.end(), &bell_ind[br * ell_blocks]);
+
+        for(int64_t i = br * bs; i < std::min((br + 1) * bs, A.m); ++i)
+        {
+            for(int64_t j = A.row_ptr[i]; j < A.row_ptr[i + 1]; ++j)
+            {
+                const int64_t col = csr_col_ind[j];
+                const int64_t k
+                    = std::lower_bound(blocks.begin(), blocks.end(), col / bs) - blocks.begin();
+                const int64_t idx = ((br * ell_blocks + k) * bs + col % bs) * bs + i % bs;
+
+                std::memcpy(&bell_values[value_size * idx], &csr_val[value_size * j], value_size);
+            }
+        }
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+        handle, stream, bell_ind, idx_base, index_type, bell_col_ind));
+
+    if(!bell_values.empty())
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            bell_val, bell_values.data(), bell_values.size(), hipMemcpyHostToDevice, stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
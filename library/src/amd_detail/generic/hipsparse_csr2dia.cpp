@@ -0,0 +1,245 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace hipsparse
+{
+    //
+    // Offsets j - i of the diagonals that hold at least one entry of A, in increasing order.
+    // diagonal[j - i + m - 1] is the position of the diagonal in the offsets, or -1.
+    //
+    static hipsparseStatus_t csr2diaDiagonals(hipsparseHandle_t     handle,
+                                              hipStream_t           stream,
+                                              const host_csr&       A,
+                                              std::vector<int64_t>& col_ind,
+                                              std::vector<int64_t>& offsets,
+                                              std::vector<int64_t>& diagonal)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, A.col_ind, A.col_type, A.nnz, A.base, col_ind));
+
+        diagonal.assign(std::max(A.m + A.n - 1, int64_t(0)), -1);
+
+        for(int64_t i = 0; i < A.m; ++i)
+        {
+            for(int64_t j = A.row_ptr[i]; j < A.row_ptr[i + 1]; ++j)
+            {
+                if(col_ind[j] < 0 || col_ind[j] >= A.n)
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                diagonal[col_ind[j] - i + A.m - 1] = 0;
+            }
+        }
+
+        offsets.clear();
+        for(int64_t k = 0; k < static_cast<int64_t>(diagonal.size()); ++k)
+        {
+            if(diagonal[k] == 0)
+            {
+                diagonal[k] = static_cast<int64_t>(offsets.size());
+                offsets.push_back(k - (A.m - 1));
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseCsr2DiaNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matCsr,
+                                      int64_t*                   diaNumDiagonals,
+                                      int64_t*                   diaFill)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || diaNumDiagonals == nullptr || diaFill == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    std::vector<int64_t> col_ind;
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> diagonal;
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::csr2diaDiagonals(handle, stream, A, col_ind, offsets, diagonal));
+
+    *diaNumDiagonals = static_cast<int64_t>(offsets.size());
+    *diaFill         = *diaNumDiagonals * A.m - A.nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsr2Dia(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matCsr,
+                                   hipsparseSpMatDescr_t      matDia)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || matDia == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::host_spmat* dia = matDia->get_host_spmat();
+    if(dia == nullptr || dia->format != HIPSPARSE_FORMAT_DIA)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    if(A.value_type != dia->value_type)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+    if(value_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(A.m != dia->rows || A.n != dia->cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<int64_t> col_ind;
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> diagonal;
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::csr2diaDiagonals(handle, stream, A, col_ind, offsets, diagonal));
+
+    if(static_cast<int64_t>(offsets.size()) != dia->width)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<char> csr_val(value_size * A.nnz);
+    if(A.nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_val.data(), A.val, value_size * A.nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+
+    //
+    // Positions of a diagonal that hold no entry, including those outside of the matrix, are
+    // padded with zeros.
+    //
+    std::vector<char> dia_val(value_size * dia->values_size, 0);
+
+    for(int64_t i = 0; i < A.m; ++i)
+    {
+        for(int64_t j = A.row_ptr[i]; j < A.row_ptr[i + 1]; ++j)
+        {
+            const int64_t idx = diagonal[col_ind[j] - i + A.m - 1] * A.m + i;
+            std::memcpy(&dia_val[value_size * idx], &csr_val[value_size * j], value_size);
+        }
+    }
+
+    // The offsets are not shifted by the index base.
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+        handle, stream, offsets, 0, dia->index_type, dia->dia_offsets));
+
+    if(dia->values_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dia->values,
+                                           dia_val.data(),
+                                           value_size * dia->values_size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    // The arrays were rewritten in place, the device copy of the matrix is stale.
+    matDia->structure_changed();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDia2CsrNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matDia,
+                                      void*                      csrRowOffsets,
+                                      int64_t*                   csrNnz)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matDia == nullptr || csrRowOffsets == nullptr || csrNnz == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::host_spmat* dia = matDia->get_host_spmat();
+    if(dia == nullptr || dia->format != HIPSPARSE_FORMAT_DIA)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::host_spmat_csr_nnz(handle, *dia, true, csrRowOffsets, csrNnz);
+}
+
+hipsparseStatus_t hipsparseDia2Csr(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matDia,
+                                   hipsparseSpMatDescr_t      matCsr)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matDia == nullptr || matCsr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::host_spmat* dia = matDia->get_host_spmat();
+    if(dia == nullptr || dia->format != HIPSPARSE_FORMAT_DIA)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::host_spmat_to_csr(handle, *dia, true, matCsr);
+}
@@ -0,0 +1,218 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+hipsparseStatus_t hipsparseCsr2EllNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matCsr,
+                                      int64_t*                   ellWidth,
+                                      int64_t*                   ellFill)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || ellWidth == nullptr || ellFill == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    int64_t width = 0;
+    for(int64_t i = 0; i < A.m; ++i)
+    {
+        width = std::max(width, A.row_ptr[i + 1] - A.row_ptr[i]);
+    }
+
+    *ellWidth = width;
+    *ellFill  = width * A.m - A.nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsr2Ell(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matCsr,
+                                   hipsparseSpMatDescr_t      matEll)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || matEll == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matEll, &format));
+
+    if(format != HIPSPARSE_FORMAT_ELL)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparse::host_spmat ell;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::get_ell_host_spmat(matEll, ell));
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    if(A.value_type != ell.value_type)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+    if(value_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(A.m != ell.rows || A.n != ell.cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    for(int64_t i = 0; i < A.m; ++i)
+    {
+        if(A.row_ptr[i + 1] - A.row_ptr[i] > ell.width)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+    }
+
+    std::vector<int64_t> csr_col_ind;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+        handle, stream, A.col_ind, A.col_type, A.nnz, A.base, csr_col_ind));
+
+    std::vector<char> csr_val(value_size * A.nnz);
+    if(A.nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_val.data(), A.val, value_size * A.nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+
+    //
+    // Padded entries get the column index -1 and a zero value. The column indices are written
+    // zero based and shifted by the index base of the ELL matrix, except for the padding.
+    //
+    std::vector<int64_t> ell_col_ind(ell.values_size, -1 - ell.idx_base);
+    std::vector<char>    ell_val(value_size * ell.values_size, 0);
+
+    for(int64_t i = 0; i < A.m; ++i)
+    {
+        for(int64_t j = A.row_ptr[i]; j < A.row_ptr[i + 1]; ++j)
+        {
+            const int64_t idx = (j - A.row_ptr[i]) * A.m + i;
+
+            ell_col_ind[idx] = csr_col_ind[j];
+            std::memcpy(&ell_val[value_size * idx], &csr_val[value_size * j], value_size);
+        }
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+        handle, stream, ell_col_ind, ell.idx_base, ell.index_type, ell.col_ind));
+
+    if(ell.values_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(ell.values,
+                                           ell_val.data(),
+                                           value_size * ell.values_size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    // The arrays were rewritten in place, the device copy of the matrix is stale.
+    matEll->structure_changed();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseEll2CsrNnz(hipsparseHandle_t          handle,
+                                      hipsparseConstSpMatDescr_t matEll,
+                                      void*                      csrRowOffsets,
+                                      int64_t*                   csrNnz)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matEll == nullptr || csrRowOffsets == nullptr || csrNnz == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matEll, &format));
+
+    if(format != HIPSPARSE_FORMAT_ELL)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparse::host_spmat ell;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::get_ell_host_spmat(matEll, ell));
+
+    return hipsparse::host_spmat_csr_nnz(handle, ell, false, csrRowOffsets, csrNnz);
+}
+
+hipsparseStatus_t hipsparseEll2Csr(hipsparseHandle_t          handle,
+                                   hipsparseConstSpMatDescr_t matEll,
+                                   hipsparseSpMatDescr_t      matCsr)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matEll == nullptr || matCsr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matEll, &format));
+
+    if(format != HIPSPARSE_FORMAT_ELL)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparse::host_spmat ell;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::get_ell_host_spmat(matEll, ell));
+
+    return hipsparse::host_spmat_to_csr(handle, ell, false, matCsr);
+}
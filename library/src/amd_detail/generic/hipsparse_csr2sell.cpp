@@ -0,0 +1,270 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace hipsparse
+{
+    //
+    // Sort the rows by decreasing length within windows of sigma rows, such that rows of
+    // similar length share a slice, and compute the offset of each slice padded to its
+    // longest row.
+    //
+    static void csr2sellSlices(const std::vector<int64_t>& row_ptr,
+                               int64_t                     m,
+                               int64_t                     slice_size,
+                               int64_t                     sigma,
+                               std::vector<int64_t>&       row_perm,
+                               std::vector<int64_t>&       slice_offsets)
+    {
+        const auto row_length = [&](int64_t i) { return row_ptr[i + 1] - row_ptr[i]; };
+
+        row_perm.resize(m);
+        std::iota(row_perm.begin(), row_perm.end(), 0);
+
+        if(sigma > 1)
+        {
+            for(int64_t w = 0; w < m; w += sigma)
+            {
+                std::stable_sort(
+                    row_perm.begin() + w,
+                    row_perm.begin() + std::min(w + sigma, m),
+                    [&](int64_t a, int64_t b) { return row_length(a) > row_length(b); });
+            }
+        }
+
+        const int64_t slices = (m + slice_size - 1) / slice_size;
+
+        slice_offsets.resize(slices + 1);
+        slice_offsets[0] = 0;
+
+        for(int64_t s = 0; s < slices; ++s)
+        {
+            int64_t width = 0;
+            for(int64_t p = s * slice_size; p < std::min((s + 1) * slice_size, m); ++p)
+            {
+                width = std::max(width, row_length(row_perm[p]));
+            }
+
+            slice_offsets[s + 1] = slice_offsets[s] + slice_size * width;
+        }
+    }
+}
+
+hipsparseStatus_t hipsparseCsr2SellNnz(hipsparseHandle_t          handle,
+                                       hipsparseConstSpMatDescr_t matCsr,
+                                       int64_t                    sliceSize,
+                                       int64_t                    sigma,
+                                       void*                      sellSliceOffsets,
+                                       void*                      sellRowPerm,
+                                       int64_t*                   sellValuesSize)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, sliceSize, sigma);
+
+    if(handle == nullptr || matCsr == nullptr || sellSliceOffsets == nullptr
+       || sellValuesSize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(sliceSize <= 0 || sigma <= 0 || (sigma > 1 && sellRowPerm == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    std::vector<int64_t> row_perm;
+    std::vector<int64_t> slice_offsets;
+    hipsparse::csr2sellSlices(A.row_ptr, A.m, sliceSize, sigma, row_perm, slice_offsets);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+        handle, stream, slice_offsets, 0, A.col_type, sellSliceOffsets));
+
+    if(sellRowPerm != nullptr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+            handle, stream, row_perm, A.base, A.col_type, sellRowPerm));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    *sellValuesSize = slice_offsets.back();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCsr2Sell(hipsparseHandle_t          handle,
+                                    hipsparseConstSpMatDescr_t matCsr,
+                                    hipsparseSpMatDescr_t      matSell)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matCsr == nullptr || matSell == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::host_spmat* sell = matSell->get_host_spmat();
+    if(sell == nullptr || sell->format != HIPSPARSE_FORMAT_SELL)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    hipsparse::host_csr A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_csr_to_host(handle, stream, matCsr, A));
+
+    if(A.value_type != sell->value_type)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+    if(value_size == 0)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(A.m != sell->rows || A.n != sell->cols || A.nnz != sell->nnz
+       || A.col_type != sell->index_type || A.base != sell->idx_base)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const int64_t C      = sell->slice_size;
+    const int64_t slices = (A.m + C - 1) / C;
+
+    std::vector<int64_t> slice_offsets;
+    std::vector<int64_t> row_perm;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+        handle, stream, sell->slice_offsets, sell->index_type, slices + 1, 0, slice_offsets));
+
+    if(sell->row_perm != nullptr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, sell->row_perm, sell->index_type, A.m, sell->idx_base, row_perm));
+    }
+    else
+    {
+        row_perm.resize(A.m);
+        std::iota(row_perm.begin(), row_perm.end(), 0);
+    }
+
+    //
+    // The slice structure has to hold every row, otherwise it was not computed for this matrix.
+    //
+    if(slice_offsets[0] != 0 || slice_offsets[slices] != sell->values_size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    for(int64_t s = 0; s < slices; ++s)
+    {
+        const int64_t size = slice_offsets[s + 1] - slice_offsets[s];
+        if(size < 0 || size % C != 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        for(int64_t p = s * C; p < std::min((s + 1) * C, A.m); ++p)
+        {
+            const int64_t i = row_perm[p];
+            if(i < 0 || i >= A.m || A.row_ptr[i + 1] - A.row_ptr[i] > size / C)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+        }
+    }
+
+    std::vector<int64_t> csr_col_ind;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+        handle, stream, A.col_ind, A.col_type, A.nnz, 0, csr_col_ind));
+
+    std::vector<char> csr_val(value_size * A.nnz);
+    if(A.nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_val.data(), A.val, value_size * A.nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+
+    //
+    // Padded entries keep the column index -1 and a zero value. The column indices keep the
+    // index base of the CSR matrix, they are copied back without shifting.
+    //
+    std::vector<int64_t> sell_col_ind(sell->values_size, -1);
+    std::vector<char>    sell_val(value_size * sell->values_size, 0);
+
+    for(int64_t s = 0; s < slices; ++s)
+    {
+        for(int64_t p = s * C; p < std::min((s + 1) * C, A.m); ++p)
+        {
+            const int64_t i = row_perm[p];
+
+            for(int64_t j = A.row_ptr[i]; j < A.row_ptr[i + 1]; ++j)
+            {
+                const int64_t idx = slice_offsets[s] + (j - A.row_ptr[i]) * C + (p - s * C);
+
+                sell_col_ind[idx] = csr_col_ind[j];
+                std::memcpy(&sell_val[value_size * idx], &csr_val[value_size * j], value_size);
+            }
+        }
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+        handle, stream, sell_col_ind, 0, sell->index_type, sell->col_ind));
+
+    if(sell->values_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(sell->values,
+                                           sell_val.data(),
+                                           value_size * sell->values_size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    // The arrays were rewritten in place, the device copy of the matrix is stale.
+    matSell->structure_changed();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
@@ -34,6 +34,10 @@ hipsparseStatus_t hipsparseGather(hipsparseHandle_t          handle,
                                   hipsparseConstDnVecDescr_t vecY,
                                   hipsparseSpVecDescr_t      vecX)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_gather(
-        (rocsparse_handle)handle, (rocsparse_const_dnvec_descr)vecY, (rocsparse_spvec_descr)vecX));
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_gather((rocsparse_handle)handle,
+                         to_rocsparse_const_dnvec_descr(vecY),
+                         (rocsparse_spvec_descr)vecX));
 }
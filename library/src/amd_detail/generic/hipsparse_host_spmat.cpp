@@ -0,0 +1,828 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../hipsparse_graph.h"
+#include "../utility.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+//
+// SpMM with general ELL matrices, which rocsparse_spmm does not accept. The stored entries are
+// expanded into coordinates on the host once per structure version and uploaded as a CSR matrix,
+// the products gather the values into it and run on rocSPARSE. The conversions of the formats
+// rocSPARSE does not support into CSR expand the entries the same way.
+//
+namespace hipsparse
+{
+    //
+    // Zero based coordinates of the stored entries of a sparse matrix. pos is the position of
+    // the entry in the values array of the matrix.
+    //
+    struct host_spmat_entries
+    {
+        std::vector<int64_t> row{};
+        std::vector<int64_t> col{};
+        std::vector<int64_t> pos{};
+    };
+
+    static hipsparseStatus_t hostSpMatExpandEll(hipsparseHandle_t   handle,
+                                                hipStream_t         stream,
+                                                const host_spmat&   A,
+                                                host_spmat_entries& E)
+    {
+        std::vector<int64_t> col_ind;
+
+        // Keep the index base, such that the padding can be told apart from column 0.
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, A.col_ind, A.index_type, A.values_size, 0, col_ind));
+
+        E.row.reserve(A.values_size);
+        E.col.reserve(A.values_size);
+        E.pos.reserve(A.values_size);
+
+        for(int64_t idx = 0; idx < A.values_size; ++idx)
+        {
+            if(col_ind[idx] == -1)
+            {
+                continue;
+            }
+
+            const int64_t i = idx % A.rows;
+            const int64_t j = col_ind[idx] - A.idx_base;
+
+            if(j < 0 || j >= A.cols)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            E.row.push_back(i);
+            E.col.push_back(j);
+            E.pos.push_back(idx);
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t hostSpMatExpandDia(hipsparseHandle_t   handle,
+                                                hipStream_t         stream,
+                                                const host_spmat&   A,
+                                                host_spmat_entries& E)
+    {
+        std::vector<int64_t> offsets;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, A.dia_offsets, A.index_type, A.width, 0, offsets));
+
+        E.row.reserve(A.values_size);
+        E.col.reserve(A.values_size);
+        E.pos.reserve(A.values_size);
+
+        for(int64_t d = 0; d < A.width; ++d)
+        {
+            // Only the rows whose column on the diagonal is inside of the matrix are stored.
+            const int64_t begin = std::max(int64_t(0), -offsets[d]);
+            const int64_t end   = std::min(A.rows, A.cols - offsets[d]);
+
+            for(int64_t i = begin; i < end; ++i)
+            {
+                E.row.push_back(i);
+                E.col.push_back(i + offsets[d]);
+                E.pos.push_back(d * A.rows + i);
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t hostSpMatExpand(hipsparseHandle_t   handle,
+                                             hipStream_t         stream,
+                                             const host_spmat&   A,
+                                             host_spmat_entries& E)
+    {
+        switch(A.format)
+        {
+        case HIPSPARSE_FORMAT_ELL:
+        {
+            return hostSpMatExpandEll(handle, stream, A, E);
+        }
+        case HIPSPARSE_FORMAT_DIA:
+        {
+            return hostSpMatExpandDia(handle, stream, A, E);
+        }
+        default:
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        }
+    }
+
+    template <typename T>
+    static hipsparseStatus_t hostSpMatCopyToHost(hipsparseHandle_t handle,
+                                                 hipStream_t       stream,
+                                                 const void*       source,
+                                                 int64_t           size,
+                                                 std::vector<T>&   host)
+    {
+        host.resize(size);
+        if(size > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                host.data(), source, sizeof(T) * size, hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    static bool hostSpMatIsZero(const char* value)
+    {
+        T v;
+        std::memcpy(&v, value, sizeof(T));
+        return v == static_cast<T>(0);
+    }
+
+    static bool hostSpMatIsZero(const char* value, hipDataType valueType)
+    {
+        switch(valueType)
+        {
+        case HIP_R_32F:
+        {
+            return hostSpMatIsZero<float>(value);
+        }
+        case HIP_R_64F:
+        {
+            return hostSpMatIsZero<double>(value);
+        }
+        case HIP_C_32F:
+        {
+            return hostSpMatIsZero<std::complex<float>>(value);
+        }
+        case HIP_C_64F:
+        {
+            return hostSpMatIsZero<std::complex<double>>(value);
+        }
+        default:
+        {
+            return false;
+        }
+        }
+    }
+
+    //
+    // Zero based CSR matrix on the host holding the stored entries of A, with the columns of
+    // each row sorted.
+    //
+    static hipsparseStatus_t hostSpMatToCsr(hipsparseHandle_t     handle,
+                                            hipStream_t           stream,
+                                            const host_spmat&     A,
+                                            bool                  drop_zeros,
+                                            std::vector<int64_t>& row_ptr,
+                                            std::vector<int64_t>& col_ind,
+                                            std::vector<char>&    val)
+    {
+        const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+        if(value_size == 0)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        host_spmat_entries E;
+        RETURN_IF_HIPSPARSE_ERROR(hostSpMatExpand(handle, stream, A, E));
+
+        std::vector<char> host_val;
+        RETURN_IF_HIPSPARSE_ERROR(
+            hostSpMatCopyToHost(handle, stream, A.values, value_size * A.values_size, host_val));
+
+        std::vector<size_t> order;
+        order.reserve(E.pos.size());
+        for(size_t k = 0; k < E.pos.size(); ++k)
+        {
+            if(!drop_zeros || !hostSpMatIsZero(&host_val[value_size * E.pos[k]], A.value_type))
+            {
+                order.push_back(k);
+            }
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return (E.row[a] != E.row[b]) ? E.row[a] < E.row[b] : E.col[a] < E.col[b];
+        });
+
+        row_ptr.assign(A.rows + 1, 0);
+        col_ind.resize(order.size());
+        val.resize(value_size * order.size());
+
+        for(size_t n = 0; n < order.size(); ++n)
+        {
+            const size_t k = order[n];
+
+            ++row_ptr[E.row[k] + 1];
+            col_ind[n] = E.col[k];
+            std::memcpy(&val[value_size * n], &host_val[value_size * E.pos[k]], value_size);
+        }
+
+        std::partial_sum(row_ptr.begin(), row_ptr.end(), row_ptr.begin());
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t deviceSpMatMalloc(hipsparseHandle_t handle, void** ptr, size_t bytes)
+    {
+        hipsparse::count_workspace(handle, bytes);
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, std::max(bytes, sizeof(int64_t))));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Upload the entries E of A into csr as a zero based CSR matrix with sorted columns.
+    //
+    static hipsparseStatus_t deviceSpMatUpload(hipsparseHandle_t         handle,
+                                               hipStream_t               stream,
+                                               const host_spmat&         A,
+                                               const host_spmat_entries& E,
+                                               device_csr&               csr)
+    {
+        const int64_t nnz = static_cast<int64_t>(E.pos.size());
+
+        std::vector<size_t> order(nnz);
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return (E.row[a] != E.row[b]) ? E.row[a] < E.row[b] : E.col[a] < E.col[b];
+        });
+
+        std::vector<int64_t> row_ptr(A.rows + 1, 0);
+        std::vector<int64_t> col_ind(nnz);
+        std::vector<int64_t> map(nnz);
+
+        for(int64_t n = 0; n < nnz; ++n)
+        {
+            const size_t k = order[n];
+
+            ++row_ptr[E.row[k] + 1];
+            col_ind[n] = E.col[k];
+            map[n]     = E.pos[k];
+        }
+
+        std::partial_sum(row_ptr.begin(), row_ptr.end(), row_ptr.begin());
+
+        // 32 bit indices, unless the dimensions or the values array of A do not fit.
+        const int64_t              largest    = std::max({A.rows, A.cols, A.values_size, nnz});
+        const hipsparseIndexType_t index_type = (largest < std::numeric_limits<int32_t>::max())
+                                                    ? HIPSPARSE_INDEX_32I
+                                                    : HIPSPARSE_INDEX_64I;
+        const size_t index_size
+            = (index_type == HIPSPARSE_INDEX_32I) ? sizeof(int32_t) : sizeof(int64_t);
+        const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+
+        csr.nnz = nnz;
+        RETURN_IF_HIPSPARSE_ERROR(
+            deviceSpMatMalloc(handle, &csr.row_ptr, index_size * (A.rows + 1)));
+        RETURN_IF_HIPSPARSE_ERROR(deviceSpMatMalloc(handle, &csr.col_ind, index_size * nnz));
+        RETURN_IF_HIPSPARSE_ERROR(deviceSpMatMalloc(handle, &csr.map, index_size * nnz));
+        RETURN_IF_HIPSPARSE_ERROR(deviceSpMatMalloc(handle, &csr.val, value_size * nnz));
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::copy_indices_to_device(handle, stream, row_ptr, 0, index_type, csr.row_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::copy_indices_to_device(handle, stream, col_ind, 0, index_type, csr.col_ind));
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::copy_indices_to_device(handle, stream, map, 0, index_type, csr.map));
+
+        const rocsparse_indextype indextype = hipsparse::hipIndexTypeToHCCIndexType(index_type);
+        const rocsparse_datatype  datatype  = hipsparse::hipDataTypeToHCCDataType(A.value_type);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr_descr(&csr.mat,
+                                                             A.rows,
+                                                             A.cols,
+                                                             nnz,
+                                                             csr.row_ptr,
+                                                             csr.col_ind,
+                                                             csr.val,
+                                                             indextype,
+                                                             indextype,
+                                                             rocsparse_index_base_zero,
+                                                             datatype));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_spvec_descr(&csr.gather,
+                                                               A.values_size,
+                                                               nnz,
+                                                               csr.map,
+                                                               csr.val,
+                                                               indextype,
+                                                               rocsparse_index_base_zero,
+                                                               datatype));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t
+        deviceSpMatBuild(hipsparseHandle_t handle, const host_spmat& A, device_spmat& D)
+    {
+        if(hipsparse::host_value_type_size(A.value_type) == 0)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        host_spmat_entries E;
+        RETURN_IF_HIPSPARSE_ERROR(hostSpMatExpand(handle, stream, A, E));
+        RETURN_IF_HIPSPARSE_ERROR(deviceSpMatUpload(handle, stream, A, E, D.csr));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_dnvec_descr(
+            &D.values, A.values_size, A.values, hipsparse::hipDataTypeToHCCDataType(A.value_type)));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Device copy of the matrix of descr if it is valid for the current structure version, null
+    // otherwise.
+    //
+    static device_spmat* deviceSpMatCurrent(hipsparseConstSpMatDescr_t descr)
+    {
+        device_spmat* D = descr->get_device_spmat();
+
+        return (D != nullptr && D->structure_version == descr->get_structure_version()) ? D
+                                                                                        : nullptr;
+    }
+
+    static hipsparseStatus_t deviceSpMatGet(hipsparseHandle_t          handle,
+                                            hipsparseConstSpMatDescr_t descr,
+                                            const host_spmat&          A,
+                                            device_spmat**             D)
+    {
+        *D = deviceSpMatCurrent(descr);
+        if(*D != nullptr)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        std::unique_ptr<device_spmat> copy(new device_spmat);
+        RETURN_IF_HIPSPARSE_ERROR(deviceSpMatBuild(handle, A, *copy));
+        copy->structure_version = descr->get_structure_version();
+
+        descr->set_device_spmat(std::move(copy));
+        *D = descr->get_device_spmat();
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t
+        deviceSpMatReserve(hipsparseHandle_t handle, device_spmat& D, size_t bytes)
+    {
+        if(bytes <= D.buffer_size)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // hipFree waits for the device to release the previous buffer.
+        RETURN_IF_HIP_ERROR(hipFree(D.buffer));
+        D.buffer      = nullptr;
+        D.buffer_size = 0;
+
+        RETURN_IF_HIPSPARSE_ERROR(deviceSpMatMalloc(handle, &D.buffer, bytes));
+        D.buffer_size = bytes;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static uint32_t deviceSpMatSpMMBit(hipsparseOperation_t opA, hipsparseOperation_t opB)
+    {
+        return uint32_t(1) << (3 * opA + opB);
+    }
+
+    static hipsparseStatus_t deviceSpMatSpMM(hipsparseHandle_t           handle,
+                                             device_spmat&               D,
+                                             hipsparseOperation_t        opA,
+                                             hipsparseOperation_t        opB,
+                                             const void*                 alpha,
+                                             rocsparse_const_dnmat_descr B,
+                                             const void*                 beta,
+                                             rocsparse_dnmat_descr       C,
+                                             rocsparse_datatype          datatype,
+                                             rocsparse_spmm_stage        stage,
+                                             size_t*                     buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spmm((rocsparse_handle)handle,
+                           hipsparse::hipOperationToHCCOperation(opA),
+                           hipsparse::hipOperationToHCCOperation(opB),
+                           alpha,
+                           D.csr.mat,
+                           B,
+                           beta,
+                           C,
+                           datatype,
+                           rocsparse_spmm_alg_default,
+                           stage,
+                           buffer_size,
+                           (stage == rocsparse_spmm_stage_buffer_size) ? nullptr : D.buffer));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparse::device_spmat::~device_spmat()
+{
+    if(this->csr.mat != nullptr)
+    {
+        (void)rocsparse_destroy_spmat_descr(this->csr.mat);
+    }
+    if(this->csr.gather != nullptr)
+    {
+        (void)rocsparse_destroy_spvec_descr(this->csr.gather);
+    }
+    (void)hipFree(this->csr.row_ptr);
+    (void)hipFree(this->csr.col_ind);
+    (void)hipFree(this->csr.val);
+    (void)hipFree(this->csr.map);
+
+    if(this->values != nullptr)
+    {
+        (void)rocsparse_destroy_dnvec_descr(this->values);
+    }
+    (void)hipFree(this->buffer);
+}
+
+hipsparseStatus_t hipsparse::host_spmat_prepare(hipsparseHandle_t          handle,
+                                                hipsparseConstSpMatDescr_t descr,
+                                                const host_spmat&          matA)
+{
+    if(deviceSpMatCurrent(descr) != nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparse::stream_capture_bypass setup_bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+    device_spmat* D;
+    RETURN_IF_HIPSPARSE_ERROR(deviceSpMatGet(handle, descr, matA, &D));
+
+    return setup_bypass.finish();
+}
+
+hipsparseStatus_t hipsparse::host_spmat_spmm(hipsparseHandle_t          handle,
+                                             hipsparseOperation_t       opA,
+                                             hipsparseOperation_t       opB,
+                                             const void*                alpha,
+                                             hipsparseConstSpMatDescr_t descr,
+                                             const host_spmat&          matA,
+                                             hipsparseConstDnMatDescr_t matB,
+                                             const void*                beta,
+                                             hipsparseDnMatDescr_t      matC,
+                                             hipDataType                computeType)
+{
+    int     batch_count_B;
+    int     batch_count_C;
+    int64_t batch_stride;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnMatGetStridedBatch(matB, &batch_count_B, &batch_stride));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnMatGetStridedBatch(matC, &batch_count_C, &batch_stride));
+
+    if(batch_count_B > 1 || batch_count_C > 1 || matA.value_type != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t          rows_B;
+    int64_t          cols_B;
+    int64_t          ld_B;
+    int64_t          rows_C;
+    int64_t          cols_C;
+    int64_t          ld_C;
+    const void*      val_B;
+    void*            val_C;
+    hipDataType      type_B;
+    hipDataType      type_C;
+    hipsparseOrder_t order_B;
+    hipsparseOrder_t order_C;
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseConstDnMatGet(matB, &rows_B, &cols_B, &ld_B, &val_B, &type_B, &order_B));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseDnMatGet(matC, &rows_C, &cols_C, &ld_C, &val_C, &type_C, &order_C));
+
+    if(type_B != computeType || type_C != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const bool    trans_A = (opA != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+    const bool    trans_B = (opB != HIPSPARSE_OPERATION_NON_TRANSPOSE);
+    const int64_t rows_A  = trans_A ? matA.cols : matA.rows;
+    const int64_t cols_A  = trans_A ? matA.rows : matA.cols;
+
+    if(rows_A != rows_C || cols_A != (trans_B ? cols_B : rows_B)
+       || (trans_B ? rows_B : cols_B) != cols_C)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const rocsparse_datatype    datatype = hipsparse::hipDataTypeToHCCDataType(computeType);
+    rocsparse_const_dnmat_descr dnmat_B  = (rocsparse_const_dnmat_descr)matB;
+    rocsparse_dnmat_descr       dnmat_C  = (rocsparse_dnmat_descr)matC;
+    const uint32_t              bit      = hipsparse::deviceSpMatSpMMBit(opA, opB);
+
+    //
+    // The buffer rocsparse_spmm needs depends on the dense matrices, it is queried on each call.
+    //
+    size_t                   buffer_size = 0;
+    hipsparse::device_spmat* D           = hipsparse::deviceSpMatCurrent(descr);
+    if(D != nullptr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::deviceSpMatSpMM(handle,
+                                                             *D,
+                                                             opA,
+                                                             opB,
+                                                             alpha,
+                                                             dnmat_B,
+                                                             beta,
+                                                             dnmat_C,
+                                                             datatype,
+                                                             rocsparse_spmm_stage_buffer_size,
+                                                             &buffer_size));
+    }
+
+    //
+    // The device copy of the matrix is built, and rocSPARSE is prepared for the operations, once
+    // and again when a larger buffer is needed. If the handle stream is being captured into a
+    // graph, this setup runs on a side stream, such that only the gather and the product are
+    // captured.
+    //
+    if(D == nullptr || (D->spmm_preprocessed & bit) == 0 || buffer_size > D->buffer_size)
+    {
+        hipsparse::stream_capture_bypass setup_bypass(handle, true);
+        RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::deviceSpMatGet(handle, descr, matA, &D));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::deviceSpMatSpMM(handle,
+                                                             *D,
+                                                             opA,
+                                                             opB,
+                                                             alpha,
+                                                             dnmat_B,
+                                                             beta,
+                                                             dnmat_C,
+                                                             datatype,
+                                                             rocsparse_spmm_stage_buffer_size,
+                                                             &buffer_size));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::deviceSpMatReserve(handle, *D, buffer_size));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::deviceSpMatSpMM(handle,
+                                                             *D,
+                                                             opA,
+                                                             opB,
+                                                             alpha,
+                                                             dnmat_B,
+                                                             beta,
+                                                             dnmat_C,
+                                                             datatype,
+                                                             rocsparse_spmm_stage_preprocess,
+                                                             &buffer_size));
+
+        D->spmm_preprocessed |= bit;
+
+        RETURN_IF_HIPSPARSE_ERROR(setup_bypass.finish());
+    }
+
+    // Gather the current values of matA into the device copy.
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnvec_set_values(D->values, matA.values));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_gather((rocsparse_handle)handle, D->values, D->csr.gather));
+
+    buffer_size = D->buffer_size;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::deviceSpMatSpMM(handle,
+                                                         *D,
+                                                         opA,
+                                                         opB,
+                                                         alpha,
+                                                         dnmat_B,
+                                                         beta,
+                                                         dnmat_C,
+                                                         datatype,
+                                                         rocsparse_spmm_stage_compute,
+                                                         &buffer_size));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::get_ell_host_spmat(hipsparseConstSpMatDescr_t descr, host_spmat& ell)
+{
+    ell.format = HIPSPARSE_FORMAT_ELL;
+
+    const void* col_ind;
+    const void* values;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseConstEllGet(descr,
+                                                   &ell.rows,
+                                                   &ell.cols,
+                                                   &ell.width,
+                                                   &col_ind,
+                                                   &values,
+                                                   &ell.index_type,
+                                                   &ell.idx_base,
+                                                   &ell.value_type));
+
+    ell.col_ind     = const_cast<void*>(col_ind);
+    ell.values      = const_cast<void*>(values);
+    ell.values_size = ell.width * ell.rows;
+    ell.nnz         = ell.values_size;
+
+    return hipsparse::get_spmat_matrix_type(descr, &ell.matrix_type, &ell.fill_mode);
+}
+
+hipsparseStatus_t hipsparse::get_csr_host_spmat(hipsparseConstSpMatDescr_t descr, host_spmat& csr)
+{
+    int batch_count;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_strided_batch(to_rocsparse_const_spmat_descr(descr), &batch_count));
+
+    if(batch_count > 1)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    csr.format = HIPSPARSE_FORMAT_CSR;
+
+    const void* row_ptr;
+    const void* col_ind;
+    const void* values;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCsrGet(descr,
+                                                   &csr.rows,
+                                                   &csr.cols,
+                                                   &csr.nnz,
+                                                   &row_ptr,
+                                                   &col_ind,
+                                                   &values,
+                                                   &csr.row_index_type,
+                                                   &csr.index_type,
+                                                   &csr.idx_base,
+                                                   &csr.value_type));
+
+    csr.row_ptr     = const_cast<void*>(row_ptr);
+    csr.col_ind     = const_cast<void*>(col_ind);
+    csr.values      = const_cast<void*>(values);
+    csr.values_size = csr.nnz;
+
+    return hipsparse::get_spmat_matrix_type(descr, &csr.matrix_type, &csr.fill_mode);
+}
+
+hipsparseStatus_t hipsparse::get_spmat_matrix_type(hipsparseConstSpMatDescr_t descr,
+                                                   hipsparseMatrixType_t*     matrixType,
+                                                   hipsparseFillMode_t*       fillMode)
+{
+    if(descr->get_host_spmat() != nullptr)
+    {
+        *matrixType = descr->get_host_spmat()->matrix_type;
+        *fillMode   = descr->get_host_spmat()->fill_mode;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    rocsparse_matrix_type matrix_type;
+    rocsparse_fill_mode   fill_mode;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(descr),
+                                                            rocsparse_spmat_matrix_type,
+                                                            &matrix_type,
+                                                            sizeof(matrix_type)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(descr),
+                                                            rocsparse_spmat_fill_mode,
+                                                            &fill_mode,
+                                                            sizeof(fill_mode)));
+
+    *matrixType = hipsparse::HCCMatTypeToHIPMatType(matrix_type);
+    *fillMode   = hipsparse::HCCFillModeToHIPFillMode(fill_mode);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::host_spmat_csr_nnz(hipsparseHandle_t handle,
+                                                const host_spmat& A,
+                                                bool              drop_zeros,
+                                                void*             csrRowOffsets,
+                                                int64_t*          csrNnz)
+{
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    std::vector<int64_t> row_ptr;
+    std::vector<int64_t> col_ind;
+    std::vector<char>    val;
+    RETURN_IF_HIPSPARSE_ERROR(hostSpMatToCsr(handle, stream, A, drop_zeros, row_ptr, col_ind, val));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+        handle, stream, row_ptr, A.idx_base, A.index_type, csrRowOffsets));
+
+    *csrNnz = static_cast<int64_t>(col_ind.size());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::host_spmat_to_csr(hipsparseHandle_t     handle,
+                                               const host_spmat&     A,
+                                               bool                  drop_zeros,
+                                               hipsparseSpMatDescr_t matCsr)
+{
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matCsr, &format));
+
+    if(format != HIPSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t              m;
+    int64_t              n;
+    int64_t              nnz;
+    void*                csr_row_ptr;
+    void*                csr_col_ind;
+    void*                csr_val;
+    hipsparseIndexType_t row_type;
+    hipsparseIndexType_t col_type;
+    hipsparseIndexBase_t base;
+    hipDataType          value_type;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrGet(matCsr,
+                                              &m,
+                                              &n,
+                                              &nnz,
+                                              &csr_row_ptr,
+                                              &csr_col_ind,
+                                              &csr_val,
+                                              &row_type,
+                                              &col_type,
+                                              &base,
+                                              &value_type));
+
+    if(value_type != A.value_type)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(m != A.rows || n != A.cols)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    std::vector<int64_t> row_ptr;
+    std::vector<int64_t> col_ind;
+    std::vector<char>    val;
+    RETURN_IF_HIPSPARSE_ERROR(hostSpMatToCsr(handle, stream, A, drop_zeros, row_ptr, col_ind, val));
+
+    if(nnz != static_cast<int64_t>(col_ind.size()))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::copy_indices_to_device(handle, stream, row_ptr, base, row_type, csr_row_ptr));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparse::copy_indices_to_device(handle, stream, col_ind, base, col_type, csr_col_ind));
+
+    if(nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(csr_val, val.data(), val.size(), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+
+    // The arrays were rewritten in place, analysis data attached to the matrix is stale.
+    matCsr->structure_changed();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
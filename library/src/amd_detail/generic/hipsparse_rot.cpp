@@ -36,9 +36,11 @@ hipsparseStatus_t hipsparseRot(hipsparseHandle_t     handle,
                                hipsparseSpVecDescr_t vecX,
                                hipsparseDnVecDescr_t vecY)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_rot((rocsparse_handle)handle,
                                                                c_coeff,
                                                                s_coeff,
                                                                (rocsparse_spvec_descr)vecX,
-                                                               (rocsparse_dnvec_descr)vecY));
+                                                               to_rocsparse_dnvec_descr(vecY)));
 }
@@ -34,6 +34,10 @@ hipsparseStatus_t hipsparseScatter(hipsparseHandle_t          handle,
                                    hipsparseConstSpVecDescr_t vecX,
                                    hipsparseDnVecDescr_t      vecY)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_scatter(
-        (rocsparse_handle)handle, (rocsparse_const_spvec_descr)vecX, (rocsparse_dnvec_descr)vecY));
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_scatter((rocsparse_handle)handle,
+                          (rocsparse_const_spvec_descr)vecX,
+                          to_rocsparse_dnvec_descr(vecY)));
 }
@@ -42,6 +42,8 @@ hipsparseStatus_t hipsparseSDDMM(hipsparseHandle_t          handle,
                                  hipsparseSDDMMAlg_t        alg,
                                  void*                      tempBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm((rocsparse_handle)handle,
                         hipsparse::hipOperationToHCCOperation(opA),
@@ -68,6 +70,8 @@ hipsparseStatus_t hipsparseSDDMM_bufferSize(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             size_t*                    pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_buffer_size((rocsparse_handle)handle,
                                     hipsparse::hipOperationToHCCOperation(opA),
@@ -94,6 +98,8 @@ hipsparseStatus_t hipsparseSDDMM_preprocess(hipsparseHandle_t          handle,
                                             hipsparseSDDMMAlg_t        alg,
                                             void*                      tempBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sddmm_preprocess((rocsparse_handle)handle,
                                    hipsparse::hipOperationToHCCOperation(opA),
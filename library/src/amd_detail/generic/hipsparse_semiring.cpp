@@ -0,0 +1,376 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <limits>
+#include <utility>
+
+namespace hipsparse
+{
+    //
+    // Identity of the addition of a semiring, the value of the entries that are not stored.
+    //
+    template <typename T>
+    static void semiringGetIdentity(hipsparseSemiring_t semiring, T* identity)
+    {
+        switch(semiring)
+        {
+        case HIPSPARSE_SEMIRING_PLUS_TIMES:
+        case HIPSPARSE_SEMIRING_OR_AND:
+        {
+            *identity = static_cast<T>(0);
+            return;
+        }
+        case HIPSPARSE_SEMIRING_MIN_PLUS:
+        {
+            *identity = std::numeric_limits<T>::infinity();
+            return;
+        }
+        case HIPSPARSE_SEMIRING_MAX_PLUS:
+        case HIPSPARSE_SEMIRING_MAX_MIN:
+        {
+            *identity = -std::numeric_limits<T>::infinity();
+            return;
+        }
+        }
+    }
+
+    static bool semiringIsValid(hipsparseSemiring_t semiring)
+    {
+        switch(semiring)
+        {
+        case HIPSPARSE_SEMIRING_PLUS_TIMES:
+        case HIPSPARSE_SEMIRING_MIN_PLUS:
+        case HIPSPARSE_SEMIRING_MAX_PLUS:
+        case HIPSPARSE_SEMIRING_MAX_MIN:
+        case HIPSPARSE_SEMIRING_OR_AND:
+        {
+            return true;
+        }
+        }
+
+        return false;
+    }
+
+    //
+    // Restore the pointer mode of the handle on return, the semiring product passes its scalars
+    // from the host.
+    //
+    class semiring_pointer_mode
+    {
+        rocsparse_handle       m_handle{};
+        rocsparse_pointer_mode m_mode{rocsparse_pointer_mode_host};
+
+    public:
+        explicit semiring_pointer_mode(hipsparseHandle_t handle)
+            : m_handle((rocsparse_handle)handle)
+        {
+            rocsparse_get_pointer_mode(m_handle, &m_mode);
+        }
+
+        ~semiring_pointer_mode()
+        {
+            rocsparse_set_pointer_mode(m_handle, m_mode);
+        }
+
+        semiring_pointer_mode(const semiring_pointer_mode&)            = delete;
+        semiring_pointer_mode& operator=(const semiring_pointer_mode&) = delete;
+    };
+
+    //
+    // Size and value type of a CSR, CSC or COO matrix, the formats supported by rocsparse_spmv.
+    //
+    static hipsparseStatus_t spmvSemiringDescribe(hipsparseConstSpMatDescr_t matA,
+                                                  int64_t&                   rows,
+                                                  int64_t&                   cols,
+                                                  hipDataType&               valueType)
+    {
+        hipsparseFormat_t format;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matA, &format));
+
+        int64_t              nnz;
+        const void*          row_data;
+        const void*          col_data;
+        const void*          val;
+        hipsparseIndexType_t row_type;
+        hipsparseIndexType_t col_type;
+        hipsparseIndexBase_t base;
+
+        switch(format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        {
+            return hipsparseConstCsrGet(matA,
+                                        &rows,
+                                        &cols,
+                                        &nnz,
+                                        &row_data,
+                                        &col_data,
+                                        &val,
+                                        &row_type,
+                                        &col_type,
+                                        &base,
+                                        &valueType);
+        }
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            return hipsparseConstCscGet(matA,
+                                        &rows,
+                                        &cols,
+                                        &nnz,
+                                        &col_data,
+                                        &row_data,
+                                        &val,
+                                        &col_type,
+                                        &row_type,
+                                        &base,
+                                        &valueType);
+        }
+        case HIPSPARSE_FORMAT_COO:
+        {
+            return hipsparseConstCooGet(matA,
+                                        &rows,
+                                        &cols,
+                                        &nnz,
+                                        &row_data,
+                                        &col_data,
+                                        &val,
+                                        &row_type,
+                                        &base,
+                                        &valueType);
+        }
+        default:
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        }
+    }
+
+    //
+    // The arithmetic semiring is y = 1 * op(A) * x + 1 * y, which is computed by rocsparse_spmv.
+    // rocSPARSE hard-codes (+, x) in its kernels, the other semirings are not supported.
+    //
+    template <typename T>
+    static hipsparseStatus_t spmvSemiringPlusTimes(hipsparseHandle_t          handle,
+                                                   hipsparseOperation_t       opA,
+                                                   hipsparseConstSpMatDescr_t matA,
+                                                   hipsparseConstDnVecDescr_t vecX,
+                                                   hipsparseDnVecDescr_t      vecY,
+                                                   hipDataType                computeType)
+    {
+        const T one = static_cast<T>(1);
+
+        semiring_pointer_mode restore(handle);
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        size_t buffer_size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 hipsparse::hipOperationToHCCOperation(opA),
+                                                 &one,
+                                                 to_rocsparse_const_spmat_descr(matA),
+                                                 to_rocsparse_const_dnvec_descr(vecX),
+                                                 &one,
+                                                 to_rocsparse_dnvec_descr(vecY),
+                                                 hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                 rocsparse_spmv_alg_default,
+                                                 rocsparse_spmv_stage_buffer_size,
+                                                 &buffer_size,
+                                                 nullptr));
+
+        void* buffer = nullptr;
+        if(buffer_size > 0)
+        {
+            hipsparse::count_workspace(handle, buffer_size);
+            RETURN_IF_HIP_ERROR(hipMallocAsync(&buffer, buffer_size, stream));
+        }
+
+        rocsparse_status status = rocsparse_status_success;
+        for(rocsparse_spmv_stage stage :
+            {rocsparse_spmv_stage_preprocess, rocsparse_spmv_stage_compute})
+        {
+            status = rocsparse_spmv((rocsparse_handle)handle,
+                                    hipsparse::hipOperationToHCCOperation(opA),
+                                    &one,
+                                    to_rocsparse_const_spmat_descr(matA),
+                                    to_rocsparse_const_dnvec_descr(vecX),
+                                    &one,
+                                    to_rocsparse_dnvec_descr(vecY),
+                                    hipsparse::hipDataTypeToHCCDataType(computeType),
+                                    rocsparse_spmv_alg_default,
+                                    stage,
+                                    &buffer_size,
+                                    buffer);
+            if(status != rocsparse_status_success)
+            {
+                break;
+            }
+        }
+
+        if(buffer != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFreeAsync(buffer, stream));
+        }
+
+        return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    }
+}
+
+hipsparseStatus_t hipsparseSemiringGetIdentity(hipsparseSemiring_t semiring,
+                                               hipDataType         valueType,
+                                               void*               identity)
+{
+    if(identity == nullptr || !hipsparse::semiringIsValid(semiring))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    switch(valueType)
+    {
+    case HIP_R_32F:
+    {
+        hipsparse::semiringGetIdentity(semiring, static_cast<float*>(identity));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIP_R_64F:
+    {
+        hipsparse::semiringGetIdentity(semiring, static_cast<double*>(identity));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIP_C_32F:
+    {
+        if(semiring != HIPSPARSE_SEMIRING_PLUS_TIMES)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        *static_cast<hipComplex*>(identity) = make_hipComplex(0.0f, 0.0f);
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIP_C_64F:
+    {
+        if(semiring != HIPSPARSE_SEMIRING_PLUS_TIMES)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        *static_cast<hipDoubleComplex*>(identity) = make_hipDoubleComplex(0.0, 0.0);
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    default:
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+    }
+}
+
+hipsparseStatus_t hipsparseSpMVSemiring(hipsparseHandle_t          handle,
+                                        hipsparseOperation_t       opA,
+                                        hipsparseSemiring_t        semiring,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        hipsparseConstDnVecDescr_t vecX,
+                                        hipsparseDnVecDescr_t      vecY,
+                                        hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, opA, semiring, computeType);
+
+    if(handle == nullptr || matA == nullptr || vecX == nullptr || vecY == nullptr
+       || !hipsparse::semiringIsValid(semiring))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(computeType != HIP_R_32F && computeType != HIP_R_64F)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(semiring != HIPSPARSE_SEMIRING_PLUS_TIMES)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t     rows;
+    int64_t     cols;
+    hipDataType typeA;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::spmvSemiringDescribe(matA, rows, cols, typeA));
+
+    int64_t     sizeX;
+    int64_t     sizeY;
+    const void* x;
+    void*       y;
+    hipDataType typeX;
+    hipDataType typeY;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseConstDnVecGet(vecX, &sizeX, &x, &typeX));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGet(vecY, &sizeY, &y, &typeY));
+
+    // The rows of op(A) are the columns of A
+    if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        std::swap(rows, cols);
+    }
+
+    if(typeA != computeType || typeX != computeType || typeY != computeType)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(sizeX != cols || sizeY != rows)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(rows == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+    {
+        return hipsparse::spmvSemiringPlusTimes<float>(
+            handle, opA, matA, vecX, vecY, computeType);
+    }
+    case HIP_R_64F:
+    {
+        return hipsparse::spmvSemiringPlusTimes<double>(
+            handle, opA, matA, vecX, vecY, computeType);
+    }
+    default:
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+    }
+}
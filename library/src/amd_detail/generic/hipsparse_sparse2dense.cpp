@@ -36,6 +36,8 @@ hipsparseStatus_t hipsparseSparseToDense_bufferSize(hipsparseHandle_t
                                                     hipsparseSparseToDenseAlg_t alg,
                                                     size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, alg);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   to_rocsparse_const_spmat_descr(matA),
@@ -51,6 +53,8 @@ hipsparseStatus_t hipsparseSparseToDense(hipsparseHandle_t           handle,
                                          hipsparseSparseToDenseAlg_t alg,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, alg);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sparse_to_dense((rocsparse_handle)handle,
                                   to_rocsparse_const_spmat_descr(matA),
@@ -30,6 +30,9 @@
 
 #include "../utility.h"
 
+#include <algorithm>
+#include <vector>
+
 struct hipsparseSpGEMMDescr
 {
     size_t bufferSize1{};
@@ -43,6 +46,14 @@ struct hipsparseSpGEMMDescr
     void* externalBuffer3{};
     void* externalBuffer4{};
     void* externalBuffer5{};
+
+    // Sparsity mask of C. hipsparseSpGEMM_workEstimation computes the zero based column indices
+    // of C and the positions of the entries of C in the full product A * B once on the host.
+    // hipsparseSpGEMM_compute forms the full product with rocsparse_spgemm and gathers C from it.
+    hipsparseConstSpMatDescr_t mask{};
+    int64_t                    productNnz{};
+    std::vector<int64_t>       hostColInd{};
+    std::vector<int64_t>       hostMap{};
 };
 
 hipsparseStatus_t hipsparseSpGEMM_createDescr(hipsparseSpGEMMDescr_t* descr)
@@ -67,6 +78,49 @@ hipsparseStatus_t hipsparseSpGEMM_destroyDescr(hipsparseSpGEMMDescr_t descr)
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparseSpGEMM_setMask(hipsparseSpGEMMDescr_t     spgemmDescr,
+                                          hipsparseConstSpMatDescr_t matM)
+{
+    if(spgemmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    spgemmDescr->mask = matM;
+    spgemmDescr->productNnz = 0;
+    spgemmDescr->hostColInd.clear();
+    spgemmDescr->hostMap.clear();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpGEMM_setSemiring(hipsparseSpGEMMDescr_t spgemmDescr,
+                                              hipsparseSemiring_t    semiring)
+{
+    if(spgemmDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // rocsparse_spgemm hard-codes (+, x), the other semirings are not supported
+    switch(semiring)
+    {
+    case HIPSPARSE_SEMIRING_PLUS_TIMES:
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    case HIPSPARSE_SEMIRING_MIN_PLUS:
+    case HIPSPARSE_SEMIRING_MAX_PLUS:
+    case HIPSPARSE_SEMIRING_MAX_MIN:
+    case HIPSPARSE_SEMIRING_OR_AND:
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+    }
+
+    return HIPSPARSE_STATUS_INVALID_VALUE;
+}
+
 namespace hipsparse
 {
     static hipsparseStatus_t getIndexTypeSize(hipsparseIndexType_t indexType, size_t& size)
@@ -128,6 +182,382 @@ namespace hipsparse
         size = 0;
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
+
+    //
+    // CSR matrix taking part in a masked product. The sparsity pattern is copied to the host with
+    // zero based 64 bit indices.
+    //
+    struct spgemm_host_csr
+    {
+        int64_t              rows{};
+        int64_t              cols{};
+        int64_t              nnz{};
+        const void*          row_ptr{};
+        const void*          col_ind{};
+        const void*          val{};
+        hipsparseIndexType_t row_type{};
+        hipsparseIndexType_t col_type{};
+        hipsparseIndexBase_t base{};
+        hipDataType          value_type{};
+
+        std::vector<int64_t> host_row_ptr{};
+        std::vector<int64_t> host_col_ind{};
+    };
+
+    //
+    // rocSPARSE only provides the product of the full matrices. A masked product computes the
+    // full product and gathers the entries inside of the mask from it.
+    //
+    static bool spgemmMasked(hipsparseSpGEMMDescr_t spgemmDescr)
+    {
+        return spgemmDescr->mask != nullptr;
+    }
+
+    static hipsparseStatus_t spgemmHostDescribe(hipsparseConstSpMatDescr_t mat,
+                                                spgemm_host_csr&           csr)
+    {
+        hipsparseFormat_t format;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(mat, &format));
+
+        if(format != HIPSPARSE_FORMAT_CSR)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCsrGet(mat,
+                                                       &csr.rows,
+                                                       &csr.cols,
+                                                       &csr.nnz,
+                                                       &csr.row_ptr,
+                                                       &csr.col_ind,
+                                                       &csr.val,
+                                                       &csr.row_type,
+                                                       &csr.col_type,
+                                                       &csr.base,
+                                                       &csr.value_type));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // The pattern of a masked product is computed on the host for non transposed CSR matrices,
+    // with the values of A, B and C stored in the compute type.
+    //
+    static hipsparseStatus_t spgemmMaskedCheck(hipsparseOperation_t       opA,
+                                               hipsparseOperation_t       opB,
+                                               hipsparseConstSpMatDescr_t matA,
+                                               hipsparseConstSpMatDescr_t matB,
+                                               hipsparseConstSpMatDescr_t matC,
+                                               hipsparseSpGEMMDescr_t     spgemmDescr,
+                                               hipDataType                computeType)
+    {
+        if(opA != HIPSPARSE_OPERATION_NON_TRANSPOSE || opB != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        spgemm_host_csr A, B, C;
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matA, A));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matB, B));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matC, C));
+
+        if(A.value_type != computeType || B.value_type != computeType
+           || C.value_type != computeType)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A.cols != B.rows || C.rows != A.rows || C.cols != B.cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(spgemmDescr->mask != nullptr)
+        {
+            spgemm_host_csr M;
+            RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(spgemmDescr->mask, M));
+
+            if(M.rows != C.rows || M.cols != C.cols)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    static hipsparseStatus_t spgemmHostCopyPatternToHost(hipsparseHandle_t handle,
+                                                         hipStream_t       stream,
+                                                         spgemm_host_csr&  csr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, csr.row_ptr, csr.row_type, csr.rows + 1, csr.base, csr.host_row_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, csr.col_ind, csr.col_type, csr.nnz, csr.base, csr.host_col_ind));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Symbolic phase of the masked product. Row i of the full product P holds the columns j that
+    // are reached by at least one product A_ik * B_kj, in ascending order like the output of
+    // rocsparse_spgemm. Row i of C holds the columns of row i of P that are also stored in row i
+    // of M, and the gather map holds their positions in P.
+    //
+    static hipsparseStatus_t spgemmMaskedWorkEstimation(hipsparseHandle_t          handle,
+                                                        hipsparseConstSpMatDescr_t matA,
+                                                        hipsparseConstSpMatDescr_t matB,
+                                                        hipsparseSpMatDescr_t      matC,
+                                                        hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                        void*                      csrRowOffsetsC)
+    {
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        spgemm_host_csr A, B, C, M;
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matA, A));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matB, B));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matC, C));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(spgemmDescr->mask, M));
+
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostCopyPatternToHost(handle, stream, A));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostCopyPatternToHost(handle, stream, B));
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostCopyPatternToHost(handle, stream, M));
+
+        std::vector<int64_t>  row_ptr(C.rows + 1, 0);
+        std::vector<int64_t>& col_ind = spgemmDescr->hostColInd;
+        std::vector<int64_t>& map     = spgemmDescr->hostMap;
+
+        col_ind.clear();
+        map.clear();
+
+        // Row in which a column was last marked by the mask and last reached by a product
+        std::vector<int64_t> marked(C.cols, -1);
+        std::vector<int64_t> reached(C.cols, -1);
+
+        // Columns of the current row of P
+        std::vector<int64_t> product_row;
+        int64_t              product_nnz = 0;
+
+        for(int64_t i = 0; i < C.rows; ++i)
+        {
+            for(int64_t q = M.host_row_ptr[i]; q < M.host_row_ptr[i + 1]; ++q)
+            {
+                marked[M.host_col_ind[q]] = i;
+            }
+
+            product_row.clear();
+
+            for(int64_t p = A.host_row_ptr[i]; p < A.host_row_ptr[i + 1]; ++p)
+            {
+                const int64_t k = A.host_col_ind[p];
+
+                for(int64_t q = B.host_row_ptr[k]; q < B.host_row_ptr[k + 1]; ++q)
+                {
+                    const int64_t j = B.host_col_ind[q];
+
+                    if(reached[j] != i)
+                    {
+                        reached[j] = i;
+                        product_row.push_back(j);
+                    }
+                }
+            }
+
+            std::sort(product_row.begin(), product_row.end());
+
+            for(size_t p = 0; p < product_row.size(); ++p)
+            {
+                const int64_t j = product_row[p];
+
+                if(marked[j] == i)
+                {
+                    col_ind.push_back(j);
+                    map.push_back(product_nnz + static_cast<int64_t>(p));
+                }
+            }
+
+            product_nnz += static_cast<int64_t>(product_row.size());
+            row_ptr[i + 1] = static_cast<int64_t>(col_ind.size());
+        }
+
+        spgemmDescr->productNnz = product_nnz;
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+            handle, stream, row_ptr, C.base, C.row_type, csrRowOffsetsC));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrSetPointers(
+            matC, csrRowOffsetsC, const_cast<void*>(C.col_ind), const_cast<void*>(C.val)));
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::set_csr_nnz(matC, static_cast<int64_t>(col_ind.size())));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Size of the arrays of the full product P and of the gather map that a masked product
+    // stores in externalBuffer2, in front of the buffer of rocsparse_spgemm.
+    //
+    static hipsparseStatus_t spgemmMaskedArraysSize(hipsparseConstSpMatDescr_t matC,
+                                                    hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                    size_t&                    size)
+    {
+        spgemm_host_csr C;
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matC, C));
+
+        size_t row_type_size;
+        size_t col_type_size;
+        size_t value_type_size;
+        RETURN_IF_HIPSPARSE_ERROR(getIndexTypeSize(C.row_type, row_type_size));
+        RETURN_IF_HIPSPARSE_ERROR(getIndexTypeSize(C.col_type, col_type_size));
+        RETURN_IF_HIPSPARSE_ERROR(getDataTypeSize(C.value_type, value_type_size));
+
+        const int64_t nnz_P = spgemmDescr->productNnz;
+
+        size = 0;
+        size += ((row_type_size * (C.rows + 1) - 1) / 256 + 1) * 256;
+        size += ((col_type_size * nnz_P - 1) / 256 + 1) * 256;
+        size += ((value_type_size * nnz_P - 1) / 256 + 1) * 256;
+        size += ((row_type_size * C.nnz - 1) / 256 + 1) * 256;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Numeric phase of the masked product. rocsparse_spgemm computes P = alpha * A * B into
+    // buffer, the entries of C are gathered from the values of P with the map of the symbolic
+    // phase.
+    //
+    static hipsparseStatus_t spgemmMaskedCompute(hipsparseHandle_t          handle,
+                                                 const void*                alpha,
+                                                 hipsparseConstSpMatDescr_t matA,
+                                                 hipsparseConstSpMatDescr_t matB,
+                                                 hipsparseConstSpMatDescr_t matC,
+                                                 hipDataType                computeType,
+                                                 hipsparseSpGEMMAlg_t       alg,
+                                                 hipsparseSpGEMMDescr_t     spgemmDescr,
+                                                 void*                      csrColIndC,
+                                                 void*                      csrValuesC,
+                                                 void*                      buffer,
+                                                 size_t                     bufferSize)
+    {
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        spgemm_host_csr C;
+        RETURN_IF_HIPSPARSE_ERROR(spgemmHostDescribe(matC, C));
+
+        const int64_t               nnz_P   = spgemmDescr->productNnz;
+        const std::vector<int64_t>& col_ind = spgemmDescr->hostColInd;
+        const std::vector<int64_t>& map     = spgemmDescr->hostMap;
+
+        // The pattern must stem from hipsparseSpGEMM_workEstimation on the same matrices
+        if(static_cast<int64_t>(col_ind.size()) != C.nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        size_t row_type_size;
+        size_t col_type_size;
+        size_t value_type_size;
+        RETURN_IF_HIPSPARSE_ERROR(getIndexTypeSize(C.row_type, row_type_size));
+        RETURN_IF_HIPSPARSE_ERROR(getIndexTypeSize(C.col_type, col_type_size));
+        RETURN_IF_HIPSPARSE_ERROR(getDataTypeSize(C.value_type, value_type_size));
+
+        size_t byteOffset = 0;
+
+        void* row_ptr_P = buffer;
+        byteOffset += ((row_type_size * (C.rows + 1) - 1) / 256 + 1) * 256;
+
+        void* col_ind_P = (static_cast<char*>(buffer) + byteOffset);
+        byteOffset += ((col_type_size * nnz_P - 1) / 256 + 1) * 256;
+
+        void* val_P = (static_cast<char*>(buffer) + byteOffset);
+        byteOffset += ((value_type_size * nnz_P - 1) / 256 + 1) * 256;
+
+        void* map_C = (static_cast<char*>(buffer) + byteOffset);
+        byteOffset += ((row_type_size * C.nnz - 1) / 256 + 1) * 256;
+
+        void*  spgemm_buffer      = (static_cast<char*>(buffer) + byteOffset);
+        size_t spgemm_buffer_size = bufferSize - byteOffset;
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+            handle, stream, col_ind, C.base, C.col_type, csrColIndC));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_device(
+            handle, stream, map, HIPSPARSE_INDEX_BASE_ZERO, C.row_type, map_C));
+
+        // Full product P = alpha * A * B
+        rocsparse_spmat_descr P;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_csr_descr(&P,
+                                       C.rows,
+                                       C.cols,
+                                       0,
+                                       row_ptr_P,
+                                       nullptr,
+                                       nullptr,
+                                       hipsparse::hipIndexTypeToHCCIndexType(C.row_type),
+                                       hipsparse::hipIndexTypeToHCCIndexType(C.col_type),
+                                       hipsparse::hipBaseToHCCBase(C.base),
+                                       hipsparse::hipDataTypeToHCCDataType(C.value_type)));
+
+        rocsparse_status status = rocsparse_status_success;
+        for(rocsparse_spgemm_stage stage :
+            {rocsparse_spgemm_stage_nnz, rocsparse_spgemm_stage_compute})
+        {
+            if(stage == rocsparse_spgemm_stage_compute)
+            {
+                status = rocsparse_csr_set_pointers(P, row_ptr_P, col_ind_P, val_P);
+                if(status != rocsparse_status_success)
+                {
+                    break;
+                }
+            }
+
+            status = rocsparse_spgemm((rocsparse_handle)handle,
+                                      rocsparse_operation_none,
+                                      rocsparse_operation_none,
+                                      alpha,
+                                      to_rocsparse_const_spmat_descr(matA),
+                                      to_rocsparse_const_spmat_descr(matB),
+                                      nullptr,
+                                      P,
+                                      P,
+                                      hipsparse::hipDataTypeToHCCDataType(computeType),
+                                      hipsparse::hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+                                      stage,
+                                      &spgemm_buffer_size,
+                                      spgemm_buffer);
+            if(status != rocsparse_status_success)
+            {
+                break;
+            }
+        }
+
+        rocsparse_destroy_spmat_descr(P);
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        // C is the part of P inside of the mask
+        hipsparseSpVecDescr_t vecC;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSpVec(&vecC,
+                                                       nnz_P,
+                                                       C.nnz,
+                                                       map_C,
+                                                       csrValuesC,
+                                                       C.row_type,
+                                                       HIPSPARSE_INDEX_BASE_ZERO,
+                                                       C.value_type));
+
+        hipsparseConstDnVecDescr_t vecP;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateConstDnVec(&vecP, nnz_P, val_P, C.value_type));
+
+        const hipsparseStatus_t gather_status = hipsparseGather(handle, vecP, vecC);
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroySpVec(vecC));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyDnVec(vecP));
+
+        return gather_status;
+    }
 }
 
 hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          handle,
@@ -144,6 +574,8 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
                                                  size_t*                    bufferSize1,
                                                  void*                      externalBuffer1)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     // Match cusparse error handling
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize1 == nullptr || spgemmDescr == nullptr)
@@ -176,6 +608,27 @@ hipsparseStatus_t hipsparseSpGEMM_workEstimation(hipsparseHandle_t          hand
     RETURN_IF_HIPSPARSE_ERROR(
         hipsparse::getIndexTypeSize(csrRowOffsetsTypeC, csrRowOffsetsTypeSizeC));
 
+    if(hipsparse::spgemmMasked(spgemmDescr))
+    {
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::spgemmMaskedCheck(opA, opB, matA, matB, matC, spgemmDescr, computeType));
+
+        // The masked symbolic phase only stores matC row ptr array
+        if(externalBuffer1 == nullptr)
+        {
+            *bufferSize1 = ((csrRowOffsetsTypeSizeC * (rowsC + 1) - 1) / 256 + 1) * 256;
+
+            spgemmDescr->bufferSize1 = *bufferSize1;
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        spgemmDescr->externalBuffer1 = externalBuffer1;
+
+        return hipsparse::spgemmMaskedWorkEstimation(
+            handle, matA, matB, matC, spgemmDescr, spgemmDescr->externalBuffer1);
+    }
+
     if(externalBuffer1 == nullptr)
     {
         // Query for required buffer size
@@ -246,6 +699,8 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
                                           size_t*                    bufferSize2,
                                           void*                      externalBuffer2)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || bufferSize2 == nullptr)
     {
@@ -298,6 +753,36 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
         // Need to store temporary space for host/device 1 value used in hipsparseSpGEMM_copy Axpby
         *bufferSize2 += ((computeTypeSize - 1) / 256 + 1) * 256;
 
+        // A masked product stores the full product, the gather map and the rocsparse_spgemm buffer
+        if(hipsparse::spgemmMasked(spgemmDescr))
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparse::spgemmMaskedCheck(opA, opB, matA, matB, matC, spgemmDescr, computeType));
+
+            size_t arraysSize;
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparse::spgemmMaskedArraysSize(matC, spgemmDescr, arraysSize));
+
+            size_t bufferSize;
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_spgemm((rocsparse_handle)handle,
+                                 rocsparse_operation_none,
+                                 rocsparse_operation_none,
+                                 alpha,
+                                 to_rocsparse_const_spmat_descr(matA),
+                                 to_rocsparse_const_spmat_descr(matB),
+                                 nullptr,
+                                 to_rocsparse_const_spmat_descr(matC),
+                                 to_rocsparse_spmat_descr(matC),
+                                 hipsparse::hipDataTypeToHCCDataType(computeType),
+                                 hipsparse::hipSpGEMMAlgToHCCSpGEMMAlg(alg),
+                                 rocsparse_spgemm_stage_buffer_size,
+                                 &bufferSize,
+                                 nullptr));
+
+            *bufferSize2 += arraysSize + bufferSize;
+        }
+
         spgemmDescr->bufferSize2 = *bufferSize2;
     }
     else
@@ -321,6 +806,31 @@ hipsparseStatus_t hipsparseSpGEMM_compute(hipsparseHandle_t          handle,
         RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrSetPointers(
             matC, csrRowOffsetsCFromBuffer1, csrColIndCFromBuffer2, csrValuesCFromBuffer2));
 
+        if(hipsparse::spgemmMasked(spgemmDescr))
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparse::spgemmMaskedCheck(opA, opB, matA, matB, matC, spgemmDescr, computeType));
+
+            // The full product follows the regions used by hipsparseSpGEMM_copy
+            byteOffset2 += ((csrValueTypeSizeC * nnzC - 1) / 256 + 1) * 256;
+            byteOffset2 += ((csrColIndTypeSizeC * nnzC - 1) / 256 + 1) * 256;
+            byteOffset2 += ((computeTypeSize - 1) / 256 + 1) * 256;
+
+            return hipsparse::spgemmMaskedCompute(
+                handle,
+                alpha,
+                matA,
+                matB,
+                matC,
+                computeType,
+                alg,
+                spgemmDescr,
+                csrColIndCFromBuffer2,
+                csrValuesCFromBuffer2,
+                (static_cast<char*>(spgemmDescr->externalBuffer2) + byteOffset2),
+                spgemmDescr->bufferSize2 - byteOffset2);
+        }
+
         size_t bufferSize = (spgemmDescr->bufferSize1 - byteOffset1);
         RETURN_IF_ROCSPARSE_ERROR(
             rocsparse_spgemm((rocsparse_handle)handle,
@@ -354,6 +864,8 @@ hipsparseStatus_t hipsparseSpGEMM_copy(hipsparseHandle_t          handle,
                                        hipsparseSpGEMMAlg_t       alg,
                                        hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || matA == nullptr
        || matB == nullptr || matC == nullptr || spgemmDescr == nullptr)
     {
@@ -30,6 +30,8 @@
 
 #include "../utility.h"
 
+#include <vector>
+
 struct hipsparseSpGEMMDescr
 {
     size_t bufferSize1{};
@@ -43,6 +45,14 @@ struct hipsparseSpGEMMDescr
     void* externalBuffer3{};
     void* externalBuffer4{};
     void* externalBuffer5{};
+
+    // Sparsity mask of C. hipsparseSpGEMM_workEstimation computes the zero based column indices
+    // of C and the positions of the entries of C in the full product A * B once on the host.
+    // hipsparseSpGEMM_compute forms the full product with rocsparse_spgemm and gathers C from it.
+    hipsparseConstSpMatDescr_t mask{};
+    int64_t                    productNnz{};
+    std::vector<int64_t>       hostColInd{};
+    std::vector<int64_t>       hostMap{};
 };
 
 namespace hipsparse
@@ -119,6 +129,14 @@ hipsparseStatus_t hipsparseSpGEMMreuse_workEstimation(hipsparseHandle_t
                                                       size_t*                    bufferSize1,
                                                       void*                      externalBuffer1)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, alg);
+
+    // Masked products are not available with the reuse functions
+    if(spgemmDescr != nullptr && spgemmDescr->mask != nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
     const void* alpha = (const void*)0x4;
     const void* beta  = (const void*)0x4;
 
@@ -175,6 +193,8 @@ hipsparseStatus_t hipsparseSpGEMMreuse_nnz(hipsparseHandle_t          handle,
                                            size_t*                    bufferSize4,
                                            void*                      externalBuffer4)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, alg);
+
     // Match cusparse error handling
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || spgemmDescr == nullptr || bufferSize2 == nullptr || bufferSize3 == nullptr
@@ -299,6 +319,8 @@ hipsparseStatus_t hipsparseSpGEMMreuse_copy(hipsparseHandle_t          handle,
                                             size_t*                    bufferSize5,
                                             void*                      externalBuffer5)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, alg);
+
     if(handle == nullptr || matA == nullptr || matB == nullptr || matC == nullptr
        || bufferSize5 == nullptr || spgemmDescr == nullptr)
     {
@@ -386,6 +408,8 @@ hipsparseStatus_t hipsparseSpGEMMreuse_compute(hipsparseHandle_t          handle
                                                hipsparseSpGEMMAlg_t       alg,
                                                hipsparseSpGEMMDescr_t     spgemmDescr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     if(handle == nullptr || alpha == nullptr || beta == nullptr || spgemmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
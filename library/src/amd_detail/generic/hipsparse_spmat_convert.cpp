@@ -0,0 +1,815 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace hipsparse
+{
+    //
+    // Sparse matrix taking part in a conversion. ptr holds the row (CSR) or column (CSC) offsets,
+    // ind the column (CSR, BLOCKED_ELL), row (CSC, COO) or interleaved row and column (COO_AOS)
+    // indices and ind2 the column indices of COO. size is the number of stored values.
+    //
+    struct spmat_convert_matrix
+    {
+        hipsparseFormat_t    format{};
+        int64_t              rows{};
+        int64_t              cols{};
+        int64_t              nnz{};
+        int64_t              block_dim{};
+        int64_t              ell_cols{};
+        int64_t              size{};
+        const void*          ptr{};
+        const void*          ind{};
+        const void*          ind2{};
+        const void*          val{};
+        hipsparseIndexType_t ptr_type{};
+        hipsparseIndexType_t ind_type{};
+        hipsparseIndexBase_t base{};
+        hipDataType          value_type{};
+    };
+
+    //
+    // Entry of the source matrix and the position of its value in the values of the source.
+    //
+    struct spmat_convert_entry
+    {
+        int64_t row;
+        int64_t col;
+        int64_t slot;
+    };
+}
+
+struct hipsparseSpMatConvertDescr
+{
+    bool analysed{};
+
+    // Source and target of the analysis, the target with the size computed by the analysis
+    hipsparse::spmat_convert_matrix A{};
+    hipsparse::spmat_convert_matrix B{};
+
+    // Zero based pattern of the target, padding of BLOCKED_ELL is stored as -1 - base
+    std::vector<int64_t> ptr{};
+    std::vector<int64_t> ind{};
+    std::vector<int64_t> ind2{};
+
+    // Value k of the conversion moves from position src[k] of A to position dst[k] of B. Maps
+    // that are the identity are not stored.
+    int64_t              entries{};
+    bool                 src_identity{};
+    bool                 dst_identity{};
+    hipsparseIndexType_t map_type{};
+    void*                buffer{};
+    void*                src{};
+    void*                dst{};
+    void*                tmp{};
+
+    // Index arrays of B written by the last conversion
+    const void* written_ptr{};
+    const void* written_ind{};
+    const void* written_ind2{};
+};
+
+namespace hipsparse
+{
+    static size_t spmatConvertAlign(size_t size)
+    {
+        return ((std::max(size, size_t(1)) - 1) / 256 + 1) * 256;
+    }
+
+    static hipsparseStatus_t spmatConvertDescribe(hipsparseConstSpMatDescr_t mat,
+                                                  spmat_convert_matrix&      A)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(mat, &A.format));
+
+        switch(A.format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCsrGet(mat,
+                                                           &A.rows,
+                                                           &A.cols,
+                                                           &A.nnz,
+                                                           &A.ptr,
+                                                           &A.ind,
+                                                           &A.val,
+                                                           &A.ptr_type,
+                                                           &A.ind_type,
+                                                           &A.base,
+                                                           &A.value_type));
+            A.size = A.nnz;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCscGet(mat,
+                                                           &A.rows,
+                                                           &A.cols,
+                                                           &A.nnz,
+                                                           &A.ptr,
+                                                           &A.ind,
+                                                           &A.val,
+                                                           &A.ptr_type,
+                                                           &A.ind_type,
+                                                           &A.base,
+                                                           &A.value_type));
+            A.size = A.nnz;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIPSPARSE_FORMAT_COO:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCooGet(mat,
+                                                           &A.rows,
+                                                           &A.cols,
+                                                           &A.nnz,
+                                                           &A.ind,
+                                                           &A.ind2,
+                                                           &A.val,
+                                                           &A.ind_type,
+                                                           &A.base,
+                                                           &A.value_type));
+            A.size = A.nnz;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIPSPARSE_FORMAT_COO_AOS:
+        {
+            void* ind;
+            void* val;
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparseCooAoSGet(const_cast<hipsparseSpMatDescr_t>(mat),
+                                   &A.rows,
+                                   &A.cols,
+                                   &A.nnz,
+                                   &ind,
+                                   &val,
+                                   &A.ind_type,
+                                   &A.base,
+                                   &A.value_type));
+            A.ind  = ind;
+            A.val  = val;
+            A.size = A.nnz;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        case HIPSPARSE_FORMAT_BLOCKED_ELL:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseConstBlockedEllGet(mat,
+                                                                  &A.rows,
+                                                                  &A.cols,
+                                                                  &A.block_dim,
+                                                                  &A.ell_cols,
+                                                                  &A.ind,
+                                                                  &A.val,
+                                                                  &A.ind_type,
+                                                                  &A.base,
+                                                                  &A.value_type));
+
+            if(A.block_dim <= 0 || A.ell_cols % A.block_dim != 0)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            A.size = (A.rows + A.block_dim - 1) / A.block_dim * A.ell_cols * A.block_dim;
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+        default:
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        }
+    }
+
+    //
+    // A and B describe a conversion if their dimensions and value types match.
+    //
+    static hipsparseStatus_t spmatConvertCheck(hipsparseConstSpMatDescr_t matA,
+                                               hipsparseConstSpMatDescr_t matB,
+                                               spmat_convert_matrix&      A,
+                                               spmat_convert_matrix&      B)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(spmatConvertDescribe(matA, A));
+        RETURN_IF_HIPSPARSE_ERROR(spmatConvertDescribe(matB, B));
+
+        if(A.value_type != B.value_type || host_value_type_size(A.value_type) == 0)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(A.rows != B.rows || A.cols != B.cols)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Everything but the arrays of x and y agree.
+    //
+    static bool spmatConvertSameLayout(const spmat_convert_matrix& x,
+                                       const spmat_convert_matrix& y)
+    {
+        return x.format == y.format && x.rows == y.rows && x.cols == y.cols && x.nnz == y.nnz
+               && x.block_dim == y.block_dim && x.ell_cols == y.ell_cols && x.size == y.size
+               && x.ptr_type == y.ptr_type && x.ind_type == y.ind_type && x.base == y.base
+               && x.value_type == y.value_type;
+    }
+
+    static hipsparseStatus_t spmatConvertEntries(hipsparseHandle_t                 handle,
+                                                 hipStream_t                       stream,
+                                                 const spmat_convert_matrix&       A,
+                                                 std::vector<spmat_convert_entry>& entries)
+    {
+        std::vector<int64_t> ptr;
+        std::vector<int64_t> ind;
+        std::vector<int64_t> ind2;
+
+        switch(A.format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            const bool    csr = A.format == HIPSPARSE_FORMAT_CSR;
+            const int64_t n   = csr ? A.rows : A.cols;
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                copy_indices_to_host(handle, stream, A.ptr, A.ptr_type, n + 1, A.base, ptr));
+            RETURN_IF_HIPSPARSE_ERROR(
+                copy_indices_to_host(handle, stream, A.ind, A.ind_type, A.nnz, A.base, ind));
+
+            if(ptr[0] != 0 || ptr[n] != A.nnz)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            entries.resize(A.nnz);
+            for(int64_t i = 0; i < n; ++i)
+            {
+                if(ptr[i] > ptr[i + 1])
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                for(int64_t j = ptr[i]; j < ptr[i + 1]; ++j)
+                {
+                    entries[j] = csr ? spmat_convert_entry{i, ind[j], j}
+                                     : spmat_convert_entry{ind[j], i, j};
+                }
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_COO:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                copy_indices_to_host(handle, stream, A.ind, A.ind_type, A.nnz, A.base, ind));
+            RETURN_IF_HIPSPARSE_ERROR(
+                copy_indices_to_host(handle, stream, A.ind2, A.ind_type, A.nnz, A.base, ind2));
+
+            entries.resize(A.nnz);
+            for(int64_t j = 0; j < A.nnz; ++j)
+            {
+                entries[j] = spmat_convert_entry{ind[j], ind2[j], j};
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_COO_AOS:
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                copy_indices_to_host(handle, stream, A.ind, A.ind_type, 2 * A.nnz, A.base, ind));
+
+            entries.resize(A.nnz);
+            for(int64_t j = 0; j < A.nnz; ++j)
+            {
+                entries[j] = spmat_convert_entry{ind[2 * j], ind[2 * j + 1], j};
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_BLOCKED_ELL:
+        {
+            //
+            // Every entry of a stored block is converted, including explicit zeros. Block k of
+            // block row br is stored column by column at ((br * ell_blocks + k) * bs) * bs,
+            // blocks with column index -1 are padding.
+            //
+            const int64_t bs         = A.block_dim;
+            const int64_t mb         = (A.rows + bs - 1) / bs;
+            const int64_t ell_blocks = A.ell_cols / bs;
+
+            RETURN_IF_HIPSPARSE_ERROR(copy_indices_to_host(
+                handle, stream, A.ind, A.ind_type, mb * ell_blocks, A.base, ind));
+
+            entries.clear();
+            entries.reserve(A.size);
+            for(int64_t br = 0; br < mb; ++br)
+            {
+                for(int64_t k = 0; k < ell_blocks; ++k)
+                {
+                    const int64_t bc = ind[br * ell_blocks + k];
+                    if(bc < 0)
+                    {
+                        continue;
+                    }
+
+                    for(int64_t c = 0; c < bs; ++c)
+                    {
+                        for(int64_t r = 0; r < bs; ++r)
+                        {
+                            const int64_t row = br * bs + r;
+                            const int64_t col = bc * bs + c;
+
+                            if(row < A.rows && col < A.cols)
+                            {
+                                entries.push_back(spmat_convert_entry{
+                                    row, col, ((br * ell_blocks + k) * bs + c) * bs + r});
+                            }
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        default:
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+        }
+
+        for(const spmat_convert_entry& e : entries)
+        {
+            if(e.row < 0 || e.row >= A.rows || e.col < 0 || e.col >= A.cols)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Computes the pattern of B from the entries of A, sets the size of B and fills the maps of
+    // the values. The entries are sorted into the order of B, except for BLOCKED_ELL targets,
+    // where they keep the order of A and are placed into the blocks of B.
+    //
+    static void spmatConvertPattern(hipsparseSpMatConvertDescr_t      descr,
+                                    std::vector<spmat_convert_entry>& entries,
+                                    std::vector<int64_t>&             src,
+                                    std::vector<int64_t>&             dst)
+    {
+        spmat_convert_matrix& B = descr->B;
+
+        const int64_t nentries = static_cast<int64_t>(entries.size());
+
+        descr->ptr.clear();
+        descr->ind.clear();
+        descr->ind2.clear();
+
+        src.resize(nentries);
+        dst.resize(nentries);
+
+        if(B.format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+        {
+            const int64_t bs = B.block_dim;
+            const int64_t mb = (B.rows + bs - 1) / bs;
+
+            // Sorted block columns of every block row
+            std::vector<std::vector<int64_t>> blocks(mb);
+            for(const spmat_convert_entry& e : entries)
+            {
+                blocks[e.row / bs].push_back(e.col / bs);
+            }
+
+            int64_t ell_blocks = 0;
+            for(std::vector<int64_t>& b : blocks)
+            {
+                std::sort(b.begin(), b.end());
+                b.erase(std::unique(b.begin(), b.end()), b.end());
+                ell_blocks = std::max(ell_blocks, static_cast<int64_t>(b.size()));
+            }
+
+            descr->ind.assign(mb * ell_blocks, -1 - B.base);
+            for(int64_t br = 0; br < mb; ++br)
+            {
+                std::copy(blocks[br].begin(), blocks[br].end(), &descr->ind[br * ell_blocks]);
+            }
+
+            for(int64_t k = 0; k < nentries; ++k)
+            {
+                const spmat_convert_entry& e  = entries[k];
+                const std::vector<int64_t>& b = blocks[e.row / bs];
+
+                const int64_t slot
+                    = std::lower_bound(b.begin(), b.end(), e.col / bs) - b.begin();
+
+                src[k] = e.slot;
+                dst[k] = (((e.row / bs) * ell_blocks + slot) * bs + e.col % bs) * bs + e.row % bs;
+            }
+
+            B.nnz      = 0;
+            B.ell_cols = ell_blocks * bs;
+            B.size     = mb * B.ell_cols * bs;
+
+            return;
+        }
+
+        const bool by_col = B.format == HIPSPARSE_FORMAT_CSC;
+
+        std::stable_sort(entries.begin(),
+                         entries.end(),
+                         [by_col](const spmat_convert_entry& x, const spmat_convert_entry& y) {
+                             return by_col ? (x.col < y.col || (x.col == y.col && x.row < y.row))
+                                           : (x.row < y.row || (x.row == y.row && x.col < y.col));
+                         });
+
+        for(int64_t k = 0; k < nentries; ++k)
+        {
+            src[k] = entries[k].slot;
+            dst[k] = k;
+        }
+
+        B.nnz  = nentries;
+        B.size = nentries;
+
+        switch(B.format)
+        {
+        case HIPSPARSE_FORMAT_CSR:
+        case HIPSPARSE_FORMAT_CSC:
+        {
+            const int64_t n = by_col ? B.cols : B.rows;
+
+            descr->ptr.assign(n + 1, 0);
+            descr->ind.resize(nentries);
+            for(int64_t k = 0; k < nentries; ++k)
+            {
+                ++descr->ptr[(by_col ? entries[k].col : entries[k].row) + 1];
+                descr->ind[k] = by_col ? entries[k].row : entries[k].col;
+            }
+
+            for(int64_t i = 0; i < n; ++i)
+            {
+                descr->ptr[i + 1] += descr->ptr[i];
+            }
+            break;
+        }
+        case HIPSPARSE_FORMAT_COO:
+        {
+            descr->ind.resize(nentries);
+            descr->ind2.resize(nentries);
+            for(int64_t k = 0; k < nentries; ++k)
+            {
+                descr->ind[k]  = entries[k].row;
+                descr->ind2[k] = entries[k].col;
+            }
+            break;
+        }
+        default:
+        {
+            descr->ind.resize(2 * nentries);
+            for(int64_t k = 0; k < nentries; ++k)
+            {
+                descr->ind[2 * k]     = entries[k].row;
+                descr->ind[2 * k + 1] = entries[k].col;
+            }
+            break;
+        }
+        }
+    }
+
+    static bool spmatConvertIsIdentity(const std::vector<int64_t>& map, int64_t size)
+    {
+        if(static_cast<int64_t>(map.size()) != size)
+        {
+            return false;
+        }
+
+        for(int64_t k = 0; k < size; ++k)
+        {
+            if(map[k] != k)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static hipsparseStatus_t spmatConvertWriteIndices(hipsparseHandle_t                  handle,
+                                                      hipStream_t                        stream,
+                                                      const hipsparseSpMatConvertDescr_t descr,
+                                                      const spmat_convert_matrix&        B)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(copy_indices_to_device(
+            handle, stream, descr->ptr, B.base, B.ptr_type, const_cast<void*>(B.ptr)));
+        RETURN_IF_HIPSPARSE_ERROR(copy_indices_to_device(
+            handle, stream, descr->ind, B.base, B.ind_type, const_cast<void*>(B.ind)));
+        RETURN_IF_HIPSPARSE_ERROR(copy_indices_to_device(
+            handle, stream, descr->ind2, B.base, B.ind_type, const_cast<void*>(B.ind2)));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Moves the values of A into B with a gather through src, a scatter through dst, or both.
+    //
+    static hipsparseStatus_t spmatConvertValues(hipsparseHandle_t                  handle,
+                                                const hipsparseSpMatConvertDescr_t descr,
+                                                const spmat_convert_matrix&        A,
+                                                const spmat_convert_matrix&        B)
+    {
+        const rocsparse_datatype  datatype  = hipDataTypeToHCCDataType(A.value_type);
+        const rocsparse_indextype indextype = hipIndexTypeToHCCIndexType(descr->map_type);
+
+        void* values = descr->dst_identity ? const_cast<void*>(B.val) : descr->tmp;
+
+        if(!descr->src_identity)
+        {
+            rocsparse_const_dnvec_descr x;
+            rocsparse_spvec_descr       y;
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_const_dnvec_descr(&x, A.size, A.val, datatype));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_spvec_descr(&y,
+                                                                   A.size,
+                                                                   descr->entries,
+                                                                   descr->src,
+                                                                   values,
+                                                                   indextype,
+                                                                   rocsparse_index_base_zero,
+                                                                   datatype));
+
+            const hipsparseStatus_t status
+                = rocSPARSEStatusToHIPStatus(rocsparse_gather((rocsparse_handle)handle, x, y));
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_dnvec_descr(x));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_spvec_descr(y));
+            RETURN_IF_HIPSPARSE_ERROR(status);
+        }
+
+        if(!descr->dst_identity)
+        {
+            rocsparse_const_spvec_descr x;
+            rocsparse_dnvec_descr       y;
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_const_spvec_descr(&x,
+                                                   B.size,
+                                                   descr->entries,
+                                                   descr->dst,
+                                                   descr->src_identity ? A.val : descr->tmp,
+                                                   indextype,
+                                                   rocsparse_index_base_zero,
+                                                   datatype));
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_dnvec_descr(&y, B.size, const_cast<void*>(B.val), datatype));
+
+            const hipsparseStatus_t status
+                = rocSPARSEStatusToHIPStatus(rocsparse_scatter((rocsparse_handle)handle, x, y));
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_spvec_descr(x));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_dnvec_descr(y));
+            RETURN_IF_HIPSPARSE_ERROR(status);
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSpMatConvert_createDescr(hipsparseSpMatConvertDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseSpMatConvertDescr;
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatConvert_destroyDescr(hipsparseSpMatConvertDescr_t descr)
+{
+    // Check if info structure has been created
+    if(descr != nullptr)
+    {
+        delete descr;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatConvert_bufferSize(hipsparseHandle_t            handle,
+                                                   hipsparseConstSpMatDescr_t   matA,
+                                                   hipsparseConstSpMatDescr_t   matB,
+                                                   hipsparseSpMatConvertAlg_t   alg,
+                                                   hipsparseSpMatConvertDescr_t descr,
+                                                   size_t*                      pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || descr == nullptr
+       || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alg != HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::spmat_convert_matrix A, B;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::spmatConvertCheck(matA, matB, A, B));
+
+    // Every value of A is moved at most once, the maps hold 64 bit indices at most and values
+    // between two BLOCKED_ELL matrices are staged in between
+    const size_t entries = static_cast<size_t>(A.size);
+
+    *pBufferSizeInBytes = 2 * hipsparse::spmatConvertAlign(sizeof(int64_t) * entries);
+
+    if(A.format == HIPSPARSE_FORMAT_BLOCKED_ELL && B.format == HIPSPARSE_FORMAT_BLOCKED_ELL)
+    {
+        *pBufferSizeInBytes += hipsparse::spmatConvertAlign(
+            hipsparse::host_value_type_size(A.value_type) * entries);
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatConvert_analysis(hipsparseHandle_t            handle,
+                                                 hipsparseConstSpMatDescr_t   matA,
+                                                 hipsparseConstSpMatDescr_t   matB,
+                                                 hipsparseSpMatConvertAlg_t   alg,
+                                                 hipsparseSpMatConvertDescr_t descr,
+                                                 int64_t*                     pNnzB,
+                                                 void*                        externalBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || descr == nullptr
+       || pNnzB == nullptr || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alg != HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::spmat_convert_matrix A, B;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::spmatConvertCheck(matA, matB, A, B));
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    descr->analysed = false;
+
+    std::vector<hipsparse::spmat_convert_entry> entries;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::spmatConvertEntries(handle, stream, A, entries));
+
+    // Only the layout of A and B is kept, their arrays are looked up again by the conversion
+    A.ptr = A.ind = A.ind2 = A.val = nullptr;
+    B.ptr = B.ind = B.ind2 = B.val = nullptr;
+
+    descr->A = A;
+    descr->B = B;
+
+    std::vector<int64_t> src, dst;
+    hipsparse::spmatConvertPattern(descr, entries, src, dst);
+
+    descr->entries      = static_cast<int64_t>(src.size());
+    descr->src_identity = hipsparse::spmatConvertIsIdentity(src, descr->A.size);
+    descr->dst_identity = hipsparse::spmatConvertIsIdentity(dst, descr->B.size);
+    descr->map_type
+        = (std::max(descr->A.size, descr->B.size) > std::numeric_limits<int32_t>::max())
+              ? HIPSPARSE_INDEX_64I
+              : HIPSPARSE_INDEX_32I;
+
+    const size_t map_size = hipsparse::spmatConvertAlign(sizeof(int64_t) * descr->A.size);
+
+    descr->buffer = externalBuffer;
+    descr->src    = externalBuffer;
+    descr->dst    = static_cast<char*>(externalBuffer) + map_size;
+    descr->tmp    = static_cast<char*>(externalBuffer) + 2 * map_size;
+
+    if(!descr->src_identity)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::copy_indices_to_device(handle, stream, src, 0, descr->map_type, descr->src));
+    }
+
+    if(!descr->dst_identity)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::copy_indices_to_device(handle, stream, dst, 0, descr->map_type, descr->dst));
+    }
+
+    descr->written_ptr  = nullptr;
+    descr->written_ind  = nullptr;
+    descr->written_ind2 = nullptr;
+    descr->analysed     = true;
+
+    *pNnzB = (descr->B.format == HIPSPARSE_FORMAT_BLOCKED_ELL) ? descr->B.ell_cols : descr->B.nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSpMatConvert(hipsparseHandle_t            handle,
+                                        hipsparseConstSpMatDescr_t   matA,
+                                        hipsparseSpMatDescr_t        matB,
+                                        hipsparseSpMatConvertAlg_t   alg,
+                                        hipsparseSpMatConvertDescr_t descr,
+                                        void*                        externalBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || matA == nullptr || matB == nullptr || descr == nullptr
+       || externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alg != HIPSPARSE_SPMAT_CONVERT_ALG_DEFAULT)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!descr->analysed)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    hipsparse::spmat_convert_matrix A, B;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::spmatConvertCheck(matA, matB, A, B));
+
+    if(!hipsparse::spmatConvertSameLayout(A, descr->A)
+       || !hipsparse::spmatConvertSameLayout(B, descr->B) || externalBuffer != descr->buffer)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+    // The pattern of B only has to be written once for the same arrays
+    if(B.ptr != descr->written_ptr || B.ind != descr->written_ind
+       || B.ind2 != descr->written_ind2)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::spmatConvertWriteIndices(handle, stream, descr, B));
+
+        descr->written_ptr  = B.ptr;
+        descr->written_ind  = B.ind;
+        descr->written_ind2 = B.ind2;
+    }
+
+    const size_t value_size = hipsparse::host_value_type_size(A.value_type);
+
+    // Padding of B is zero
+    if(!descr->dst_identity && B.size > 0)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(const_cast<void*>(B.val), 0, value_size * B.size, stream));
+    }
+
+    if(descr->entries == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(descr->src_identity && descr->dst_identity)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(const_cast<void*>(B.val),
+                                           A.val,
+                                           value_size * descr->entries,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    return hipsparse::spmatConvertValues(handle, descr, A, B);
+}
@@ -30,6 +30,50 @@
 
 #include "../utility.h"
 
+//
+// Products rocSPARSE does not compute are not supported: matrices in the SELL-C-sigma and DIA
+// formats, which it has no kernels for, and symmetric or Hermitian matrices, which rocsparse_spmm
+// only multiplies as general matrices.
+//
+static bool hipsparseSpMMIsSupported(hipsparseConstSpMatDescr_t matA)
+{
+    if(matA == nullptr)
+    {
+        return true;
+    }
+
+    hipsparseMatrixType_t matrix_type;
+    hipsparseFillMode_t   fill_mode;
+    return matA->get_host_spmat() == nullptr
+           && hipsparse::get_spmat_matrix_type(matA, &matrix_type, &fill_mode)
+                  == HIPSPARSE_STATUS_SUCCESS
+           && matrix_type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+           && matrix_type != HIPSPARSE_MATRIX_TYPE_HERMITIAN;
+}
+
+//
+// ELL matrices, which rocsparse_spmm does not accept, are multiplied through their device copy.
+// Returns null for all other matrices.
+//
+static const hipsparse::host_spmat* hipsparseSpMMHostMatrix(hipsparseConstSpMatDescr_t matA,
+                                                            hipsparse::host_spmat&     view)
+{
+    if(matA == nullptr)
+    {
+        return nullptr;
+    }
+
+    hipsparseFormat_t format;
+    if(hipsparseSpMatGetFormat(matA, &format) != HIPSPARSE_STATUS_SUCCESS
+       || format != HIPSPARSE_FORMAT_ELL)
+    {
+        return nullptr;
+    }
+
+    return (hipsparse::get_ell_host_spmat(matA, view) == HIPSPARSE_STATUS_SUCCESS) ? &view
+                                                                                   : nullptr;
+}
+
 hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseOperation_t        opA,
                                            hipsparseOperation_t        opB,
@@ -42,6 +86,28 @@ hipsparseStatus_t hipsparseSpMM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
+    if(!hipsparseSpMMIsSupported(matA))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    //
+    // The device copy of a matrix rocsparse_spmm does not accept holds its own buffer.
+    //
+    hipsparse::host_spmat view;
+    if(hipsparseSpMMHostMatrix(matA, view) != nullptr)
+    {
+        if(pBufferSizeInBytes == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        pBufferSizeInBytes[0] = 0;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
@@ -70,6 +136,25 @@ hipsparseStatus_t hipsparseSpMM_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMMAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
+    if(!hipsparseSpMMIsSupported(matA))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparse::host_spmat        view;
+    const hipsparse::host_spmat* host_matA = hipsparseSpMMHostMatrix(matA, view);
+    if(host_matA != nullptr)
+    {
+        if(handle == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparse::host_spmat_prepare(handle, matA, *host_matA);
+    }
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
@@ -99,6 +184,27 @@ hipsparseStatus_t hipsparseSpMM(hipsparseHandle_t           handle,
                                 hipsparseSpMMAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
+    if(!hipsparseSpMMIsSupported(matA))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparse::host_spmat        view;
+    const hipsparse::host_spmat* host_matA = hipsparseSpMMHostMatrix(matA, view);
+    if(host_matA != nullptr)
+    {
+        if(handle == nullptr || alpha == nullptr || matB == nullptr || beta == nullptr
+           || matC == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        return hipsparse::host_spmat_spmm(
+            handle, opA, opB, alpha, matA, *host_matA, matB, beta, matC, computeType);
+    }
+
     size_t bufferSize;
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmm((rocsparse_handle)handle,
@@ -28,8 +28,571 @@
 #include <hip/hip_runtime_api.h>
 #include <rocsparse/rocsparse.h>
 
+#include "../hipsparse_graph.h"
 #include "../utility.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+//
+// Fallback algorithm: replace algorithms rocSPARSE does not support for the requested
+// operation or matrix type with adaptive.
+//
+// The SpMV plan stored in the sparse matrix descriptor is keyed by the algorithm requested
+// by the user, i.e. before the fallback is applied, so that hipsparseSpMV_bufferSize,
+// hipsparseSpMV_preprocess and hipsparseSpMV always resolve to the same plan.
+//
+static hipsparseStatus_t hipsparseSpMVFallbackAlg(hipsparseConstSpMatDescr_t matA,
+                                                  rocsparse_operation        operation,
+                                                  rocsparse_spmv_alg*        spmv_alg)
+{
+    if(spmv_alg[0] == rocsparse_spmv_alg_csr_lrb)
+    {
+        rocsparse_matrix_type matrix_type;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(matA),
+                                          rocsparse_spmat_matrix_type,
+                                          &matrix_type,
+                                          sizeof(matrix_type)));
+
+        if((matrix_type == rocsparse_matrix_type_symmetric)
+           || (operation != rocsparse_operation_none))
+        {
+            spmv_alg[0] = rocsparse_spmv_alg_csr_adaptive;
+        }
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Select the algorithm for HIPSPARSE_SPMV_ALG_DEFAULT. For CSR matrices, the algorithm is chosen
+// from the row length statistics of the matrix. The statistics require a copy of the row pointer
+// to the host, they are computed once per sparsity pattern and cached in the sparse matrix
+// descriptor. If the handle stream is being captured into a graph and the statistics are not
+// cached yet, rocSPARSE's default algorithm is used. The HIPSPARSE_SPMV_DEFAULT_ALG environment
+// variable pins a path (stream, adaptive, lrb or coo) or rocSPARSE's default algorithm (default)
+// instead. The selected algorithm is stored in the SpMV plan.
+//
+// The COO path expands the CSR row pointer into COO row indices that are stored in the external
+// buffer of the user, see hipsparseSpMVCooRowIndices. It is therefore only taken when the buffer
+// size is queried, i.e. if buffer_size_query is true, and falls back to adaptive otherwise.
+//
+static hipsparseStatus_t hipsparseSpMVSelectAlg(hipsparseHandle_t          handle,
+                                                hipsparseConstSpMatDescr_t matA,
+                                                rocsparse_operation        operation,
+                                                bool                       buffer_size_query,
+                                                hipsparseSpMVDescr_st*     hip_spmv_descr,
+                                                rocsparse_spmv_alg*        spmv_alg)
+{
+    if(spmv_alg[0] != rocsparse_spmv_alg_default)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(hip_spmv_descr->is_alg_selected())
+    {
+        spmv_alg[0] = hip_spmv_descr->get_selected_alg();
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparse::spmv_path path;
+    if(hipsparse::parse_spmv_path(std::getenv("HIPSPARSE_SPMV_DEFAULT_ALG"), &path) == false)
+    {
+        path = hipsparse::spmv_path_auto;
+    }
+
+    if(path == hipsparse::spmv_path_default)
+    {
+        hip_spmv_descr->set_selected_alg(rocsparse_spmv_alg_default);
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_format(to_rocsparse_const_spmat_descr(matA), &format));
+
+    int batch_count;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_strided_batch(to_rocsparse_const_spmat_descr(matA), &batch_count));
+
+    if(format != rocsparse_format_csr || batch_count > 1)
+    {
+        hip_spmv_descr->set_selected_alg(rocsparse_spmv_alg_default);
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          csr_row_ptr;
+    const void*          csr_col_ind;
+    const void*          csr_val;
+    rocsparse_indextype  hcc_row_index_type;
+    rocsparse_indextype  hcc_col_index_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                      &rows,
+                                                      &cols,
+                                                      &nnz,
+                                                      &csr_row_ptr,
+                                                      &csr_col_ind,
+                                                      &csr_val,
+                                                      &hcc_row_index_type,
+                                                      &hcc_col_index_type,
+                                                      &hcc_index_base,
+                                                      &hcc_data_type));
+
+    rocsparse_matrix_type matrix_type;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(matA),
+                                                            rocsparse_spmat_matrix_type,
+                                                            &matrix_type,
+                                                            sizeof(matrix_type)));
+
+    const bool coo_available = buffer_size_query
+                               && (hcc_row_index_type == rocsparse_indextype_i32)
+                               && (hcc_col_index_type == rocsparse_indextype_i32) && (nnz > 0)
+                               && (matrix_type == rocsparse_matrix_type_general);
+
+    if(path == hipsparse::spmv_path_auto)
+    {
+        if(matA->has_row_statistics() == false)
+        {
+            hipStream_t stream;
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+            // The row pointer cannot be copied to the host while the stream is being captured
+            if(hipsparse::check_stream_not_capturing(stream) != HIPSPARSE_STATUS_SUCCESS)
+            {
+                hip_spmv_descr->set_selected_alg(rocsparse_spmv_alg_default);
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+
+            std::vector<int64_t> hcsr_row_ptr;
+            RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+                handle,
+                stream,
+                csr_row_ptr,
+                (hcc_row_index_type == rocsparse_indextype_i32) ? HIPSPARSE_INDEX_32I
+                                                                : HIPSPARSE_INDEX_64I,
+                rows + 1,
+                0,
+                hcsr_row_ptr));
+
+            matA->set_row_statistics(
+                hipsparse::compute_spmv_row_statistics(rows, hcsr_row_ptr.data()));
+        }
+
+        path = hipsparse::select_spmv_path(matA->get_row_statistics(),
+                                           operation != rocsparse_operation_none,
+                                           matrix_type == rocsparse_matrix_type_symmetric,
+                                           coo_available);
+    }
+
+    if(path == hipsparse::spmv_path_coo && coo_available == false)
+    {
+        path = hipsparse::spmv_path_adaptive;
+    }
+
+    switch(path)
+    {
+    case hipsparse::spmv_path_stream:
+        spmv_alg[0] = rocsparse_spmv_alg_csr_stream;
+        break;
+    case hipsparse::spmv_path_adaptive:
+    case hipsparse::spmv_path_auto:
+        spmv_alg[0] = rocsparse_spmv_alg_csr_adaptive;
+        break;
+    case hipsparse::spmv_path_default:
+        spmv_alg[0] = rocsparse_spmv_alg_default;
+        break;
+    case hipsparse::spmv_path_lrb:
+        spmv_alg[0] = rocsparse_spmv_alg_csr_lrb;
+        break;
+    case hipsparse::spmv_path_coo:
+    {
+        //
+        // The row indices are bound by hipsparseSpMVCooRowIndices once the external buffer is
+        // known, the column indices stand in for them until then.
+        //
+        rocsparse_spmat_descr coo_descr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_coo_descr(&coo_descr,
+                                                             rows,
+                                                             cols,
+                                                             nnz,
+                                                             (void*)csr_col_ind,
+                                                             (void*)csr_col_ind,
+                                                             (void*)csr_val,
+                                                             rocsparse_indextype_i32,
+                                                             hcc_index_base,
+                                                             hcc_data_type));
+        hip_spmv_descr->set_spmv_descr(coo_descr);
+
+        spmv_alg[0] = rocsparse_spmv_alg_coo;
+        break;
+    }
+    }
+
+    hip_spmv_descr->set_selected_alg(spmv_alg[0]);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Offset of the COO row indices in the external buffer, they follow the analysis buffer.
+//
+static size_t hipsparseSpMVCooRowOffset(size_t buffer_size_stage_analysis)
+{
+    return (buffer_size_stage_analysis + 255) / 256 * 256;
+}
+
+//
+// Expand the CSR row pointer of A into the COO row indices of a plan that selected the COO path.
+// The indices live in the external buffer behind the analysis buffer, the expansion runs on the
+// handle stream and is repeated whenever a different external buffer is passed.
+//
+static hipsparseStatus_t hipsparseSpMVCooRowIndices(hipsparseHandle_t          handle,
+                                                    hipsparseConstSpMatDescr_t matA,
+                                                    hipsparseSpMVDescr_st*     hip_spmv_descr,
+                                                    void*                      externalBuffer)
+{
+    if(hip_spmv_descr->is_alg_selected() == false
+       || hip_spmv_descr->get_selected_alg() != rocsparse_spmv_alg_coo)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(externalBuffer == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    void* coo_row_ind = static_cast<char*>(externalBuffer)
+                        + hipsparseSpMVCooRowOffset(
+                            hip_spmv_descr->get_buffer_size_stage_analysis());
+
+    if(coo_row_ind == hip_spmv_descr->get_coo_row_ind())
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          csr_row_ptr;
+    const void*          csr_col_ind;
+    const void*          csr_val;
+    rocsparse_indextype  hcc_row_index_type;
+    rocsparse_indextype  hcc_col_index_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                      &rows,
+                                                      &cols,
+                                                      &nnz,
+                                                      &csr_row_ptr,
+                                                      &csr_col_ind,
+                                                      &csr_val,
+                                                      &hcc_row_index_type,
+                                                      &hcc_col_index_type,
+                                                      &hcc_index_base,
+                                                      &hcc_data_type));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2coo((rocsparse_handle)handle,
+                                                (const rocsparse_int*)csr_row_ptr,
+                                                (rocsparse_int)nnz,
+                                                (rocsparse_int)rows,
+                                                (rocsparse_int*)coo_row_ind,
+                                                hcc_index_base));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo_set_pointers(
+        hip_spmv_descr->get_spmv_descr(), coo_row_ind, (void*)csr_col_ind, (void*)csr_val));
+
+    hip_spmv_descr->set_coo_row_ind(coo_row_ind);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Matrix descriptor the SpMV plan operates on, i.e. the COO expansion of A if the plan selected
+// the COO path and a private copy of the descriptor of A otherwise. rocSPARSE stores the SpMV
+// analysis inside the matrix descriptor, plans of different operations or algorithms must
+// therefore not share it. The copy is created on first use and shares the arrays of A.
+//
+static hipsparseStatus_t hipsparseSpMVGetMatrix(hipsparseConstSpMatDescr_t   matA,
+                                                hipsparseSpMVDescr_st*       hip_spmv_descr,
+                                                rocsparse_const_spmat_descr* mat)
+{
+    if(hip_spmv_descr->get_spmv_descr() == nullptr)
+    {
+        rocsparse_spmat_descr clone;
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparse::clone_spmat_descr(to_rocsparse_const_spmat_descr(matA), &clone));
+        hip_spmv_descr->set_spmv_descr(clone);
+    }
+
+    mat[0] = (hip_spmv_descr->get_spmv_descr() != nullptr) ? hip_spmv_descr->get_spmv_descr()
+                                                           : to_rocsparse_const_spmat_descr(matA);
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// True if A, x or y is a strided batch.
+//
+static hipsparseStatus_t hipsparseSpMVIsStridedBatched(hipsparseConstSpMatDescr_t matA,
+                                                       hipsparseConstDnVecDescr_t vecX,
+                                                       hipsparseConstDnVecDescr_t vecY,
+                                                       bool*                      batched)
+{
+    int batch_count_A;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_strided_batch(to_rocsparse_const_spmat_descr(matA), &batch_count_A));
+
+    batched[0] = (batch_count_A > 1) || (hipsparse::get_dnvec_strided_batch(vecX).batch_count > 1)
+                 || (hipsparse::get_dnvec_strided_batch(vecY).batch_count > 1);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Single column dense matrix viewing vec, with the strided batch of vec. rocSPARSE dense vector
+// descriptors do not carry a batch, dense matrix descriptors do.
+//
+static hipsparseStatus_t hipsparseSpMVBatchedDnMat(hipsparseConstDnVecDescr_t vec,
+                                                   rocsparse_dnmat_descr*     mat)
+{
+    int64_t            size;
+    const void*        values;
+    rocsparse_datatype datatype;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_const_dnvec_get(to_rocsparse_const_dnvec_descr(vec), &size, &values, &datatype));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_dnmat_descr(mat,
+                                                           size,
+                                                           1,
+                                                           std::max(size, int64_t(1)),
+                                                           (void*)values,
+                                                           datatype,
+                                                           rocsparse_order_column));
+
+    const hipsparse::dnvec_strided_batch batch = hipsparse::get_dnvec_strided_batch(vec);
+    if(batch.batch_count > 1)
+    {
+        const rocsparse_status status
+            = rocsparse_dnmat_set_strided_batch(*mat, batch.batch_count, batch.batch_stride);
+        if(status != rocsparse_status_success)
+        {
+            rocsparse_destroy_dnmat_descr(*mat);
+            return hipsparse::rocSPARSEStatusToHIPStatus(status);
+        }
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Strided batched SpMV. rocSPARSE SpMV does not support batches, the batches of x and y are
+// passed to the batched SpMM as batches of single column dense matrices instead. The batch of A
+// is the strided batch of its rocSPARSE descriptor. Supported are CSR and COO matrices, with
+// y_i = A * x_i, y_i = A_i * x or y_i = A_i * x_i.
+//
+static hipsparseStatus_t hipsparseSpMVStridedBatched(hipsparseHandle_t          handle,
+                                                     rocsparse_operation        operation,
+                                                     const void*                alpha,
+                                                     hipsparseConstSpMatDescr_t matA,
+                                                     hipsparseConstDnVecDescr_t vecX,
+                                                     const void*                beta,
+                                                     hipsparseConstDnVecDescr_t vecY,
+                                                     rocsparse_datatype         datatype,
+                                                     rocsparse_spmm_stage       stage,
+                                                     size_t*                    buffer_size,
+                                                     void*                      buffer)
+{
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_format(to_rocsparse_const_spmat_descr(matA), &format));
+
+    if(format != rocsparse_format_csr && format != rocsparse_format_coo)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int batch_count_A;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_strided_batch(to_rocsparse_const_spmat_descr(matA), &batch_count_A));
+
+    const hipsparse::dnvec_strided_batch batch_x = hipsparse::get_dnvec_strided_batch(vecX);
+    const hipsparse::dnvec_strided_batch batch_y = hipsparse::get_dnvec_strided_batch(vecY);
+
+    //
+    // Every product writes its own y_i, A and x are either shared by all products or batched
+    // like y.
+    //
+    if((batch_count_A != 1 && batch_count_A != batch_y.batch_count)
+       || (batch_x.batch_count != 1 && batch_x.batch_count != batch_y.batch_count)
+       || (batch_count_A == 1 && batch_x.batch_count == 1))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const rocsparse_spmm_alg spmm_alg = (format == rocsparse_format_csr)
+                                            ? rocsparse_spmm_alg_csr
+                                            : rocsparse_spmm_alg_coo_atomic;
+
+    rocsparse_dnmat_descr X;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVBatchedDnMat(vecX, &X));
+
+    rocsparse_dnmat_descr Y;
+    hipsparseStatus_t     hip_status = hipsparseSpMVBatchedDnMat(vecY, &Y);
+    if(hip_status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        rocsparse_destroy_dnmat_descr(X);
+        return hip_status;
+    }
+
+    const rocsparse_status status = rocsparse_spmm((rocsparse_handle)handle,
+                                                   operation,
+                                                   rocsparse_operation_none,
+                                                   alpha,
+                                                   to_rocsparse_const_spmat_descr(matA),
+                                                   X,
+                                                   beta,
+                                                   Y,
+                                                   datatype,
+                                                   spmm_alg,
+                                                   stage,
+                                                   buffer_size,
+                                                   buffer);
+    rocsparse_destroy_dnmat_descr(X);
+    rocsparse_destroy_dnmat_descr(Y);
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+}
+
+//
+// Run the preprocessing of a strided batched SpMV plan with the external buffer of the user.
+// This happens on the first call with the plan and again if a different buffer is passed. The
+// size of the buffer is returned in buffer_size.
+//
+static hipsparseStatus_t hipsparseSpMVBatchedPreprocess(hipsparseHandle_t          handle,
+                                                        rocsparse_operation        operation,
+                                                        const void*                alpha,
+                                                        hipsparseConstSpMatDescr_t matA,
+                                                        hipsparseConstDnVecDescr_t vecX,
+                                                        const void*                beta,
+                                                        hipsparseConstDnVecDescr_t vecY,
+                                                        rocsparse_datatype         datatype,
+                                                        hipsparseSpMVDescr_st*     hip_spmv_descr,
+                                                        size_t*                    buffer_size,
+                                                        void*                      buffer)
+{
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVStridedBatched(handle,
+                                                          operation,
+                                                          alpha,
+                                                          matA,
+                                                          vecX,
+                                                          beta,
+                                                          vecY,
+                                                          datatype,
+                                                          rocsparse_spmm_stage_buffer_size,
+                                                          buffer_size,
+                                                          nullptr));
+
+    if(hip_spmv_descr->is_batched_stage_preprocess_called()
+       && hip_spmv_descr->get_batched_buffer() == buffer)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // The preprocessing cannot be captured into a graph
+    hipsparse::stream_capture_bypass setup_bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVStridedBatched(handle,
+                                                          operation,
+                                                          alpha,
+                                                          matA,
+                                                          vecX,
+                                                          beta,
+                                                          vecY,
+                                                          datatype,
+                                                          rocsparse_spmm_stage_preprocess,
+                                                          buffer_size,
+                                                          buffer));
+    hip_spmv_descr->batched_stage_preprocess_called(buffer);
+
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.finish());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Operation rocSPARSE applies to matA. A symmetric matrix equals its transpose, and a real one
+// also its conjugate transpose, so these products of a symmetric CSR matrix are computed without
+// transposition, which rocSPARSE supports from half storage.
+//
+static hipsparseOperation_t hipsparseSpMVOperation(hipsparseConstSpMatDescr_t matA,
+                                                   hipsparseOperation_t       opA)
+{
+    hipsparseFormat_t     format;
+    hipsparse::host_spmat csr;
+    if(opA == HIPSPARSE_OPERATION_NON_TRANSPOSE || matA->get_host_spmat() != nullptr
+       || hipsparseSpMatGetFormat(matA, &format) != HIPSPARSE_STATUS_SUCCESS
+       || format != HIPSPARSE_FORMAT_CSR
+       || hipsparse::get_csr_host_spmat(matA, csr) != HIPSPARSE_STATUS_SUCCESS
+       || csr.matrix_type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC)
+    {
+        return opA;
+    }
+
+    if(opA == HIPSPARSE_OPERATION_TRANSPOSE
+       || (csr.value_type != HIP_C_32F && csr.value_type != HIP_C_64F))
+    {
+        return HIPSPARSE_OPERATION_NON_TRANSPOSE;
+    }
+
+    return opA;
+}
+
+//
+// Products rocSPARSE does not compute are not supported: matrices in the SELL-C-sigma and DIA
+// formats, which it has no kernels for, and symmetric or Hermitian matrices, except for symmetric
+// CSR matrices whose product is computed without transposition, see hipsparseSpMVOperation.
+//
+static hipsparseStatus_t hipsparseSpMVCheckMatrix(hipsparseConstSpMatDescr_t matA,
+                                                  hipsparseOperation_t       opA)
+{
+    if(matA->get_host_spmat() != nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    hipsparseFormat_t     format;
+    hipsparseMatrixType_t matrix_type;
+    hipsparseFillMode_t   fill_mode;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matA, &format));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::get_spmat_matrix_type(matA, &matrix_type, &fill_mode));
+
+    if(matrix_type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+       && matrix_type != HIPSPARSE_MATRIX_TYPE_HERMITIAN)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(format != HIPSPARSE_FORMAT_CSR || matrix_type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+       || hipsparseSpMVOperation(matA, opA) != HIPSPARSE_OPERATION_NON_TRANSPOSE)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseOperation_t        opA,
                                            const void*                 alpha,
@@ -41,6 +604,7 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
 
     if(handle == nullptr)
     {
@@ -77,35 +641,48 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVCheckMatrix(matA, opA));
+
+    opA = hipsparseSpMVOperation(matA, opA);
+
     const rocsparse_datatype  datatype  = hipsparse::hipDataTypeToHCCDataType(computeType);
     const rocsparse_operation operation = hipsparse::hipOperationToHCCOperation(opA);
     rocsparse_spmv_alg        spmv_alg  = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
 
-    //
-    // Fallback algorithm: replace unsupported rocsparse_spmv_alg_csr_rowsplit with adaptive
-    //
-    if(spmv_alg == rocsparse_spmv_alg_csr_lrb)
-    {
-        rocsparse_matrix_type matrix_type;
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(matA),
-                                          rocsparse_spmat_matrix_type,
-                                          &matrix_type,
-                                          sizeof(matrix_type)));
+    hipsparseSpMVDescr_st* hip_spmv_descr
+        = matA->get_hip_spmv_descr(operation, spmv_alg, datatype);
 
-        if((matrix_type == rocsparse_matrix_type_symmetric)
-           || (operation != rocsparse_operation_none))
-        {
-            spmv_alg = rocsparse_spmv_alg_csr_adaptive;
-        }
-    }
-    else if((spmv_alg == rocsparse_spmv_alg_csr_adaptive)
-            && (operation != rocsparse_operation_none))
+    bool batched;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVIsStridedBatched(matA, vecX, vecY, &batched));
+
+    if(batched)
     {
-        spmv_alg = rocsparse_spmv_alg_csr_adaptive;
+        return hipsparseSpMVStridedBatched(handle,
+                                           operation,
+                                           alpha,
+                                           matA,
+                                           vecX,
+                                           beta,
+                                           vecY,
+                                           datatype,
+                                           rocsparse_spmm_stage_buffer_size,
+                                           pBufferSizeInBytes,
+                                           nullptr);
     }
 
-    hipsparseSpMVDescr_st* hip_spmv_descr = matA->get_hip_spmv_descr();
+    //
+    // Selecting the algorithm might copy the row pointer to the host, keep it out of a stream
+    // capture.
+    //
+    hipsparse::stream_capture_bypass setup_bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMVSelectAlg(handle, matA, operation, true, hip_spmv_descr, &spmv_alg));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVFallbackAlg(matA, operation, &spmv_alg));
+
+    rocsparse_const_spmat_descr mat;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVGetMatrix(matA, hip_spmv_descr, &mat));
 
     //
     // Buffer size for the analysis phase.
@@ -113,10 +690,10 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
                                              operation,
                                              alpha,
-                                             to_rocsparse_const_spmat_descr(matA),
-                                             (rocsparse_const_dnvec_descr)vecX,
+                                             mat,
+                                             to_rocsparse_const_dnvec_descr(vecX),
                                              beta,
-                                             (rocsparse_dnvec_descr)vecY,
+                                             to_rocsparse_dnvec_descr(vecY),
                                              datatype,
                                              spmv_alg,
                                              rocsparse_spmv_stage_buffer_size,
@@ -126,6 +703,23 @@ hipsparseStatus_t hipsparseSpMV_bufferSize(hipsparseHandle_t           handle,
     hip_spmv_descr->set_buffer_size_stage_analysis(pBufferSizeInBytes[0]);
     hip_spmv_descr->buffer_size_called();
 
+    //
+    // The COO path stores its row indices in the external buffer, behind the analysis buffer.
+    //
+    if(hip_spmv_descr->is_alg_selected()
+       && hip_spmv_descr->get_selected_alg() == rocsparse_spmv_alg_coo)
+    {
+        int64_t rows;
+        int64_t cols;
+        int64_t nnz;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_size(mat, &rows, &cols, &nnz));
+
+        pBufferSizeInBytes[0]
+            = hipsparseSpMVCooRowOffset(pBufferSizeInBytes[0]) + sizeof(int32_t) * nnz;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.finish());
+
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -140,6 +734,8 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
                                            hipsparseSpMVAlg_t          alg,
                                            void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
+
     if(handle == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -170,51 +766,68 @@ hipsparseStatus_t hipsparseSpMV_preprocess(hipsparseHandle_t           handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVCheckMatrix(matA, opA));
+
+    opA = hipsparseSpMVOperation(matA, opA);
+
     const rocsparse_datatype  datatype  = hipsparse::hipDataTypeToHCCDataType(computeType);
     const rocsparse_operation operation = hipsparse::hipOperationToHCCOperation(opA);
     rocsparse_spmv_alg        spmv_alg  = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
 
-    //
-    // Fallback algorithm: replace unsupported rocsparse_spmv_alg_csr_rowsplit with adaptive
-    //
-    if(spmv_alg == rocsparse_spmv_alg_csr_lrb)
-    {
-        rocsparse_matrix_type matrix_type;
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(matA),
-                                          rocsparse_spmat_matrix_type,
-                                          &matrix_type,
-                                          sizeof(matrix_type)));
+    hipsparseSpMVDescr_st* hip_spmv_descr
+        = matA->get_hip_spmv_descr(operation, spmv_alg, datatype);
 
-        if((matrix_type == rocsparse_matrix_type_symmetric)
-           || (operation != rocsparse_operation_none))
-        {
-            spmv_alg = rocsparse_spmv_alg_csr_adaptive;
-        }
-    }
-    else if((spmv_alg == rocsparse_spmv_alg_csr_adaptive)
-            && (operation != rocsparse_operation_none))
+    bool batched;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVIsStridedBatched(matA, vecX, vecY, &batched));
+
+    if(batched)
     {
-        spmv_alg = rocsparse_spmv_alg_csr_adaptive;
+        size_t buffer_size;
+        return hipsparseSpMVBatchedPreprocess(handle,
+                                              operation,
+                                              alpha,
+                                              matA,
+                                              vecX,
+                                              beta,
+                                              vecY,
+                                              datatype,
+                                              hip_spmv_descr,
+                                              &buffer_size,
+                                              externalBuffer);
     }
 
-    hipsparseSpMVDescr_st* hip_spmv_descr = matA->get_hip_spmv_descr();
+    //
+    // The analysis cannot be captured, it runs once on a side stream.
+    //
+    hipsparse::stream_capture_bypass setup_bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMVSelectAlg(handle, matA, operation, false, hip_spmv_descr, &spmv_alg));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVFallbackAlg(matA, operation, &spmv_alg));
+
+    rocsparse_const_spmat_descr mat;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVGetMatrix(matA, hip_spmv_descr, &mat));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMVCooRowIndices(handle, matA, hip_spmv_descr, externalBuffer));
 
     size_t buffer_size = hip_spmv_descr->get_buffer_size_stage_analysis();
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
                                              operation,
                                              alpha,
-                                             to_rocsparse_const_spmat_descr(matA),
-                                             (rocsparse_const_dnvec_descr)vecX,
+                                             mat,
+                                             to_rocsparse_const_dnvec_descr(vecX),
                                              beta,
-                                             (rocsparse_dnvec_descr)vecY,
+                                             to_rocsparse_dnvec_descr(vecY),
                                              datatype,
                                              spmv_alg,
                                              rocsparse_spmv_stage_preprocess,
                                              &buffer_size,
                                              externalBuffer));
     hip_spmv_descr->stage_analysis_called();
+
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.finish());
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -229,6 +842,8 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                                 hipsparseSpMVAlg_t          alg,
                                 void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
+
     if(handle == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -259,38 +874,69 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
 
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVCheckMatrix(matA, opA));
+
+    opA = hipsparseSpMVOperation(matA, opA);
+
     const rocsparse_datatype  datatype  = hipsparse::hipDataTypeToHCCDataType(computeType);
     const rocsparse_operation operation = hipsparse::hipOperationToHCCOperation(opA);
     rocsparse_spmv_alg        spmv_alg  = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
 
-    hipsparseSpMVDescr_st* hip_spmv_descr = matA->get_hip_spmv_descr();
+    hipsparseSpMVDescr_st* hip_spmv_descr
+        = matA->get_hip_spmv_descr(operation, spmv_alg, datatype);
 
-    if(spmv_alg == rocsparse_spmv_alg_csr_lrb)
-    {
-        rocsparse_matrix_type matrix_type;
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(matA),
-                                          rocsparse_spmat_matrix_type,
-                                          &matrix_type,
-                                          sizeof(matrix_type)));
-        if((matrix_type == rocsparse_matrix_type_symmetric)
-           || (operation != rocsparse_operation_none))
-        {
-            spmv_alg = rocsparse_spmv_alg_csr_adaptive;
-        }
-    }
-    else if((spmv_alg == rocsparse_spmv_alg_csr_adaptive)
-            && (operation != rocsparse_operation_none))
-    {
-        spmv_alg = rocsparse_spmv_alg_csr_adaptive;
-    }
-    else if(((spmv_alg == rocsparse_spmv_alg_csr_adaptive)
-             || (spmv_alg == rocsparse_spmv_alg_csr_lrb))
-            && (hip_spmv_descr->is_stage_analysis_called() == false))
+    bool batched;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVIsStridedBatched(matA, vecX, vecY, &batched));
+
+    if(batched)
     {
-        spmv_alg = rocsparse_spmv_alg_csr_adaptive;
+        size_t buffer_size;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVBatchedPreprocess(handle,
+                                                                 operation,
+                                                                 alpha,
+                                                                 matA,
+                                                                 vecX,
+                                                                 beta,
+                                                                 vecY,
+                                                                 datatype,
+                                                                 hip_spmv_descr,
+                                                                 &buffer_size,
+                                                                 externalBuffer));
+
+        return hipsparseSpMVStridedBatched(handle,
+                                           operation,
+                                           alpha,
+                                           matA,
+                                           vecX,
+                                           beta,
+                                           vecY,
+                                           datatype,
+                                           rocsparse_spmm_stage_compute,
+                                           &buffer_size,
+                                           externalBuffer);
     }
 
+    //
+    // The first call with a plan selects the algorithm, runs the analysis and allocates the
+    // compute buffer. If the handle stream is being captured into a graph, this setup runs on a
+    // side stream instead, such that only the compute stage is captured.
+    //
+    const bool setup = (hip_spmv_descr->is_stage_compute_subsequent() == false)
+                       || (hip_spmv_descr->is_stage_analysis_called() == false
+                           && hip_spmv_descr->is_implicit_stage_analysis_called() == false);
+
+    hipsparse::stream_capture_bypass setup_bypass(handle, setup);
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMVSelectAlg(handle, matA, operation, false, hip_spmv_descr, &spmv_alg));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVFallbackAlg(matA, operation, &spmv_alg));
+
+    rocsparse_const_spmat_descr mat;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVGetMatrix(matA, hip_spmv_descr, &mat));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSpMVCooRowIndices(handle, matA, hip_spmv_descr, externalBuffer));
+
     if(hip_spmv_descr->is_stage_analysis_called() == false)
     {
         //
@@ -306,10 +952,10 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                     rocsparse_spmv((rocsparse_handle)handle,
                                    operation,
                                    alpha,
-                                   to_rocsparse_const_spmat_descr(matA),
-                                   (rocsparse_const_dnvec_descr)vecX,
+                                   mat,
+                                   to_rocsparse_const_dnvec_descr(vecX),
                                    beta,
-                                   (rocsparse_dnvec_descr)vecY,
+                                   to_rocsparse_dnvec_descr(vecY),
                                    datatype,
                                    spmv_alg,
                                    rocsparse_spmv_stage_buffer_size,
@@ -319,16 +965,17 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                 hipStream_t stream{};
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
 
+                hipsparse::count_workspace(handle, buffer_size_in_bytes);
                 RETURN_IF_HIP_ERROR(hipMallocAsync(
                     hip_spmv_descr->get_buffer_reference(), buffer_size_in_bytes, stream));
 
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
                                                          operation,
                                                          alpha,
-                                                         to_rocsparse_const_spmat_descr(matA),
-                                                         (rocsparse_const_dnvec_descr)vecX,
+                                                         mat,
+                                                         to_rocsparse_const_dnvec_descr(vecX),
                                                          beta,
-                                                         (const rocsparse_dnvec_descr)vecY,
+                                                         to_rocsparse_dnvec_descr(vecY),
                                                          datatype,
                                                          spmv_alg,
                                                          rocsparse_spmv_stage_preprocess,
@@ -349,10 +996,10 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
                     rocsparse_spmv((rocsparse_handle)handle,
                                    operation,
                                    alpha,
-                                   to_rocsparse_const_spmat_descr(matA),
-                                   (rocsparse_const_dnvec_descr)vecX,
+                                   mat,
+                                   to_rocsparse_const_dnvec_descr(vecX),
                                    beta,
-                                   (const rocsparse_dnvec_descr)vecY,
+                                   to_rocsparse_dnvec_descr(vecY),
                                    datatype,
                                    spmv_alg,
                                    rocsparse_spmv_stage_preprocess,
@@ -379,10 +1026,10 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
             rocsparse_spmv((rocsparse_handle)handle,
                            operation,
                            alpha,
-                           to_rocsparse_const_spmat_descr(matA),
-                           (rocsparse_const_dnvec_descr)vecX,
+                           mat,
+                           to_rocsparse_const_dnvec_descr(vecX),
                            beta,
-                           (rocsparse_dnvec_descr)vecY,
+                           to_rocsparse_dnvec_descr(vecY),
                            datatype,
                            spmv_alg,
                            rocsparse_spmv_stage_buffer_size,
@@ -394,6 +1041,7 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
         hipStream_t stream{};
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
 
+        hipsparse::count_workspace(handle, hip_spmv_descr->get_buffer_size_stage_compute());
         RETURN_IF_HIP_ERROR(hipMallocAsync(hip_spmv_descr->get_buffer_reference(),
                                            hip_spmv_descr->get_buffer_size_stage_compute(),
                                            stream));
@@ -401,14 +1049,33 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
         hip_spmv_descr->stage_compute_subsequent();
     }
 
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.finish());
+
+    if(hip_spmv_descr->get_spmv_descr() != nullptr)
+    {
+        //
+        // The plan's matrix descriptor shares the values of A, which might have been replaced
+        // since the descriptor was created.
+        //
+        const void* csr_val;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_const_spmat_get_values(to_rocsparse_const_spmat_descr(matA), &csr_val));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spmat_set_values(hip_spmv_descr->get_spmv_descr(), (void*)csr_val));
+    }
+
+    hipStream_t stream{};
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+    hip_spmv_descr->set_stream(stream);
+
     size_t buffer_size = hip_spmv_descr->get_buffer_size_stage_compute();
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
                                              operation,
                                              alpha,
-                                             to_rocsparse_const_spmat_descr(matA),
-                                             (rocsparse_const_dnvec_descr)vecX,
+                                             mat,
+                                             to_rocsparse_const_dnvec_descr(vecX),
                                              beta,
-                                             (rocsparse_dnvec_descr)vecY,
+                                             to_rocsparse_dnvec_descr(vecY),
                                              datatype,
                                              spmv_alg,
                                              rocsparse_spmv_stage_compute,
@@ -417,3 +1084,301 @@ hipsparseStatus_t hipsparseSpMV(hipsparseHandle_t           handle,
 
     return HIPSPARSE_STATUS_SUCCESS;
 }
+
+//
+// hipsparseSpMVDot computes result = conj(z)^T * y as the dense product of the 1 x n matrix z^H
+// with the n x 1 matrix y, sampled by rocsparse_sddmm at the single entry of a 1 x 1 CSR matrix.
+// The dot buffer of the SpMV plan holds the index pair {0, 1}, which is both the row pointer and
+// the column index of that matrix, followed by the value of the entry and the buffer of
+// rocsparse_sddmm.
+//
+static const size_t spmv_dot_value_offset = ((sizeof(rocsparse_int) * 2 - 1) / 256 + 1) * 256;
+
+static size_t hipsparseSpMVDotSddmmOffset(rocsparse_datatype datatype)
+{
+    return spmv_dot_value_offset + ((hipsparse::HCCDataTypeSize(datatype) - 1) / 256 + 1) * 256;
+}
+
+//
+// Grow the dot buffer of the SpMV plan to at least bytes and write the index pair.
+//
+static hipsparseStatus_t
+    hipsparseSpMVDotReserve(hipsparseHandle_t handle, size_t bytes, hipsparseSpMVDescr_st* descr)
+{
+    if(bytes <= descr->get_dot_buffer_size())
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Allocation cannot be captured into a graph
+    hipsparse::stream_capture_bypass setup_bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.status());
+
+    hipStream_t stream{};
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+    RETURN_IF_HIP_ERROR(hipFreeAsync(descr->get_dot_buffer(), stream));
+    descr->get_dot_buffer_reference()[0] = nullptr;
+    descr->set_dot_buffer_size(0);
+
+    hipsparse::count_workspace(handle, bytes);
+    RETURN_IF_HIP_ERROR(hipMallocAsync(descr->get_dot_buffer_reference(), bytes, stream));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(
+        (rocsparse_handle)handle, 2, (rocsparse_int*)descr->get_dot_buffer()));
+
+    descr->set_dot_buffer_size(bytes);
+
+    RETURN_IF_HIPSPARSE_ERROR(setup_bypass.finish());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Query the buffer size of rocsparse_sddmm if buffer_size is not null, compute the dot product
+// into the value of the dot buffer otherwise. The scalars are passed from the host.
+//
+static hipsparseStatus_t hipsparseSpMVDotSddmm(hipsparseHandle_t          handle,
+                                               hipsparseConstDnVecDescr_t vecZ,
+                                               hipsparseConstDnVecDescr_t vecY,
+                                               rocsparse_datatype         datatype,
+                                               hipsparseSpMVDescr_st*     descr,
+                                               size_t*                    buffer_size)
+{
+    int64_t            size;
+    const void*        values_z;
+    const void*        values_y;
+    rocsparse_datatype datatype_z;
+    rocsparse_datatype datatype_y;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecZ), &size, &values_z, &datatype_z));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecY), &size, &values_y, &datatype_y));
+
+    const rocsparse_operation operation
+        = (datatype == rocsparse_datatype_f32_c || datatype == rocsparse_datatype_f64_c)
+              ? rocsparse_operation_conjugate_transpose
+              : rocsparse_operation_transpose;
+
+    const float  sone[2]  = {1.0f, 0.0f};
+    const float  szero[2] = {0.0f, 0.0f};
+    const double done[2]  = {1.0, 0.0};
+    const double dzero[2] = {0.0, 0.0};
+
+    const bool single
+        = (datatype == rocsparse_datatype_f32_r || datatype == rocsparse_datatype_f32_c);
+    const void* alpha = single ? static_cast<const void*>(sone) : static_cast<const void*>(done);
+    const void* beta  = single ? static_cast<const void*>(szero) : static_cast<const void*>(dzero);
+
+    char* dot_buffer = static_cast<char*>(descr->get_dot_buffer());
+    void* sddmm_buffer
+        = (buffer_size == nullptr) ? dot_buffer + hipsparseSpMVDotSddmmOffset(datatype) : nullptr;
+
+    // z and y are n x 1 column major matrices
+    const int64_t ld = std::max(size, int64_t(1));
+
+    rocsparse_const_dnmat_descr Z = nullptr;
+    rocsparse_const_dnmat_descr Y = nullptr;
+    rocsparse_spmat_descr       D = nullptr;
+
+    rocsparse_status status = rocsparse_create_const_dnmat_descr(
+        &Z, size, 1, ld, values_z, datatype_z, rocsparse_order_column);
+
+    if(status == rocsparse_status_success)
+    {
+        status = rocsparse_create_const_dnmat_descr(
+            &Y, size, 1, ld, values_y, datatype_y, rocsparse_order_column);
+    }
+
+    if(status == rocsparse_status_success)
+    {
+        status = rocsparse_create_csr_descr(&D,
+                                            1,
+                                            1,
+                                            1,
+                                            dot_buffer,
+                                            dot_buffer,
+                                            dot_buffer + spmv_dot_value_offset,
+                                            rocsparse_indextype_i32,
+                                            rocsparse_indextype_i32,
+                                            rocsparse_index_base_zero,
+                                            datatype);
+    }
+
+    if(status == rocsparse_status_success && buffer_size != nullptr)
+    {
+        status = rocsparse_sddmm_buffer_size((rocsparse_handle)handle,
+                                             operation,
+                                             rocsparse_operation_none,
+                                             alpha,
+                                             Z,
+                                             Y,
+                                             beta,
+                                             D,
+                                             datatype,
+                                             rocsparse_sddmm_alg_default,
+                                             buffer_size);
+    }
+
+    if(status == rocsparse_status_success && buffer_size == nullptr)
+    {
+        status = rocsparse_sddmm_preprocess((rocsparse_handle)handle,
+                                            operation,
+                                            rocsparse_operation_none,
+                                            alpha,
+                                            Z,
+                                            Y,
+                                            beta,
+                                            D,
+                                            datatype,
+                                            rocsparse_sddmm_alg_default,
+                                            sddmm_buffer);
+    }
+
+    if(status == rocsparse_status_success && buffer_size == nullptr)
+    {
+        status = rocsparse_sddmm((rocsparse_handle)handle,
+                                 operation,
+                                 rocsparse_operation_none,
+                                 alpha,
+                                 Z,
+                                 Y,
+                                 beta,
+                                 D,
+                                 datatype,
+                                 rocsparse_sddmm_alg_default,
+                                 sddmm_buffer);
+    }
+
+    (void)rocsparse_destroy_dnmat_descr(Z);
+    (void)rocsparse_destroy_dnmat_descr(Y);
+    (void)rocsparse_destroy_spmat_descr(D);
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(status);
+}
+
+//
+// Compute result = conj(z)^T * y. The result is copied to the host in host pointer mode and
+// stays on the device in device pointer mode.
+//
+static hipsparseStatus_t hipsparseSpMVDotCompute(hipsparseHandle_t          handle,
+                                                 hipsparseConstDnVecDescr_t vecZ,
+                                                 hipsparseConstDnVecDescr_t vecY,
+                                                 void*                      result,
+                                                 rocsparse_datatype         datatype,
+                                                 hipsparseSpMVDescr_st*     hip_spmv_descr)
+{
+    hipStream_t stream{};
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+    hip_spmv_descr->set_stream(stream);
+
+    rocsparse_pointer_mode pointer_mode;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_pointer_mode((rocsparse_handle)handle, &pointer_mode));
+
+    const size_t sddmm_offset = hipsparseSpMVDotSddmmOffset(datatype);
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVDotReserve(handle, sddmm_offset, hip_spmv_descr));
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+    size_t            buffer_size;
+    hipsparseStatus_t status
+        = hipsparseSpMVDotSddmm(handle, vecZ, vecY, datatype, hip_spmv_descr, &buffer_size);
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMVDotReserve(handle, sddmm_offset + buffer_size, hip_spmv_descr);
+    }
+
+    if(status == HIPSPARSE_STATUS_SUCCESS)
+    {
+        status = hipsparseSpMVDotSddmm(handle, vecZ, vecY, datatype, hip_spmv_descr, nullptr);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)handle, pointer_mode));
+    RETURN_IF_HIPSPARSE_ERROR(status);
+
+    const char*  dot_buffer = static_cast<const char*>(hip_spmv_descr->get_dot_buffer());
+    const void*  value      = dot_buffer + spmv_dot_value_offset;
+    const size_t value_size = hipsparse::HCCDataTypeSize(datatype);
+
+    if(pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(result, value, value_size, hipMemcpyDeviceToDevice, stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(result, value, value_size, hipMemcpyDeviceToHost, stream));
+
+    return hipsparse::synchronize_stream(handle, stream);
+}
+
+hipsparseStatus_t hipsparseSpMVDot(hipsparseHandle_t          handle,
+                                   hipsparseOperation_t       opA,
+                                   const void*                alpha,
+                                   hipsparseConstSpMatDescr_t matA,
+                                   hipsparseConstDnVecDescr_t vecX,
+                                   const void*                beta,
+                                   hipsparseDnVecDescr_t      vecY,
+                                   hipsparseConstDnVecDescr_t vecZ,
+                                   void*                      result,
+                                   hipDataType                computeType,
+                                   hipsparseSpMVAlg_t         alg,
+                                   void*                      externalBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
+
+    if(handle == nullptr || alpha == nullptr || matA == nullptr || vecX == nullptr
+       || beta == nullptr || vecY == nullptr || result == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    bool batched;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMVIsStridedBatched(matA, vecX, vecY, &batched));
+
+    if(batched || (vecZ != nullptr && hipsparse::get_dnvec_strided_batch(vecZ).batch_count > 1))
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // z defaults to x
+    if(vecZ == nullptr)
+    {
+        vecZ = vecX;
+    }
+
+    int64_t            size_y;
+    const void*        values_y;
+    rocsparse_datatype datatype_y;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecY), &size_y, &values_y, &datatype_y));
+
+    int64_t            size_z;
+    const void*        values_z;
+    rocsparse_datatype datatype_z;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecZ), &size_z, &values_z, &datatype_z));
+
+    if(size_z != size_y)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMV(
+        handle, opA, alpha, matA, vecX, beta, vecY, computeType, alg, externalBuffer));
+
+    opA = hipsparseSpMVOperation(matA, opA);
+
+    const rocsparse_datatype  datatype  = hipsparse::hipDataTypeToHCCDataType(computeType);
+    const rocsparse_operation operation = hipsparse::hipOperationToHCCOperation(opA);
+    const rocsparse_spmv_alg  spmv_alg  = hipsparse::hipSpMVAlgToHCCSpMVAlg(alg);
+
+    hipsparseSpMVDescr_st* hip_spmv_descr
+        = matA->get_hip_spmv_descr(operation, spmv_alg, datatype);
+
+    return hipsparseSpMVDotCompute(handle, vecZ, vecY, result, datatype, hip_spmv_descr);
+}
@@ -0,0 +1,223 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_SPMV_ALG_SELECT_H
+#define HIPSPARSE_SPMV_ALG_SELECT_H
+
+//
+// Selection of the CSR SpMV algorithm used for HIPSPARSE_SPMV_ALG_DEFAULT.
+//
+// This header is host-only and does not depend on HIP or rocSPARSE, such that the selection
+// heuristic can be tested without a device.
+//
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace hipsparse
+{
+    //
+    // Row length statistics of a CSR matrix.
+    //
+    struct spmv_row_statistics
+    {
+        int64_t m{};
+        int64_t nnz{};
+        int64_t max_row_nnz{};
+        int64_t empty_rows{};
+        double  mean_row_nnz{};
+        double  cv_row_nnz{}; // coefficient of variation, i.e. standard deviation / mean
+    };
+
+    //
+    // SpMV paths the default algorithm can choose from.
+    //
+    typedef enum
+    {
+        spmv_path_stream   = 0, // one wavefront segment per row, best for uniform rows
+        spmv_path_adaptive = 1, // row blocks with balanced nnz, handles moderately irregular rows
+        spmv_path_lrb      = 2, // logarithmic row binning, handles highly irregular rows
+        spmv_path_coo      = 3, // nnz-parallel COO, handles mostly empty or extremely skewed rows
+        spmv_path_auto     = 4, // chosen by select_spmv_path from the row length statistics
+        spmv_path_default  = 5 // rocSPARSE's default algorithm
+    } spmv_path;
+
+    //
+    // Thresholds of the selection heuristic.
+    //
+    constexpr double spmv_select_uniform_cv        = 0.5;
+    constexpr double spmv_select_irregular_cv      = 2.0;
+    constexpr double spmv_select_skew_ratio        = 64.0;
+    constexpr double spmv_select_coo_empty_ratio   = 0.5;
+    constexpr double spmv_select_coo_skew_ratio    = 4096.0;
+    constexpr double spmv_select_stream_max_length = 4.0;
+
+    template <typename I>
+    inline spmv_row_statistics compute_spmv_row_statistics(int64_t m, const I* csr_row_ptr)
+    {
+        spmv_row_statistics stats;
+
+        stats.m = m;
+
+        if(m <= 0)
+        {
+            return stats;
+        }
+
+        stats.nnz          = static_cast<int64_t>(csr_row_ptr[m] - csr_row_ptr[0]);
+        stats.mean_row_nnz = static_cast<double>(stats.nnz) / m;
+
+        double sum_sq = 0.0;
+        for(int64_t i = 0; i < m; ++i)
+        {
+            const int64_t row_nnz = static_cast<int64_t>(csr_row_ptr[i + 1] - csr_row_ptr[i]);
+
+            stats.max_row_nnz = (row_nnz > stats.max_row_nnz) ? row_nnz : stats.max_row_nnz;
+            stats.empty_rows += (row_nnz == 0) ? 1 : 0;
+
+            const double diff = row_nnz - stats.mean_row_nnz;
+            sum_sq += diff * diff;
+        }
+
+        stats.cv_row_nnz
+            = (stats.mean_row_nnz > 0.0) ? std::sqrt(sum_sq / m) / stats.mean_row_nnz : 0.0;
+
+        return stats;
+    }
+
+    //
+    // Choose the SpMV path for a CSR matrix with the given row statistics.
+    //
+    // transposed    true if the operation is (conjugate) transposed. Stream, adaptive and COO
+    //               support transposed products, LRB does not.
+    // symmetric     true if the matrix type is symmetric, i.e. only one triangle is stored. LRB
+    //               does not support symmetric matrices either.
+    // coo_available true if the matrix can be expanded into COO format, i.e. if it uses 32 bit
+    //               indices.
+    //
+    inline spmv_path select_spmv_path(const spmv_row_statistics& stats,
+                                      bool                       transposed,
+                                      bool                       symmetric,
+                                      bool                       coo_available)
+    {
+        //
+        // Nothing to balance.
+        //
+        if(stats.m == 0 || stats.nnz == 0)
+        {
+            return spmv_path_stream;
+        }
+
+        const double empty_ratio = static_cast<double>(stats.empty_rows) / stats.m;
+        const double skew_ratio  = stats.max_row_nnz / stats.mean_row_nnz;
+
+        //
+        // Mostly empty rows or a few extremely long rows, row-based paths waste most of their
+        // threads. Distribute the non-zeros instead.
+        //
+        if(coo_available && !symmetric
+           && (empty_ratio >= spmv_select_coo_empty_ratio
+               || skew_ratio >= spmv_select_coo_skew_ratio))
+        {
+            return spmv_path_coo;
+        }
+
+        //
+        // Uniform rows, or rows that are short enough that imbalance does not matter.
+        //
+        if(stats.cv_row_nnz <= spmv_select_uniform_cv
+           || stats.max_row_nnz <= spmv_select_stream_max_length)
+        {
+            return spmv_path_stream;
+        }
+
+        //
+        // Highly irregular rows, bin rows by their length. Adaptive balances the rows of the
+        // operations LRB does not support.
+        //
+        if(!symmetric && !transposed
+           && (stats.cv_row_nnz >= spmv_select_irregular_cv
+               || skew_ratio >= spmv_select_skew_ratio))
+        {
+            return spmv_path_lrb;
+        }
+
+        return spmv_path_adaptive;
+    }
+
+    //
+    // Parse the value of the HIPSPARSE_SPMV_DEFAULT_ALG environment variable. Returns false if
+    // the value is unset or does not name a path, in which case the path is chosen by
+    // select_spmv_path, as for "auto". "default" keeps rocSPARSE's default algorithm and avoids
+    // the copy of the row pointer to the host that the heuristic requires.
+    //
+    inline bool parse_spmv_path(const char* value, spmv_path* path)
+    {
+        if(value == nullptr)
+        {
+            return false;
+        }
+
+        if(std::strcmp(value, "stream") == 0)
+        {
+            *path = spmv_path_stream;
+            return true;
+        }
+
+        if(std::strcmp(value, "adaptive") == 0)
+        {
+            *path = spmv_path_adaptive;
+            return true;
+        }
+
+        if(std::strcmp(value, "lrb") == 0)
+        {
+            *path = spmv_path_lrb;
+            return true;
+        }
+
+        if(std::strcmp(value, "coo") == 0)
+        {
+            *path = spmv_path_coo;
+            return true;
+        }
+
+        if(std::strcmp(value, "auto") == 0)
+        {
+            *path = spmv_path_auto;
+            return true;
+        }
+
+        if(std::strcmp(value, "default") == 0)
+        {
+            *path = spmv_path_default;
+            return true;
+        }
+
+        return false;
+    }
+}
+
+#endif // HIPSPARSE_SPMV_ALG_SELECT_H
@@ -64,6 +64,8 @@ hipsparseStatus_t hipsparseSpSM_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSMDescr_t        spsmDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     if(spsmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -99,6 +101,8 @@ hipsparseStatus_t hipsparseSpSM_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSMDescr_t        spsmDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     if(spsmDescr == nullptr || externalBuffer == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -134,6 +138,8 @@ hipsparseStatus_t hipsparseSpSM_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSMDescr_t        spsmDescr,
                                       void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, opB, computeType, alg);
+
     if(spsmDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
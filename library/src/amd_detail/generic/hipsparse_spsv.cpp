@@ -28,11 +28,22 @@
 #include <hip/hip_runtime_api.h>
 #include <rocsparse/rocsparse.h>
 
+#include "../hipsparse_graph.h"
 #include "../utility.h"
 
 struct hipsparseSpSVDescr
 {
     void* externalBuffer{};
+
+    //
+    // Size of externalBuffer, as required by the analysis.
+    //
+    size_t bufferSize{};
+
+    //
+    // Structure version of the sparse matrix at the time the analysis was performed.
+    //
+    int64_t structureVersion{};
 };
 
 hipsparseStatus_t hipsparseSpSV_createDescr(hipsparseSpSVDescr_t* descr)
@@ -63,13 +74,15 @@ hipsparseStatus_t hipsparseSpSV_bufferSize(hipsparseHandle_t           handle,
                                            hipsparseSpSVDescr_t        spsvDescr,
                                            size_t*                     pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        alpha,
                        to_rocsparse_const_spmat_descr(matA),
-                       (rocsparse_const_dnvec_descr)x,
-                       (const rocsparse_dnvec_descr)y,
+                       to_rocsparse_const_dnvec_descr(x),
+                       to_rocsparse_dnvec_descr(y),
                        hipsparse::hipDataTypeToHCCDataType(computeType),
                        hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
                        rocsparse_spsv_stage_buffer_size,
@@ -88,23 +101,40 @@ hipsparseStatus_t hipsparseSpSV_analysis(hipsparseHandle_t           handle,
                                          hipsparseSpSVDescr_t        spsvDescr,
                                          void*                       externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
 
     if(spsvDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
+
+    size_t buffer_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsv((rocsparse_handle)handle,
+                                             hipsparse::hipOperationToHCCOperation(opA),
+                                             alpha,
+                                             to_rocsparse_const_spmat_descr(matA),
+                                             to_rocsparse_const_dnvec_descr(x),
+                                             to_rocsparse_dnvec_descr(y),
+                                             hipsparse::hipDataTypeToHCCDataType(computeType),
+                                             hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
+                                             rocsparse_spsv_stage_buffer_size,
+                                             &buffer_size,
+                                             nullptr));
+
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsv((rocsparse_handle)handle,
                                              hipsparse::hipOperationToHCCOperation(opA),
                                              alpha,
                                              to_rocsparse_const_spmat_descr(matA),
-                                             (rocsparse_const_dnvec_descr)x,
-                                             (const rocsparse_dnvec_descr)y,
+                                             to_rocsparse_const_dnvec_descr(x),
+                                             to_rocsparse_dnvec_descr(y),
                                              hipsparse::hipDataTypeToHCCDataType(computeType),
                                              hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
                                              rocsparse_spsv_stage_preprocess,
                                              nullptr,
                                              externalBuffer));
-    spsvDescr->externalBuffer = externalBuffer;
+    spsvDescr->externalBuffer   = externalBuffer;
+    spsvDescr->bufferSize       = buffer_size;
+    spsvDescr->structureVersion = matA->get_structure_version();
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -118,17 +148,69 @@ hipsparseStatus_t hipsparseSpSV_solve(hipsparseHandle_t           handle,
                                       hipsparseSpSVAlg_t          alg,
                                       hipsparseSpSVDescr_t        spsvDescr)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opA, computeType, alg);
+
     if(spsvDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
+
+    //
+    // Values-only updates keep the analysis valid. If the sparsity pattern pointers changed
+    // since the analysis, redo it in the buffer that was passed to hipsparseSpSV_analysis. The
+    // new pattern might need a larger buffer, in which case the user has to query the buffer
+    // size and run the analysis again.
+    //
+    if(matA != nullptr && spsvDescr->externalBuffer != nullptr
+       && spsvDescr->structureVersion != matA->get_structure_version())
+    {
+        size_t buffer_size;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spsv((rocsparse_handle)handle,
+                           hipsparse::hipOperationToHCCOperation(opA),
+                           alpha,
+                           to_rocsparse_const_spmat_descr(matA),
+                           to_rocsparse_const_dnvec_descr(x),
+                           to_rocsparse_dnvec_descr(y),
+                           hipsparse::hipDataTypeToHCCDataType(computeType),
+                           hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
+                           rocsparse_spsv_stage_buffer_size,
+                           &buffer_size,
+                           nullptr));
+
+        if(buffer_size > spsvDescr->bufferSize)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The analysis cannot be captured into a graph, run it on a side stream while capturing
+        hipsparse::stream_capture_bypass analysis_bypass(handle, true);
+        RETURN_IF_HIPSPARSE_ERROR(analysis_bypass.status());
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spsv((rocsparse_handle)handle,
+                           hipsparse::hipOperationToHCCOperation(opA),
+                           alpha,
+                           to_rocsparse_const_spmat_descr(matA),
+                           to_rocsparse_const_dnvec_descr(x),
+                           to_rocsparse_dnvec_descr(y),
+                           hipsparse::hipDataTypeToHCCDataType(computeType),
+                           hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
+                           rocsparse_spsv_stage_preprocess,
+                           nullptr,
+                           spsvDescr->externalBuffer));
+        spsvDescr->structureVersion = matA->get_structure_version();
+
+        RETURN_IF_HIPSPARSE_ERROR(analysis_bypass.finish());
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spsv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opA),
                        alpha,
                        to_rocsparse_const_spmat_descr(matA),
-                       (rocsparse_const_dnvec_descr)x,
-                       (const rocsparse_dnvec_descr)y,
+                       to_rocsparse_const_dnvec_descr(x),
+                       to_rocsparse_dnvec_descr(y),
                        hipsparse::hipDataTypeToHCCDataType(computeType),
                        hipsparse::hipSpSVAlgToHCCSpSVAlg(alg),
                        rocsparse_spsv_stage_compute,
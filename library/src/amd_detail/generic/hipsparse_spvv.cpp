@@ -38,11 +38,13 @@ hipsparseStatus_t hipsparseSpVV_bufferSize(hipsparseHandle_t          handle,
                                            hipDataType                computeType,
                                            size_t*                    pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opX, computeType);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spvv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opX),
                        (rocsparse_const_spvec_descr)vecX,
-                       (rocsparse_const_dnvec_descr)vecY,
+                       to_rocsparse_const_dnvec_descr(vecY),
                        result,
                        hipsparse::hipDataTypeToHCCDataType(computeType),
                        pBufferSizeInBytes,
@@ -57,6 +59,8 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
                                 hipDataType                computeType,
                                 void*                      externalBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, opX, computeType);
+
     size_t bufferSize;
 
     // Check for buffer == nullptr as this is not done in rocsparse
@@ -69,7 +73,7 @@ hipsparseStatus_t hipsparseSpVV(hipsparseHandle_t          handle,
         rocsparse_spvv((rocsparse_handle)handle,
                        hipsparse::hipOperationToHCCOperation(opX),
                        (rocsparse_const_spvec_descr)vecX,
-                       (rocsparse_const_dnvec_descr)vecY,
+                       to_rocsparse_const_dnvec_descr(vecY),
                        result,
                        hipsparse::hipDataTypeToHCCDataType(computeType),
                        &bufferSize,
@@ -51,11 +51,21 @@ hipsparseStatus_t hipsparseCreate(hipsparseHandle_t* handle)
         retval = hipsparse::rocSPARSEStatusToHIPStatus(
             rocsparse_create_handle((rocsparse_handle*)handle));
     }
+
+    if(retval == HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipsparse::create_counters(*handle);
+    }
+
     return retval;
 }
 
 hipsparseStatus_t hipsparseDestroy(hipsparseHandle_t handle)
 {
+    // Write the trace of the handle, if tracing is enabled
+    hipsparse::trace_flush(handle);
+    hipsparse::destroy_counters(handle);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_destroy_handle((rocsparse_handle)handle));
 }
@@ -132,6 +142,128 @@ hipsparseStatus_t hipsparseGetStream(hipsparseHandle_t handle, hipStream_t* stre
         rocsparse_get_stream((rocsparse_handle)handle, streamId));
 }
 
+hipsparseStatus_t hipsparseGetCounters(hipsparseHandle_t handle, hipsparseCounters_t* counters)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(counters == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::handle_counters* handle_counters = hipsparse::get_counters(handle);
+
+    if(handle_counters == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    hipsparse::collect_device_time(handle_counters);
+
+    *counters = {};
+
+    const int routine_count = hipsparse::get_routine_count();
+    for(int i = 0; i < routine_count; ++i)
+    {
+        counters->calls += handle_counters->calls[i].load(std::memory_order_relaxed);
+        counters->hostTimeNs += handle_counters->host_ns[i].load(std::memory_order_relaxed);
+        counters->deviceTimeNs += handle_counters->device_ns[i].load(std::memory_order_relaxed);
+    }
+
+    counters->workspaceBytes = handle_counters->workspace_bytes.load(std::memory_order_relaxed);
+    counters->workspaceAllocations
+        = handle_counters->workspace_allocations.load(std::memory_order_relaxed);
+    counters->synchronizations = handle_counters->synchronizations.load(std::memory_order_relaxed);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGetRoutineCounters(hipsparseHandle_t           handle,
+                                              int*                        count,
+                                              hipsparseRoutineCounters_t* counters)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(count == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(counters != nullptr && *count < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::handle_counters* handle_counters = hipsparse::get_counters(handle);
+
+    if(handle_counters == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    hipsparse::collect_device_time(handle_counters);
+
+    const int capacity = (counters != nullptr) ? *count : 0;
+
+    // Only report routines that have been called through this handle
+    int called = 0;
+
+    const int routine_count = hipsparse::get_routine_count();
+    for(int i = 0; i < routine_count; ++i)
+    {
+        const int64_t calls = handle_counters->calls[i].load(std::memory_order_relaxed);
+
+        if(calls == 0)
+        {
+            continue;
+        }
+
+        if(called < capacity)
+        {
+            counters[called].name  = hipsparse::get_routine_name(i);
+            counters[called].calls = calls;
+            counters[called].hostTimeNs
+                = handle_counters->host_ns[i].load(std::memory_order_relaxed);
+            counters[called].deviceTimeNs
+                = handle_counters->device_ns[i].load(std::memory_order_relaxed);
+        }
+
+        ++called;
+    }
+
+    *count = called;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseResetCounters(hipsparseHandle_t handle)
+{
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    hipsparse::handle_counters* handle_counters = hipsparse::get_counters(handle);
+
+    if(handle_counters == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    // Calls made before the reset must not add their device time afterwards
+    hipsparse::discard_device_time(handle_counters);
+
+    handle_counters->reset();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseSetPointerMode(hipsparseHandle_t handle, hipsparsePointerMode_t mode)
 {
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_set_pointer_mode(
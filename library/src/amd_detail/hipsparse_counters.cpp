@@ -0,0 +1,354 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_counters.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+    //
+    // Routine names, indexed by routine id.
+    //
+    std::mutex       routine_mutex;
+    const char*      routine_names[hipsparse::counters_max_routines];
+    std::atomic<int> routine_count{0};
+
+    //
+    // Open addressing hash table from handles to their counters. Removed entries are marked
+    // with a tombstone, such that probing continues past them.
+    //
+    constexpr size_t counters_table_size = 4096;
+
+    struct counters_entry
+    {
+        std::atomic<hipsparseHandle_t>           handle{nullptr};
+        std::atomic<hipsparse::handle_counters*> counters{nullptr};
+    };
+
+    counters_entry counters_table[counters_table_size];
+
+    hipsparseHandle_t tombstone()
+    {
+        return reinterpret_cast<hipsparseHandle_t>(static_cast<uintptr_t>(1));
+    }
+
+    size_t counters_hash(hipsparseHandle_t handle)
+    {
+        uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return static_cast<size_t>(key) & (counters_table_size - 1);
+    }
+
+    //
+    // Take an event from the pool of counters, or create one. Requires the timing mutex.
+    //
+    hipEvent_t acquire_event(hipsparse::handle_counters* counters)
+    {
+        if(!counters->free_events.empty())
+        {
+            hipEvent_t event = counters->free_events.back();
+            counters->free_events.pop_back();
+            return event;
+        }
+
+        hipEvent_t event;
+        return (hipEventCreate(&event) == hipSuccess) ? event : nullptr;
+    }
+
+    //
+    // Add the device time of completed timings and return their events to the pool, timings of
+    // calls that are still running are kept. Requires the timing mutex.
+    //
+    void collect_completed_timings(hipsparse::handle_counters* counters)
+    {
+        std::vector<hipsparse::device_timing>& pending = counters->pending_timings;
+
+        size_t kept = 0;
+        for(size_t i = 0; i < pending.size(); ++i)
+        {
+            const hipsparse::device_timing timing = pending[i];
+
+            if(hipEventQuery(timing.stop) != hipSuccess)
+            {
+                pending[kept++] = timing;
+                continue;
+            }
+
+            float ms;
+            if(hipEventElapsedTime(&ms, timing.start, timing.stop) == hipSuccess)
+            {
+                counters->device_ns[timing.routine].fetch_add(
+                    static_cast<int64_t>(static_cast<double>(ms) * 1e6),
+                    std::memory_order_relaxed);
+            }
+
+            counters->free_events.push_back(timing.start);
+            counters->free_events.push_back(timing.stop);
+        }
+
+        pending.resize(kept);
+    }
+}
+
+hipsparse::handle_counters::~handle_counters()
+{
+    for(const device_timing& timing : pending_timings)
+    {
+        (void)hipEventDestroy(timing.start);
+        (void)hipEventDestroy(timing.stop);
+    }
+
+    for(hipEvent_t event : free_events)
+    {
+        (void)hipEventDestroy(event);
+    }
+}
+
+void hipsparse::handle_counters::reset()
+{
+    for(int i = 0; i < counters_max_routines; ++i)
+    {
+        calls[i].store(0, std::memory_order_relaxed);
+        host_ns[i].store(0, std::memory_order_relaxed);
+        device_ns[i].store(0, std::memory_order_relaxed);
+    }
+
+    workspace_bytes.store(0, std::memory_order_relaxed);
+    workspace_allocations.store(0, std::memory_order_relaxed);
+    synchronizations.store(0, std::memory_order_relaxed);
+}
+
+int hipsparse::register_routine(const char* name)
+{
+    std::lock_guard<std::mutex> lock(routine_mutex);
+
+    const int routine = routine_count.load(std::memory_order_relaxed);
+
+    if(routine >= counters_max_routines)
+    {
+        return -1;
+    }
+
+    routine_names[routine] = name;
+    routine_count.store(routine + 1, std::memory_order_release);
+
+    return routine;
+}
+
+int hipsparse::get_routine_count()
+{
+    return routine_count.load(std::memory_order_acquire);
+}
+
+const char* hipsparse::get_routine_name(int routine)
+{
+    return routine_names[routine];
+}
+
+void hipsparse::create_counters(hipsparseHandle_t handle)
+{
+    const size_t start = counters_hash(handle);
+
+    for(size_t i = 0; i < counters_table_size; ++i)
+    {
+        counters_entry& entry = counters_table[(start + i) & (counters_table_size - 1)];
+
+        hipsparseHandle_t key = entry.handle.load(std::memory_order_acquire);
+
+        if((key == nullptr || key == tombstone())
+           && entry.handle.compare_exchange_strong(key, handle, std::memory_order_acq_rel))
+        {
+            entry.counters.store(new handle_counters, std::memory_order_release);
+            return;
+        }
+    }
+
+    // The table is full, the handle works without counters
+}
+
+void hipsparse::destroy_counters(hipsparseHandle_t handle)
+{
+    const size_t start = counters_hash(handle);
+
+    for(size_t i = 0; i < counters_table_size; ++i)
+    {
+        counters_entry& entry = counters_table[(start + i) & (counters_table_size - 1)];
+
+        hipsparseHandle_t key = entry.handle.load(std::memory_order_acquire);
+
+        if(key == nullptr)
+        {
+            return;
+        }
+
+        if(key == handle)
+        {
+            delete entry.counters.exchange(nullptr, std::memory_order_acq_rel);
+            entry.handle.store(tombstone(), std::memory_order_release);
+            return;
+        }
+    }
+}
+
+hipsparse::handle_counters* hipsparse::get_counters(hipsparseHandle_t handle)
+{
+    const size_t start = counters_hash(handle);
+
+    for(size_t i = 0; i < counters_table_size; ++i)
+    {
+        counters_entry& entry = counters_table[(start + i) & (counters_table_size - 1)];
+
+        hipsparseHandle_t key = entry.handle.load(std::memory_order_acquire);
+
+        if(key == nullptr)
+        {
+            return nullptr;
+        }
+
+        if(key == handle)
+        {
+            return entry.counters.load(std::memory_order_acquire);
+        }
+    }
+
+    return nullptr;
+}
+
+bool hipsparse::device_timing_enabled()
+{
+    static const bool enabled = []() {
+        const char* env = std::getenv("HIPSPARSE_COUNTERS_DEVICE_TIME");
+        return env != nullptr && std::strcmp(env, "0") != 0;
+    }();
+
+    return enabled;
+}
+
+bool hipsparse::begin_device_timing(hipsparseHandle_t handle,
+                                    handle_counters*  counters,
+                                    int               routine,
+                                    device_timing*    timing)
+{
+    hipStream_t stream;
+    if(rocsparse_get_stream((rocsparse_handle)handle, &stream) != rocsparse_status_success)
+    {
+        return false;
+    }
+
+    // Work captured into a graph only runs when the graph is launched, there is nothing to time
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &capture_status) != hipSuccess
+       || capture_status != hipStreamCaptureStatusNone)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(counters->timing_mutex);
+
+        if(counters->pending_timings.size() >= counters_max_pending_timings)
+        {
+            collect_completed_timings(counters);
+
+            if(counters->pending_timings.size() >= counters_max_pending_timings)
+            {
+                return false;
+            }
+        }
+
+        timing->routine = routine;
+        timing->start   = acquire_event(counters);
+        timing->stop    = acquire_event(counters);
+    }
+
+    if(timing->start == nullptr || timing->stop == nullptr
+       || hipEventRecord(timing->start, stream) != hipSuccess)
+    {
+        std::lock_guard<std::mutex> lock(counters->timing_mutex);
+
+        if(timing->start != nullptr)
+        {
+            counters->free_events.push_back(timing->start);
+        }
+
+        if(timing->stop != nullptr)
+        {
+            counters->free_events.push_back(timing->stop);
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+void hipsparse::end_device_timing(hipsparseHandle_t    handle,
+                                  handle_counters*     counters,
+                                  const device_timing& timing)
+{
+    hipStream_t stream;
+    const bool  recorded
+        = rocsparse_get_stream((rocsparse_handle)handle, &stream) == rocsparse_status_success
+          && hipEventRecord(timing.stop, stream) == hipSuccess;
+
+    std::lock_guard<std::mutex> lock(counters->timing_mutex);
+
+    if(recorded)
+    {
+        counters->pending_timings.push_back(timing);
+    }
+    else
+    {
+        counters->free_events.push_back(timing.start);
+        counters->free_events.push_back(timing.stop);
+    }
+}
+
+void hipsparse::collect_device_time(handle_counters* counters)
+{
+    std::lock_guard<std::mutex> lock(counters->timing_mutex);
+
+    collect_completed_timings(counters);
+}
+
+void hipsparse::discard_device_time(handle_counters* counters)
+{
+    std::lock_guard<std::mutex> lock(counters->timing_mutex);
+
+    for(const device_timing& timing : counters->pending_timings)
+    {
+        counters->free_events.push_back(timing.start);
+        counters->free_events.push_back(timing.stop);
+    }
+
+    counters->pending_timings.clear();
+}
@@ -0,0 +1,174 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_COUNTERS_H
+#define HIPSPARSE_COUNTERS_H
+
+//
+// Per handle performance counters.
+//
+// Every handle created by hipsparseCreate owns a set of counters, that are found through a
+// lock-free table keyed by the handle. Each traced entry point (see hipsparse_trace.h) registers
+// itself once as a routine and counts its calls and host time in the counters of its handle with
+// relaxed atomics. Internal workspace allocations and forced synchronizations are counted at the
+// places where they happen.
+//
+// Measuring the device time of calls is enabled by setting the environment variable
+// HIPSPARSE_COUNTERS_DEVICE_TIME to 1. The device time of a call is then measured with a pair of
+// HIP events on the handle stream. The events are collected without waiting when the counters are
+// read, calls that have not completed on the device yet are added by a later read.
+//
+#include "hipsparse.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hipsparse
+{
+    //
+    // Maximum number of distinct routines that can be counted.
+    //
+    constexpr int counters_max_routines = 1024;
+
+    //
+    // Maximum number of calls whose device time has not been collected yet, later calls are not
+    // timed until earlier ones have been collected.
+    //
+    constexpr size_t counters_max_pending_timings = 65536;
+
+    //
+    // Events of a call whose device time is being measured.
+    //
+    struct device_timing
+    {
+        int        routine{};
+        hipEvent_t start{};
+        hipEvent_t stop{};
+    };
+
+    struct handle_counters
+    {
+        std::atomic<int64_t> calls[counters_max_routines];
+        std::atomic<int64_t> host_ns[counters_max_routines];
+        std::atomic<int64_t> device_ns[counters_max_routines];
+        std::atomic<int64_t> workspace_bytes;
+        std::atomic<int64_t> workspace_allocations;
+        std::atomic<int64_t> synchronizations;
+
+        //
+        // Timings that have not been collected yet and events that can be reused, guarded by
+        // timing_mutex.
+        //
+        std::mutex                 timing_mutex;
+        std::vector<device_timing> pending_timings;
+        std::vector<hipEvent_t>    free_events;
+
+        handle_counters()
+        {
+            reset();
+        }
+
+        ~handle_counters();
+
+        void reset();
+    };
+
+    //
+    // Register a routine by name, returns its id or -1 if counters_max_routines routines have
+    // already been registered. Names must have static storage duration.
+    //
+    int         register_routine(const char* name);
+    int         get_routine_count();
+    const char* get_routine_name(int routine);
+
+    //
+    // Attach counters to a handle and release them again.
+    //
+    void create_counters(hipsparseHandle_t handle);
+    void destroy_counters(hipsparseHandle_t handle);
+
+    //
+    // Counters of handle, nullptr if the handle has none.
+    //
+    handle_counters* get_counters(hipsparseHandle_t handle);
+
+    //
+    // True if the device time of calls is measured, see HIPSPARSE_COUNTERS_DEVICE_TIME.
+    //
+    bool device_timing_enabled();
+
+    //
+    // Start measuring the device time of a call of routine on the stream of handle. Returns false
+    // if the call is not timed, e.g. because the stream is being captured into a graph.
+    //
+    bool begin_device_timing(hipsparseHandle_t handle,
+                             handle_counters*  counters,
+                             int               routine,
+                             device_timing*    timing);
+    void end_device_timing(hipsparseHandle_t    handle,
+                           handle_counters*     counters,
+                           const device_timing& timing);
+
+    //
+    // Add the device time of all timed calls that have completed to the counters. Calls that are
+    // still running are kept for a later collection.
+    //
+    void collect_device_time(handle_counters* counters);
+
+    //
+    // Drop all timed calls without adding their device time.
+    //
+    void discard_device_time(handle_counters* counters);
+
+    //
+    // Count a workspace allocation of the given size, made internally on behalf of the caller.
+    //
+    inline void count_workspace(hipsparseHandle_t handle, size_t bytes)
+    {
+        handle_counters* counters = get_counters(handle);
+        if(counters != nullptr)
+        {
+            counters->workspace_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            counters->workspace_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    //
+    // Count a synchronization of the handle stream (or device) that the caller did not ask for.
+    //
+    inline void count_synchronization(hipsparseHandle_t handle)
+    {
+        handle_counters* counters = get_counters(handle);
+        if(counters != nullptr)
+        {
+            counters->synchronizations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif // HIPSPARSE_COUNTERS_H
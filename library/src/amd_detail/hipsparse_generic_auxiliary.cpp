@@ -30,6 +30,10 @@
 
 #include "utility.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 //
 // hipsparseSpMVDescr_st
 //
@@ -43,6 +47,14 @@ void hipsparseSpMVDescr_st::set_spmv_descr(rocsparse_spmat_descr value)
     this->m_spmv_descr = value;
 }
 
+bool hipsparseSpMVDescr_st::is_plan(rocsparse_operation operation,
+                                    rocsparse_spmv_alg  alg,
+                                    rocsparse_datatype  datatype) const
+{
+    return (this->m_operation == operation) && (this->m_alg == alg)
+           && (this->m_datatype == datatype);
+}
+
 bool hipsparseSpMVDescr_st::is_stage_analysis_called() const
 {
     return this->m_is_stage_analysis_called;
@@ -118,9 +130,107 @@ void hipsparseSpMVDescr_st::buffer_size_called()
     this->m_is_buffer_size_called = true;
 }
 
+hipsparseSpMVDescr_st::hipsparseSpMVDescr_st(rocsparse_operation operation,
+                                             rocsparse_spmv_alg  alg,
+                                             rocsparse_datatype  datatype)
+    : m_operation(operation)
+    , m_alg(alg)
+    , m_datatype(datatype)
+{
+}
+
+bool hipsparseSpMVDescr_st::is_alg_selected() const
+{
+    return this->m_is_alg_selected;
+}
+
+rocsparse_spmv_alg hipsparseSpMVDescr_st::get_selected_alg() const
+{
+    return this->m_selected_alg;
+}
+
+void hipsparseSpMVDescr_st::set_selected_alg(rocsparse_spmv_alg value)
+{
+    this->m_selected_alg    = value;
+    this->m_is_alg_selected = true;
+}
+
+void* hipsparseSpMVDescr_st::get_coo_row_ind()
+{
+    return this->m_coo_row_ind;
+}
+
+void hipsparseSpMVDescr_st::set_coo_row_ind(void* value)
+{
+    this->m_coo_row_ind = value;
+}
+
+bool hipsparseSpMVDescr_st::is_batched_stage_preprocess_called() const
+{
+    return this->m_is_batched_stage_preprocess_called;
+}
+
+void hipsparseSpMVDescr_st::batched_stage_preprocess_called(void* buffer)
+{
+    this->m_is_batched_stage_preprocess_called = true;
+    this->m_batched_buffer                     = buffer;
+}
+
+void* hipsparseSpMVDescr_st::get_batched_buffer()
+{
+    return this->m_batched_buffer;
+}
+
+size_t hipsparseSpMVDescr_st::get_dot_buffer_size() const
+{
+    return this->m_dot_buffer_size;
+}
+
+void hipsparseSpMVDescr_st::set_dot_buffer_size(size_t value)
+{
+    this->m_dot_buffer_size = value;
+}
+
+void* hipsparseSpMVDescr_st::get_dot_buffer()
+{
+    return this->m_dot_buffer;
+}
+
+void** hipsparseSpMVDescr_st::get_dot_buffer_reference()
+{
+    return &this->m_dot_buffer;
+}
+
+hipStream_t hipsparseSpMVDescr_st::get_stream() const
+{
+    return this->m_stream;
+}
+
+void hipsparseSpMVDescr_st::set_stream(hipStream_t value)
+{
+    this->m_stream = value;
+}
+
 hipsparseSpMVDescr_st::~hipsparseSpMVDescr_st()
 {
-    (void)hipFree(this->get_buffer());
+    //
+    // Release the buffers once the products queued on the stream that used them are done,
+    // without blocking the host.
+    //
+    if(this->m_buffer != nullptr)
+    {
+        (void)hipFreeAsync(this->m_buffer, this->m_stream);
+    }
+
+    if(this->m_dot_buffer != nullptr)
+    {
+        (void)hipFreeAsync(this->m_dot_buffer, this->m_stream);
+    }
+
+    if(this->m_spmv_descr != nullptr)
+    {
+        (void)rocsparse_destroy_spmat_descr(this->m_spmv_descr);
+    }
 }
 
 //
@@ -141,14 +251,105 @@ void hipsparseSpMatDescr_st::set_spmat_descr(rocsparse_spmat_descr value)
     this->m_spmat_descr = value;
 }
 
-hipsparseSpMVDescr_st* hipsparseSpMatDescr_st::get_hip_spmv_descr()
+hipsparseSpMVDescr_st* hipsparseSpMatDescr_st::get_hip_spmv_descr(rocsparse_operation operation,
+                                                                  rocsparse_spmv_alg  alg,
+                                                                  rocsparse_datatype  datatype) const
+{
+    auto& cache = this->m_hip_spmv_descr_cache;
+    for(size_t i = 0; i < cache.size(); ++i)
+    {
+        if(cache[i]->is_plan(operation, alg, datatype))
+        {
+            //
+            // Move the plan to the back, so that the least recently used plan is evicted first.
+            //
+            std::unique_ptr<hipsparseSpMVDescr_st> plan = std::move(cache[i]);
+            cache.erase(cache.begin() + i);
+            cache.push_back(std::move(plan));
+            return cache.back().get();
+        }
+    }
+
+    if(cache.size() >= s_spmv_descr_cache_capacity)
+    {
+        cache.erase(cache.begin());
+    }
+
+    cache.push_back(std::make_unique<hipsparseSpMVDescr_st>(operation, alg, datatype));
+    return cache.back().get();
+}
+
+void hipsparseSpMatDescr_st::clear_hip_spmv_descr_cache()
+{
+    this->m_hip_spmv_descr_cache.clear();
+}
+
+int64_t hipsparseSpMatDescr_st::get_structure_version() const
+{
+    return this->m_structure_version;
+}
+
+void hipsparseSpMatDescr_st::structure_changed()
+{
+    ++this->m_structure_version;
+    this->clear_hip_spmv_descr_cache();
+}
+
+bool hipsparseSpMatDescr_st::has_row_statistics() const
+{
+    return this->m_row_statistics_version == this->m_structure_version;
+}
+
+const hipsparse::spmv_row_statistics& hipsparseSpMatDescr_st::get_row_statistics() const
+{
+    return this->m_row_statistics;
+}
+
+void hipsparseSpMatDescr_st::set_row_statistics(const hipsparse::spmv_row_statistics& value) const
+{
+    this->m_row_statistics         = value;
+    this->m_row_statistics_version = this->m_structure_version;
+}
+
+bool hipsparseSpMatDescr_st::has_statistics() const
+{
+    return this->m_statistics_version == this->m_structure_version;
+}
+
+const hipsparseSpMatStatistics_t& hipsparseSpMatDescr_st::get_statistics() const
+{
+    return this->m_statistics;
+}
+
+void hipsparseSpMatDescr_st::set_statistics(const hipsparseSpMatStatistics_t& value) const
+{
+    this->m_statistics         = value;
+    this->m_statistics_version = this->m_structure_version;
+}
+
+const hipsparse::host_spmat* hipsparseSpMatDescr_st::get_host_spmat() const
+{
+    return this->m_host_spmat.get();
+}
+
+hipsparse::host_spmat* hipsparseSpMatDescr_st::get_host_spmat()
 {
-    return &this->m_hip_spmv_descr;
+    return this->m_host_spmat.get();
 }
 
-hipsparseSpMVDescr_st* hipsparseSpMatDescr_st::get_hip_spmv_descr() const
+void hipsparseSpMatDescr_st::set_host_spmat(std::unique_ptr<hipsparse::host_spmat> value)
 {
-    return &this->m_hip_spmv_descr;
+    this->m_host_spmat = std::move(value);
+}
+
+hipsparse::device_spmat* hipsparseSpMatDescr_st::get_device_spmat() const
+{
+    return this->m_device_spmat.get();
+}
+
+void hipsparseSpMatDescr_st::set_device_spmat(std::unique_ptr<hipsparse::device_spmat> value) const
+{
+    this->m_device_spmat = std::move(value);
 }
 
 rocsparse_spmat_descr* hipsparseSpMatDescr_st::get_spmat_descr_reference()
@@ -174,6 +375,62 @@ rocsparse_spmat_descr to_rocsparse_spmat_descr(const hipsparseSpMatDescr_t sourc
     return (source != nullptr) ? source->get_spmat_descr() : nullptr;
 }
 
+//
+// hipsparseDnVecDescr_st
+//
+const hipsparse::dnvec_strided_batch& hipsparseDnVecDescr_st::get_strided_batch() const
+{
+    return this->m_strided_batch;
+}
+
+void hipsparseDnVecDescr_st::set_strided_batch(const hipsparse::dnvec_strided_batch& value)
+{
+    this->m_strided_batch = value;
+}
+
+rocsparse_dnvec_descr hipsparseDnVecDescr_st::get_dnvec_descr()
+{
+    return this->m_dnvec_descr;
+}
+
+rocsparse_const_dnvec_descr hipsparseDnVecDescr_st::get_const_dnvec_descr() const
+{
+    return this->m_dnvec_descr;
+}
+
+rocsparse_dnvec_descr* hipsparseDnVecDescr_st::get_dnvec_descr_reference()
+{
+    return &this->m_dnvec_descr;
+}
+
+rocsparse_const_dnvec_descr* hipsparseDnVecDescr_st::get_const_dnvec_descr_reference()
+{
+    return (rocsparse_const_dnvec_descr*)&this->m_dnvec_descr;
+}
+
+//
+// Cast hipsparseDnVecDescr_t to rocsparse_dnvec_descr.
+//
+rocsparse_const_dnvec_descr to_rocsparse_const_dnvec_descr(const hipsparseConstDnVecDescr_t source)
+{
+    return (source != nullptr)
+               ? static_cast<const hipsparseDnVecDescr_st*>(source)->get_const_dnvec_descr()
+               : nullptr;
+}
+
+rocsparse_dnvec_descr to_rocsparse_dnvec_descr(const hipsparseDnVecDescr_t source)
+{
+    return (source != nullptr) ? static_cast<hipsparseDnVecDescr_st*>(source)->get_dnvec_descr()
+                               : nullptr;
+}
+
+hipsparse::dnvec_strided_batch hipsparse::get_dnvec_strided_batch(hipsparseConstDnVecDescr_t descr)
+{
+    return (descr != nullptr)
+               ? static_cast<const hipsparseDnVecDescr_st*>(descr)->get_strided_batch()
+               : dnvec_strided_batch();
+}
+
 /* Generic API */
 hipsparseStatus_t hipsparseCreateSpVec(hipsparseSpVecDescr_t* spVecDescr,
                                        int64_t                size,
@@ -430,61 +687,13 @@ hipsparseStatus_t hipsparseCreateConstBlockedEll(hipsparseConstSpMatDescr_t* spM
                                           hipsparse::hipDataTypeToHCCDataType(valueType)));
 }
 
-hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
-                                        int64_t                rows,
-                                        int64_t                cols,
-                                        int64_t                nnz,
-                                        void*                  cooInd,
-                                        void*                  cooValues,
-                                        hipsparseIndexType_t   cooIdxType,
-                                        hipsparseIndexBase_t   idxBase,
-                                        hipDataType            valueType)
-{
-    if(spMatDescr == nullptr)
-    {
-        return HIPSPARSE_STATUS_INVALID_VALUE;
-    }
-    spMatDescr[0] = new hipsparseSpMatDescr_st();
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_coo_aos_descr(spMatDescr[0]->get_spmat_descr_reference(),
-                                       rows,
-                                       cols,
-                                       nnz,
-                                       cooInd,
-                                       cooValues,
-                                       hipsparse::hipIndexTypeToHCCIndexType(cooIdxType),
-                                       hipsparse::hipBaseToHCCBase(idxBase),
-                                       hipsparse::hipDataTypeToHCCDataType(valueType)));
-}
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_create_csr_descr_SWDEV_453599(rocsparse_spmat_descr* descr,
-                                                         int64_t                rows,
-                                                         int64_t                cols,
-                                                         int64_t                nnz,
-                                                         void*                  csrRowPtr,
-                                                         void*                  csrColInd,
-                                                         void*                  csrVal,
-                                                         rocsparse_indextype    row_ptr_type,
-                                                         rocsparse_indextype    col_ind_type,
-                                                         rocsparse_index_base   idx_base,
-                                                         rocsparse_datatype     data_type);
-#ifdef __cplusplus
-}
-#endif
-
-hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
+hipsparseStatus_t hipsparseCreateEll(hipsparseSpMatDescr_t* spMatDescr,
                                      int64_t                rows,
                                      int64_t                cols,
-                                     int64_t                nnz,
-                                     void*                  csrRowOffsets,
-                                     void*                  csrColInd,
-                                     void*                  csrValues,
-                                     hipsparseIndexType_t   csrRowOffsetsType,
-                                     hipsparseIndexType_t   csrColIndType,
+                                     int64_t                ellWidth,
+                                     void*                  ellColInd,
+                                     void*                  ellValues,
+                                     hipsparseIndexType_t   ellIdxType,
                                      hipsparseIndexBase_t   idxBase,
                                      hipDataType            valueType)
 {
@@ -493,30 +702,25 @@ hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
     spMatDescr[0] = new hipsparseSpMatDescr_st();
-
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_create_csr_descr_SWDEV_453599(
-        spMatDescr[0]->get_spmat_descr_reference(),
-        rows,
-        cols,
-        nnz,
-        csrRowOffsets,
-        csrColInd,
-        csrValues,
-        hipsparse::hipIndexTypeToHCCIndexType(csrRowOffsetsType),
-        hipsparse::hipIndexTypeToHCCIndexType(csrColIndType),
-        hipsparse::hipBaseToHCCBase(idxBase),
-        hipsparse::hipDataTypeToHCCDataType(valueType)));
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_ell_descr(spMatDescr[0]->get_spmat_descr_reference(),
+                                   rows,
+                                   cols,
+                                   ellColInd,
+                                   ellValues,
+                                   ellWidth,
+                                   hipsparse::hipIndexTypeToHCCIndexType(ellIdxType),
+                                   hipsparse::hipBaseToHCCBase(idxBase),
+                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
 }
 
-hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr,
+hipsparseStatus_t hipsparseCreateConstEll(hipsparseConstSpMatDescr_t* spMatDescr,
                                           int64_t                     rows,
                                           int64_t                     cols,
-                                          int64_t                     nnz,
-                                          const void*                 csrRowOffsets,
-                                          const void*                 csrColInd,
-                                          const void*                 csrValues,
-                                          hipsparseIndexType_t        csrRowOffsetsType,
-                                          hipsparseIndexType_t        csrColIndType,
+                                          int64_t                     ellWidth,
+                                          const void*                 ellColInd,
+                                          const void*                 ellValues,
+                                          hipsparseIndexType_t        ellIdxType,
                                           hipsparseIndexBase_t        idxBase,
                                           hipDataType                 valueType)
 {
@@ -524,55 +728,410 @@ hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
-    spMatDescr[0] = new hipsparseSpMatDescr_st();
 
+    //
+    // rocSPARSE has no constant ELL descriptor, the arrays are only read through it.
+    //
+    hipsparseSpMatDescr_t descr = new hipsparseSpMatDescr_st();
+    spMatDescr[0]               = descr;
     return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_const_csr_descr(spMatDescr[0]->get_const_spmat_descr_reference(),
-                                         rows,
-                                         cols,
-                                         nnz,
-                                         csrRowOffsets,
-                                         csrColInd,
-                                         csrValues,
-                                         hipsparse::hipIndexTypeToHCCIndexType(csrRowOffsetsType),
-                                         hipsparse::hipIndexTypeToHCCIndexType(csrColIndType),
-                                         hipsparse::hipBaseToHCCBase(idxBase),
-                                         hipsparse::hipDataTypeToHCCDataType(valueType)));
+        rocsparse_create_ell_descr(descr->get_spmat_descr_reference(),
+                                   rows,
+                                   cols,
+                                   const_cast<void*>(ellColInd),
+                                   const_cast<void*>(ellValues),
+                                   ellWidth,
+                                   hipsparse::hipIndexTypeToHCCIndexType(ellIdxType),
+                                   hipsparse::hipBaseToHCCBase(idxBase),
+                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
 }
 
-hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
-                                     int64_t                rows,
-                                     int64_t                cols,
-                                     int64_t                nnz,
-                                     void*                  cscColOffsets,
-                                     void*                  cscRowInd,
-                                     void*                  cscValues,
-                                     hipsparseIndexType_t   cscColOffsetsType,
-                                     hipsparseIndexType_t   cscRowIndType,
-                                     hipsparseIndexBase_t   idxBase,
-                                     hipDataType            valueType)
+//
+// Validate the arguments of hipsparseCreateSell and hipsparseCreateConstSell and store the
+// matrix arrays in the hipSPARSE descriptor.
+//
+static hipsparseStatus_t hipsparseCreateSellDescr(hipsparseSpMatDescr_t* spMatDescr,
+                                                  int64_t                rows,
+                                                  int64_t                cols,
+                                                  int64_t                nnz,
+                                                  int64_t                sellValuesSize,
+                                                  int64_t                sliceSize,
+                                                  const void*            sellSliceOffsets,
+                                                  const void*            sellColInd,
+                                                  const void*            sellValues,
+                                                  const void*            sellRowPerm,
+                                                  hipsparseIndexType_t   sellIdxType,
+                                                  hipsparseIndexBase_t   idxBase,
+                                                  hipDataType            valueType)
 {
     if(spMatDescr == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
     }
-    spMatDescr[0] = new hipsparseSpMatDescr_st();
-
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_csc_descr(spMatDescr[0]->get_spmat_descr_reference(),
-                                   rows,
-                                   cols,
-                                   nnz,
-                                   cscColOffsets,
-                                   cscRowInd,
-                                   cscValues,
-                                   hipsparse::hipIndexTypeToHCCIndexType(cscColOffsetsType),
-                                   hipsparse::hipIndexTypeToHCCIndexType(cscRowIndType),
-                                   hipsparse::hipBaseToHCCBase(idxBase),
-                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
-}
 
-hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr,
+    if(rows < 0 || cols < 0 || nnz < 0 || sliceSize <= 0 || sellValuesSize < nnz)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if((rows > 0 && sellSliceOffsets == nullptr)
+       || (sellValuesSize > 0 && (sellColInd == nullptr || sellValues == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(sellIdxType != HIPSPARSE_INDEX_32I && sellIdxType != HIPSPARSE_INDEX_64I)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(idxBase != HIPSPARSE_INDEX_BASE_ZERO && idxBase != HIPSPARSE_INDEX_BASE_ONE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::unique_ptr<hipsparse::host_spmat> sell = std::make_unique<hipsparse::host_spmat>();
+
+    sell->format        = HIPSPARSE_FORMAT_SELL;
+    sell->rows          = rows;
+    sell->cols          = cols;
+    sell->nnz           = nnz;
+    sell->values_size   = sellValuesSize;
+    sell->slice_size    = sliceSize;
+    sell->slice_offsets = const_cast<void*>(sellSliceOffsets);
+    sell->col_ind       = const_cast<void*>(sellColInd);
+    sell->values        = const_cast<void*>(sellValues);
+    sell->row_perm      = const_cast<void*>(sellRowPerm);
+    sell->index_type    = sellIdxType;
+    sell->idx_base      = idxBase;
+    sell->value_type    = valueType;
+
+    spMatDescr[0] = new hipsparseSpMatDescr_st();
+    spMatDescr[0]->set_host_spmat(std::move(sell));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateSell(hipsparseSpMatDescr_t* spMatDescr,
+                                      int64_t                rows,
+                                      int64_t                cols,
+                                      int64_t                nnz,
+                                      int64_t                sellValuesSize,
+                                      int64_t                sliceSize,
+                                      void*                  sellSliceOffsets,
+                                      void*                  sellColInd,
+                                      void*                  sellValues,
+                                      void*                  sellRowPerm,
+                                      hipsparseIndexType_t   sellIdxType,
+                                      hipsparseIndexBase_t   idxBase,
+                                      hipDataType            valueType)
+{
+    return hipsparseCreateSellDescr(spMatDescr,
+                                    rows,
+                                    cols,
+                                    nnz,
+                                    sellValuesSize,
+                                    sliceSize,
+                                    sellSliceOffsets,
+                                    sellColInd,
+                                    sellValues,
+                                    sellRowPerm,
+                                    sellIdxType,
+                                    idxBase,
+                                    valueType);
+}
+
+hipsparseStatus_t hipsparseCreateConstSell(hipsparseConstSpMatDescr_t* spMatDescr,
+                                           int64_t                     rows,
+                                           int64_t                     cols,
+                                           int64_t                     nnz,
+                                           int64_t                     sellValuesSize,
+                                           int64_t                     sliceSize,
+                                           const void*                 sellSliceOffsets,
+                                           const void*                 sellColInd,
+                                           const void*                 sellValues,
+                                           const void*                 sellRowPerm,
+                                           hipsparseIndexType_t        sellIdxType,
+                                           hipsparseIndexBase_t        idxBase,
+                                           hipDataType                 valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseSpMatDescr_t descr;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateSellDescr(&descr,
+                                                       rows,
+                                                       cols,
+                                                       nnz,
+                                                       sellValuesSize,
+                                                       sliceSize,
+                                                       sellSliceOffsets,
+                                                       sellColInd,
+                                                       sellValues,
+                                                       sellRowPerm,
+                                                       sellIdxType,
+                                                       idxBase,
+                                                       valueType));
+
+    spMatDescr[0] = descr;
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Validate the arguments of hipsparseCreateDia and hipsparseCreateConstDia and store the matrix
+// arrays in the hipSPARSE descriptor.
+//
+static hipsparseStatus_t hipsparseCreateDiaDescr(hipsparseSpMatDescr_t* spMatDescr,
+                                                 int64_t                rows,
+                                                 int64_t                cols,
+                                                 int64_t                diaNumDiagonals,
+                                                 const void*            diaOffsets,
+                                                 const void*            diaValues,
+                                                 hipsparseIndexType_t   diaIdxType,
+                                                 hipsparseIndexBase_t   idxBase,
+                                                 hipDataType            valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(rows < 0 || cols < 0 || diaNumDiagonals < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(diaNumDiagonals > 0 && (diaOffsets == nullptr || (rows > 0 && diaValues == nullptr)))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(diaIdxType != HIPSPARSE_INDEX_32I && diaIdxType != HIPSPARSE_INDEX_64I)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(idxBase != HIPSPARSE_INDEX_BASE_ZERO && idxBase != HIPSPARSE_INDEX_BASE_ONE)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    std::unique_ptr<hipsparse::host_spmat> dia = std::make_unique<hipsparse::host_spmat>();
+
+    dia->format      = HIPSPARSE_FORMAT_DIA;
+    dia->rows        = rows;
+    dia->cols        = cols;
+    dia->nnz         = diaNumDiagonals * rows;
+    dia->values_size = diaNumDiagonals * rows;
+    dia->width       = diaNumDiagonals;
+    dia->dia_offsets = const_cast<void*>(diaOffsets);
+    dia->values      = const_cast<void*>(diaValues);
+    dia->index_type  = diaIdxType;
+    dia->idx_base    = idxBase;
+    dia->value_type  = valueType;
+
+    spMatDescr[0] = new hipsparseSpMatDescr_st();
+    spMatDescr[0]->set_host_spmat(std::move(dia));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateDia(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                diaNumDiagonals,
+                                     void*                  diaOffsets,
+                                     void*                  diaValues,
+                                     hipsparseIndexType_t   diaIdxType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    return hipsparseCreateDiaDescr(spMatDescr,
+                                   rows,
+                                   cols,
+                                   diaNumDiagonals,
+                                   diaOffsets,
+                                   diaValues,
+                                   diaIdxType,
+                                   idxBase,
+                                   valueType);
+}
+
+hipsparseStatus_t hipsparseCreateConstDia(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     diaNumDiagonals,
+                                          const void*                 diaOffsets,
+                                          const void*                 diaValues,
+                                          hipsparseIndexType_t        diaIdxType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseSpMatDescr_t descr;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateDiaDescr(&descr,
+                                                      rows,
+                                                      cols,
+                                                      diaNumDiagonals,
+                                                      diaOffsets,
+                                                      diaValues,
+                                                      diaIdxType,
+                                                      idxBase,
+                                                      valueType));
+
+    spMatDescr[0] = descr;
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseCreateCooAoS(hipsparseSpMatDescr_t* spMatDescr,
+                                        int64_t                rows,
+                                        int64_t                cols,
+                                        int64_t                nnz,
+                                        void*                  cooInd,
+                                        void*                  cooValues,
+                                        hipsparseIndexType_t   cooIdxType,
+                                        hipsparseIndexBase_t   idxBase,
+                                        hipDataType            valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+    spMatDescr[0] = new hipsparseSpMatDescr_st();
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_coo_aos_descr(spMatDescr[0]->get_spmat_descr_reference(),
+                                       rows,
+                                       cols,
+                                       nnz,
+                                       cooInd,
+                                       cooValues,
+                                       hipsparse::hipIndexTypeToHCCIndexType(cooIdxType),
+                                       hipsparse::hipBaseToHCCBase(idxBase),
+                                       hipsparse::hipDataTypeToHCCDataType(valueType)));
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_csr_descr_SWDEV_453599(rocsparse_spmat_descr* descr,
+                                                         int64_t                rows,
+                                                         int64_t                cols,
+                                                         int64_t                nnz,
+                                                         void*                  csrRowPtr,
+                                                         void*                  csrColInd,
+                                                         void*                  csrVal,
+                                                         rocsparse_indextype    row_ptr_type,
+                                                         rocsparse_indextype    col_ind_type,
+                                                         rocsparse_index_base   idx_base,
+                                                         rocsparse_datatype     data_type);
+#ifdef __cplusplus
+}
+#endif
+
+hipsparseStatus_t hipsparseCreateCsr(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  csrRowOffsets,
+                                     void*                  csrColInd,
+                                     void*                  csrValues,
+                                     hipsparseIndexType_t   csrRowOffsetsType,
+                                     hipsparseIndexType_t   csrColIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+    spMatDescr[0] = new hipsparseSpMatDescr_st();
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_create_csr_descr_SWDEV_453599(
+        spMatDescr[0]->get_spmat_descr_reference(),
+        rows,
+        cols,
+        nnz,
+        csrRowOffsets,
+        csrColInd,
+        csrValues,
+        hipsparse::hipIndexTypeToHCCIndexType(csrRowOffsetsType),
+        hipsparse::hipIndexTypeToHCCIndexType(csrColIndType),
+        hipsparse::hipBaseToHCCBase(idxBase),
+        hipsparse::hipDataTypeToHCCDataType(valueType)));
+}
+
+hipsparseStatus_t hipsparseCreateConstCsr(hipsparseConstSpMatDescr_t* spMatDescr,
+                                          int64_t                     rows,
+                                          int64_t                     cols,
+                                          int64_t                     nnz,
+                                          const void*                 csrRowOffsets,
+                                          const void*                 csrColInd,
+                                          const void*                 csrValues,
+                                          hipsparseIndexType_t        csrRowOffsetsType,
+                                          hipsparseIndexType_t        csrColIndType,
+                                          hipsparseIndexBase_t        idxBase,
+                                          hipDataType                 valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+    spMatDescr[0] = new hipsparseSpMatDescr_st();
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_const_csr_descr(spMatDescr[0]->get_const_spmat_descr_reference(),
+                                         rows,
+                                         cols,
+                                         nnz,
+                                         csrRowOffsets,
+                                         csrColInd,
+                                         csrValues,
+                                         hipsparse::hipIndexTypeToHCCIndexType(csrRowOffsetsType),
+                                         hipsparse::hipIndexTypeToHCCIndexType(csrColIndType),
+                                         hipsparse::hipBaseToHCCBase(idxBase),
+                                         hipsparse::hipDataTypeToHCCDataType(valueType)));
+}
+
+hipsparseStatus_t hipsparseCreateCsc(hipsparseSpMatDescr_t* spMatDescr,
+                                     int64_t                rows,
+                                     int64_t                cols,
+                                     int64_t                nnz,
+                                     void*                  cscColOffsets,
+                                     void*                  cscRowInd,
+                                     void*                  cscValues,
+                                     hipsparseIndexType_t   cscColOffsetsType,
+                                     hipsparseIndexType_t   cscRowIndType,
+                                     hipsparseIndexBase_t   idxBase,
+                                     hipDataType            valueType)
+{
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+    spMatDescr[0] = new hipsparseSpMatDescr_st();
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_create_csc_descr(spMatDescr[0]->get_spmat_descr_reference(),
+                                   rows,
+                                   cols,
+                                   nnz,
+                                   cscColOffsets,
+                                   cscRowInd,
+                                   cscValues,
+                                   hipsparse::hipIndexTypeToHCCIndexType(cscColOffsetsType),
+                                   hipsparse::hipIndexTypeToHCCIndexType(cscRowIndType),
+                                   hipsparse::hipBaseToHCCBase(idxBase),
+                                   hipsparse::hipDataTypeToHCCDataType(valueType)));
+}
+
+hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr,
                                           int64_t                     rows,
                                           int64_t                     cols,
                                           int64_t                     nnz,
@@ -605,8 +1164,19 @@ hipsparseStatus_t hipsparseCreateConstCsc(hipsparseConstSpMatDescr_t* spMatDescr
 
 hipsparseStatus_t hipsparseDestroySpMat(hipsparseConstSpMatDescr_t spMatDescr)
 {
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        delete spMatDescr;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_destroy_spmat_descr(to_rocsparse_const_spmat_descr(spMatDescr)));
+
+    //
+    // Release the hipSPARSE descriptor together with its cached SpMV plans.
+    //
+    delete spMatDescr;
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
@@ -681,6 +1251,223 @@ hipsparseStatus_t hipsparseConstBlockedEllGet(hipsparseConstSpMatDescr_t spMatDe
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
+hipsparseStatus_t hipsparseEllGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    ellWidth,
+                                  void**                      ellColInd,
+                                  void**                      ellValues,
+                                  hipsparseIndexType_t*       ellIdxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    rocsparse_indextype  hcc_index_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_ell_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                rows,
+                                                cols,
+                                                ellColInd,
+                                                ellValues,
+                                                ellWidth,
+                                                ellIdxType != nullptr ? &hcc_index_type : nullptr,
+                                                idxBase != nullptr ? &hcc_index_base : nullptr,
+                                                valueType != nullptr ? &hcc_data_type : nullptr));
+
+    *ellIdxType = hipsparse::HCCIndexTypeToHIPIndexType(hcc_index_type);
+    *idxBase    = hipsparse::HCCBaseToHIPBase(hcc_index_base);
+    *valueType  = hipsparse::HCCDataTypeToHIPDataType(hcc_data_type);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstEllGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   ellWidth,
+                                       const void**               ellColInd,
+                                       const void**               ellValues,
+                                       hipsparseIndexType_t*      ellIdxType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    if(ellColInd == nullptr || ellValues == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    void* col_ind;
+    void* values;
+
+    //
+    // rocSPARSE has no constant ELL getter, the descriptor is not modified.
+    //
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseEllGet(const_cast<hipsparseSpMatDescr_t>(spMatDescr),
+                                              rows,
+                                              cols,
+                                              ellWidth,
+                                              &col_ind,
+                                              &values,
+                                              ellIdxType,
+                                              idxBase,
+                                              valueType));
+
+    *ellColInd = col_ind;
+    *ellValues = values;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSellGet(const hipsparseSpMatDescr_t spMatDescr,
+                                   int64_t*                    rows,
+                                   int64_t*                    cols,
+                                   int64_t*                    nnz,
+                                   int64_t*                    sellValuesSize,
+                                   int64_t*                    sliceSize,
+                                   void**                      sellSliceOffsets,
+                                   void**                      sellColInd,
+                                   void**                      sellValues,
+                                   void**                      sellRowPerm,
+                                   hipsparseIndexType_t*       sellIdxType,
+                                   hipsparseIndexBase_t*       idxBase,
+                                   hipDataType*                valueType)
+{
+    const void* slice_offsets;
+    const void* col_ind;
+    const void* values;
+    const void* row_perm;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseConstSellGet(spMatDescr,
+                                                    rows,
+                                                    cols,
+                                                    nnz,
+                                                    sellValuesSize,
+                                                    sliceSize,
+                                                    &slice_offsets,
+                                                    &col_ind,
+                                                    &values,
+                                                    &row_perm,
+                                                    sellIdxType,
+                                                    idxBase,
+                                                    valueType));
+
+    *sellSliceOffsets = const_cast<void*>(slice_offsets);
+    *sellColInd       = const_cast<void*>(col_ind);
+    *sellValues       = const_cast<void*>(values);
+    *sellRowPerm      = const_cast<void*>(row_perm);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstSellGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                        int64_t*                   rows,
+                                        int64_t*                   cols,
+                                        int64_t*                   nnz,
+                                        int64_t*                   sellValuesSize,
+                                        int64_t*                   sliceSize,
+                                        const void**               sellSliceOffsets,
+                                        const void**               sellColInd,
+                                        const void**               sellValues,
+                                        const void**               sellRowPerm,
+                                        hipsparseIndexType_t*      sellIdxType,
+                                        hipsparseIndexBase_t*      idxBase,
+                                        hipDataType*               valueType)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || nnz == nullptr
+       || sellValuesSize == nullptr || sliceSize == nullptr || sellSliceOffsets == nullptr
+       || sellColInd == nullptr || sellValues == nullptr || sellRowPerm == nullptr
+       || sellIdxType == nullptr || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::host_spmat* sell = spMatDescr->get_host_spmat();
+    if(sell == nullptr || sell->format != HIPSPARSE_FORMAT_SELL)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows             = sell->rows;
+    *cols             = sell->cols;
+    *nnz              = sell->nnz;
+    *sellValuesSize   = sell->values_size;
+    *sliceSize        = sell->slice_size;
+    *sellSliceOffsets = sell->slice_offsets;
+    *sellColInd       = sell->col_ind;
+    *sellValues       = sell->values;
+    *sellRowPerm      = sell->row_perm;
+    *sellIdxType      = sell->index_type;
+    *idxBase          = sell->idx_base;
+    *valueType        = sell->value_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDiaGet(const hipsparseSpMatDescr_t spMatDescr,
+                                  int64_t*                    rows,
+                                  int64_t*                    cols,
+                                  int64_t*                    diaNumDiagonals,
+                                  void**                      diaOffsets,
+                                  void**                      diaValues,
+                                  hipsparseIndexType_t*       diaIdxType,
+                                  hipsparseIndexBase_t*       idxBase,
+                                  hipDataType*                valueType)
+{
+    const void* offsets;
+    const void* values;
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseConstDiaGet(spMatDescr,
+                                                   rows,
+                                                   cols,
+                                                   diaNumDiagonals,
+                                                   &offsets,
+                                                   &values,
+                                                   diaIdxType,
+                                                   idxBase,
+                                                   valueType));
+
+    *diaOffsets = const_cast<void*>(offsets);
+    *diaValues  = const_cast<void*>(values);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseConstDiaGet(hipsparseConstSpMatDescr_t spMatDescr,
+                                       int64_t*                   rows,
+                                       int64_t*                   cols,
+                                       int64_t*                   diaNumDiagonals,
+                                       const void**               diaOffsets,
+                                       const void**               diaValues,
+                                       hipsparseIndexType_t*      diaIdxType,
+                                       hipsparseIndexBase_t*      idxBase,
+                                       hipDataType*               valueType)
+{
+    if(spMatDescr == nullptr || rows == nullptr || cols == nullptr || diaNumDiagonals == nullptr
+       || diaOffsets == nullptr || diaValues == nullptr || diaIdxType == nullptr
+       || idxBase == nullptr || valueType == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::host_spmat* dia = spMatDescr->get_host_spmat();
+    if(dia == nullptr || dia->format != HIPSPARSE_FORMAT_DIA)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *rows            = dia->rows;
+    *cols            = dia->cols;
+    *diaNumDiagonals = dia->width;
+    *diaOffsets      = dia->dia_offsets;
+    *diaValues       = dia->values;
+    *diaIdxType      = dia->index_type;
+    *idxBase         = dia->idx_base;
+    *valueType       = dia->value_type;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseCooGet(const hipsparseSpMatDescr_t spMatDescr,
                                   int64_t*                    rows,
                                   int64_t*                    cols,
@@ -861,9 +1648,397 @@ hipsparseStatus_t hipsparseCsrSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 csrColInd,
                                           void*                 csrValues)
 {
+    void* csr_row_ptr{};
+    void* csr_col_ind{};
 
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csr_set_pointers(
+    if(spMatDescr != nullptr)
+    {
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        void*                csr_val;
+        rocsparse_indextype  hcc_row_index_type;
+        rocsparse_indextype  hcc_col_index_type;
+        rocsparse_index_base hcc_index_base;
+        rocsparse_datatype   hcc_data_type;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &csr_row_ptr,
+                                                    &csr_col_ind,
+                                                    &csr_val,
+                                                    &hcc_row_index_type,
+                                                    &hcc_col_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(
         to_rocsparse_spmat_descr(spMatDescr), csrRowOffsets, csrColInd, csrValues));
+
+    //
+    // Attached analysis data remains valid if only the values pointer changed.
+    //
+    if(csr_row_ptr != csrRowOffsets || csr_col_ind != csrColInd)
+    {
+        spMatDescr->structure_changed();
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::check_stream_not_capturing(hipStream_t stream)
+{
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    RETURN_IF_HIP_ERROR(hipStreamIsCapturing(stream, &capture_status));
+
+    return (capture_status == hipStreamCaptureStatusNone) ? HIPSPARSE_STATUS_SUCCESS
+                                                          : HIPSPARSE_STATUS_NOT_SUPPORTED;
+}
+
+hipsparseStatus_t hipsparse::synchronize_stream(hipsparseHandle_t handle, hipStream_t stream)
+{
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    hipsparse::count_synchronization(handle);
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::copy_indices_to_host(hipsparseHandle_t     handle,
+                                                 hipStream_t           stream,
+                                                 const void*           indices,
+                                                 hipsparseIndexType_t  indexType,
+                                                 int64_t               size,
+                                                 int64_t               base,
+                                                 std::vector<int64_t>& host)
+{
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    host.resize(size);
+
+    if(size == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(indexType == HIPSPARSE_INDEX_64I)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            host.data(), indices, sizeof(int64_t) * size, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+    else if(indexType == HIPSPARSE_INDEX_32I)
+    {
+        std::vector<int32_t> host32(size);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            host32.data(), indices, sizeof(int32_t) * size, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+        std::copy(host32.begin(), host32.end(), host.begin());
+    }
+    else
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    for(int64_t i = 0; i < size; ++i)
+    {
+        host[i] -= base;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::copy_indices_to_device(hipsparseHandle_t           handle,
+                                                   hipStream_t                 stream,
+                                                   const std::vector<int64_t>& host,
+                                                   int64_t                     base,
+                                                   hipsparseIndexType_t        indexType,
+                                                   void*                       indices)
+{
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    const int64_t size = static_cast<int64_t>(host.size());
+
+    if(size == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(indexType == HIPSPARSE_INDEX_64I)
+    {
+        std::vector<int64_t> host64(size);
+        for(int64_t i = 0; i < size; ++i)
+        {
+            host64[i] = host[i] + base;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            indices, host64.data(), sizeof(int64_t) * size, hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+    else if(indexType == HIPSPARSE_INDEX_32I)
+    {
+        std::vector<int32_t> host32(size);
+        for(int64_t i = 0; i < size; ++i)
+        {
+            host32[i] = static_cast<int32_t>(host[i] + base);
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            indices, host32.data(), sizeof(int32_t) * size, hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+    }
+    else
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+size_t hipsparse::host_value_type_size(hipDataType valueType)
+{
+    switch(valueType)
+    {
+    case HIP_R_32F:
+    {
+        return sizeof(float);
+    }
+    case HIP_R_64F:
+    {
+        return sizeof(double);
+    }
+    case HIP_C_32F:
+    {
+        return sizeof(hipComplex);
+    }
+    case HIP_C_64F:
+    {
+        return sizeof(hipDoubleComplex);
+    }
+    default:
+    {
+        return 0;
+    }
+    }
+}
+
+hipsparseStatus_t hipsparse::copy_csr_to_host(hipsparseHandle_t          handle,
+                                              hipStream_t                stream,
+                                              hipsparseConstSpMatDescr_t matCsr,
+                                              host_csr&                  A)
+{
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(matCsr, &format));
+
+    if(format != HIPSPARSE_FORMAT_CSR)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    const void*          row_data;
+    hipsparseIndexType_t row_type;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCsrGet(matCsr,
+                                                   &A.m,
+                                                   &A.n,
+                                                   &A.nnz,
+                                                   &row_data,
+                                                   &A.col_ind,
+                                                   &A.val,
+                                                   &row_type,
+                                                   &A.col_type,
+                                                   &A.base,
+                                                   &A.value_type));
+
+    return hipsparse::copy_indices_to_host(
+        handle, stream, row_data, row_type, A.m + 1, A.base, A.row_ptr);
+}
+
+//
+// Copy the attributes of a rocSPARSE matrix descriptor to a descriptor that was created from the
+// same arrays.
+//
+static hipsparseStatus_t hipsparseCopySpMatAttributes(rocsparse_const_spmat_descr source,
+                                                      rocsparse_spmat_descr       dest)
+{
+    rocsparse_fill_mode    fill_mode;
+    rocsparse_diag_type    diag_type;
+    rocsparse_matrix_type  matrix_type;
+    rocsparse_storage_mode storage_mode;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+        source, rocsparse_spmat_fill_mode, &fill_mode, sizeof(fill_mode)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+        source, rocsparse_spmat_diag_type, &diag_type, sizeof(diag_type)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+        source, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_attribute(
+        source, rocsparse_spmat_storage_mode, &storage_mode, sizeof(storage_mode)));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+        dest, rocsparse_spmat_fill_mode, &fill_mode, sizeof(fill_mode)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+        dest, rocsparse_spmat_diag_type, &diag_type, sizeof(diag_type)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+        dest, rocsparse_spmat_matrix_type, &matrix_type, sizeof(matrix_type)));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+        dest, rocsparse_spmat_storage_mode, &storage_mode, sizeof(storage_mode)));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::set_csr_nnz(hipsparseSpMatDescr_t spMatDescr, int64_t nnz)
+{
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              csr_nnz;
+    void*                csr_row_ptr;
+    void*                csr_col_ind;
+    void*                csr_val;
+    rocsparse_indextype  hcc_row_index_type;
+    rocsparse_indextype  hcc_col_index_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                &rows,
+                                                &cols,
+                                                &csr_nnz,
+                                                &csr_row_ptr,
+                                                &csr_col_ind,
+                                                &csr_val,
+                                                &hcc_row_index_type,
+                                                &hcc_col_index_type,
+                                                &hcc_index_base,
+                                                &hcc_data_type));
+
+    if(csr_nnz == nnz)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // rocSPARSE only updates the number of non-zeros inside its own routines, the descriptor is
+    // recreated and its attributes are carried over.
+    //
+    rocsparse_spmat_descr descr;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr_descr_SWDEV_453599(&descr,
+                                                                      rows,
+                                                                      cols,
+                                                                      nnz,
+                                                                      csr_row_ptr,
+                                                                      csr_col_ind,
+                                                                      csr_val,
+                                                                      hcc_row_index_type,
+                                                                      hcc_col_index_type,
+                                                                      hcc_index_base,
+                                                                      hcc_data_type));
+
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseCopySpMatAttributes(to_rocsparse_const_spmat_descr(spMatDescr), descr));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_spmat_descr(spMatDescr->get_spmat_descr()));
+
+    spMatDescr->set_spmat_descr(descr);
+    spMatDescr->structure_changed();
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparse::clone_spmat_descr(rocsparse_const_spmat_descr source,
+                                               rocsparse_spmat_descr*      clone)
+{
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_format(source, &format));
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          ptr;
+    const void*          ind;
+    const void*          val;
+    rocsparse_indextype  hcc_ptr_type;
+    rocsparse_indextype  hcc_ind_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+
+    switch(format)
+    {
+    case rocsparse_format_csr:
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(source,
+                                                          &rows,
+                                                          &cols,
+                                                          &nnz,
+                                                          &ptr,
+                                                          &ind,
+                                                          &val,
+                                                          &hcc_ptr_type,
+                                                          &hcc_ind_type,
+                                                          &hcc_index_base,
+                                                          &hcc_data_type));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr_descr_SWDEV_453599(clone,
+                                                                          rows,
+                                                                          cols,
+                                                                          nnz,
+                                                                          const_cast<void*>(ptr),
+                                                                          const_cast<void*>(ind),
+                                                                          const_cast<void*>(val),
+                                                                          hcc_ptr_type,
+                                                                          hcc_ind_type,
+                                                                          hcc_index_base,
+                                                                          hcc_data_type));
+        break;
+    }
+    case rocsparse_format_csc:
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csc_get(source,
+                                                          &rows,
+                                                          &cols,
+                                                          &nnz,
+                                                          &ptr,
+                                                          &ind,
+                                                          &val,
+                                                          &hcc_ptr_type,
+                                                          &hcc_ind_type,
+                                                          &hcc_index_base,
+                                                          &hcc_data_type));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csc_descr(clone,
+                                                             rows,
+                                                             cols,
+                                                             nnz,
+                                                             const_cast<void*>(ptr),
+                                                             const_cast<void*>(ind),
+                                                             const_cast<void*>(val),
+                                                             hcc_ptr_type,
+                                                             hcc_ind_type,
+                                                             hcc_index_base,
+                                                             hcc_data_type));
+        break;
+    }
+    default:
+    {
+        //
+        // rocSPARSE keeps no analysis data in descriptors of the other formats.
+        //
+        *clone = nullptr;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+    }
+
+    hipsparseStatus_t status = hipsparseCopySpMatAttributes(source, *clone);
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        rocsparse_destroy_spmat_descr(*clone);
+        *clone = nullptr;
+    }
+
+    return status;
 }
 
 hipsparseStatus_t hipsparseCscGet(const hipsparseSpMatDescr_t spMatDescr,
@@ -947,8 +2122,45 @@ hipsparseStatus_t hipsparseCscSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cscRowInd,
                                           void*                 cscValues)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csc_set_pointers(
+    void* csc_col_ptr{};
+    void* csc_row_ind{};
+
+    if(spMatDescr != nullptr)
+    {
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        void*                csc_val;
+        rocsparse_indextype  hcc_col_index_type;
+        rocsparse_indextype  hcc_row_index_type;
+        rocsparse_index_base hcc_index_base;
+        rocsparse_datatype   hcc_data_type;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csc_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &csc_col_ptr,
+                                                    &csc_row_ind,
+                                                    &csc_val,
+                                                    &hcc_col_index_type,
+                                                    &hcc_row_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csc_set_pointers(
         to_rocsparse_spmat_descr(spMatDescr), cscColOffsets, cscRowInd, cscValues));
+
+    //
+    // Attached analysis data remains valid if only the values pointer changed.
+    //
+    if(csc_col_ptr != cscColOffsets || csc_row_ind != cscRowInd)
+    {
+        spMatDescr->structure_changed();
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
@@ -956,8 +2168,43 @@ hipsparseStatus_t hipsparseCooSetPointers(hipsparseSpMatDescr_t spMatDescr,
                                           void*                 cooColInd,
                                           void*                 cooValues)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_coo_set_pointers(
+    void* coo_row_ind{};
+    void* coo_col_ind{};
+
+    if(spMatDescr != nullptr)
+    {
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        void*                coo_val;
+        rocsparse_indextype  hcc_index_type;
+        rocsparse_index_base hcc_index_base;
+        rocsparse_datatype   hcc_data_type;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &coo_row_ind,
+                                                    &coo_col_ind,
+                                                    &coo_val,
+                                                    &hcc_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo_set_pointers(
         to_rocsparse_spmat_descr(spMatDescr), cooRowInd, cooColInd, cooValues));
+
+    //
+    // Attached analysis data remains valid if only the values pointer changed.
+    //
+    if(coo_row_ind != cooRowInd || coo_col_ind != cooColInd)
+    {
+        spMatDescr->structure_changed();
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
@@ -965,6 +2212,19 @@ hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
                                         int64_t*                   cols,
                                         int64_t*                   nnz)
 {
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        if(rows == nullptr || cols == nullptr || nnz == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *rows = spMatDescr->get_host_spmat()->rows;
+        *cols = spMatDescr->get_host_spmat()->cols;
+        *nnz  = spMatDescr->get_host_spmat()->nnz;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmat_get_size(to_rocsparse_const_spmat_descr(spMatDescr), rows, cols, nnz));
 }
@@ -972,6 +2232,17 @@ hipsparseStatus_t hipsparseSpMatGetSize(hipsparseConstSpMatDescr_t spMatDescr,
 hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
                                           hipsparseFormat_t*         format)
 {
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        if(format == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *format = spMatDescr->get_host_spmat()->format;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     rocsparse_format hcc_format;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_get_format(
         to_rocsparse_const_spmat_descr(spMatDescr), format != nullptr ? &hcc_format : nullptr));
@@ -984,6 +2255,17 @@ hipsparseStatus_t hipsparseSpMatGetFormat(hipsparseConstSpMatDescr_t spMatDescr,
 hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDescr,
                                              hipsparseIndexBase_t*      idxBase)
 {
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        if(idxBase == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *idxBase = spMatDescr->get_host_spmat()->idx_base;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     rocsparse_index_base hcc_index_base;
     RETURN_IF_ROCSPARSE_ERROR(
         rocsparse_spmat_get_index_base(to_rocsparse_const_spmat_descr(spMatDescr),
@@ -994,8 +2276,19 @@ hipsparseStatus_t hipsparseSpMatGetIndexBase(hipsparseConstSpMatDescr_t spMatDes
     return HIPSPARSE_STATUS_SUCCESS;
 }
 
-hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
-{
+hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void** values)
+{
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        if(values == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *values = spMatDescr->get_host_spmat()->values;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmat_get_values(to_rocsparse_spmat_descr(spMatDescr), values));
 }
@@ -1003,16 +2296,209 @@ hipsparseStatus_t hipsparseSpMatGetValues(hipsparseSpMatDescr_t spMatDescr, void
 hipsparseStatus_t hipsparseConstSpMatGetValues(hipsparseConstSpMatDescr_t spMatDescr,
                                                const void**               values)
 {
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        if(values == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *values = spMatDescr->get_host_spmat()->values;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_const_spmat_get_values(to_rocsparse_const_spmat_descr(spMatDescr), values));
 }
 
 hipsparseStatus_t hipsparseSpMatSetValues(hipsparseSpMatDescr_t spMatDescr, void* values)
 {
+    if(spMatDescr != nullptr && spMatDescr->get_host_spmat() != nullptr)
+    {
+        if(values == nullptr && spMatDescr->get_host_spmat()->values_size > 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        spMatDescr->get_host_spmat()->values = values;
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmat_set_values(to_rocsparse_spmat_descr(spMatDescr), values));
 }
 
+hipsparseStatus_t hipsparseSpMatUpdateValues(hipsparseHandle_t     handle,
+                                             hipsparseSpMatDescr_t spMatDescr,
+                                             const void*           values)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(values == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+    //
+    // SELL and DIA matrices are not backed by a rocSPARSE descriptor, copy the whole values
+    // array including the padding.
+    //
+    const hipsparse::host_spmat* host = spMatDescr->get_host_spmat();
+    if(host != nullptr)
+    {
+        const size_t value_size = hipsparse::host_value_type_size(host->value_type);
+        if(value_size == 0)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(host->values_size > 0 && host->values != values)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(host->values,
+                                               values,
+                                               value_size * host->values_size,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    int batch_count;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_strided_batch(to_rocsparse_const_spmat_descr(spMatDescr), &batch_count));
+
+    if(batch_count > 1)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    rocsparse_format hcc_format;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_format(to_rocsparse_const_spmat_descr(spMatDescr), &hcc_format));
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    int64_t              ell_width;
+    void*                row_data;
+    void*                col_data;
+    void*                val_data;
+    rocsparse_indextype  hcc_row_index_type;
+    rocsparse_indextype  hcc_col_index_type;
+    rocsparse_index_base hcc_index_base;
+    rocsparse_datatype   hcc_data_type;
+
+    switch(hcc_format)
+    {
+    case rocsparse_format_csr:
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &row_data,
+                                                    &col_data,
+                                                    &val_data,
+                                                    &hcc_row_index_type,
+                                                    &hcc_col_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+        break;
+    case rocsparse_format_csc:
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csc_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &col_data,
+                                                    &row_data,
+                                                    &val_data,
+                                                    &hcc_col_index_type,
+                                                    &hcc_row_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+        break;
+    case rocsparse_format_coo:
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &nnz,
+                                                    &row_data,
+                                                    &col_data,
+                                                    &val_data,
+                                                    &hcc_row_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+        break;
+    case rocsparse_format_coo_aos:
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo_aos_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                        &rows,
+                                                        &cols,
+                                                        &nnz,
+                                                        &row_data,
+                                                        &val_data,
+                                                        &hcc_row_index_type,
+                                                        &hcc_index_base,
+                                                        &hcc_data_type));
+        break;
+    case rocsparse_format_ell:
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_ell_get(to_rocsparse_spmat_descr(spMatDescr),
+                                                    &rows,
+                                                    &cols,
+                                                    &col_data,
+                                                    &val_data,
+                                                    &ell_width,
+                                                    &hcc_col_index_type,
+                                                    &hcc_index_base,
+                                                    &hcc_data_type));
+
+        // The padding is part of the values array
+        nnz = rows * ell_width;
+        break;
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(nnz == 0 || val_data == values)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // The values are copied into the array the descriptor already points to, such that the
+    // sparsity pattern, all array pointers and hence all attached analysis data stay valid.
+    //
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(val_data,
+                                       values,
+                                       hipsparse::HCCDataTypeSize(hcc_data_type) * nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    //
+    // The device copy of a general ELL matrix keeps its structure, the values are gathered by
+    // each product. rocSPARSE is prepared again for the new values.
+    //
+    hipsparse::device_spmat* device = spMatDescr->get_device_spmat();
+    if(device != nullptr)
+    {
+        device->spmm_preprocessed = 0;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
 hipsparseStatus_t hipsparseSpMatGetStridedBatch(hipsparseConstSpMatDescr_t spMatDescr,
                                                 int*                       batchCount)
 {
@@ -1046,11 +2532,89 @@ hipsparseStatus_t hipsparseCsrSetStridedBatch(hipsparseSpMatDescr_t spMatDescr,
                                         columnsValuesBatchStride));
 }
 
+//
+// Size of the value of a sparse matrix attribute, 0 for attributes that do not exist.
+//
+static size_t hipsparseSpMatAttributeSize(hipsparseSpMatAttribute_t attribute)
+{
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+    {
+        return sizeof(hipsparseFillMode_t);
+    }
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+    {
+        return sizeof(hipsparseDiagType_t);
+    }
+    case HIPSPARSE_SPMAT_MATRIX_TYPE:
+    {
+        return sizeof(hipsparseMatrixType_t);
+    }
+    }
+
+    return 0;
+}
+
 hipsparseStatus_t hipsparseSpMatGetAttribute(hipsparseConstSpMatDescr_t spMatDescr,
                                              hipsparseSpMatAttribute_t  attribute,
                                              void*                      data,
                                              size_t                     dataSize)
 {
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const size_t size = hipsparseSpMatAttributeSize(attribute);
+    if(size == 0 || dataSize != size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    //
+    // Formats rocSPARSE does not support keep their attributes in the host matrix.
+    //
+    const hipsparse::host_spmat* host_spmat = spMatDescr->get_host_spmat();
+    if(host_spmat != nullptr)
+    {
+        switch(attribute)
+        {
+        case HIPSPARSE_SPMAT_FILL_MODE:
+        {
+            *static_cast<hipsparseFillMode_t*>(data) = host_spmat->fill_mode;
+            break;
+        }
+        case HIPSPARSE_SPMAT_DIAG_TYPE:
+        {
+            *static_cast<hipsparseDiagType_t*>(data) = host_spmat->diag_type;
+            break;
+        }
+        case HIPSPARSE_SPMAT_MATRIX_TYPE:
+        {
+            *static_cast<hipsparseMatrixType_t*>(data) = host_spmat->matrix_type;
+            break;
+        }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(attribute == HIPSPARSE_SPMAT_MATRIX_TYPE)
+    {
+        rocsparse_matrix_type matrix_type;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(spMatDescr),
+                                          rocsparse_spmat_matrix_type,
+                                          &matrix_type,
+                                          sizeof(matrix_type)));
+
+        *static_cast<hipsparseMatrixType_t*>(data)
+            = hipsparse::HCCMatTypeToHIPMatType(matrix_type);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_spmat_get_attribute(to_rocsparse_const_spmat_descr(spMatDescr),
                                       (rocsparse_spmat_attribute)attribute,
@@ -1063,11 +2627,414 @@ hipsparseStatus_t hipsparseSpMatSetAttribute(hipsparseSpMatDescr_t     spMatDesc
                                              const void*               data,
                                              size_t                    dataSize)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_spmat_set_attribute(to_rocsparse_spmat_descr(spMatDescr),
-                                      (rocsparse_spmat_attribute)attribute,
-                                      data,
-                                      dataSize));
+    if(spMatDescr == nullptr || data == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const size_t size = hipsparseSpMatAttributeSize(attribute);
+    if(size == 0 || dataSize != size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The enum conversions below do not accept values out of range
+    switch(attribute)
+    {
+    case HIPSPARSE_SPMAT_FILL_MODE:
+    {
+        const hipsparseFillMode_t fill_mode = *static_cast<const hipsparseFillMode_t*>(data);
+        if(fill_mode != HIPSPARSE_FILL_MODE_LOWER && fill_mode != HIPSPARSE_FILL_MODE_UPPER)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+        break;
+    }
+    case HIPSPARSE_SPMAT_DIAG_TYPE:
+    {
+        const hipsparseDiagType_t diag_type = *static_cast<const hipsparseDiagType_t*>(data);
+        if(diag_type != HIPSPARSE_DIAG_TYPE_NON_UNIT && diag_type != HIPSPARSE_DIAG_TYPE_UNIT)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+        break;
+    }
+    case HIPSPARSE_SPMAT_MATRIX_TYPE:
+    {
+        const hipsparseMatrixType_t matrix_type
+            = *static_cast<const hipsparseMatrixType_t*>(data);
+        if(matrix_type != HIPSPARSE_MATRIX_TYPE_GENERAL
+           && matrix_type != HIPSPARSE_MATRIX_TYPE_SYMMETRIC
+           && matrix_type != HIPSPARSE_MATRIX_TYPE_HERMITIAN
+           && matrix_type != HIPSPARSE_MATRIX_TYPE_TRIANGULAR)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+        break;
+    }
+    }
+
+    hipsparse::host_spmat* host_spmat = spMatDescr->get_host_spmat();
+    if(host_spmat != nullptr)
+    {
+        switch(attribute)
+        {
+        case HIPSPARSE_SPMAT_FILL_MODE:
+        {
+            host_spmat->fill_mode = *static_cast<const hipsparseFillMode_t*>(data);
+            break;
+        }
+        case HIPSPARSE_SPMAT_DIAG_TYPE:
+        {
+            host_spmat->diag_type = *static_cast<const hipsparseDiagType_t*>(data);
+            break;
+        }
+        case HIPSPARSE_SPMAT_MATRIX_TYPE:
+        {
+            host_spmat->matrix_type = *static_cast<const hipsparseMatrixType_t*>(data);
+            break;
+        }
+        }
+
+        //
+        // The matrix type and the fill mode select the entries of the device copy of the matrix.
+        //
+        if(attribute != HIPSPARSE_SPMAT_DIAG_TYPE)
+        {
+            spMatDescr->structure_changed();
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(attribute == HIPSPARSE_SPMAT_MATRIX_TYPE)
+    {
+        const rocsparse_matrix_type matrix_type = hipsparse::hipMatTypeToHCCMatType(
+            *static_cast<const hipsparseMatrixType_t*>(data));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+            to_rocsparse_spmat_descr(spMatDescr), rocsparse_spmat_matrix_type, &matrix_type, size));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_spmat_set_attribute(to_rocsparse_spmat_descr(spMatDescr),
+                                          (rocsparse_spmat_attribute)attribute,
+                                          data,
+                                          dataSize));
+    }
+
+    //
+    // The matrix type and the fill mode select the SpMV algorithm, SpMV plans of the matrix are
+    // dropped when they change.
+    //
+    if(attribute != HIPSPARSE_SPMAT_DIAG_TYPE)
+    {
+        spMatDescr->structure_changed();
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+//
+// Compress zero based row indices of a COO (or transposed CSC) pattern into a CSR pattern.
+//
+static void hipsparseCompressRows(int64_t                     m,
+                                  const std::vector<int64_t>& row_ind,
+                                  const std::vector<int64_t>& col_ind,
+                                  std::vector<int64_t>&       csr_row_ptr,
+                                  std::vector<int64_t>&       csr_col_ind)
+{
+    const int64_t nnz = static_cast<int64_t>(row_ind.size());
+
+    csr_row_ptr.assign(m + 1, 0);
+    csr_col_ind.resize(nnz);
+
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+        ++csr_row_ptr[row_ind[k] + 1];
+    }
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
+    }
+
+    std::vector<int64_t> offset(csr_row_ptr.begin(), csr_row_ptr.end() - 1);
+    for(int64_t k = 0; k < nnz; ++k)
+    {
+        csr_col_ind[offset[row_ind[k]]++] = col_ind[k];
+    }
+}
+
+//
+// Structural statistics of a zero based CSR pattern.
+//
+static void hipsparseComputeStatistics(int64_t                     m,
+                                       int64_t                     n,
+                                       const std::vector<int64_t>& csr_row_ptr,
+                                       std::vector<int64_t>&       csr_col_ind,
+                                       hipsparseSpMatStatistics_t* stats)
+{
+    *stats = hipsparseSpMatStatistics_t{};
+
+    stats->rows = m;
+    stats->cols = n;
+    stats->nnz  = (m > 0) ? csr_row_ptr[m] : 0;
+
+    if(m == 0)
+    {
+        stats->hasFullDiagonal         = 1;
+        stats->isStructurallySymmetric = (n == 0) ? 1 : 0;
+        return;
+    }
+
+    stats->minRowNnz  = stats->nnz;
+    stats->meanRowNnz = static_cast<double>(stats->nnz) / m;
+
+    const int64_t min_mn        = std::min(m, n);
+    int64_t       diagonal_rows = 0;
+    double        sum_sq        = 0.0;
+
+    for(int64_t i = 0; i < m; ++i)
+    {
+        const int64_t row_begin = csr_row_ptr[i];
+        const int64_t row_end   = csr_row_ptr[i + 1];
+        const int64_t row_nnz   = row_end - row_begin;
+
+        stats->minRowNnz = std::min(stats->minRowNnz, row_nnz);
+        stats->maxRowNnz = std::max(stats->maxRowNnz, row_nnz);
+        stats->emptyRows += (row_nnz == 0) ? 1 : 0;
+
+        int bin = 0;
+        for(int64_t len = row_nnz; len > 0; len >>= 1)
+        {
+            ++bin;
+        }
+        ++stats->rowNnzHistogram[std::min(bin, HIPSPARSE_SPMAT_STATISTICS_HISTOGRAM_BINS - 1)];
+
+        const double diff = row_nnz - stats->meanRowNnz;
+        sum_sq += diff * diff;
+
+        bool has_diagonal = false;
+        for(int64_t k = row_begin; k < row_end; ++k)
+        {
+            const int64_t j = csr_col_ind[k];
+
+            stats->lowerBandwidth = std::max(stats->lowerBandwidth, i - j);
+            stats->upperBandwidth = std::max(stats->upperBandwidth, j - i);
+
+            if(i == j)
+            {
+                ++stats->diagonalNnz;
+                has_diagonal = true;
+            }
+        }
+
+        diagonal_rows += (has_diagonal && i < min_mn) ? 1 : 0;
+
+        // Sort the row, such that the symmetry test below can use binary search
+        std::sort(csr_col_ind.begin() + row_begin, csr_col_ind.begin() + row_end);
+    }
+
+    stats->stdDevRowNnz    = std::sqrt(sum_sq / m);
+    stats->hasFullDiagonal = (diagonal_rows == min_mn) ? 1 : 0;
+
+    //
+    // The pattern is symmetric if (j, i) is stored for every stored (i, j).
+    //
+    stats->isStructurallySymmetric = (m == n) ? 1 : 0;
+    for(int64_t i = 0; i < m && stats->isStructurallySymmetric; ++i)
+    {
+        for(int64_t k = csr_row_ptr[i]; k < csr_row_ptr[i + 1]; ++k)
+        {
+            const int64_t j = csr_col_ind[k];
+
+            if(i != j
+               && !std::binary_search(csr_col_ind.begin() + csr_row_ptr[j],
+                                      csr_col_ind.begin() + csr_row_ptr[j + 1],
+                                      i))
+            {
+                stats->isStructurallySymmetric = 0;
+                break;
+            }
+        }
+    }
+}
+
+hipsparseStatus_t hipsparseSpMatGetStatistics(hipsparseHandle_t           handle,
+                                              hipsparseConstSpMatDescr_t  spMatDescr,
+                                              hipsparseSpMatStatistics_t* statistics)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(spMatDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(statistics == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    //
+    // SELL and DIA matrices are stored in formats rocSPARSE does not support.
+    //
+    if(spMatDescr->get_host_spmat() != nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(spMatDescr->has_statistics())
+    {
+        *statistics = spMatDescr->get_statistics();
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipStream_t stream;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+    hipsparseFormat_t format;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetFormat(spMatDescr, &format));
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          row_data;
+    const void*          col_data;
+    const void*          val_data;
+    hipsparseIndexType_t row_index_type;
+    hipsparseIndexType_t col_index_type;
+    hipsparseIndexBase_t index_base;
+    hipDataType          data_type;
+
+    std::vector<int64_t> csr_row_ptr;
+    std::vector<int64_t> csr_col_ind;
+
+    switch(format)
+    {
+    case HIPSPARSE_FORMAT_CSR:
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCsrGet(spMatDescr,
+                                                       &rows,
+                                                       &cols,
+                                                       &nnz,
+                                                       &row_data,
+                                                       &col_data,
+                                                       &val_data,
+                                                       &row_index_type,
+                                                       &col_index_type,
+                                                       &index_base,
+                                                       &data_type));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, row_data, row_index_type, rows + 1, index_base, csr_row_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, col_data, col_index_type, nnz, index_base, csr_col_ind));
+        break;
+    }
+    case HIPSPARSE_FORMAT_CSC:
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCscGet(spMatDescr,
+                                                       &rows,
+                                                       &cols,
+                                                       &nnz,
+                                                       &col_data,
+                                                       &row_data,
+                                                       &val_data,
+                                                       &col_index_type,
+                                                       &row_index_type,
+                                                       &index_base,
+                                                       &data_type));
+
+        std::vector<int64_t> csc_col_ptr;
+        std::vector<int64_t> csc_row_ind;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, col_data, col_index_type, cols + 1, index_base, csc_col_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, row_data, row_index_type, nnz, index_base, csc_row_ind));
+
+        // Expand the column pointer into column indices
+        std::vector<int64_t> coo_col_ind(nnz);
+        for(int64_t j = 0; j < cols; ++j)
+        {
+            for(int64_t k = csc_col_ptr[j]; k < csc_col_ptr[j + 1]; ++k)
+            {
+                coo_col_ind[k] = j;
+            }
+        }
+
+        hipsparseCompressRows(rows, csc_row_ind, coo_col_ind, csr_row_ptr, csr_col_ind);
+        break;
+    }
+    case HIPSPARSE_FORMAT_COO:
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseConstCooGet(spMatDescr,
+                                                       &rows,
+                                                       &cols,
+                                                       &nnz,
+                                                       &row_data,
+                                                       &col_data,
+                                                       &val_data,
+                                                       &row_index_type,
+                                                       &index_base,
+                                                       &data_type));
+
+        std::vector<int64_t> coo_row_ind;
+        std::vector<int64_t> coo_col_ind;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, row_data, row_index_type, nnz, index_base, coo_row_ind));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::copy_indices_to_host(
+            handle, stream, col_data, row_index_type, nnz, index_base, coo_col_ind));
+
+        hipsparseCompressRows(rows, coo_row_ind, coo_col_ind, csr_row_ptr, csr_col_ind);
+        break;
+    }
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // The row pointer was shifted by the index base, rebase it to start at zero
+    if(rows > 0 && format == HIPSPARSE_FORMAT_CSR && csr_row_ptr[0] != 0)
+    {
+        const int64_t offset = csr_row_ptr[0];
+        for(int64_t& i : csr_row_ptr)
+        {
+            i -= offset;
+        }
+    }
+
+    hipsparseSpMatStatistics_t stats;
+    hipsparseComputeStatistics(rows, cols, csr_row_ptr, csr_col_ind, &stats);
+
+    spMatDescr->set_statistics(stats);
+
+    //
+    // Also drive the default SpMV algorithm selection from the statistics.
+    //
+    if(format == HIPSPARSE_FORMAT_CSR)
+    {
+        hipsparse::spmv_row_statistics row_stats;
+        row_stats.m            = stats.rows;
+        row_stats.nnz          = stats.nnz;
+        row_stats.max_row_nnz  = stats.maxRowNnz;
+        row_stats.empty_rows   = stats.emptyRows;
+        row_stats.mean_row_nnz = stats.meanRowNnz;
+        row_stats.cv_row_nnz
+            = (stats.meanRowNnz > 0.0) ? stats.stdDevRowNnz / stats.meanRowNnz : 0.0;
+
+        spMatDescr->set_row_statistics(row_stats);
+    }
+
+    *statistics = stats;
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
@@ -1075,11 +3042,26 @@ hipsparseStatus_t hipsparseCreateDnVec(hipsparseDnVecDescr_t* dnVecDescr,
                                        void*                  values,
                                        hipDataType            valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_dnvec_descr((rocsparse_dnvec_descr*)dnVecDescr,
-                                     size,
-                                     values,
-                                     hipsparse::hipDataTypeToHCCDataType(valueType)));
+    if(dnVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseDnVecDescr_st* descr = new hipsparseDnVecDescr_st();
+
+    const rocsparse_status status
+        = rocsparse_create_dnvec_descr(descr->get_dnvec_descr_reference(),
+                                       size,
+                                       values,
+                                       hipsparse::hipDataTypeToHCCDataType(valueType));
+    if(status != rocsparse_status_success)
+    {
+        delete descr;
+        return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    }
+
+    dnVecDescr[0] = descr;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDescr,
@@ -1087,17 +3069,38 @@ hipsparseStatus_t hipsparseCreateConstDnVec(hipsparseConstDnVecDescr_t* dnVecDes
                                             const void*                 values,
                                             hipDataType                 valueType)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_create_const_dnvec_descr((rocsparse_const_dnvec_descr*)dnVecDescr,
-                                           size,
-                                           values,
-                                           hipsparse::hipDataTypeToHCCDataType(valueType)));
+    if(dnVecDescr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparseDnVecDescr_st* descr = new hipsparseDnVecDescr_st();
+
+    const rocsparse_status status
+        = rocsparse_create_const_dnvec_descr(descr->get_const_dnvec_descr_reference(),
+                                             size,
+                                             values,
+                                             hipsparse::hipDataTypeToHCCDataType(valueType));
+    if(status != rocsparse_status_success)
+    {
+        delete descr;
+        return hipsparse::rocSPARSEStatusToHIPStatus(status);
+    }
+
+    dnVecDescr[0] = descr;
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseDestroyDnVec(hipsparseConstDnVecDescr_t dnVecDescr)
 {
-    return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_destroy_dnvec_descr((rocsparse_const_dnvec_descr)dnVecDescr));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_destroy_dnvec_descr(to_rocsparse_const_dnvec_descr(dnVecDescr)));
+
+    //
+    // Release the hipSPARSE descriptor together with its strided batch.
+    //
+    delete static_cast<const hipsparseDnVecDescr_st*>(dnVecDescr);
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
@@ -1106,7 +3109,7 @@ hipsparseStatus_t hipsparseDnVecGet(const hipsparseDnVecDescr_t dnVecDescr,
                                     hipDataType*                valueType)
 {
     rocsparse_datatype hcc_data_type;
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnvec_get((const rocsparse_dnvec_descr)dnVecDescr,
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnvec_get(to_rocsparse_dnvec_descr(dnVecDescr),
                                                   size,
                                                   values,
                                                   valueType != nullptr ? &hcc_data_type : nullptr));
@@ -1123,7 +3126,7 @@ hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
 {
     rocsparse_datatype hcc_data_type;
     RETURN_IF_ROCSPARSE_ERROR(
-        rocsparse_const_dnvec_get((const rocsparse_const_dnvec_descr)dnVecDescr,
+        rocsparse_const_dnvec_get(to_rocsparse_const_dnvec_descr(dnVecDescr),
                                   size,
                                   values,
                                   valueType != nullptr ? &hcc_data_type : nullptr));
@@ -1136,20 +3139,67 @@ hipsparseStatus_t hipsparseConstDnVecGet(hipsparseConstDnVecDescr_t dnVecDescr,
 hipsparseStatus_t hipsparseDnVecGetValues(const hipsparseDnVecDescr_t dnVecDescr, void** values)
 {
     return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dnvec_get_values((const rocsparse_dnvec_descr)dnVecDescr, values));
+        rocsparse_dnvec_get_values(to_rocsparse_dnvec_descr(dnVecDescr), values));
 }
 
 hipsparseStatus_t hipsparseConstDnVecGetValues(hipsparseConstDnVecDescr_t dnVecDescr,
                                                const void**               values)
 {
     return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_const_dnvec_get_values((const rocsparse_const_dnvec_descr)dnVecDescr, values));
+        rocsparse_const_dnvec_get_values(to_rocsparse_const_dnvec_descr(dnVecDescr), values));
 }
 
 hipsparseStatus_t hipsparseDnVecSetValues(hipsparseDnVecDescr_t dnVecDescr, void* values)
 {
     return hipsparse::rocSPARSEStatusToHIPStatus(
-        rocsparse_dnvec_set_values((rocsparse_dnvec_descr)dnVecDescr, values));
+        rocsparse_dnvec_set_values(to_rocsparse_dnvec_descr(dnVecDescr), values));
+}
+
+hipsparseStatus_t hipsparseDnVecGetStridedBatch(hipsparseConstDnVecDescr_t dnVecDescr,
+                                                int*                       batchCount,
+                                                int64_t*                   batchStride)
+{
+    if(dnVecDescr == nullptr || batchCount == nullptr || batchStride == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const hipsparse::dnvec_strided_batch batch = hipsparse::get_dnvec_strided_batch(dnVecDescr);
+
+    *batchCount  = batch.batch_count;
+    *batchStride = batch.batch_stride;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDnVecSetStridedBatch(hipsparseDnVecDescr_t dnVecDescr,
+                                                int                   batchCount,
+                                                int64_t               batchStride)
+{
+    if(dnVecDescr == nullptr || batchCount <= 0 || batchStride < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t            size;
+    void*              values;
+    rocsparse_datatype data_type;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_dnvec_get(to_rocsparse_dnvec_descr(dnVecDescr), &size, &values, &data_type));
+
+    // Vectors of the batch must not overlap
+    if(batchCount > 1 && batchStride < size)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipsparse::dnvec_strided_batch batch;
+    batch.batch_count  = batchCount;
+    batch.batch_stride = batchStride;
+
+    static_cast<hipsparseDnVecDescr_st*>(dnVecDescr)->set_strided_batch(batch);
+
+    return HIPSPARSE_STATUS_SUCCESS;
 }
 
 hipsparseStatus_t hipsparseCreateDnMat(hipsparseDnMatDescr_t* dnMatDescr,
@@ -0,0 +1,340 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_graph.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "utility.h"
+
+struct hipsparseGraphPlan
+{
+    // Handle being captured, nullptr if the plan is not capturing
+    hipsparseHandle_t handle{};
+
+    // Stream of the handle before the capture started
+    hipStream_t user_stream{};
+
+    // Stream the calls are captured on
+    hipStream_t capture_stream{};
+
+    hipGraph_t     graph{};
+    hipGraphExec_t exec{};
+};
+
+hipsparse::stream_capture_bypass::stream_capture_bypass(hipsparseHandle_t handle, bool enable)
+    : m_handle(handle)
+{
+    if(!enable || handle == nullptr)
+    {
+        return;
+    }
+
+    m_status = hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_get_stream((rocsparse_handle)handle, &m_stream));
+
+    if(m_status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return;
+    }
+
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    m_status
+        = hipsparse::hipErrorToHIPSPARSEStatus(hipStreamIsCapturing(m_stream, &capture_status));
+
+    if(m_status != HIPSPARSE_STATUS_SUCCESS || capture_status != hipStreamCaptureStatusActive)
+    {
+        return;
+    }
+
+    // Allow allocations and synchronizations of the side stream for this thread
+    m_mode   = hipStreamCaptureModeRelaxed;
+    m_status = hipsparse::hipErrorToHIPSPARSEStatus(hipThreadExchangeStreamCaptureMode(&m_mode));
+
+    if(m_status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        return;
+    }
+
+    m_active = true;
+
+    m_status = hipsparse::hipErrorToHIPSPARSEStatus(
+        hipStreamCreateWithFlags(&m_side_stream, hipStreamNonBlocking));
+
+    if(m_status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        m_side_stream = nullptr;
+        return;
+    }
+
+    m_status = hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_set_stream((rocsparse_handle)handle, m_side_stream));
+}
+
+hipsparse::stream_capture_bypass::~stream_capture_bypass()
+{
+    restore();
+}
+
+hipsparseStatus_t hipsparse::stream_capture_bypass::status() const
+{
+    return m_status;
+}
+
+hipsparseStatus_t hipsparse::stream_capture_bypass::finish()
+{
+    if(!m_active)
+    {
+        return m_status;
+    }
+
+    if(m_side_stream != nullptr)
+    {
+        hipsparse::count_synchronization(m_handle);
+        m_status = hipsparse::hipErrorToHIPSPARSEStatus(hipStreamSynchronize(m_side_stream));
+    }
+
+    restore();
+
+    return m_status;
+}
+
+void hipsparse::stream_capture_bypass::restore()
+{
+    if(!m_active)
+    {
+        return;
+    }
+
+    rocsparse_set_stream((rocsparse_handle)m_handle, m_stream);
+
+    if(m_side_stream != nullptr)
+    {
+        // Outstanding work completes before the resources of the stream are released
+        hipStreamDestroy(m_side_stream);
+        m_side_stream = nullptr;
+    }
+
+    hipThreadExchangeStreamCaptureMode(&m_mode);
+
+    m_active = false;
+}
+
+hipsparseStatus_t hipsparseCreateGraphPlan(hipsparseGraphPlan_t* plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *plan = new hipsparseGraphPlan;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyGraphPlan(hipsparseGraphPlan_t plan)
+{
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    // Abandon an unfinished capture
+    if(plan->handle != nullptr)
+    {
+        hipGraph_t graph{};
+        if(hipStreamEndCapture(plan->capture_stream, &graph) == hipSuccess && graph != nullptr)
+        {
+            hipGraphDestroy(graph);
+        }
+
+        rocsparse_set_stream((rocsparse_handle)plan->handle, plan->user_stream);
+    }
+
+    if(plan->exec != nullptr)
+    {
+        hipGraphExecDestroy(plan->exec);
+    }
+
+    if(plan->graph != nullptr)
+    {
+        hipGraphDestroy(plan->graph);
+    }
+
+    if(plan->capture_stream != nullptr)
+    {
+        hipStreamDestroy(plan->capture_stream);
+    }
+
+    delete plan;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGraphPlanBeginCapture(hipsparseHandle_t    handle,
+                                                 hipsparseGraphPlan_t plan)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The plan is already capturing
+    if(plan->handle != nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t user_stream{};
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &user_stream));
+
+    //
+    // Capture on a stream of the plan, the handle stream might be the null stream which cannot
+    // be captured.
+    //
+    if(plan->capture_stream == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&plan->capture_stream, hipStreamNonBlocking));
+    }
+
+    RETURN_IF_HIP_ERROR(
+        hipStreamBeginCapture(plan->capture_stream, hipStreamCaptureModeThreadLocal));
+
+    hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_set_stream((rocsparse_handle)handle, plan->capture_stream));
+
+    if(status != HIPSPARSE_STATUS_SUCCESS)
+    {
+        hipGraph_t graph{};
+        if(hipStreamEndCapture(plan->capture_stream, &graph) == hipSuccess && graph != nullptr)
+        {
+            hipGraphDestroy(graph);
+        }
+
+        return status;
+    }
+
+    plan->handle      = handle;
+    plan->user_stream = user_stream;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGraphPlanEndCapture(hipsparseHandle_t    handle,
+                                               hipsparseGraphPlan_t plan)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The plan is not capturing on this handle
+    if(plan->handle != handle)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipGraph_t       graph{};
+    const hipError_t capture_status = hipStreamEndCapture(plan->capture_stream, &graph);
+
+    // The handle gets its stream back, whether the capture succeeded or not
+    plan->handle = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_stream((rocsparse_handle)handle, plan->user_stream));
+
+    if(capture_status != hipSuccess)
+    {
+        if(graph != nullptr)
+        {
+            hipGraphDestroy(graph);
+        }
+
+        return hipsparse::hipErrorToHIPSPARSEStatus(capture_status);
+    }
+
+    hipGraphExec_t exec{};
+    if(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0) != hipSuccess)
+    {
+        hipGraphDestroy(graph);
+        return HIPSPARSE_STATUS_INTERNAL_ERROR;
+    }
+
+    // Replace the previously captured sequence
+    if(plan->exec != nullptr)
+    {
+        hipGraphExecDestroy(plan->exec);
+    }
+
+    if(plan->graph != nullptr)
+    {
+        hipGraphDestroy(plan->graph);
+    }
+
+    plan->graph = graph;
+    plan->exec  = exec;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseGraphPlanLaunch(hipsparseHandle_t handle, hipsparseGraphPlan_t plan)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr)
+    {
+        return HIPSPARSE_STATUS_NOT_INITIALIZED;
+    }
+
+    if(plan == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Nothing has been captured yet, or the capture is still running
+    if(plan->exec == nullptr || plan->handle != nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream{};
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+    RETURN_IF_HIP_ERROR(hipGraphLaunch(plan->exec, stream));
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
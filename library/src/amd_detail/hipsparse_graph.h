@@ -0,0 +1,81 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_GRAPH_H
+#define HIPSPARSE_GRAPH_H
+
+//
+// Stream capture support.
+//
+// Routines that have to allocate, analyse or synchronize the first time they see a descriptor
+// cannot do so while the handle stream is being captured into a graph. stream_capture_bypass
+// moves that setup out of the capture: if the handle stream is capturing, the handle is pointed
+// to a private side stream and unsafe API calls are allowed for the calling thread until
+// finish() is called or the bypass goes out of scope. Only the work issued after that ends up
+// in the graph.
+//
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+
+namespace hipsparse
+{
+    class stream_capture_bypass
+    {
+    public:
+        //
+        // Start the bypass if enable is true and the handle stream is capturing, does nothing
+        // otherwise.
+        //
+        stream_capture_bypass(hipsparseHandle_t handle, bool enable);
+        ~stream_capture_bypass();
+
+        stream_capture_bypass(const stream_capture_bypass&)            = delete;
+        stream_capture_bypass& operator=(const stream_capture_bypass&) = delete;
+
+        //
+        // Status of starting the bypass.
+        //
+        hipsparseStatus_t status() const;
+
+        //
+        // Wait for the work issued on the side stream and point the handle back to the
+        // capturing stream.
+        //
+        hipsparseStatus_t finish();
+
+    private:
+        hipsparseHandle_t    m_handle{};
+        hipStream_t          m_stream{};
+        hipStream_t          m_side_stream{};
+        hipStreamCaptureMode m_mode{hipStreamCaptureModeRelaxed};
+        bool                 m_active{};
+        hipsparseStatus_t    m_status{HIPSPARSE_STATUS_SUCCESS};
+
+        void restore();
+    };
+}
+
+#endif // HIPSPARSE_GRAPH_H
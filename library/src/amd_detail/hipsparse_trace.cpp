@@ -0,0 +1,525 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse_trace.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define HIPSPARSE_TRACE_GETPID _getpid
+#else
+#include <unistd.h>
+#define HIPSPARSE_TRACE_GETPID getpid
+#endif
+
+namespace
+{
+    //
+    // States of a slot of the ring buffer. The state is stored in the low bits of the slot state,
+    // the ticket of the record in the remaining bits.
+    //
+    typedef enum
+    {
+        trace_slot_free     = 0,
+        trace_slot_running  = 1,
+        trace_slot_complete = 2,
+        trace_slot_flushing = 3
+    } trace_slot;
+
+    constexpr uint64_t trace_slot_bits = 2;
+    constexpr uint64_t trace_slot_mask = (uint64_t(1) << trace_slot_bits) - 1;
+
+    inline uint64_t trace_state(uint64_t ticket, trace_slot slot)
+    {
+        return (ticket << trace_slot_bits) | slot;
+    }
+
+    inline trace_slot trace_state_slot(uint64_t state)
+    {
+        return static_cast<trace_slot>(state & trace_slot_mask);
+    }
+
+    //
+    // One slot of the ring buffer. Only the owner of the slot reads or writes the fields other
+    // than state: the running call between trace_begin and trace_end, or the flush that moved
+    // a complete record into the flushing state. Ownership is taken with a compare and exchange
+    // of state and handed over with a release store.
+    //
+    struct trace_record
+    {
+        std::atomic<uint64_t> state{};
+        uint64_t              ticket{};
+        int                   routine{};
+        const char*           name{};
+        hipsparseHandle_t     handle{};
+        hipStream_t           stream{};
+        double                start_us{};
+        double                host_us{};
+        hipEvent_t            start{};
+        hipEvent_t            stop{};
+        bool                  timed{};
+        char                  args[hipsparse::trace_args_size]{};
+    };
+
+    //
+    // Snapshot of a completed record, taken while flushing.
+    //
+    struct trace_entry
+    {
+        uint64_t          ticket;
+        const char*       name;
+        hipsparseHandle_t handle;
+        hipStream_t       stream;
+        double            start_us;
+        double            host_us;
+        double            device_us;
+        std::string       args;
+    };
+
+    class trace_buffer
+    {
+    public:
+        explicit trace_buffer(uint64_t capacity)
+            : m_mask(capacity - 1)
+            , m_records(new trace_record[capacity])
+            , m_epoch(std::chrono::steady_clock::now())
+        {
+        }
+
+        // The events of the slots are released with the process, the HIP runtime might already
+        // be shut down when static objects are destroyed.
+        ~trace_buffer() = default;
+
+        uint64_t capacity() const
+        {
+            return m_mask + 1;
+        }
+
+        trace_record& slot(uint64_t ticket)
+        {
+            return m_records[(ticket - 1) & m_mask];
+        }
+
+        uint64_t next_ticket()
+        {
+            return m_head.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        int next_file_id()
+        {
+            return m_file_id.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        double now_us() const
+        {
+            return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now()
+                                                             - m_epoch)
+                .count();
+        }
+
+    private:
+        uint64_t                        m_mask;
+        std::unique_ptr<trace_record[]> m_records;
+        std::chrono::steady_clock::time_point m_epoch;
+        std::atomic<uint64_t>                 m_head{0};
+        std::atomic<int>                      m_file_id{0};
+    };
+
+    uint64_t get_trace_capacity()
+    {
+        uint64_t capacity = 65536;
+
+        const char* env = std::getenv("HIPSPARSE_TRACE_BUFFER_SIZE");
+        if(env != nullptr)
+        {
+            unsigned long long value = std::strtoull(env, nullptr, 10);
+            if(value > 0)
+            {
+                capacity = value;
+            }
+        }
+
+        // Round up to the next power of two, such that the slot is a mask of the ticket
+        uint64_t pow2 = 16;
+        while(pow2 < capacity)
+        {
+            pow2 <<= 1;
+        }
+
+        return pow2;
+    }
+
+    trace_buffer& get_trace_buffer()
+    {
+        static trace_buffer buffer(get_trace_capacity());
+        return buffer;
+    }
+
+    //
+    // Device time of a completed record in microseconds, or -1 if it is not available. If wait
+    // is false, records whose events have not completed yet are reported as not available.
+    //
+    double device_time_us(const trace_record& record, bool wait)
+    {
+        if(!record.timed)
+        {
+            return -1.0;
+        }
+
+        if(wait ? (hipEventSynchronize(record.stop) != hipSuccess)
+                : (hipEventQuery(record.stop) != hipSuccess))
+        {
+            return -1.0;
+        }
+
+        float ms;
+        if(hipEventElapsedTime(&ms, record.start, record.stop) != hipSuccess)
+        {
+            return -1.0;
+        }
+
+        return ms * 1000.0;
+    }
+
+    void write_csv(FILE* file, const std::vector<trace_entry>& entries)
+    {
+        std::fprintf(file, "name,handle,stream,start_us,host_us,device_us,args\n");
+
+        for(const trace_entry& e : entries)
+        {
+            std::fprintf(file,
+                         "%s,%p,%p,%.3f,%.3f,%.3f,\"%s\"\n",
+                         e.name,
+                         static_cast<const void*>(e.handle),
+                         static_cast<const void*>(e.stream),
+                         e.start_us,
+                         e.host_us,
+                         e.device_us,
+                         e.args.c_str());
+        }
+    }
+
+    void write_json(FILE* file, const std::vector<trace_entry>& entries)
+    {
+        std::fprintf(file, "[\n");
+
+        for(size_t i = 0; i < entries.size(); ++i)
+        {
+            const trace_entry& e = entries[i];
+
+            std::fprintf(file,
+                         "  {\"name\": \"%s\", \"handle\": \"%p\", \"stream\": \"%p\", "
+                         "\"start_us\": %.3f, \"host_us\": %.3f, \"device_us\": %.3f, "
+                         "\"args\": \"%s\"}%s\n",
+                         e.name,
+                         static_cast<const void*>(e.handle),
+                         static_cast<const void*>(e.stream),
+                         e.start_us,
+                         e.host_us,
+                         e.device_us,
+                         e.args.c_str(),
+                         (i + 1 < entries.size()) ? "," : "");
+        }
+
+        std::fprintf(file, "]\n");
+    }
+
+    //
+    // Chrome trace event format, one complete event per call and one row per stream. The
+    // duration is the device time if it could be measured and the host time otherwise.
+    //
+    void write_chrome(FILE* file, const std::vector<trace_entry>& entries)
+    {
+        std::map<hipStream_t, int> stream_ids;
+
+        std::fprintf(file, "{\"traceEvents\": [\n");
+
+        for(size_t i = 0; i < entries.size(); ++i)
+        {
+            const trace_entry& e = entries[i];
+
+            auto it = stream_ids.emplace(e.stream, static_cast<int>(stream_ids.size())).first;
+
+            std::fprintf(file,
+                         "  {\"name\": \"%s\", \"cat\": \"hipsparse\", \"ph\": \"X\", "
+                         "\"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %d, \"args\": {",
+                         e.name,
+                         e.start_us,
+                         (e.device_us >= 0.0) ? e.device_us : e.host_us,
+                         static_cast<int>(HIPSPARSE_TRACE_GETPID()),
+                         it->second);
+
+            // Split "name=value" pairs
+            size_t pos   = 0;
+            bool   first = true;
+            while(pos < e.args.size())
+            {
+                size_t end = e.args.find(' ', pos);
+                if(end == std::string::npos)
+                {
+                    end = e.args.size();
+                }
+
+                size_t eq = e.args.find('=', pos);
+                if(eq != std::string::npos && eq < end)
+                {
+                    std::fprintf(file,
+                                 "%s\"%.*s\": \"%.*s\"",
+                                 first ? "" : ", ",
+                                 static_cast<int>(eq - pos),
+                                 e.args.c_str() + pos,
+                                 static_cast<int>(end - eq - 1),
+                                 e.args.c_str() + eq + 1);
+                    first = false;
+                }
+
+                pos = end + 1;
+            }
+
+            std::fprintf(file, "}}%s\n", (i + 1 < entries.size()) ? "," : "");
+        }
+
+        std::fprintf(file, "], \"displayTimeUnit\": \"ms\"}\n");
+    }
+}
+
+hipsparse::trace_format hipsparse::get_trace_format()
+{
+    static const trace_format format = []() {
+        const char* env = std::getenv("HIPSPARSE_TRACE");
+
+        if(env == nullptr)
+        {
+            return trace_format_none;
+        }
+
+        if(std::strcmp(env, "csv") == 0)
+        {
+            return trace_format_csv;
+        }
+
+        if(std::strcmp(env, "json") == 0)
+        {
+            return trace_format_json;
+        }
+
+        if(std::strcmp(env, "chrome") == 0)
+        {
+            return trace_format_chrome;
+        }
+
+        return trace_format_none;
+    }();
+
+    return format;
+}
+
+bool hipsparse::trace_device_time_enabled()
+{
+    static const bool enabled = []() {
+        const char* env = std::getenv("HIPSPARSE_TRACE_DEVICE_TIME");
+        return env != nullptr && std::strcmp(env, "0") != 0;
+    }();
+
+    return enabled;
+}
+
+uint64_t
+    hipsparse::trace_begin(int routine, const char* name, hipsparseHandle_t handle, const char* args)
+{
+    trace_buffer& buffer = get_trace_buffer();
+
+    const uint64_t ticket = buffer.next_ticket();
+    trace_record&  record = buffer.slot(ticket);
+
+    // The slot still belongs to a call that has not returned yet or to a flush, this call is
+    // not recorded. A completed record is overwritten.
+    uint64_t         state = record.state.load(std::memory_order_relaxed);
+    const trace_slot slot  = trace_state_slot(state);
+    if((slot != trace_slot_free && slot != trace_slot_complete)
+       || !record.state.compare_exchange_strong(state,
+                                                trace_state(ticket, trace_slot_running),
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    record.ticket   = ticket;
+    record.routine  = routine;
+    record.name     = name;
+    record.handle   = handle;
+    record.stream   = nullptr;
+    rocsparse_get_stream((rocsparse_handle)handle, &record.stream);
+
+    std::strncpy(record.args, args, trace_args_size - 1);
+    record.args[trace_args_size - 1] = '\0';
+
+    record.timed = false;
+
+    if(trace_device_time_enabled())
+    {
+        // Events are created once per slot and reused by all calls that land in the slot
+        if(record.start == nullptr && hipEventCreate(&record.start) != hipSuccess)
+        {
+            record.start = nullptr;
+        }
+
+        if(record.stop == nullptr && hipEventCreate(&record.stop) != hipSuccess)
+        {
+            record.stop = nullptr;
+        }
+
+        // Work captured into a graph only runs when the graph is launched, there is nothing to
+        // time
+        hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+        const bool             capturing
+            = hipStreamIsCapturing(record.stream, &capture_status) != hipSuccess
+              || capture_status != hipStreamCaptureStatusNone;
+
+        record.timed = !capturing && record.start != nullptr && record.stop != nullptr
+                       && hipEventRecord(record.start, record.stream) == hipSuccess;
+    }
+
+    record.start_us = buffer.now_us();
+
+    return ticket;
+}
+
+void hipsparse::trace_end(uint64_t ticket)
+{
+    trace_buffer& buffer = get_trace_buffer();
+    trace_record& record = buffer.slot(ticket);
+
+    // The slot is owned by this call until it is marked complete
+    record.host_us = buffer.now_us() - record.start_us;
+
+    if(record.timed)
+    {
+        record.timed = (hipEventRecord(record.stop, record.stream) == hipSuccess);
+    }
+
+    record.state.store(trace_state(ticket, trace_slot_complete), std::memory_order_release);
+}
+
+void hipsparse::trace_flush(hipsparseHandle_t handle)
+{
+    const trace_format format = get_trace_format();
+
+    if(format == trace_format_none)
+    {
+        return;
+    }
+
+    trace_buffer& buffer = get_trace_buffer();
+
+    std::vector<trace_entry> entries;
+
+    for(uint64_t i = 1; i <= buffer.capacity(); ++i)
+    {
+        trace_record& record = buffer.slot(i);
+
+        // Take the slot over from a completed call, such that no new call overwrites it while
+        // it is read
+        uint64_t state = record.state.load(std::memory_order_relaxed);
+        if(trace_state_slot(state) != trace_slot_complete
+           || !record.state.compare_exchange_strong(
+               state,
+               trace_state(state >> trace_slot_bits, trace_slot_flushing),
+               std::memory_order_acquire,
+               std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        if(record.handle != handle)
+        {
+            record.state.store(state, std::memory_order_release);
+            continue;
+        }
+
+        const double device_us = device_time_us(record, true);
+
+        entries.push_back({record.ticket,
+                           record.name,
+                           record.handle,
+                           record.stream,
+                           record.start_us,
+                           record.host_us,
+                           device_us,
+                           std::string(record.args)});
+
+        // Release the slot
+        record.state.store(trace_state(0, trace_slot_free), std::memory_order_release);
+    }
+
+    if(entries.empty())
+    {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const trace_entry& a, const trace_entry& b) {
+        return a.ticket < b.ticket;
+    });
+
+    const char* prefix = std::getenv("HIPSPARSE_TRACE_FILE");
+    std::string filename
+        = std::string(prefix != nullptr ? prefix : "hipsparse_trace") + "_"
+          + std::to_string(HIPSPARSE_TRACE_GETPID()) + "_" + std::to_string(buffer.next_file_id())
+          + (format == trace_format_csv ? ".csv" : ".json");
+
+    FILE* file = std::fopen(filename.c_str(), "w");
+    if(file == nullptr)
+    {
+        return;
+    }
+
+    switch(format)
+    {
+    case trace_format_csv:
+        write_csv(file, entries);
+        break;
+    case trace_format_json:
+        write_json(file, entries);
+        break;
+    case trace_format_chrome:
+        write_chrome(file, entries);
+        break;
+    case trace_format_none:
+        break;
+    }
+
+    std::fclose(file);
+}
@@ -0,0 +1,262 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_TRACE_H
+#define HIPSPARSE_TRACE_H
+
+//
+// Call tracing and counting of the hipSPARSE entry points.
+//
+// Each entry point is counted in the performance counters of its handle, see
+// hipsparse_counters.h. Entry points called by other entry points are traced, but only the
+// outermost call of a thread is counted.
+//
+// Tracing is enabled by setting the environment variable HIPSPARSE_TRACE to csv, json or chrome.
+// Each traced call is stored in a process wide ring buffer together with its scalar arguments,
+// stream and host duration. Calls claim a slot of the ring buffer with an atomic compare and
+// exchange of its state, no lock is taken. The records of a handle are written to a file when
+// the handle is destroyed.
+//
+// HIPSPARSE_TRACE_FILE         prefix of the output files, default hipsparse_trace.
+// HIPSPARSE_TRACE_BUFFER_SIZE  number of records kept in the ring buffer, default 65536. Older
+//                              completed records are overwritten once the buffer is full, a
+//                              call whose slot is still owned by a running call or by a flush
+//                              is not recorded.
+// HIPSPARSE_TRACE_DEVICE_TIME  if set to a value other than 0, the device duration of each call
+//                              is measured with HIP events on the stream of the handle.
+//
+#include "hipsparse.h"
+#include "hipsparse_counters.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+namespace hipsparse
+{
+    typedef enum
+    {
+        trace_format_none   = 0,
+        trace_format_csv    = 1,
+        trace_format_json   = 2,
+        trace_format_chrome = 3
+    } trace_format;
+
+    //
+    // Maximum length of the formatted argument list of a record, including the terminator.
+    //
+    constexpr size_t trace_args_size = 192;
+
+    trace_format get_trace_format();
+    bool         trace_device_time_enabled();
+
+    inline bool trace_enabled()
+    {
+        static const bool enabled = (get_trace_format() != trace_format_none);
+        return enabled;
+    }
+
+    //
+    // Start and finish a record in the ring buffer. trace_begin returns the ticket of the record,
+    // which trace_end uses to find the slot, or 0 if the call is not recorded. The slot is owned
+    // by the call until trace_end marks the record complete.
+    //
+    uint64_t
+        trace_begin(int routine, const char* name, hipsparseHandle_t handle, const char* args);
+    void trace_end(uint64_t ticket);
+
+    //
+    // Write all records of handle to the output file and release them.
+    //
+    void trace_flush(hipsparseHandle_t handle);
+
+    template <typename T>
+    inline int trace_format_value(char* buffer, size_t size, const T& value)
+    {
+        if constexpr(std::is_enum<T>::value || std::is_integral<T>::value)
+        {
+            return std::snprintf(buffer, size, "%lld", static_cast<long long>(value));
+        }
+        else if constexpr(std::is_floating_point<T>::value)
+        {
+            return std::snprintf(buffer, size, "%g", static_cast<double>(value));
+        }
+        else
+        {
+            static_assert(std::is_pointer<T>::value, "only scalar arguments can be traced");
+            return std::snprintf(buffer, size, "%p", static_cast<const void*>(value));
+        }
+    }
+
+    inline void trace_format_args(char*, size_t, const char*) {}
+
+    //
+    // Append the arguments as "name=value" pairs separated by spaces. names is the stringified,
+    // comma separated list of argument names.
+    //
+    template <typename T, typename... Ts>
+    inline void trace_format_args(
+        char* buffer, size_t size, const char* names, const T& arg, const Ts&... args)
+    {
+        while(*names == ',' || *names == ' ')
+        {
+            ++names;
+        }
+
+        const char* end = std::strchr(names, ',');
+        if(end == nullptr)
+        {
+            end = names + std::strlen(names);
+        }
+
+        size_t used   = std::strlen(buffer);
+        int    length = std::snprintf(buffer + used,
+                                   size - used,
+                                   "%s%.*s=",
+                                   (used > 0) ? " " : "",
+                                   static_cast<int>(end - names),
+                                   names);
+
+        if(length > 0 && used + length < size)
+        {
+            used += length;
+            trace_format_value(buffer + used, size - used, arg);
+        }
+
+        trace_format_args(buffer, size, end, args...);
+    }
+
+    //
+    // Number of entry point calls of the calling thread that are in progress.
+    //
+    inline int& trace_depth()
+    {
+        static thread_local int depth = 0;
+        return depth;
+    }
+
+    //
+    // Counts and, if tracing is enabled, records the enclosing entry point call for the lifetime
+    // of the object.
+    //
+    class trace_scope
+    {
+        hipsparseHandle_t                     m_handle{};
+        handle_counters*                      m_counters{};
+        int                                   m_routine{};
+        uint64_t                              m_ticket{};
+        bool                                  m_timed{};
+        device_timing                         m_timing{};
+        std::chrono::steady_clock::time_point m_start{};
+
+    public:
+        template <typename... Ts>
+        trace_scope(int               routine,
+                    const char*       name,
+                    const char*       names,
+                    hipsparseHandle_t handle,
+                    const Ts&... args)
+            : m_handle(handle)
+            , m_routine(routine)
+        {
+            if(handle == nullptr)
+            {
+                return;
+            }
+
+            // Calls made by another entry point are part of its counts
+            if(routine >= 0 && trace_depth()++ == 0)
+            {
+                m_counters = get_counters(handle);
+
+                if(m_counters != nullptr)
+                {
+                    m_timed = device_timing_enabled()
+                              && begin_device_timing(handle, m_counters, routine, &m_timing);
+                    m_start = std::chrono::steady_clock::now();
+                }
+            }
+
+            if(trace_enabled())
+            {
+                // Skip the handle in the list of names
+                while(*names != ',' && *names != '\0')
+                {
+                    ++names;
+                }
+
+                char buffer[trace_args_size] = {};
+                trace_format_args(buffer, sizeof(buffer), names, args...);
+
+                m_ticket = trace_begin(routine, name, handle, buffer);
+            }
+        }
+
+        ~trace_scope()
+        {
+            if(m_ticket != 0)
+            {
+                trace_end(m_ticket);
+            }
+
+            if(m_counters != nullptr)
+            {
+                const auto elapsed = std::chrono::steady_clock::now() - m_start;
+
+                if(m_timed)
+                {
+                    end_device_timing(m_handle, m_counters, m_timing);
+                }
+
+                m_counters->calls[m_routine].fetch_add(1, std::memory_order_relaxed);
+                m_counters->host_ns[m_routine].fetch_add(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                    std::memory_order_relaxed);
+            }
+
+            if(m_handle != nullptr && m_routine >= 0)
+            {
+                --trace_depth();
+            }
+        }
+
+        trace_scope(const trace_scope&)            = delete;
+        trace_scope& operator=(const trace_scope&) = delete;
+    };
+}
+
+//
+// Trace and count the enclosing entry point. The first argument is the handle, followed by the
+// scalar arguments that are recorded. The routine is registered on its first call.
+//
+#define HIPSPARSE_TRACE_SCOPE(...)                                                     \
+    static const int hipsparse_trace_routine_ = hipsparse::register_routine(__func__); \
+    hipsparse::trace_scope hipsparse_trace_scope_(                                     \
+        hipsparse_trace_routine_, __func__, #__VA_ARGS__, __VA_ARGS__)
+
+#endif // HIPSPARSE_TRACE_H
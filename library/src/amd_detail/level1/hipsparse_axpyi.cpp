@@ -38,6 +38,8 @@ hipsparseStatus_t hipsparseSaxpyi(hipsparseHandle_t    handle,
                                   float*               y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_saxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -50,6 +52,8 @@ hipsparseStatus_t hipsparseDaxpyi(hipsparseHandle_t    handle,
                                   double*              y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_daxpyi(
         (rocsparse_handle)handle, nnz, alpha, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -62,6 +66,8 @@ hipsparseStatus_t hipsparseCaxpyi(hipsparseHandle_t    handle,
                                   hipComplex*          y,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_caxpyi((rocsparse_handle)handle,
                          nnz,
@@ -80,6 +86,8 @@ hipsparseStatus_t hipsparseZaxpyi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       y,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zaxpyi((rocsparse_handle)handle,
                          nnz,
@@ -38,6 +38,8 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                   hipComplex*          result,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -52,6 +54,7 @@ hipsparseStatus_t hipsparseCdotci(hipsparseHandle_t    handle,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -65,6 +68,8 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       result,
                                   hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse dotci is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -79,6 +84,7 @@ hipsparseStatus_t hipsparseZdotci(hipsparseHandle_t       handle,
                                                hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -38,6 +38,8 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                  float*               result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -52,6 +54,7 @@ hipsparseStatus_t hipsparseSdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -65,6 +68,8 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                  double*              result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -79,6 +84,7 @@ hipsparseStatus_t hipsparseDdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -92,6 +98,8 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                  hipComplex*          result,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -106,6 +114,7 @@ hipsparseStatus_t hipsparseCdoti(hipsparseHandle_t    handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -119,6 +128,8 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       result,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     // Obtain stream, to explicitly sync (cusparse doti is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -133,6 +144,7 @@ hipsparseStatus_t hipsparseZdoti(hipsparseHandle_t       handle,
                                               hipsparse::hipBaseToHCCBase(idxBase)));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
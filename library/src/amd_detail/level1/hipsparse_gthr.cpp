@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseSgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthr(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -48,6 +50,8 @@ hipsparseStatus_t hipsparseDgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthr(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -59,6 +63,8 @@ hipsparseStatus_t hipsparseCgthr(hipsparseHandle_t    handle,
                                  const int*           xInd,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthr((rocsparse_handle)handle,
                         nnz,
@@ -75,6 +81,8 @@ hipsparseStatus_t hipsparseZgthr(hipsparseHandle_t       handle,
                                  const int*              xInd,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthr((rocsparse_handle)handle,
                         nnz,
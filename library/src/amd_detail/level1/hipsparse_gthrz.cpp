@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseSgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgthrz(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -48,6 +50,8 @@ hipsparseStatus_t hipsparseDgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgthrz(
         (rocsparse_handle)handle, nnz, y, xVal, xInd, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -59,6 +63,8 @@ hipsparseStatus_t hipsparseCgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgthrz((rocsparse_handle)handle,
                          nnz,
@@ -75,6 +81,8 @@ hipsparseStatus_t hipsparseZgthrz(hipsparseHandle_t    handle,
                                   const int*           xInd,
                                   hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgthrz((rocsparse_handle)handle,
                          nnz,
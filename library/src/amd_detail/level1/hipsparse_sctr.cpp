@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseSsctr(hipsparseHandle_t    handle,
                                  float*               y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_ssctr(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -48,6 +50,8 @@ hipsparseStatus_t hipsparseDsctr(hipsparseHandle_t    handle,
                                  double*              y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsctr(
         (rocsparse_handle)handle, nnz, xVal, xInd, y, hipsparse::hipBaseToHCCBase(idxBase)));
 }
@@ -59,6 +63,8 @@ hipsparseStatus_t hipsparseCsctr(hipsparseHandle_t    handle,
                                  hipComplex*          y,
                                  hipsparseIndexBase_t idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_csctr((rocsparse_handle)handle,
                         nnz,
@@ -75,6 +81,8 @@ hipsparseStatus_t hipsparseZsctr(hipsparseHandle_t       handle,
                                  hipDoubleComplex*       y,
                                  hipsparseIndexBase_t    idxBase)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zsctr((rocsparse_handle)handle,
                         nnz,
@@ -46,6 +46,8 @@ hipsparseStatus_t hipsparseSbsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -81,6 +83,8 @@ hipsparseStatus_t hipsparseDbsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -116,6 +120,8 @@ hipsparseStatus_t hipsparseCbsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -151,6 +157,8 @@ hipsparseStatus_t hipsparseZbsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmv((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -33,6 +33,8 @@
 hipsparseStatus_t
     hipsparseXbsrsv2_zeroPivot(hipsparseHandle_t handle, bsrsv2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_bsrsv_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 }
@@ -50,6 +52,8 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -89,6 +93,8 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -128,6 +134,8 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -167,6 +175,8 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -206,6 +216,8 @@ hipsparseStatus_t hipsparseSbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -234,6 +246,8 @@ hipsparseStatus_t hipsparseDbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -262,6 +276,8 @@ hipsparseStatus_t hipsparseCbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -290,6 +306,8 @@ hipsparseStatus_t hipsparseZbsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  bsrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipDirectionToHCCDirection(dir),
@@ -319,6 +337,8 @@ hipsparseStatus_t hipsparseSbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -350,6 +370,8 @@ hipsparseStatus_t hipsparseDbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -381,6 +403,8 @@ hipsparseStatus_t hipsparseCbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -412,6 +436,8 @@ hipsparseStatus_t hipsparseZbsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dir),
@@ -446,6 +472,8 @@ hipsparseStatus_t hipsparseSbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -482,6 +510,8 @@ hipsparseStatus_t hipsparseDbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -518,6 +548,8 @@ hipsparseStatus_t hipsparseCbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -554,6 +586,8 @@ hipsparseStatus_t hipsparseZbsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, transA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dir),
@@ -49,6 +49,8 @@ hipsparseStatus_t hipsparseSbsrxmv(hipsparseHandle_t         handle,
                                    const float*              beta,
                                    float*                    y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, trans, sizeOfMask, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -89,6 +91,8 @@ hipsparseStatus_t hipsparseDbsrxmv(hipsparseHandle_t         handle,
                                    const double*             beta,
                                    double*                   y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, trans, sizeOfMask, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -129,6 +133,8 @@ hipsparseStatus_t hipsparseCbsrxmv(hipsparseHandle_t         handle,
                                    const hipComplex*         beta,
                                    hipComplex*               y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, trans, sizeOfMask, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
@@ -169,6 +175,8 @@ hipsparseStatus_t hipsparseZbsrxmv(hipsparseHandle_t         handle,
                                    const hipDoubleComplex*   beta,
                                    hipDoubleComplex*         y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dir, trans, sizeOfMask, mb, nb, nnzb, blockDim);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrxmv((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dir),
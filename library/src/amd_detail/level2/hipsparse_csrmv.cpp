@@ -44,6 +44,8 @@ hipsparseStatus_t hipsparseScsrmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -75,6 +77,8 @@ hipsparseStatus_t hipsparseDcsrmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -106,6 +110,8 @@ hipsparseStatus_t hipsparseCcsrmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -137,6 +143,8 @@ hipsparseStatus_t hipsparseZcsrmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -33,6 +33,8 @@
 hipsparseStatus_t
     hipsparseXcsrsv2_zeroPivot(hipsparseHandle_t handle, csrsv2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -42,6 +44,7 @@ hipsparseStatus_t
         (rocsparse_handle)handle, nullptr, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -58,6 +61,8 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -93,6 +98,8 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -128,6 +135,8 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -163,6 +172,8 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSize(hipsparseHandle_t         handle,
                                               csrsv2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -198,6 +209,8 @@ hipsparseStatus_t hipsparseScsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -222,6 +235,8 @@ hipsparseStatus_t hipsparseDcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -246,6 +261,8 @@ hipsparseStatus_t hipsparseCcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -270,6 +287,8 @@ hipsparseStatus_t hipsparseZcsrsv2_bufferSizeExt(hipsparseHandle_t         handl
                                                  csrsv2Info_t              info,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -295,6 +314,8 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -315,6 +336,7 @@ hipsparseStatus_t hipsparseScsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -332,6 +354,8 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -352,6 +376,7 @@ hipsparseStatus_t hipsparseDcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -369,6 +394,8 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -389,6 +416,7 @@ hipsparseStatus_t hipsparseCcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -406,6 +434,8 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     // Obtain stream, to explicitly sync (cusparse csrsv2_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -426,6 +456,7 @@ hipsparseStatus_t hipsparseZcsrsv2_analysis(hipsparseHandle_t         handle,
                                   pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -446,6 +477,8 @@ hipsparseStatus_t hipsparseScsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -478,6 +511,8 @@ hipsparseStatus_t hipsparseDcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -510,6 +545,8 @@ hipsparseStatus_t hipsparseCcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -542,6 +579,8 @@ hipsparseStatus_t hipsparseZcsrsv2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, nnz, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsv_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
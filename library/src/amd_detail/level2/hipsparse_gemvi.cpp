@@ -37,6 +37,8 @@ hipsparseStatus_t hipsparseSgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -64,6 +66,8 @@ hipsparseStatus_t hipsparseDgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -91,6 +95,8 @@ hipsparseStatus_t hipsparseCgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -118,6 +124,8 @@ hipsparseStatus_t hipsparseZgemvi_bufferSize(hipsparseHandle_t    handle,
                                              int                  nnz,
                                              int*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, nnz);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -153,6 +161,8 @@ hipsparseStatus_t hipsparseSgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, lda, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -185,6 +195,8 @@ hipsparseStatus_t hipsparseDgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, lda, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -217,6 +229,8 @@ hipsparseStatus_t hipsparseCgemvi(hipsparseHandle_t    handle,
                                   hipsparseIndexBase_t idxBase,
                                   void*                pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, lda, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -249,6 +263,8 @@ hipsparseStatus_t hipsparseZgemvi(hipsparseHandle_t       handle,
                                   hipsparseIndexBase_t    idxBase,
                                   void*                   pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, lda, nnz, idxBase);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgemvi((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -39,6 +39,8 @@ hipsparseStatus_t hipsparseShybmv(hipsparseHandle_t         handle,
                                   const float*              beta,
                                   float*                    y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_shybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -59,6 +61,8 @@ hipsparseStatus_t hipsparseDhybmv(hipsparseHandle_t         handle,
                                   const double*             beta,
                                   double*                   y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -79,6 +83,8 @@ hipsparseStatus_t hipsparseChybmv(hipsparseHandle_t         handle,
                                   const hipComplex*         beta,
                                   hipComplex*               y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_chybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -99,6 +105,8 @@ hipsparseStatus_t hipsparseZhybmv(hipsparseHandle_t         handle,
                                   const hipDoubleComplex*   beta,
                                   hipDoubleComplex*         y)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zhybmv((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
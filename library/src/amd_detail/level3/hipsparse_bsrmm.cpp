@@ -50,6 +50,8 @@ hipsparseStatus_t hipsparseSbsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transB, mb, n, kb, nnzb, blockDim, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -92,6 +94,8 @@ hipsparseStatus_t hipsparseDbsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transB, mb, n, kb, nnzb, blockDim, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -134,6 +138,8 @@ hipsparseStatus_t hipsparseCbsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transB, mb, n, kb, nnzb, blockDim, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -176,6 +182,8 @@ hipsparseStatus_t hipsparseZbsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transB, mb, n, kb, nnzb, blockDim, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrmm((rocsparse_handle)handle,
                          hipsparse::hipDirectionToHCCDirection(dirA),
@@ -33,6 +33,8 @@
 hipsparseStatus_t
     hipsparseXbsrsm2_zeroPivot(hipsparseHandle_t handle, bsrsm2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Obtain stream, to explicitly sync (cusparse bsrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -42,6 +44,7 @@ hipsparseStatus_t
         rocsparse_bsrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -62,6 +65,8 @@ hipsparseStatus_t hipsparseSbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -105,6 +110,8 @@ hipsparseStatus_t hipsparseDbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -148,6 +155,8 @@ hipsparseStatus_t hipsparseCbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -191,6 +200,8 @@ hipsparseStatus_t hipsparseZbsrsm2_bufferSize(hipsparseHandle_t         handle,
                                               bsrsm2Info_t              info,
                                               int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -235,6 +246,8 @@ hipsparseStatus_t hipsparseSbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -270,6 +283,8 @@ hipsparseStatus_t hipsparseDbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -305,6 +320,8 @@ hipsparseStatus_t hipsparseCbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -340,6 +357,8 @@ hipsparseStatus_t hipsparseZbsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipDirectionToHCCDirection(dirA),
@@ -380,6 +399,8 @@ hipsparseStatus_t hipsparseSbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, ldb, ldx, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -424,6 +445,8 @@ hipsparseStatus_t hipsparseDbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, ldb, ldx, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -468,6 +491,8 @@ hipsparseStatus_t hipsparseCbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, ldb, ldx, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
@@ -512,6 +537,8 @@ hipsparseStatus_t hipsparseZbsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, transA, transX, mb, nrhs, nnzb, blockDim, ldb, ldx, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipDirectionToHCCDirection(dirA),
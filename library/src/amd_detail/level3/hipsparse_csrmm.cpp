@@ -47,6 +47,8 @@ hipsparseStatus_t hipsparseScsrmm(hipsparseHandle_t         handle,
                                   float*                    C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -84,6 +86,8 @@ hipsparseStatus_t hipsparseDcsrmm(hipsparseHandle_t         handle,
                                   double*                   C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -121,6 +125,8 @@ hipsparseStatus_t hipsparseCcsrmm(hipsparseHandle_t         handle,
                                   hipComplex*               C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -158,6 +164,8 @@ hipsparseStatus_t hipsparseZcsrmm(hipsparseHandle_t         handle,
                                   hipDoubleComplex*         C,
                                   int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -196,6 +204,8 @@ hipsparseStatus_t hipsparseScsrmm2(hipsparseHandle_t         handle,
                                    float*                    C,
                                    int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -234,6 +244,8 @@ hipsparseStatus_t hipsparseDcsrmm2(hipsparseHandle_t         handle,
                                    double*                   C,
                                    int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -272,6 +284,8 @@ hipsparseStatus_t hipsparseCcsrmm2(hipsparseHandle_t         handle,
                                    hipComplex*               C,
                                    int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -310,6 +324,8 @@ hipsparseStatus_t hipsparseZcsrmm2(hipsparseHandle_t         handle,
                                    hipDoubleComplex*         C,
                                    int                       ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, transA, transB, m, n, k, nnz, ldb, ldc);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrmm((rocsparse_handle)handle,
                          hipsparse::hipOperationToHCCOperation(transA),
@@ -33,6 +33,8 @@
 hipsparseStatus_t
     hipsparseXcsrsm2_zeroPivot(hipsparseHandle_t handle, csrsm2Info_t info, int* position)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Obtain stream, to explicitly sync (cusparse csrsm2_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -42,6 +44,7 @@ hipsparseStatus_t
         rocsparse_csrsm_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -65,6 +68,8 @@ hipsparseStatus_t hipsparseScsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -102,6 +107,8 @@ hipsparseStatus_t hipsparseDcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -139,6 +146,8 @@ hipsparseStatus_t hipsparseCcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -176,6 +185,8 @@ hipsparseStatus_t hipsparseZcsrsm2_bufferSizeExt(hipsparseHandle_t         handl
                                                  hipsparseSolvePolicy_t    policy,
                                                  size_t*                   pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_buffer_size((rocsparse_handle)handle,
                                      hipsparse::hipOperationToHCCOperation(transA),
@@ -213,6 +224,8 @@ hipsparseStatus_t hipsparseScsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -251,6 +264,8 @@ hipsparseStatus_t hipsparseDcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -289,6 +304,8 @@ hipsparseStatus_t hipsparseCcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -327,6 +344,8 @@ hipsparseStatus_t hipsparseZcsrsm2_analysis(hipsparseHandle_t         handle,
                                             hipsparseSolvePolicy_t    policy,
                                             void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_analysis((rocsparse_handle)handle,
                                   hipsparse::hipOperationToHCCOperation(transA),
@@ -365,6 +384,8 @@ hipsparseStatus_t hipsparseScsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -402,6 +423,8 @@ hipsparseStatus_t hipsparseDcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -439,6 +462,8 @@ hipsparseStatus_t hipsparseCcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
@@ -476,6 +501,8 @@ hipsparseStatus_t hipsparseZcsrsm2_solve(hipsparseHandle_t         handle,
                                          hipsparseSolvePolicy_t    policy,
                                          void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, transA, transB, m, nrhs, nnz, ldb, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrsm_solve((rocsparse_handle)handle,
                                hipsparse::hipOperationToHCCOperation(transA),
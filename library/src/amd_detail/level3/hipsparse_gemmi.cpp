@@ -45,6 +45,8 @@ hipsparseStatus_t hipsparseSgemmi(hipsparseHandle_t handle,
                                   float*            C,
                                   int               ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnz, lda, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -93,6 +95,8 @@ hipsparseStatus_t hipsparseDgemmi(hipsparseHandle_t handle,
                                   double*           C,
                                   int               ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnz, lda, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status
@@ -141,6 +145,8 @@ hipsparseStatus_t hipsparseCgemmi(hipsparseHandle_t handle,
                                   hipComplex*       C,
                                   int               ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnz, lda, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -189,6 +195,8 @@ hipsparseStatus_t hipsparseZgemmi(hipsparseHandle_t       handle,
                                   hipDoubleComplex*       C,
                                   int                     ldc)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, k, nnz, lda, ldc);
+
     rocsparse_mat_descr descr;
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&descr));
     hipsparseStatus_t status = hipsparse::rocSPARSEStatusToHIPStatus(
@@ -0,0 +1,775 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    hipsparseStatus_t bsrdiag_gather(hipsparseHandle_t handle,
+                                     int               nnz,
+                                     const float*      y,
+                                     float*            x,
+                                     const int*        ind)
+    {
+        return hipsparseSgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_gather(hipsparseHandle_t handle,
+                                     int               nnz,
+                                     const double*     y,
+                                     double*           x,
+                                     const int*        ind)
+    {
+        return hipsparseDgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_gather(hipsparseHandle_t handle,
+                                     int               nnz,
+                                     const hipComplex* y,
+                                     hipComplex*       x,
+                                     const int*        ind)
+    {
+        return hipsparseCgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_gather(hipsparseHandle_t       handle,
+                                     int                     nnz,
+                                     const hipDoubleComplex* y,
+                                     hipDoubleComplex*       x,
+                                     const int*              ind)
+    {
+        return hipsparseZgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_scatter(hipsparseHandle_t handle,
+                                      int               nnz,
+                                      const float*      x,
+                                      const int*        ind,
+                                      float*            y)
+    {
+        return hipsparseSsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_scatter(hipsparseHandle_t handle,
+                                      int               nnz,
+                                      const double*     x,
+                                      const int*        ind,
+                                      double*           y)
+    {
+        return hipsparseDsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_scatter(hipsparseHandle_t handle,
+                                      int               nnz,
+                                      const hipComplex* x,
+                                      const int*        ind,
+                                      hipComplex*       y)
+    {
+        return hipsparseCsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_scatter(hipsparseHandle_t       handle,
+                                      int                     nnz,
+                                      const hipDoubleComplex* x,
+                                      const int*              ind,
+                                      hipDoubleComplex*       y)
+    {
+        return hipsparseZsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t bsrdiag_bsrmv(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dir,
+                                    int                       mb,
+                                    const float*              alpha,
+                                    const hipsparseMatDescr_t descr,
+                                    const float*              val,
+                                    const int*                ind,
+                                    int                       block_dim,
+                                    const float*              x,
+                                    const float*              beta,
+                                    float*                    y)
+    {
+        // The block diagonal pattern has row pointers and column indices 0, 1, ..., mb
+        return hipsparseSbsrmv(handle,
+                               dir,
+                               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                               mb,
+                               mb,
+                               mb,
+                               alpha,
+                               descr,
+                               val,
+                               ind,
+                               ind,
+                               block_dim,
+                               x,
+                               beta,
+                               y);
+    }
+
+    hipsparseStatus_t bsrdiag_bsrmv(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dir,
+                                    int                       mb,
+                                    const double*             alpha,
+                                    const hipsparseMatDescr_t descr,
+                                    const double*             val,
+                                    const int*                ind,
+                                    int                       block_dim,
+                                    const double*             x,
+                                    const double*             beta,
+                                    double*                   y)
+    {
+        // The block diagonal pattern has row pointers and column indices 0, 1, ..., mb
+        return hipsparseDbsrmv(handle,
+                               dir,
+                               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                               mb,
+                               mb,
+                               mb,
+                               alpha,
+                               descr,
+                               val,
+                               ind,
+                               ind,
+                               block_dim,
+                               x,
+                               beta,
+                               y);
+    }
+
+    hipsparseStatus_t bsrdiag_bsrmv(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dir,
+                                    int                       mb,
+                                    const hipComplex*         alpha,
+                                    const hipsparseMatDescr_t descr,
+                                    const hipComplex*         val,
+                                    const int*                ind,
+                                    int                       block_dim,
+                                    const hipComplex*         x,
+                                    const hipComplex*         beta,
+                                    hipComplex*               y)
+    {
+        // The block diagonal pattern has row pointers and column indices 0, 1, ..., mb
+        return hipsparseCbsrmv(handle,
+                               dir,
+                               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                               mb,
+                               mb,
+                               mb,
+                               alpha,
+                               descr,
+                               val,
+                               ind,
+                               ind,
+                               block_dim,
+                               x,
+                               beta,
+                               y);
+    }
+
+    hipsparseStatus_t bsrdiag_bsrmv(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dir,
+                                    int                       mb,
+                                    const hipDoubleComplex*   alpha,
+                                    const hipsparseMatDescr_t descr,
+                                    const hipDoubleComplex*   val,
+                                    const int*                ind,
+                                    int                       block_dim,
+                                    const hipDoubleComplex*   x,
+                                    const hipDoubleComplex*   beta,
+                                    hipDoubleComplex*         y)
+    {
+        // The block diagonal pattern has row pointers and column indices 0, 1, ..., mb
+        return hipsparseZbsrmv(handle,
+                               dir,
+                               HIPSPARSE_OPERATION_NON_TRANSPOSE,
+                               mb,
+                               mb,
+                               mb,
+                               alpha,
+                               descr,
+                               val,
+                               ind,
+                               ind,
+                               block_dim,
+                               x,
+                               beta,
+                               y);
+    }
+
+    //
+    // Invert the dense n x n block a in place by Gauss-Jordan elimination with partial
+    // pivoting. Returns false and leaves a unchanged if the block is singular.
+    //
+    template <typename C>
+    bool bsrdiag_invert(int n, C* a)
+    {
+        // Augmented matrix [a | I], stored by rows
+        std::vector<C> w(2 * n * n, C(0));
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                w[2 * n * i + j] = a[n * i + j];
+            }
+
+            w[2 * n * i + n + i] = C(1);
+        }
+
+        for(int k = 0; k < n; ++k)
+        {
+            int    pivot     = k;
+            double pivot_abs = std::abs(w[2 * n * k + k]);
+            for(int i = k + 1; i < n; ++i)
+            {
+                const double v = std::abs(w[2 * n * i + k]);
+                if(v > pivot_abs)
+                {
+                    pivot     = i;
+                    pivot_abs = v;
+                }
+            }
+
+            if(pivot_abs == 0.0)
+            {
+                return false;
+            }
+
+            if(pivot != k)
+            {
+                for(int j = 0; j < 2 * n; ++j)
+                {
+                    std::swap(w[2 * n * k + j], w[2 * n * pivot + j]);
+                }
+            }
+
+            const C inv = C(1) / w[2 * n * k + k];
+            for(int j = 0; j < 2 * n; ++j)
+            {
+                w[2 * n * k + j] *= inv;
+            }
+
+            for(int i = 0; i < n; ++i)
+            {
+                const C f = w[2 * n * i + k];
+                if(i == k || f == C(0))
+                {
+                    continue;
+                }
+
+                for(int j = 0; j < 2 * n; ++j)
+                {
+                    w[2 * n * i + j] -= f * w[2 * n * k + j];
+                }
+            }
+        }
+
+        for(int i = 0; i < n; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                a[n * i + j] = w[2 * n * i + n + j];
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    hipsparseStatus_t bsrdiag_template(hipsparseHandle_t         handle,
+                                       hipsparseDirection_t      dirA,
+                                       int                       mb,
+                                       int                       nnzb,
+                                       const hipsparseMatDescr_t descrA,
+                                       const T*                  bsrValA,
+                                       const int*                bsrRowPtrA,
+                                       const int*                bsrColIndA,
+                                       int                       blockDim,
+                                       T*                        blockDiag)
+    {
+        if(handle == nullptr || descrA == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(dirA != HIPSPARSE_DIRECTION_ROW && dirA != HIPSPARSE_DIRECTION_COLUMN)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(mb < 0 || nnzb < 0 || blockDim < 1)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(mb == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(bsrRowPtrA == nullptr || blockDiag == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnzb > 0 && (bsrValA == nullptr || bsrColIndA == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int     base       = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE);
+        const int64_t block_size = static_cast<int64_t>(blockDim) * blockDim;
+
+        // The values are gathered with 32 bit indices into bsrValA and blockDiag
+        if(block_size * std::max(nnzb, mb) > std::numeric_limits<int>::max())
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        std::vector<int> hrow_ptr(mb + 1);
+        std::vector<int> hcol_ind(nnzb);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hrow_ptr.data(), bsrRowPtrA, sizeof(int) * (mb + 1), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hcol_ind.data(), bsrColIndA, sizeof(int) * nnzb, hipMemcpyDeviceToHost, stream));
+
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(hrow_ptr[0] != base || hrow_ptr[mb] - base != nnzb)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Positions of the diagonal block entries in bsrValA and in blockDiag
+        std::vector<int> hsrc;
+        std::vector<int> hdst;
+        for(int i = 0; i < mb; ++i)
+        {
+            for(int k = hrow_ptr[i] - base; k < hrow_ptr[i + 1] - base; ++k)
+            {
+                const int j = hcol_ind[k] - base;
+                if(j < 0 || j >= mb)
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                if(j == i)
+                {
+                    const int64_t first_src = block_size * k;
+                    const int64_t first_dst = block_size * i;
+
+                    for(int64_t e = 0; e < block_size; ++e)
+                    {
+                        hsrc.push_back(static_cast<int>(first_src + e));
+                        hdst.push_back(static_cast<int>(first_dst + e));
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        const int nnz      = static_cast<int>(hsrc.size());
+        const int complete = (nnz == block_size * mb);
+
+        // Block rows without diagonal block yield zero blocks
+        if(!complete)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(blockDiag, 0, sizeof(T) * block_size * mb, stream));
+        }
+
+        if(nnz == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // If every block row has a diagonal block, the blocks are gathered in place. Otherwise,
+        // the present blocks are gathered into a temporary array and scattered into blockDiag.
+        const size_t ind_size = sizeof(int) * nnz * (complete ? 1 : 2);
+        const size_t val_size = complete ? 0 : sizeof(T) * nnz;
+
+        char* buffer = nullptr;
+        hipsparse::count_workspace(handle, ind_size + val_size);
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&buffer, ind_size + val_size));
+
+        int* src = reinterpret_cast<int*>(buffer);
+        int* dst = src + nnz;
+        T*   tmp = reinterpret_cast<T*>(buffer + ind_size);
+
+        hipsparseStatus_t status = hipsparse::hipErrorToHIPSPARSEStatus(
+            hipMemcpyAsync(src, hsrc.data(), sizeof(int) * nnz, hipMemcpyHostToDevice, stream));
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            if(complete)
+            {
+                status = bsrdiag_gather(handle, nnz, bsrValA, blockDiag, src);
+            }
+            else
+            {
+                status = hipsparse::hipErrorToHIPSPARSEStatus(hipMemcpyAsync(
+                    dst, hdst.data(), sizeof(int) * nnz, hipMemcpyHostToDevice, stream));
+
+                if(status == HIPSPARSE_STATUS_SUCCESS)
+                {
+                    status = bsrdiag_gather(handle, nnz, bsrValA, tmp, src);
+                }
+
+                if(status == HIPSPARSE_STATUS_SUCCESS)
+                {
+                    status = bsrdiag_scatter(handle, nnz, tmp, dst, blockDiag);
+                }
+            }
+        }
+
+        // The host positions have to outlive the copies, the buffer is released after the
+        // gather and scatter
+        hipsparse::count_synchronization(handle);
+        const hipError_t sync_error = hipStreamSynchronize(stream);
+
+        RETURN_IF_HIP_ERROR(hipFree(buffer));
+        RETURN_IF_HIP_ERROR(sync_error);
+
+        return status;
+    }
+
+    template <typename T, typename C>
+    hipsparseStatus_t bsrdiaginv_template(
+        hipsparseHandle_t handle, int mb, int blockDim, T* blockDiag, int* position)
+    {
+        if(handle == nullptr || mb < 0 || blockDim < 1 || position == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        *position = -1;
+
+        if(mb == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(blockDiag == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int64_t block_size = static_cast<int64_t>(blockDim) * blockDim;
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        std::vector<C> hblocks(block_size * mb);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hblocks.data(),
+                                           blockDiag,
+                                           sizeof(T) * block_size * mb,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // The blocks are inverted one after another on the host, rocSPARSE has no batched
+        // dense inversion. The inverse of the transposed block is the transposed inverse, such
+        // that the blocks can be inverted as row major blocks regardless of their storage layout.
+        for(int i = 0; i < mb; ++i)
+        {
+            if(!bsrdiag_invert(blockDim, hblocks.data() + block_size * i) && *position == -1)
+            {
+                *position = i;
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(blockDiag,
+                                           hblocks.data(),
+                                           sizeof(T) * block_size * mb,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return (*position == -1) ? HIPSPARSE_STATUS_SUCCESS : HIPSPARSE_STATUS_ZERO_PIVOT;
+    }
+
+    template <typename T>
+    hipsparseStatus_t bsrdiagmv_template(hipsparseHandle_t    handle,
+                                         hipsparseDirection_t dirA,
+                                         int                  mb,
+                                         int                  blockDim,
+                                         const T*             alpha,
+                                         const T*             blockDiag,
+                                         const T*             x,
+                                         const T*             beta,
+                                         T*                   y,
+                                         void*                pBuffer)
+    {
+        if(handle == nullptr || mb < 0 || blockDim < 1 || alpha == nullptr || beta == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(mb == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(blockDiag == nullptr || x == nullptr || y == nullptr || pBuffer == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        int* ind = reinterpret_cast<int*>(pBuffer);
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateIdentityPermutation(handle, mb + 1, ind));
+
+        hipsparseMatDescr_t descr;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&descr));
+
+        const hipsparseStatus_t status
+            = bsrdiag_bsrmv(handle, dirA, mb, alpha, descr, blockDiag, ind, blockDim, x, beta, y);
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyMatDescr(descr));
+
+        return status;
+    }
+}
+
+hipsparseStatus_t hipsparseSbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const float*              bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    float*                    blockDiag)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
+    return bsrdiag_template(
+        handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+}
+
+hipsparseStatus_t hipsparseDbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const double*             bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    double*                   blockDiag)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
+    return bsrdiag_template(
+        handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+}
+
+hipsparseStatus_t hipsparseCbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipComplex*         bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    hipComplex*               blockDiag)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
+    return bsrdiag_template(
+        handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+}
+
+hipsparseStatus_t hipsparseZbsrdiag(hipsparseHandle_t         handle,
+                                    hipsparseDirection_t      dirA,
+                                    int                       mb,
+                                    int                       nnzb,
+                                    const hipsparseMatDescr_t descrA,
+                                    const hipDoubleComplex*   bsrValA,
+                                    const int*                bsrRowPtrA,
+                                    const int*                bsrColIndA,
+                                    int                       blockDim,
+                                    hipDoubleComplex*         blockDiag)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
+    return bsrdiag_template(
+        handle, dirA, mb, nnzb, descrA, bsrValA, bsrRowPtrA, bsrColIndA, blockDim, blockDiag);
+}
+
+hipsparseStatus_t hipsparseSbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       float*            blockDiag,
+                                       int*              position)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, mb, blockDim);
+
+    return bsrdiaginv_template<float, float>(handle, mb, blockDim, blockDiag, position);
+}
+
+hipsparseStatus_t hipsparseDbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       double*           blockDiag,
+                                       int*              position)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, mb, blockDim);
+
+    return bsrdiaginv_template<double, double>(handle, mb, blockDim, blockDiag, position);
+}
+
+hipsparseStatus_t hipsparseCbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       hipComplex*       blockDiag,
+                                       int*              position)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, mb, blockDim);
+
+    return bsrdiaginv_template<hipComplex, std::complex<float>>(
+        handle, mb, blockDim, blockDiag, position);
+}
+
+hipsparseStatus_t hipsparseZbsrdiaginv(hipsparseHandle_t handle,
+                                       int               mb,
+                                       int               blockDim,
+                                       hipDoubleComplex* blockDiag,
+                                       int*              position)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, mb, blockDim);
+
+    return bsrdiaginv_template<hipDoubleComplex, std::complex<double>>(
+        handle, mb, blockDim, blockDiag, position);
+}
+
+hipsparseStatus_t hipsparseXbsrdiagmv_bufferSize(hipsparseHandle_t handle,
+                                                 int               mb,
+                                                 size_t*           pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, mb);
+
+    if(handle == nullptr || mb < 0 || pBufferSizeInBytes == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // Row pointers and column indices of the block diagonal pattern
+    *pBufferSizeInBytes = sizeof(int) * (mb + 1);
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSbsrdiagmv(hipsparseHandle_t    handle,
+                                      hipsparseDirection_t dirA,
+                                      int                  mb,
+                                      int                  blockDim,
+                                      const float*         alpha,
+                                      const float*         blockDiag,
+                                      const float*         x,
+                                      const float*         beta,
+                                      float*               y,
+                                      void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, blockDim);
+
+    return bsrdiagmv_template(handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+}
+
+hipsparseStatus_t hipsparseDbsrdiagmv(hipsparseHandle_t    handle,
+                                      hipsparseDirection_t dirA,
+                                      int                  mb,
+                                      int                  blockDim,
+                                      const double*        alpha,
+                                      const double*        blockDiag,
+                                      const double*        x,
+                                      const double*        beta,
+                                      double*              y,
+                                      void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, blockDim);
+
+    return bsrdiagmv_template(handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+}
+
+hipsparseStatus_t hipsparseCbsrdiagmv(hipsparseHandle_t    handle,
+                                      hipsparseDirection_t dirA,
+                                      int                  mb,
+                                      int                  blockDim,
+                                      const hipComplex*    alpha,
+                                      const hipComplex*    blockDiag,
+                                      const hipComplex*    x,
+                                      const hipComplex*    beta,
+                                      hipComplex*          y,
+                                      void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, blockDim);
+
+    return bsrdiagmv_template(handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+}
+
+hipsparseStatus_t hipsparseZbsrdiagmv(hipsparseHandle_t       handle,
+                                      hipsparseDirection_t    dirA,
+                                      int                     mb,
+                                      int                     blockDim,
+                                      const hipDoubleComplex* alpha,
+                                      const hipDoubleComplex* blockDiag,
+                                      const hipDoubleComplex* x,
+                                      const hipDoubleComplex* beta,
+                                      hipDoubleComplex*       y,
+                                      void*                   pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, blockDim);
+
+    return bsrdiagmv_template(handle, dirA, mb, blockDim, alpha, blockDiag, x, beta, y, pBuffer);
+}
@@ -33,6 +33,8 @@
 hipsparseStatus_t
     hipsparseXbsric02_zeroPivot(hipsparseHandle_t handle, bsric02Info_t info, int* position)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -42,6 +44,7 @@ hipsparseStatus_t
         rocsparse_bsric0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -59,6 +62,8 @@ hipsparseStatus_t hipsparseSbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -96,6 +101,8 @@ hipsparseStatus_t hipsparseDbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -133,6 +140,8 @@ hipsparseStatus_t hipsparseCbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -170,6 +179,8 @@ hipsparseStatus_t hipsparseZbsric02_bufferSize(hipsparseHandle_t         handle,
                                                bsric02Info_t             info,
                                                int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -208,6 +219,8 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -229,6 +242,7 @@ hipsparseStatus_t hipsparseSbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -247,6 +261,8 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -268,6 +284,7 @@ hipsparseStatus_t hipsparseDbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -286,6 +303,8 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -307,6 +326,7 @@ hipsparseStatus_t hipsparseCbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -325,6 +345,8 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                              hipsparseSolvePolicy_t    policy,
                                              void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsric02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -346,6 +368,7 @@ hipsparseStatus_t hipsparseZbsric02_analysis(hipsparseHandle_t         handle,
                                    pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -364,6 +387,8 @@ hipsparseStatus_t hipsparseSbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -392,6 +417,8 @@ hipsparseStatus_t hipsparseDbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -420,6 +447,8 @@ hipsparseStatus_t hipsparseCbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -448,6 +477,8 @@ hipsparseStatus_t hipsparseZbsric02(hipsparseHandle_t         handle,
                                     hipsparseSolvePolicy_t    policy,
                                     void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsric0((rocsparse_handle)handle,
                           hipsparse::hipDirectionToHCCDirection(dirA),
@@ -33,6 +33,8 @@
 hipsparseStatus_t
     hipsparseXbsrilu02_zeroPivot(hipsparseHandle_t handle, bsrilu02Info_t info, int* position)
 {
+    HIPSPARSE_TRACE_SCOPE(handle);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_zeropivot is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -42,6 +44,7 @@ hipsparseStatus_t
         rocsparse_bsrilu0_zero_pivot((rocsparse_handle)handle, (rocsparse_mat_info)info, position));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -50,6 +53,8 @@ hipsparseStatus_t
 hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, float* boost_val)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, enable_boost);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dsbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -57,6 +62,8 @@ hipsparseStatus_t hipsparseSbsrilu02_numericBoost(
 hipsparseStatus_t hipsparseDbsrilu02_numericBoost(
     hipsparseHandle_t handle, bsrilu02Info_t info, int enable_boost, double* tol, double* boost_val)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, enable_boost);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dbsrilu0_numeric_boost(
         (rocsparse_handle)handle, (rocsparse_mat_info)info, enable_boost, tol, boost_val));
 }
@@ -67,6 +74,8 @@ hipsparseStatus_t hipsparseCbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipComplex*       boost_val)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, enable_boost);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcbsrilu0_numeric_boost((rocsparse_handle)handle,
                                           (rocsparse_mat_info)info,
@@ -81,6 +90,8 @@ hipsparseStatus_t hipsparseZbsrilu02_numericBoost(hipsparseHandle_t handle,
                                                   double*           tol,
                                                   hipDoubleComplex* boost_val)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, enable_boost);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0_numeric_boost((rocsparse_handle)handle,
                                          (rocsparse_mat_info)info,
@@ -101,6 +112,8 @@ hipsparseStatus_t hipsparseSbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -138,6 +151,8 @@ hipsparseStatus_t hipsparseDbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -175,6 +190,8 @@ hipsparseStatus_t hipsparseCbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -212,6 +229,8 @@ hipsparseStatus_t hipsparseZbsrilu02_bufferSize(hipsparseHandle_t         handle
                                                 bsrilu02Info_t            info,
                                                 int*                      pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim);
+
     if(pBufferSizeInBytes == nullptr)
     {
         return HIPSPARSE_STATUS_INVALID_VALUE;
@@ -250,6 +269,8 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -271,6 +292,7 @@ hipsparseStatus_t hipsparseSbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -289,6 +311,8 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -310,6 +334,7 @@ hipsparseStatus_t hipsparseDbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -328,6 +353,8 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -349,6 +376,7 @@ hipsparseStatus_t hipsparseCbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -367,6 +395,8 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                               hipsparseSolvePolicy_t    policy,
                                               void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     // Obtain stream, to explicitly sync (cusparse bsrilu02_analysis is blocking)
     hipStream_t stream;
     RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
@@ -388,6 +418,7 @@ hipsparseStatus_t hipsparseZbsrilu02_analysis(hipsparseHandle_t         handle,
                                     pBuffer));
 
     // Synchronize stream
+    hipsparse::count_synchronization(handle);
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     return HIPSPARSE_STATUS_SUCCESS;
@@ -406,6 +437,8 @@ hipsparseStatus_t hipsparseSbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -434,6 +467,8 @@ hipsparseStatus_t hipsparseDbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -462,6 +497,8 @@ hipsparseStatus_t hipsparseCbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
@@ -490,6 +527,8 @@ hipsparseStatus_t hipsparseZbsrilu02(hipsparseHandle_t         handle,
                                      hipsparseSolvePolicy_t    policy,
                                      void*                     pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, dirA, mb, nnzb, blockDim, policy);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zbsrilu0((rocsparse_handle)handle,
                            hipsparse::hipDirectionToHCCDirection(dirA),
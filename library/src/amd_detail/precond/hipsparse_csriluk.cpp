@@ -0,0 +1,762 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+#include "hipsparse_ilu.h"
+
+#include <vector>
+
+hipsparseStatus_t hipsparseCreateIluInfo(hipsparseIluInfo_t* info)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *info = new hipsparseIluInfo;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyIluInfo(hipsparseIluInfo_t info)
+{
+    if(info != nullptr)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::ilu_info_clear(info));
+
+        delete info;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace hipsparse
+{
+    hipsparseStatus_t ilu_info_clear(hipsparseIluInfo* info)
+    {
+        for(int** ptr : {&info->fill_row_ptr,
+                         &info->fill_col_ind,
+                         &info->map_A,
+                         &info->map_L,
+                         &info->map_U,
+                         &info->col_ind_L,
+                         &info->col_ind_U})
+        {
+            if(*ptr != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(*ptr));
+                *ptr = nullptr;
+            }
+        }
+
+        for(void** ptr : {&info->fill_val, &info->buffer})
+        {
+            if(*ptr != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(*ptr));
+                *ptr = nullptr;
+            }
+        }
+
+        if(info->fill_descr != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyMatDescr(info->fill_descr));
+            info->fill_descr = nullptr;
+        }
+
+        if(info->fill_info != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseDestroyCsrilu02Info(info->fill_info));
+            info->fill_info = nullptr;
+        }
+
+        info->m             = 0;
+        info->nnz_A         = 0;
+        info->nnz_L         = 0;
+        info->nnz_U         = 0;
+        info->iluk          = false;
+        info->nnz_fill      = 0;
+        info->fill_val_size = 0;
+        info->buffer_size   = 0;
+        info->analysed      = false;
+        info->ilut          = false;
+
+        info->ilut_col_ind_L.clear();
+        info->ilut_col_ind_U.clear();
+        info->ilut_val_L.clear();
+        info->ilut_val_U.clear();
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+namespace
+{
+    hipsparseStatus_t iluk_upload(hipsparseHandle_t       handle,
+                                  hipStream_t             stream,
+                                  const std::vector<int>& src,
+                                  int**                   dst)
+    {
+        if(src.empty())
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        hipsparse::count_workspace(handle, sizeof(int) * src.size());
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)dst, sizeof(int) * src.size()));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            *dst, src.data(), sizeof(int) * src.size(), hipMemcpyHostToDevice, stream));
+
+        return hipsparse::synchronize_stream(handle, stream);
+    }
+
+    hipsparseStatus_t iluk_scatter(
+        hipsparseHandle_t handle, int nnz, const float* x, const int* ind, float* y)
+    {
+        return hipsparseSsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_scatter(
+        hipsparseHandle_t handle, int nnz, const double* x, const int* ind, double* y)
+    {
+        return hipsparseDsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_scatter(
+        hipsparseHandle_t handle, int nnz, const hipComplex* x, const int* ind, hipComplex* y)
+    {
+        return hipsparseCsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_scatter(hipsparseHandle_t       handle,
+                                   int                     nnz,
+                                   const hipDoubleComplex* x,
+                                   const int*              ind,
+                                   hipDoubleComplex*       y)
+    {
+        return hipsparseZsctr(handle, nnz, x, ind, y, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_gather(
+        hipsparseHandle_t handle, int nnz, const float* y, float* x, const int* ind)
+    {
+        return hipsparseSgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_gather(
+        hipsparseHandle_t handle, int nnz, const double* y, double* x, const int* ind)
+    {
+        return hipsparseDgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_gather(
+        hipsparseHandle_t handle, int nnz, const hipComplex* y, hipComplex* x, const int* ind)
+    {
+        return hipsparseCgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_gather(hipsparseHandle_t       handle,
+                                  int                     nnz,
+                                  const hipDoubleComplex* y,
+                                  hipDoubleComplex*       x,
+                                  const int*              ind)
+    {
+        return hipsparseZgthr(handle, nnz, y, x, ind, HIPSPARSE_INDEX_BASE_ZERO);
+    }
+
+    hipsparseStatus_t iluk_buffer_size(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descr,
+                                       float*                    val,
+                                       const int*                row_ptr,
+                                       const int*                col_ind,
+                                       csrilu02Info_t            info,
+                                       size_t*                   buffer_size)
+    {
+        return hipsparseScsrilu02_bufferSizeExt(
+            handle, m, nnz, descr, val, row_ptr, col_ind, info, buffer_size);
+    }
+
+    hipsparseStatus_t iluk_buffer_size(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descr,
+                                       double*                   val,
+                                       const int*                row_ptr,
+                                       const int*                col_ind,
+                                       csrilu02Info_t            info,
+                                       size_t*                   buffer_size)
+    {
+        return hipsparseDcsrilu02_bufferSizeExt(
+            handle, m, nnz, descr, val, row_ptr, col_ind, info, buffer_size);
+    }
+
+    hipsparseStatus_t iluk_buffer_size(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descr,
+                                       hipComplex*               val,
+                                       const int*                row_ptr,
+                                       const int*                col_ind,
+                                       csrilu02Info_t            info,
+                                       size_t*                   buffer_size)
+    {
+        return hipsparseCcsrilu02_bufferSizeExt(
+            handle, m, nnz, descr, val, row_ptr, col_ind, info, buffer_size);
+    }
+
+    hipsparseStatus_t iluk_buffer_size(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descr,
+                                       hipDoubleComplex*         val,
+                                       const int*                row_ptr,
+                                       const int*                col_ind,
+                                       csrilu02Info_t            info,
+                                       size_t*                   buffer_size)
+    {
+        return hipsparseZcsrilu02_bufferSizeExt(
+            handle, m, nnz, descr, val, row_ptr, col_ind, info, buffer_size);
+    }
+
+    hipsparseStatus_t iluk_analysis(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descr,
+                                    const float*              val,
+                                    const int*                row_ptr,
+                                    const int*                col_ind,
+                                    csrilu02Info_t            info,
+                                    void*                     buffer)
+    {
+        return hipsparseScsrilu02_analysis(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           val,
+                                           row_ptr,
+                                           col_ind,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    }
+
+    hipsparseStatus_t iluk_analysis(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descr,
+                                    const double*             val,
+                                    const int*                row_ptr,
+                                    const int*                col_ind,
+                                    csrilu02Info_t            info,
+                                    void*                     buffer)
+    {
+        return hipsparseDcsrilu02_analysis(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           val,
+                                           row_ptr,
+                                           col_ind,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    }
+
+    hipsparseStatus_t iluk_analysis(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descr,
+                                    const hipComplex*         val,
+                                    const int*                row_ptr,
+                                    const int*                col_ind,
+                                    csrilu02Info_t            info,
+                                    void*                     buffer)
+    {
+        return hipsparseCcsrilu02_analysis(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           val,
+                                           row_ptr,
+                                           col_ind,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    }
+
+    hipsparseStatus_t iluk_analysis(hipsparseHandle_t         handle,
+                                    int                       m,
+                                    int                       nnz,
+                                    const hipsparseMatDescr_t descr,
+                                    const hipDoubleComplex*   val,
+                                    const int*                row_ptr,
+                                    const int*                col_ind,
+                                    csrilu02Info_t            info,
+                                    void*                     buffer)
+    {
+        return hipsparseZcsrilu02_analysis(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           val,
+                                           row_ptr,
+                                           col_ind,
+                                           info,
+                                           HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                           buffer);
+    }
+
+    hipsparseStatus_t iluk_factorize(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descr,
+                                     float*                    val,
+                                     const int*                row_ptr,
+                                     const int*                col_ind,
+                                     csrilu02Info_t            info,
+                                     void*                     buffer)
+    {
+        return hipsparseScsrilu02(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  val,
+                                  row_ptr,
+                                  col_ind,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    }
+
+    hipsparseStatus_t iluk_factorize(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descr,
+                                     double*                   val,
+                                     const int*                row_ptr,
+                                     const int*                col_ind,
+                                     csrilu02Info_t            info,
+                                     void*                     buffer)
+    {
+        return hipsparseDcsrilu02(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  val,
+                                  row_ptr,
+                                  col_ind,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    }
+
+    hipsparseStatus_t iluk_factorize(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descr,
+                                     hipComplex*               val,
+                                     const int*                row_ptr,
+                                     const int*                col_ind,
+                                     csrilu02Info_t            info,
+                                     void*                     buffer)
+    {
+        return hipsparseCcsrilu02(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  val,
+                                  row_ptr,
+                                  col_ind,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    }
+
+    hipsparseStatus_t iluk_factorize(hipsparseHandle_t         handle,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descr,
+                                     hipDoubleComplex*         val,
+                                     const int*                row_ptr,
+                                     const int*                col_ind,
+                                     csrilu02Info_t            info,
+                                     void*                     buffer)
+    {
+        return hipsparseZcsrilu02(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  val,
+                                  row_ptr,
+                                  col_ind,
+                                  info,
+                                  HIPSPARSE_SOLVE_POLICY_USE_LEVEL,
+                                  buffer);
+    }
+
+    template <typename T>
+    hipsparseStatus_t csriluk_template(hipsparseHandle_t  handle,
+                                       hipDataType        datatype,
+                                       const T*           csrValA,
+                                       hipsparseIluInfo_t info,
+                                       T*                 csrValL,
+                                       int*               csrColIndL,
+                                       T*                 csrValU,
+                                       int*               csrColIndU)
+    {
+        if(handle == nullptr || info == nullptr || !info->iluk)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(info->m == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if((info->nnz_A > 0 && csrValA == nullptr) || csrValU == nullptr || csrColIndU == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(info->nnz_L > 0 && (csrValL == nullptr || csrColIndL == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int    m    = info->m;
+        const int    nnz  = info->nnz_fill;
+        const size_t size = sizeof(T) * nnz;
+
+        if(info->fill_val_size < size)
+        {
+            if(info->fill_val != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(info->fill_val));
+                info->fill_val      = nullptr;
+                info->fill_val_size = 0;
+            }
+
+            hipsparse::count_workspace(handle, size);
+            RETURN_IF_HIP_ERROR(hipMalloc(&info->fill_val, size));
+            info->fill_val_size = size;
+        }
+
+        T* fill_val = (T*)info->fill_val;
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        // A padded with explicit zeros at the fill-in positions
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(fill_val, 0, size, stream));
+
+        if(info->nnz_A > 0)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                iluk_scatter(handle, info->nnz_A, csrValA, info->map_A, fill_val));
+        }
+
+        // The dependency analysis only depends on the pattern, it is computed once per data type
+        if(!info->analysed || info->analysed_type != datatype)
+        {
+            size_t buffer_size;
+            RETURN_IF_HIPSPARSE_ERROR(iluk_buffer_size(handle,
+                                                       m,
+                                                       nnz,
+                                                       info->fill_descr,
+                                                       fill_val,
+                                                       info->fill_row_ptr,
+                                                       info->fill_col_ind,
+                                                       info->fill_info,
+                                                       &buffer_size));
+
+            if(info->buffer_size < buffer_size)
+            {
+                if(info->buffer != nullptr)
+                {
+                    RETURN_IF_HIP_ERROR(hipFree(info->buffer));
+                    info->buffer      = nullptr;
+                    info->buffer_size = 0;
+                }
+
+                hipsparse::count_workspace(handle, buffer_size);
+                RETURN_IF_HIP_ERROR(hipMalloc(&info->buffer, buffer_size));
+                info->buffer_size = buffer_size;
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(iluk_analysis(handle,
+                                                    m,
+                                                    nnz,
+                                                    info->fill_descr,
+                                                    fill_val,
+                                                    info->fill_row_ptr,
+                                                    info->fill_col_ind,
+                                                    info->fill_info,
+                                                    info->buffer));
+
+            info->analysed      = true;
+            info->analysed_type = datatype;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(iluk_factorize(handle,
+                                                 m,
+                                                 nnz,
+                                                 info->fill_descr,
+                                                 fill_val,
+                                                 info->fill_row_ptr,
+                                                 info->fill_col_ind,
+                                                 info->fill_info,
+                                                 info->buffer));
+
+        if(info->nnz_L > 0)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                iluk_gather(handle, info->nnz_L, fill_val, csrValL, info->map_L));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrColIndL,
+                                               info->col_ind_L,
+                                               sizeof(int) * info->nnz_L,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(iluk_gather(handle, info->nnz_U, fill_val, csrValU, info->map_U));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrColIndU,
+                                           info->col_ind_U,
+                                           sizeof(int) * info->nnz_U,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseXcsriluk_analysis(hipsparseHandle_t         handle,
+                                             int                       m,
+                                             int                       nnzA,
+                                             const hipsparseMatDescr_t descrA,
+                                             const int*                csrRowPtrA,
+                                             const int*                csrColIndA,
+                                             int                       level,
+                                             const hipsparseMatDescr_t descrL,
+                                             int*                      csrRowPtrL,
+                                             int*                      nnzL,
+                                             const hipsparseMatDescr_t descrU,
+                                             int*                      csrRowPtrU,
+                                             int*                      nnzU,
+                                             hipsparseIluInfo_t        info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnzA, level);
+
+    if(handle == nullptr || descrA == nullptr || descrL == nullptr || descrU == nullptr
+       || info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m < 0 || nnzA < 0 || level < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    if(csrRowPtrA == nullptr || csrRowPtrL == nullptr || csrRowPtrU == nullptr
+       || nnzL == nullptr || nnzU == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(nnzA > 0 && csrColIndA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const int base_A = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+    const int base_L = (hipsparseGetMatIndexBase(descrL) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+    const int base_U = (hipsparseGetMatIndexBase(descrU) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    std::vector<int> hrow_ptr_A(m + 1);
+    std::vector<int> hcol_ind_A(nnzA);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hrow_ptr_A.data(), csrRowPtrA, sizeof(int) * (m + 1), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        hcol_ind_A.data(), csrColIndA, sizeof(int) * nnzA, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    // Symbolic factorization on the host
+    std::vector<int> hrow_ptr_F;
+    std::vector<int> hcol_ind_F;
+    std::vector<int> hmap_A;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::iluk_structure(
+        m, nnzA, base_A, level, hrow_ptr_A, hcol_ind_A, hrow_ptr_F, hcol_ind_F, hmap_A));
+
+    std::vector<int> hrow_ptr_L;
+    std::vector<int> hcol_ind_L;
+    std::vector<int> hmap_L;
+    std::vector<int> hrow_ptr_U;
+    std::vector<int> hcol_ind_U;
+    std::vector<int> hmap_U;
+    hipsparse::ilu_split(m,
+                         hrow_ptr_F,
+                         hcol_ind_F,
+                         base_L,
+                         base_U,
+                         hrow_ptr_L,
+                         hcol_ind_L,
+                         hmap_L,
+                         hrow_ptr_U,
+                         hcol_ind_U,
+                         hmap_U);
+
+    // The fill pattern is factorized in the index base of A, such that zero pivots are reported
+    // in the index base of A
+    for(int& p : hrow_ptr_F)
+    {
+        p += base_A;
+    }
+
+    for(int& j : hcol_ind_F)
+    {
+        j += base_A;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::ilu_info_clear(info));
+
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hrow_ptr_F, &info->fill_row_ptr));
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hcol_ind_F, &info->fill_col_ind));
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hmap_A, &info->map_A));
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hmap_L, &info->map_L));
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hmap_U, &info->map_U));
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hcol_ind_L, &info->col_ind_L));
+    RETURN_IF_HIPSPARSE_ERROR(iluk_upload(handle, stream, hcol_ind_U, &info->col_ind_U));
+
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateMatDescr(&info->fill_descr));
+    RETURN_IF_HIPSPARSE_ERROR(
+        hipsparseSetMatIndexBase(info->fill_descr, hipsparseGetMatIndexBase(descrA)));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsrilu02Info(&info->fill_info));
+
+    info->m        = m;
+    info->nnz_A    = nnzA;
+    info->nnz_L    = static_cast<int>(hcol_ind_L.size());
+    info->nnz_U    = static_cast<int>(hcol_ind_U.size());
+    info->nnz_fill = static_cast<int>(hcol_ind_F.size());
+    info->iluk     = true;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csrRowPtrL, hrow_ptr_L.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csrRowPtrU, hrow_ptr_U.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    *nnzL = info->nnz_L;
+    *nnzU = info->nnz_U;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseXcsriluk_zeroPivot(hipsparseHandle_t  handle,
+                                              hipsparseIluInfo_t info,
+                                              int*               position)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(handle == nullptr || info == nullptr || !info->iluk || position == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparseXcsrilu02_zeroPivot(handle, info->fill_info, position);
+}
+
+hipsparseStatus_t hipsparseScsriluk(hipsparseHandle_t  handle,
+                                    const float*       csrValA,
+                                    hipsparseIluInfo_t info,
+                                    float*             csrValL,
+                                    int*               csrColIndL,
+                                    float*             csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csriluk_template(
+        handle, HIP_R_32F, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
+
+hipsparseStatus_t hipsparseDcsriluk(hipsparseHandle_t  handle,
+                                    const double*      csrValA,
+                                    hipsparseIluInfo_t info,
+                                    double*            csrValL,
+                                    int*               csrColIndL,
+                                    double*            csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csriluk_template(
+        handle, HIP_R_64F, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
+
+hipsparseStatus_t hipsparseCcsriluk(hipsparseHandle_t  handle,
+                                    const hipComplex*  csrValA,
+                                    hipsparseIluInfo_t info,
+                                    hipComplex*        csrValL,
+                                    int*               csrColIndL,
+                                    hipComplex*        csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csriluk_template(
+        handle, HIP_C_32F, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
+
+hipsparseStatus_t hipsparseZcsriluk(hipsparseHandle_t       handle,
+                                    const hipDoubleComplex* csrValA,
+                                    hipsparseIluInfo_t      info,
+                                    hipDoubleComplex*       csrValL,
+                                    int*                    csrColIndL,
+                                    hipDoubleComplex*       csrValU,
+                                    int*                    csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csriluk_template(
+        handle, HIP_C_64F, csrValA, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
@@ -0,0 +1,458 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+#include "hipsparse_ilu.h"
+
+#include <complex>
+#include <vector>
+
+namespace
+{
+    template <typename T, typename C>
+    hipsparseStatus_t csrilutNnz_template(hipsparseHandle_t         handle,
+                                          hipDataType               datatype,
+                                          int                       m,
+                                          int                       nnzA,
+                                          const hipsparseMatDescr_t descrA,
+                                          const T*                  csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          double                    tol,
+                                          int                       maxFill,
+                                          const hipsparseMatDescr_t descrL,
+                                          int*                      csrRowPtrL,
+                                          int*                      nnzL,
+                                          const hipsparseMatDescr_t descrU,
+                                          int*                      csrRowPtrU,
+                                          int*                      nnzU,
+                                          hipsparseIluInfo_t        info)
+    {
+        if(handle == nullptr || descrA == nullptr || descrL == nullptr || descrU == nullptr
+           || info == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m < 0 || nnzA < 0 || maxFill < 0 || !(tol >= 0.0))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(csrRowPtrA == nullptr || csrRowPtrL == nullptr || csrRowPtrU == nullptr
+           || nnzL == nullptr || nnzU == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnzA > 0 && (csrValA == nullptr || csrColIndA == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int base_A = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+        const int base_L = (hipsparseGetMatIndexBase(descrL) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+        const int base_U = (hipsparseGetMatIndexBase(descrU) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+        // rocSPARSE has no ILUT, the factorization runs on the host with copies on the handle
+        // stream
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        std::vector<int> hrow_ptr_A(m + 1);
+        std::vector<int> hcol_ind_A(nnzA);
+        std::vector<C>   hval_A(nnzA);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hrow_ptr_A.data(),
+                                           csrRowPtrA,
+                                           sizeof(int) * (m + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hcol_ind_A.data(), csrColIndA, sizeof(int) * nnzA, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hval_A.data(), csrValA, sizeof(C) * nnzA, hipMemcpyDeviceToHost, stream));
+
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // The dropping depends on the values, such that the factorization is computed at once
+        std::vector<int> hrow_ptr_L;
+        std::vector<int> hcol_ind_L;
+        std::vector<C>   hval_L;
+        std::vector<int> hrow_ptr_U;
+        std::vector<int> hcol_ind_U;
+        std::vector<C>   hval_U;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::ilut_factorize(m,
+                                                            base_A,
+                                                            tol,
+                                                            maxFill,
+                                                            hrow_ptr_A,
+                                                            hcol_ind_A,
+                                                            hval_A,
+                                                            hrow_ptr_L,
+                                                            hcol_ind_L,
+                                                            hval_L,
+                                                            hrow_ptr_U,
+                                                            hcol_ind_U,
+                                                            hval_U));
+
+        for(int& p : hrow_ptr_L)
+        {
+            p += base_L;
+        }
+
+        for(int& j : hcol_ind_L)
+        {
+            j += base_L;
+        }
+
+        for(int& p : hrow_ptr_U)
+        {
+            p += base_U;
+        }
+
+        for(int& j : hcol_ind_U)
+        {
+            j += base_U;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrRowPtrL,
+                                           hrow_ptr_L.data(),
+                                           sizeof(int) * (m + 1),
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrRowPtrU,
+                                           hrow_ptr_U.data(),
+                                           sizeof(int) * (m + 1),
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        // The host row pointers have to outlive the copies
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::ilu_info_clear(info));
+
+        info->m     = m;
+        info->nnz_A = nnzA;
+        info->nnz_L = static_cast<int>(hcol_ind_L.size());
+        info->nnz_U = static_cast<int>(hcol_ind_U.size());
+
+        info->ilut           = true;
+        info->ilut_type      = datatype;
+        info->ilut_col_ind_L = std::move(hcol_ind_L);
+        info->ilut_col_ind_U = std::move(hcol_ind_U);
+        info->ilut_val_L.assign((const char*)hval_L.data(),
+                                (const char*)(hval_L.data() + hval_L.size()));
+        info->ilut_val_U.assign((const char*)hval_U.data(),
+                                (const char*)(hval_U.data() + hval_U.size()));
+
+        *nnzL = info->nnz_L;
+        *nnzU = info->nnz_U;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t csrilut_template(hipsparseHandle_t  handle,
+                                       hipDataType        datatype,
+                                       hipsparseIluInfo_t info,
+                                       T*                 csrValL,
+                                       int*               csrColIndL,
+                                       T*                 csrValU,
+                                       int*               csrColIndU)
+    {
+        if(handle == nullptr || info == nullptr || !info->ilut)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The factors have been computed for a different data type
+        if(info->ilut_type != datatype)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(info->nnz_L > 0 && (csrValL == nullptr || csrColIndL == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(info->nnz_U > 0 && (csrValU == nullptr || csrColIndU == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        if(info->nnz_L > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrColIndL,
+                                               info->ilut_col_ind_L.data(),
+                                               sizeof(int) * info->nnz_L,
+                                               hipMemcpyHostToDevice,
+                                               stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrValL,
+                                               info->ilut_val_L.data(),
+                                               sizeof(T) * info->nnz_L,
+                                               hipMemcpyHostToDevice,
+                                               stream));
+        }
+
+        if(info->nnz_U > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrColIndU,
+                                               info->ilut_col_ind_U.data(),
+                                               sizeof(int) * info->nnz_U,
+                                               hipMemcpyHostToDevice,
+                                               stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(csrValU,
+                                               info->ilut_val_U.data(),
+                                               sizeof(T) * info->nnz_U,
+                                               hipMemcpyHostToDevice,
+                                               stream));
+        }
+
+        // The factors in info may be replaced or released once this function returns
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseScsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const float*              csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       float                     tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnzA, maxFill);
+
+    return csrilutNnz_template<float, float>(handle,
+                                             HIP_R_32F,
+                                             m,
+                                             nnzA,
+                                             descrA,
+                                             csrValA,
+                                             csrRowPtrA,
+                                             csrColIndA,
+                                             tol,
+                                             maxFill,
+                                             descrL,
+                                             csrRowPtrL,
+                                             nnzL,
+                                             descrU,
+                                             csrRowPtrU,
+                                             nnzU,
+                                             info);
+}
+
+hipsparseStatus_t hipsparseDcsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const double*             csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       double                    tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnzA, maxFill);
+
+    return csrilutNnz_template<double, double>(handle,
+                                               HIP_R_64F,
+                                               m,
+                                               nnzA,
+                                               descrA,
+                                               csrValA,
+                                               csrRowPtrA,
+                                               csrColIndA,
+                                               tol,
+                                               maxFill,
+                                               descrL,
+                                               csrRowPtrL,
+                                               nnzL,
+                                               descrU,
+                                               csrRowPtrU,
+                                               nnzU,
+                                               info);
+}
+
+hipsparseStatus_t hipsparseCcsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipComplex*         csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       float                     tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnzA, maxFill);
+
+    return csrilutNnz_template<hipComplex, std::complex<float>>(handle,
+                                                                HIP_C_32F,
+                                                                m,
+                                                                nnzA,
+                                                                descrA,
+                                                                csrValA,
+                                                                csrRowPtrA,
+                                                                csrColIndA,
+                                                                tol,
+                                                                maxFill,
+                                                                descrL,
+                                                                csrRowPtrL,
+                                                                nnzL,
+                                                                descrU,
+                                                                csrRowPtrU,
+                                                                nnzU,
+                                                                info);
+}
+
+hipsparseStatus_t hipsparseZcsrilutNnz(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnzA,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipDoubleComplex*   csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       double                    tol,
+                                       int                       maxFill,
+                                       const hipsparseMatDescr_t descrL,
+                                       int*                      csrRowPtrL,
+                                       int*                      nnzL,
+                                       const hipsparseMatDescr_t descrU,
+                                       int*                      csrRowPtrU,
+                                       int*                      nnzU,
+                                       hipsparseIluInfo_t        info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnzA, maxFill);
+
+    return csrilutNnz_template<hipDoubleComplex, std::complex<double>>(handle,
+                                                                       HIP_C_64F,
+                                                                       m,
+                                                                       nnzA,
+                                                                       descrA,
+                                                                       csrValA,
+                                                                       csrRowPtrA,
+                                                                       csrColIndA,
+                                                                       tol,
+                                                                       maxFill,
+                                                                       descrL,
+                                                                       csrRowPtrL,
+                                                                       nnzL,
+                                                                       descrU,
+                                                                       csrRowPtrU,
+                                                                       nnzU,
+                                                                       info);
+}
+
+hipsparseStatus_t hipsparseScsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    float*             csrValL,
+                                    int*               csrColIndL,
+                                    float*             csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csrilut_template(handle, HIP_R_32F, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
+
+hipsparseStatus_t hipsparseDcsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    double*            csrValL,
+                                    int*               csrColIndL,
+                                    double*            csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csrilut_template(handle, HIP_R_64F, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
+
+hipsparseStatus_t hipsparseCcsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    hipComplex*        csrValL,
+                                    int*               csrColIndL,
+                                    hipComplex*        csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csrilut_template(handle, HIP_C_32F, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
+
+hipsparseStatus_t hipsparseZcsrilut(hipsparseHandle_t  handle,
+                                    hipsparseIluInfo_t info,
+                                    hipDoubleComplex*  csrValL,
+                                    int*               csrColIndL,
+                                    hipDoubleComplex*  csrValU,
+                                    int*               csrColIndU)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    return csrilut_template(handle, HIP_C_64F, info, csrValL, csrColIndL, csrValU, csrColIndU);
+}
@@ -0,0 +1,790 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace
+{
+    hipsparseStatus_t csritilu0_check(int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      hipsparseItilu0Alg_t      alg)
+    {
+        if(descrA == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m < 0 || nnz < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(alg < HIPSPARSE_ITILU0_ALG_DEFAULT || alg > HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    rocsparse_status csritilu0_compute(rocsparse_handle     handle,
+                                       rocsparse_itilu0_alg alg,
+                                       int                  option,
+                                       int*                 maxIter,
+                                       float                tol,
+                                       int                  m,
+                                       int                  nnz,
+                                       const int*           csrRowPtrA,
+                                       const int*           csrColIndA,
+                                       const float*         csrValA,
+                                       float*               csrValM,
+                                       rocsparse_index_base base,
+                                       size_t               bufferSize,
+                                       void*                pBuffer)
+    {
+        return rocsparse_scsritilu0_compute(handle,
+                                            alg,
+                                            option,
+                                            maxIter,
+                                            tol,
+                                            m,
+                                            nnz,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            csrValA,
+                                            csrValM,
+                                            base,
+                                            bufferSize,
+                                            pBuffer);
+    }
+
+    rocsparse_status csritilu0_compute(rocsparse_handle     handle,
+                                       rocsparse_itilu0_alg alg,
+                                       int                  option,
+                                       int*                 maxIter,
+                                       double               tol,
+                                       int                  m,
+                                       int                  nnz,
+                                       const int*           csrRowPtrA,
+                                       const int*           csrColIndA,
+                                       const double*        csrValA,
+                                       double*              csrValM,
+                                       rocsparse_index_base base,
+                                       size_t               bufferSize,
+                                       void*                pBuffer)
+    {
+        return rocsparse_dcsritilu0_compute(handle,
+                                            alg,
+                                            option,
+                                            maxIter,
+                                            tol,
+                                            m,
+                                            nnz,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            csrValA,
+                                            csrValM,
+                                            base,
+                                            bufferSize,
+                                            pBuffer);
+    }
+
+    rocsparse_status csritilu0_compute(rocsparse_handle     handle,
+                                       rocsparse_itilu0_alg alg,
+                                       int                  option,
+                                       int*                 maxIter,
+                                       float                tol,
+                                       int                  m,
+                                       int                  nnz,
+                                       const int*           csrRowPtrA,
+                                       const int*           csrColIndA,
+                                       const hipComplex*    csrValA,
+                                       hipComplex*          csrValM,
+                                       rocsparse_index_base base,
+                                       size_t               bufferSize,
+                                       void*                pBuffer)
+    {
+        return rocsparse_ccsritilu0_compute(handle,
+                                            alg,
+                                            option,
+                                            maxIter,
+                                            tol,
+                                            m,
+                                            nnz,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            (const rocsparse_float_complex*)csrValA,
+                                            (rocsparse_float_complex*)csrValM,
+                                            base,
+                                            bufferSize,
+                                            pBuffer);
+    }
+
+    rocsparse_status csritilu0_compute(rocsparse_handle        handle,
+                                       rocsparse_itilu0_alg    alg,
+                                       int                     option,
+                                       int*                    maxIter,
+                                       double                  tol,
+                                       int                     m,
+                                       int                     nnz,
+                                       const int*              csrRowPtrA,
+                                       const int*              csrColIndA,
+                                       const hipDoubleComplex* csrValA,
+                                       hipDoubleComplex*       csrValM,
+                                       rocsparse_index_base    base,
+                                       size_t                  bufferSize,
+                                       void*                   pBuffer)
+    {
+        return rocsparse_zcsritilu0_compute(handle,
+                                            alg,
+                                            option,
+                                            maxIter,
+                                            tol,
+                                            m,
+                                            nnz,
+                                            csrRowPtrA,
+                                            csrColIndA,
+                                            (const rocsparse_double_complex*)csrValA,
+                                            (rocsparse_double_complex*)csrValM,
+                                            base,
+                                            bufferSize,
+                                            pBuffer);
+    }
+
+    template <typename T, typename R>
+    hipsparseStatus_t csritilu0_template(hipsparseHandle_t         handle,
+                                         hipsparseItilu0Alg_t      alg,
+                                         int                       option,
+                                         int*                      maxIter,
+                                         R                         tol,
+                                         int                       m,
+                                         int                       nnz,
+                                         const hipsparseMatDescr_t descrA,
+                                         const T*                  csrValA,
+                                         const int*                csrRowPtrA,
+                                         const int*                csrColIndA,
+                                         T*                        csrValM,
+                                         size_t                    bufferSize,
+                                         void*                     pBuffer)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(csritilu0_check(m, nnz, descrA, alg));
+
+        return hipsparse::rocSPARSEStatusToHIPStatus(
+            csritilu0_compute((rocsparse_handle)handle,
+                              hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+                              hipsparse::hipItilu0OptionToHCCItilu0Option(option),
+                              maxIter,
+                              tol,
+                              m,
+                              nnz,
+                              csrRowPtrA,
+                              csrColIndA,
+                              csrValA,
+                              csrValM,
+                              hipsparse::hipBaseToHCCBase(hipsparseGetMatIndexBase(descrA)),
+                              bufferSize,
+                              pBuffer));
+    }
+
+    //
+    // The ILU0 factors of a Hermitian positive definite matrix satisfy U = D L^H, with D the
+    // diagonal of U. The IC0 factor is therefore L D^{1/2}, which only needs the diagonal of U
+    // and is computed on the host. Entries above the diagonal keep the values of A, as in
+    // csric02. The copies run on the handle stream.
+    //
+    template <typename T, typename C>
+    hipsparseStatus_t csritic0_from_ilu0(hipsparseHandle_t handle,
+                                         int               m,
+                                         int               nnz,
+                                         int               base,
+                                         const int*        csrRowPtrA,
+                                         const int*        csrColIndA,
+                                         const T*          csrValA,
+                                         T*                csrValM)
+    {
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        std::vector<int> row_ptr(m + 1);
+        std::vector<int> col_ind(nnz);
+        std::vector<C>   val_A(nnz);
+        std::vector<C>   val_M(nnz);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            row_ptr.data(), csrRowPtrA, sizeof(int) * (m + 1), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            col_ind.data(), csrColIndA, sizeof(int) * nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(val_A.data(), csrValA, sizeof(C) * nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(val_M.data(), csrValM, sizeof(C) * nnz, hipMemcpyDeviceToHost, stream));
+
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // Square root of the diagonal of U
+        std::vector<C> sqrt_diag(m);
+        for(int i = 0; i < m; ++i)
+        {
+            bool has_diag = false;
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                if(col_ind[k] - base == i)
+                {
+                    if(std::real(val_M[k]) <= 0)
+                    {
+                        return HIPSPARSE_STATUS_ZERO_PIVOT;
+                    }
+
+                    sqrt_diag[i] = std::sqrt(std::real(val_M[k]));
+                    has_diag     = true;
+                }
+            }
+
+            if(!has_diag)
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+        }
+
+        for(int i = 0; i < m; ++i)
+        {
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                const int j = col_ind[k] - base;
+
+                if(j < i)
+                {
+                    val_M[k] *= sqrt_diag[j];
+                }
+                else if(j == i)
+                {
+                    val_M[k] = sqrt_diag[i];
+                }
+                else
+                {
+                    val_M[k] = val_A[k];
+                }
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(csrValM, val_M.data(), sizeof(C) * nnz, hipMemcpyHostToDevice, stream));
+
+        // The host values have to outlive the copy
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T, typename C, typename R>
+    hipsparseStatus_t csritic0_template(hipsparseHandle_t         handle,
+                                        hipsparseItilu0Alg_t      alg,
+                                        int                       option,
+                                        int*                      maxIter,
+                                        R                         tol,
+                                        int                       m,
+                                        int                       nnz,
+                                        const hipsparseMatDescr_t descrA,
+                                        const T*                  csrValA,
+                                        const int*                csrRowPtrA,
+                                        const int*                csrColIndA,
+                                        T*                        csrValM,
+                                        size_t                    bufferSize,
+                                        void*                     pBuffer)
+    {
+        RETURN_IF_HIPSPARSE_ERROR(csritilu0_template(handle,
+                                                     alg,
+                                                     option,
+                                                     maxIter,
+                                                     tol,
+                                                     m,
+                                                     nnz,
+                                                     descrA,
+                                                     csrValA,
+                                                     csrRowPtrA,
+                                                     csrColIndA,
+                                                     csrValM,
+                                                     bufferSize,
+                                                     pBuffer));
+
+        if(m == 0 || nnz == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        const int base = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+        return csritic0_from_ilu0<T, C>(
+            handle, m, nnz, base, csrRowPtrA, csrColIndA, csrValA, csrValM);
+    }
+}
+
+hipsparseStatus_t hipsparseXcsritilu0_bufferSize(hipsparseHandle_t         handle,
+                                                 hipsparseItilu0Alg_t      alg,
+                                                 int                       option,
+                                                 int                       maxIter,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const int*                csrRowPtrA,
+                                                 const int*                csrColIndA,
+                                                 hipDataType               valueType,
+                                                 size_t*                   pBufferSizeInBytes)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz, maxIter);
+
+    RETURN_IF_HIPSPARSE_ERROR(csritilu0_check(m, nnz, descrA, alg));
+
+    if(valueType != HIP_R_32F && valueType != HIP_R_64F && valueType != HIP_C_32F
+       && valueType != HIP_C_64F)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csritilu0_buffer_size(
+        (rocsparse_handle)handle,
+        hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+        hipsparse::hipItilu0OptionToHCCItilu0Option(option),
+        maxIter,
+        m,
+        nnz,
+        csrRowPtrA,
+        csrColIndA,
+        hipsparse::hipBaseToHCCBase(hipsparseGetMatIndexBase(descrA)),
+        hipsparse::hipDataTypeToHCCDataType(valueType),
+        pBufferSizeInBytes));
+}
+
+hipsparseStatus_t hipsparseXcsritilu0_preprocess(hipsparseHandle_t         handle,
+                                                 hipsparseItilu0Alg_t      alg,
+                                                 int                       option,
+                                                 int                       maxIter,
+                                                 int                       m,
+                                                 int                       nnz,
+                                                 const hipsparseMatDescr_t descrA,
+                                                 const int*                csrRowPtrA,
+                                                 const int*                csrColIndA,
+                                                 hipDataType               valueType,
+                                                 size_t                    bufferSize,
+                                                 void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz, maxIter);
+
+    RETURN_IF_HIPSPARSE_ERROR(csritilu0_check(m, nnz, descrA, alg));
+
+    if(valueType != HIP_R_32F && valueType != HIP_R_64F && valueType != HIP_C_32F
+       && valueType != HIP_C_64F)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_csritilu0_preprocess(
+        (rocsparse_handle)handle,
+        hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+        hipsparse::hipItilu0OptionToHCCItilu0Option(option),
+        maxIter,
+        m,
+        nnz,
+        csrRowPtrA,
+        csrColIndA,
+        hipsparse::hipBaseToHCCBase(hipsparseGetMatIndexBase(descrA)),
+        hipsparse::hipDataTypeToHCCDataType(valueType),
+        bufferSize,
+        pBuffer));
+}
+
+hipsparseStatus_t hipsparseScsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      float                     tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const float*              csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      float*                    csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritilu0_template(handle,
+                              alg,
+                              option,
+                              maxIter,
+                              tol,
+                              m,
+                              nnz,
+                              descrA,
+                              csrValA,
+                              csrRowPtrA,
+                              csrColIndA,
+                              csrValM,
+                              bufferSize,
+                              pBuffer);
+}
+
+hipsparseStatus_t hipsparseDcsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      double                    tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const double*             csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      double*                   csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritilu0_template(handle,
+                              alg,
+                              option,
+                              maxIter,
+                              tol,
+                              m,
+                              nnz,
+                              descrA,
+                              csrValA,
+                              csrRowPtrA,
+                              csrColIndA,
+                              csrValM,
+                              bufferSize,
+                              pBuffer);
+}
+
+hipsparseStatus_t hipsparseCcsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      float                     tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipComplex*         csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      hipComplex*               csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritilu0_template(handle,
+                              alg,
+                              option,
+                              maxIter,
+                              tol,
+                              m,
+                              nnz,
+                              descrA,
+                              csrValA,
+                              csrRowPtrA,
+                              csrColIndA,
+                              csrValM,
+                              bufferSize,
+                              pBuffer);
+}
+
+hipsparseStatus_t hipsparseZcsritilu0(hipsparseHandle_t         handle,
+                                      hipsparseItilu0Alg_t      alg,
+                                      int                       option,
+                                      int*                      maxIter,
+                                      double                    tol,
+                                      int                       m,
+                                      int                       nnz,
+                                      const hipsparseMatDescr_t descrA,
+                                      const hipDoubleComplex*   csrValA,
+                                      const int*                csrRowPtrA,
+                                      const int*                csrColIndA,
+                                      hipDoubleComplex*         csrValM,
+                                      size_t                    bufferSize,
+                                      void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritilu0_template(handle,
+                              alg,
+                              option,
+                              maxIter,
+                              tol,
+                              m,
+                              nnz,
+                              descrA,
+                              csrValA,
+                              csrRowPtrA,
+                              csrColIndA,
+                              csrValM,
+                              bufferSize,
+                              pBuffer);
+}
+
+hipsparseStatus_t hipsparseScsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              float*               data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(alg < HIPSPARSE_ITILU0_ALG_DEFAULT || alg > HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_scsritilu0_history((rocsparse_handle)handle,
+                                     hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+                                     niter,
+                                     data,
+                                     bufferSize,
+                                     pBuffer));
+}
+
+hipsparseStatus_t hipsparseDcsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              double*              data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(alg < HIPSPARSE_ITILU0_ALG_DEFAULT || alg > HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_dcsritilu0_history((rocsparse_handle)handle,
+                                     hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+                                     niter,
+                                     data,
+                                     bufferSize,
+                                     pBuffer));
+}
+
+hipsparseStatus_t hipsparseCcsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              float*               data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(alg < HIPSPARSE_ITILU0_ALG_DEFAULT || alg > HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_ccsritilu0_history((rocsparse_handle)handle,
+                                     hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+                                     niter,
+                                     data,
+                                     bufferSize,
+                                     pBuffer));
+}
+
+hipsparseStatus_t hipsparseZcsritilu0_history(hipsparseHandle_t    handle,
+                                              hipsparseItilu0Alg_t alg,
+                                              int*                 niter,
+                                              double*              data,
+                                              size_t               bufferSize,
+                                              void*                pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle);
+
+    if(alg < HIPSPARSE_ITILU0_ALG_DEFAULT || alg > HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    return hipsparse::rocSPARSEStatusToHIPStatus(
+        rocsparse_zcsritilu0_history((rocsparse_handle)handle,
+                                     hipsparse::hipItilu0AlgToHCCItilu0Alg(alg),
+                                     niter,
+                                     data,
+                                     bufferSize,
+                                     pBuffer));
+}
+
+hipsparseStatus_t hipsparseScsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     float                     tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const float*              csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     float*                    csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritic0_template<float, float>(handle,
+                                           alg,
+                                           option,
+                                           maxIter,
+                                           tol,
+                                           m,
+                                           nnz,
+                                           descrA,
+                                           csrValA,
+                                           csrRowPtrA,
+                                           csrColIndA,
+                                           csrValM,
+                                           bufferSize,
+                                           pBuffer);
+}
+
+hipsparseStatus_t hipsparseDcsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     double                    tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const double*             csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     double*                   csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritic0_template<double, double>(handle,
+                                             alg,
+                                             option,
+                                             maxIter,
+                                             tol,
+                                             m,
+                                             nnz,
+                                             descrA,
+                                             csrValA,
+                                             csrRowPtrA,
+                                             csrColIndA,
+                                             csrValM,
+                                             bufferSize,
+                                             pBuffer);
+}
+
+hipsparseStatus_t hipsparseCcsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     float                     tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipComplex*         csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     hipComplex*               csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritic0_template<hipComplex, std::complex<float>>(handle,
+                                                              alg,
+                                                              option,
+                                                              maxIter,
+                                                              tol,
+                                                              m,
+                                                              nnz,
+                                                              descrA,
+                                                              csrValA,
+                                                              csrRowPtrA,
+                                                              csrColIndA,
+                                                              csrValM,
+                                                              bufferSize,
+                                                              pBuffer);
+}
+
+hipsparseStatus_t hipsparseZcsritic0(hipsparseHandle_t         handle,
+                                     hipsparseItilu0Alg_t      alg,
+                                     int                       option,
+                                     int*                      maxIter,
+                                     double                    tol,
+                                     int                       m,
+                                     int                       nnz,
+                                     const hipsparseMatDescr_t descrA,
+                                     const hipDoubleComplex*   csrValA,
+                                     const int*                csrRowPtrA,
+                                     const int*                csrColIndA,
+                                     hipDoubleComplex*         csrValM,
+                                     size_t                    bufferSize,
+                                     void*                     pBuffer)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csritic0_template<hipDoubleComplex, std::complex<double>>(handle,
+                                                                     alg,
+                                                                     option,
+                                                                     maxIter,
+                                                                     tol,
+                                                                     m,
+                                                                     nnz,
+                                                                     descrA,
+                                                                     csrValA,
+                                                                     csrRowPtrA,
+                                                                     csrColIndA,
+                                                                     csrValM,
+                                                                     bufferSize,
+                                                                     pBuffer);
+}
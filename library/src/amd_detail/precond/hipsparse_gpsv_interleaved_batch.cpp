@@ -42,6 +42,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -74,6 +76,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -106,6 +110,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -138,6 +144,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -170,6 +178,8 @@ hipsparseStatus_t hipsparseSgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -197,6 +207,8 @@ hipsparseStatus_t hipsparseDgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -224,6 +236,8 @@ hipsparseStatus_t hipsparseCgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -251,6 +265,8 @@ hipsparseStatus_t hipsparseZgpsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgpsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gpsv_interleaved_alg)algo,
@@ -40,6 +40,8 @@ hipsparseStatus_t hipsparseSgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -59,6 +61,8 @@ hipsparseStatus_t hipsparseDgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -78,6 +82,8 @@ hipsparseStatus_t hipsparseCgtsv2_bufferSizeExt(hipsparseHandle_t handle,
                                                 int               ldb,
                                                 size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -105,6 +111,8 @@ hipsparseStatus_t hipsparseZgtsv2_bufferSizeExt(hipsparseHandle_t       handle,
                                                 int                     ldb,
                                                 size_t*                 pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -133,6 +141,8 @@ hipsparseStatus_t hipsparseSgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -148,6 +158,8 @@ hipsparseStatus_t hipsparseDgtsv2(hipsparseHandle_t handle,
                                   void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv((rocsparse_handle)handle, m, n, dl, d, du, B, ldb, pBuffer));
 }
@@ -162,6 +174,8 @@ hipsparseStatus_t hipsparseCgtsv2(hipsparseHandle_t handle,
                                   int               ldb,
                                   void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_cgtsv((rocsparse_handle)handle,
                                                                  m,
                                                                  n,
@@ -184,6 +198,8 @@ hipsparseStatus_t hipsparseZgtsv2(hipsparseHandle_t       handle,
                                   void*                   pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, ldb);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv((rocsparse_handle)handle,
                         m,
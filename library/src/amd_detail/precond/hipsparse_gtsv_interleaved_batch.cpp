@@ -40,6 +40,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -68,6 +70,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -96,6 +100,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int               batchCount,
                                                                size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -124,6 +130,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch_bufferSizeExt(hipsparseHandle_t
                                                                int                     batchCount,
                                                                size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -153,6 +161,8 @@ hipsparseStatus_t hipsparseSgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_sgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -177,6 +187,8 @@ hipsparseStatus_t hipsparseDgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -200,6 +212,8 @@ hipsparseStatus_t hipsparseCgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  int               batchCount,
                                                  void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
@@ -224,6 +238,8 @@ hipsparseStatus_t hipsparseZgtsvInterleavedBatch(hipsparseHandle_t handle,
                                                  void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, algo, m, batchCount);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_interleaved_batch((rocsparse_handle)handle,
                                           (rocsparse_gtsv_interleaved_alg)algo,
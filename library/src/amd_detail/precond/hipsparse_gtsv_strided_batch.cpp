@@ -40,6 +40,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -67,6 +69,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -94,6 +98,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t ha
                                                             int               batchStride,
                                                             size_t*           pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -121,6 +127,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch_bufferSizeExt(hipsparseHandle_t
                                                             int                     batchStride,
                                                             size_t* pBufferSizeInBytes)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     // cusparse allows passing nullptr's for dl, d, du, and B. On the other hand rocsparse checks
     // if they are nullptr and returns invalid pointer if they are. In both cases the pointers are
     // never actually de-referenced. In order to work in the same way regardless of the backend
@@ -149,6 +157,8 @@ hipsparseStatus_t hipsparseSgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_sgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -164,6 +174,8 @@ hipsparseStatus_t hipsparseDgtsv2StridedBatch(hipsparseHandle_t handle,
                                               void*             pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(rocsparse_dgtsv_no_pivot_strided_batch(
         (rocsparse_handle)handle, m, dl, d, du, x, batchCount, batchStride, pBuffer));
 }
@@ -178,6 +190,8 @@ hipsparseStatus_t hipsparseCgtsv2StridedBatch(hipsparseHandle_t handle,
                                               int               batchStride,
                                               void*             pBuffer)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_cgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
@@ -201,6 +215,8 @@ hipsparseStatus_t hipsparseZgtsv2StridedBatch(hipsparseHandle_t       handle,
                                               void*                   pBuffer)
 
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, batchCount, batchStride);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zgtsv_no_pivot_strided_batch((rocsparse_handle)handle,
                                                m,
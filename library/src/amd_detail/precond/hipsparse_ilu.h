@@ -0,0 +1,416 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_ILU_H
+#define HIPSPARSE_ILU_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+struct hipsparseIluInfo
+{
+    // Number of rows of the factorized matrix and number of non-zero entries of A, L and U of
+    // the last symbolic phase. L holds the strictly lower part, its unit diagonal is not stored.
+    int m{};
+    int nnz_A{};
+    int nnz_L{};
+    int nnz_U{};
+
+    // ILU(k), set by hipsparseXcsriluk_analysis(). The values of A are scattered into the
+    // pattern of A with fill-in, which is factorized by csrilu02 and gathered into L and U.
+    // map_A, map_L and map_U are the zero based positions of A, L and U in the fill pattern.
+    bool                iluk{};
+    int                 nnz_fill{};
+    int*                fill_row_ptr{};
+    int*                fill_col_ind{};
+    int*                map_A{};
+    int*                map_L{};
+    int*                map_U{};
+    int*                col_ind_L{};
+    int*                col_ind_U{};
+    hipsparseMatDescr_t fill_descr{};
+    csrilu02Info_t      fill_info{};
+
+    // Values of the fill pattern and csrilu02 buffer, allocated by the first numeric phase. The
+    // csrilu02 analysis is computed once per data type and reused while only values change.
+    void*       fill_val{};
+    size_t      fill_val_size{};
+    void*       buffer{};
+    size_t      buffer_size{};
+    bool        analysed{};
+    hipDataType analysed_type{};
+
+    // ILUT(tau, p), set by hipsparseXcsrilutNnz(). The factors are computed on the host, the
+    // column indices are in the index base of L and U.
+    bool              ilut{};
+    hipDataType       ilut_type{};
+    std::vector<int>  ilut_col_ind_L;
+    std::vector<int>  ilut_col_ind_U;
+    std::vector<char> ilut_val_L;
+    std::vector<char> ilut_val_U;
+};
+
+namespace hipsparse
+{
+    //
+    // Sparsity pattern of L + U for ILU(k) by the level of fill rule of the symbolic IKJ
+    // factorization: an entry created by eliminating A_ik has level lev(i, k) + lev(k, j) + 1
+    // and is kept if its level is at most level. Entries of A have level 0 and the diagonal is
+    // always part of the pattern. The columns of A have to be sorted. row_ptr_F and col_ind_F
+    // are zero based, map_A[k] is the position of the k-th entry of A in the pattern.
+    //
+    inline hipsparseStatus_t iluk_structure(int                     m,
+                                            int                     nnz,
+                                            int                     base,
+                                            int                     level,
+                                            const std::vector<int>& row_ptr_A,
+                                            const std::vector<int>& col_ind_A,
+                                            std::vector<int>&       row_ptr_F,
+                                            std::vector<int>&       col_ind_F,
+                                            std::vector<int>&       map_A)
+    {
+        if(row_ptr_A[0] != base || row_ptr_A[m] - base != nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Upper part of every factorized row, with the level of fill of each entry
+        std::vector<std::vector<std::pair<int, int>>> upper(m);
+
+        row_ptr_F.assign(m + 1, 0);
+        col_ind_F.clear();
+        map_A.resize(nnz);
+
+        for(int i = 0; i < m; ++i)
+        {
+            const int row_begin = row_ptr_A[i] - base;
+            const int row_end   = row_ptr_A[i + 1] - base;
+
+            if(row_begin > row_end || row_end > nnz)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            std::map<int, int> row;
+            for(int k = row_begin; k < row_end; ++k)
+            {
+                const int j = col_ind_A[k] - base;
+                if(j < 0 || j >= m || (k > row_begin && j <= col_ind_A[k - 1] - base))
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                row[j] = 0;
+            }
+
+            row.emplace(i, 0);
+
+            // Entries inserted during the elimination are right of the current pivot, such that
+            // every entry left of the diagonal is visited with its final level
+            for(auto it = row.begin(); it != row.end() && it->first < i; ++it)
+            {
+                const int64_t lev_ik = it->second;
+
+                for(const auto& kj : upper[it->first])
+                {
+                    const int64_t lev = lev_ik + kj.second + 1;
+                    if(lev > level)
+                    {
+                        continue;
+                    }
+
+                    auto ij = row.emplace(kj.first, static_cast<int>(lev));
+                    if(!ij.second && lev < ij.first->second)
+                    {
+                        ij.first->second = static_cast<int>(lev);
+                    }
+                }
+            }
+
+            const int offset = static_cast<int>(col_ind_F.size());
+            for(const auto& ij : row)
+            {
+                col_ind_F.push_back(ij.first);
+
+                if(ij.first > i)
+                {
+                    upper[i].push_back(ij);
+                }
+            }
+
+            row_ptr_F[i + 1] = static_cast<int>(col_ind_F.size());
+
+            for(int k = row_begin; k < row_end; ++k)
+            {
+                map_A[k] = static_cast<int>(
+                    std::lower_bound(col_ind_F.begin() + offset,
+                                     col_ind_F.end(),
+                                     col_ind_A[k] - base)
+                    - col_ind_F.begin());
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Split a zero based pattern into its strictly lower part L and its upper part U including
+    // the diagonal. map_L and map_U are the positions of L and U in the pattern.
+    //
+    inline void ilu_split(int                     m,
+                          const std::vector<int>& row_ptr,
+                          const std::vector<int>& col_ind,
+                          int                     base_L,
+                          int                     base_U,
+                          std::vector<int>&       row_ptr_L,
+                          std::vector<int>&       col_ind_L,
+                          std::vector<int>&       map_L,
+                          std::vector<int>&       row_ptr_U,
+                          std::vector<int>&       col_ind_U,
+                          std::vector<int>&       map_U)
+    {
+        row_ptr_L.assign(m + 1, base_L);
+        row_ptr_U.assign(m + 1, base_U);
+        col_ind_L.clear();
+        col_ind_U.clear();
+        map_L.clear();
+        map_U.clear();
+
+        for(int i = 0; i < m; ++i)
+        {
+            for(int k = row_ptr[i]; k < row_ptr[i + 1]; ++k)
+            {
+                if(col_ind[k] < i)
+                {
+                    col_ind_L.push_back(col_ind[k] + base_L);
+                    map_L.push_back(k);
+                }
+                else
+                {
+                    col_ind_U.push_back(col_ind[k] + base_U);
+                    map_U.push_back(k);
+                }
+            }
+
+            row_ptr_L[i + 1] = static_cast<int>(col_ind_L.size()) + base_L;
+            row_ptr_U[i + 1] = static_cast<int>(col_ind_U.size()) + base_U;
+        }
+    }
+
+    //
+    // ILUT(tau, p) by the IKJ variant of Saad's dual threshold algorithm. With
+    // tau_i = tau * ||a_i||_2, multipliers and entries of U smaller than tau_i in magnitude are
+    // dropped, and the max_fill largest entries of every row of L and of U, not counting the
+    // diagonal, are kept. Ties are broken by the smaller column index. The factors are zero
+    // based with sorted columns, L is strictly lower. Returns HIPSPARSE_STATUS_ZERO_PIVOT if a
+    // pivot is zero.
+    //
+    template <typename T>
+    hipsparseStatus_t ilut_factorize(int                     m,
+                                     int                     base,
+                                     double                  tol,
+                                     int                     max_fill,
+                                     const std::vector<int>& row_ptr_A,
+                                     const std::vector<int>& col_ind_A,
+                                     const std::vector<T>&   val_A,
+                                     std::vector<int>&       row_ptr_L,
+                                     std::vector<int>&       col_ind_L,
+                                     std::vector<T>&         val_L,
+                                     std::vector<int>&       row_ptr_U,
+                                     std::vector<int>&       col_ind_U,
+                                     std::vector<T>&         val_U)
+    {
+        const int nnz = static_cast<int>(col_ind_A.size());
+        if(row_ptr_A[0] != base || row_ptr_A[m] - base != nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        row_ptr_L.assign(m + 1, 0);
+        row_ptr_U.assign(m + 1, 0);
+        col_ind_L.clear();
+        col_ind_U.clear();
+        val_L.clear();
+        val_U.clear();
+
+        // Dense work row, used marks its non-zero pattern
+        std::vector<T>    w(m, T(0));
+        std::vector<char> used(m, 0);
+        std::vector<int>  pattern;
+        std::vector<int>  diag(m);
+
+        // Larger magnitude first, ties by the smaller column
+        auto larger = [](const std::pair<int, T>& a, const std::pair<int, T>& b) {
+            const double abs_a = std::abs(a.second);
+            const double abs_b = std::abs(b.second);
+            return abs_a > abs_b || (abs_a == abs_b && a.first < b.first);
+        };
+
+        auto by_column = [](const std::pair<int, T>& a, const std::pair<int, T>& b) {
+            return a.first < b.first;
+        };
+
+        std::vector<std::pair<int, T>> row_L;
+        std::vector<std::pair<int, T>> row_U;
+
+        for(int i = 0; i < m; ++i)
+        {
+            pattern.clear();
+
+            double norm = 0.0;
+            for(int k = row_ptr_A[i] - base; k < row_ptr_A[i + 1] - base; ++k)
+            {
+                const int j = col_ind_A[k] - base;
+                if(j < 0 || j >= m || used[j])
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                w[j]    = val_A[k];
+                used[j] = 1;
+                pattern.push_back(j);
+
+                const double a = std::abs(val_A[k]);
+                norm += a * a;
+            }
+
+            const double tau = tol * std::sqrt(norm);
+
+            // Eliminate the lower entries in increasing column order, the pattern grows with
+            // the fill-in of the rows of U
+            std::vector<int> lower;
+            for(int j : pattern)
+            {
+                if(j < i)
+                {
+                    lower.push_back(j);
+                }
+            }
+
+            std::make_heap(lower.begin(), lower.end(), std::greater<int>());
+
+            row_L.clear();
+            while(!lower.empty())
+            {
+                std::pop_heap(lower.begin(), lower.end(), std::greater<int>());
+                const int k = lower.back();
+                lower.pop_back();
+
+                const T w_k = w[k] / val_U[diag[k]];
+                if(std::abs(w_k) < tau)
+                {
+                    continue;
+                }
+
+                row_L.emplace_back(k, w_k);
+
+                for(int p = diag[k] + 1; p < row_ptr_U[k + 1]; ++p)
+                {
+                    const int j = col_ind_U[p];
+                    if(!used[j])
+                    {
+                        w[j]    = T(0);
+                        used[j] = 1;
+                        pattern.push_back(j);
+
+                        if(j < i)
+                        {
+                            lower.push_back(j);
+                            std::push_heap(lower.begin(), lower.end(), std::greater<int>());
+                        }
+                    }
+
+                    w[j] -= w_k * val_U[p];
+                }
+            }
+
+            if(!used[i] || w[i] == T(0))
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+
+            row_U.clear();
+            for(int j : pattern)
+            {
+                if(j > i && std::abs(w[j]) >= tau)
+                {
+                    row_U.emplace_back(j, w[j]);
+                }
+            }
+
+            // Keep the max_fill largest entries of L and U
+            for(auto* row : {&row_L, &row_U})
+            {
+                if(row->size() > static_cast<size_t>(max_fill))
+                {
+                    std::sort(row->begin(), row->end(), larger);
+                    row->resize(max_fill);
+                }
+
+                std::sort(row->begin(), row->end(), by_column);
+            }
+
+            for(const auto& ij : row_L)
+            {
+                col_ind_L.push_back(ij.first);
+                val_L.push_back(ij.second);
+            }
+
+            diag[i] = static_cast<int>(col_ind_U.size());
+            col_ind_U.push_back(i);
+            val_U.push_back(w[i]);
+
+            for(const auto& ij : row_U)
+            {
+                col_ind_U.push_back(ij.first);
+                val_U.push_back(ij.second);
+            }
+
+            row_ptr_L[i + 1] = static_cast<int>(col_ind_L.size());
+            row_ptr_U[i + 1] = static_cast<int>(col_ind_U.size());
+
+            for(int j : pattern)
+            {
+                w[j]    = T(0);
+                used[j] = 0;
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Release the device data of an ILU info structure and reset it.
+    //
+    hipsparseStatus_t ilu_info_clear(hipsparseIluInfo* info);
+}
+
+#endif // HIPSPARSE_ILU_H
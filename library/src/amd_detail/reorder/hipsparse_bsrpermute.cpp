@@ -0,0 +1,112 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+#include "hipsparse_permute.h"
+
+hipsparseStatus_t hipsparseXbsrpermute_analysis(hipsparseHandle_t         handle,
+                                                int                       mb,
+                                                int                       nb,
+                                                int                       nnzb,
+                                                const hipsparseMatDescr_t descrA,
+                                                const int*                bsrRowPtrA,
+                                                const int*                bsrColIndA,
+                                                int                       blockDim,
+                                                const int*                P,
+                                                const int*                Q,
+                                                const hipsparseMatDescr_t descrB,
+                                                int*                      bsrRowPtrB,
+                                                int*                      bsrColIndB,
+                                                hipsparsePermuteInfo_t    info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, mb, nb, nnzb, blockDim);
+
+    return hipsparse::permute_analysis(handle,
+                                       mb,
+                                       nb,
+                                       nnzb,
+                                       blockDim,
+                                       descrA,
+                                       bsrRowPtrA,
+                                       bsrColIndA,
+                                       P,
+                                       Q,
+                                       descrB,
+                                       bsrRowPtrB,
+                                       bsrColIndB,
+                                       info);
+}
+
+hipsparseStatus_t hipsparseSbsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnzb,
+                                       int                    blockDim,
+                                       const float*           bsrValA,
+                                       float*                 bsrValB,
+                                       hipsparsePermuteInfo_t info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnzb, blockDim);
+
+    return hipsparse::permute_values(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+}
+
+hipsparseStatus_t hipsparseDbsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnzb,
+                                       int                    blockDim,
+                                       const double*          bsrValA,
+                                       double*                bsrValB,
+                                       hipsparsePermuteInfo_t info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnzb, blockDim);
+
+    return hipsparse::permute_values(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+}
+
+hipsparseStatus_t hipsparseCbsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnzb,
+                                       int                    blockDim,
+                                       const hipComplex*      bsrValA,
+                                       hipComplex*            bsrValB,
+                                       hipsparsePermuteInfo_t info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnzb, blockDim);
+
+    return hipsparse::permute_values(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+}
+
+hipsparseStatus_t hipsparseZbsrpermute(hipsparseHandle_t       handle,
+                                       int                     nnzb,
+                                       int                     blockDim,
+                                       const hipDoubleComplex* bsrValA,
+                                       hipDoubleComplex*       bsrValB,
+                                       hipsparsePermuteInfo_t  info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnzb, blockDim);
+
+    return hipsparse::permute_values(handle, nnzb, blockDim, bsrValA, bsrValB, info);
+}
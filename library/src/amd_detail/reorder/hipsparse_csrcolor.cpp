@@ -43,6 +43,8 @@ hipsparseStatus_t hipsparseScsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_scsrcolor((rocsparse_handle)handle,
                             m,
@@ -71,6 +73,8 @@ hipsparseStatus_t hipsparseDcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_dcsrcolor((rocsparse_handle)handle,
                             m,
@@ -99,6 +103,8 @@ hipsparseStatus_t hipsparseCcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_ccsrcolor((rocsparse_handle)handle,
                             m,
@@ -127,6 +133,8 @@ hipsparseStatus_t hipsparseZcsrcolor(hipsparseHandle_t         handle,
                                      int*                      reordering,
                                      hipsparseColorInfo_t      info)
 {
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
     return hipsparse::rocSPARSEStatusToHIPStatus(
         rocsparse_zcsrcolor((rocsparse_handle)handle,
                             m,
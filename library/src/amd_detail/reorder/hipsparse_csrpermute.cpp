@@ -0,0 +1,278 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+#include "hipsparse_permute.h"
+
+#include <limits>
+#include <vector>
+
+hipsparseStatus_t hipsparseCreatePermuteInfo(hipsparsePermuteInfo_t* info)
+{
+    if(info == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *info = new hipsparsePermuteInfo;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseDestroyPermuteInfo(hipsparsePermuteInfo_t info)
+{
+    if(info != nullptr)
+    {
+        if(info->map != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->map));
+        }
+
+        delete info;
+    }
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+namespace hipsparse
+{
+    hipsparseStatus_t permute_analysis(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       n,
+                                       int                       nnz,
+                                       int                       block_dim,
+                                       const hipsparseMatDescr_t descrA,
+                                       const int*                row_ptr_A,
+                                       const int*                col_ind_A,
+                                       const int*                P,
+                                       const int*                Q,
+                                       const hipsparseMatDescr_t descrB,
+                                       int*                      row_ptr_B,
+                                       int*                      col_ind_B,
+                                       hipsparsePermuteInfo*     info)
+    {
+        if(handle == nullptr || descrA == nullptr || descrB == nullptr || info == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(m < 0 || n < 0 || nnz < 0 || block_dim <= 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL
+           || hipsparseGetMatType(descrB) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(row_ptr_A == nullptr || row_ptr_B == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnz > 0 && (col_ind_A == nullptr || col_ind_B == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The values are gathered with 32 bit indices
+        const int64_t size = static_cast<int64_t>(nnz) * block_dim * block_dim;
+        if(size > std::numeric_limits<int>::max())
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        const int base_A = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+        const int base_B = (hipsparseGetMatIndexBase(descrB) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        std::vector<int> hrow_ptr_A(m + 1);
+        std::vector<int> hcol_ind_A(nnz);
+        std::vector<int> hP(P != nullptr ? m : 0);
+        std::vector<int> hQ(Q != nullptr ? n : 0);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hrow_ptr_A.data(), row_ptr_A, sizeof(int) * (m + 1), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hcol_ind_A.data(), col_ind_A, sizeof(int) * nnz, hipMemcpyDeviceToHost, stream));
+
+        // An empty permutation is the identity
+        if(P != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(hP.data(), P, sizeof(int) * m, hipMemcpyDeviceToHost, stream));
+        }
+
+        if(Q != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpyAsync(hQ.data(), Q, sizeof(int) * n, hipMemcpyDeviceToHost, stream));
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+        std::vector<int> hrow_ptr_B;
+        std::vector<int> hcol_ind_B;
+        std::vector<int> map;
+        RETURN_IF_HIPSPARSE_ERROR(permute_structure(m,
+                                                    n,
+                                                    nnz,
+                                                    base_A,
+                                                    base_B,
+                                                    hrow_ptr_A,
+                                                    hcol_ind_A,
+                                                    hP,
+                                                    hQ,
+                                                    hrow_ptr_B,
+                                                    hcol_ind_B,
+                                                    map));
+
+        // Blocks are moved as a whole
+        const int        block_size = block_dim * block_dim;
+        std::vector<int> value_map(size);
+        for(int k = 0; k < nnz; ++k)
+        {
+            for(int t = 0; t < block_size; ++t)
+            {
+                value_map[k * block_size + t] = map[k] * block_size + t;
+            }
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            row_ptr_B, hrow_ptr_B.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            col_ind_B, hcol_ind_B.data(), sizeof(int) * nnz, hipMemcpyHostToDevice, stream));
+
+        if(info->map != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->map));
+            info->map = nullptr;
+        }
+
+        info->nnz       = 0;
+        info->block_dim = 0;
+
+        if(size > 0)
+        {
+            hipsparse::count_workspace(handle, sizeof(int) * size);
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->map, sizeof(int) * size));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                info->map, value_map.data(), sizeof(int) * size, hipMemcpyHostToDevice, stream));
+        }
+
+        // The host arrays are released once the copies have completed
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+        info->nnz       = nnz;
+        info->block_dim = block_dim;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseXcsrpermute_analysis(hipsparseHandle_t         handle,
+                                                int                       m,
+                                                int                       n,
+                                                int                       nnz,
+                                                const hipsparseMatDescr_t descrA,
+                                                const int*                csrRowPtrA,
+                                                const int*                csrColIndA,
+                                                const int*                P,
+                                                const int*                Q,
+                                                const hipsparseMatDescr_t descrB,
+                                                int*                      csrRowPtrB,
+                                                int*                      csrColIndB,
+                                                hipsparsePermuteInfo_t    info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, n, nnz);
+
+    return hipsparse::permute_analysis(handle,
+                                       m,
+                                       n,
+                                       nnz,
+                                       1,
+                                       descrA,
+                                       csrRowPtrA,
+                                       csrColIndA,
+                                       P,
+                                       Q,
+                                       descrB,
+                                       csrRowPtrB,
+                                       csrColIndB,
+                                       info);
+}
+
+hipsparseStatus_t hipsparseScsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnz,
+                                       const float*           csrValA,
+                                       float*                 csrValB,
+                                       hipsparsePermuteInfo_t info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnz);
+
+    return hipsparse::permute_values(handle, nnz, 1, csrValA, csrValB, info);
+}
+
+hipsparseStatus_t hipsparseDcsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnz,
+                                       const double*          csrValA,
+                                       double*                csrValB,
+                                       hipsparsePermuteInfo_t info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnz);
+
+    return hipsparse::permute_values(handle, nnz, 1, csrValA, csrValB, info);
+}
+
+hipsparseStatus_t hipsparseCcsrpermute(hipsparseHandle_t      handle,
+                                       int                    nnz,
+                                       const hipComplex*      csrValA,
+                                       hipComplex*            csrValB,
+                                       hipsparsePermuteInfo_t info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnz);
+
+    return hipsparse::permute_values(handle, nnz, 1, csrValA, csrValB, info);
+}
+
+hipsparseStatus_t hipsparseZcsrpermute(hipsparseHandle_t       handle,
+                                       int                     nnz,
+                                       const hipDoubleComplex* csrValA,
+                                       hipDoubleComplex*       csrValB,
+                                       hipsparsePermuteInfo_t  info)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, nnz);
+
+    return hipsparse::permute_values(handle, nnz, 1, csrValA, csrValB, info);
+}
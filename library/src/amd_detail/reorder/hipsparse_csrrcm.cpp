@@ -0,0 +1,302 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    //
+    // Breadth first search from root. Appends the visited nodes to nodes, level_ptr holds the
+    // start of every level in nodes. A node is visited if its mark equals stamp.
+    //
+    void rcm_level_structure(const std::vector<int>& adj_ptr,
+                             const std::vector<int>& adj,
+                             int                     root,
+                             std::vector<int>&       mark,
+                             int                     stamp,
+                             std::vector<int>&       nodes,
+                             std::vector<int>&       level_ptr)
+    {
+        nodes.clear();
+        level_ptr.clear();
+
+        nodes.push_back(root);
+        mark[root] = stamp;
+
+        size_t begin = 0;
+        while(begin < nodes.size())
+        {
+            const size_t end = nodes.size();
+            level_ptr.push_back(static_cast<int>(begin));
+
+            for(size_t k = begin; k < end; ++k)
+            {
+                const int u = nodes[k];
+                for(int e = adj_ptr[u]; e < adj_ptr[u + 1]; ++e)
+                {
+                    if(mark[adj[e]] != stamp)
+                    {
+                        mark[adj[e]] = stamp;
+                        nodes.push_back(adj[e]);
+                    }
+                }
+            }
+
+            begin = end;
+        }
+
+        level_ptr.push_back(static_cast<int>(nodes.size()));
+    }
+
+    //
+    // Node of minimum degree in nodes[begin, end), ties are broken by the lowest index.
+    //
+    int rcm_min_degree(const std::vector<int>& degree,
+                       const std::vector<int>& nodes,
+                       int                     begin,
+                       int                     end)
+    {
+        int node = nodes[begin];
+        for(int k = begin + 1; k < end; ++k)
+        {
+            const int v = nodes[k];
+            if(degree[v] < degree[node] || (degree[v] == degree[node] && v < node))
+            {
+                node = v;
+            }
+        }
+
+        return node;
+    }
+
+    hipsparseStatus_t rcm_ordering(int                     m,
+                                   int                     nnz,
+                                   int                     base,
+                                   const std::vector<int>& row_ptr,
+                                   const std::vector<int>& col_ind,
+                                   std::vector<int>&       order)
+    {
+        if(row_ptr[0] != base || row_ptr[m] - base != nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // Graph of A + A^T without self loops
+        std::vector<int> adj_ptr(m + 1, 0);
+        for(int i = 0; i < m; ++i)
+        {
+            if(row_ptr[i + 1] < row_ptr[i])
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                const int j = col_ind[k] - base;
+                if(j < 0 || j >= m)
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                if(j != i)
+                {
+                    ++adj_ptr[i + 1];
+                    ++adj_ptr[j + 1];
+                }
+            }
+        }
+
+        for(int i = 0; i < m; ++i)
+        {
+            adj_ptr[i + 1] += adj_ptr[i];
+        }
+
+        std::vector<int> adj(adj_ptr[m]);
+        std::vector<int> next(adj_ptr.begin(), adj_ptr.end() - 1);
+        for(int i = 0; i < m; ++i)
+        {
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                const int j = col_ind[k] - base;
+                if(j != i)
+                {
+                    adj[next[i]++] = j;
+                    adj[next[j]++] = i;
+                }
+            }
+        }
+
+        // Remove duplicate edges
+        std::vector<int> degree(m);
+        int              unique = 0;
+        for(int i = 0; i < m; ++i)
+        {
+            const int begin = adj_ptr[i];
+            std::sort(adj.begin() + begin, adj.begin() + adj_ptr[i + 1]);
+            const int end = static_cast<int>(
+                std::unique(adj.begin() + begin, adj.begin() + adj_ptr[i + 1]) - adj.begin());
+
+            adj_ptr[i] = unique;
+            for(int e = begin; e < end; ++e)
+            {
+                adj[unique++] = adj[e];
+            }
+
+            degree[i] = unique - adj_ptr[i];
+        }
+
+        adj_ptr[m] = unique;
+
+        std::vector<int>  mark(m, 0);
+        std::vector<char> ordered(m, 0);
+        std::vector<int>  nodes;
+        std::vector<int>  level_ptr;
+        std::vector<int>  neighbours;
+        int               stamp = 0;
+
+        order.clear();
+        order.reserve(m);
+
+        for(int seed = 0; seed < m; ++seed)
+        {
+            if(ordered[seed])
+            {
+                continue;
+            }
+
+            // Start from a node of minimum degree of the component
+            rcm_level_structure(adj_ptr, adj, seed, mark, ++stamp, nodes, level_ptr);
+            int root = rcm_min_degree(degree, nodes, 0, static_cast<int>(nodes.size()));
+
+            // Pseudo-peripheral node, move to a node of minimum degree of the last level as
+            // long as the eccentricity increases
+            rcm_level_structure(adj_ptr, adj, root, mark, ++stamp, nodes, level_ptr);
+            int eccentricity = static_cast<int>(level_ptr.size()) - 2;
+
+            while(eccentricity > 0)
+            {
+                const int candidate = rcm_min_degree(
+                    degree, nodes, level_ptr[level_ptr.size() - 2], level_ptr.back());
+
+                rcm_level_structure(adj_ptr, adj, candidate, mark, ++stamp, nodes, level_ptr);
+                const int candidate_eccentricity = static_cast<int>(level_ptr.size()) - 2;
+
+                if(candidate_eccentricity <= eccentricity)
+                {
+                    break;
+                }
+
+                root         = candidate;
+                eccentricity = candidate_eccentricity;
+            }
+
+            // Cuthill-McKee, visit the neighbours in ascending order of their degree
+            size_t head = order.size();
+            order.push_back(root);
+            ordered[root] = 1;
+
+            while(head < order.size())
+            {
+                const int u = order[head++];
+
+                neighbours.clear();
+                for(int e = adj_ptr[u]; e < adj_ptr[u + 1]; ++e)
+                {
+                    if(!ordered[adj[e]])
+                    {
+                        ordered[adj[e]] = 1;
+                        neighbours.push_back(adj[e]);
+                    }
+                }
+
+                std::sort(neighbours.begin(), neighbours.end(), [&degree](int a, int b) {
+                    return degree[a] < degree[b] || (degree[a] == degree[b] && a < b);
+                });
+
+                order.insert(order.end(), neighbours.begin(), neighbours.end());
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseXcsrrcm(hipsparseHandle_t         handle,
+                                   int                       m,
+                                   int                       nnz,
+                                   const hipsparseMatDescr_t descrA,
+                                   const int*                csrRowPtrA,
+                                   const int*                csrColIndA,
+                                   int*                      P)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    if(handle == nullptr || descrA == nullptr || m < 0 || nnz < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(m == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    if(csrRowPtrA == nullptr || P == nullptr || (nnz > 0 && csrColIndA == nullptr))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    const int base = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+    hipStream_t stream;
+    RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+    std::vector<int> row_ptr(m + 1);
+    std::vector<int> col_ind(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        row_ptr.data(), csrRowPtrA, sizeof(int) * (m + 1), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        col_ind.data(), csrColIndA, sizeof(int) * nnz, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+    std::vector<int> order;
+    RETURN_IF_HIPSPARSE_ERROR(rcm_ordering(m, nnz, base, row_ptr, col_ind, order));
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(P, order.data(), sizeof(int) * m, hipMemcpyHostToDevice, stream));
+
+    return hipsparse::synchronize_stream(handle, stream);
+}
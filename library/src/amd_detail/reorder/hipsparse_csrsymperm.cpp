@@ -0,0 +1,264 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../utility.h"
+#include "hipsparse_permute.h"
+
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    hipsparseStatus_t csrsymperm_template(hipsparseHandle_t         handle,
+                                          int                       m,
+                                          int                       nnz,
+                                          const hipsparseMatDescr_t descrA,
+                                          const T*                  csrValA,
+                                          const int*                csrRowPtrA,
+                                          const int*                csrColIndA,
+                                          const int*                P,
+                                          const hipsparseMatDescr_t descrC,
+                                          T*                        csrValC,
+                                          int*                      csrRowPtrC,
+                                          int*                      csrColIndC)
+    {
+        if(handle == nullptr || descrA == nullptr || descrC == nullptr || m < 0 || nnz < 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(hipsparseGetMatType(descrA) != HIPSPARSE_MATRIX_TYPE_GENERAL
+           || hipsparseGetMatType(descrC) != HIPSPARSE_MATRIX_TYPE_GENERAL)
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        if(m == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(csrRowPtrA == nullptr || P == nullptr || csrRowPtrC == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnz > 0
+           && (csrValA == nullptr || csrColIndA == nullptr || csrValC == nullptr
+               || csrColIndC == nullptr))
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        const int base_A = (hipsparseGetMatIndexBase(descrA) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+        const int base_C = (hipsparseGetMatIndexBase(descrC) == HIPSPARSE_INDEX_BASE_ONE) ? 1 : 0;
+
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::check_stream_not_capturing(stream));
+
+        std::vector<int> row_ptr_A(m + 1);
+        std::vector<int> col_ind_A(nnz);
+        std::vector<int> perm(m);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            row_ptr_A.data(), csrRowPtrA, sizeof(int) * (m + 1), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            col_ind_A.data(), csrColIndA, sizeof(int) * nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(perm.data(), P, sizeof(int) * m, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+        std::vector<int> row_ptr_C;
+        std::vector<int> col_ind_C;
+        std::vector<int> map;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::permute_structure(m,
+                                                               m,
+                                                               nnz,
+                                                               base_A,
+                                                               base_C,
+                                                               row_ptr_A,
+                                                               col_ind_A,
+                                                               perm,
+                                                               perm,
+                                                               row_ptr_C,
+                                                               col_ind_C,
+                                                               map));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csrRowPtrC, row_ptr_C.data(), sizeof(int) * (m + 1), hipMemcpyHostToDevice, stream));
+
+        if(nnz == 0)
+        {
+            return hipsparse::synchronize_stream(handle, stream);
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csrColIndC, col_ind_C.data(), sizeof(int) * nnz, hipMemcpyHostToDevice, stream));
+
+        // Values are gathered on the device
+        int* d_map;
+        hipsparse::count_workspace(handle, sizeof(int) * nnz);
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&d_map, sizeof(int) * nnz));
+
+        hipsparseStatus_t status = hipsparse::hipErrorToHIPSPARSEStatus(
+            hipMemcpyAsync(d_map, map.data(), sizeof(int) * nnz, hipMemcpyHostToDevice, stream));
+
+        if(status == HIPSPARSE_STATUS_SUCCESS)
+        {
+            status = hipsparse::rocSPARSEStatusToHIPStatus(
+                hipsparse::permute_gather((rocsparse_handle)handle, nnz, csrValA, csrValC, d_map));
+        }
+
+        // The host arrays and d_map are released once the copies and the gather have completed
+        const hipsparseStatus_t sync_status = hipsparse::synchronize_stream(handle, stream);
+
+        RETURN_IF_HIP_ERROR(hipFree(d_map));
+        RETURN_IF_HIPSPARSE_ERROR(status);
+
+        return sync_status;
+    }
+}
+
+hipsparseStatus_t hipsparseScsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const float*              csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       float*                    csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csrsymperm_template(handle,
+                               m,
+                               nnz,
+                               descrA,
+                               csrValA,
+                               csrRowPtrA,
+                               csrColIndA,
+                               P,
+                               descrC,
+                               csrValC,
+                               csrRowPtrC,
+                               csrColIndC);
+}
+
+hipsparseStatus_t hipsparseDcsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const double*             csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       double*                   csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csrsymperm_template(handle,
+                               m,
+                               nnz,
+                               descrA,
+                               csrValA,
+                               csrRowPtrA,
+                               csrColIndA,
+                               P,
+                               descrC,
+                               csrValC,
+                               csrRowPtrC,
+                               csrColIndC);
+}
+
+hipsparseStatus_t hipsparseCcsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipComplex*         csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       hipComplex*               csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csrsymperm_template(handle,
+                               m,
+                               nnz,
+                               descrA,
+                               csrValA,
+                               csrRowPtrA,
+                               csrColIndA,
+                               P,
+                               descrC,
+                               csrValC,
+                               csrRowPtrC,
+                               csrColIndC);
+}
+
+hipsparseStatus_t hipsparseZcsrsymperm(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       nnz,
+                                       const hipsparseMatDescr_t descrA,
+                                       const hipDoubleComplex*   csrValA,
+                                       const int*                csrRowPtrA,
+                                       const int*                csrColIndA,
+                                       const int*                P,
+                                       const hipsparseMatDescr_t descrC,
+                                       hipDoubleComplex*         csrValC,
+                                       int*                      csrRowPtrC,
+                                       int*                      csrColIndC)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, m, nnz);
+
+    return csrsymperm_template(handle,
+                               m,
+                               nnz,
+                               descrA,
+                               csrValA,
+                               csrRowPtrA,
+                               csrColIndA,
+                               P,
+                               descrC,
+                               csrValC,
+                               csrRowPtrC,
+                               csrColIndC);
+}
@@ -0,0 +1,258 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HIPSPARSE_PERMUTE_H
+#define HIPSPARSE_PERMUTE_H
+
+//
+// Permutation of the rows and columns of a sparse matrix, B = P A Q^T.
+//
+// The sparsity pattern of B and the position of every value of A in B are computed on the host.
+// The values are then permuted on the device with a single gather, which is all that has to
+// be repeated when the values of A change.
+//
+#include "hipsparse.h"
+
+#include <hip/hip_complex.h>
+#include <rocsparse/rocsparse.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+struct hipsparsePermuteInfo
+{
+    // Number of non-zero entries or blocks and block dimension of the last analysis, the block
+    // dimension of a CSR matrix is 1.
+    int nnz{};
+    int block_dim{};
+
+    // map[k] is the position in the values of A of the k-th value of B, a device array of
+    // nnz * block_dim * block_dim elements.
+    int* map{};
+};
+
+namespace hipsparse
+{
+    //
+    // Sparsity pattern of B = P A Q^T with sorted columns, i.e. B_ij = A_P[i],Q[j]. An empty P
+    // or Q is the identity. Returns HIPSPARSE_STATUS_INVALID_VALUE if P or Q is not a
+    // permutation or if A is not a valid CSR matrix.
+    //
+    inline hipsparseStatus_t permute_structure(int                     m,
+                                               int                     n,
+                                               int                     nnz,
+                                               int                     base_A,
+                                               int                     base_B,
+                                               const std::vector<int>& row_ptr_A,
+                                               const std::vector<int>& col_ind_A,
+                                               const std::vector<int>& P,
+                                               const std::vector<int>& Q,
+                                               std::vector<int>&       row_ptr_B,
+                                               std::vector<int>&       col_ind_B,
+                                               std::vector<int>&       map)
+    {
+        if(row_ptr_A[0] != base_A || row_ptr_A[m] - base_A != nnz)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // P and Q have to be permutations
+        std::vector<char> seen(m, 0);
+        for(size_t i = 0; i < P.size(); ++i)
+        {
+            if(P[i] < 0 || P[i] >= m || seen[P[i]])
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            seen[P[i]] = 1;
+        }
+
+        std::vector<int> inverse_Q(n);
+        for(int j = 0; j < n; ++j)
+        {
+            inverse_Q[j] = j;
+        }
+
+        if(!Q.empty())
+        {
+            std::fill(inverse_Q.begin(), inverse_Q.end(), -1);
+            for(int j = 0; j < n; ++j)
+            {
+                if(Q[j] < 0 || Q[j] >= n || inverse_Q[Q[j]] != -1)
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                inverse_Q[Q[j]] = j;
+            }
+        }
+
+        row_ptr_B.resize(m + 1);
+        col_ind_B.resize(nnz);
+        map.resize(nnz);
+
+        row_ptr_B[0] = base_B;
+
+        std::vector<std::pair<int, int>> row;
+        for(int i = 0; i < m; ++i)
+        {
+            const int old_row = P.empty() ? i : P[i];
+            const int begin   = row_ptr_A[old_row] - base_A;
+            const int end     = row_ptr_A[old_row + 1] - base_A;
+
+            if(begin < 0 || end < begin || end > nnz)
+            {
+                return HIPSPARSE_STATUS_INVALID_VALUE;
+            }
+
+            row.clear();
+            for(int k = begin; k < end; ++k)
+            {
+                const int j = col_ind_A[k] - base_A;
+                if(j < 0 || j >= n)
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                row.emplace_back(inverse_Q[j], k);
+            }
+
+            std::sort(row.begin(), row.end());
+
+            const int offset = row_ptr_B[i] - base_B;
+            for(size_t k = 0; k < row.size(); ++k)
+            {
+                col_ind_B[offset + k] = row[k].first + base_B;
+                map[offset + k]       = row[k].second;
+            }
+
+            row_ptr_B[i + 1] = row_ptr_B[i] + static_cast<int>(row.size());
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // x[k] = y[map[k]] for k = 0, ..., size - 1.
+    //
+    inline rocsparse_status permute_gather(
+        rocsparse_handle handle, int size, const float* y, float* x, const int* map)
+    {
+        return rocsparse_sgthr(handle, size, y, x, map, rocsparse_index_base_zero);
+    }
+
+    inline rocsparse_status permute_gather(
+        rocsparse_handle handle, int size, const double* y, double* x, const int* map)
+    {
+        return rocsparse_dgthr(handle, size, y, x, map, rocsparse_index_base_zero);
+    }
+
+    inline rocsparse_status permute_gather(
+        rocsparse_handle handle, int size, const hipComplex* y, hipComplex* x, const int* map)
+    {
+        return rocsparse_cgthr(handle,
+                               size,
+                               (const rocsparse_float_complex*)y,
+                               (rocsparse_float_complex*)x,
+                               map,
+                               rocsparse_index_base_zero);
+    }
+
+    inline rocsparse_status permute_gather(rocsparse_handle        handle,
+                                           int                     size,
+                                           const hipDoubleComplex* y,
+                                           hipDoubleComplex*       x,
+                                           const int*              map)
+    {
+        return rocsparse_zgthr(handle,
+                               size,
+                               (const rocsparse_double_complex*)y,
+                               (rocsparse_double_complex*)x,
+                               map,
+                               rocsparse_index_base_zero);
+    }
+
+    //
+    // Symbolic phase of B = P A Q^T for CSR (block_dim 1) and BSR matrices. Computes the
+    // pattern of B on the device and the permutation of the values in info. P and Q can be
+    // nullptr.
+    //
+    hipsparseStatus_t permute_analysis(hipsparseHandle_t         handle,
+                                       int                       m,
+                                       int                       n,
+                                       int                       nnz,
+                                       int                       block_dim,
+                                       const hipsparseMatDescr_t descrA,
+                                       const int*                row_ptr_A,
+                                       const int*                col_ind_A,
+                                       const int*                P,
+                                       const int*                Q,
+                                       const hipsparseMatDescr_t descrB,
+                                       int*                      row_ptr_B,
+                                       int*                      col_ind_B,
+                                       hipsparsePermuteInfo*     info);
+
+    //
+    // Numeric phase of B = P A Q^T, a single gather of the values.
+    //
+    template <typename T>
+    hipsparseStatus_t permute_values(hipsparseHandle_t     handle,
+                                     int                   nnz,
+                                     int                   block_dim,
+                                     const T*              val_A,
+                                     T*                    val_B,
+                                     hipsparsePermuteInfo* info)
+    {
+        if(handle == nullptr || info == nullptr || nnz < 0 || block_dim <= 0)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        // The analysis has to match the matrix
+        if(nnz != info->nnz || block_dim != info->block_dim)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        if(nnz == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        if(val_A == nullptr || val_B == nullptr)
+        {
+            return HIPSPARSE_STATUS_INVALID_VALUE;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(permute_gather(
+            (rocsparse_handle)handle, nnz * block_dim * block_dim, val_A, val_B, info->map));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+#endif // HIPSPARSE_PERMUTE_H
@@ -0,0 +1,1715 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../hipsparse_graph.h"
+#include "../utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    //
+    // Zero based CSR matrix with 32 bit indices, owned by the hierarchy.
+    //
+    struct amg_csr
+    {
+        int64_t               nnz{};
+        void*                 row_ptr{};
+        void*                 col_ind{};
+        void*                 val{};
+        hipsparseSpMatDescr_t mat{};
+    };
+
+    //
+    // Buffer of a SpGEMM or transposition, kept from the symbolic phase for every numeric phase.
+    //
+    struct amg_buffer
+    {
+        void*  ptr{};
+        size_t size{};
+    };
+
+    //
+    // Level of the hierarchy. The matrix of level 0 is the matrix of the user, the matrix of
+    // level l + 1 is R_l A_l P_l.
+    //
+    struct amg_level
+    {
+        int64_t n{};
+        int64_t nnz{};
+        amg_csr A;
+
+        // Transfer operators to the next coarser level, which has nc rows. The Jacobi operator
+        // I - omega D^{-1} A smooths the tentative prolongator into P, AP is A P.
+        int64_t    nc{};
+        amg_csr    jacobi;
+        amg_csr    tentative;
+        amg_csr    P;
+        amg_csr    R;
+        amg_csr    AP;
+        amg_buffer spgemm_P;
+        amg_buffer spgemm_AP;
+        amg_buffer spgemm_RAP;
+        amg_buffer transpose;
+
+        // Smoother and coloring, unused if the level is solved directly
+        hipsparseSmootherDescr_t smoother{};
+        void*                    coloring{};
+        int                      ncolors{};
+
+        // Dense inverse of a coarsest level that is solved directly
+        amg_csr inverse;
+
+        // Right hand side, solution and residual, a single allocation. Level 0 works on the
+        // vectors of the user and stores the residual only.
+        void*                 work{};
+        hipsparseDnVecDescr_t b{};
+        hipsparseDnVecDescr_t x{};
+        hipsparseDnVecDescr_t r{};
+
+        // SpMV buffers of the residual, restriction, prolongation and direct solve
+        void* spmv_A{};
+        void* spmv_R{};
+        void* spmv_P{};
+        void* spmv_inverse{};
+    };
+}
+
+struct hipsparseAmgDescr
+{
+    double  strength_threshold{0.08};
+    double  prolongator_weight{4.0 / 3.0};
+    int     max_levels{10};
+    int64_t coarse_size{64};
+
+    hipsparseSmootherAlg_t smoother_alg{HIPSPARSE_SMOOTHER_JACOBI};
+    int                    pre_sweeps{1};
+    int                    post_sweeps{1};
+    double                 smoother_omega{2.0 / 3.0};
+
+    // Matrix of the last setup. The sparsity pattern is identified by the structure version
+    // and the index arrays of the descriptor.
+    bool               setup{};
+    int64_t            n{};
+    int64_t            nnz{};
+    int64_t            structure_version{};
+    const void*        row_ptr{};
+    const void*        col_ind{};
+    rocsparse_datatype datatype{};
+
+    std::vector<amg_level> levels;
+};
+
+namespace
+{
+    //
+    // Restore the pointer mode of the handle on return, the multigrid method passes its scalars
+    // from the host.
+    //
+    class amg_pointer_mode
+    {
+        rocsparse_handle       m_handle{};
+        rocsparse_pointer_mode m_mode{rocsparse_pointer_mode_host};
+
+    public:
+        explicit amg_pointer_mode(hipsparseHandle_t handle)
+            : m_handle((rocsparse_handle)handle)
+        {
+            rocsparse_get_pointer_mode(m_handle, &m_mode);
+        }
+
+        ~amg_pointer_mode()
+        {
+            rocsparse_set_pointer_mode(m_handle, m_mode);
+        }
+
+        amg_pointer_mode(const amg_pointer_mode&)            = delete;
+        amg_pointer_mode& operator=(const amg_pointer_mode&) = delete;
+    };
+
+    void amg_csr_clear(amg_csr& csr)
+    {
+        if(csr.mat != nullptr)
+        {
+            hipsparseDestroySpMat(csr.mat);
+        }
+
+        (void)hipFree(csr.row_ptr);
+        (void)hipFree(csr.col_ind);
+        (void)hipFree(csr.val);
+
+        csr = amg_csr();
+    }
+
+    void amg_buffer_clear(amg_buffer& buffer)
+    {
+        (void)hipFree(buffer.ptr);
+
+        buffer = amg_buffer();
+    }
+
+    //
+    // Release the hierarchy.
+    //
+    void amg_clear(hipsparseAmgDescr* descr)
+    {
+        for(amg_level& level : descr->levels)
+        {
+            amg_csr_clear(level.A);
+            amg_csr_clear(level.jacobi);
+            amg_csr_clear(level.tentative);
+            amg_csr_clear(level.P);
+            amg_csr_clear(level.R);
+            amg_csr_clear(level.AP);
+            amg_csr_clear(level.inverse);
+            amg_buffer_clear(level.spgemm_P);
+            amg_buffer_clear(level.spgemm_AP);
+            amg_buffer_clear(level.spgemm_RAP);
+            amg_buffer_clear(level.transpose);
+
+            if(level.smoother != nullptr)
+            {
+                hipsparseSmoother_destroyDescr(level.smoother);
+            }
+
+            for(hipsparseDnVecDescr_t vector : {level.b, level.x, level.r})
+            {
+                if(vector != nullptr)
+                {
+                    hipsparseDestroyDnVec(vector);
+                }
+            }
+
+            (void)hipFree(level.coloring);
+            (void)hipFree(level.work);
+            (void)hipFree(level.spmv_A);
+            (void)hipFree(level.spmv_R);
+            (void)hipFree(level.spmv_P);
+            (void)hipFree(level.spmv_inverse);
+        }
+
+        descr->levels.clear();
+        descr->setup = false;
+    }
+
+    hipsparseStatus_t amg_malloc(hipsparseHandle_t handle, void** ptr, size_t bytes)
+    {
+        hipsparse::count_workspace(handle, bytes);
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, std::max(bytes, sizeof(int64_t))));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Copy an array to the device on the handle stream, into a new allocation if *ptr is null.
+    //
+    template <typename K>
+    hipsparseStatus_t amg_upload(hipsparseHandle_t handle, const std::vector<K>& host, void** ptr)
+    {
+        if(*ptr == nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, ptr, sizeof(K) * host.size()));
+        }
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            *ptr, host.data(), sizeof(K) * host.size(), hipMemcpyHostToDevice, stream));
+
+        return hipsparse::synchronize_stream(handle, stream);
+    }
+
+    template <typename K>
+    hipsparseStatus_t
+        amg_download(hipsparseHandle_t handle, const void* ptr, int64_t size, std::vector<K>& host)
+    {
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        host.resize(size);
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(host.data(), ptr, sizeof(K) * size, hipMemcpyDeviceToHost, stream));
+
+        return hipsparse::synchronize_stream(handle, stream);
+    }
+
+    //
+    // Create an m x n matrix from host arrays, or update the values of an existing matrix with
+    // the same pattern.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_csr_upload(hipsparseHandle_t       handle,
+                                     amg_csr&                csr,
+                                     int64_t                 m,
+                                     int64_t                 n,
+                                     const std::vector<int>& row_ptr,
+                                     const std::vector<int>& col_ind,
+                                     const std::vector<T>&   val,
+                                     hipDataType             computeType)
+    {
+        if(csr.mat != nullptr)
+        {
+            return amg_upload(handle, val, &csr.val);
+        }
+
+        csr.nnz = static_cast<int64_t>(col_ind.size());
+
+        RETURN_IF_HIPSPARSE_ERROR(amg_upload(handle, row_ptr, &csr.row_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(amg_upload(handle, col_ind, &csr.col_ind));
+        RETURN_IF_HIPSPARSE_ERROR(amg_upload(handle, val, &csr.val));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&csr.mat,
+                                                     m,
+                                                     n,
+                                                     csr.nnz,
+                                                     csr.row_ptr,
+                                                     csr.col_ind,
+                                                     csr.val,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_BASE_ZERO,
+                                                     computeType));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Diagonal of a level, the Jacobi operator and the smoothers divide by it.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_diagonal(int64_t                 n,
+                                   const std::vector<int>& row_ptr,
+                                   const std::vector<int>& col_ind,
+                                   const std::vector<T>&   val,
+                                   int                     base,
+                                   std::vector<T>&         diagonal)
+    {
+        diagonal.assign(n, T(0));
+        for(int64_t i = 0; i < n; ++i)
+        {
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                if(col_ind[k] - base == i)
+                {
+                    diagonal[i] += val[k];
+                }
+            }
+
+            if(diagonal[i] == T(0))
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Greedy aggregation of the strongly connected rows by Vanek, Mandel and Brezina. Row i is
+    // strongly connected to row j if |a_ij| >= theta sqrt(|a_ii a_jj|). Returns the number of
+    // aggregates, rows without strong connections get the aggregate -1.
+    //
+    template <typename T>
+    int64_t amg_aggregate(int64_t                 n,
+                          const std::vector<int>& row_ptr,
+                          const std::vector<int>& col_ind,
+                          const std::vector<T>&   val,
+                          int                     base,
+                          const std::vector<T>&   diagonal,
+                          double                  theta,
+                          std::vector<int>&       aggregates)
+    {
+        // Strong connections
+        std::vector<int> strong_ptr(n + 1, 0);
+        std::vector<int> strong_ind;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                const int j = col_ind[k] - base;
+                if(j != i
+                   && std::abs(val[k])
+                          >= theta * std::sqrt(std::abs(diagonal[i]) * std::abs(diagonal[j])))
+                {
+                    strong_ind.push_back(j);
+                }
+            }
+
+            strong_ptr[i + 1] = static_cast<int>(strong_ind.size());
+        }
+
+        // -2 marks rows that are not aggregated yet
+        const int unassigned = -2;
+        int64_t   num_aggr   = 0;
+
+        aggregates.assign(n, unassigned);
+        for(int64_t i = 0; i < n; ++i)
+        {
+            if(strong_ptr[i + 1] == strong_ptr[i])
+            {
+                aggregates[i] = -1;
+            }
+        }
+
+        // Rows whose strong neighbours are all unassigned form an aggregate with them
+        for(int64_t i = 0; i < n; ++i)
+        {
+            if(aggregates[i] != unassigned)
+            {
+                continue;
+            }
+
+            bool isolated = true;
+            for(int k = strong_ptr[i]; k < strong_ptr[i + 1]; ++k)
+            {
+                isolated = isolated && (aggregates[strong_ind[k]] == unassigned);
+            }
+
+            if(isolated)
+            {
+                aggregates[i] = static_cast<int>(num_aggr);
+                for(int k = strong_ptr[i]; k < strong_ptr[i + 1]; ++k)
+                {
+                    aggregates[strong_ind[k]] = static_cast<int>(num_aggr);
+                }
+
+                ++num_aggr;
+            }
+        }
+
+        // Remaining rows join the aggregate of a strong neighbour of the first pass
+        const std::vector<int> first_pass(aggregates);
+        for(int64_t i = 0; i < n; ++i)
+        {
+            if(aggregates[i] != unassigned)
+            {
+                continue;
+            }
+
+            for(int k = strong_ptr[i]; k < strong_ptr[i + 1]; ++k)
+            {
+                if(first_pass[strong_ind[k]] >= 0)
+                {
+                    aggregates[i] = first_pass[strong_ind[k]];
+                    break;
+                }
+            }
+        }
+
+        // Rows that are still unassigned form an aggregate with their unassigned strong neighbours
+        for(int64_t i = 0; i < n; ++i)
+        {
+            if(aggregates[i] != unassigned)
+            {
+                continue;
+            }
+
+            aggregates[i] = static_cast<int>(num_aggr);
+            for(int k = strong_ptr[i]; k < strong_ptr[i + 1]; ++k)
+            {
+                if(aggregates[strong_ind[k]] == unassigned)
+                {
+                    aggregates[strong_ind[k]] = static_cast<int>(num_aggr);
+                }
+            }
+
+            ++num_aggr;
+        }
+
+        return num_aggr;
+    }
+
+    //
+    // Jacobi operator I - omega D^{-1} A with omega = weight / rho, where rho is the Gershgorin
+    // bound of the spectral radius of D^{-1} A. Its pattern is the pattern of A and the
+    // diagonal, with sorted columns.
+    //
+    template <typename T>
+    void amg_jacobi(int64_t                 n,
+                    const std::vector<int>& row_ptr,
+                    const std::vector<int>& col_ind,
+                    const std::vector<T>&   val,
+                    int                     base,
+                    const std::vector<T>&   diagonal,
+                    double                  weight,
+                    std::vector<int>&       jacobi_row_ptr,
+                    std::vector<int>&       jacobi_col_ind,
+                    std::vector<T>&         jacobi_val)
+    {
+        double rho = 0.0;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            double sum = 0.0;
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                sum += std::abs(val[k]);
+            }
+
+            rho = std::max(rho, sum / std::abs(diagonal[i]));
+        }
+
+        const T omega = T(rho > 0.0 ? weight / rho : 0.0);
+
+        jacobi_row_ptr.assign(n + 1, 0);
+        jacobi_col_ind.clear();
+        jacobi_val.clear();
+
+        std::vector<std::pair<int, T>> row;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            row.clear();
+            row.emplace_back(static_cast<int>(i), T(1));
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                row.emplace_back(col_ind[k] - base, -omega * val[k] / diagonal[i]);
+            }
+
+            // The identity comes first among equal columns and absorbs the diagonal of A
+            std::stable_sort(row.begin(),
+                             row.end(),
+                             [](const std::pair<int, T>& a, const std::pair<int, T>& b) {
+                                 return a.first < b.first;
+                             });
+
+            for(const std::pair<int, T>& entry : row)
+            {
+                if(jacobi_col_ind.size() > size_t(jacobi_row_ptr[i])
+                   && jacobi_col_ind.back() == entry.first)
+                {
+                    jacobi_val.back() += entry.second;
+                    continue;
+                }
+
+                jacobi_col_ind.push_back(entry.first);
+                jacobi_val.push_back(entry.second);
+            }
+
+            jacobi_row_ptr[i + 1] = static_cast<int>(jacobi_col_ind.size());
+        }
+    }
+
+    //
+    // Greedy coloring of the pattern of a level, every row gets the smallest color that none of
+    // its neighbours in lower rows has. Returns the number of colors.
+    //
+    int amg_coloring(int64_t                 n,
+                     const std::vector<int>& row_ptr,
+                     const std::vector<int>& col_ind,
+                     int                     base,
+                     std::vector<int>&       colors)
+    {
+        colors.assign(n, -1);
+
+        // mark[c] == i if color c is taken by a neighbour of row i
+        std::vector<int64_t> mark;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                const int j = col_ind[k] - base;
+                if(j != i && colors[j] >= 0)
+                {
+                    mark[colors[j]] = i;
+                }
+            }
+
+            size_t c = 0;
+            while(c < mark.size() && mark[c] == i)
+            {
+                ++c;
+            }
+
+            if(c == mark.size())
+            {
+                mark.push_back(-1);
+            }
+
+            colors[i] = static_cast<int>(c);
+        }
+
+        return static_cast<int>(mark.size());
+    }
+
+    //
+    // Gauss-Jordan inversion of a dense row major n x n matrix with partial pivoting. Returns
+    // false if the matrix is singular.
+    //
+    template <typename T>
+    bool amg_invert(int64_t n, std::vector<T>& a)
+    {
+        std::vector<T> inverse(n * n, T(0));
+        for(int64_t i = 0; i < n; ++i)
+        {
+            inverse[i * n + i] = T(1);
+        }
+
+        for(int64_t k = 0; k < n; ++k)
+        {
+            int64_t pivot = k;
+            for(int64_t i = k + 1; i < n; ++i)
+            {
+                if(std::abs(a[i * n + k]) > std::abs(a[pivot * n + k]))
+                {
+                    pivot = i;
+                }
+            }
+
+            if(a[pivot * n + k] == T(0))
+            {
+                return false;
+            }
+
+            for(int64_t j = 0; j < n; ++j)
+            {
+                std::swap(a[k * n + j], a[pivot * n + j]);
+                std::swap(inverse[k * n + j], inverse[pivot * n + j]);
+            }
+
+            const T scale = T(1) / a[k * n + k];
+            for(int64_t j = 0; j < n; ++j)
+            {
+                a[k * n + j] *= scale;
+                inverse[k * n + j] *= scale;
+            }
+
+            for(int64_t i = 0; i < n; ++i)
+            {
+                const T factor = a[i * n + k];
+                if(i == k || factor == T(0))
+                {
+                    continue;
+                }
+
+                for(int64_t j = 0; j < n; ++j)
+                {
+                    a[i * n + j] -= factor * a[k * n + j];
+                    inverse[i * n + j] -= factor * inverse[k * n + j];
+                }
+            }
+        }
+
+        a = std::move(inverse);
+
+        return true;
+    }
+
+    //
+    // Symbolic phase of C = A B. The row offsets of C are allocated before, and its column
+    // indices and values after the number of non-zeros is known.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_spgemm_symbolic(hipsparseHandle_t          handle,
+                                          hipsparseConstSpMatDescr_t A,
+                                          hipsparseConstSpMatDescr_t B,
+                                          amg_csr&                   C,
+                                          int64_t                    m,
+                                          int64_t                    n,
+                                          amg_buffer&                buffer,
+                                          hipDataType                computeType)
+    {
+        const T one = T(1);
+
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, &C.row_ptr, sizeof(int) * (m + 1)));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&C.mat,
+                                                     m,
+                                                     n,
+                                                     0,
+                                                     C.row_ptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_BASE_ZERO,
+                                                     computeType));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                                   rocsparse_operation_none,
+                                                   rocsparse_operation_none,
+                                                   &one,
+                                                   to_rocsparse_const_spmat_descr(A),
+                                                   to_rocsparse_const_spmat_descr(B),
+                                                   nullptr,
+                                                   to_rocsparse_const_spmat_descr(C.mat),
+                                                   to_rocsparse_spmat_descr(C.mat),
+                                                   hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                   rocsparse_spgemm_alg_default,
+                                                   rocsparse_spgemm_stage_buffer_size,
+                                                   &buffer.size,
+                                                   nullptr));
+
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, &buffer.ptr, buffer.size));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                                   rocsparse_operation_none,
+                                                   rocsparse_operation_none,
+                                                   &one,
+                                                   to_rocsparse_const_spmat_descr(A),
+                                                   to_rocsparse_const_spmat_descr(B),
+                                                   nullptr,
+                                                   to_rocsparse_const_spmat_descr(C.mat),
+                                                   to_rocsparse_spmat_descr(C.mat),
+                                                   hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                   rocsparse_spgemm_alg_default,
+                                                   rocsparse_spgemm_stage_nnz,
+                                                   &buffer.size,
+                                                   buffer.ptr));
+
+        int64_t rows;
+        int64_t cols;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseSpMatGetSize(C.mat, &rows, &cols, &C.nnz));
+
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, &C.col_ind, sizeof(int) * C.nnz));
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, &C.val, sizeof(T) * C.nnz));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCsrSetPointers(C.mat, C.row_ptr, C.col_ind, C.val));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                                   rocsparse_operation_none,
+                                                   rocsparse_operation_none,
+                                                   &one,
+                                                   to_rocsparse_const_spmat_descr(A),
+                                                   to_rocsparse_const_spmat_descr(B),
+                                                   nullptr,
+                                                   to_rocsparse_const_spmat_descr(C.mat),
+                                                   to_rocsparse_spmat_descr(C.mat),
+                                                   hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                   rocsparse_spgemm_alg_default,
+                                                   rocsparse_spgemm_stage_symbolic,
+                                                   &buffer.size,
+                                                   buffer.ptr));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Numeric phase of C = A B, the pattern of C is the one of the symbolic phase.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_spgemm_numeric(hipsparseHandle_t          handle,
+                                         hipsparseConstSpMatDescr_t A,
+                                         hipsparseConstSpMatDescr_t B,
+                                         amg_csr&                   C,
+                                         amg_buffer&                buffer,
+                                         hipDataType                computeType)
+    {
+        const T one = T(1);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm((rocsparse_handle)handle,
+                                                   rocsparse_operation_none,
+                                                   rocsparse_operation_none,
+                                                   &one,
+                                                   to_rocsparse_const_spmat_descr(A),
+                                                   to_rocsparse_const_spmat_descr(B),
+                                                   nullptr,
+                                                   to_rocsparse_const_spmat_descr(C.mat),
+                                                   to_rocsparse_spmat_descr(C.mat),
+                                                   hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                   rocsparse_spgemm_alg_default,
+                                                   rocsparse_spgemm_stage_numeric,
+                                                   &buffer.size,
+                                                   buffer.ptr));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    rocsparse_status amg_csr2csc(rocsparse_handle handle,
+                                 int              m,
+                                 int              n,
+                                 int              nnz,
+                                 const float*     csr_val,
+                                 const int*       csr_row_ptr,
+                                 const int*       csr_col_ind,
+                                 float*           csc_val,
+                                 int*             csc_row_ind,
+                                 int*             csc_col_ptr,
+                                 void*            buffer)
+    {
+        return rocsparse_scsr2csc(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csc_val,
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  rocsparse_action_numeric,
+                                  rocsparse_index_base_zero,
+                                  buffer);
+    }
+
+    rocsparse_status amg_csr2csc(rocsparse_handle handle,
+                                 int              m,
+                                 int              n,
+                                 int              nnz,
+                                 const double*    csr_val,
+                                 const int*       csr_row_ptr,
+                                 const int*       csr_col_ind,
+                                 double*          csc_val,
+                                 int*             csc_row_ind,
+                                 int*             csc_col_ptr,
+                                 void*            buffer)
+    {
+        return rocsparse_dcsr2csc(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csc_val,
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  rocsparse_action_numeric,
+                                  rocsparse_index_base_zero,
+                                  buffer);
+    }
+
+    rocsparse_status amg_csr2csc(rocsparse_handle           handle,
+                                 int                        m,
+                                 int                        n,
+                                 int                        nnz,
+                                 const std::complex<float>* csr_val,
+                                 const int*                 csr_row_ptr,
+                                 const int*                 csr_col_ind,
+                                 std::complex<float>*       csc_val,
+                                 int*                       csc_row_ind,
+                                 int*                       csc_col_ptr,
+                                 void*                      buffer)
+    {
+        return rocsparse_ccsr2csc(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  reinterpret_cast<const rocsparse_float_complex*>(csr_val),
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  reinterpret_cast<rocsparse_float_complex*>(csc_val),
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  rocsparse_action_numeric,
+                                  rocsparse_index_base_zero,
+                                  buffer);
+    }
+
+    rocsparse_status amg_csr2csc(rocsparse_handle            handle,
+                                 int                         m,
+                                 int                         n,
+                                 int                         nnz,
+                                 const std::complex<double>* csr_val,
+                                 const int*                  csr_row_ptr,
+                                 const int*                  csr_col_ind,
+                                 std::complex<double>*       csc_val,
+                                 int*                        csc_row_ind,
+                                 int*                        csc_col_ptr,
+                                 void*                       buffer)
+    {
+        return rocsparse_zcsr2csc(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  reinterpret_cast<const rocsparse_double_complex*>(csr_val),
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  reinterpret_cast<rocsparse_double_complex*>(csc_val),
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  rocsparse_action_numeric,
+                                  rocsparse_index_base_zero,
+                                  buffer);
+    }
+
+    //
+    // Allocate the restriction R = P^T of a level and the buffer of the transposition.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_transpose_analysis(hipsparseHandle_t handle,
+                                             amg_level&        level,
+                                             hipDataType       computeType)
+    {
+        const int64_t nnz = level.P.nnz;
+
+        level.R.nnz = nnz;
+        RETURN_IF_HIPSPARSE_ERROR(
+            amg_malloc(handle, &level.R.row_ptr, sizeof(int) * (level.nc + 1)));
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, &level.R.col_ind, sizeof(int) * nnz));
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, &level.R.val, sizeof(T) * nnz));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateCsr(&level.R.mat,
+                                                     level.nc,
+                                                     level.n,
+                                                     nnz,
+                                                     level.R.row_ptr,
+                                                     level.R.col_ind,
+                                                     level.R.val,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_32I,
+                                                     HIPSPARSE_INDEX_BASE_ZERO,
+                                                     computeType));
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr2csc_buffer_size((rocsparse_handle)handle,
+                                          static_cast<int>(level.n),
+                                          static_cast<int>(level.nc),
+                                          static_cast<int>(nnz),
+                                          static_cast<const int*>(level.P.row_ptr),
+                                          static_cast<const int*>(level.P.col_ind),
+                                          rocsparse_action_numeric,
+                                          &level.transpose.size));
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            amg_malloc(handle, &level.transpose.ptr, level.transpose.size));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t amg_transpose(hipsparseHandle_t handle, amg_level& level)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(amg_csr2csc((rocsparse_handle)handle,
+                                              static_cast<int>(level.n),
+                                              static_cast<int>(level.nc),
+                                              static_cast<int>(level.P.nnz),
+                                              static_cast<const T*>(level.P.val),
+                                              static_cast<const int*>(level.P.row_ptr),
+                                              static_cast<const int*>(level.P.col_ind),
+                                              static_cast<T*>(level.R.val),
+                                              static_cast<int*>(level.R.col_ind),
+                                              static_cast<int*>(level.R.row_ptr),
+                                              level.transpose.ptr));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Buffer size and preprocessing of y = A x.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_spmv_analysis(hipsparseHandle_t          handle,
+                                        hipsparseConstSpMatDescr_t A,
+                                        hipsparseDnVecDescr_t      x,
+                                        hipsparseDnVecDescr_t      y,
+                                        void**                     buffer,
+                                        hipDataType                computeType)
+    {
+        const T one  = T(1);
+        const T zero = T(0);
+
+        size_t buffer_size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &one,
+                                                 to_rocsparse_const_spmat_descr(A),
+                                                 to_rocsparse_const_dnvec_descr(x),
+                                                 &zero,
+                                                 to_rocsparse_dnvec_descr(y),
+                                                 hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_buffer_size,
+                                                 &buffer_size,
+                                                 nullptr));
+
+        RETURN_IF_HIPSPARSE_ERROR(amg_malloc(handle, buffer, buffer_size));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &one,
+                                                 to_rocsparse_const_spmat_descr(A),
+                                                 to_rocsparse_const_dnvec_descr(x),
+                                                 &zero,
+                                                 to_rocsparse_dnvec_descr(y),
+                                                 hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_preprocess,
+                                                 &buffer_size,
+                                                 *buffer));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t amg_spmv(hipsparseHandle_t          handle,
+                               T                          alpha,
+                               hipsparseConstSpMatDescr_t A,
+                               hipsparseConstDnVecDescr_t x,
+                               T                          beta,
+                               hipsparseDnVecDescr_t      y,
+                               void*                      buffer,
+                               hipDataType                computeType)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &alpha,
+                                                 to_rocsparse_const_spmat_descr(A),
+                                                 to_rocsparse_const_dnvec_descr(x),
+                                                 &beta,
+                                                 to_rocsparse_dnvec_descr(y),
+                                                 hipsparse::hipDataTypeToHCCDataType(computeType),
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_compute,
+                                                 nullptr,
+                                                 buffer));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseConstSpMatDescr_t amg_matrix(const hipsparseAmgDescr*   descr,
+                                          size_t                     level,
+                                          hipsparseConstSpMatDescr_t matA)
+    {
+        return (level == 0) ? matA : descr->levels[level].A.mat;
+    }
+
+    //
+    // Set up one level: the transfer operators and the matrix of the next coarser level, and
+    // the smoother or the dense inverse of the level. With reuse, the aggregates and patterns
+    // of a previous setup are kept and only the values are recomputed. Returns in coarsest
+    // whether the level is the last one.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_setup_level(hipsparseHandle_t          handle,
+                                      hipsparseAmgDescr*         descr,
+                                      size_t                     l,
+                                      hipsparseConstSpMatDescr_t matA,
+                                      hipDataType                computeType,
+                                      bool                       reuse,
+                                      bool*                      coarsest)
+    {
+        hipsparseConstSpMatDescr_t A = amg_matrix(descr, l, matA);
+
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        const void*          csr_row_ptr;
+        const void*          csr_col_ind;
+        const void*          csr_val;
+        rocsparse_indextype  row_type;
+        rocsparse_indextype  col_type;
+        rocsparse_index_base base;
+        rocsparse_datatype   datatype;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(A),
+                                                          &rows,
+                                                          &cols,
+                                                          &nnz,
+                                                          &csr_row_ptr,
+                                                          &csr_col_ind,
+                                                          &csr_val,
+                                                          &row_type,
+                                                          &col_type,
+                                                          &base,
+                                                          &datatype));
+
+        std::vector<int> row_ptr;
+        std::vector<int> col_ind;
+        std::vector<T>   val;
+        RETURN_IF_HIPSPARSE_ERROR(amg_download(handle, csr_row_ptr, rows + 1, row_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(amg_download(handle, csr_col_ind, nnz, col_ind));
+        RETURN_IF_HIPSPARSE_ERROR(amg_download(handle, csr_val, nnz, val));
+
+        std::vector<T> diagonal;
+        RETURN_IF_HIPSPARSE_ERROR(amg_diagonal(rows, row_ptr, col_ind, val, base, diagonal));
+
+        amg_level& level = descr->levels[l];
+        level.n          = rows;
+        level.nnz        = nnz;
+
+        // Coarsen until the level is small enough, the maximum number of levels is reached or
+        // the aggregation stalls
+        if(reuse)
+        {
+            *coarsest = (l + 1 == descr->levels.size());
+        }
+        else
+        {
+            *coarsest = (rows <= descr->coarse_size || l + 1 >= size_t(descr->max_levels));
+
+            if(!*coarsest)
+            {
+                std::vector<int> aggregates;
+                level.nc  = amg_aggregate(rows,
+                                          row_ptr,
+                                          col_ind,
+                                          val,
+                                          base,
+                                          diagonal,
+                                          descr->strength_threshold,
+                                          aggregates);
+                *coarsest = (level.nc == 0 || level.nc >= rows);
+
+                if(!*coarsest)
+                {
+                    // Tentative prolongator, rows that are not aggregated stay empty
+                    std::vector<int> tentative_row_ptr(rows + 1, 0);
+                    std::vector<int> tentative_col_ind;
+                    for(int64_t i = 0; i < rows; ++i)
+                    {
+                        if(aggregates[i] >= 0)
+                        {
+                            tentative_col_ind.push_back(aggregates[i]);
+                        }
+
+                        tentative_row_ptr[i + 1] = static_cast<int>(tentative_col_ind.size());
+                    }
+
+                    const std::vector<T> tentative_val(tentative_col_ind.size(), T(1));
+                    RETURN_IF_HIPSPARSE_ERROR(amg_csr_upload(handle,
+                                                             level.tentative,
+                                                             rows,
+                                                             level.nc,
+                                                             tentative_row_ptr,
+                                                             tentative_col_ind,
+                                                             tentative_val,
+                                                             computeType));
+                }
+            }
+        }
+
+        if(!*coarsest)
+        {
+            std::vector<int> jacobi_row_ptr;
+            std::vector<int> jacobi_col_ind;
+            std::vector<T>   jacobi_val;
+            amg_jacobi(rows,
+                       row_ptr,
+                       col_ind,
+                       val,
+                       base,
+                       diagonal,
+                       descr->prolongator_weight,
+                       jacobi_row_ptr,
+                       jacobi_col_ind,
+                       jacobi_val);
+
+            RETURN_IF_HIPSPARSE_ERROR(amg_csr_upload(handle,
+                                                     level.jacobi,
+                                                     rows,
+                                                     rows,
+                                                     jacobi_row_ptr,
+                                                     jacobi_col_ind,
+                                                     jacobi_val,
+                                                     computeType));
+
+            // The coarse level is appended before any reference to it is taken, the levels are
+            // reserved such that this does not move the finer levels
+            if(!reuse)
+            {
+                descr->levels.emplace_back();
+            }
+
+            amg_level& coarse = descr->levels[l + 1];
+
+            // P = J T, R = P^T and A_c = R (A P)
+            if(!reuse)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(amg_spgemm_symbolic<T>(handle,
+                                                                 level.jacobi.mat,
+                                                                 level.tentative.mat,
+                                                                 level.P,
+                                                                 rows,
+                                                                 level.nc,
+                                                                 level.spgemm_P,
+                                                                 computeType));
+                RETURN_IF_HIPSPARSE_ERROR(amg_transpose_analysis<T>(handle, level, computeType));
+                RETURN_IF_HIPSPARSE_ERROR(amg_spgemm_symbolic<T>(handle,
+                                                                 A,
+                                                                 level.P.mat,
+                                                                 level.AP,
+                                                                 rows,
+                                                                 level.nc,
+                                                                 level.spgemm_AP,
+                                                                 computeType));
+                RETURN_IF_HIPSPARSE_ERROR(amg_spgemm_symbolic<T>(handle,
+                                                                 level.R.mat,
+                                                                 level.AP.mat,
+                                                                 coarse.A,
+                                                                 level.nc,
+                                                                 level.nc,
+                                                                 level.spgemm_RAP,
+                                                                 computeType));
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(amg_spgemm_numeric<T>(handle,
+                                                            level.jacobi.mat,
+                                                            level.tentative.mat,
+                                                            level.P,
+                                                            level.spgemm_P,
+                                                            computeType));
+            RETURN_IF_HIPSPARSE_ERROR(amg_transpose<T>(handle, level));
+            RETURN_IF_HIPSPARSE_ERROR(amg_spgemm_numeric<T>(
+                handle, A, level.P.mat, level.AP, level.spgemm_AP, computeType));
+            RETURN_IF_HIPSPARSE_ERROR(amg_spgemm_numeric<T>(
+                handle, level.R.mat, level.AP.mat, coarse.A, level.spgemm_RAP, computeType));
+        }
+
+        // A small coarsest level is solved with its dense inverse, stored as a full matrix
+        if(*coarsest && rows <= descr->coarse_size)
+        {
+            std::vector<T> dense(rows * rows, T(0));
+            for(int64_t i = 0; i < rows; ++i)
+            {
+                for(int k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+                {
+                    dense[i * rows + col_ind[k] - base] += val[k];
+                }
+            }
+
+            if(!amg_invert(rows, dense))
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+
+            std::vector<int> dense_row_ptr(rows + 1);
+            std::vector<int> dense_col_ind(rows * rows);
+            for(int64_t i = 0; i <= rows; ++i)
+            {
+                dense_row_ptr[i] = static_cast<int>(i * rows);
+            }
+
+            for(int64_t k = 0; k < rows * rows; ++k)
+            {
+                dense_col_ind[k] = static_cast<int>(k % rows);
+            }
+
+            return amg_csr_upload(handle,
+                                  level.inverse,
+                                  rows,
+                                  rows,
+                                  dense_row_ptr,
+                                  dense_col_ind,
+                                  dense,
+                                  computeType);
+        }
+
+        if(!reuse)
+        {
+            if(descr->smoother_alg != HIPSPARSE_SMOOTHER_JACOBI)
+            {
+                std::vector<int> colors;
+                level.ncolors = amg_coloring(rows, row_ptr, col_ind, base, colors);
+                RETURN_IF_HIPSPARSE_ERROR(amg_upload(handle, colors, &level.coloring));
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparseSmoother_createDescr(&level.smoother, descr->smoother_alg));
+        }
+
+        return hipsparseSmoother_analysis(handle,
+                                          level.smoother,
+                                          A,
+                                          level.ncolors,
+                                          static_cast<const int*>(level.coloring),
+                                          computeType);
+    }
+
+    //
+    // Vectors of every level and the SpMV buffers of the V-cycle.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_workspace(hipsparseHandle_t          handle,
+                                    hipsparseAmgDescr*         descr,
+                                    hipsparseConstSpMatDescr_t matA,
+                                    hipDataType                computeType)
+    {
+        for(size_t l = 0; l < descr->levels.size(); ++l)
+        {
+            amg_level&    level       = descr->levels[l];
+            const int64_t n           = level.n;
+            const int     num_vectors = (l == 0) ? 1 : 3;
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                amg_malloc(handle, &level.work, sizeof(T) * num_vectors * n));
+            RETURN_IF_HIP_ERROR(hipMemset(level.work, 0, sizeof(T) * num_vectors * n));
+
+            T* work = static_cast<T*>(level.work);
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                hipsparseCreateDnVec(&level.r, n, work + (num_vectors - 1) * n, computeType));
+
+            if(l > 0)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(hipsparseCreateDnVec(&level.b, n, work, computeType));
+                RETURN_IF_HIPSPARSE_ERROR(
+                    hipsparseCreateDnVec(&level.x, n, work + n, computeType));
+            }
+        }
+
+        for(size_t l = 0; l < descr->levels.size(); ++l)
+        {
+            amg_level&                 level = descr->levels[l];
+            hipsparseConstSpMatDescr_t A     = amg_matrix(descr, l, matA);
+
+            // Level 0 multiplies the vectors of the user, the residual stands in for them
+            hipsparseDnVecDescr_t x = (l == 0) ? level.r : level.x;
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                amg_spmv_analysis<T>(handle, A, x, level.r, &level.spmv_A, computeType));
+
+            if(level.inverse.mat != nullptr)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(amg_spmv_analysis<T>(
+                    handle, level.inverse.mat, level.r, x, &level.spmv_inverse, computeType));
+            }
+
+            if(l + 1 < descr->levels.size())
+            {
+                amg_level& coarse = descr->levels[l + 1];
+
+                RETURN_IF_HIPSPARSE_ERROR(amg_spmv_analysis<T>(
+                    handle, level.R.mat, level.r, coarse.b, &level.spmv_R, computeType));
+                RETURN_IF_HIPSPARSE_ERROR(amg_spmv_analysis<T>(
+                    handle, level.P.mat, coarse.x, x, &level.spmv_P, computeType));
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t amg_setup(hipsparseHandle_t          handle,
+                                hipsparseAmgDescr*         descr,
+                                hipsparseConstSpMatDescr_t matA,
+                                hipDataType                computeType,
+                                bool                       reuse)
+    {
+        if(!reuse)
+        {
+            descr->levels.reserve(descr->max_levels);
+            descr->levels.emplace_back();
+        }
+
+        bool coarsest = false;
+        for(size_t l = 0; !coarsest; ++l)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                amg_setup_level<T>(handle, descr, l, matA, computeType, reuse, &coarsest));
+        }
+
+        if(!reuse)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(amg_workspace<T>(handle, descr, matA, computeType));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t amg_smooth(hipsparseHandle_t          handle,
+                                 const hipsparseAmgDescr*   descr,
+                                 const amg_level&           level,
+                                 hipsparseConstSpMatDescr_t A,
+                                 hipsparseConstDnVecDescr_t vecB,
+                                 hipsparseDnVecDescr_t      vecX,
+                                 int                        sweeps,
+                                 hipDataType                computeType)
+    {
+        if(sweeps == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            hipsparseSmoother_setParameters(level.smoother, sweeps, descr->smoother_omega));
+
+        return hipsparseSmoother_smooth(handle, level.smoother, A, vecB, vecX, computeType);
+    }
+
+    //
+    // r = b - A x
+    //
+    template <typename T>
+    hipsparseStatus_t amg_residual(hipsparseHandle_t          handle,
+                                   const amg_level&           level,
+                                   hipsparseConstSpMatDescr_t A,
+                                   const void*                b,
+                                   hipsparseDnVecDescr_t      vecX,
+                                   hipDataType                computeType)
+    {
+        hipStream_t stream;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+        void* r;
+        RETURN_IF_HIPSPARSE_ERROR(hipsparseDnVecGetValues(level.r, &r));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(r, b, sizeof(T) * level.n, hipMemcpyDeviceToDevice, stream));
+
+        return amg_spmv<T>(handle, T(-1), A, vecX, T(1), level.r, level.spmv_A, computeType);
+    }
+
+    //
+    // V-cycle on level l, x := x + correction.
+    //
+    template <typename T>
+    hipsparseStatus_t amg_vcycle(hipsparseHandle_t          handle,
+                                 const hipsparseAmgDescr*   descr,
+                                 size_t                     l,
+                                 hipsparseConstSpMatDescr_t matA,
+                                 hipsparseConstDnVecDescr_t vecB,
+                                 const void*                b,
+                                 hipsparseDnVecDescr_t      vecX,
+                                 hipDataType                computeType)
+    {
+        const amg_level&           level = descr->levels[l];
+        hipsparseConstSpMatDescr_t A     = amg_matrix(descr, l, matA);
+
+        if(level.inverse.mat != nullptr)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(amg_residual<T>(handle, level, A, b, vecX, computeType));
+
+            return amg_spmv<T>(handle,
+                               T(1),
+                               level.inverse.mat,
+                               level.r,
+                               T(1),
+                               vecX,
+                               level.spmv_inverse,
+                               computeType);
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(amg_smooth<T>(
+            handle, descr, level, A, vecB, vecX, descr->pre_sweeps, computeType));
+
+        if(l + 1 < descr->levels.size())
+        {
+            const amg_level& coarse = descr->levels[l + 1];
+
+            hipStream_t stream;
+            RETURN_IF_HIPSPARSE_ERROR(hipsparseGetStream(handle, &stream));
+
+            // Restrict the residual, solve for the correction with a zero initial guess and
+            // prolongate it
+            RETURN_IF_HIPSPARSE_ERROR(amg_residual<T>(handle, level, A, b, vecX, computeType));
+            RETURN_IF_HIPSPARSE_ERROR(amg_spmv<T>(
+                handle, T(1), level.R.mat, level.r, T(0), coarse.b, level.spmv_R, computeType));
+
+            T* coarse_b = static_cast<T*>(coarse.work);
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(coarse_b + coarse.n, 0, sizeof(T) * coarse.n, stream));
+
+            RETURN_IF_HIPSPARSE_ERROR(amg_vcycle<T>(
+                handle, descr, l + 1, matA, coarse.b, coarse_b, coarse.x, computeType));
+
+            RETURN_IF_HIPSPARSE_ERROR(amg_spmv<T>(
+                handle, T(1), level.P.mat, coarse.x, T(1), vecX, level.spmv_P, computeType));
+        }
+
+        return amg_smooth<T>(
+            handle, descr, level, A, vecB, vecX, descr->post_sweeps, computeType);
+    }
+}
+
+hipsparseStatus_t hipsparseAmg_createDescr(hipsparseAmgDescr_t* descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr = new hipsparseAmgDescr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAmg_destroyDescr(hipsparseAmgDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    amg_clear(descr);
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAmg_setParameters(hipsparseAmgDescr_t descr,
+                                             double              strengthThreshold,
+                                             double              prolongatorWeight,
+                                             int                 maxLevels,
+                                             int64_t             coarseSize)
+{
+    if(descr == nullptr || !(strengthThreshold >= 0.0 && strengthThreshold <= 1.0)
+       || !(prolongatorWeight >= 0.0) || maxLevels <= 0 || coarseSize < 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->strength_threshold = strengthThreshold;
+    descr->prolongator_weight = prolongatorWeight;
+    descr->max_levels         = maxLevels;
+    descr->coarse_size        = coarseSize;
+
+    // The hierarchy has to be set up again
+    descr->setup = false;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAmg_setSmoother(hipsparseAmgDescr_t    descr,
+                                           hipsparseSmootherAlg_t alg,
+                                           int                    preSweeps,
+                                           int                    postSweeps,
+                                           double                 omega)
+{
+    if(descr == nullptr || preSweeps < 0 || postSweeps < 0 || !(omega > 0.0))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alg != HIPSPARSE_SMOOTHER_JACOBI && alg != HIPSPARSE_SMOOTHER_GAUSS_SEIDEL
+       && alg != HIPSPARSE_SMOOTHER_SYMMETRIC_GAUSS_SEIDEL && alg != HIPSPARSE_SMOOTHER_SOR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->smoother_alg   = alg;
+    descr->pre_sweeps     = preSweeps;
+    descr->post_sweeps    = postSweeps;
+    descr->smoother_omega = omega;
+
+    // The hierarchy has to be set up again
+    descr->setup = false;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAmg_setup(hipsparseHandle_t          handle,
+                                     hipsparseAmgDescr_t        descr,
+                                     hipsparseConstSpMatDescr_t matA,
+                                     hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, computeType);
+
+    if(handle == nullptr || descr == nullptr || matA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_format(to_rocsparse_const_spmat_descr(matA), &format));
+
+    if(format != rocsparse_format_csr)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          csr_row_ptr;
+    const void*          csr_col_ind;
+    const void*          csr_val;
+    rocsparse_indextype  row_type;
+    rocsparse_indextype  col_type;
+    rocsparse_index_base base;
+    rocsparse_datatype   datatype;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                      &rows,
+                                                      &cols,
+                                                      &nnz,
+                                                      &csr_row_ptr,
+                                                      &csr_col_ind,
+                                                      &csr_val,
+                                                      &row_type,
+                                                      &col_type,
+                                                      &base,
+                                                      &datatype));
+
+    if(rows != cols || datatype != hipsparse::hipDataTypeToHCCDataType(computeType))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(row_type != rocsparse_indextype_i32 || col_type != rocsparse_indextype_i32)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    // Same pattern and parameters as the last setup, only the values are recomputed
+    const bool reuse = descr->setup && descr->n == rows && descr->nnz == nnz
+                       && descr->structure_version == matA->get_structure_version()
+                       && descr->row_ptr == csr_row_ptr && descr->col_ind == csr_col_ind
+                       && descr->datatype == datatype;
+
+    if(!reuse)
+    {
+        amg_clear(descr);
+    }
+
+    descr->setup = false;
+
+    if(rows > 0)
+    {
+        // Allocations and the host computations are kept out of graph captures
+        hipsparse::stream_capture_bypass bypass(handle, true);
+        RETURN_IF_HIPSPARSE_ERROR(bypass.status());
+
+        amg_pointer_mode pointer_mode(handle);
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+        hipsparseStatus_t status;
+        switch(computeType)
+        {
+        case HIP_R_32F:
+            status = amg_setup<float>(handle, descr, matA, computeType, reuse);
+            break;
+        case HIP_R_64F:
+            status = amg_setup<double>(handle, descr, matA, computeType, reuse);
+            break;
+        case HIP_C_32F:
+            status = amg_setup<std::complex<float>>(handle, descr, matA, computeType, reuse);
+            break;
+        case HIP_C_64F:
+            status = amg_setup<std::complex<double>>(handle, descr, matA, computeType, reuse);
+            break;
+        default:
+            status = HIPSPARSE_STATUS_NOT_SUPPORTED;
+            break;
+        }
+
+        // A failed setup does not leave a partial hierarchy behind
+        if(status != HIPSPARSE_STATUS_SUCCESS)
+        {
+            amg_clear(descr);
+
+            return status;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(bypass.finish());
+    }
+    else
+    {
+        descr->levels.resize(1);
+    }
+
+    descr->setup             = true;
+    descr->n                 = rows;
+    descr->nnz               = nnz;
+    descr->structure_version = matA->get_structure_version();
+    descr->row_ptr           = csr_row_ptr;
+    descr->col_ind           = csr_col_ind;
+    descr->datatype          = datatype;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAmg_getLevel(
+    hipsparseAmgDescr_t descr, int level, int* numLevels, int64_t* rows, int64_t* nnz)
+{
+    if(descr == nullptr || numLevels == nullptr || rows == nullptr || nnz == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(!descr->setup || level < 0 || size_t(level) >= descr->levels.size())
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *numLevels = static_cast<int>(descr->levels.size());
+    *rows      = descr->levels[level].n;
+    *nnz       = descr->levels[level].nnz;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseAmg_vcycle(hipsparseHandle_t          handle,
+                                      hipsparseAmgDescr_t        descr,
+                                      hipsparseConstSpMatDescr_t matA,
+                                      hipsparseConstDnVecDescr_t vecB,
+                                      hipsparseDnVecDescr_t      vecX,
+                                      hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, computeType);
+
+    if(handle == nullptr || descr == nullptr || matA == nullptr || vecB == nullptr
+       || vecX == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The hierarchy has to match the matrix
+    if(!descr->setup || descr->structure_version != matA->get_structure_version()
+       || descr->datatype != hipsparse::hipDataTypeToHCCDataType(computeType))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t            rows;
+    int64_t            cols;
+    int64_t            nnz;
+    int64_t            size_b;
+    int64_t            size_x;
+    const void*        b_values;
+    void*              x_values;
+    rocsparse_datatype type_b;
+    rocsparse_datatype type_x;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_size(to_rocsparse_const_spmat_descr(matA), &rows, &cols, &nnz));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecB), &size_b, &b_values, &type_b));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_dnvec_get(to_rocsparse_dnvec_descr(vecX), &size_x, &x_values, &type_x));
+
+    if(rows != descr->n || nnz != descr->nnz || size_b != descr->n || size_x != descr->n
+       || type_b != descr->datatype || type_x != descr->datatype)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(descr->n == 0)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    amg_pointer_mode pointer_mode(handle);
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+        return amg_vcycle<float>(handle, descr, 0, matA, vecB, b_values, vecX, computeType);
+    case HIP_R_64F:
+        return amg_vcycle<double>(handle, descr, 0, matA, vecB, b_values, vecX, computeType);
+    case HIP_C_32F:
+        return amg_vcycle<std::complex<float>>(
+            handle, descr, 0, matA, vecB, b_values, vecX, computeType);
+    case HIP_C_64F:
+        return amg_vcycle<std::complex<double>>(
+            handle, descr, 0, matA, vecB, b_values, vecX, computeType);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
@@ -0,0 +1,1005 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../hipsparse_graph.h"
+#include "../utility.h"
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+struct hipsparseSmootherDescr
+{
+    hipsparseSmootherAlg_t alg{};
+    int                    sweeps{1};
+    double                 omega{1.0};
+
+    // Matrix of the last analysis
+    bool               analyzed{};
+    int64_t            n{};
+    int64_t            nnz{};
+    int64_t            structure_version{};
+    rocsparse_datatype datatype{};
+
+    // Block b holds the permuted rows block_ptr[b] to block_ptr[b + 1] - 1, which are the rows
+    // of one color. The Jacobi method uses a single block of all rows.
+    std::vector<int64_t> block_ptr;
+
+    // permutation[i] is the row of A that is row i of the permuted matrix. indices holds
+    // 0, 1, ..., n and is used as row offsets and column indices of the inverse diagonal.
+    rocsparse_indextype indextype{};
+    void*               permutation{};
+    void*               indices{};
+
+    // Permuted matrix, zero based. The row offsets of every block start at zero, such that
+    // every block is a matrix of its own.
+    void* row_ptr{};
+    void* col_ind{};
+    void* val{};
+    void* inverse_diagonal{};
+
+    std::vector<rocsparse_spmat_descr> blocks;
+    std::vector<rocsparse_spmat_descr> diagonals;
+
+    // Permuted right hand side, permuted solution and residual, a single allocation. The
+    // Jacobi method works on the vectors of the user and stores the residual only.
+    void*                              work{};
+    rocsparse_spvec_descr              b_perm{};
+    rocsparse_spvec_descr              x_perm{};
+    rocsparse_dnvec_descr              x_full{};
+    rocsparse_dnvec_descr              r_full{};
+    std::vector<rocsparse_dnvec_descr> x_blocks;
+    std::vector<rocsparse_dnvec_descr> r_blocks;
+
+    // SpMV buffers of every block and diagonal, a single allocation
+    void*              buffer{};
+    std::vector<void*> block_buffers;
+    std::vector<void*> diagonal_buffers;
+};
+
+namespace
+{
+    //
+    // Restore the pointer mode of the handle on return, the smoother passes its scalars from
+    // the host.
+    //
+    class smoother_pointer_mode
+    {
+        rocsparse_handle       m_handle{};
+        rocsparse_pointer_mode m_mode{rocsparse_pointer_mode_host};
+
+    public:
+        explicit smoother_pointer_mode(hipsparseHandle_t handle)
+            : m_handle((rocsparse_handle)handle)
+        {
+            rocsparse_get_pointer_mode(m_handle, &m_mode);
+        }
+
+        ~smoother_pointer_mode()
+        {
+            rocsparse_set_pointer_mode(m_handle, m_mode);
+        }
+
+        smoother_pointer_mode(const smoother_pointer_mode&)            = delete;
+        smoother_pointer_mode& operator=(const smoother_pointer_mode&) = delete;
+    };
+
+    //
+    // Release everything created by the analysis.
+    //
+    void smoother_clear(hipsparseSmootherDescr* descr)
+    {
+        for(rocsparse_spmat_descr block : descr->blocks)
+        {
+            rocsparse_destroy_spmat_descr(block);
+        }
+
+        for(rocsparse_spmat_descr diagonal : descr->diagonals)
+        {
+            rocsparse_destroy_spmat_descr(diagonal);
+        }
+
+        for(rocsparse_dnvec_descr vector : descr->x_blocks)
+        {
+            rocsparse_destroy_dnvec_descr(vector);
+        }
+
+        for(rocsparse_dnvec_descr vector : descr->r_blocks)
+        {
+            rocsparse_destroy_dnvec_descr(vector);
+        }
+
+        if(descr->b_perm != nullptr)
+        {
+            rocsparse_destroy_spvec_descr(descr->b_perm);
+        }
+
+        if(descr->x_perm != nullptr)
+        {
+            rocsparse_destroy_spvec_descr(descr->x_perm);
+        }
+
+        if(descr->x_full != nullptr)
+        {
+            rocsparse_destroy_dnvec_descr(descr->x_full);
+        }
+
+        if(descr->r_full != nullptr)
+        {
+            rocsparse_destroy_dnvec_descr(descr->r_full);
+        }
+
+        (void)hipFree(descr->permutation);
+        (void)hipFree(descr->indices);
+        (void)hipFree(descr->row_ptr);
+        (void)hipFree(descr->col_ind);
+        (void)hipFree(descr->val);
+        (void)hipFree(descr->inverse_diagonal);
+        (void)hipFree(descr->work);
+        (void)hipFree(descr->buffer);
+
+        descr->analyzed         = false;
+        descr->permutation      = nullptr;
+        descr->indices          = nullptr;
+        descr->row_ptr          = nullptr;
+        descr->col_ind          = nullptr;
+        descr->val              = nullptr;
+        descr->inverse_diagonal = nullptr;
+        descr->work             = nullptr;
+        descr->buffer           = nullptr;
+        descr->b_perm           = nullptr;
+        descr->x_perm           = nullptr;
+        descr->x_full           = nullptr;
+        descr->r_full           = nullptr;
+        descr->block_ptr.clear();
+        descr->blocks.clear();
+        descr->diagonals.clear();
+        descr->x_blocks.clear();
+        descr->r_blocks.clear();
+        descr->block_buffers.clear();
+        descr->diagonal_buffers.clear();
+    }
+
+    hipsparseStatus_t smoother_malloc(hipsparseHandle_t handle, void** ptr, size_t bytes)
+    {
+        hipsparse::count_workspace(handle, bytes);
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, std::max(bytes, sizeof(int64_t))));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Copy an array to the device, converted to the index or value type K.
+    //
+    template <typename K, typename S>
+    hipsparseStatus_t
+        smoother_upload(hipsparseHandle_t handle, const std::vector<S>& host, void** ptr)
+    {
+        std::vector<K> converted(host.begin(), host.end());
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        RETURN_IF_HIPSPARSE_ERROR(smoother_malloc(handle, ptr, sizeof(K) * converted.size()));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(*ptr,
+                                           converted.data(),
+                                           sizeof(K) * converted.size(),
+                                           hipMemcpyHostToDevice,
+                                           stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename S>
+    hipsparseStatus_t smoother_upload_indices(hipsparseHandle_t             handle,
+                                              const hipsparseSmootherDescr* descr,
+                                              const std::vector<S>&         host,
+                                              void**                        ptr)
+    {
+        if(descr->indextype == rocsparse_indextype_i64)
+        {
+            return smoother_upload<int64_t>(handle, host, ptr);
+        }
+
+        return smoother_upload<int32_t>(handle, host, ptr);
+    }
+
+    //
+    // Permute A into contiguous blocks of rows of one color and invert its diagonal. Rows are
+    // sorted by color with a stable counting sort, columns are permuted the same way, such that
+    // the diagonal of every block is the diagonal of A.
+    //
+    template <typename I, typename J, typename T>
+    hipsparseStatus_t smoother_permute(hipsparseHandle_t       handle,
+                                       hipsparseSmootherDescr* descr,
+                                       const void*             csr_row_ptr,
+                                       const void*             csr_col_ind,
+                                       const void*             csr_val,
+                                       rocsparse_index_base    base,
+                                       int                     ncolors,
+                                       const int*              coloring)
+    {
+        const int64_t n   = descr->n;
+        const int64_t nnz = descr->nnz;
+
+        std::vector<I> row_ptr(n + 1);
+        std::vector<J> col_ind(nnz);
+        std::vector<T> val(nnz);
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            row_ptr.data(), csr_row_ptr, sizeof(I) * (n + 1), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            col_ind.data(), csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(val.data(), csr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+        // Rows by color
+        std::vector<int64_t> permutation(n);
+        std::vector<int64_t> block_ptr{0};
+
+        if(descr->alg == HIPSPARSE_SMOOTHER_JACOBI)
+        {
+            std::iota(permutation.begin(), permutation.end(), int64_t(0));
+            block_ptr.push_back(n);
+        }
+        else
+        {
+            std::vector<int> colors(n);
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                colors.data(), coloring, sizeof(int) * n, hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIPSPARSE_ERROR(hipsparse::synchronize_stream(handle, stream));
+
+            std::vector<int64_t> color_ptr(ncolors + 1, 0);
+            for(int64_t i = 0; i < n; ++i)
+            {
+                if(colors[i] < 0 || colors[i] >= ncolors)
+                {
+                    return HIPSPARSE_STATUS_INVALID_VALUE;
+                }
+
+                ++color_ptr[colors[i] + 1];
+            }
+
+            std::partial_sum(color_ptr.begin(), color_ptr.end(), color_ptr.begin());
+
+            std::vector<int64_t> next(color_ptr.begin(), color_ptr.end() - 1);
+            for(int64_t i = 0; i < n; ++i)
+            {
+                permutation[next[colors[i]]++] = i;
+            }
+
+            // Colors without rows do not get a block
+            for(int c = 0; c < ncolors; ++c)
+            {
+                if(color_ptr[c + 1] > color_ptr[c])
+                {
+                    block_ptr.push_back(color_ptr[c + 1]);
+                }
+            }
+        }
+
+        std::vector<int64_t> inverse_permutation(n);
+        for(int64_t i = 0; i < n; ++i)
+        {
+            inverse_permutation[permutation[i]] = i;
+        }
+
+        // Permuted matrix with sorted columns
+        std::vector<int64_t> perm_row_ptr(n + 1, 0);
+        std::vector<J>       perm_col_ind(nnz);
+        std::vector<T>       perm_val(nnz);
+        std::vector<T>       inverse_diagonal(n);
+
+        std::vector<std::pair<int64_t, T>> row;
+        for(int64_t i = 0; i < n; ++i)
+        {
+            const int64_t old_row = permutation[i];
+
+            row.clear();
+            for(int64_t k = row_ptr[old_row] - base; k < row_ptr[old_row + 1] - base; ++k)
+            {
+                row.emplace_back(inverse_permutation[col_ind[k] - base], val[k]);
+            }
+
+            std::sort(row.begin(),
+                      row.end(),
+                      [](const std::pair<int64_t, T>& a, const std::pair<int64_t, T>& b) {
+                          return a.first < b.first;
+                      });
+
+            T       diagonal = T(0);
+            int64_t offset   = perm_row_ptr[i];
+            for(const std::pair<int64_t, T>& entry : row)
+            {
+                perm_col_ind[offset] = static_cast<J>(entry.first);
+                perm_val[offset]     = entry.second;
+                ++offset;
+
+                if(entry.first == i)
+                {
+                    diagonal += entry.second;
+                }
+            }
+
+            if(diagonal == T(0))
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+
+            perm_row_ptr[i + 1] = offset;
+            inverse_diagonal[i] = T(1) / diagonal;
+        }
+
+        // Row offsets of every block, relative to the first entry of the block
+        const int64_t        num_blocks = static_cast<int64_t>(block_ptr.size()) - 1;
+        std::vector<int64_t> block_row_ptr;
+        block_row_ptr.reserve(n + num_blocks);
+        for(int64_t b = 0; b < num_blocks; ++b)
+        {
+            for(int64_t i = block_ptr[b]; i <= block_ptr[b + 1]; ++i)
+            {
+                block_row_ptr.push_back(perm_row_ptr[i] - perm_row_ptr[block_ptr[b]]);
+            }
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(smoother_upload<I>(handle, block_row_ptr, &descr->row_ptr));
+        RETURN_IF_HIPSPARSE_ERROR(smoother_upload<J>(handle, perm_col_ind, &descr->col_ind));
+        RETURN_IF_HIPSPARSE_ERROR(smoother_upload<T>(handle, perm_val, &descr->val));
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_upload<T>(handle, inverse_diagonal, &descr->inverse_diagonal));
+
+        std::vector<int64_t> indices(n + 1);
+        std::iota(indices.begin(), indices.end(), int64_t(0));
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_upload_indices(handle, descr, indices, &descr->indices));
+
+        if(descr->alg != HIPSPARSE_SMOOTHER_JACOBI)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(
+                smoother_upload_indices(handle, descr, permutation, &descr->permutation));
+        }
+
+        // Matrices of every block
+        const rocsparse_indextype row_type
+            = (sizeof(I) == sizeof(int64_t)) ? rocsparse_indextype_i64 : rocsparse_indextype_i32;
+        const rocsparse_indextype col_type
+            = (sizeof(J) == sizeof(int64_t)) ? rocsparse_indextype_i64 : rocsparse_indextype_i32;
+
+        descr->block_ptr = block_ptr;
+        descr->blocks.resize(num_blocks);
+        descr->diagonals.resize(num_blocks);
+
+        for(int64_t b = 0; b < num_blocks; ++b)
+        {
+            const int64_t first = block_ptr[b];
+            const int64_t rows  = block_ptr[b + 1] - first;
+            const int64_t start = perm_row_ptr[first];
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_csr_descr(&descr->blocks[b],
+                                           rows,
+                                           n,
+                                           perm_row_ptr[block_ptr[b + 1]] - start,
+                                           static_cast<I*>(descr->row_ptr) + first + b,
+                                           static_cast<J*>(descr->col_ind) + start,
+                                           static_cast<T*>(descr->val) + start,
+                                           row_type,
+                                           col_type,
+                                           rocsparse_index_base_zero,
+                                           descr->datatype));
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_csr_descr(&descr->diagonals[b],
+                                           rows,
+                                           rows,
+                                           rows,
+                                           descr->indices,
+                                           descr->indices,
+                                           static_cast<T*>(descr->inverse_diagonal) + first,
+                                           descr->indextype,
+                                           descr->indextype,
+                                           rocsparse_index_base_zero,
+                                           descr->datatype));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Workspace vectors and SpMV buffers of every block.
+    //
+    template <typename T>
+    hipsparseStatus_t smoother_workspace(hipsparseHandle_t handle, hipsparseSmootherDescr* descr)
+    {
+        const int64_t n          = descr->n;
+        const int64_t num_blocks = static_cast<int64_t>(descr->blocks.size());
+        const bool    jacobi     = (descr->alg == HIPSPARSE_SMOOTHER_JACOBI);
+
+        // b, x and r, or r only
+        const int num_vectors = jacobi ? 1 : 3;
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_malloc(handle, &descr->work, sizeof(T) * num_vectors * n));
+        RETURN_IF_HIP_ERROR(hipMemset(descr->work, 0, sizeof(T) * num_vectors * n));
+
+        T* r = static_cast<T*>(descr->work) + (num_vectors - 1) * n;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_dnvec_descr(&descr->r_full, n, r, descr->datatype));
+
+        if(!jacobi)
+        {
+            T* b = static_cast<T*>(descr->work);
+            T* x = static_cast<T*>(descr->work) + n;
+
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_dnvec_descr(&descr->x_full, n, x, descr->datatype));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_spvec_descr(&descr->b_perm,
+                                                                   n,
+                                                                   n,
+                                                                   descr->permutation,
+                                                                   b,
+                                                                   descr->indextype,
+                                                                   rocsparse_index_base_zero,
+                                                                   descr->datatype));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_spvec_descr(&descr->x_perm,
+                                                                   n,
+                                                                   n,
+                                                                   descr->permutation,
+                                                                   x,
+                                                                   descr->indextype,
+                                                                   rocsparse_index_base_zero,
+                                                                   descr->datatype));
+
+            descr->x_blocks.resize(num_blocks);
+            descr->r_blocks.resize(num_blocks);
+            for(int64_t b_idx = 0; b_idx < num_blocks; ++b_idx)
+            {
+                const int64_t first = descr->block_ptr[b_idx];
+                const int64_t rows  = descr->block_ptr[b_idx + 1] - first;
+
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_dnvec_descr(
+                    &descr->x_blocks[b_idx], rows, x + first, descr->datatype));
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_dnvec_descr(
+                    &descr->r_blocks[b_idx], rows, r + first, descr->datatype));
+            }
+        }
+
+        // The Jacobi method multiplies the vectors of the user, the residual stands in for
+        // them during the analysis
+        rocsparse_dnvec_descr x_full = jacobi ? descr->r_full : descr->x_full;
+
+        const T one  = T(1);
+        const T zero = T(0);
+
+        std::vector<size_t> block_sizes(num_blocks);
+        std::vector<size_t> diagonal_sizes(num_blocks);
+        size_t              total_size = 0;
+
+        for(int64_t b = 0; b < num_blocks; ++b)
+        {
+            rocsparse_dnvec_descr r_block = jacobi ? descr->r_full : descr->r_blocks[b];
+            rocsparse_dnvec_descr x_block = jacobi ? descr->r_full : descr->x_blocks[b];
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                     rocsparse_operation_none,
+                                                     &one,
+                                                     descr->blocks[b],
+                                                     x_full,
+                                                     &zero,
+                                                     r_block,
+                                                     descr->datatype,
+                                                     rocsparse_spmv_alg_csr_stream,
+                                                     rocsparse_spmv_stage_buffer_size,
+                                                     &block_sizes[b],
+                                                     nullptr));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                     rocsparse_operation_none,
+                                                     &one,
+                                                     descr->diagonals[b],
+                                                     r_block,
+                                                     &zero,
+                                                     x_block,
+                                                     descr->datatype,
+                                                     rocsparse_spmv_alg_csr_stream,
+                                                     rocsparse_spmv_stage_buffer_size,
+                                                     &diagonal_sizes[b],
+                                                     nullptr));
+
+            // Keep every buffer aligned
+            block_sizes[b]    = ((std::max(block_sizes[b], size_t(1)) - 1) / 256 + 1) * 256;
+            diagonal_sizes[b] = ((std::max(diagonal_sizes[b], size_t(1)) - 1) / 256 + 1) * 256;
+            total_size += block_sizes[b] + diagonal_sizes[b];
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(smoother_malloc(handle, &descr->buffer, total_size));
+
+        descr->block_buffers.resize(num_blocks);
+        descr->diagonal_buffers.resize(num_blocks);
+
+        char* buffer = static_cast<char*>(descr->buffer);
+        for(int64_t b = 0; b < num_blocks; ++b)
+        {
+            rocsparse_dnvec_descr r_block = jacobi ? descr->r_full : descr->r_blocks[b];
+            rocsparse_dnvec_descr x_block = jacobi ? descr->r_full : descr->x_blocks[b];
+
+            descr->block_buffers[b] = buffer;
+            buffer += block_sizes[b];
+            descr->diagonal_buffers[b] = buffer;
+            buffer += diagonal_sizes[b];
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                     rocsparse_operation_none,
+                                                     &one,
+                                                     descr->blocks[b],
+                                                     x_full,
+                                                     &zero,
+                                                     r_block,
+                                                     descr->datatype,
+                                                     rocsparse_spmv_alg_csr_stream,
+                                                     rocsparse_spmv_stage_preprocess,
+                                                     &block_sizes[b],
+                                                     descr->block_buffers[b]));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                     rocsparse_operation_none,
+                                                     &one,
+                                                     descr->diagonals[b],
+                                                     r_block,
+                                                     &zero,
+                                                     x_block,
+                                                     descr->datatype,
+                                                     rocsparse_spmv_alg_csr_stream,
+                                                     rocsparse_spmv_stage_preprocess,
+                                                     &diagonal_sizes[b],
+                                                     descr->diagonal_buffers[b]));
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t smoother_analysis(hipsparseHandle_t          handle,
+                                        hipsparseSmootherDescr*    descr,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        int                        ncolors,
+                                        const int*                 coloring)
+    {
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        const void*          csr_row_ptr;
+        const void*          csr_col_ind;
+        const void*          csr_val;
+        rocsparse_indextype  row_type;
+        rocsparse_indextype  col_type;
+        rocsparse_index_base base;
+        rocsparse_datatype   datatype;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                          &rows,
+                                                          &cols,
+                                                          &nnz,
+                                                          &csr_row_ptr,
+                                                          &csr_col_ind,
+                                                          &csr_val,
+                                                          &row_type,
+                                                          &col_type,
+                                                          &base,
+                                                          &datatype));
+
+        descr->n                 = rows;
+        descr->nnz               = nnz;
+        descr->structure_version = matA->get_structure_version();
+        descr->datatype          = datatype;
+        descr->indextype         = (rows + 1 > std::numeric_limits<int32_t>::max())
+                                       ? rocsparse_indextype_i64
+                                       : rocsparse_indextype_i32;
+
+        if(row_type == rocsparse_indextype_i32 && col_type == rocsparse_indextype_i32)
+        {
+            RETURN_IF_HIPSPARSE_ERROR((smoother_permute<int32_t, int32_t, T>(
+                handle, descr, csr_row_ptr, csr_col_ind, csr_val, base, ncolors, coloring)));
+        }
+        else if(row_type == rocsparse_indextype_i64 && col_type == rocsparse_indextype_i32)
+        {
+            RETURN_IF_HIPSPARSE_ERROR((smoother_permute<int64_t, int32_t, T>(
+                handle, descr, csr_row_ptr, csr_col_ind, csr_val, base, ncolors, coloring)));
+        }
+        else if(row_type == rocsparse_indextype_i64 && col_type == rocsparse_indextype_i64)
+        {
+            RETURN_IF_HIPSPARSE_ERROR((smoother_permute<int64_t, int64_t, T>(
+                handle, descr, csr_row_ptr, csr_col_ind, csr_val, base, ncolors, coloring)));
+        }
+        else
+        {
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(smoother_workspace<T>(handle, descr));
+
+        descr->analyzed = true;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Relax the rows of one block, x_c := x_c + omega D_c^{-1} (b_c - A_c x).
+    //
+    template <typename T>
+    hipsparseStatus_t smoother_relax(hipsparseHandle_t             handle,
+                                     const hipsparseSmootherDescr* descr,
+                                     int64_t                       block,
+                                     const T*                      b,
+                                     rocsparse_dnvec_descr         x,
+                                     rocsparse_dnvec_descr         x_block,
+                                     rocsparse_dnvec_descr         r_block,
+                                     T                             omega)
+    {
+        const int64_t first = descr->block_ptr[block];
+        const int64_t rows  = descr->block_ptr[block + 1] - first;
+
+        const T minus_one = T(-1);
+        const T one       = T(1);
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        int64_t            size;
+        void*              r;
+        rocsparse_datatype datatype;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_dnvec_get(r_block, &size, &r, &datatype));
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(r, b + first, sizeof(T) * rows, hipMemcpyDeviceToDevice, stream));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &minus_one,
+                                                 descr->blocks[block],
+                                                 x,
+                                                 &one,
+                                                 r_block,
+                                                 descr->datatype,
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_compute,
+                                                 nullptr,
+                                                 descr->block_buffers[block]));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &omega,
+                                                 descr->diagonals[block],
+                                                 r_block,
+                                                 &one,
+                                                 x_block,
+                                                 descr->datatype,
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_compute,
+                                                 nullptr,
+                                                 descr->diagonal_buffers[block]));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t smoother_smooth(hipsparseHandle_t             handle,
+                                      const hipsparseSmootherDescr* descr,
+                                      hipsparseConstDnVecDescr_t    vecB,
+                                      const void*                   b_values,
+                                      hipsparseDnVecDescr_t         vecX)
+    {
+        // Gauss-Seidel is SOR without relaxation
+        const T omega
+            = (descr->alg == HIPSPARSE_SMOOTHER_JACOBI || descr->alg == HIPSPARSE_SMOOTHER_SOR)
+                  ? T(descr->omega)
+                  : T(1);
+
+        if(descr->sweeps == 0)
+        {
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // The Jacobi method updates all rows from the previous iterate at once, in the order of
+        // the user
+        if(descr->alg == HIPSPARSE_SMOOTHER_JACOBI)
+        {
+            rocsparse_dnvec_descr x = to_rocsparse_dnvec_descr(vecX);
+
+            for(int sweep = 0; sweep < descr->sweeps; ++sweep)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(smoother_relax<T>(handle,
+                                                            descr,
+                                                            0,
+                                                            static_cast<const T*>(b_values),
+                                                            x,
+                                                            x,
+                                                            descr->r_full,
+                                                            omega));
+            }
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Permute b and x into the order of the colors
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gather(
+            (rocsparse_handle)handle, to_rocsparse_const_dnvec_descr(vecB), descr->b_perm));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gather(
+            (rocsparse_handle)handle, to_rocsparse_const_dnvec_descr(vecX), descr->x_perm));
+
+        const T*      b          = static_cast<const T*>(descr->work);
+        const int64_t num_blocks = static_cast<int64_t>(descr->blocks.size());
+
+        for(int sweep = 0; sweep < descr->sweeps; ++sweep)
+        {
+            for(int64_t block = 0; block < num_blocks; ++block)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(smoother_relax<T>(handle,
+                                                            descr,
+                                                            block,
+                                                            b,
+                                                            descr->x_full,
+                                                            descr->x_blocks[block],
+                                                            descr->r_blocks[block],
+                                                            omega));
+            }
+
+            // The backward sweep skips the last color, the rows of a color do not depend on
+            // each other and relaxing them twice in a row does not change them
+            if(descr->alg == HIPSPARSE_SMOOTHER_SYMMETRIC_GAUSS_SEIDEL)
+            {
+                for(int64_t block = num_blocks - 2; block >= 0; --block)
+                {
+                    RETURN_IF_HIPSPARSE_ERROR(smoother_relax<T>(handle,
+                                                                descr,
+                                                                block,
+                                                                b,
+                                                                descr->x_full,
+                                                                descr->x_blocks[block],
+                                                                descr->r_blocks[block],
+                                                                omega));
+                }
+            }
+        }
+
+        // Permute x back into the order of the user
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_scatter(
+            (rocsparse_handle)handle, descr->x_perm, to_rocsparse_dnvec_descr(vecX)));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+}
+
+hipsparseStatus_t hipsparseSmoother_createDescr(hipsparseSmootherDescr_t* descr,
+                                                hipsparseSmootherAlg_t    alg)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alg != HIPSPARSE_SMOOTHER_JACOBI && alg != HIPSPARSE_SMOOTHER_GAUSS_SEIDEL
+       && alg != HIPSPARSE_SMOOTHER_SYMMETRIC_GAUSS_SEIDEL && alg != HIPSPARSE_SMOOTHER_SOR)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr        = new hipsparseSmootherDescr;
+    (*descr)->alg = alg;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSmoother_destroyDescr(hipsparseSmootherDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    smoother_clear(descr);
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparseSmoother_setParameters(hipsparseSmootherDescr_t descr, int sweeps, double omega)
+{
+    if(descr == nullptr || sweeps < 0 || !(omega > 0.0))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    descr->sweeps = sweeps;
+    descr->omega  = omega;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSmoother_analysis(hipsparseHandle_t          handle,
+                                             hipsparseSmootherDescr_t   descr,
+                                             hipsparseConstSpMatDescr_t matA,
+                                             int                        ncolors,
+                                             const int*                 coloring,
+                                             hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, ncolors, computeType);
+
+    if(handle == nullptr || descr == nullptr || matA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The Jacobi method does not need a coloring
+    if(descr->alg != HIPSPARSE_SMOOTHER_JACOBI && (coloring == nullptr || ncolors <= 0))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_format(to_rocsparse_const_spmat_descr(matA), &format));
+
+    if(format != rocsparse_format_csr)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          csr_row_ptr;
+    const void*          csr_col_ind;
+    const void*          csr_val;
+    rocsparse_indextype  row_type;
+    rocsparse_indextype  col_type;
+    rocsparse_index_base base;
+    rocsparse_datatype   datatype;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                      &rows,
+                                                      &cols,
+                                                      &nnz,
+                                                      &csr_row_ptr,
+                                                      &csr_col_ind,
+                                                      &csr_val,
+                                                      &row_type,
+                                                      &col_type,
+                                                      &base,
+                                                      &datatype));
+
+    if(rows != cols || datatype != hipsparse::hipDataTypeToHCCDataType(computeType))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    smoother_clear(descr);
+
+    // Allocations and the host permutation are kept out of graph captures
+    hipsparse::stream_capture_bypass bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(bypass.status());
+
+    smoother_pointer_mode pointer_mode(handle);
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_analysis<float>(handle, descr, matA, ncolors, coloring));
+        break;
+    case HIP_R_64F:
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_analysis<double>(handle, descr, matA, ncolors, coloring));
+        break;
+    case HIP_C_32F:
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_analysis<std::complex<float>>(handle, descr, matA, ncolors, coloring));
+        break;
+    case HIP_C_64F:
+        RETURN_IF_HIPSPARSE_ERROR(
+            smoother_analysis<std::complex<double>>(handle, descr, matA, ncolors, coloring));
+        break;
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(bypass.finish());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSmoother_smooth(hipsparseHandle_t          handle,
+                                           hipsparseSmootherDescr_t   descr,
+                                           hipsparseConstSpMatDescr_t matA,
+                                           hipsparseConstDnVecDescr_t vecB,
+                                           hipsparseDnVecDescr_t      vecX,
+                                           hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, computeType);
+
+    if(handle == nullptr || descr == nullptr || matA == nullptr || vecB == nullptr
+       || vecX == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The analysis has to match the matrix
+    if(!descr->analyzed || descr->structure_version != matA->get_structure_version()
+       || descr->datatype != hipsparse::hipDataTypeToHCCDataType(computeType))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t            rows;
+    int64_t            cols;
+    int64_t            nnz;
+    int64_t            size_b;
+    int64_t            size_x;
+    const void*        b_values;
+    void*              x_values;
+    rocsparse_datatype type_b;
+    rocsparse_datatype type_x;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_size(to_rocsparse_const_spmat_descr(matA), &rows, &cols, &nnz));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecB), &size_b, &b_values, &type_b));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_dnvec_get(to_rocsparse_dnvec_descr(vecX), &size_x, &x_values, &type_x));
+
+    if(rows != descr->n || nnz != descr->nnz || size_b != descr->n || size_x != descr->n
+       || type_b != descr->datatype || type_x != descr->datatype)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    smoother_pointer_mode pointer_mode(handle);
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+        return smoother_smooth<float>(handle, descr, vecB, b_values, vecX);
+    case HIP_R_64F:
+        return smoother_smooth<double>(handle, descr, vecB, b_values, vecX);
+    case HIP_C_32F:
+        return smoother_smooth<std::complex<float>>(handle, descr, vecB, b_values, vecX);
+    case HIP_C_64F:
+        return smoother_smooth<std::complex<double>>(handle, descr, vecB, b_values, vecX);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
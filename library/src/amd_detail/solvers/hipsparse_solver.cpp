@@ -0,0 +1,2186 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipsparse.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocsparse/rocsparse.h>
+
+#include "../hipsparse_graph.h"
+#include "../utility.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+//
+// Dense vector of the solver workspace. rocSPARSE computes dot products and axpby of sparse with
+// dense vectors only, every vector is therefore described as a dense vector and as a sparse
+// vector with all entries stored.
+//
+struct hipsparseSolverVector
+{
+    void*                 values{};
+    rocsparse_dnvec_descr dnvec{};
+    rocsparse_spvec_descr spvec{};
+};
+
+struct hipsparseSolverDescr
+{
+    hipsparseSolverAlg_t     alg{};
+    hipsparseSolverPrecond_t precond{};
+    int                      max_iterations{1000};
+    double                   tolerance{1e-6};
+    int                      restart{30};
+
+    // Matrix of the last analysis
+    bool                 analyzed{};
+    int64_t              n{};
+    int64_t              nnz{};
+    int64_t              structure_version{};
+    rocsparse_datatype   datatype{};
+    rocsparse_index_base base{};
+    size_t               value_size{};
+
+    // 0, 1, ..., n, used as indices of the workspace vectors and of the Jacobi matrix
+    rocsparse_indextype indextype{};
+    void*               indices{};
+
+    // Workspace vectors, a single allocation
+    void*                              work{};
+    std::vector<hipsparseSolverVector> vectors;
+
+    // Device scalars, see solver_scalar
+    int   num_scalars{};
+    void* scalars{};
+
+    // Division of device scalars, a triangular solve with the 1 x 1 matrix of the divisor slot
+    rocsparse_spmat_descr scalar_mat{};
+    rocsparse_dnvec_descr scalar_x{};
+    rocsparse_dnvec_descr scalar_y{};
+    size_t                scalar_buffer_size{};
+    void*                 scalar_buffer{};
+
+    size_t spvv_buffer_size{};
+    void*  spvv_buffer{};
+    size_t spmv_buffer_size{};
+    void*  spmv_buffer{};
+
+    // Preconditioner. Jacobi stores the inverse diagonal as diagonal matrix L. ILU0 stores the
+    // unit lower factor L and the upper factor U, IC0 stores the lower factor L twice for the
+    // solves with L and L^H.
+    void*                 precond_val{};
+    rocsparse_spmat_descr precond_L{};
+    rocsparse_spmat_descr precond_U{};
+    size_t                precond_buffer_size_L{};
+    void*                 precond_buffer_L{};
+    size_t                precond_buffer_size_U{};
+    void*                 precond_buffer_U{};
+
+    // Convergence of the last solve
+    int                 iterations{};
+    double              residual{};
+    bool                converged{};
+    std::vector<double> history;
+};
+
+namespace
+{
+    //
+    // Restore the pointer mode of the handle on return. The solver switches between host
+    // scalars for vector updates and device scalars for dot products.
+    //
+    class solver_pointer_mode
+    {
+        rocsparse_handle       m_handle{};
+        rocsparse_pointer_mode m_mode{rocsparse_pointer_mode_host};
+
+    public:
+        explicit solver_pointer_mode(hipsparseHandle_t handle)
+            : m_handle((rocsparse_handle)handle)
+        {
+            rocsparse_get_pointer_mode(m_handle, &m_mode);
+        }
+
+        ~solver_pointer_mode()
+        {
+            rocsparse_set_pointer_mode(m_handle, m_mode);
+        }
+
+        solver_pointer_mode(const solver_pointer_mode&)            = delete;
+        solver_pointer_mode& operator=(const solver_pointer_mode&) = delete;
+    };
+
+    //
+    // Destroy the descriptors of a solver vector on return.
+    //
+    class solver_vector_guard
+    {
+        hipsparseSolverVector& m_vector;
+
+    public:
+        explicit solver_vector_guard(hipsparseSolverVector& vector)
+            : m_vector(vector)
+        {
+        }
+
+        ~solver_vector_guard()
+        {
+            if(m_vector.dnvec != nullptr)
+            {
+                rocsparse_destroy_dnvec_descr(m_vector.dnvec);
+            }
+
+            if(m_vector.spvec != nullptr)
+            {
+                rocsparse_destroy_spvec_descr(m_vector.spvec);
+            }
+        }
+
+        solver_vector_guard(const solver_vector_guard&)            = delete;
+        solver_vector_guard& operator=(const solver_vector_guard&) = delete;
+    };
+
+    //
+    // Scalar arithmetic on the host.
+    //
+    template <typename T>
+    struct solver_traits;
+
+    template <>
+    struct solver_traits<float>
+    {
+        using real_type      = float;
+        using rocsparse_type = float;
+
+        static constexpr auto csrilu0_buffer_size = rocsparse_scsrilu0_buffer_size;
+        static constexpr auto csrilu0_analysis    = rocsparse_scsrilu0_analysis;
+        static constexpr auto csrilu0             = rocsparse_scsrilu0;
+        static constexpr auto csric0_buffer_size  = rocsparse_scsric0_buffer_size;
+        static constexpr auto csric0_analysis     = rocsparse_scsric0_analysis;
+        static constexpr auto csric0              = rocsparse_scsric0;
+    };
+
+    template <>
+    struct solver_traits<double>
+    {
+        using real_type      = double;
+        using rocsparse_type = double;
+
+        static constexpr auto csrilu0_buffer_size = rocsparse_dcsrilu0_buffer_size;
+        static constexpr auto csrilu0_analysis    = rocsparse_dcsrilu0_analysis;
+        static constexpr auto csrilu0             = rocsparse_dcsrilu0;
+        static constexpr auto csric0_buffer_size  = rocsparse_dcsric0_buffer_size;
+        static constexpr auto csric0_analysis     = rocsparse_dcsric0_analysis;
+        static constexpr auto csric0              = rocsparse_dcsric0;
+    };
+
+    template <>
+    struct solver_traits<std::complex<float>>
+    {
+        using real_type      = float;
+        using rocsparse_type = rocsparse_float_complex;
+
+        static constexpr auto csrilu0_buffer_size = rocsparse_ccsrilu0_buffer_size;
+        static constexpr auto csrilu0_analysis    = rocsparse_ccsrilu0_analysis;
+        static constexpr auto csrilu0             = rocsparse_ccsrilu0;
+        static constexpr auto csric0_buffer_size  = rocsparse_ccsric0_buffer_size;
+        static constexpr auto csric0_analysis     = rocsparse_ccsric0_analysis;
+        static constexpr auto csric0              = rocsparse_ccsric0;
+    };
+
+    template <>
+    struct solver_traits<std::complex<double>>
+    {
+        using real_type      = double;
+        using rocsparse_type = rocsparse_double_complex;
+
+        static constexpr auto csrilu0_buffer_size = rocsparse_zcsrilu0_buffer_size;
+        static constexpr auto csrilu0_analysis    = rocsparse_zcsrilu0_analysis;
+        static constexpr auto csrilu0             = rocsparse_zcsrilu0;
+        static constexpr auto csric0_buffer_size  = rocsparse_zcsric0_buffer_size;
+        static constexpr auto csric0_analysis     = rocsparse_zcsric0_analysis;
+        static constexpr auto csric0              = rocsparse_zcsric0;
+    };
+
+    template <typename T>
+    inline T solver_conj(T value)
+    {
+        return value;
+    }
+
+    template <typename T>
+    inline std::complex<T> solver_conj(std::complex<T> value)
+    {
+        return std::conj(value);
+    }
+
+    inline bool solver_is_complex(rocsparse_datatype datatype)
+    {
+        return datatype == rocsparse_datatype_f32_c || datatype == rocsparse_datatype_f64_c;
+    }
+
+    inline size_t solver_value_size(rocsparse_datatype datatype)
+    {
+        switch(datatype)
+        {
+        case rocsparse_datatype_f32_r:
+            return sizeof(float);
+        case rocsparse_datatype_f64_r:
+            return sizeof(double);
+        case rocsparse_datatype_f32_c:
+            return sizeof(std::complex<float>);
+        case rocsparse_datatype_f64_c:
+            return sizeof(std::complex<double>);
+        default:
+            return 0;
+        }
+    }
+
+    //
+    // Slots of the device scalars. CG and BiCGStab keep their step lengths on the device, the
+    // free slots hold the dot products that are read back.
+    //
+    enum solver_scalar
+    {
+        solver_scalar_one = 0,
+        solver_scalar_minus_one,
+        solver_scalar_divisor,
+        solver_scalar_rho,
+        solver_scalar_rho_new,
+        solver_scalar_alpha,
+        solver_scalar_minus_alpha,
+        solver_scalar_omega,
+        solver_scalar_minus_omega,
+        solver_scalar_beta,
+        solver_scalar_quotient,
+        solver_scalar_dot_0,
+        solver_scalar_dot_1,
+        solver_scalar_free
+    };
+
+    //
+    // Number of CG and BiCGStab iterations whose relative residuals are read back at once.
+    //
+    constexpr int solver_check_interval = 4;
+
+    //
+    // Number of workspace vectors, the ILU0 and IC0 solves need an intermediate vector.
+    //
+    inline int solver_num_vectors(const hipsparseSolverDescr* descr)
+    {
+        int num_vectors = 0;
+
+        switch(descr->alg)
+        {
+        case HIPSPARSE_SOLVER_CG:
+            // r, z, p, q and the iterate of the last check
+            num_vectors = 5;
+            break;
+        case HIPSPARSE_SOLVER_BICGSTAB:
+            // r, r0, p, v, s, t, phat, shat and the iterate of the last check
+            num_vectors = 9;
+            break;
+        case HIPSPARSE_SOLVER_GMRES:
+            // r, w, z, V_0, ..., V_restart
+            num_vectors = 3 + descr->restart + 1;
+            break;
+        }
+
+        if(descr->precond == HIPSPARSE_SOLVER_PRECOND_ILU0
+           || descr->precond == HIPSPARSE_SOLVER_PRECOND_IC0)
+        {
+            ++num_vectors;
+        }
+
+        return num_vectors;
+    }
+
+    //
+    // Release everything created by the analysis.
+    //
+    void solver_clear(hipsparseSolverDescr* descr)
+    {
+        for(hipsparseSolverVector& vector : descr->vectors)
+        {
+            rocsparse_destroy_dnvec_descr(vector.dnvec);
+            rocsparse_destroy_spvec_descr(vector.spvec);
+        }
+
+        descr->vectors.clear();
+
+        if(descr->precond_L != nullptr)
+        {
+            rocsparse_destroy_spmat_descr(descr->precond_L);
+        }
+
+        if(descr->precond_U != nullptr)
+        {
+            rocsparse_destroy_spmat_descr(descr->precond_U);
+        }
+
+        if(descr->scalar_mat != nullptr)
+        {
+            rocsparse_destroy_spmat_descr(descr->scalar_mat);
+        }
+
+        if(descr->scalar_x != nullptr)
+        {
+            rocsparse_destroy_dnvec_descr(descr->scalar_x);
+        }
+
+        if(descr->scalar_y != nullptr)
+        {
+            rocsparse_destroy_dnvec_descr(descr->scalar_y);
+        }
+
+        (void)hipFree(descr->indices);
+        (void)hipFree(descr->work);
+        (void)hipFree(descr->scalars);
+        (void)hipFree(descr->scalar_buffer);
+        (void)hipFree(descr->spvv_buffer);
+        (void)hipFree(descr->spmv_buffer);
+        (void)hipFree(descr->precond_val);
+        (void)hipFree(descr->precond_buffer_L);
+        (void)hipFree(descr->precond_buffer_U);
+
+        descr->analyzed              = false;
+        descr->indices               = nullptr;
+        descr->work                  = nullptr;
+        descr->scalars               = nullptr;
+        descr->scalar_mat            = nullptr;
+        descr->scalar_x              = nullptr;
+        descr->scalar_y              = nullptr;
+        descr->scalar_buffer         = nullptr;
+        descr->spvv_buffer           = nullptr;
+        descr->spmv_buffer           = nullptr;
+        descr->precond_val           = nullptr;
+        descr->precond_L             = nullptr;
+        descr->precond_U             = nullptr;
+        descr->precond_buffer_L      = nullptr;
+        descr->precond_buffer_U      = nullptr;
+        descr->spvv_buffer_size      = 0;
+        descr->spmv_buffer_size      = 0;
+        descr->scalar_buffer_size    = 0;
+        descr->precond_buffer_size_L = 0;
+        descr->precond_buffer_size_U = 0;
+    }
+
+    hipsparseStatus_t solver_malloc(hipsparseHandle_t handle, void** ptr, size_t bytes)
+    {
+        hipsparse::count_workspace(handle, bytes);
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, bytes));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    hipsparseStatus_t solver_synchronize(hipsparseHandle_t handle)
+    {
+        hipStream_t stream{};
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        hipsparse::count_synchronization(handle);
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Index sequence 0, 1, ..., size - 1. The 32 bit sequence is generated on the device, the
+    // 64 bit sequence of very large systems is uploaded on the handle stream.
+    //
+    hipsparseStatus_t solver_fill_indices(hipsparseHandle_t   handle,
+                                          rocsparse_indextype indextype,
+                                          int64_t             size,
+                                          void*               indices)
+    {
+        if(indextype == rocsparse_indextype_i32)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_create_identity_permutation((rocsparse_handle)handle,
+                                                      static_cast<rocsparse_int>(size),
+                                                      static_cast<rocsparse_int*>(indices)));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        std::vector<int64_t> host_indices(size);
+        std::iota(host_indices.begin(), host_indices.end(), int64_t(0));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(indices,
+                                           host_indices.data(),
+                                           sizeof(int64_t) * size,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        // The host sequence has to outlive the copy
+        return solver_synchronize(handle);
+    }
+
+    hipsparseStatus_t solver_create_vector(const hipsparseSolverDescr* descr,
+                                           void*                       values,
+                                           hipsparseSolverVector*      vector)
+    {
+        vector->values = values;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_dnvec_descr(&vector->dnvec, descr->n, values, descr->datatype));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_spvec_descr(&vector->spvec,
+                                                               descr->n,
+                                                               descr->n,
+                                                               descr->indices,
+                                                               values,
+                                                               descr->indextype,
+                                                               rocsparse_index_base_zero,
+                                                               descr->datatype));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Position of the diagonal entry of every row, -1 if it is not stored.
+    //
+    template <typename I, typename J>
+    hipsparseStatus_t solver_diagonal_positions(hipsparseHandle_t     handle,
+                                                int64_t               n,
+                                                int64_t               nnz,
+                                                const void*           csr_row_ptr,
+                                                const void*           csr_col_ind,
+                                                rocsparse_index_base  base,
+                                                std::vector<int64_t>& positions)
+    {
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        std::vector<I> row_ptr(n + 1);
+        std::vector<J> col_ind(nnz);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_ptr.data(),
+                                           csr_row_ptr,
+                                           sizeof(I) * (n + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            col_ind.data(), csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(solver_synchronize(handle));
+
+        positions.assign(n, -1);
+
+        for(int64_t i = 0; i < n; ++i)
+        {
+            for(int64_t k = row_ptr[i] - base; k < row_ptr[i + 1] - base; ++k)
+            {
+                if(static_cast<int64_t>(col_ind[k] - base) == i)
+                {
+                    positions[i] = k;
+                    break;
+                }
+            }
+        }
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Jacobi preconditioner, the inverse diagonal is stored as diagonal CSR matrix that shares
+    // its row offsets and column indices with the index sequence of the workspace vectors.
+    //
+    template <typename T>
+    hipsparseStatus_t solver_analysis_jacobi(hipsparseHandle_t           handle,
+                                             hipsparseSolverDescr*       descr,
+                                             const std::vector<int64_t>& positions,
+                                             const void*                 csr_val)
+    {
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        std::vector<T> val(descr->nnz);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            val.data(), csr_val, sizeof(T) * descr->nnz, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIPSPARSE_ERROR(solver_synchronize(handle));
+
+        std::vector<T> inverse_diagonal(descr->n);
+        for(int64_t i = 0; i < descr->n; ++i)
+        {
+            if(positions[i] == -1 || val[positions[i]] == T(0))
+            {
+                return HIPSPARSE_STATUS_ZERO_PIVOT;
+            }
+
+            inverse_diagonal[i] = T(1) / val[positions[i]];
+        }
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->precond_val, sizeof(T) * std::max(descr->n, int64_t(1))));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(descr->precond_val,
+                                           inverse_diagonal.data(),
+                                           sizeof(T) * descr->n,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr_descr(&descr->precond_L,
+                                                             descr->n,
+                                                             descr->n,
+                                                             descr->n,
+                                                             descr->indices,
+                                                             descr->indices,
+                                                             descr->precond_val,
+                                                             descr->indextype,
+                                                             descr->indextype,
+                                                             rocsparse_index_base_zero,
+                                                             descr->datatype));
+
+        const T one  = T(1);
+        const T zero = T(0);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &one,
+                                                 descr->precond_L,
+                                                 descr->vectors[0].dnvec,
+                                                 &zero,
+                                                 descr->vectors[1].dnvec,
+                                                 descr->datatype,
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_buffer_size,
+                                                 &descr->precond_buffer_size_L,
+                                                 nullptr));
+
+        descr->precond_buffer_size_L = std::max(descr->precond_buffer_size_L, sizeof(int64_t));
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->precond_buffer_L, descr->precond_buffer_size_L));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &one,
+                                                 descr->precond_L,
+                                                 descr->vectors[0].dnvec,
+                                                 &zero,
+                                                 descr->vectors[1].dnvec,
+                                                 descr->datatype,
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_preprocess,
+                                                 &descr->precond_buffer_size_L,
+                                                 descr->precond_buffer_L));
+
+        // The host inverse diagonal has to outlive the copy
+        return solver_synchronize(handle);
+    }
+
+    //
+    // Triangular solve of the ILU0 or IC0 preconditioner and of the scalar division.
+    //
+    template <typename T>
+    hipsparseStatus_t solver_spsv(hipsparseHandle_t     handle,
+                                  hipsparseSolverDescr* descr,
+                                  rocsparse_operation   operation,
+                                  rocsparse_spmat_descr mat,
+                                  rocsparse_dnvec_descr x,
+                                  rocsparse_dnvec_descr y,
+                                  rocsparse_spsv_stage  stage,
+                                  size_t*               buffer_size,
+                                  void*                 buffer)
+    {
+        const T one = T(1);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsv((rocsparse_handle)handle,
+                                                 operation,
+                                                 &one,
+                                                 mat,
+                                                 x,
+                                                 y,
+                                                 descr->datatype,
+                                                 rocsparse_spsv_alg_default,
+                                                 stage,
+                                                 buffer_size,
+                                                 buffer));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // ILU0 and IC0 preconditioners, the incomplete factorization of a copy of the values of A
+    // followed by the analysis of the two triangular solves.
+    //
+    template <typename T>
+    hipsparseStatus_t solver_analysis_factorization(hipsparseHandle_t     handle,
+                                                    hipsparseSolverDescr* descr,
+                                                    const int*            csr_row_ptr,
+                                                    const int*            csr_col_ind,
+                                                    const void*           csr_val)
+    {
+        using rocsparse_type = typename solver_traits<T>::rocsparse_type;
+
+        const bool ic0 = (descr->precond == HIPSPARSE_SOLVER_PRECOND_IC0);
+        const int  m   = static_cast<int>(descr->n);
+        const int  nnz = static_cast<int>(descr->nnz);
+
+        RETURN_IF_HIPSPARSE_ERROR(solver_malloc(
+            handle, &descr->precond_val, sizeof(T) * std::max(descr->nnz, int64_t(1))));
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(descr->precond_val,
+                                           csr_val,
+                                           sizeof(T) * descr->nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        rocsparse_type* val = static_cast<rocsparse_type*>(descr->precond_val);
+
+        rocsparse_mat_descr mat_descr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&mat_descr));
+
+        rocsparse_mat_info mat_info;
+        rocsparse_status   status = rocsparse_create_mat_info(&mat_info);
+
+        if(status != rocsparse_status_success)
+        {
+            rocsparse_destroy_mat_descr(mat_descr);
+            return hipsparse::rocSPARSEStatusToHIPStatus(status);
+        }
+
+        size_t buffer_size = 0;
+        void*  buffer      = nullptr;
+        int    pivot       = -1;
+
+        status = rocsparse_set_mat_index_base(mat_descr, descr->base);
+
+        if(status == rocsparse_status_success)
+        {
+            status = ic0 ? solver_traits<T>::csric0_buffer_size((rocsparse_handle)handle,
+                                                                 m,
+                                                                 nnz,
+                                                                 mat_descr,
+                                                                 val,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 mat_info,
+                                                                 &buffer_size)
+                         : solver_traits<T>::csrilu0_buffer_size((rocsparse_handle)handle,
+                                                                  m,
+                                                                  nnz,
+                                                                  mat_descr,
+                                                                  val,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  mat_info,
+                                                                  &buffer_size);
+        }
+
+        if(status == rocsparse_status_success)
+        {
+            hipsparse::count_workspace(handle, buffer_size);
+            status = (hipMalloc(&buffer, std::max(buffer_size, sizeof(int64_t))) == hipSuccess)
+                         ? rocsparse_status_success
+                         : rocsparse_status_memory_error;
+        }
+
+        if(status == rocsparse_status_success)
+        {
+            status = ic0 ? solver_traits<T>::csric0_analysis((rocsparse_handle)handle,
+                                                             m,
+                                                             nnz,
+                                                             mat_descr,
+                                                             val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             mat_info,
+                                                             rocsparse_analysis_policy_force,
+                                                             rocsparse_solve_policy_auto,
+                                                             buffer)
+                         : solver_traits<T>::csrilu0_analysis((rocsparse_handle)handle,
+                                                              m,
+                                                              nnz,
+                                                              mat_descr,
+                                                              val,
+                                                              csr_row_ptr,
+                                                              csr_col_ind,
+                                                              mat_info,
+                                                              rocsparse_analysis_policy_force,
+                                                              rocsparse_solve_policy_auto,
+                                                              buffer);
+        }
+
+        if(status == rocsparse_status_success)
+        {
+            status = ic0 ? solver_traits<T>::csric0((rocsparse_handle)handle,
+                                                    m,
+                                                    nnz,
+                                                    mat_descr,
+                                                    val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    mat_info,
+                                                    rocsparse_solve_policy_auto,
+                                                    buffer)
+                         : solver_traits<T>::csrilu0((rocsparse_handle)handle,
+                                                     m,
+                                                     nnz,
+                                                     mat_descr,
+                                                     val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     mat_info,
+                                                     rocsparse_solve_policy_auto,
+                                                     buffer);
+        }
+
+        if(status == rocsparse_status_success)
+        {
+            status = ic0 ? rocsparse_csric0_zero_pivot((rocsparse_handle)handle, mat_info, &pivot)
+                         : rocsparse_csrilu0_zero_pivot((rocsparse_handle)handle, mat_info, &pivot);
+        }
+
+        (void)hipFree(buffer);
+        rocsparse_destroy_mat_info(mat_info);
+        rocsparse_destroy_mat_descr(mat_descr);
+
+        if(status == rocsparse_status_zero_pivot || pivot != -1)
+        {
+            return HIPSPARSE_STATUS_ZERO_PIVOT;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        //
+        // ILU0 solves with the unit lower triangle L and the upper triangle U of the factors, IC0
+        // solves with the lower triangle L and with its (conjugate) transpose.
+        //
+        const rocsparse_fill_mode fill_mode_L = rocsparse_fill_mode_lower;
+        const rocsparse_diag_type diag_type_L
+            = ic0 ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
+        const rocsparse_fill_mode fill_mode_U
+            = ic0 ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
+        const rocsparse_diag_type diag_type_U = rocsparse_diag_type_non_unit;
+
+        rocsparse_spmat_descr* mats[]       = {&descr->precond_L, &descr->precond_U};
+        rocsparse_fill_mode    fill_modes[] = {fill_mode_L, fill_mode_U};
+        rocsparse_diag_type    diag_types[] = {diag_type_L, diag_type_U};
+
+        for(int i = 0; i < 2; ++i)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr_descr(mats[i],
+                                                                 descr->n,
+                                                                 descr->n,
+                                                                 descr->nnz,
+                                                                 (void*)csr_row_ptr,
+                                                                 (void*)csr_col_ind,
+                                                                 descr->precond_val,
+                                                                 rocsparse_indextype_i32,
+                                                                 rocsparse_indextype_i32,
+                                                                 descr->base,
+                                                                 descr->datatype));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+                *mats[i], rocsparse_spmat_fill_mode, &fill_modes[i], sizeof(fill_modes[i])));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmat_set_attribute(
+                *mats[i], rocsparse_spmat_diag_type, &diag_types[i], sizeof(diag_types[i])));
+        }
+
+        const rocsparse_operation operation_U
+            = !ic0 ? rocsparse_operation_none
+                   : (solver_is_complex(descr->datatype) ? rocsparse_operation_conjugate_transpose
+                                                         : rocsparse_operation_transpose);
+
+        rocsparse_dnvec_descr x = descr->vectors[0].dnvec;
+        rocsparse_dnvec_descr y = descr->vectors[1].dnvec;
+
+        RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(handle,
+                                                 descr,
+                                                 rocsparse_operation_none,
+                                                 descr->precond_L,
+                                                 x,
+                                                 y,
+                                                 rocsparse_spsv_stage_buffer_size,
+                                                 &descr->precond_buffer_size_L,
+                                                 nullptr));
+        RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(handle,
+                                                 descr,
+                                                 operation_U,
+                                                 descr->precond_U,
+                                                 x,
+                                                 y,
+                                                 rocsparse_spsv_stage_buffer_size,
+                                                 &descr->precond_buffer_size_U,
+                                                 nullptr));
+
+        descr->precond_buffer_size_L = std::max(descr->precond_buffer_size_L, sizeof(int64_t));
+        descr->precond_buffer_size_U = std::max(descr->precond_buffer_size_U, sizeof(int64_t));
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->precond_buffer_L, descr->precond_buffer_size_L));
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->precond_buffer_U, descr->precond_buffer_size_U));
+
+        RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(handle,
+                                                 descr,
+                                                 rocsparse_operation_none,
+                                                 descr->precond_L,
+                                                 x,
+                                                 y,
+                                                 rocsparse_spsv_stage_preprocess,
+                                                 &descr->precond_buffer_size_L,
+                                                 descr->precond_buffer_L));
+        RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(handle,
+                                                 descr,
+                                                 operation_U,
+                                                 descr->precond_U,
+                                                 x,
+                                                 y,
+                                                 rocsparse_spsv_stage_preprocess,
+                                                 &descr->precond_buffer_size_U,
+                                                 descr->precond_buffer_U));
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t solver_analysis(hipsparseHandle_t          handle,
+                                      hipsparseSolverDescr*      descr,
+                                      hipsparseConstSpMatDescr_t matA)
+    {
+        int64_t              rows;
+        int64_t              cols;
+        int64_t              nnz;
+        const void*          csr_row_ptr;
+        const void*          csr_col_ind;
+        const void*          csr_val;
+        rocsparse_indextype  row_type;
+        rocsparse_indextype  col_type;
+        rocsparse_index_base base;
+        rocsparse_datatype   datatype;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                          &rows,
+                                                          &cols,
+                                                          &nnz,
+                                                          &csr_row_ptr,
+                                                          &csr_col_ind,
+                                                          &csr_val,
+                                                          &row_type,
+                                                          &col_type,
+                                                          &base,
+                                                          &datatype));
+
+        if(descr->precond == HIPSPARSE_SOLVER_PRECOND_ILU0
+           || descr->precond == HIPSPARSE_SOLVER_PRECOND_IC0)
+        {
+            // The incomplete factorizations support 32 bit indices only
+            if(row_type != rocsparse_indextype_i32 || col_type != rocsparse_indextype_i32
+               || nnz > std::numeric_limits<int32_t>::max())
+            {
+                return HIPSPARSE_STATUS_NOT_SUPPORTED;
+            }
+        }
+
+        descr->n                 = rows;
+        descr->nnz               = nnz;
+        descr->structure_version = matA->get_structure_version();
+        descr->datatype          = datatype;
+        descr->base              = base;
+        descr->value_size        = sizeof(T);
+        descr->indextype         = (rows + 1 > std::numeric_limits<int32_t>::max())
+                                       ? rocsparse_indextype_i64
+                                       : rocsparse_indextype_i32;
+
+        // Index sequence
+        const size_t index_size
+            = (descr->indextype == rocsparse_indextype_i64) ? sizeof(int64_t) : sizeof(int32_t);
+        RETURN_IF_HIPSPARSE_ERROR(solver_malloc(handle, &descr->indices, index_size * (rows + 1)));
+
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_fill_indices(handle, descr->indextype, rows + 1, descr->indices));
+
+        hipStream_t stream;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+        // Workspace vectors
+        const int num_vectors = solver_num_vectors(descr);
+        RETURN_IF_HIPSPARSE_ERROR(solver_malloc(
+            handle, &descr->work, sizeof(T) * num_vectors * std::max(rows, int64_t(1))));
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(descr->work, 0, sizeof(T) * num_vectors * rows, stream));
+
+        descr->vectors.resize(num_vectors);
+        for(int i = 0; i < num_vectors; ++i)
+        {
+            RETURN_IF_HIPSPARSE_ERROR(solver_create_vector(
+                descr, static_cast<T*>(descr->work) + i * rows, &descr->vectors[i]));
+        }
+
+        // Device scalars. The free slots hold the residuals of a check interval, GMRES computes
+        // one dot product per basis vector at once.
+        descr->num_scalars
+            = solver_scalar_free
+              + std::max(solver_check_interval,
+                         (descr->alg == HIPSPARSE_SOLVER_GMRES) ? descr->restart + 1 : 0);
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->scalars, sizeof(T) * descr->num_scalars));
+
+        // Constant slots, the host copy is alive until the synchronization of the analysis
+        std::vector<T> constants(descr->num_scalars, T(0));
+        constants[solver_scalar_one]       = T(1);
+        constants[solver_scalar_minus_one] = T(-1);
+        constants[solver_scalar_divisor]   = T(1);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(descr->scalars,
+                                           constants.data(),
+                                           sizeof(T) * descr->num_scalars,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+        // Scalar division, y = alpha * x / d, where d is the 1 x 1 matrix of the divisor slot.
+        // Its row offsets and column index are taken from the index sequence.
+        T* scalars = static_cast<T*>(descr->scalars);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csr_descr(&descr->scalar_mat,
+                                                             1,
+                                                             1,
+                                                             1,
+                                                             descr->indices,
+                                                             descr->indices,
+                                                             scalars + solver_scalar_divisor,
+                                                             descr->indextype,
+                                                             descr->indextype,
+                                                             rocsparse_index_base_zero,
+                                                             datatype));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_dnvec_descr(
+            &descr->scalar_x, 1, scalars + solver_scalar_one, datatype));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_dnvec_descr(
+            &descr->scalar_y, 1, scalars + solver_scalar_quotient, datatype));
+
+        RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(handle,
+                                                 descr,
+                                                 rocsparse_operation_none,
+                                                 descr->scalar_mat,
+                                                 descr->scalar_x,
+                                                 descr->scalar_y,
+                                                 rocsparse_spsv_stage_buffer_size,
+                                                 &descr->scalar_buffer_size,
+                                                 nullptr));
+
+        descr->scalar_buffer_size = std::max(descr->scalar_buffer_size, sizeof(int64_t));
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->scalar_buffer, descr->scalar_buffer_size));
+
+        RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(handle,
+                                                 descr,
+                                                 rocsparse_operation_none,
+                                                 descr->scalar_mat,
+                                                 descr->scalar_x,
+                                                 descr->scalar_y,
+                                                 rocsparse_spsv_stage_preprocess,
+                                                 &descr->scalar_buffer_size,
+                                                 descr->scalar_buffer));
+
+        // Dot product buffer, rocsparse_spvv treats a null buffer as a buffer size query
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spvv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 descr->vectors[0].spvec,
+                                                 descr->vectors[1].dnvec,
+                                                 descr->scalars,
+                                                 datatype,
+                                                 &descr->spvv_buffer_size,
+                                                 nullptr));
+
+        descr->spvv_buffer_size = std::max(descr->spvv_buffer_size, sizeof(int64_t));
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->spvv_buffer, descr->spvv_buffer_size));
+
+        // SpMV buffer
+        const T one  = T(1);
+        const T zero = T(0);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &one,
+                                                 to_rocsparse_const_spmat_descr(matA),
+                                                 descr->vectors[0].dnvec,
+                                                 &zero,
+                                                 descr->vectors[1].dnvec,
+                                                 datatype,
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_buffer_size,
+                                                 &descr->spmv_buffer_size,
+                                                 nullptr));
+
+        descr->spmv_buffer_size = std::max(descr->spmv_buffer_size, sizeof(int64_t));
+        RETURN_IF_HIPSPARSE_ERROR(
+            solver_malloc(handle, &descr->spmv_buffer, descr->spmv_buffer_size));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)handle,
+                                                 rocsparse_operation_none,
+                                                 &one,
+                                                 to_rocsparse_const_spmat_descr(matA),
+                                                 descr->vectors[0].dnvec,
+                                                 &zero,
+                                                 descr->vectors[1].dnvec,
+                                                 datatype,
+                                                 rocsparse_spmv_alg_csr_stream,
+                                                 rocsparse_spmv_stage_preprocess,
+                                                 &descr->spmv_buffer_size,
+                                                 descr->spmv_buffer));
+
+        // Preconditioner
+        switch(descr->precond)
+        {
+        case HIPSPARSE_SOLVER_PRECOND_NONE:
+            break;
+
+        case HIPSPARSE_SOLVER_PRECOND_JACOBI:
+        {
+            std::vector<int64_t> positions;
+
+            if(row_type == rocsparse_indextype_i32 && col_type == rocsparse_indextype_i32)
+            {
+                RETURN_IF_HIPSPARSE_ERROR((solver_diagonal_positions<int32_t, int32_t>(
+                    handle, rows, nnz, csr_row_ptr, csr_col_ind, base, positions)));
+            }
+            else if(row_type == rocsparse_indextype_i64 && col_type == rocsparse_indextype_i32)
+            {
+                RETURN_IF_HIPSPARSE_ERROR((solver_diagonal_positions<int64_t, int32_t>(
+                    handle, rows, nnz, csr_row_ptr, csr_col_ind, base, positions)));
+            }
+            else if(row_type == rocsparse_indextype_i64 && col_type == rocsparse_indextype_i64)
+            {
+                RETURN_IF_HIPSPARSE_ERROR((solver_diagonal_positions<int64_t, int64_t>(
+                    handle, rows, nnz, csr_row_ptr, csr_col_ind, base, positions)));
+            }
+            else
+            {
+                return HIPSPARSE_STATUS_NOT_SUPPORTED;
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(solver_analysis_jacobi<T>(handle, descr, positions, csr_val));
+            break;
+        }
+
+        case HIPSPARSE_SOLVER_PRECOND_ILU0:
+        case HIPSPARSE_SOLVER_PRECOND_IC0:
+            RETURN_IF_HIPSPARSE_ERROR(
+                solver_analysis_factorization<T>(handle,
+                                                 descr,
+                                                 static_cast<const int*>(csr_row_ptr),
+                                                 static_cast<const int*>(csr_col_ind),
+                                                 csr_val));
+            break;
+        }
+
+        // The analysis is blocking, as for the incomplete factorizations
+        RETURN_IF_HIPSPARSE_ERROR(solver_synchronize(handle));
+
+        descr->analyzed = true;
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Operations of the Krylov solvers on the workspace vectors. Vector updates take host
+    // scalars or device scalar slots, dot products and divisions write device scalar slots.
+    // Only read synchronizes with the device.
+    //
+    template <typename T>
+    class solver_ops
+    {
+        hipsparseHandle_t           m_handle{};
+        hipsparseSolverDescr*       m_descr{};
+        rocsparse_const_spmat_descr m_mat{};
+        hipStream_t                 m_stream{};
+
+    public:
+        solver_ops(hipsparseHandle_t          handle,
+                   hipsparseSolverDescr*      descr,
+                   hipsparseConstSpMatDescr_t matA)
+            : m_handle(handle)
+            , m_descr(descr)
+            , m_mat(to_rocsparse_const_spmat_descr(matA))
+        {
+        }
+
+        hipsparseStatus_t init()
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)m_handle, &m_stream));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        hipsparseSolverVector& vector(int i)
+        {
+            return m_descr->vectors[i];
+        }
+
+        // y = A * x
+        hipsparseStatus_t spmv(const hipsparseSolverVector& x, const hipsparseSolverVector& y)
+        {
+            const T one  = T(1);
+            const T zero = T(0);
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                 rocsparse_pointer_mode_host));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)m_handle,
+                                                     rocsparse_operation_none,
+                                                     &one,
+                                                     m_mat,
+                                                     x.dnvec,
+                                                     &zero,
+                                                     y.dnvec,
+                                                     m_descr->datatype,
+                                                     rocsparse_spmv_alg_csr_stream,
+                                                     rocsparse_spmv_stage_compute,
+                                                     &m_descr->spmv_buffer_size,
+                                                     m_descr->spmv_buffer));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Scalar slot = x^H * y, on the device
+        hipsparseStatus_t
+            dot(const hipsparseSolverVector& x, const hipsparseSolverVector& y, int slot)
+        {
+            const rocsparse_operation operation = solver_is_complex(m_descr->datatype)
+                                                      ? rocsparse_operation_conjugate_transpose
+                                                      : rocsparse_operation_none;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                 rocsparse_pointer_mode_device));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spvv((rocsparse_handle)m_handle,
+                                                     operation,
+                                                     x.spvec,
+                                                     y.dnvec,
+                                                     static_cast<T*>(m_descr->scalars) + slot,
+                                                     m_descr->datatype,
+                                                     &m_descr->spvv_buffer_size,
+                                                     m_descr->spvv_buffer));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Read count scalar slots starting at first, the only synchronization of the solvers
+        hipsparseStatus_t read(int first, int count, T* values)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(values,
+                                               static_cast<T*>(m_descr->scalars) + first,
+                                               sizeof(T) * count,
+                                               hipMemcpyDeviceToHost,
+                                               m_stream));
+
+            hipsparse::count_synchronization(m_handle);
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(m_stream));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Scalar slot result = factor * numerator / divisor, on the device
+        hipsparseStatus_t divide(int numerator, int divisor, int factor, int result)
+        {
+            T* scalars = static_cast<T*>(m_descr->scalars);
+
+            RETURN_IF_HIPSPARSE_ERROR(assign(divisor, solver_scalar_divisor));
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_dnvec_set_values(m_descr->scalar_x, scalars + numerator));
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_dnvec_set_values(m_descr->scalar_y, scalars + result));
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                 rocsparse_pointer_mode_device));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_spsv((rocsparse_handle)m_handle,
+                                                     rocsparse_operation_none,
+                                                     scalars + factor,
+                                                     m_descr->scalar_mat,
+                                                     m_descr->scalar_x,
+                                                     m_descr->scalar_y,
+                                                     m_descr->datatype,
+                                                     rocsparse_spsv_alg_default,
+                                                     rocsparse_spsv_stage_compute,
+                                                     &m_descr->scalar_buffer_size,
+                                                     m_descr->scalar_buffer));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // Scalar slot result = source, on the device
+        hipsparseStatus_t assign(int source, int result)
+        {
+            T* scalars = static_cast<T*>(m_descr->scalars);
+
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                scalars + result, scalars + source, sizeof(T), hipMemcpyDeviceToDevice, m_stream));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // y = alpha * x + beta * y
+        hipsparseStatus_t
+            axpby(T alpha, const hipsparseSolverVector& x, T beta, const hipsparseSolverVector& y)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                 rocsparse_pointer_mode_host));
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_axpby((rocsparse_handle)m_handle, &alpha, x.spvec, &beta, y.dnvec));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // y = alpha * x + beta * y with the scalar slots alpha and beta
+        hipsparseStatus_t axpby(solver_scalar                alpha,
+                                const hipsparseSolverVector& x,
+                                solver_scalar                beta,
+                                const hipsparseSolverVector& y)
+        {
+            T* scalars = static_cast<T*>(m_descr->scalars);
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                 rocsparse_pointer_mode_device));
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_axpby(
+                (rocsparse_handle)m_handle, scalars + alpha, x.spvec, scalars + beta, y.dnvec));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // y = alpha * y
+        hipsparseStatus_t scale(T alpha, const hipsparseSolverVector& y)
+        {
+            return axpby(T(0), y, alpha, y);
+        }
+
+        // y = x
+        hipsparseStatus_t copy(const hipsparseSolverVector& x, const hipsparseSolverVector& y)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                y.values, x.values, sizeof(T) * m_descr->n, hipMemcpyDeviceToDevice, m_stream));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        }
+
+        // z = M^-1 * r
+        hipsparseStatus_t precond(const hipsparseSolverVector& r, const hipsparseSolverVector& z)
+        {
+            const T one  = T(1);
+            const T zero = T(0);
+
+            switch(m_descr->precond)
+            {
+            case HIPSPARSE_SOLVER_PRECOND_NONE:
+                return copy(r, z);
+
+            case HIPSPARSE_SOLVER_PRECOND_JACOBI:
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                     rocsparse_pointer_mode_host));
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_spmv((rocsparse_handle)m_handle,
+                                                         rocsparse_operation_none,
+                                                         &one,
+                                                         m_descr->precond_L,
+                                                         r.dnvec,
+                                                         &zero,
+                                                         z.dnvec,
+                                                         m_descr->datatype,
+                                                         rocsparse_spmv_alg_csr_stream,
+                                                         rocsparse_spmv_stage_compute,
+                                                         &m_descr->precond_buffer_size_L,
+                                                         m_descr->precond_buffer_L));
+                return HIPSPARSE_STATUS_SUCCESS;
+
+            case HIPSPARSE_SOLVER_PRECOND_ILU0:
+            case HIPSPARSE_SOLVER_PRECOND_IC0:
+            {
+                // The intermediate vector is the last workspace vector
+                const hipsparseSolverVector& t = m_descr->vectors.back();
+
+                const rocsparse_operation operation_U
+                    = (m_descr->precond == HIPSPARSE_SOLVER_PRECOND_ILU0)
+                          ? rocsparse_operation_none
+                          : (solver_is_complex(m_descr->datatype)
+                                 ? rocsparse_operation_conjugate_transpose
+                                 : rocsparse_operation_transpose);
+
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode((rocsparse_handle)m_handle,
+                                                                     rocsparse_pointer_mode_host));
+                RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(m_handle,
+                                                         m_descr,
+                                                         rocsparse_operation_none,
+                                                         m_descr->precond_L,
+                                                         r.dnvec,
+                                                         t.dnvec,
+                                                         rocsparse_spsv_stage_compute,
+                                                         &m_descr->precond_buffer_size_L,
+                                                         m_descr->precond_buffer_L));
+                RETURN_IF_HIPSPARSE_ERROR(solver_spsv<T>(m_handle,
+                                                         m_descr,
+                                                         operation_U,
+                                                         m_descr->precond_U,
+                                                         t.dnvec,
+                                                         z.dnvec,
+                                                         rocsparse_spsv_stage_compute,
+                                                         &m_descr->precond_buffer_size_U,
+                                                         m_descr->precond_buffer_U));
+                return HIPSPARSE_STATUS_SUCCESS;
+            }
+            }
+
+            return HIPSPARSE_STATUS_NOT_SUPPORTED;
+        }
+
+        // Record the relative residual of an iteration
+        void record(double residual)
+        {
+            m_descr->residual = residual;
+            m_descr->history.push_back(residual);
+        }
+
+        bool converged(double residual) const
+        {
+            return residual <= m_descr->tolerance;
+        }
+    };
+
+    template <typename T>
+    inline double solver_norm(T squared_norm)
+    {
+        return std::sqrt(static_cast<double>(std::abs(squared_norm)));
+    }
+
+    //
+    // Iterations of CG and BiCGStab, whose step lengths stay in device scalars. A step writes
+    // the squared norm of its residual to a free slot, the residuals of solver_check_interval
+    // steps are read back at once. A residual that is not finite shows a breakdown between two
+    // checks. The iterate of the last check is restored and the method restarts with a check
+    // after every step, where the step reads its divisors back and stops on a breakdown.
+    //
+    template <typename T, typename Start, typename Step>
+    hipsparseStatus_t solver_iterate(solver_ops<T>&               ops,
+                                     hipsparseSolverDescr*        descr,
+                                     const hipsparseSolverVector& x,
+                                     const hipsparseSolverVector& x_check,
+                                     double                       norm_b,
+                                     double                       residual,
+                                     Start                        start,
+                                     Step                         step)
+    {
+        T residuals[solver_check_interval];
+
+        int  interval = solver_check_interval;
+        bool stop     = false;
+
+        RETURN_IF_HIPSPARSE_ERROR(ops.copy(x, x_check));
+
+        while(!stop && !ops.converged(residual) && descr->iterations < descr->max_iterations)
+        {
+            const int steps = std::min(interval, descr->max_iterations - descr->iterations);
+            int       count = 0;
+
+            for(int i = 0; i < steps && !stop; ++i)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(
+                    step(solver_scalar_free + i, interval == 1, &stop, &count));
+            }
+
+            if(count == 0)
+            {
+                break;
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, count, residuals));
+
+            bool finite = true;
+            for(int i = 0; i < count; ++i)
+            {
+                finite = finite && std::isfinite(solver_norm(residuals[i]));
+            }
+
+            if(!finite)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(ops.copy(x_check, x));
+
+                if(interval == 1)
+                {
+                    break;
+                }
+
+                interval = 1;
+                stop     = false;
+
+                RETURN_IF_HIPSPARSE_ERROR(start());
+                continue;
+            }
+
+            for(int i = 0; i < count; ++i)
+            {
+                ++descr->iterations;
+                residual = solver_norm(residuals[i]) / norm_b;
+                ops.record(residual);
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(x, x_check));
+        }
+
+        descr->converged = ops.converged(residual);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    //
+    // Preconditioned conjugate gradient method.
+    //
+    template <typename T>
+    hipsparseStatus_t solver_cg(solver_ops<T>&               ops,
+                                hipsparseSolverDescr*        descr,
+                                const hipsparseSolverVector& b,
+                                const hipsparseSolverVector& x)
+    {
+        const hipsparseSolverVector& r       = ops.vector(0);
+        const hipsparseSolverVector& z       = ops.vector(1);
+        const hipsparseSolverVector& p       = ops.vector(2);
+        const hipsparseSolverVector& q       = ops.vector(3);
+        const hipsparseSolverVector& x_check = ops.vector(4);
+
+        // r = b - A * x, z = M^-1 * r, p = z, rho = r^H * z
+        auto start = [&]() -> hipsparseStatus_t {
+            RETURN_IF_HIPSPARSE_ERROR(ops.spmv(x, r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(T(1), b, T(-1), r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.precond(r, z));
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(z, p));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, z, solver_scalar_rho));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        auto step = [&](int slot, bool checked, bool* stop, int* count) -> hipsparseStatus_t {
+            T divisor;
+
+            // q = A * p, alpha = rho / (p^H * q)
+            RETURN_IF_HIPSPARSE_ERROR(ops.spmv(p, q));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(p, q, solver_scalar_dot_0));
+
+            if(checked)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_dot_0, 1, &divisor));
+
+                if(divisor == T(0))
+                {
+                    *stop = true;
+                    return HIPSPARSE_STATUS_SUCCESS;
+                }
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(
+                solver_scalar_rho, solver_scalar_dot_0, solver_scalar_one, solver_scalar_alpha));
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(solver_scalar_rho,
+                                                 solver_scalar_dot_0,
+                                                 solver_scalar_minus_one,
+                                                 solver_scalar_minus_alpha));
+
+            // x = x + alpha * p, r = r - alpha * q, z = M^-1 * r
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(solver_scalar_alpha, p, solver_scalar_one, x));
+            RETURN_IF_HIPSPARSE_ERROR(
+                ops.axpby(solver_scalar_minus_alpha, q, solver_scalar_one, r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.precond(r, z));
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, z, solver_scalar_rho_new));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, r, slot));
+            ++*count;
+
+            if(checked)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_rho, 1, &divisor));
+
+                if(divisor == T(0))
+                {
+                    *stop = true;
+                    return HIPSPARSE_STATUS_SUCCESS;
+                }
+            }
+
+            // p = z + beta * p, beta = rho_new / rho
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(
+                solver_scalar_rho_new, solver_scalar_rho, solver_scalar_one, solver_scalar_beta));
+            RETURN_IF_HIPSPARSE_ERROR(ops.assign(solver_scalar_rho_new, solver_scalar_rho));
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(solver_scalar_one, z, solver_scalar_beta, p));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        T scalars[2];
+
+        RETURN_IF_HIPSPARSE_ERROR(start());
+        RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, r, solver_scalar_free));
+        RETURN_IF_HIPSPARSE_ERROR(ops.dot(b, b, solver_scalar_free + 1));
+        RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, 2, scalars));
+
+        const double norm_b   = solver_norm(scalars[1]);
+        const double residual = (norm_b > 0.0) ? solver_norm(scalars[0]) / norm_b : 0.0;
+
+        ops.record(residual);
+
+        return solver_iterate(ops, descr, x, x_check, norm_b, residual, start, step);
+    }
+
+    //
+    // Right preconditioned stabilized bi-conjugate gradient method.
+    //
+    template <typename T>
+    hipsparseStatus_t solver_bicgstab(solver_ops<T>&               ops,
+                                      hipsparseSolverDescr*        descr,
+                                      const hipsparseSolverVector& b,
+                                      const hipsparseSolverVector& x)
+    {
+        const hipsparseSolverVector& r       = ops.vector(0);
+        const hipsparseSolverVector& r0      = ops.vector(1);
+        const hipsparseSolverVector& p       = ops.vector(2);
+        const hipsparseSolverVector& v       = ops.vector(3);
+        const hipsparseSolverVector& s       = ops.vector(4);
+        const hipsparseSolverVector& t       = ops.vector(5);
+        const hipsparseSolverVector& phat    = ops.vector(6);
+        const hipsparseSolverVector& shat    = ops.vector(7);
+        const hipsparseSolverVector& x_check = ops.vector(8);
+
+        double norm_b = 0.0;
+
+        // r = b - A * x, r0 = r, p = r, rho = r0^H * r
+        auto start = [&]() -> hipsparseStatus_t {
+            RETURN_IF_HIPSPARSE_ERROR(ops.spmv(x, r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(T(1), b, T(-1), r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(r, r0));
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(r, p));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r0, r, solver_scalar_rho));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        auto step = [&](int slot, bool checked, bool* stop, int* count) -> hipsparseStatus_t {
+            T divisor;
+
+            // phat = M^-1 * p, v = A * phat, alpha = rho / (r0^H * v)
+            RETURN_IF_HIPSPARSE_ERROR(ops.precond(p, phat));
+            RETURN_IF_HIPSPARSE_ERROR(ops.spmv(phat, v));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r0, v, solver_scalar_dot_0));
+
+            if(checked)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_dot_0, 1, &divisor));
+
+                if(divisor == T(0))
+                {
+                    *stop = true;
+                    return HIPSPARSE_STATUS_SUCCESS;
+                }
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(
+                solver_scalar_rho, solver_scalar_dot_0, solver_scalar_one, solver_scalar_alpha));
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(solver_scalar_rho,
+                                                 solver_scalar_dot_0,
+                                                 solver_scalar_minus_one,
+                                                 solver_scalar_minus_alpha));
+
+            // s = r - alpha * v, shat = M^-1 * s, t = A * shat
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(r, s));
+            RETURN_IF_HIPSPARSE_ERROR(
+                ops.axpby(solver_scalar_minus_alpha, v, solver_scalar_one, s));
+            RETURN_IF_HIPSPARSE_ERROR(ops.precond(s, shat));
+            RETURN_IF_HIPSPARSE_ERROR(ops.spmv(shat, t));
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(t, s, solver_scalar_dot_0));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(t, t, solver_scalar_dot_1));
+
+            if(checked)
+            {
+                T norm_s;
+
+                RETURN_IF_HIPSPARSE_ERROR(ops.dot(s, s, slot));
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(slot, 1, &norm_s));
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_dot_1, 1, &divisor));
+
+                // Early exit if s is small enough, x = x + alpha * phat
+                if(ops.converged(solver_norm(norm_s) / norm_b) || divisor == T(0))
+                {
+                    RETURN_IF_HIPSPARSE_ERROR(
+                        ops.axpby(solver_scalar_alpha, phat, solver_scalar_one, x));
+                    RETURN_IF_HIPSPARSE_ERROR(ops.copy(s, r));
+                    ++*count;
+
+                    *stop = true;
+                    return HIPSPARSE_STATUS_SUCCESS;
+                }
+            }
+
+            // omega = (t^H * s) / (t^H * t)
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(
+                solver_scalar_dot_0, solver_scalar_dot_1, solver_scalar_one, solver_scalar_omega));
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(solver_scalar_dot_0,
+                                                 solver_scalar_dot_1,
+                                                 solver_scalar_minus_one,
+                                                 solver_scalar_minus_omega));
+
+            // x = x + alpha * phat + omega * shat, r = s - omega * t
+            RETURN_IF_HIPSPARSE_ERROR(
+                ops.axpby(solver_scalar_alpha, phat, solver_scalar_one, x));
+            RETURN_IF_HIPSPARSE_ERROR(
+                ops.axpby(solver_scalar_omega, shat, solver_scalar_one, x));
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(s, r));
+            RETURN_IF_HIPSPARSE_ERROR(
+                ops.axpby(solver_scalar_minus_omega, t, solver_scalar_one, r));
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r0, r, solver_scalar_rho_new));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, r, slot));
+            ++*count;
+
+            if(checked)
+            {
+                // rho, rho_new, alpha, minus_alpha and omega
+                T scalars[5];
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_rho, 5, scalars));
+
+                if(scalars[0] == T(0) || scalars[4] == T(0))
+                {
+                    *stop = true;
+                    return HIPSPARSE_STATUS_SUCCESS;
+                }
+            }
+
+            // p = r + beta * (p - omega * v), beta = (rho_new / rho) * (alpha / omega)
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(solver_scalar_rho_new,
+                                                 solver_scalar_rho,
+                                                 solver_scalar_one,
+                                                 solver_scalar_quotient));
+            RETURN_IF_HIPSPARSE_ERROR(ops.divide(solver_scalar_alpha,
+                                                 solver_scalar_omega,
+                                                 solver_scalar_quotient,
+                                                 solver_scalar_beta));
+            RETURN_IF_HIPSPARSE_ERROR(ops.assign(solver_scalar_rho_new, solver_scalar_rho));
+
+            RETURN_IF_HIPSPARSE_ERROR(
+                ops.axpby(solver_scalar_minus_omega, v, solver_scalar_one, p));
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(solver_scalar_one, r, solver_scalar_beta, p));
+
+            return HIPSPARSE_STATUS_SUCCESS;
+        };
+
+        T scalars[2];
+
+        RETURN_IF_HIPSPARSE_ERROR(start());
+        RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, r, solver_scalar_free));
+        RETURN_IF_HIPSPARSE_ERROR(ops.dot(b, b, solver_scalar_free + 1));
+        RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, 2, scalars));
+
+        norm_b                = solver_norm(scalars[1]);
+        const double residual = (norm_b > 0.0) ? solver_norm(scalars[0]) / norm_b : 0.0;
+
+        ops.record(residual);
+
+        return solver_iterate(ops, descr, x, x_check, norm_b, residual, start, step);
+    }
+
+    //
+    // Restarted, right preconditioned generalized minimal residual method. The Arnoldi basis is
+    // orthogonalized with classical Gram-Schmidt and one reorthogonalization, such that all dot
+    // products of a pass are read back at once.
+    //
+    template <typename T>
+    hipsparseStatus_t solver_gmres(solver_ops<T>&               ops,
+                                   hipsparseSolverDescr*        descr,
+                                   const hipsparseSolverVector& b,
+                                   const hipsparseSolverVector& x)
+    {
+        using real_type = typename solver_traits<T>::real_type;
+
+        const int m = descr->restart;
+
+        const hipsparseSolverVector& r = ops.vector(0);
+        const hipsparseSolverVector& w = ops.vector(1);
+        const hipsparseSolverVector& z = ops.vector(2);
+
+        auto V = [&ops](int i) -> const hipsparseSolverVector& { return ops.vector(3 + i); };
+
+        std::vector<T> scalars(m + 1);
+        std::vector<T> H((m + 1) * m);
+        std::vector<T> g(m + 1);
+        std::vector<T> y(m);
+        std::vector<T> cs(m);
+        std::vector<T> sn(m);
+
+        // Column major Hessenberg matrix
+        auto h = [&H, m](int i, int j) -> T& { return H[i + j * (m + 1)]; };
+
+        // r = b - A * x
+        RETURN_IF_HIPSPARSE_ERROR(ops.spmv(x, r));
+        RETURN_IF_HIPSPARSE_ERROR(ops.axpby(T(1), b, T(-1), r));
+
+        RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, r, solver_scalar_free));
+        RETURN_IF_HIPSPARSE_ERROR(ops.dot(b, b, solver_scalar_free + 1));
+        RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, 2, scalars.data()));
+
+        double norm_r   = solver_norm(scalars[0]);
+        double norm_b   = solver_norm(scalars[1]);
+        double residual = (norm_b > 0.0) ? norm_r / norm_b : 0.0;
+
+        ops.record(residual);
+
+        while(!ops.converged(residual) && descr->iterations < descr->max_iterations)
+        {
+            // V_0 = r / ||r||
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(r, V(0)));
+            RETURN_IF_HIPSPARSE_ERROR(ops.scale(T(real_type(1) / real_type(norm_r)), V(0)));
+
+            std::fill(g.begin(), g.end(), T(0));
+            g[0] = T(real_type(norm_r));
+
+            int  k         = 0;
+            bool breakdown = false;
+
+            while(k < m && descr->iterations < descr->max_iterations)
+            {
+                const int j = k;
+
+                // w = A * M^-1 * V_j
+                RETURN_IF_HIPSPARSE_ERROR(ops.precond(V(j), z));
+                RETURN_IF_HIPSPARSE_ERROR(ops.spmv(z, w));
+
+                for(int i = 0; i <= j; ++i)
+                {
+                    h(i, j) = T(0);
+                }
+
+                // Two passes of classical Gram-Schmidt
+                for(int pass = 0; pass < 2; ++pass)
+                {
+                    for(int i = 0; i <= j; ++i)
+                    {
+                        RETURN_IF_HIPSPARSE_ERROR(ops.dot(V(i), w, solver_scalar_free + i));
+                    }
+
+                    RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, j + 1, scalars.data()));
+
+                    for(int i = 0; i <= j; ++i)
+                    {
+                        RETURN_IF_HIPSPARSE_ERROR(ops.axpby(-scalars[i], V(i), T(1), w));
+                        h(i, j) += scalars[i];
+                    }
+                }
+
+                RETURN_IF_HIPSPARSE_ERROR(ops.dot(w, w, solver_scalar_free));
+                RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, 1, scalars.data()));
+
+                const double norm_w = solver_norm(scalars[0]);
+                h(j + 1, j)         = T(real_type(norm_w));
+
+                if(norm_w > 0.0)
+                {
+                    RETURN_IF_HIPSPARSE_ERROR(ops.copy(w, V(j + 1)));
+                    RETURN_IF_HIPSPARSE_ERROR(
+                        ops.scale(T(real_type(1) / real_type(norm_w)), V(j + 1)));
+                }
+                else
+                {
+                    breakdown = true;
+                }
+
+                // Apply the previous Givens rotations to the new column
+                for(int i = 0; i < j; ++i)
+                {
+                    const T temp = cs[i] * h(i, j) + sn[i] * h(i + 1, j);
+                    h(i + 1, j)  = -solver_conj(sn[i]) * h(i, j) + cs[i] * h(i + 1, j);
+                    h(i, j)      = temp;
+                }
+
+                // Rotation that eliminates h(j + 1, j)
+                const real_type abs_a = std::abs(h(j, j));
+                const real_type abs_b = std::abs(h(j + 1, j));
+                const real_type norm  = std::sqrt(abs_a * abs_a + abs_b * abs_b);
+
+                if(norm == real_type(0))
+                {
+                    cs[j] = T(1);
+                    sn[j] = T(0);
+                }
+                else if(abs_a == real_type(0))
+                {
+                    cs[j] = T(0);
+                    sn[j] = solver_conj(h(j + 1, j)) / T(abs_b);
+                }
+                else
+                {
+                    const T phase = h(j, j) / T(abs_a);
+
+                    cs[j] = T(abs_a / norm);
+                    sn[j] = phase * solver_conj(h(j + 1, j)) / T(norm);
+                }
+
+                h(j, j)     = cs[j] * h(j, j) + sn[j] * h(j + 1, j);
+                h(j + 1, j) = T(0);
+                g[j + 1]    = -solver_conj(sn[j]) * g[j];
+                g[j]        = cs[j] * g[j];
+
+                ++k;
+                ++descr->iterations;
+
+                residual = static_cast<double>(std::abs(g[j + 1])) / norm_b;
+                ops.record(residual);
+
+                if(ops.converged(residual) || breakdown)
+                {
+                    break;
+                }
+            }
+
+            // Solve the upper triangular system H(0:k, 0:k) * y = g(0:k)
+            for(int i = k - 1; i >= 0; --i)
+            {
+                T sum = g[i];
+                for(int l = i + 1; l < k; ++l)
+                {
+                    sum -= h(i, l) * y[l];
+                }
+
+                y[i] = (h(i, i) != T(0)) ? sum / h(i, i) : T(0);
+            }
+
+            // x = x + M^-1 * V * y
+            RETURN_IF_HIPSPARSE_ERROR(ops.copy(V(0), w));
+            RETURN_IF_HIPSPARSE_ERROR(ops.scale(y[0], w));
+
+            for(int i = 1; i < k; ++i)
+            {
+                RETURN_IF_HIPSPARSE_ERROR(ops.axpby(y[i], V(i), T(1), w));
+            }
+
+            RETURN_IF_HIPSPARSE_ERROR(ops.precond(w, z));
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(T(1), z, T(1), x));
+
+            // Residual of the restart, r = b - A * x
+            RETURN_IF_HIPSPARSE_ERROR(ops.spmv(x, r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.axpby(T(1), b, T(-1), r));
+            RETURN_IF_HIPSPARSE_ERROR(ops.dot(r, r, solver_scalar_free));
+            RETURN_IF_HIPSPARSE_ERROR(ops.read(solver_scalar_free, 1, scalars.data()));
+
+            norm_r   = solver_norm(scalars[0]);
+            residual = norm_r / norm_b;
+
+            descr->residual = residual;
+
+            if(breakdown)
+            {
+                break;
+            }
+        }
+
+        descr->converged = ops.converged(residual);
+
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipsparseStatus_t solver_solve(hipsparseHandle_t          handle,
+                                   hipsparseSolverDescr*      descr,
+                                   hipsparseConstSpMatDescr_t matA,
+                                   const void*                b_values,
+                                   void*                      x_values)
+    {
+        hipsparseSolverVector b;
+        hipsparseSolverVector x;
+        solver_vector_guard   b_guard(b);
+        solver_vector_guard   x_guard(x);
+
+        RETURN_IF_HIPSPARSE_ERROR(solver_create_vector(descr, (void*)b_values, &b));
+        RETURN_IF_HIPSPARSE_ERROR(solver_create_vector(descr, x_values, &x));
+
+        solver_ops<T> ops(handle, descr, matA);
+        RETURN_IF_HIPSPARSE_ERROR(ops.init());
+
+        descr->iterations = 0;
+        descr->residual   = 0.0;
+        descr->converged  = false;
+        descr->history.clear();
+
+        switch(descr->alg)
+        {
+        case HIPSPARSE_SOLVER_CG:
+            return solver_cg<T>(ops, descr, b, x);
+        case HIPSPARSE_SOLVER_BICGSTAB:
+            return solver_bicgstab<T>(ops, descr, b, x);
+        case HIPSPARSE_SOLVER_GMRES:
+            return solver_gmres<T>(ops, descr, b, x);
+        }
+
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipsparseStatus_t hipsparseSolver_createDescr(hipsparseSolverDescr_t*  descr,
+                                              hipsparseSolverAlg_t     alg,
+                                              hipsparseSolverPrecond_t precond)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(alg != HIPSPARSE_SOLVER_CG && alg != HIPSPARSE_SOLVER_BICGSTAB
+       && alg != HIPSPARSE_SOLVER_GMRES)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    if(precond != HIPSPARSE_SOLVER_PRECOND_NONE && precond != HIPSPARSE_SOLVER_PRECOND_JACOBI
+       && precond != HIPSPARSE_SOLVER_PRECOND_ILU0 && precond != HIPSPARSE_SOLVER_PRECOND_IC0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *descr            = new hipsparseSolverDescr;
+    (*descr)->alg     = alg;
+    (*descr)->precond = precond;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSolver_destroyDescr(hipsparseSolverDescr_t descr)
+{
+    if(descr == nullptr)
+    {
+        return HIPSPARSE_STATUS_SUCCESS;
+    }
+
+    solver_clear(descr);
+    delete descr;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSolver_setParameters(hipsparseSolverDescr_t descr,
+                                                int                    maxIterations,
+                                                double                 tolerance,
+                                                int                    restart)
+{
+    if(descr == nullptr || maxIterations < 0 || !(tolerance >= 0.0) || restart <= 0)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The workspace size depends on the restart length
+    if(descr->analyzed && descr->alg == HIPSPARSE_SOLVER_GMRES && restart != descr->restart)
+    {
+        solver_clear(descr);
+    }
+
+    descr->max_iterations = maxIterations;
+    descr->tolerance      = tolerance;
+    descr->restart        = restart;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSolver_analysis(hipsparseHandle_t          handle,
+                                           hipsparseSolverDescr_t     descr,
+                                           hipsparseConstSpMatDescr_t matA,
+                                           hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, computeType);
+
+    if(handle == nullptr || descr == nullptr || matA == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    rocsparse_format format;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_format(to_rocsparse_const_spmat_descr(matA), &format));
+
+    if(format != rocsparse_format_csr)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t              rows;
+    int64_t              cols;
+    int64_t              nnz;
+    const void*          csr_row_ptr;
+    const void*          csr_col_ind;
+    const void*          csr_val;
+    rocsparse_indextype  row_type;
+    rocsparse_indextype  col_type;
+    rocsparse_index_base base;
+    rocsparse_datatype   datatype;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_csr_get(to_rocsparse_const_spmat_descr(matA),
+                                                      &rows,
+                                                      &cols,
+                                                      &nnz,
+                                                      &csr_row_ptr,
+                                                      &csr_col_ind,
+                                                      &csr_val,
+                                                      &row_type,
+                                                      &col_type,
+                                                      &base,
+                                                      &datatype));
+
+    if(rows != cols || datatype != hipsparse::hipDataTypeToHCCDataType(computeType))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    solver_clear(descr);
+
+    // Allocations, host copies and the incomplete factorizations are kept out of graph captures
+    hipsparse::stream_capture_bypass bypass(handle, true);
+    RETURN_IF_HIPSPARSE_ERROR(bypass.status());
+
+    solver_pointer_mode pointer_mode(handle);
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_set_pointer_mode((rocsparse_handle)handle, rocsparse_pointer_mode_host));
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+        RETURN_IF_HIPSPARSE_ERROR(solver_analysis<float>(handle, descr, matA));
+        break;
+    case HIP_R_64F:
+        RETURN_IF_HIPSPARSE_ERROR(solver_analysis<double>(handle, descr, matA));
+        break;
+    case HIP_C_32F:
+        RETURN_IF_HIPSPARSE_ERROR(solver_analysis<std::complex<float>>(handle, descr, matA));
+        break;
+    case HIP_C_64F:
+        RETURN_IF_HIPSPARSE_ERROR(solver_analysis<std::complex<double>>(handle, descr, matA));
+        break;
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    RETURN_IF_HIPSPARSE_ERROR(bypass.finish());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t hipsparseSolver_solve(hipsparseHandle_t          handle,
+                                        hipsparseSolverDescr_t     descr,
+                                        hipsparseConstSpMatDescr_t matA,
+                                        hipsparseConstDnVecDescr_t vecB,
+                                        hipsparseDnVecDescr_t      vecX,
+                                        hipDataType                computeType)
+{
+    HIPSPARSE_TRACE_SCOPE(handle, computeType);
+
+    if(handle == nullptr || descr == nullptr || matA == nullptr || vecB == nullptr
+       || vecX == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The analysis has to match the matrix
+    if(!descr->analyzed || descr->structure_version != matA->get_structure_version()
+       || descr->datatype != hipsparse::hipDataTypeToHCCDataType(computeType))
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    int64_t            rows;
+    int64_t            cols;
+    int64_t            nnz;
+    int64_t            size_b;
+    int64_t            size_x;
+    const void*        b_values;
+    void*              x_values;
+    rocsparse_datatype type_b;
+    rocsparse_datatype type_x;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_spmat_get_size(to_rocsparse_const_spmat_descr(matA), &rows, &cols, &nnz));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_const_dnvec_get(
+        to_rocsparse_const_dnvec_descr(vecB), &size_b, &b_values, &type_b));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_dnvec_get(to_rocsparse_dnvec_descr(vecX), &size_x, &x_values, &type_x));
+
+    if(rows != descr->n || nnz != descr->nnz || size_b != descr->n || size_x != descr->n
+       || type_b != descr->datatype || type_x != descr->datatype)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // The solvers read scalars back to decide on convergence, which cannot be captured
+    hipStream_t stream;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_stream((rocsparse_handle)handle, &stream));
+
+    hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
+    RETURN_IF_HIP_ERROR(hipStreamIsCapturing(stream, &capture_status));
+
+    if(capture_status != hipStreamCaptureStatusNone)
+    {
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+
+    solver_pointer_mode pointer_mode(handle);
+
+    switch(computeType)
+    {
+    case HIP_R_32F:
+        return solver_solve<float>(handle, descr, matA, b_values, x_values);
+    case HIP_R_64F:
+        return solver_solve<double>(handle, descr, matA, b_values, x_values);
+    case HIP_C_32F:
+        return solver_solve<std::complex<float>>(handle, descr, matA, b_values, x_values);
+    case HIP_C_64F:
+        return solver_solve<std::complex<double>>(handle, descr, matA, b_values, x_values);
+    default:
+        return HIPSPARSE_STATUS_NOT_SUPPORTED;
+    }
+}
+
+hipsparseStatus_t hipsparseSolver_getInfo(hipsparseSolverDescr_t descr,
+                                          int*                   iterations,
+                                          double*                residual,
+                                          int*                   converged)
+{
+    if(descr == nullptr || iterations == nullptr || residual == nullptr || converged == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    *iterations = descr->iterations;
+    *residual   = descr->residual;
+    *converged  = descr->converged ? 1 : 0;
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
+
+hipsparseStatus_t
+    hipsparseSolver_getHistory(hipsparseSolverDescr_t descr, int* historySize, double* history)
+{
+    if(descr == nullptr || historySize == nullptr)
+    {
+        return HIPSPARSE_STATUS_INVALID_VALUE;
+    }
+
+    // A null history queries the number of entries only
+    if(history != nullptr)
+    {
+        std::copy(descr->history.begin(), descr->history.end(), history);
+    }
+
+    *historySize = static_cast<int>(descr->history.size());
+
+    return HIPSPARSE_STATUS_SUCCESS;
+}
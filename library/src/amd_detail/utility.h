@@ -21,6 +21,12 @@
 *
 * ************************************************************************ */
 
+#include <memory>
+#include <vector>
+
+#include "generic/hipsparse_spmv_alg_select.h"
+#include "hipsparse_trace.h"
+
 #define TO_STR2(x) #x
 #define TO_STR(x) TO_STR2(x)
 
@@ -456,6 +462,27 @@ namespace hipsparse
         }
     }
 
+    inline size_t HCCDataTypeSize(rocsparse_datatype_ datatype)
+    {
+        switch(datatype)
+        {
+        case rocsparse_datatype_i8_r:
+            return sizeof(int8_t);
+        case rocsparse_datatype_i32_r:
+            return sizeof(int32_t);
+        case rocsparse_datatype_f32_r:
+            return sizeof(float);
+        case rocsparse_datatype_f64_r:
+            return sizeof(double);
+        case rocsparse_datatype_f32_c:
+            return sizeof(hipFloatComplex);
+        case rocsparse_datatype_f64_c:
+            return sizeof(hipDoubleComplex);
+        default:
+            throw "Non existent rocsparse_datatype";
+        }
+    }
+
     inline hipDataType HCCDataTypeToHIPDataType(rocsparse_datatype_ datatype)
     {
         switch(datatype)
@@ -626,6 +653,50 @@ namespace hipsparse
         }
     }
 
+    inline rocsparse_itilu0_alg_ hipItilu0AlgToHCCItilu0Alg(hipsparseItilu0Alg_t alg)
+    {
+        switch(alg)
+        {
+        case HIPSPARSE_ITILU0_ALG_DEFAULT:
+            return rocsparse_itilu0_alg_default;
+        case HIPSPARSE_ITILU0_ALG_ASYNC_INPLACE:
+            return rocsparse_itilu0_alg_async_inplace;
+        case HIPSPARSE_ITILU0_ALG_ASYNC_SPLIT:
+            return rocsparse_itilu0_alg_async_split;
+        case HIPSPARSE_ITILU0_ALG_SYNC_SPLIT:
+            return rocsparse_itilu0_alg_sync_split;
+        case HIPSPARSE_ITILU0_ALG_SYNC_SPLIT_FUSION:
+            return rocsparse_itilu0_alg_sync_split_fusion;
+        default:
+            throw "Non existent hipsparseItilu0Alg_t";
+        }
+    }
+
+    inline int hipItilu0OptionToHCCItilu0Option(int option)
+    {
+        int hcc_option = 0;
+
+        hcc_option
+            |= (option & HIPSPARSE_ITILU0_OPTION_VERBOSE) ? rocsparse_itilu0_option_verbose : 0;
+        hcc_option |= (option & HIPSPARSE_ITILU0_OPTION_STOPPING_CRITERIA)
+                          ? rocsparse_itilu0_option_stopping_criteria
+                          : 0;
+        hcc_option |= (option & HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_CORRECTION)
+                          ? rocsparse_itilu0_option_compute_nrm_correction
+                          : 0;
+        hcc_option |= (option & HIPSPARSE_ITILU0_OPTION_COMPUTE_NRM_RESIDUAL)
+                          ? rocsparse_itilu0_option_compute_nrm_residual
+                          : 0;
+        hcc_option |= (option & HIPSPARSE_ITILU0_OPTION_CONVERGENCE_HISTORY)
+                          ? rocsparse_itilu0_option_convergence_history
+                          : 0;
+        hcc_option |= (option & HIPSPARSE_ITILU0_OPTION_COO_FORMAT)
+                          ? rocsparse_itilu0_option_coo_format
+                          : 0;
+
+        return hcc_option;
+    }
+
     inline rocsparse_format_ hipFormatToHCCFormat(hipsparseFormat_t format)
     {
         switch(format)
@@ -640,6 +711,8 @@ namespace hipsparse
             return rocsparse_format_coo_aos;
         case HIPSPARSE_FORMAT_BLOCKED_ELL:
             return rocsparse_format_bell;
+        case HIPSPARSE_FORMAT_ELL:
+            return rocsparse_format_ell;
         default:
             throw "Non existent hipsparseFormat_t";
         }
@@ -659,27 +732,270 @@ namespace hipsparse
             return HIPSPARSE_FORMAT_COO_AOS;
         case rocsparse_format_bell:
             return HIPSPARSE_FORMAT_BLOCKED_ELL;
+        case rocsparse_format_ell:
+            return HIPSPARSE_FORMAT_ELL;
         default:
             throw "Non existent rocsparse_format";
         }
     }
+
+    //
+    // Strided batch of a dense vector. rocSPARSE dense vector descriptors do not carry a batch,
+    // it is stored in the hipSPARSE descriptor. Descriptors without a batch have a batch count
+    // of 1.
+    //
+    struct dnvec_strided_batch
+    {
+        int     batch_count{1};
+        int64_t batch_stride{};
+    };
+
+    dnvec_strided_batch get_dnvec_strided_batch(hipsparseConstDnVecDescr_t descr);
+
+    //
+    // Set the number of non-zeros of a CSR matrix computed outside of rocSPARSE.
+    //
+    hipsparseStatus_t set_csr_nnz(hipsparseSpMatDescr_t descr, int64_t nnz);
+
+    //
+    // Create a rocSPARSE descriptor that shares the arrays and attributes of source. rocSPARSE
+    // keeps the SpMV analysis of CSR and CSC matrices inside the descriptor, for all other
+    // formats clone is set to nullptr.
+    //
+    hipsparseStatus_t clone_spmat_descr(rocsparse_const_spmat_descr source,
+                                        rocsparse_spmat_descr*      clone);
+
+    //
+    // Returns HIPSPARSE_STATUS_NOT_SUPPORTED if stream is being captured into a graph. Routines
+    // that copy data to the host and synchronize cannot be captured.
+    //
+    hipsparseStatus_t check_stream_not_capturing(hipStream_t stream);
+
+    //
+    // Synchronize stream, the stream of handle, on behalf of the caller and count the
+    // synchronization in the counters of handle. Fails with HIPSPARSE_STATUS_NOT_SUPPORTED if the
+    // stream is being captured.
+    //
+    hipsparseStatus_t synchronize_stream(hipsparseHandle_t handle, hipStream_t stream);
+
+    //
+    // Copy sparse matrix indices between the device and zero based 64 bit indices on the host,
+    // on stream, the stream of handle. Both routines synchronize the stream through
+    // synchronize_stream.
+    //
+    hipsparseStatus_t copy_indices_to_host(hipsparseHandle_t     handle,
+                                           hipStream_t           stream,
+                                           const void*           indices,
+                                           hipsparseIndexType_t  indexType,
+                                           int64_t               size,
+                                           int64_t               base,
+                                           std::vector<int64_t>& host);
+    hipsparseStatus_t copy_indices_to_device(hipsparseHandle_t           handle,
+                                             hipStream_t                 stream,
+                                             const std::vector<int64_t>& host,
+                                             int64_t                     base,
+                                             hipsparseIndexType_t        indexType,
+                                             void*                       indices);
+
+    //
+    // Size of a value type of the host formats, 0 if the type is not supported.
+    //
+    size_t host_value_type_size(hipDataType valueType);
+
+    //
+    // Sparse CSR matrix with zero based row pointer on the host, the column indices and values
+    // stay on the device.
+    //
+    struct host_csr
+    {
+        int64_t              m{};
+        int64_t              n{};
+        int64_t              nnz{};
+        const void*          col_ind{};
+        const void*          val{};
+        hipsparseIndexType_t col_type{};
+        hipsparseIndexBase_t base{};
+        hipDataType          value_type{};
+        std::vector<int64_t> row_ptr{};
+    };
+
+    //
+    // Copy the row pointer of a CSR matrix to the host. Returns HIPSPARSE_STATUS_NOT_SUPPORTED if
+    // the matrix is not a CSR matrix.
+    //
+    hipsparseStatus_t copy_csr_to_host(hipsparseHandle_t          handle,
+                                       hipStream_t                stream,
+                                       hipsparseConstSpMatDescr_t matCsr,
+                                       host_csr&                  A);
+
+    //
+    // Sparse matrix stored in a format rocSPARSE does not support. The arrays are owned by the
+    // user and only referenced by the hipSPARSE descriptor. SpMV and SpMM are not supported with
+    // such a matrix.
+    //
+    // SELL: slice_size consecutive rows of the (row permuted) matrix form a slice. Slice s stores
+    // its entries column by column, starting at slice_offsets[s], and is padded to the length of
+    // its longest row with column index -1. Position p of the permuted matrix holds row
+    // row_perm[p] of the matrix, or row p if row_perm is null.
+    //
+    // DIA: diagonal d holds the entries A(i, i + dia_offsets[d]) at values[d * rows + i], width
+    // is the number of diagonals. Positions outside of the matrix are padding.
+    //
+    // ELL: only used as a host view of a rocSPARSE ELL matrix. Entry k of row i is stored at
+    // k * rows + i, width is the number of entries per row and padding has column index -1.
+    //
+    // CSR: only used as a host view of a rocSPARSE CSR matrix. row_ptr has the type
+    // row_index_type and col_ind the type index_type.
+    //
+    struct host_spmat
+    {
+        hipsparseFormat_t     format{};
+        int64_t               rows{};
+        int64_t               cols{};
+        int64_t               nnz{};
+        int64_t               values_size{};
+        int64_t               slice_size{};
+        int64_t               width{};
+        void*                 slice_offsets{};
+        void*                 dia_offsets{};
+        void*                 row_ptr{};
+        void*                 col_ind{};
+        void*                 values{};
+        void*                 row_perm{};
+        hipsparseIndexType_t  index_type{};
+        hipsparseIndexType_t  row_index_type{};
+        hipsparseIndexBase_t  idx_base{};
+        hipDataType           value_type{};
+        hipsparseMatrixType_t matrix_type{HIPSPARSE_MATRIX_TYPE_GENERAL};
+        hipsparseFillMode_t   fill_mode{HIPSPARSE_FILL_MODE_LOWER};
+        hipsparseDiagType_t   diag_type{HIPSPARSE_DIAG_TYPE_NON_UNIT};
+    };
+
+    //
+    // Device CSR matrix with the entries of a host_spmat. map holds the position of each entry in
+    // the values array of the host_spmat, gather moves the values through it into val.
+    //
+    struct device_csr
+    {
+        int64_t               nnz{};
+        void*                 row_ptr{};
+        void*                 col_ind{};
+        void*                 val{};
+        void*                 map{};
+        rocsparse_spmat_descr mat{};
+        rocsparse_spvec_descr gather{};
+    };
+
+    //
+    // Device copy of the structure of a general ELL matrix, built once per structure version of
+    // its descriptor. Each product gathers the current values into csr and multiplies it with
+    // rocSPARSE, without copying any data to the host. The preprocessed bits record the
+    // operations rocSPARSE has been prepared for.
+    //
+    struct device_spmat
+    {
+        int64_t               structure_version{-1};
+        device_csr            csr{};
+        rocsparse_dnvec_descr values{};
+        size_t                buffer_size{};
+        void*                 buffer{};
+        uint32_t              spmm_preprocessed{};
+
+        device_spmat() = default;
+        device_spmat(const device_spmat&)            = delete;
+        device_spmat& operator=(const device_spmat&) = delete;
+        ~device_spmat();
+    };
+
+    //
+    // SpMM with matA, a host view of the general ELL matrix of descr. The device copy of matA is
+    // built on the first call, the setup runs on a side stream if the handle stream is being
+    // captured into a graph.
+    //
+    hipsparseStatus_t host_spmat_spmm(hipsparseHandle_t          handle,
+                                      hipsparseOperation_t       opA,
+                                      hipsparseOperation_t       opB,
+                                      const void*                alpha,
+                                      hipsparseConstSpMatDescr_t descr,
+                                      const host_spmat&          matA,
+                                      hipsparseConstDnMatDescr_t matB,
+                                      const void*                beta,
+                                      hipsparseDnMatDescr_t      matC,
+                                      hipDataType                computeType);
+
+    //
+    // Build the device copy of matA ahead of the first product, called by the preprocessing of
+    // SpMM.
+    //
+    hipsparseStatus_t host_spmat_prepare(hipsparseHandle_t          handle,
+                                         hipsparseConstSpMatDescr_t descr,
+                                         const host_spmat&          matA);
+
+    //
+    // Host view of a rocSPARSE ELL matrix.
+    //
+    hipsparseStatus_t get_ell_host_spmat(hipsparseConstSpMatDescr_t descr, host_spmat& ell);
+
+    //
+    // Host view of a rocSPARSE CSR matrix.
+    //
+    hipsparseStatus_t get_csr_host_spmat(hipsparseConstSpMatDescr_t descr, host_spmat& csr);
+
+    //
+    // Matrix type and fill mode of a sparse matrix descriptor, of the host matrix for formats
+    // rocSPARSE does not support.
+    //
+    hipsparseStatus_t get_spmat_matrix_type(hipsparseConstSpMatDescr_t descr,
+                                            hipsparseMatrixType_t*     matrixType,
+                                            hipsparseFillMode_t*       fillMode);
+
+    //
+    // Conversion of a host format matrix, or of a host view, into CSR. The number of non-zeros
+    // step writes the row offsets with the index type and base of A, the second step fills the
+    // CSR matrix. Entries with a zero value are dropped if drop_zeros is set, DIA matrices cannot
+    // tell them apart from the padding otherwise.
+    //
+    hipsparseStatus_t host_spmat_csr_nnz(hipsparseHandle_t handle,
+                                         const host_spmat& A,
+                                         bool              drop_zeros,
+                                         void*             csrRowOffsets,
+                                         int64_t*          csrNnz);
+    hipsparseStatus_t host_spmat_to_csr(hipsparseHandle_t     handle,
+                                        const host_spmat&     A,
+                                        bool                  drop_zeros,
+                                        hipsparseSpMatDescr_t matCsr);
 }
 
 struct hipsparseSpMVDescr_st
 {
 protected:
     rocsparse_spmat_descr m_spmv_descr{};
-    bool                 m_is_stage_analysis_called{};
-    bool                 m_is_implicit_stage_analysis_called{};
-    size_t               m_buffer_size_stage_analysis{};
-    size_t               m_buffer_size_stage_compute{};
-    void*                m_buffer{};
-    bool                 m_is_stage_compute_subsequent{};
-    bool                 m_is_buffer_size_called{};
+    rocsparse_operation   m_operation{};
+    rocsparse_spmv_alg    m_alg{};
+    rocsparse_datatype    m_datatype{};
+    bool                  m_is_stage_analysis_called{};
+    bool                  m_is_implicit_stage_analysis_called{};
+    size_t                m_buffer_size_stage_analysis{};
+    size_t                m_buffer_size_stage_compute{};
+    void*                 m_buffer{};
+    bool                  m_is_stage_compute_subsequent{};
+    bool                  m_is_buffer_size_called{};
+    bool                  m_is_alg_selected{};
+    rocsparse_spmv_alg    m_selected_alg{};
+    void*                 m_coo_row_ind{};
+    bool                  m_is_batched_stage_preprocess_called{};
+    void*                 m_batched_buffer{};
+    size_t                m_dot_buffer_size{};
+    void*                 m_dot_buffer{};
+    hipStream_t           m_stream{};
 
 public:
     rocsparse_spmat_descr get_spmv_descr();
-    void                 set_spmv_descr(rocsparse_spmat_descr value);
+    void                  set_spmv_descr(rocsparse_spmat_descr value);
+
+    bool is_plan(rocsparse_operation operation,
+                 rocsparse_spmv_alg  alg,
+                 rocsparse_datatype  datatype) const;
 
     bool is_stage_analysis_called() const;
     void stage_analysis_called();
@@ -704,21 +1020,109 @@ public:
 
     void** get_buffer_reference();
 
+    bool               is_alg_selected() const;
+    rocsparse_spmv_alg get_selected_alg() const;
+    void               set_selected_alg(rocsparse_spmv_alg value);
+
+    void* get_coo_row_ind();
+    void  set_coo_row_ind(void* value);
+
+    //
+    // The strided batched SpMV is preprocessed with the external buffer of the user, which is
+    // not owned by the plan. get_batched_buffer returns the buffer of the last preprocessing.
+    //
+    bool  is_batched_stage_preprocess_called() const;
+    void  batched_stage_preprocess_called(void* buffer);
+    void* get_batched_buffer();
+
+    size_t get_dot_buffer_size() const;
+    void   set_dot_buffer_size(size_t value);
+
+    void*  get_dot_buffer();
+    void** get_dot_buffer_reference();
+
+    //
+    // Stream of the last product that used the buffers of the plan, they are released on it.
+    //
+    hipStream_t get_stream() const;
+    void        set_stream(hipStream_t value);
+
     hipsparseSpMVDescr_st() = default;
+    hipsparseSpMVDescr_st(rocsparse_operation operation,
+                          rocsparse_spmv_alg  alg,
+                          rocsparse_datatype  datatype);
+    hipsparseSpMVDescr_st(const hipsparseSpMVDescr_st&)            = delete;
+    hipsparseSpMVDescr_st& operator=(const hipsparseSpMVDescr_st&) = delete;
     ~hipsparseSpMVDescr_st();
 };
 
 struct hipsparseSpMatDescr_st
 {
 protected:
-    rocsparse_spmat_descr         m_spmat_descr{};
-    mutable hipsparseSpMVDescr_st m_hip_spmv_descr{};
+    //
+    // Maximum number of analyzed SpMV plans kept per sparse matrix descriptor.
+    //
+    static constexpr size_t s_spmv_descr_cache_capacity = 8;
+
+    rocsparse_spmat_descr m_spmat_descr{};
+
+    //
+    // SpMV plans keyed by (operation, algorithm, compute type), the most recently used plan
+    // is stored last.
+    //
+    mutable std::vector<std::unique_ptr<hipsparseSpMVDescr_st>> m_hip_spmv_descr_cache{};
+
+    //
+    // Incremented each time the sparsity pattern pointers of the descriptor change. Analysis data
+    // attached to the descriptor is only valid for the structure version it was computed for.
+    //
+    int64_t m_structure_version{};
+
+    //
+    // Row length statistics used to select the default SpMV algorithm, valid for the structure
+    // version they were computed for.
+    //
+    mutable hipsparse::spmv_row_statistics m_row_statistics{};
+    mutable int64_t                        m_row_statistics_version{-1};
+
+    //
+    // Structural statistics returned by hipsparseSpMatGetStatistics, valid for the structure
+    // version they were computed for.
+    //
+    mutable hipsparseSpMatStatistics_t m_statistics{};
+    mutable int64_t                    m_statistics_version{-1};
+
+    //
+    // Matrix in a format rocSPARSE does not support, m_spmat_descr is null if set.
+    //
+    std::unique_ptr<hipsparse::host_spmat> m_host_spmat{};
+
+    //
+    // Device copy of an ELL matrix for SpMM, which rocsparse_spmm does not accept, valid for the
+    // structure version it was built for.
+    //
+    mutable std::unique_ptr<hipsparse::device_spmat> m_device_spmat{};
 
 public:
     hipsparseSpMatDescr_st()  = default;
     ~hipsparseSpMatDescr_st() = default;
-    hipsparseSpMVDescr_st*       get_hip_spmv_descr();
-    hipsparseSpMVDescr_st*       get_hip_spmv_descr() const;
+    hipsparseSpMVDescr_st*       get_hip_spmv_descr(rocsparse_operation operation,
+                                                    rocsparse_spmv_alg  alg,
+                                                    rocsparse_datatype  datatype) const;
+    void                         clear_hip_spmv_descr_cache();
+    int64_t                      get_structure_version() const;
+    void                         structure_changed();
+    bool                         has_row_statistics() const;
+    const hipsparse::spmv_row_statistics& get_row_statistics() const;
+    void set_row_statistics(const hipsparse::spmv_row_statistics& value) const;
+    bool                              has_statistics() const;
+    const hipsparseSpMatStatistics_t& get_statistics() const;
+    void                              set_statistics(const hipsparseSpMatStatistics_t& value) const;
+    const hipsparse::host_spmat*      get_host_spmat() const;
+    hipsparse::host_spmat*            get_host_spmat();
+    void set_host_spmat(std::unique_ptr<hipsparse::host_spmat> value);
+    hipsparse::device_spmat*          get_device_spmat() const;
+    void set_device_spmat(std::unique_ptr<hipsparse::device_spmat> value) const;
     rocsparse_spmat_descr        get_spmat_descr();
     rocsparse_const_spmat_descr  get_const_spmat_descr() const;
     rocsparse_spmat_descr*       get_spmat_descr_reference();
@@ -728,3 +1132,30 @@ public:
 
 rocsparse_spmat_descr       to_rocsparse_spmat_descr(const hipsparseSpMatDescr_t source);
 rocsparse_const_spmat_descr to_rocsparse_const_spmat_descr(const hipsparseConstSpMatDescr_t source);
+
+struct hipsparseDnVecDescr_st
+{
+protected:
+    rocsparse_dnvec_descr m_dnvec_descr{};
+
+    //
+    // Strided batch set with hipsparseDnVecSetStridedBatch.
+    //
+    hipsparse::dnvec_strided_batch m_strided_batch{};
+
+public:
+    hipsparseDnVecDescr_st()  = default;
+    ~hipsparseDnVecDescr_st() = default;
+    const hipsparse::dnvec_strided_batch& get_strided_batch() const;
+    void                         set_strided_batch(const hipsparse::dnvec_strided_batch& value);
+    rocsparse_dnvec_descr        get_dnvec_descr();
+    rocsparse_const_dnvec_descr  get_const_dnvec_descr() const;
+    rocsparse_dnvec_descr*       get_dnvec_descr_reference();
+    rocsparse_const_dnvec_descr* get_const_dnvec_descr_reference();
+};
+
+//
+// hipsparseDnVecDescr_t is an opaque pointer to hipsparseDnVecDescr_st.
+//
+rocsparse_dnvec_descr       to_rocsparse_dnvec_descr(const hipsparseDnVecDescr_t source);
+rocsparse_const_dnvec_descr to_rocsparse_const_dnvec_descr(const hipsparseConstDnVecDescr_t source);